@@ -82,6 +82,15 @@ TracyOption = Annotated[
     bool, Option("--tracy", help="Run the binary with the TRACY_ENABLE macro defined")
 ]
 
+TrackAllocationsOption = Annotated[
+    bool,
+    Option(
+        "--track_allocations",
+        help="Count the heap allocations made by each stage of every AI tick, and "
+        "report them to Tracy's memory profiler when combined with --tracy",
+    ),
+]
+
 TestSuiteOption = Annotated[
     bool,
     Option("--suite", help="Run entire test suite instead of searching for a target"),
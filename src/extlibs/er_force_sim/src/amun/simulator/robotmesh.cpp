@@ -133,3 +133,20 @@ camun::simulator::createRobotMesh(float radius, float height, float angle,
 
     return meshParts;
 }
+
+std::vector<std::vector<std::tuple<float, float, float>>>
+camun::simulator::createSimpleRobotMesh(float radius, float height, float angle,
+                                        float holeDepth)
+{
+    static constexpr unsigned int NUM_SEGMENTS_HULL = 8;
+
+    // The convex hull of the shell points is cut off flat between the first and last
+    // point, at the back of the dribbler hole (see createRobotMesh)
+    const float holePlatePos    = radius * std::cos(angle / 2.0) - holeDepth;
+    const float halfOuterAngle  = std::acos(holePlatePos / radius);
+    const float outerAngleStart = halfOuterAngle + M_PI_2;
+    const float outerAngleStop  = 2.0 * M_PI - halfOuterAngle + M_PI_2;
+
+    return {generateRobotShellPoints(NUM_SEGMENTS_HULL, outerAngleStart, outerAngleStop,
+                                     radius, height)};
+}
@@ -30,6 +30,20 @@ namespace simulator
 {
 std::vector<std::vector<std::tuple<float, float, float>>> createRobotMesh(
     float radius, float height, float angle, float holeDepth, float holeHeight);
+
+/**
+ * Creates a cheaper robot mesh made of a single convex hull with fewer segments, where
+ * the dribbler hole spans the whole height of the robot
+ *
+ * @param radius the radius of the robot
+ * @param height the height of the robot
+ * @param angle the angle of the front plate of the robot
+ * @param holeDepth the depth of the dribbler hole
+ *
+ * @return the points of the convex hull
+ */
+std::vector<std::vector<std::tuple<float, float, float>>> createSimpleRobotMesh(
+    float radius, float height, float angle, float holeDepth);
 }  // namespace simulator
 }  // namespace camun
 
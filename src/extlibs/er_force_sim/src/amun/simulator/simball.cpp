@@ -28,6 +28,44 @@
 
 using namespace camun::simulator;
 
+RigidBodyState camun::simulator::captureRigidBodyState(const btRigidBody& body)
+{
+    return RigidBodyState{
+        .transform        = body.getWorldTransform(),
+        .linearVelocity   = body.getLinearVelocity(),
+        .angularVelocity  = body.getAngularVelocity(),
+        .activationState  = body.getActivationState(),
+        .deactivationTime = body.getDeactivationTime(),
+    };
+}
+
+void camun::simulator::restoreRigidBodyState(btRigidBody& body,
+                                             const RigidBodyState& state,
+                                             btDiscreteDynamicsWorld& world)
+{
+    body.setWorldTransform(state.transform);
+    body.setInterpolationWorldTransform(state.transform);
+    if (body.getMotionState())
+    {
+        body.getMotionState()->setWorldTransform(state.transform);
+    }
+    body.setLinearVelocity(state.linearVelocity);
+    body.setAngularVelocity(state.angularVelocity);
+    body.setInterpolationLinearVelocity(state.linearVelocity);
+    body.setInterpolationAngularVelocity(state.angularVelocity);
+    body.clearForces();
+    body.forceActivationState(state.activationState);
+    body.setDeactivationTime(state.deactivationTime);
+
+    // contact points cached for the old position are invalid after teleporting the body
+    if (body.getBroadphaseHandle())
+    {
+        world.getBroadphase()->getOverlappingPairCache()->cleanProxyFromPairs(
+            body.getBroadphaseHandle(), world.getDispatcher());
+        world.updateSingleAabb(&body);
+    }
+}
+
 SimBall::SimBall(std::shared_ptr<btDiscreteDynamicsWorld> world)
     : m_world(world),
       m_rolling_speed(-1.0f),
@@ -425,6 +463,28 @@ void SimBall::restoreState(const world::SimBall& ball)
     m_body->setAngularVelocity(angular);
 }
 
+SimBall::Snapshot SimBall::createSnapshot() const
+{
+    return Snapshot{
+        .body               = captureRigidBodyState(*m_body),
+        .rng                = m_rng,
+        .move               = m_move,
+        .rollingSpeed       = m_rolling_speed,
+        .setTransitionSpeed = m_set_transition_speed,
+        .currentBallState   = m_current_ball_state,
+    };
+}
+
+void SimBall::restoreSnapshot(const Snapshot& snapshot)
+{
+    restoreRigidBodyState(*m_body, snapshot.body, *m_world);
+    m_rng                  = snapshot.rng;
+    m_move                 = snapshot.move;
+    m_rolling_speed        = snapshot.rollingSpeed;
+    m_set_transition_speed = snapshot.setTransitionSpeed;
+    m_current_ball_state   = snapshot.currentBallState;
+}
+
 bool SimBall::isInvalid() const
 {
     const btTransform transform = m_body->getWorldTransform();
@@ -34,12 +34,44 @@ namespace camun
 namespace simulator
 {
 class SimBall;
+struct RigidBodyState;
+
+/**
+ * Captures the full dynamic state of a rigid body, so that it can be restored later
+ *
+ * @param body the body to capture the state of
+ *
+ * @return the state of the body
+ */
+RigidBodyState captureRigidBodyState(const btRigidBody& body);
+
+/**
+ * Restores the dynamic state of a rigid body and drops its cached contact points, so
+ * that stepping the world afterwards does not depend on where the body was before
+ *
+ * @param body the body to restore the state of
+ * @param state the state to restore
+ * @param world the world the body is in
+ */
+void restoreRigidBodyState(btRigidBody& body, const RigidBodyState& state,
+                           btDiscreteDynamicsWorld& world);
 }  // namespace simulator
 }  // namespace camun
 
+struct camun::simulator::RigidBodyState
+{
+    btTransform transform;
+    btVector3 linearVelocity;
+    btVector3 angularVelocity;
+    int activationState;
+    btScalar deactivationTime;
+};
+
 class camun::simulator::SimBall
 {
    public:
+    struct Snapshot;
+
     SimBall(std::shared_ptr<btDiscreteDynamicsWorld> world);
     ~SimBall();
 
@@ -78,6 +110,21 @@ class camun::simulator::SimBall
 
     void restoreState(const world::SimBall& ball);
 
+    /**
+     * Captures the complete state of the ball, including its random number generator
+     * and rolling model, at full precision
+     *
+     * @return the snapshot of the ball
+     */
+    Snapshot createSnapshot() const;
+
+    /**
+     * Restores the ball to a snapshot created by createSnapshot
+     *
+     * @param snapshot the snapshot to restore
+     */
+    void restoreSnapshot(const Snapshot& snapshot);
+
     btRigidBody* body() const
     {
         return m_body.get();
@@ -112,4 +159,14 @@ class camun::simulator::SimBall
     BallState m_current_ball_state;
 };
 
+struct camun::simulator::SimBall::Snapshot
+{
+    RigidBodyState body;
+    RNG rng;
+    sslsim::TeleportBall move;
+    double rollingSpeed;
+    bool setTransitionSpeed;
+    BallState currentBallState;
+};
+
 #endif  // SIMBALL_H
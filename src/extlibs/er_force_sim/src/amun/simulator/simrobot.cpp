@@ -33,7 +33,7 @@ const float MAX_SPEED = 1000;
 
 SimRobot::SimRobot(const robot::Specs& specs,
                    std::shared_ptr<btDiscreteDynamicsWorld> world, const btVector3& pos,
-                   float dir)
+                   float dir, bool simpleMesh)
     : m_specs(specs),
       m_world(world),
       m_charge(false),
@@ -50,10 +50,12 @@ SimRobot::SimRobot(const robot::Specs& specs,
     robotShapeTransform.setIdentity();
 
     // subtract collision margin from dimensions
-    auto mesh =
-        createRobotMesh(m_specs.radius() - COLLISION_MARGIN / SIMULATOR_SCALE,
-                        m_specs.height() - 2 * COLLISION_MARGIN / SIMULATOR_SCALE,
-                        m_specs.angle(), 0.04f, m_specs.dribbler_height() + 0.02f);
+    const float meshRadius = m_specs.radius() - COLLISION_MARGIN / SIMULATOR_SCALE;
+    const float meshHeight = m_specs.height() - 2 * COLLISION_MARGIN / SIMULATOR_SCALE;
+    auto mesh = simpleMesh ? createSimpleRobotMesh(meshRadius, meshHeight,
+                                                   m_specs.angle(), 0.04f)
+                           : createRobotMesh(meshRadius, meshHeight, m_specs.angle(),
+                                             0.04f, m_specs.dribbler_height() + 0.02f);
     for (const auto& hullPart : mesh)
     {
         std::unique_ptr<btConvexHullShape> hullPartShape =
@@ -210,6 +212,11 @@ void SimRobot::setDribbleMode(bool perfectDribbler)
     m_perfectDribbler = perfectDribbler;
 }
 
+void SimRobot::setDeactivateWhenResting(bool deactivateWhenResting)
+{
+    m_deactivateWhenResting = deactivateWhenResting;
+}
+
 void SimRobot::begin(SimBall& ball, double time)
 {
     m_commandTime += time;
@@ -472,6 +479,16 @@ void SimRobot::begin(SimBall& ball, double time)
     float v_s   = v_local.x() / SIMULATOR_SCALE;
     float omega = m_body->getAngularVelocity().z();
 
+    // tiny correcting forces would keep waking up a robot that stands still
+    const float RESTING_SPEED         = 0.01f;
+    const float RESTING_ANGULAR_SPEED = 0.05f;
+    if (m_deactivateWhenResting && output_v_f == 0 && output_v_s == 0 &&
+        output_omega == 0 && std::abs(v_f) < RESTING_SPEED &&
+        std::abs(v_s) < RESTING_SPEED && std::abs(omega) < RESTING_ANGULAR_SPEED)
+    {
+        return;
+    }
+
     const float error_v_s   = v_d_local.x() - v_s;
     const float error_v_f   = v_d_local.y() - v_f;
     const float error_omega = std::clamp(output_omega, -MAX_SPEED, MAX_SPEED) - omega;
@@ -759,6 +776,45 @@ void SimRobot::restoreState(const world::SimRobot& robot)
     m_body->setAngularVelocity(angular);
 }
 
+SimRobot::Snapshot SimRobot::createSnapshot() const
+{
+    return Snapshot{
+        .body          = captureRigidBodyState(*m_body),
+        .dribblerBody  = captureRigidBodyState(*m_dribblerBody),
+        .rng           = m_rng,
+        .move          = m_move,
+        .sslCommand    = m_sslCommand,
+        .charge        = m_charge,
+        .isCharged     = m_isCharged,
+        .inStandby     = m_inStandby,
+        .shootTime     = m_shootTime,
+        .commandTime   = m_commandTime,
+        .errorSumVS    = m_error_sum_v_s,
+        .errorSumVF    = m_error_sum_v_f,
+        .errorSumOmega = m_error_sum_omega,
+        .lastSendTime  = m_lastSendTime,
+    };
+}
+
+void SimRobot::restoreSnapshot(const Snapshot& snapshot)
+{
+    stopDribbling();
+    restoreRigidBodyState(*m_body, snapshot.body, *m_world);
+    restoreRigidBodyState(*m_dribblerBody, snapshot.dribblerBody, *m_world);
+    m_rng             = snapshot.rng;
+    m_move            = snapshot.move;
+    m_sslCommand      = snapshot.sslCommand;
+    m_charge          = snapshot.charge;
+    m_isCharged       = snapshot.isCharged;
+    m_inStandby       = snapshot.inStandby;
+    m_shootTime       = snapshot.shootTime;
+    m_commandTime     = snapshot.commandTime;
+    m_error_sum_v_s   = snapshot.errorSumVS;
+    m_error_sum_v_f   = snapshot.errorSumVF;
+    m_error_sum_omega = snapshot.errorSumOmega;
+    m_lastSendTime    = snapshot.lastSendTime;
+}
+
 void SimRobot::move(const sslsim::TeleportRobot& robot)
 {
     m_move = robot;
@@ -42,8 +42,10 @@ class SimRobot;
 class camun::simulator::SimRobot
 {
    public:
+    struct Snapshot;
+
     SimRobot(const robot::Specs& specs, std::shared_ptr<btDiscreteDynamicsWorld> world,
-             const btVector3& pos, float dir);
+             const btVector3& pos, float dir, bool simpleMesh = false);
     ~SimRobot();
 
    public:
@@ -64,6 +66,22 @@ class camun::simulator::SimRobot
 
     void restoreState(const world::SimRobot& robot);
 
+    /**
+     * Captures the complete state of the robot, including its dribbler, random number
+     * generator and last command, at full precision
+     *
+     * @return the snapshot of the robot
+     */
+    Snapshot createSnapshot() const;
+
+    /**
+     * Restores the robot to a snapshot created by createSnapshot. A ball held by a
+     * perfect dribbler is released, and picked up again on the next simulator tick.
+     *
+     * @param snapshot the snapshot to restore
+     */
+    void restoreSnapshot(const Snapshot& snapshot);
+
     void move(const sslsim::TeleportRobot& robot);
 
     bool isFlipped();
@@ -79,6 +97,14 @@ class camun::simulator::SimRobot
 
     void setDribbleMode(bool perfectDribbler);
 
+    /**
+     * Sets whether the robot stops applying correcting forces while it is commanded to
+     * stand still and already does, so that Bullet can put it to sleep
+     *
+     * @param deactivateWhenResting whether the robot may be put to sleep when resting
+     */
+    void setDeactivateWhenResting(bool deactivateWhenResting);
+
     void stopDribbling();
 
     const robot::Specs& specs() const
@@ -126,9 +152,28 @@ class camun::simulator::SimRobot
     float m_error_sum_v_f;
     float m_error_sum_omega;
 
-    bool m_perfectDribbler = false;
+    bool m_perfectDribbler       = false;
+    bool m_deactivateWhenResting = false;
 
     int64_t m_lastSendTime = 0;
 };
 
+struct camun::simulator::SimRobot::Snapshot
+{
+    RigidBodyState body;
+    RigidBodyState dribblerBody;
+    RNG rng;
+    sslsim::TeleportRobot move;
+    SSLSimulationProto::RobotCommand sslCommand;
+    bool charge;
+    bool isCharged;
+    bool inStandby;
+    double shootTime;
+    double commandTime;
+    float errorSumVS;
+    float errorSumVF;
+    float errorSumOmega;
+    int64_t lastSendTime;
+};
+
 #endif  // SIMROBOT_H
@@ -28,8 +28,9 @@
 
 using namespace camun::simulator;
 
-Simulator::Simulator(const amun::SimulatorSetup& setup)
+Simulator::Simulator(const amun::SimulatorSetup& setup, const SimulatorFidelity& fidelity)
     : m_data(std::make_unique<SimulatorData>()),
+      m_fidelity(fidelity),
       m_enabled(false),
       m_charge(true),
       m_time(0),
@@ -40,7 +41,7 @@ Simulator::Simulator(const amun::SimulatorSetup& setup)
     m_data->dispatcher = std::make_unique<btCollisionDispatcher>(m_data->collision.get());
     m_data->overlappingPairCache = std::make_unique<btDbvtBroadphase>();
     m_data->solver        = std::make_unique<btSequentialImpulseConstraintSolver>();
-    m_data->dynamicsWorld = std::make_shared<btDiscreteDynamicsWorld>(
+    m_data->dynamicsWorld = std::make_shared<SimDynamicsWorld>(
         m_data->dispatcher.get(), m_data->overlappingPairCache.get(),
         m_data->solver.get(), m_data->collision.get());
     m_data->dynamicsWorld->setGravity(btVector3(0.0f, 0.0f, -9.81f * SIMULATOR_SCALE));
@@ -134,6 +135,16 @@ std::vector<robot::RadioResponse> Simulator::acceptRobotControlCommand(
     return responses;
 }
 
+std::unique_ptr<SimRobot> Simulator::createRobot(const robot::Specs& specs,
+                                                 const btVector3& pos, float dir)
+{
+    auto robot = std::make_unique<SimRobot>(specs, m_data->dynamicsWorld, pos, dir,
+                                            m_fidelity.simpleRobotMesh);
+    robot->setDribbleMode(m_data->dribblePerfect);
+    robot->setDeactivateWhenResting(m_fidelity.deactivateRestingRobots);
+    return robot;
+}
+
 void Simulator::resetFlipped(Simulator::RobotMap& robots, float side)
 {
     // find flipped robots and align them on a line
@@ -144,9 +155,7 @@ void Simulator::resetFlipped(Simulator::RobotMap& robots, float side)
     {
         if (robot->isFlipped())
         {
-            robot = std::make_unique<SimRobot>(robot->specs(), m_data->dynamicsWorld,
-                                               btVector3(x, side * y, 0), 0.0f);
-            robot->setDribbleMode(m_data->dribblePerfect);
+            robot = createRobot(robot->specs(), btVector3(x, side * y, 0), 0.0f);
         }
         y -= 0.3;
     }
@@ -154,7 +163,7 @@ void Simulator::resetFlipped(Simulator::RobotMap& robots, float side)
 
 void Simulator::stepSimulation(double time_s)
 {
-    m_data->dynamicsWorld->stepSimulation(time_s, 10, SUB_TIMESTEP);
+    m_data->dynamicsWorld->stepSimulation(time_s, 10, m_fidelity.subTimestep);
     m_time += time_s * 1E9;
 }
 
@@ -245,6 +254,11 @@ static btVector3 positionOffsetForCamera(float offsetStrength, btVector3 cameraP
 
 std::vector<SSLProto::SSL_WrapperPacket> Simulator::getWrapperPackets()
 {
+    if (m_wrapperPacketCalls++ % std::max(m_fidelity.cameraPacketDecimation, 1u) != 0)
+    {
+        return {};
+    }
+
     const std::size_t numCameras = m_data->reportedCameraSetup.size();
 
     std::vector<SSLProto::SSL_DetectionFrame> detections(numCameras);
@@ -463,9 +477,7 @@ void Simulator::setTeam(Simulator::RobotMap& robotMap, float side,
         }
         teamSpecs[id].CopyFrom(specs);
 
-        robotMap[id] = std::make_unique<SimRobot>(teamSpecs[id], m_data->dynamicsWorld,
-                                                  btVector3(x, side * y, 0), 0.f);
-        robotMap[id]->setDribbleMode(m_data->dribblePerfect);
+        robotMap[id] = createRobot(teamSpecs[id], btVector3(x, side * y, 0), 0.f);
 
         y -= 0.3;
     }
@@ -547,10 +559,9 @@ void Simulator::moveRobot(const sslsim::TeleportRobot& robot)
                 coordinates::fromVision(robot, targetPos);
                 // TODO: check if the given position is fine
 
-                robotMap[robot.id().id()] = std::make_unique<SimRobot>(
-                    teamSpecs[robot.id().id()], m_data->dynamicsWorld,
-                    btVector3(targetPos.x, targetPos.y, 0), 0.f);
-                robotMap[robot.id().id()]->setDribbleMode(m_data->dribblePerfect);
+                robotMap[robot.id().id()] =
+                    createRobot(teamSpecs[robot.id().id()],
+                                btVector3(targetPos.x, targetPos.y, 0), 0.f);
             }
         }
         else if (!robot.present() && isPresent)
@@ -593,6 +604,83 @@ void Simulator::moveRobot(const sslsim::TeleportRobot& robot)
     robotMap[robot.id().id()]->move(r);
 }
 
+Simulator::Snapshot Simulator::createSnapshot() const
+{
+    Snapshot snapshot{
+        .ball                  = m_data->ball->createSnapshot(),
+        .specsBlue             = m_data->specsBlue,
+        .specsYellow           = m_data->specsYellow,
+        .rng                   = m_data->rng,
+        .localTime             = m_data->dynamicsWorld->getLocalTime(),
+        .charge                = m_charge,
+        .time                  = m_time,
+        .minRobotDetectionTime = m_minRobotDetectionTime,
+        .minBallDetectionTime  = m_minBallDetectionTime,
+        .lastBallSendTime      = m_lastBallSendTime,
+        .wrapperPacketCalls    = m_wrapperPacketCalls,
+        .lastFrameNumber       = m_lastFrameNumber,
+        .randShuffleSrc        = rand_shuffle_src,
+    };
+    for (const auto& [robotId, robot] : m_data->robotsBlue)
+    {
+        snapshot.robotsBlue.emplace(robotId, robot->createSnapshot());
+    }
+    for (const auto& [robotId, robot] : m_data->robotsYellow)
+    {
+        snapshot.robotsYellow.emplace(robotId, robot->createSnapshot());
+    }
+    return snapshot;
+}
+
+void Simulator::restoreSnapshot(const Snapshot& snapshot)
+{
+    m_data->specsBlue   = snapshot.specsBlue;
+    m_data->specsYellow = snapshot.specsYellow;
+    restoreTeam(m_data->robotsBlue, snapshot.robotsBlue, m_data->specsBlue);
+    restoreTeam(m_data->robotsYellow, snapshot.robotsYellow, m_data->specsYellow);
+    m_data->ball->restoreSnapshot(snapshot.ball);
+    m_data->rng = snapshot.rng;
+    m_data->dynamicsWorld->setLocalTime(snapshot.localTime);
+
+    m_charge                = snapshot.charge;
+    m_time                  = snapshot.time;
+    m_minRobotDetectionTime = snapshot.minRobotDetectionTime;
+    m_minBallDetectionTime  = snapshot.minBallDetectionTime;
+    m_lastBallSendTime      = snapshot.lastBallSendTime;
+    m_wrapperPacketCalls    = snapshot.wrapperPacketCalls;
+    m_lastFrameNumber       = snapshot.lastFrameNumber;
+    rand_shuffle_src        = snapshot.randShuffleSrc;
+}
+
+void Simulator::restoreTeam(Simulator::RobotMap& robots,
+                            const std::map<unsigned int, SimRobot::Snapshot>& snapshots,
+                            const std::map<uint32_t, robot::Specs>& specs)
+{
+    // remove the robots that did not exist when the snapshot was created
+    std::erase_if(robots,
+                  [&](const auto& kv_pair)
+                  {
+                      auto& [robotId, robot] = kv_pair;
+                      if (snapshots.contains(robotId))
+                      {
+                          return false;
+                      }
+                      robot->stopDribbling();
+                      return true;
+                  });
+
+    for (const auto& [robotId, robotSnapshot] : snapshots)
+    {
+        std::unique_ptr<SimRobot>& robot = robots[robotId];
+        if (!robot)
+        {
+            // the position is overwritten by the snapshot below
+            robot = createRobot(specs.at(robotId), btVector3(0, 0, 0), 0.f);
+        }
+        robot->restoreSnapshot(robotSnapshot);
+    }
+}
+
 void Simulator::handleSimulatorSetupCommand(const std::unique_ptr<amun::Command>& command)
 {
     bool teamOrPerfectDribbleChanged = false;
@@ -43,21 +43,82 @@ namespace camun
 namespace simulator
 {
 class Simulator;
+class SimDynamicsWorld;
 struct SimulatorData;
+struct SimulatorFidelity;
 }  // namespace simulator
 }  // namespace camun
 
+/**
+ * Controls that trade the fidelity of the simulation for throughput. The default
+ * values simulate at full fidelity.
+ */
+struct camun::simulator::SimulatorFidelity
+{
+    // the length of a physics sub timestep [s]
+    float subTimestep = SUB_TIMESTEP;
+    // whether robots that are commanded to stand still and already do stop applying
+    // forces, so that Bullet deactivates them until they are commanded or hit
+    bool deactivateRestingRobots = false;
+    // whether robots collide as a single convex hull with fewer segments instead of
+    // the mesh with a dribbler hole
+    bool simpleRobotMesh = false;
+    // camera packets are only generated on every n-th call to getWrapperPackets, the
+    // other calls return no packets
+    unsigned int cameraPacketDecimation = 1;
+
+    /**
+     * Returns the controls for bulk regression and tuning runs, which need many
+     * simulated seconds per wall second more than accurate physics
+     *
+     * @return the throughput controls
+     */
+    static SimulatorFidelity throughput()
+    {
+        return SimulatorFidelity{
+            .subTimestep             = 1 / 100.f,
+            .deactivateRestingRobots = true,
+            .simpleRobotMesh         = true,
+            .cameraPacketDecimation  = 2,
+        };
+    }
+};
+
+/**
+ * A btDiscreteDynamicsWorld that exposes the time which has been passed to
+ * stepSimulation but not simulated yet, because it is shorter than a sub timestep.
+ * This time is part of the state of the simulation.
+ */
+class camun::simulator::SimDynamicsWorld : public btDiscreteDynamicsWorld
+{
+   public:
+    using btDiscreteDynamicsWorld::btDiscreteDynamicsWorld;
+
+    btScalar getLocalTime() const
+    {
+        return m_localTime;
+    }
+
+    void setLocalTime(btScalar localTime)
+    {
+        m_localTime = localTime;
+    }
+};
+
 class camun::simulator::Simulator
 {
    public:
     typedef std::map<unsigned int, std::unique_ptr<SimRobot>> RobotMap;
+    struct Snapshot;
 
     /**
      * Creates a simulator with the given set up
      *
      * @param setup the simulator set up
+     * @param fidelity the controls that trade fidelity for throughput
      */
-    explicit Simulator(const amun::SimulatorSetup& setup);
+    explicit Simulator(const amun::SimulatorSetup& setup,
+                       const SimulatorFidelity& fidelity = SimulatorFidelity());
 
    public:
     /**
@@ -108,6 +169,27 @@ class camun::simulator::Simulator
      */
     void handleSimulatorSetupCommand(const std::unique_ptr<amun::Command>& command);
 
+    /**
+     * Captures the complete dynamic state of the simulation: the ball, the robots,
+     * the random number generators and the simulation time. Configuration such as the
+     * geometry and the realism settings is not part of the snapshot.
+     *
+     * @return the snapshot of the simulation
+     */
+    Snapshot createSnapshot() const;
+
+    /**
+     * Restores the simulation to a snapshot created by createSnapshot, adding and
+     * removing robots as required. The snapshot may come from another simulator, which
+     * allows running several independent copies of one simulation.
+     *
+     * @pre the snapshot was created by a simulator with the same set up and realism
+     * configuration as this one
+     *
+     * @param snapshot the snapshot to restore
+     */
+    void restoreSnapshot(const Snapshot& snapshot);
+
    private:
     /**
      * Accepts and executes a blue or yellow robot control command
@@ -120,6 +202,11 @@ class camun::simulator::Simulator
     std::vector<robot::RadioResponse> acceptRobotControlCommand(
         const SSLSimulationProto::RobotControl& control, bool isBlue);
 
+    void restoreTeam(RobotMap& robots,
+                     const std::map<unsigned int, SimRobot::Snapshot>& snapshots,
+                     const std::map<uint32_t, robot::Specs>& specs);
+    std::unique_ptr<SimRobot> createRobot(const robot::Specs& specs,
+                                          const btVector3& pos, float dir);
     void resetFlipped(RobotMap& robots, float side);
     void setTeam(RobotMap& list, float side, const robot::Team& team,
                  std::map<uint32_t, robot::Specs>& specs);
@@ -129,6 +216,7 @@ class camun::simulator::Simulator
 
    private:
     std::unique_ptr<SimulatorData> m_data;
+    const SimulatorFidelity m_fidelity;
 
     bool m_enabled;
     bool m_charge;
@@ -139,12 +227,32 @@ class camun::simulator::Simulator
     int64_t m_minRobotDetectionTime = 0;
     int64_t m_minBallDetectionTime  = 0;
     int64_t m_lastBallSendTime      = 0;
+    unsigned int m_wrapperPacketCalls = 0;
 
     std::map<size_t, unsigned int> m_lastFrameNumber;
 
     std::mt19937 rand_shuffle_src = std::mt19937(std::random_device()());
 };
 
+struct camun::simulator::Simulator::Snapshot
+{
+    SimBall::Snapshot ball;
+    std::map<unsigned int, SimRobot::Snapshot> robotsBlue;
+    std::map<unsigned int, SimRobot::Snapshot> robotsYellow;
+    std::map<uint32_t, robot::Specs> specsBlue;
+    std::map<uint32_t, robot::Specs> specsYellow;
+    RNG rng;
+    btScalar localTime;
+    bool charge;
+    int64_t time;
+    int64_t minRobotDetectionTime;
+    int64_t minBallDetectionTime;
+    int64_t lastBallSendTime;
+    unsigned int wrapperPacketCalls;
+    std::map<size_t, unsigned int> lastFrameNumber;
+    std::mt19937 randShuffleSrc;
+};
+
 
 /* Friction and restitution between robots, ball and field: (empirical
  * measurments) Ball vs. Robot: Restitution: about 0.60 Friction: trial and
@@ -179,7 +287,7 @@ struct camun::simulator::SimulatorData
     std::unique_ptr<btCollisionDispatcher> dispatcher;
     std::unique_ptr<btBroadphaseInterface> overlappingPairCache;
     std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
-    std::shared_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
+    std::shared_ptr<SimDynamicsWorld> dynamicsWorld;
     world::Geometry geometry;
     std::vector<SSLProto::SSL_GeometryCameraCalibration> reportedCameraSetup;
     std::vector<btVector3> cameraPositions;
@@ -0,0 +1,743 @@
+#include "proto/message_translation/compact_primitive_set.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "software/logger/logger.h"
+
+namespace
+{
+enum class PrimitiveType : std::uint8_t
+{
+    NOT_SET        = 0,
+    STOP           = 1,
+    MOVE           = 2,
+    DIRECT_CONTROL = 3,
+};
+
+enum class AutoChipOrKickType : std::uint8_t
+{
+    NOT_SET              = 0,
+    AUTOKICK_SPEED       = 1,
+    AUTOCHIP_DISTANCE    = 2,
+    AUTOKICK_PULSE_WIDTH = 3,
+    AUTOCHIP_PULSE_WIDTH = 4,
+};
+
+enum class DriveControlType : std::uint8_t
+{
+    NOT_SET   = 0,
+    PER_WHEEL = 1,
+    VELOCITY  = 2,
+};
+
+enum class ChickerCommandType : std::uint8_t
+{
+    NOT_SET           = 0,
+    KICK_SPEED        = 1,
+    CHIP_DISTANCE     = 2,
+    AUTO_CHIP_OR_KICK = 3,
+    KICK_PULSE_WIDTH  = 4,
+    CHIP_PULSE_WIDTH  = 5,
+};
+
+// Flags for the parts of a direct control primitive that are set
+constexpr std::uint8_t HAS_MOTOR_CONTROL = 1 << 0;
+constexpr std::uint8_t HAS_POWER_CONTROL = 1 << 1;
+
+// Scales values in base units to the quantized milli units
+constexpr double MILLI_PER_UNIT = 1000.0;
+
+/**
+ * Appends little-endian values to a buffer
+ */
+class Writer
+{
+   public:
+    explicit Writer(std::string& buffer) : buffer_(buffer) {}
+
+    template <typename T>
+    void write(T value)
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            write(std::bit_cast<std::uint32_t>(value));
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            write(std::bit_cast<std::uint64_t>(value));
+        }
+        else
+        {
+            auto bits = static_cast<std::make_unsigned_t<T>>(value);
+            for (std::size_t i = 0; i < sizeof(T); i++)
+            {
+                buffer_.push_back(static_cast<char>(bits & 0xFF));
+                bits = static_cast<std::make_unsigned_t<T>>(bits >> 8);
+            }
+        }
+    }
+
+    /**
+     * Writes the given value in milli units, rounded and saturated to the range of T
+     *
+     * @param value The value to write, in base units
+     */
+    template <typename T>
+    void writeMilli(double value)
+    {
+        const double milli = std::round(value * MILLI_PER_UNIT);
+        write(static_cast<T>(std::clamp(
+            std::isnan(milli) ? 0.0 : milli,
+            static_cast<double>(std::numeric_limits<T>::min()),
+            static_cast<double>(std::numeric_limits<T>::max()))));
+    }
+
+    /**
+     * Overwrites a u16 written earlier
+     *
+     * @param offset The offset of the u16 in the buffer
+     * @param value The new value
+     */
+    void overwrite(std::size_t offset, std::uint16_t value)
+    {
+        buffer_[offset]     = static_cast<char>(value & 0xFF);
+        buffer_[offset + 1] = static_cast<char>(value >> 8);
+    }
+
+    std::size_t size() const
+    {
+        return buffer_.size();
+    }
+
+   private:
+    std::string& buffer_;
+};
+
+/**
+ * Reads little-endian values from a buffer. Reading past the end of the buffer
+ * returns zero and marks the reader as failed, so that a whole message can be read
+ * before checking if it was malformed.
+ */
+class Reader
+{
+   public:
+    explicit Reader(std::span<const char> data) : data_(data) {}
+
+    template <typename T>
+    T read()
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+            return std::bit_cast<float>(read<std::uint32_t>());
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            return std::bit_cast<double>(read<std::uint64_t>());
+        }
+        else
+        {
+            if (remaining() < sizeof(T))
+            {
+                fail();
+                return T{};
+            }
+
+            std::make_unsigned_t<T> bits = 0;
+            for (std::size_t i = 0; i < sizeof(T); i++)
+            {
+                bits = static_cast<std::make_unsigned_t<T>>(
+                    bits | static_cast<std::make_unsigned_t<T>>(
+                               static_cast<unsigned char>(data_[offset_ + i]))
+                               << (8 * i));
+            }
+            offset_ += sizeof(T);
+            return static_cast<T>(bits);
+        }
+    }
+
+    /**
+     * Reads a value written in milli units
+     *
+     * @return the value, in base units
+     */
+    template <typename T>
+    double readMilli()
+    {
+        return static_cast<double>(read<T>()) / MILLI_PER_UNIT;
+    }
+
+    /**
+     * Reads the next bytes as a separate buffer
+     *
+     * @param size The number of bytes to read
+     *
+     * @return a reader over the bytes
+     */
+    Reader readBytes(std::size_t size)
+    {
+        if (remaining() < size)
+        {
+            fail();
+            return Reader({});
+        }
+
+        Reader reader(data_.subspan(offset_, size));
+        offset_ += size;
+        return reader;
+    }
+
+    void fail()
+    {
+        failed_ = true;
+        offset_ = data_.size();
+    }
+
+    std::size_t remaining() const
+    {
+        return data_.size() - offset_;
+    }
+
+    bool ok() const
+    {
+        return !failed_;
+    }
+
+   private:
+    std::span<const char> data_;
+    std::size_t offset_ = 0;
+    bool failed_        = false;
+};
+
+struct Header
+{
+    std::uint8_t num_primitives;
+    std::uint32_t sequence_number;
+    double time_sent_seconds;
+};
+
+void writePoint(Writer& writer, const TbotsProto::Point& point)
+{
+    writer.writeMilli<std::int16_t>(point.x_meters());
+    writer.writeMilli<std::int16_t>(point.y_meters());
+}
+
+void readPoint(Reader& reader, TbotsProto::Point& point)
+{
+    point.set_x_meters(reader.readMilli<std::int16_t>());
+    point.set_y_meters(reader.readMilli<std::int16_t>());
+}
+
+void writeVector(Writer& writer, const TbotsProto::Vector& vector)
+{
+    writer.writeMilli<std::int16_t>(vector.x_component_meters());
+    writer.writeMilli<std::int16_t>(vector.y_component_meters());
+}
+
+void readVector(Reader& reader, TbotsProto::Vector& vector)
+{
+    vector.set_x_component_meters(reader.readMilli<std::int16_t>());
+    vector.set_y_component_meters(reader.readMilli<std::int16_t>());
+}
+
+/**
+ * Reads an enum value written as a u8, failing the reader if the value isn't valid
+ *
+ * @param reader The reader to read from
+ * @param is_valid The generated protobuf function that checks if a value is valid
+ *
+ * @return the enum value
+ */
+template <typename EnumT>
+EnumT readEnum(Reader& reader, bool (*is_valid)(int))
+{
+    const int value = reader.read<std::uint8_t>();
+    if (!is_valid(value))
+    {
+        reader.fail();
+        return EnumT{};
+    }
+    return static_cast<EnumT>(value);
+}
+
+void writeAutoChipOrKick(Writer& writer,
+                         const TbotsProto::AutoChipOrKick& auto_chip_or_kick)
+{
+    switch (auto_chip_or_kick.auto_chip_or_kick_case())
+    {
+        case TbotsProto::AutoChipOrKick::kAutokickSpeedMPerS:
+            writer.write(AutoChipOrKickType::AUTOKICK_SPEED);
+            writer.write(auto_chip_or_kick.autokick_speed_m_per_s());
+            break;
+        case TbotsProto::AutoChipOrKick::kAutochipDistanceMeters:
+            writer.write(AutoChipOrKickType::AUTOCHIP_DISTANCE);
+            writer.write(auto_chip_or_kick.autochip_distance_meters());
+            break;
+        case TbotsProto::AutoChipOrKick::kAutokickPulseWidth:
+            writer.write(AutoChipOrKickType::AUTOKICK_PULSE_WIDTH);
+            writer.write(auto_chip_or_kick.autokick_pulse_width());
+            break;
+        case TbotsProto::AutoChipOrKick::kAutochipPulseWidth:
+            writer.write(AutoChipOrKickType::AUTOCHIP_PULSE_WIDTH);
+            writer.write(auto_chip_or_kick.autochip_pulse_width());
+            break;
+        case TbotsProto::AutoChipOrKick::AUTO_CHIP_OR_KICK_NOT_SET:
+            writer.write(AutoChipOrKickType::NOT_SET);
+            break;
+    }
+}
+
+void readAutoChipOrKick(Reader& reader, TbotsProto::AutoChipOrKick& auto_chip_or_kick)
+{
+    switch (static_cast<AutoChipOrKickType>(reader.read<std::uint8_t>()))
+    {
+        case AutoChipOrKickType::AUTOKICK_SPEED:
+            auto_chip_or_kick.set_autokick_speed_m_per_s(reader.read<float>());
+            break;
+        case AutoChipOrKickType::AUTOCHIP_DISTANCE:
+            auto_chip_or_kick.set_autochip_distance_meters(reader.read<float>());
+            break;
+        case AutoChipOrKickType::AUTOKICK_PULSE_WIDTH:
+            auto_chip_or_kick.set_autokick_pulse_width(reader.read<float>());
+            break;
+        case AutoChipOrKickType::AUTOCHIP_PULSE_WIDTH:
+            auto_chip_or_kick.set_autochip_pulse_width(reader.read<float>());
+            break;
+        case AutoChipOrKickType::NOT_SET:
+            auto_chip_or_kick.clear_auto_chip_or_kick();
+            break;
+        default:
+            reader.fail();
+    }
+}
+
+void writeMove(Writer& writer, const TbotsProto::MovePrimitive& move)
+{
+    const TbotsProto::TrajectoryPathParams2D& xy_params = move.xy_traj_params();
+    writePoint(writer, xy_params.start_position());
+    writePoint(writer, xy_params.destination());
+    writeVector(writer, xy_params.initial_velocity());
+    writer.write(static_cast<std::uint8_t>(xy_params.max_speed_mode()));
+
+    const int num_sub_destinations =
+        std::min(xy_params.sub_destinations_size(),
+                 static_cast<int>(std::numeric_limits<std::uint8_t>::max()));
+    writer.write(static_cast<std::uint8_t>(num_sub_destinations));
+    for (int i = 0; i < num_sub_destinations; i++)
+    {
+        const auto& sub_destination = xy_params.sub_destinations(i);
+        writePoint(writer, sub_destination.sub_destination());
+        writer.writeMilli<std::uint16_t>(sub_destination.connection_time_s());
+    }
+
+    const TbotsProto::TrajectoryParamsAngular1D& w_params = move.w_traj_params();
+    writer.writeMilli<std::int16_t>(w_params.start_angle().radians());
+    writer.writeMilli<std::int16_t>(w_params.final_angle().radians());
+    writer.writeMilli<std::int16_t>(w_params.initial_velocity().radians_per_second());
+
+    writer.write(static_cast<std::uint8_t>(move.dribbler_mode()));
+    writeAutoChipOrKick(writer, move.auto_chip_or_kick());
+}
+
+void readMove(Reader& reader, TbotsProto::MovePrimitive& move)
+{
+    TbotsProto::TrajectoryPathParams2D& xy_params = *move.mutable_xy_traj_params();
+    readPoint(reader, *xy_params.mutable_start_position());
+    readPoint(reader, *xy_params.mutable_destination());
+    readVector(reader, *xy_params.mutable_initial_velocity());
+    xy_params.set_max_speed_mode(readEnum<TbotsProto::MaxAllowedSpeedMode>(
+        reader, TbotsProto::MaxAllowedSpeedMode_IsValid));
+
+    const std::uint8_t num_sub_destinations = reader.read<std::uint8_t>();
+    xy_params.mutable_sub_destinations()->Clear();
+    for (std::uint8_t i = 0; i < num_sub_destinations && reader.ok(); i++)
+    {
+        auto& sub_destination = *xy_params.add_sub_destinations();
+        readPoint(reader, *sub_destination.mutable_sub_destination());
+        sub_destination.set_connection_time_s(
+            static_cast<float>(reader.readMilli<std::uint16_t>()));
+    }
+
+    TbotsProto::TrajectoryParamsAngular1D& w_params = *move.mutable_w_traj_params();
+    w_params.mutable_start_angle()->set_radians(reader.readMilli<std::int16_t>());
+    w_params.mutable_final_angle()->set_radians(reader.readMilli<std::int16_t>());
+    w_params.mutable_initial_velocity()->set_radians_per_second(
+        reader.readMilli<std::int16_t>());
+
+    move.set_dribbler_mode(
+        readEnum<TbotsProto::DribblerMode>(reader, TbotsProto::DribblerMode_IsValid));
+    readAutoChipOrKick(reader, *move.mutable_auto_chip_or_kick());
+}
+
+void writeMotorControl(Writer& writer, const TbotsProto::MotorControl& motor_control)
+{
+    switch (motor_control.drive_control_case())
+    {
+        case TbotsProto::MotorControl::kDirectPerWheelControl:
+        {
+            const auto& per_wheel = motor_control.direct_per_wheel_control();
+            writer.write(DriveControlType::PER_WHEEL);
+            writer.writeMilli<std::int16_t>(per_wheel.front_left_wheel_velocity());
+            writer.writeMilli<std::int16_t>(per_wheel.back_left_wheel_velocity());
+            writer.writeMilli<std::int16_t>(per_wheel.front_right_wheel_velocity());
+            writer.writeMilli<std::int16_t>(per_wheel.back_right_wheel_velocity());
+            break;
+        }
+        case TbotsProto::MotorControl::kDirectVelocityControl:
+        {
+            const auto& velocity = motor_control.direct_velocity_control();
+            writer.write(DriveControlType::VELOCITY);
+            writeVector(writer, velocity.velocity());
+            writer.writeMilli<std::int16_t>(
+                velocity.angular_velocity().radians_per_second());
+            break;
+        }
+        case TbotsProto::MotorControl::DRIVE_CONTROL_NOT_SET:
+            writer.write(DriveControlType::NOT_SET);
+            break;
+    }
+
+    writer.write(static_cast<std::int16_t>(
+        std::clamp(motor_control.dribbler_speed_rpm(),
+                   static_cast<std::int32_t>(std::numeric_limits<std::int16_t>::min()),
+                   static_cast<std::int32_t>(std::numeric_limits<std::int16_t>::max()))));
+}
+
+void readMotorControl(Reader& reader, TbotsProto::MotorControl& motor_control)
+{
+    switch (static_cast<DriveControlType>(reader.read<std::uint8_t>()))
+    {
+        case DriveControlType::PER_WHEEL:
+        {
+            auto& per_wheel = *motor_control.mutable_direct_per_wheel_control();
+            per_wheel.set_front_left_wheel_velocity(
+                static_cast<float>(reader.readMilli<std::int16_t>()));
+            per_wheel.set_back_left_wheel_velocity(
+                static_cast<float>(reader.readMilli<std::int16_t>()));
+            per_wheel.set_front_right_wheel_velocity(
+                static_cast<float>(reader.readMilli<std::int16_t>()));
+            per_wheel.set_back_right_wheel_velocity(
+                static_cast<float>(reader.readMilli<std::int16_t>()));
+            break;
+        }
+        case DriveControlType::VELOCITY:
+        {
+            auto& velocity = *motor_control.mutable_direct_velocity_control();
+            readVector(reader, *velocity.mutable_velocity());
+            velocity.mutable_angular_velocity()->set_radians_per_second(
+                reader.readMilli<std::int16_t>());
+            break;
+        }
+        case DriveControlType::NOT_SET:
+            motor_control.clear_drive_control();
+            break;
+        default:
+            reader.fail();
+    }
+
+    motor_control.set_dribbler_speed_rpm(reader.read<std::int16_t>());
+}
+
+void writePowerControl(Writer& writer, const TbotsProto::PowerControl& power_control)
+{
+    const TbotsProto::PowerControl::ChickerControl& chicker = power_control.chicker();
+    switch (chicker.chicker_command_case())
+    {
+        case TbotsProto::PowerControl::ChickerControl::kKickSpeedMPerS:
+            writer.write(ChickerCommandType::KICK_SPEED);
+            writer.write(chicker.kick_speed_m_per_s());
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kChipDistanceMeters:
+            writer.write(ChickerCommandType::CHIP_DISTANCE);
+            writer.write(chicker.chip_distance_meters());
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kAutoChipOrKick:
+            writer.write(ChickerCommandType::AUTO_CHIP_OR_KICK);
+            writeAutoChipOrKick(writer, chicker.auto_chip_or_kick());
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kKickPulseWidth:
+            writer.write(ChickerCommandType::KICK_PULSE_WIDTH);
+            writer.write(chicker.kick_pulse_width());
+            break;
+        case TbotsProto::PowerControl::ChickerControl::kChipPulseWidth:
+            writer.write(ChickerCommandType::CHIP_PULSE_WIDTH);
+            writer.write(chicker.chip_pulse_width());
+            break;
+        case TbotsProto::PowerControl::ChickerControl::CHICKER_COMMAND_NOT_SET:
+            writer.write(ChickerCommandType::NOT_SET);
+            break;
+    }
+
+    writer.write(static_cast<std::uint8_t>(power_control.geneva_slot()));
+}
+
+void readPowerControl(Reader& reader, TbotsProto::PowerControl& power_control)
+{
+    TbotsProto::PowerControl::ChickerControl& chicker = *power_control.mutable_chicker();
+    switch (static_cast<ChickerCommandType>(reader.read<std::uint8_t>()))
+    {
+        case ChickerCommandType::KICK_SPEED:
+            chicker.set_kick_speed_m_per_s(reader.read<float>());
+            break;
+        case ChickerCommandType::CHIP_DISTANCE:
+            chicker.set_chip_distance_meters(reader.read<float>());
+            break;
+        case ChickerCommandType::AUTO_CHIP_OR_KICK:
+            readAutoChipOrKick(reader, *chicker.mutable_auto_chip_or_kick());
+            break;
+        case ChickerCommandType::KICK_PULSE_WIDTH:
+            chicker.set_kick_pulse_width(reader.read<float>());
+            break;
+        case ChickerCommandType::CHIP_PULSE_WIDTH:
+            chicker.set_chip_pulse_width(reader.read<float>());
+            break;
+        case ChickerCommandType::NOT_SET:
+            chicker.clear_chicker_command();
+            break;
+        default:
+            reader.fail();
+    }
+
+    power_control.set_geneva_slot(
+        readEnum<TbotsProto::Geneva::Slot>(reader, TbotsProto::Geneva::Slot_IsValid));
+}
+
+void writeDirectControl(Writer& writer,
+                        const TbotsProto::DirectControlPrimitive& direct_control)
+{
+    std::uint8_t flags = 0;
+    if (direct_control.has_motor_control())
+    {
+        flags |= HAS_MOTOR_CONTROL;
+    }
+    if (direct_control.has_power_control())
+    {
+        flags |= HAS_POWER_CONTROL;
+    }
+    writer.write(flags);
+
+    if (direct_control.has_motor_control())
+    {
+        writeMotorControl(writer, direct_control.motor_control());
+    }
+    if (direct_control.has_power_control())
+    {
+        writePowerControl(writer, direct_control.power_control());
+    }
+}
+
+void readDirectControl(Reader& reader, TbotsProto::DirectControlPrimitive& direct_control)
+{
+    const std::uint8_t flags = reader.read<std::uint8_t>();
+
+    if (flags & HAS_MOTOR_CONTROL)
+    {
+        readMotorControl(reader, *direct_control.mutable_motor_control());
+    }
+    else
+    {
+        direct_control.clear_motor_control();
+    }
+
+    if (flags & HAS_POWER_CONTROL)
+    {
+        readPowerControl(reader, *direct_control.mutable_power_control());
+    }
+    else
+    {
+        direct_control.clear_power_control();
+    }
+}
+
+std::optional<Header> readHeader(Reader& reader)
+{
+    if (reader.read<std::uint8_t>() != COMPACT_PRIMITIVE_SET_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    Header header;
+    header.num_primitives    = reader.read<std::uint8_t>();
+    header.sequence_number   = reader.read<std::uint32_t>();
+    header.time_sent_seconds = reader.read<double>();
+    if (!reader.ok())
+    {
+        return std::nullopt;
+    }
+    return header;
+}
+
+/**
+ * Reads the payload of a primitive into the given primitive, keeping its sub-messages
+ * if its type doesn't change
+ *
+ * @param payload The payload of the primitive
+ * @param type The type of the primitive
+ * @param header The header of the PrimitiveSet the primitive is in
+ * @param primitive The primitive to read into
+ *
+ * @return true if the whole payload was read
+ */
+bool readPrimitive(Reader& payload, PrimitiveType type, const Header& header,
+                   TbotsProto::Primitive& primitive)
+{
+    switch (type)
+    {
+        case PrimitiveType::STOP:
+            primitive.mutable_stop();
+            break;
+        case PrimitiveType::MOVE:
+            readMove(payload, *primitive.mutable_move());
+            break;
+        case PrimitiveType::DIRECT_CONTROL:
+            readDirectControl(payload, *primitive.mutable_direct_control());
+            break;
+        case PrimitiveType::NOT_SET:
+            primitive.clear_primitive();
+            break;
+        default:
+            return false;
+    }
+
+    primitive.set_sequence_number(header.sequence_number);
+    primitive.mutable_time_sent()->set_epoch_timestamp_seconds(header.time_sent_seconds);
+    return payload.ok() && payload.remaining() == 0;
+}
+}  // namespace
+
+void encodeCompactPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                               std::string& buffer)
+{
+    buffer.clear();
+    Writer writer(buffer);
+
+    const std::size_t num_primitives =
+        std::min(primitive_set.robot_primitives().size(),
+                 static_cast<std::size_t>(std::numeric_limits<std::uint8_t>::max()));
+
+    writer.write(COMPACT_PRIMITIVE_SET_VERSION);
+    const std::size_t num_primitives_offset = writer.size();
+    writer.write(static_cast<std::uint8_t>(num_primitives));
+    writer.write(static_cast<std::uint32_t>(primitive_set.sequence_number()));
+    writer.write(primitive_set.time_sent().epoch_timestamp_seconds());
+
+    std::uint8_t num_written = 0;
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        if (num_written == num_primitives)
+        {
+            break;
+        }
+        if (robot_id > std::numeric_limits<std::uint8_t>::max())
+        {
+            LOG(WARNING) << "Robot id " << robot_id
+                         << " is too large for a compact PrimitiveSet, skipping it";
+            continue;
+        }
+
+        writer.write(static_cast<std::uint8_t>(robot_id));
+        switch (primitive.primitive_case())
+        {
+            case TbotsProto::Primitive::kStop:
+                writer.write(PrimitiveType::STOP);
+                break;
+            case TbotsProto::Primitive::kMove:
+                writer.write(PrimitiveType::MOVE);
+                break;
+            case TbotsProto::Primitive::kDirectControl:
+                writer.write(PrimitiveType::DIRECT_CONTROL);
+                break;
+            case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
+                writer.write(PrimitiveType::NOT_SET);
+                break;
+        }
+
+        // The payload size is filled in once the payload is written
+        const std::size_t payload_size_offset = writer.size();
+        writer.write(std::uint16_t{0});
+        const std::size_t payload_offset = writer.size();
+
+        if (primitive.has_move())
+        {
+            writeMove(writer, primitive.move());
+        }
+        else if (primitive.has_direct_control())
+        {
+            writeDirectControl(writer, primitive.direct_control());
+        }
+
+        writer.overwrite(payload_size_offset,
+                         static_cast<std::uint16_t>(writer.size() - payload_offset));
+        num_written++;
+    }
+
+    buffer[num_primitives_offset] = static_cast<char>(num_written);
+}
+
+bool decodeCompactPrimitive(std::span<const char> data, RobotId robot_id,
+                            TbotsProto::Primitive& primitive)
+{
+    Reader reader(data);
+    const std::optional<Header> header = readHeader(reader);
+    if (!header)
+    {
+        return false;
+    }
+
+    for (std::uint8_t i = 0; i < header->num_primitives; i++)
+    {
+        const std::uint8_t entry_robot_id = reader.read<std::uint8_t>();
+        const auto type                   = reader.read<PrimitiveType>();
+        const std::uint16_t payload_size  = reader.read<std::uint16_t>();
+        Reader payload                    = reader.readBytes(payload_size);
+        if (!reader.ok())
+        {
+            return false;
+        }
+
+        if (entry_robot_id == robot_id)
+        {
+            return readPrimitive(payload, type, *header, primitive);
+        }
+    }
+    return false;
+}
+
+std::optional<TbotsProto::PrimitiveSet> decodeCompactPrimitiveSet(
+    std::span<const char> data)
+{
+    Reader reader(data);
+    const std::optional<Header> header = readHeader(reader);
+    if (!header)
+    {
+        return std::nullopt;
+    }
+
+    TbotsProto::PrimitiveSet primitive_set;
+    primitive_set.set_sequence_number(header->sequence_number);
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(
+        header->time_sent_seconds);
+
+    auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+    for (std::uint8_t i = 0; i < header->num_primitives; i++)
+    {
+        const std::uint8_t robot_id      = reader.read<std::uint8_t>();
+        const auto type                  = reader.read<PrimitiveType>();
+        const std::uint16_t payload_size = reader.read<std::uint16_t>();
+        Reader payload                   = reader.readBytes(payload_size);
+        if (!reader.ok() ||
+            !readPrimitive(payload, type, *header, robot_primitives[robot_id]))
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (reader.remaining() != 0)
+    {
+        return std::nullopt;
+    }
+    return primitive_set;
+}
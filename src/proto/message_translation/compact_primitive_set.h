@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+#include "proto/primitive.pb.h"
+#include "proto/tbots_software_msgs.pb.h"
+#include "software/world/robot_state.h"
+
+/**
+ * A compact binary encoding of a PrimitiveSet, so that the primitives of every robot can
+ * be multicast in a single small datagram every frame instead of sending a protobuf
+ * Primitive to each robot.
+ *
+ * All values are little-endian. The datagram starts with a header:
+ *
+ *   u8  version
+ *   u8  number of primitives
+ *   u32 sequence number
+ *   f64 time sent, in seconds since the epoch
+ *
+ * followed by one entry per robot:
+ *
+ *   u8  robot id
+ *   u8  primitive type (stop, move or direct control)
+ *   u16 size of the primitive payload in bytes
+ *   ... primitive payload
+ *
+ * so that a robot can skip over the entries of other robots without decoding them.
+ *
+ * Positions and linear velocities are quantized to int16 millimetres (per second), angles
+ * and angular velocities to int16 milliradians (per second), and sub destination
+ * connection times to u16 milliseconds. Values outside the range of their field are
+ * saturated. Chicker commands are kept as float32 since their units depend on the
+ * command.
+ *
+ * The sequence number and time sent of the PrimitiveSet are given to every decoded
+ * Primitive. stay_away_from_ball isn't encoded since robots don't use it.
+ */
+
+// The version of the encoding, which is bumped whenever the layout changes
+static constexpr std::uint8_t COMPACT_PRIMITIVE_SET_VERSION = 1;
+
+/**
+ * Encodes the given PrimitiveSet into the compact encoding
+ *
+ * @param primitive_set The PrimitiveSet to encode
+ * @param buffer The buffer to write the encoded PrimitiveSet to. Its previous contents
+ * are replaced, but its capacity is reused.
+ */
+void encodeCompactPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                               std::string& buffer);
+
+/**
+ * Decodes the primitive of the given robot from a compact PrimitiveSet
+ *
+ * @param data The encoded PrimitiveSet
+ * @param robot_id The id of the robot to decode the primitive of
+ * @param primitive The primitive to decode into. Its previous contents are replaced, but
+ * its allocated sub-messages are reused. It is left in an unspecified state if decoding
+ * fails.
+ *
+ * @return true if the PrimitiveSet has a primitive for the robot and it was decoded,
+ * false if it doesn't or the data is malformed
+ */
+bool decodeCompactPrimitive(std::span<const char> data, RobotId robot_id,
+                            TbotsProto::Primitive& primitive);
+
+/**
+ * Decodes every primitive in a compact PrimitiveSet
+ *
+ * @param data The encoded PrimitiveSet
+ *
+ * @return the decoded PrimitiveSet, or std::nullopt if the data is malformed
+ */
+std::optional<TbotsProto::PrimitiveSet> decodeCompactPrimitiveSet(
+    std::span<const char> data);
@@ -0,0 +1,321 @@
+#include "proto/message_translation/compact_primitive_set.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "shared/constants.h"
+#include "software/networking/udp/threaded_udp_listener.h"
+#include "software/networking/udp/threaded_udp_sender.h"
+
+class CompactPrimitiveSetTest : public ::testing::Test
+{
+   protected:
+    static TbotsProto::Primitive createMovePrimitive()
+    {
+        TbotsProto::Primitive primitive;
+        TbotsProto::MovePrimitive& move = *primitive.mutable_move();
+
+        auto& xy_params = *move.mutable_xy_traj_params();
+        xy_params.mutable_start_position()->set_x_meters(-1.234);
+        xy_params.mutable_start_position()->set_y_meters(2.5);
+        xy_params.mutable_destination()->set_x_meters(4.321);
+        xy_params.mutable_destination()->set_y_meters(-3.0);
+        xy_params.mutable_initial_velocity()->set_x_component_meters(1.5);
+        xy_params.mutable_initial_velocity()->set_y_component_meters(-0.25);
+        xy_params.set_max_speed_mode(TbotsProto::MaxAllowedSpeedMode::STOP_COMMAND);
+
+        auto& sub_destination = *xy_params.add_sub_destinations();
+        sub_destination.mutable_sub_destination()->set_x_meters(1.0);
+        sub_destination.mutable_sub_destination()->set_y_meters(-1.0);
+        sub_destination.set_connection_time_s(0.75f);
+
+        auto& w_params = *move.mutable_w_traj_params();
+        w_params.mutable_start_angle()->set_radians(-3.1);
+        w_params.mutable_final_angle()->set_radians(1.57);
+        w_params.mutable_initial_velocity()->set_radians_per_second(2.0);
+
+        move.set_dribbler_mode(TbotsProto::DribblerMode::MAX_FORCE);
+        move.mutable_auto_chip_or_kick()->set_autochip_distance_meters(1.5f);
+        return primitive;
+    }
+
+    static TbotsProto::Primitive createDirectControlPrimitive()
+    {
+        TbotsProto::Primitive primitive;
+        auto& direct_control = *primitive.mutable_direct_control();
+
+        auto& motor_control = *direct_control.mutable_motor_control();
+        auto& velocity      = *motor_control.mutable_direct_velocity_control();
+        velocity.mutable_velocity()->set_x_component_meters(0.5);
+        velocity.mutable_velocity()->set_y_component_meters(-0.5);
+        velocity.mutable_angular_velocity()->set_radians_per_second(3.0);
+        motor_control.set_dribbler_speed_rpm(-8000);
+
+        auto& power_control = *direct_control.mutable_power_control();
+        power_control.mutable_chicker()->set_kick_pulse_width(2500.0f);
+        power_control.set_geneva_slot(TbotsProto::Geneva::Slot::CENTRE_RIGHT);
+        return primitive;
+    }
+
+    static TbotsProto::PrimitiveSet createPrimitiveSet()
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.set_sequence_number(42);
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1700000000.125);
+
+        auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+        robot_primitives[0]    = createMovePrimitive();
+        robot_primitives[3]    = createDirectControlPrimitive();
+        robot_primitives[5].mutable_stop();
+        return primitive_set;
+    }
+
+    /**
+     * Checks that the given primitive was decoded from the given primitive, to within
+     * the resolution of the quantized fields
+     */
+    static void expectDecodedEqual(const TbotsProto::Primitive& expected,
+                                   const TbotsProto::Primitive& decoded)
+    {
+        google::protobuf::util::MessageDifferencer differencer;
+        google::protobuf::util::DefaultFieldComparator comparator;
+        comparator.set_float_comparison(
+            google::protobuf::util::DefaultFieldComparator::APPROXIMATE);
+        comparator.SetDefaultFractionAndMargin(0.0, 0.0005);
+        differencer.set_field_comparator(&comparator);
+        differencer.IgnoreField(TbotsProto::Primitive::descriptor()->FindFieldByName(
+            "sequence_number"));
+        differencer.IgnoreField(
+            TbotsProto::Primitive::descriptor()->FindFieldByName("time_sent"));
+
+        std::string differences;
+        differencer.ReportDifferencesToString(&differences);
+        EXPECT_TRUE(differencer.Compare(expected, decoded)) << differences;
+    }
+};
+
+TEST_F(CompactPrimitiveSetTest, round_trip_primitive_set)
+{
+    const TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+    std::optional<TbotsProto::PrimitiveSet> decoded = decodeCompactPrimitiveSet(buffer);
+
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(42, decoded->sequence_number());
+    EXPECT_DOUBLE_EQ(1700000000.125, decoded->time_sent().epoch_timestamp_seconds());
+    ASSERT_EQ(3, decoded->robot_primitives().size());
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        expectDecodedEqual(primitive, decoded->robot_primitives().at(robot_id));
+    }
+}
+
+TEST_F(CompactPrimitiveSetTest, decode_primitive_of_each_robot)
+{
+    const TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+
+    // Decode every primitive into the same message to check that switching between
+    // primitive types leaves nothing behind from the previous primitive
+    TbotsProto::Primitive primitive;
+    for (RobotId robot_id : {3u, 0u, 5u, 0u})
+    {
+        ASSERT_TRUE(decodeCompactPrimitive(buffer, robot_id, primitive));
+        expectDecodedEqual(primitive_set.robot_primitives().at(robot_id), primitive);
+        EXPECT_EQ(42, primitive.sequence_number());
+        EXPECT_DOUBLE_EQ(1700000000.125, primitive.time_sent().epoch_timestamp_seconds());
+    }
+}
+
+TEST_F(CompactPrimitiveSetTest, decode_primitive_of_robot_not_in_set)
+{
+    std::string buffer;
+    encodeCompactPrimitiveSet(createPrimitiveSet(), buffer);
+
+    TbotsProto::Primitive primitive;
+    EXPECT_FALSE(decodeCompactPrimitive(buffer, 1, primitive));
+}
+
+TEST_F(CompactPrimitiveSetTest, decode_per_wheel_control_and_auto_chip_or_kick)
+{
+    TbotsProto::Primitive primitive;
+    auto& direct_control = *primitive.mutable_direct_control();
+    auto& per_wheel =
+        *direct_control.mutable_motor_control()->mutable_direct_per_wheel_control();
+    per_wheel.set_front_left_wheel_velocity(1.0f);
+    per_wheel.set_back_left_wheel_velocity(-2.0f);
+    per_wheel.set_front_right_wheel_velocity(0.125f);
+    per_wheel.set_back_right_wheel_velocity(-0.5f);
+    direct_control.mutable_power_control()
+        ->mutable_chicker()
+        ->mutable_auto_chip_or_kick()
+        ->set_autokick_speed_m_per_s(4.5f);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    (*primitive_set.mutable_robot_primitives())[2] = primitive;
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+
+    TbotsProto::Primitive decoded;
+    ASSERT_TRUE(decodeCompactPrimitive(buffer, 2, decoded));
+    expectDecodedEqual(primitive, decoded);
+}
+
+TEST_F(CompactPrimitiveSetTest, out_of_range_values_are_saturated)
+{
+    TbotsProto::Primitive primitive = createMovePrimitive();
+    primitive.mutable_move()
+        ->mutable_xy_traj_params()
+        ->mutable_destination()
+        ->set_x_meters(100.0);
+    primitive.mutable_move()
+        ->mutable_xy_traj_params()
+        ->mutable_destination()
+        ->set_y_meters(-100.0);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    (*primitive_set.mutable_robot_primitives())[0] = primitive;
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+
+    TbotsProto::Primitive decoded;
+    ASSERT_TRUE(decodeCompactPrimitive(buffer, 0, decoded));
+    EXPECT_DOUBLE_EQ(32.767, decoded.move().xy_traj_params().destination().x_meters());
+    EXPECT_DOUBLE_EQ(-32.768, decoded.move().xy_traj_params().destination().y_meters());
+}
+
+TEST_F(CompactPrimitiveSetTest, compact_encoding_is_smaller_than_protobuf)
+{
+    const TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+
+    std::size_t protobuf_size = 0;
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        protobuf_size += primitive.ByteSizeLong();
+    }
+    EXPECT_LT(buffer.size(), protobuf_size / 2);
+}
+
+TEST_F(CompactPrimitiveSetTest, truncated_data_is_rejected)
+{
+    // Only encode one primitive, since the primitive of a robot can still be decoded
+    // if the entries of other robots after it are truncated
+    TbotsProto::PrimitiveSet primitive_set;
+    (*primitive_set.mutable_robot_primitives())[4] = createMovePrimitive();
+    std::string buffer;
+    encodeCompactPrimitiveSet(primitive_set, buffer);
+
+    TbotsProto::Primitive primitive;
+    for (std::size_t size = 0; size < buffer.size(); size++)
+    {
+        const std::span<const char> truncated(buffer.data(), size);
+        EXPECT_FALSE(decodeCompactPrimitiveSet(truncated).has_value());
+        EXPECT_FALSE(decodeCompactPrimitive(truncated, 4, primitive));
+    }
+}
+
+TEST_F(CompactPrimitiveSetTest, unknown_version_is_rejected)
+{
+    std::string buffer;
+    encodeCompactPrimitiveSet(createPrimitiveSet(), buffer);
+    buffer[0] = static_cast<char>(COMPACT_PRIMITIVE_SET_VERSION + 1);
+
+    TbotsProto::Primitive primitive;
+    EXPECT_FALSE(decodeCompactPrimitiveSet(buffer).has_value());
+    EXPECT_FALSE(decodeCompactPrimitive(buffer, 0, primitive));
+}
+
+TEST_F(CompactPrimitiveSetTest, loopback_bytes_and_packets_compared_to_protobuf)
+{
+    // Sends the same frames of primitives over loopback both as a protobuf Primitive
+    // per robot and as one compact PrimitiveSet per frame, and compares what arrives
+    constexpr int NUM_FRAMES               = 60;
+    constexpr int NUM_ROBOTS               = 6;
+    constexpr double FRAME_RATE_HZ         = 60.0;
+    constexpr unsigned short PROTOBUF_PORT = 40003;
+    constexpr unsigned short COMPACT_PORT  = 40004;
+
+    struct ReceivedCount
+    {
+        std::size_t num_packets = 0;
+        std::size_t num_bytes   = 0;
+    };
+    std::mutex mutex;
+    std::condition_variable packet_received;
+    ReceivedCount protobuf_received;
+    ReceivedCount compact_received;
+
+    auto count_into = [&](ReceivedCount& count)
+    {
+        return [&](const char*, const size_t& size)
+        {
+            std::scoped_lock lock(mutex);
+            count.num_packets++;
+            count.num_bytes += size;
+            packet_received.notify_all();
+        };
+    };
+    ThreadedUdpListener protobuf_listener(PROTOBUF_PORT, count_into(protobuf_received));
+    ThreadedUdpListener compact_listener(COMPACT_PORT, count_into(compact_received));
+    ThreadedUdpSender protobuf_sender("127.0.0.1", PROTOBUF_PORT, LOOPBACK_INTERFACE,
+                                      false);
+    ThreadedUdpSender compact_sender("127.0.0.1", COMPACT_PORT, LOOPBACK_INTERFACE,
+                                     false);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    std::string buffer;
+    for (int frame = 0; frame < NUM_FRAMES; frame++)
+    {
+        primitive_set.set_sequence_number(frame);
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(
+            1700000000.0 + frame / FRAME_RATE_HZ);
+        for (int robot_id = 0; robot_id < NUM_ROBOTS; robot_id++)
+        {
+            TbotsProto::Primitive& primitive =
+                (*primitive_set.mutable_robot_primitives())[robot_id];
+            primitive = createMovePrimitive();
+            primitive.set_sequence_number(frame);
+            *primitive.mutable_time_sent() = primitive_set.time_sent();
+
+            protobuf_sender.sendString(primitive.SerializeAsString());
+        }
+
+        encodeCompactPrimitiveSet(primitive_set, buffer);
+        compact_sender.sendString(buffer);
+
+        // Pace the frames so that the socket receive buffers don't overflow
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(packet_received.wait_for(
+        lock, std::chrono::seconds(5),
+        [&]
+        {
+            return protobuf_received.num_packets == NUM_FRAMES * NUM_ROBOTS &&
+                   compact_received.num_packets == NUM_FRAMES;
+        }));
+
+    // Report the rates the frames would be sent at by an AI running at FRAME_RATE_HZ
+    const double seconds = NUM_FRAMES / FRAME_RATE_HZ;
+    RecordProperty("protobuf_packets_per_second",
+                   std::to_string(protobuf_received.num_packets / seconds));
+    RecordProperty("protobuf_bytes_per_second",
+                   std::to_string(protobuf_received.num_bytes / seconds));
+    RecordProperty("compact_packets_per_second",
+                   std::to_string(compact_received.num_packets / seconds));
+    RecordProperty("compact_bytes_per_second",
+                   std::to_string(compact_received.num_bytes / seconds));
+
+    EXPECT_LT(compact_received.num_bytes, protobuf_received.num_bytes / 2);
+}
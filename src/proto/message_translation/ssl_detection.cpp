@@ -2,6 +2,72 @@
 
 #include "shared/constants.h"
 
+namespace
+{
+/**
+ * Converts a ball detection from SSL vision to our units
+ *
+ * @param ball The ball detection from SSL vision
+ * @param t_capture The time the camera frame containing the detection was captured
+ *
+ * @return the ball detection in meters
+ */
+BallDetection createBallDetection(const SSLProto::SSL_DetectionBall& ball,
+                                  const Timestamp& t_capture)
+{
+    return BallDetection{.position = Point(ball.x() * METERS_PER_MILLIMETER,
+                                           ball.y() * METERS_PER_MILLIMETER),
+                         .distance_from_ground = ball.z() * METERS_PER_MILLIMETER,
+                         .timestamp            = t_capture,
+                         .confidence           = ball.confidence()};
+}
+
+/**
+ * Converts a robot detection from SSL vision to our units
+ *
+ * @param robot The robot detection from SSL vision
+ * @param t_capture The time the camera frame containing the detection was captured
+ *
+ * @return the robot detection in meters and radians
+ */
+RobotDetection createRobotDetection(const SSLProto::SSL_DetectionRobot& robot,
+                                    const Timestamp& t_capture)
+{
+    return RobotDetection{.id          = robot.robot_id(),
+                          .position    = Point(robot.x() * METERS_PER_MILLIMETER,
+                                               robot.y() * METERS_PER_MILLIMETER),
+                          .orientation = Angle::fromRadians(robot.orientation()),
+                          .confidence  = robot.confidence(),
+                          .timestamp   = t_capture};
+}
+
+/**
+ * Checks if a detected position is outside of the valid x range
+ *
+ * @param position The detected position
+ * @param min_valid_x min valid x value
+ * @param max_valid_x max valid x value
+ *
+ * @return whether the position is outside of the valid x range
+ */
+bool isOutsideValidX(const Point& position, double min_valid_x, double max_valid_x)
+{
+    return min_valid_x > position.x() || max_valid_x < position.x();
+}
+
+/**
+ * Inverts a position across the x and y axis
+ *
+ * @param position The position to invert
+ *
+ * @return the inverted position
+ */
+Point invertPosition(const Point& position)
+{
+    return Point(-position.x(), -position.y());
+}
+}  // namespace
+
 std::unique_ptr<SSLProto::SSL_DetectionBall> createSSLDetectionBall(const BallState& ball)
 {
     auto detection_ball = std::make_unique<SSLProto::SSL_DetectionBall>();
@@ -93,19 +159,14 @@ std::vector<BallDetection> createBallDetections(
 
     for (const auto& detection : detections)
     {
+        const Timestamp t_capture = Timestamp::fromSeconds(detection.t_capture());
         for (const SSLProto::SSL_DetectionBall& ball : detection.balls())
         {
-            // Convert all data to meters and radians
-            BallDetection ball_detection{
-                .position             = Point(ball.x() * METERS_PER_MILLIMETER,
-                                              ball.y() * METERS_PER_MILLIMETER),
-                .distance_from_ground = ball.z() * METERS_PER_MILLIMETER,
-                .timestamp            = Timestamp::fromSeconds(detection.t_capture()),
-                .confidence           = ball.confidence()};
+            BallDetection ball_detection = createBallDetection(ball, t_capture);
 
             bool ignore_ball = ignore_invalid_camera_data &&
-                               (min_valid_x > ball_detection.position.x() ||
-                                max_valid_x < ball_detection.position.x());
+                               isOutsideValidX(ball_detection.position, min_valid_x,
+                                               max_valid_x);
             if (!ignore_ball)
             {
                 ball_detections.push_back(ball_detection);
@@ -125,25 +186,19 @@ std::vector<RobotDetection> createTeamDetection(
     // Collect all the visible robots from all camera frames
     for (const auto& detection : detections)
     {
-        auto ssl_robots = detection.robots_blue();
-        if (team_colour == TeamColour::YELLOW)
-        {
-            ssl_robots = detection.robots_yellow();
-        }
+        const Timestamp t_capture = Timestamp::fromSeconds(detection.t_capture());
+        const auto& ssl_robots    = team_colour == TeamColour::YELLOW
+                                        ? detection.robots_yellow()
+                                        : detection.robots_blue();
 
         for (const auto& ssl_robot_detection : ssl_robots)
         {
-            RobotDetection robot_detection{
-                .id          = ssl_robot_detection.robot_id(),
-                .position    = Point(ssl_robot_detection.x() * METERS_PER_MILLIMETER,
-                                     ssl_robot_detection.y() * METERS_PER_MILLIMETER),
-                .orientation = Angle::fromRadians(ssl_robot_detection.orientation()),
-                .confidence  = ssl_robot_detection.confidence(),
-                .timestamp   = Timestamp::fromSeconds(detection.t_capture())};
+            RobotDetection robot_detection =
+                createRobotDetection(ssl_robot_detection, t_capture);
 
             bool ignore_robot = ignore_invalid_camera_data &&
-                                (min_valid_x > robot_detection.position.x() ||
-                                 max_valid_x < robot_detection.position.x());
+                                isOutsideValidX(robot_detection.position, min_valid_x,
+                                                max_valid_x);
             if (!ignore_robot)
             {
                 robot_detections.push_back(robot_detection);
@@ -152,3 +207,55 @@ std::vector<RobotDetection> createTeamDetection(
     }
     return robot_detections;
 }
+
+void fillVisionDetectionBatch(const SSLProto::SSL_DetectionFrame& detection,
+                              double min_valid_x, double max_valid_x,
+                              bool ignore_invalid_camera_data,
+                              bool defending_positive_side, VisionDetectionBatch& batch)
+{
+    batch.clear();
+    batch.camera_id = detection.camera_id();
+    batch.t_capture = Timestamp::fromSeconds(detection.t_capture());
+
+    for (const SSLProto::SSL_DetectionBall& ball : detection.balls())
+    {
+        BallDetection ball_detection = createBallDetection(ball, batch.t_capture);
+        if (ignore_invalid_camera_data &&
+            isOutsideValidX(ball_detection.position, min_valid_x, max_valid_x))
+        {
+            continue;
+        }
+
+        if (defending_positive_side)
+        {
+            ball_detection.position = invertPosition(ball_detection.position);
+        }
+        batch.balls.push_back(ball_detection);
+    }
+
+    const auto add_robot_detections =
+        [&](const google::protobuf::RepeatedPtrField<SSLProto::SSL_DetectionRobot>&
+                ssl_robots,
+            std::vector<RobotDetection>& robot_detections)
+    {
+        for (const SSLProto::SSL_DetectionRobot& ssl_robot : ssl_robots)
+        {
+            RobotDetection robot_detection =
+                createRobotDetection(ssl_robot, batch.t_capture);
+            if (ignore_invalid_camera_data &&
+                isOutsideValidX(robot_detection.position, min_valid_x, max_valid_x))
+            {
+                continue;
+            }
+
+            if (defending_positive_side)
+            {
+                robot_detection.position    = invertPosition(robot_detection.position);
+                robot_detection.orientation = robot_detection.orientation + Angle::half();
+            }
+            robot_detections.push_back(robot_detection);
+        }
+    };
+    add_robot_detections(detection.robots_yellow(), batch.yellow_robots);
+    add_robot_detections(detection.robots_blue(), batch.blue_robots);
+}
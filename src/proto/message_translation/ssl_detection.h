@@ -91,3 +91,27 @@ std::vector<RobotDetection> createTeamDetection(
     double min_valid_x              = std::numeric_limits<double>::min(),
     double max_valid_x              = std::numeric_limits<double>::max(),
     bool ignore_invalid_camera_data = false);
+
+/**
+ * Converts the ball and robot detections in the given DetectionFrame into the given
+ * batch, replacing its contents. The detections are converted, filtered and moved into
+ * our reference frame in a single pass over the frame, and the memory of the batch is
+ * reused so converting a frame doesn't allocate once the batch is large enough.
+ *
+ * Filters out detections that are less than min_valid_x and greater than max_valid_x
+ * if ignore_invalid_camera_data is true. The valid x range is in SSL vision
+ * coordinates, before the detections are moved into our reference frame.
+ *
+ * @param detection The DetectionFrame to convert
+ * @param min_valid_x min valid x value
+ * @param max_valid_x max valid x value
+ * @param ignore_invalid_camera_data whether or not to ignore detections outside of
+ * valid x range
+ * @param defending_positive_side whether we are defending the positive side of the
+ * field, in which case all positions and orientations are inverted
+ * @param batch The batch to write the detections to
+ */
+void fillVisionDetectionBatch(const SSLProto::SSL_DetectionFrame& detection,
+                              double min_valid_x, double max_valid_x,
+                              bool ignore_invalid_camera_data,
+                              bool defending_positive_side, VisionDetectionBatch& batch);
@@ -212,3 +212,83 @@ TEST(SSLDetectionTest, test_convert_robot_states_to_proto_and_back)
     ASSERT_EQ(2, blue_team_detections[1].id);
     ASSERT_EQ(3, blue_team_detections[2].id);
 }
+
+TEST(SSLDetectionTest, test_fill_vision_detection_batch)
+{
+    const uint32_t camera_id    = 3;
+    const Timestamp t_capture   = Timestamp::fromSeconds(4.5);
+    const uint32_t frame_number = 40391;
+    const BallState ball_state(Point(0.5, -1), Vector(0.01, 3), 0.2);
+
+    std::vector<RobotStateWithId> yellow_robot_states = {RobotStateWithId{
+        .id          = 1,
+        .robot_state = RobotState(Point(1, 2), Vector(0, 0), Angle::quarter(),
+                                  AngularVelocity::zero())}};
+    RobotState blue_robot_state1(Point(-1, 0), Vector(0, 0), Angle::zero(),
+                                 AngularVelocity::zero());
+    RobotState blue_robot_state2(Point(2, -1), Vector(0, 0), Angle::zero(),
+                                 AngularVelocity::zero());
+    std::vector<RobotStateWithId> blue_robot_states = {
+        RobotStateWithId{.id = 4, .robot_state = blue_robot_state1},
+        RobotStateWithId{.id = 5, .robot_state = blue_robot_state2},
+    };
+
+    auto detection_frame =
+        createSSLDetectionFrame(camera_id, t_capture, frame_number, {ball_state},
+                                yellow_robot_states, blue_robot_states);
+    ASSERT_TRUE(detection_frame);
+
+    VisionDetectionBatch batch;
+    fillVisionDetectionBatch(*detection_frame, -1.5, 1.5, true, true, batch);
+
+    EXPECT_EQ(camera_id, batch.camera_id);
+    EXPECT_EQ(t_capture, batch.t_capture);
+
+    // Detections are filtered by their x in vision coordinates, then inverted
+    ASSERT_EQ(1, batch.balls.size());
+    EXPECT_FLOAT_EQ(-0.5f, static_cast<float>(batch.balls[0].position.x()));
+    EXPECT_FLOAT_EQ(1.0f, static_cast<float>(batch.balls[0].position.y()));
+    EXPECT_FLOAT_EQ(0.2f, static_cast<float>(batch.balls[0].distance_from_ground));
+    EXPECT_EQ(t_capture, batch.balls[0].timestamp);
+
+    ASSERT_EQ(1, batch.yellow_robots.size());
+    EXPECT_EQ(1, batch.yellow_robots[0].id);
+    EXPECT_EQ(Point(-1, -2), batch.yellow_robots[0].position);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::threeQuarter(),
+                                               batch.yellow_robots[0].orientation,
+                                               Angle::fromDegrees(0.5)));
+
+    ASSERT_EQ(1, batch.blue_robots.size());
+    EXPECT_EQ(4, batch.blue_robots[0].id);
+    EXPECT_EQ(Point(1, 0), batch.blue_robots[0].position);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Angle::half(), batch.blue_robots[0].orientation, Angle::fromDegrees(0.5)));
+}
+
+TEST(SSLDetectionTest, test_fill_vision_detection_batch_replaces_previous_frame)
+{
+    const BallState ball_state(Point(0.5, -1), Vector(0, 0), 0);
+    std::vector<RobotStateWithId> robot_states = {RobotStateWithId{
+        .id          = 2,
+        .robot_state = RobotState(Point(1, 2), Vector(0, 0), Angle::quarter(),
+                                  AngularVelocity::zero())}};
+
+    auto first_frame = createSSLDetectionFrame(0, Timestamp::fromSeconds(1), 0,
+                                               {ball_state}, robot_states, robot_states);
+    auto second_frame =
+        createSSLDetectionFrame(1, Timestamp::fromSeconds(2), 1, {}, {}, robot_states);
+    ASSERT_TRUE(first_frame);
+    ASSERT_TRUE(second_frame);
+
+    VisionDetectionBatch batch;
+    fillVisionDetectionBatch(*first_frame, 0, 0, false, false, batch);
+    fillVisionDetectionBatch(*second_frame, 0, 0, false, false, batch);
+
+    EXPECT_EQ(1, batch.camera_id);
+    EXPECT_EQ(Timestamp::fromSeconds(2), batch.t_capture);
+    EXPECT_TRUE(batch.balls.empty());
+    EXPECT_TRUE(batch.yellow_robots.empty());
+    ASSERT_EQ(1, batch.blue_robots.size());
+    EXPECT_EQ(Point(1, 2), batch.blue_robots[0].position);
+    EXPECT_EQ(Timestamp::fromSeconds(2), batch.blue_robots[0].timestamp);
+}
@@ -474,6 +474,50 @@ std::optional<TrajectoryPath> createTrajectoryPathFromParams(
     return trajectory_path;
 }
 
+bool generateTrajectoryPathFromParams(
+    const TbotsProto::TrajectoryPathParams2D& params, const Vector& initial_velocity,
+    const robot_constants::RobotConstants& robot_constants,
+    BoundedTrajectoryPath& trajectory_path)
+{
+    double max_speed = convertMaxAllowedSpeedModeToMaxAllowedSpeed(
+        params.max_speed_mode(), robot_constants);
+
+    if (max_speed == 0)
+    {
+        return false;
+    }
+
+    KinematicConstraints constraints(
+        max_speed, robot_constants.robot_trajectory_max_acceleration_m_per_s_2,
+        robot_constants.robot_trajectory_max_deceleration_m_per_s_2);
+
+    Point initial_destination = createPoint(params.destination());
+    if (!params.sub_destinations().empty())
+    {
+        initial_destination = createPoint(params.sub_destinations(0).sub_destination());
+    }
+
+    trajectory_path.generate(createPoint(params.start_position()), initial_destination,
+                             initial_velocity, constraints);
+
+    // Append the rest of the sub-trajectories, followed by a final sub-trajectory to
+    // the final destination
+    for (int i = 1; i <= params.sub_destinations_size(); ++i)
+    {
+        const Point destination =
+            i < params.sub_destinations_size()
+                ? createPoint(params.sub_destinations(i).sub_destination())
+                : createPoint(params.destination());
+        if (!trajectory_path.append(params.sub_destinations(i - 1).connection_time_s(),
+                                    destination, constraints))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 BangBangTrajectory1DAngular createAngularTrajectoryFromParams(
     const TbotsProto::TrajectoryParamsAngular1D& params,
     const AngularVelocity& initial_velocity,
@@ -6,6 +6,7 @@
 #include "proto/visualization.pb.h"
 #include "proto/world.pb.h"
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_1d_angular.h"
+#include "software/ai/navigator/trajectory/bounded_trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/ai/passing/pass_with_rating.h"
 #include "software/world/world.h"
@@ -247,6 +248,23 @@ std::optional<TrajectoryPath> createTrajectoryPathFromParams(
     const TbotsProto::TrajectoryPathParams2D& params, const Vector& initial_velocity,
     const robot_constants::RobotConstants& robot_constants);
 
+/**
+ * Regenerate a BoundedTrajectoryPath in place given 2D trajectory parameters. Unlike
+ * createTrajectoryPathFromParams, this does not allocate memory.
+ *
+ * @param params 2D Trajectory Path
+ * @param initial_velocity Initial velocity to use for the trajectory
+ * @param robot_constants Constants to use for the trajectory
+ * @param trajectory_path The trajectory path to regenerate
+ *
+ * @return true if the trajectory path was regenerated, or false if it could not be
+ * created from the given parameters, in which case trajectory_path should not be used
+ */
+bool generateTrajectoryPathFromParams(
+    const TbotsProto::TrajectoryPathParams2D& params, const Vector& initial_velocity,
+    const robot_constants::RobotConstants& robot_constants,
+    BoundedTrajectoryPath& trajectory_path);
+
 /**
  * Generate an angular trajectory path given angular trajectory proto parameters
  *
@@ -216,6 +216,24 @@ TEST_P(TrajectoryParamConversionTest, trajectory_params_msg_test)
     TrajectoryPath converted_trajectory_path = converted_trajectory_path_opt.value();
     TbotsProtobufTest::assertTrajectoryPathsAreSame(trajectory_path,
                                                     converted_trajectory_path);
+
+    BoundedTrajectoryPath bounded_trajectory_path;
+    ASSERT_TRUE(generateTrajectoryPathFromParams(params, initial_velocity,
+                                                 robot_constants,
+                                                 bounded_trajectory_path));
+    EXPECT_EQ(bounded_trajectory_path.getNumNodes(),
+              trajectory_path.getTrajectoryPathNodes().size());
+    const double total_time_sec = trajectory_path.getTotalTime();
+    EXPECT_NEAR(bounded_trajectory_path.getTotalTime(), total_time_sec, 1e-6);
+    for (double t_sec = 0; t_sec <= total_time_sec; t_sec += total_time_sec / 20)
+    {
+        EXPECT_EQ(bounded_trajectory_path.getPosition(t_sec),
+                  trajectory_path.getPosition(t_sec))
+            << " Position at t=" << t_sec << " is not equal";
+        EXPECT_EQ(bounded_trajectory_path.getVelocity(t_sec),
+                  trajectory_path.getVelocity(t_sec))
+            << " Velocity at t=" << t_sec << " is not equal";
+    }
 }
 
 INSTANTIATE_TEST_CASE_P(
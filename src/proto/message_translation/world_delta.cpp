@@ -0,0 +1,293 @@
+#include "proto/message_translation/world_delta.h"
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include <algorithm>
+
+namespace
+{
+/**
+ * Checks if two protos are equal
+ *
+ * @param message The first proto
+ * @param other_message The second proto
+ *
+ * @return true if the protos have the same fields set to the same values
+ */
+bool equals(const google::protobuf::Message& message,
+            const google::protobuf::Message& other_message)
+{
+    return google::protobuf::util::MessageDifferencer::Equals(message, other_message);
+}
+
+/**
+ * Encodes the parts of a robot's state that differ from the same robot in the keyframe
+ *
+ * @param state The state of the robot
+ * @param keyframe_state The state of the robot in the keyframe
+ * @param robot_delta The robot delta to set the parts that differ in
+ *
+ * @return true if the state was encoded, false if a part of it is only set in one of
+ * the states, since a delta can't unset a part
+ */
+bool encodeRobotStateDelta(const TbotsProto::RobotState& state,
+                           const TbotsProto::RobotState& keyframe_state,
+                           TbotsProto::RobotDelta& robot_delta)
+{
+    if (state.has_global_position() != keyframe_state.has_global_position() ||
+        state.has_global_orientation() != keyframe_state.has_global_orientation() ||
+        state.has_global_velocity() != keyframe_state.has_global_velocity() ||
+        state.has_global_angular_velocity() !=
+            keyframe_state.has_global_angular_velocity())
+    {
+        return false;
+    }
+
+    if (!equals(state.global_position(), keyframe_state.global_position()))
+    {
+        *robot_delta.mutable_current_state()->mutable_global_position() =
+            state.global_position();
+    }
+    if (!equals(state.global_orientation(), keyframe_state.global_orientation()))
+    {
+        *robot_delta.mutable_current_state()->mutable_global_orientation() =
+            state.global_orientation();
+    }
+    if (!equals(state.global_velocity(), keyframe_state.global_velocity()))
+    {
+        *robot_delta.mutable_current_state()->mutable_global_velocity() =
+            state.global_velocity();
+    }
+    if (!equals(state.global_angular_velocity(),
+                keyframe_state.global_angular_velocity()))
+    {
+        *robot_delta.mutable_current_state()->mutable_global_angular_velocity() =
+            state.global_angular_velocity();
+    }
+    return true;
+}
+}  // namespace
+
+WorldDeltaEncoder::WorldDeltaEncoder(unsigned int keyframe_period)
+    : keyframe_period_(keyframe_period)
+{
+}
+
+const TbotsProto::WorldDelta& WorldDeltaEncoder::encode(const TbotsProto::World& world)
+{
+    world_delta_.Clear();
+    world_delta_.set_sequence_number(world.sequence_number());
+
+    if (keyframe_.has_value() && num_deltas_since_keyframe_ + 1 < keyframe_period_ &&
+        encodeDelta(world))
+    {
+        num_deltas_since_keyframe_++;
+        return world_delta_;
+    }
+
+    // encodeDelta may have partially filled in the delta before finding that the World
+    // needs a keyframe
+    world_delta_.Clear();
+    world_delta_.set_sequence_number(world.sequence_number());
+    *world_delta_.mutable_keyframe() = world;
+
+    keyframe_                  = world;
+    num_deltas_since_keyframe_ = 0;
+    return world_delta_;
+}
+
+bool WorldDeltaEncoder::encodeDelta(const TbotsProto::World& world)
+{
+    if (!equals(world.field(), keyframe_->field()) ||
+        !equals(world.game_state(), keyframe_->game_state()))
+    {
+        return false;
+    }
+
+    if (!encodeTeamDelta(world.friendly_team(), keyframe_->friendly_team(),
+                         *world_delta_.mutable_friendly_robots()) ||
+        !encodeTeamDelta(world.enemy_team(), keyframe_->enemy_team(),
+                         *world_delta_.mutable_enemy_robots()))
+    {
+        return false;
+    }
+
+    world_delta_.set_keyframe_sequence_number(keyframe_->sequence_number());
+    *world_delta_.mutable_time_sent() = world.time_sent();
+
+    if (!equals(world.ball(), keyframe_->ball()))
+    {
+        *world_delta_.mutable_ball() = world.ball();
+    }
+
+    if (world.has_dribble_displacement())
+    {
+        if (!keyframe_->has_dribble_displacement() ||
+            !equals(world.dribble_displacement(), keyframe_->dribble_displacement()))
+        {
+            *world_delta_.mutable_dribble_displacement() = world.dribble_displacement();
+        }
+    }
+    else if (keyframe_->has_dribble_displacement())
+    {
+        world_delta_.set_dribble_displacement_cleared(true);
+    }
+
+    return true;
+}
+
+bool WorldDeltaEncoder::encodeTeamDelta(
+    const TbotsProto::Team& team, const TbotsProto::Team& keyframe_team,
+    google::protobuf::RepeatedPtrField<TbotsProto::RobotDelta>& robot_deltas)
+{
+    if (team.has_goalie_id() != keyframe_team.has_goalie_id() ||
+        team.goalie_id() != keyframe_team.goalie_id() ||
+        team.team_robots_size() != keyframe_team.team_robots_size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < team.team_robots_size(); i++)
+    {
+        const TbotsProto::Robot& robot          = team.team_robots(i);
+        const TbotsProto::Robot& keyframe_robot = keyframe_team.team_robots(i);
+        if (robot.id() != keyframe_robot.id())
+        {
+            return false;
+        }
+
+        // Robot deltas are added in place and removed if the robot didn't change, so
+        // that the robot deltas allocated by previous frames are reused
+        TbotsProto::RobotDelta& robot_delta = *robot_deltas.Add();
+        if (!encodeRobotStateDelta(robot.current_state(), keyframe_robot.current_state(),
+                                   robot_delta))
+        {
+            return false;
+        }
+
+        if (!equals(robot.timestamp(), keyframe_robot.timestamp()))
+        {
+            *robot_delta.mutable_timestamp() = robot.timestamp();
+        }
+
+        if (!std::equal(robot.unavailable_capabilities().begin(),
+                        robot.unavailable_capabilities().end(),
+                        keyframe_robot.unavailable_capabilities().begin(),
+                        keyframe_robot.unavailable_capabilities().end()))
+        {
+            *robot_delta.mutable_unavailable_capabilities()->mutable_capabilities() =
+                robot.unavailable_capabilities();
+        }
+
+        if (robot_delta.has_current_state() || robot_delta.has_timestamp() ||
+            robot_delta.has_unavailable_capabilities())
+        {
+            robot_delta.set_id(robot.id());
+        }
+        else
+        {
+            robot_deltas.RemoveLast();
+        }
+    }
+
+    return true;
+}
+
+bool WorldDeltaDecoder::decode(const TbotsProto::WorldDelta& world_delta,
+                               TbotsProto::World& world)
+{
+    if (world_delta.has_keyframe())
+    {
+        keyframe_                 = world_delta.keyframe();
+        keyframe_sequence_number_ = world_delta.sequence_number();
+        world                     = *keyframe_;
+        return true;
+    }
+
+    if (!keyframe_.has_value() || !world_delta.has_keyframe_sequence_number() ||
+        world_delta.keyframe_sequence_number() != keyframe_sequence_number_)
+    {
+        return false;
+    }
+
+    world = *keyframe_;
+    world.set_sequence_number(world_delta.sequence_number());
+
+    if (world_delta.has_time_sent())
+    {
+        *world.mutable_time_sent() = world_delta.time_sent();
+    }
+
+    if (!applyRobotDeltas(world_delta.friendly_robots(),
+                          *world.mutable_friendly_team()) ||
+        !applyRobotDeltas(world_delta.enemy_robots(), *world.mutable_enemy_team()))
+    {
+        return false;
+    }
+
+    if (world_delta.has_ball())
+    {
+        *world.mutable_ball() = world_delta.ball();
+    }
+
+    if (world_delta.has_dribble_displacement())
+    {
+        *world.mutable_dribble_displacement() = world_delta.dribble_displacement();
+    }
+    else if (world_delta.dribble_displacement_cleared())
+    {
+        world.clear_dribble_displacement();
+    }
+
+    return true;
+}
+
+bool WorldDeltaDecoder::applyRobotDeltas(
+    const google::protobuf::RepeatedPtrField<TbotsProto::RobotDelta>& robot_deltas,
+    TbotsProto::Team& team)
+{
+    for (const TbotsProto::RobotDelta& robot_delta : robot_deltas)
+    {
+        auto robot = std::find_if(team.mutable_team_robots()->begin(),
+                                  team.mutable_team_robots()->end(),
+                                  [&](const TbotsProto::Robot& robot)
+                                  { return robot.id() == robot_delta.id(); });
+        if (robot == team.mutable_team_robots()->end())
+        {
+            return false;
+        }
+
+        const TbotsProto::RobotState& state_delta = robot_delta.current_state();
+        TbotsProto::RobotState& state             = *robot->mutable_current_state();
+        if (state_delta.has_global_position())
+        {
+            *state.mutable_global_position() = state_delta.global_position();
+        }
+        if (state_delta.has_global_orientation())
+        {
+            *state.mutable_global_orientation() = state_delta.global_orientation();
+        }
+        if (state_delta.has_global_velocity())
+        {
+            *state.mutable_global_velocity() = state_delta.global_velocity();
+        }
+        if (state_delta.has_global_angular_velocity())
+        {
+            *state.mutable_global_angular_velocity() =
+                state_delta.global_angular_velocity();
+        }
+
+        if (robot_delta.has_timestamp())
+        {
+            *robot->mutable_timestamp() = robot_delta.timestamp();
+        }
+
+        if (robot_delta.has_unavailable_capabilities())
+        {
+            *robot->mutable_unavailable_capabilities() =
+                robot_delta.unavailable_capabilities().capabilities();
+        }
+    }
+
+    return true;
+}
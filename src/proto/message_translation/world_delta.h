@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "proto/world.pb.h"
+
+/**
+ * Delta encoding of a stream of World protos, so that the parts of the World that
+ * rarely change (the field, game state and the teams' goalies and robot IDs) aren't
+ * serialized every frame.
+ *
+ * Every keyframe_period Worlds, and whenever one of the rarely changing parts changes,
+ * the encoder sends a keyframe holding the complete World. Every other World is sent as
+ * the parts of its robots, ball and dribble displacement that differ from the last
+ * keyframe. Since deltas are relative to the last keyframe rather than to the previous
+ * World, a decoder that misses a delta (because a listener dropped it, or because a
+ * replay was seeked) only misses that World, and a decoder that misses a keyframe
+ * resumes at the next one.
+ *
+ * Worlds in a stream must have increasing sequence numbers, which are used to match
+ * deltas with their keyframe.
+ */
+
+// How many Worlds are encoded per keyframe by default, which is about once a second
+static constexpr unsigned int WORLD_DELTA_DEFAULT_KEYFRAME_PERIOD = 60;
+
+/**
+ * Encodes a stream of Worlds into WorldDeltas
+ */
+class WorldDeltaEncoder
+{
+   public:
+    /**
+     * Creates a WorldDeltaEncoder
+     *
+     * @param keyframe_period How many Worlds are encoded per keyframe
+     */
+    explicit WorldDeltaEncoder(
+        unsigned int keyframe_period = WORLD_DELTA_DEFAULT_KEYFRAME_PERIOD);
+
+    /**
+     * Encodes the next World in the stream
+     *
+     * @param world The World to encode
+     *
+     * @return the encoded World, which is valid until the next call to encode
+     */
+    const TbotsProto::WorldDelta& encode(const TbotsProto::World& world);
+
+   private:
+    /**
+     * Encodes the given World as the differences from the keyframe
+     *
+     * @param world The World to encode
+     *
+     * @return true if the World was encoded, false if it differs from the keyframe in a
+     * part that is only sent in keyframes
+     */
+    bool encodeDelta(const TbotsProto::World& world);
+
+    /**
+     * Encodes the differences between the robots of a team and the robots of the same
+     * team in the keyframe
+     *
+     * @param team The team to encode
+     * @param keyframe_team The same team in the keyframe
+     * @param robot_deltas The robot deltas to add the robots that differ to
+     *
+     * @return true if the team was encoded, false if its goalie or robot IDs differ
+     * from the keyframe
+     */
+    static bool encodeTeamDelta(
+        const TbotsProto::Team& team, const TbotsProto::Team& keyframe_team,
+        google::protobuf::RepeatedPtrField<TbotsProto::RobotDelta>& robot_deltas);
+
+    unsigned int keyframe_period_;
+    unsigned int num_deltas_since_keyframe_ = 0;
+    std::optional<TbotsProto::World> keyframe_;
+    TbotsProto::WorldDelta world_delta_;
+};
+
+/**
+ * Decodes a stream of WorldDeltas back into complete Worlds
+ */
+class WorldDeltaDecoder
+{
+   public:
+    /**
+     * Decodes the next WorldDelta in the stream
+     *
+     * @param world_delta The WorldDelta to decode
+     * @param world The World to decode into. Its previous contents are replaced, but
+     * its allocated sub-messages are reused.
+     *
+     * @return true if the World was decoded, false if the WorldDelta is relative to a
+     * keyframe that this decoder hasn't decoded, or is malformed
+     */
+    bool decode(const TbotsProto::WorldDelta& world_delta, TbotsProto::World& world);
+
+   private:
+    /**
+     * Applies robot deltas to the robots of a team
+     *
+     * @param robot_deltas The robot deltas to apply
+     * @param team The team to apply them to
+     *
+     * @return true if every robot delta was applied, false if the team doesn't have one
+     * of the robots
+     */
+    static bool applyRobotDeltas(
+        const google::protobuf::RepeatedPtrField<TbotsProto::RobotDelta>& robot_deltas,
+        TbotsProto::Team& team);
+
+    std::optional<TbotsProto::World> keyframe_;
+    std::uint64_t keyframe_sequence_number_ = 0;
+};
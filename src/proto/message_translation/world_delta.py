@@ -0,0 +1,104 @@
+from __future__ import annotations
+
+from proto.world_pb2 import World, WorldDelta
+from proto.team_pb2 import Team
+
+
+class WorldDeltaDecoder:
+    """Decodes a stream of WorldDeltas back into complete Worlds.
+
+    This mirrors the WorldDeltaDecoder in world_delta.h: keyframes hold the
+    complete World, and every other WorldDelta holds the parts of the robots,
+    ball and dribble displacement that differ from the last keyframe. Deltas
+    relative to a keyframe that this decoder hasn't decoded (because the
+    keyframe was dropped, or a replay was seeked past it) are skipped until
+    the next keyframe.
+    """
+
+    ROBOT_STATE_PARTS = [
+        "global_position",
+        "global_orientation",
+        "global_velocity",
+        "global_angular_velocity",
+    ]
+
+    def __init__(self) -> None:
+        """Creates a WorldDeltaDecoder"""
+        self.keyframe = None
+        self.keyframe_sequence_number = 0
+
+    def decode(self, world_delta: WorldDelta) -> World | None:
+        """Decodes the next WorldDelta in the stream
+
+        :param world_delta: The WorldDelta to decode
+        :return: The decoded World, or None if the WorldDelta is relative to a
+                 keyframe that this decoder hasn't decoded, or is malformed
+        """
+        if world_delta.HasField("keyframe"):
+            self.keyframe = World()
+            self.keyframe.CopyFrom(world_delta.keyframe)
+            self.keyframe_sequence_number = world_delta.sequence_number
+
+            world = World()
+            world.CopyFrom(self.keyframe)
+            return world
+
+        if (
+            self.keyframe is None
+            or not world_delta.HasField("keyframe_sequence_number")
+            or world_delta.keyframe_sequence_number != self.keyframe_sequence_number
+        ):
+            return None
+
+        world = World()
+        world.CopyFrom(self.keyframe)
+        world.sequence_number = world_delta.sequence_number
+
+        if world_delta.HasField("time_sent"):
+            world.time_sent.CopyFrom(world_delta.time_sent)
+
+        if not self.__apply_robot_deltas(
+            world_delta.friendly_robots, world.friendly_team
+        ) or not self.__apply_robot_deltas(world_delta.enemy_robots, world.enemy_team):
+            return None
+
+        if world_delta.HasField("ball"):
+            world.ball.CopyFrom(world_delta.ball)
+
+        if world_delta.HasField("dribble_displacement"):
+            world.dribble_displacement.CopyFrom(world_delta.dribble_displacement)
+        elif world_delta.dribble_displacement_cleared:
+            world.ClearField("dribble_displacement")
+
+        return world
+
+    def __apply_robot_deltas(self, robot_deltas, team: Team) -> bool:
+        """Applies robot deltas to the robots of a team
+
+        :param robot_deltas: The robot deltas to apply
+        :param team: The team to apply them to
+        :return: True if every robot delta was applied, False if the team
+                 doesn't have one of the robots
+        """
+        robots = {robot.id: robot for robot in team.team_robots}
+
+        for robot_delta in robot_deltas:
+            robot = robots.get(robot_delta.id)
+            if robot is None:
+                return False
+
+            for part in WorldDeltaDecoder.ROBOT_STATE_PARTS:
+                if robot_delta.current_state.HasField(part):
+                    getattr(robot.current_state, part).CopyFrom(
+                        getattr(robot_delta.current_state, part)
+                    )
+
+            if robot_delta.HasField("timestamp"):
+                robot.timestamp.CopyFrom(robot_delta.timestamp)
+
+            if robot_delta.HasField("unavailable_capabilities"):
+                robot.unavailable_capabilities[:] = (
+                    robot_delta.unavailable_capabilities.capabilities
+                )
+
+        return True
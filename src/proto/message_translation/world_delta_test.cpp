@@ -0,0 +1,235 @@
+#include "proto/message_translation/world_delta.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/tbots_protobuf.h"
+
+class WorldDeltaTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Timestamp timestamp = Timestamp::fromSeconds(1);
+        Team friendly_team({
+            Robot(0, Point(-1, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+                  timestamp),
+            Robot(1, Point(-2, 1), Vector(), Angle::half(), AngularVelocity::zero(),
+                  timestamp),
+        });
+        friendly_team.assignGoalie(1);
+        Team enemy_team({
+            Robot(2, Point(1, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+                  timestamp),
+            Robot(3, Point(2, -1), Vector(), Angle::zero(), AngularVelocity::zero(),
+                  timestamp),
+        });
+
+        world_ = *createWorldWithSequenceNumber(
+            World(Field::createSSLDivisionBField(),
+                  Ball(Point(0, 0), Vector(), timestamp), friendly_team, enemy_team),
+            0);
+    }
+
+    /**
+     * Gets the next World in the stream, with the given robot moved
+     *
+     * @param robot_index The index of the friendly robot to move
+     *
+     * @return the next World
+     */
+    TbotsProto::World nextWorld(int robot_index)
+    {
+        world_.set_sequence_number(world_.sequence_number() + 1);
+        world_.mutable_time_sent()->set_epoch_timestamp_seconds(
+            world_.time_sent().epoch_timestamp_seconds() + 0.01);
+
+        TbotsProto::Robot* robot = world_.mutable_friendly_team()->mutable_team_robots(
+            robot_index);
+        robot->mutable_current_state()->mutable_global_position()->set_x_meters(
+            robot->current_state().global_position().x_meters() + 0.01);
+        robot->mutable_timestamp()->set_epoch_timestamp_seconds(
+            world_.time_sent().epoch_timestamp_seconds());
+        return world_;
+    }
+
+    /**
+     * Encodes and decodes the World, and checks that the decoded World is the same
+     *
+     * @param world The World to encode
+     *
+     * @return the encoded World
+     */
+    TbotsProto::WorldDelta encodeAndDecode(const TbotsProto::World& world)
+    {
+        const TbotsProto::WorldDelta world_delta = encoder_.encode(world);
+
+        TbotsProto::World decoded_world;
+        EXPECT_TRUE(decoder_.decode(world_delta, decoded_world));
+        EXPECT_TRUE(
+            google::protobuf::util::MessageDifferencer::Equals(world, decoded_world))
+            << world.DebugString() << decoded_world.DebugString();
+        return world_delta;
+    }
+
+    TbotsProto::World world_;
+    WorldDeltaEncoder encoder_ = WorldDeltaEncoder(10);
+    WorldDeltaDecoder decoder_;
+};
+
+TEST_F(WorldDeltaTest, first_world_is_keyframe)
+{
+    const TbotsProto::WorldDelta world_delta = encodeAndDecode(world_);
+
+    EXPECT_TRUE(world_delta.has_keyframe());
+    EXPECT_EQ(0, world_delta.sequence_number());
+}
+
+TEST_F(WorldDeltaTest, sends_keyframe_every_keyframe_period)
+{
+    encodeAndDecode(world_);
+
+    for (int i = 1; i < 30; i++)
+    {
+        const TbotsProto::WorldDelta world_delta = encodeAndDecode(nextWorld(i % 2));
+        EXPECT_EQ(i % 10 == 0, world_delta.has_keyframe()) << i;
+        EXPECT_EQ(i, world_delta.sequence_number());
+    }
+}
+
+TEST_F(WorldDeltaTest, delta_only_has_parts_that_changed)
+{
+    encodeAndDecode(world_);
+    const TbotsProto::WorldDelta world_delta = encodeAndDecode(nextWorld(0));
+
+    ASSERT_FALSE(world_delta.has_keyframe());
+    EXPECT_EQ(0, world_delta.keyframe_sequence_number());
+    EXPECT_FALSE(world_delta.has_ball());
+    EXPECT_EQ(0, world_delta.enemy_robots_size());
+    ASSERT_EQ(1, world_delta.friendly_robots_size());
+
+    const TbotsProto::RobotDelta& robot_delta = world_delta.friendly_robots(0);
+    EXPECT_EQ(0, robot_delta.id());
+    EXPECT_TRUE(robot_delta.current_state().has_global_position());
+    EXPECT_FALSE(robot_delta.current_state().has_global_orientation());
+    EXPECT_FALSE(robot_delta.current_state().has_global_velocity());
+    EXPECT_TRUE(robot_delta.has_timestamp());
+    EXPECT_FALSE(robot_delta.has_unavailable_capabilities());
+
+    EXPECT_LT(world_delta.ByteSizeLong(), world_.ByteSizeLong() / 4);
+}
+
+TEST_F(WorldDeltaTest, robots_that_changed_since_keyframe_stay_in_deltas)
+{
+    encodeAndDecode(world_);
+    encodeAndDecode(nextWorld(0));
+    const TbotsProto::WorldDelta world_delta = encodeAndDecode(nextWorld(1));
+
+    ASSERT_FALSE(world_delta.has_keyframe());
+    EXPECT_EQ(2, world_delta.friendly_robots_size());
+}
+
+TEST_F(WorldDeltaTest, changing_game_state_sends_keyframe)
+{
+    encodeAndDecode(world_);
+
+    TbotsProto::World world = nextWorld(0);
+    world.mutable_game_state()->set_command(
+        TbotsProto::GameState::REFEREE_COMMAND_FORCE_START);
+    EXPECT_TRUE(encodeAndDecode(world).has_keyframe());
+}
+
+TEST_F(WorldDeltaTest, changing_field_sends_keyframe)
+{
+    encodeAndDecode(world_);
+
+    TbotsProto::World world = nextWorld(0);
+    world.mutable_field()->set_field_x_length(12);
+    EXPECT_TRUE(encodeAndDecode(world).has_keyframe());
+}
+
+TEST_F(WorldDeltaTest, changing_robots_or_goalie_sends_keyframe)
+{
+    encodeAndDecode(world_);
+
+    TbotsProto::World world = nextWorld(0);
+    world.mutable_enemy_team()->mutable_team_robots()->RemoveLast();
+    EXPECT_TRUE(encodeAndDecode(world).has_keyframe());
+
+    world = nextWorld(0);
+    world.mutable_enemy_team()->mutable_team_robots()->RemoveLast();
+    EXPECT_FALSE(encodeAndDecode(world).has_keyframe());
+    world.mutable_friendly_team()->set_goalie_id(0);
+    EXPECT_TRUE(encodeAndDecode(world).has_keyframe());
+}
+
+TEST_F(WorldDeltaTest, encodes_ball_capabilities_and_dribble_displacement)
+{
+    encodeAndDecode(world_);
+
+    TbotsProto::World world = nextWorld(0);
+    world.mutable_ball()->mutable_current_state()->set_distance_from_ground(0.1);
+    world.mutable_friendly_team()->mutable_team_robots(1)->add_unavailable_capabilities(
+        TbotsProto::Robot::Kick);
+    world.mutable_dribble_displacement()->mutable_start()->set_x_meters(1);
+    TbotsProto::WorldDelta world_delta = encodeAndDecode(world);
+    ASSERT_FALSE(world_delta.has_keyframe());
+    EXPECT_TRUE(world_delta.has_ball());
+    EXPECT_TRUE(world_delta.has_dribble_displacement());
+
+    // Clearing the dribble displacement and capabilities set since the keyframe
+    world.clear_dribble_displacement();
+    world.mutable_friendly_team()
+        ->mutable_team_robots(1)
+        ->clear_unavailable_capabilities();
+    world_delta = encodeAndDecode(world);
+    ASSERT_FALSE(world_delta.has_keyframe());
+    EXPECT_FALSE(world_delta.has_dribble_displacement());
+    EXPECT_FALSE(world_delta.dribble_displacement_cleared());
+}
+
+TEST_F(WorldDeltaTest, clears_dribble_displacement_of_keyframe)
+{
+    world_.mutable_dribble_displacement()->mutable_end()->set_y_meters(1);
+    encodeAndDecode(world_);
+
+    TbotsProto::World world = nextWorld(0);
+    world.clear_dribble_displacement();
+    const TbotsProto::WorldDelta world_delta = encodeAndDecode(world);
+    ASSERT_FALSE(world_delta.has_keyframe());
+    EXPECT_TRUE(world_delta.dribble_displacement_cleared());
+}
+
+TEST_F(WorldDeltaTest, decoder_waits_for_keyframe)
+{
+    encoder_.encode(world_);
+    const TbotsProto::WorldDelta world_delta = encoder_.encode(nextWorld(0));
+
+    TbotsProto::World decoded_world;
+    EXPECT_FALSE(decoder_.decode(world_delta, decoded_world));
+
+    for (int i = 2; i < 10; i++)
+    {
+        encoder_.encode(nextWorld(0));
+    }
+    EXPECT_TRUE(decoder_.decode(encoder_.encode(nextWorld(0)), decoded_world));
+    EXPECT_EQ(10, decoded_world.sequence_number());
+}
+
+TEST_F(WorldDeltaTest, missed_delta_only_loses_that_world)
+{
+    encodeAndDecode(world_);
+    encoder_.encode(nextWorld(0));
+    encoder_.encode(nextWorld(1));
+    encodeAndDecode(nextWorld(0));
+}
+
+TEST_F(WorldDeltaTest, decoder_rejects_delta_with_unknown_robot)
+{
+    encodeAndDecode(world_);
+    TbotsProto::WorldDelta world_delta = encoder_.encode(nextWorld(0));
+    world_delta.mutable_friendly_robots(0)->set_id(7);
+
+    TbotsProto::World decoded_world;
+    EXPECT_FALSE(decoder_.decode(world_delta, decoded_world));
+}
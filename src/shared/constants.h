@@ -33,6 +33,10 @@ static const std::string LOOPBACK_INTERFACE = "lo";
 static const std::string PLOTJUGGLER_GUI_DEFAULT_HOST        = "ff02::c3d0:42d2:aaaa";
 static const short unsigned int PLOTJUGGLER_GUI_DEFAULT_PORT = 9870;
 
+// PlotJuggler port for TELEMETRY, which is sent as CBOR rather than the JSON sent to
+// the default port, since a PlotJuggler UDP server only parses one format
+static const short unsigned int PLOTJUGGLER_TELEMETRY_DEFAULT_PORT = 9871;
+
 // ProtoLogger constants for replay files
 static const std::string REPLAY_FILE_EXTENSION      = "replay";
 static const std::string REPLAY_METADATA_DELIMITER  = ",";
@@ -55,6 +59,10 @@ static constexpr short unsigned int NETWORK_COMM_TEST_PORT                    =
 static constexpr short unsigned int ROBOT_TO_FULL_SYSTEM_IP_NOTIFICATION_PORT = 42073;
 static constexpr short unsigned int FULL_SYSTEM_TO_ROBOT_IP_NOTIFICATION_PORT = 42076;
 
+// the multicast port robots are listening to for compact primitive sets, which carry the
+// primitives of every robot in one datagram
+static constexpr short unsigned int COMPACT_PRIMITIVE_SET_PORT = 42077;
+
 // maximum transfer unit of the network interface
 // this is an int to avoid Wconversion with lwip
 static const short unsigned int MAXIMUM_TRANSFER_UNIT_BYTES = 1500;
@@ -1,28 +1,51 @@
 #include "software/ai/ai.h"
 
 #include <Tracy.hpp>
+#include <optional>
 
 #include "software/ai/hl/stp/play/halt_play/halt_play.h"
 #include "software/ai/hl/stp/play/play_factory.h"
 #include "software/tracy/tracy_constants.h"
 
-
-Ai::Ai(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr)
-    : ai_config_ptr(ai_config_ptr),
-      fsm(std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config_ptr})),
-      override_play(nullptr),
-      current_play(std::make_unique<HaltPlay>(ai_config_ptr)),
-      ai_config_changed(false)
+#ifdef TRACK_ALLOCATIONS
+/**
+ * Plots the number of heap allocations made by each stage of an AI tick in Tracy
+ *
+ * @param tick_profile The profile of the tick
+ */
+static void plotTickAllocations(const AiTickProfile& tick_profile)
 {
-    auto current_override = ai_config_ptr->ai_control_config().override_ai_play();
-    if (current_override != TbotsProto::PlayName::UseAiSelection)
+    // Tracy identifies plots by the address of their name, so the names must live as
+    // long as the program
+    static const auto plot_names = []()
     {
-        // Override to new play if we're not running Ai Selection
-        TbotsProto::Play play_proto;
-        play_proto.set_name(current_override);
-        overridePlayFromProto(play_proto);
+        std::array<std::string, reflective_enum::size<AiTickStage>()> names;
+        for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+        {
+            names[static_cast<std::size_t>(stage)] =
+                "AI allocations: " + std::string(reflective_enum::nameOf(stage));
+        }
+        return names;
+    }();
+
+    for (std::size_t i = 0; i < plot_names.size(); i++)
+    {
+        TracyPlot(plot_names[i].c_str(),
+                  static_cast<int64_t>(tick_profile.stage_num_allocations[i]));
     }
 }
+#endif
+
+Ai::Ai(std::shared_ptr<const AiConfigStore> ai_config_store)
+    : ai_config_store(ai_config_store),
+      ai_config_snapshot(ai_config_store->load()),
+      fsm(std::make_unique<FSM<PlaySelectionFSM>>(
+          PlaySelectionFSM{ai_config_snapshot->getAiConfigPtr()})),
+      override_play(nullptr),
+      current_play(std::make_unique<HaltPlay>(ai_config_snapshot->getAiConfigPtr()))
+{
+    applyOverridePlayFromConfig();
+}
 
 void Ai::overridePlay(std::unique_ptr<Play> play)
 {
@@ -32,35 +55,37 @@ void Ai::overridePlay(std::unique_ptr<Play> play)
 void Ai::overridePlayFromProto(TbotsProto::Play play_proto)
 {
     current_override_play_proto = play_proto;
-    overridePlay(std::move(createPlay(play_proto, ai_config_ptr)));
-}
-
-void Ai::updateAiConfig()
-{
-    ai_config_changed = true;
+    overridePlay(std::move(createPlay(play_proto, ai_config_snapshot->getAiConfigPtr())));
 }
 
 void Ai::checkAiConfig()
 {
-    if (ai_config_changed)
+    std::shared_ptr<const AiConfigSnapshot> latest_snapshot = ai_config_store->load();
+    if (latest_snapshot == ai_config_snapshot)
     {
-        ai_config_changed = false;
+        return;
+    }
 
-        fsm = std::make_unique<FSM<PlaySelectionFSM>>(PlaySelectionFSM{ai_config_ptr});
+    ai_config_snapshot = std::move(latest_snapshot);
+    fsm                = std::make_unique<FSM<PlaySelectionFSM>>(
+        PlaySelectionFSM{ai_config_snapshot->getAiConfigPtr()});
+    applyOverridePlayFromConfig();
+}
 
-        auto current_override = ai_config_ptr->ai_control_config().override_ai_play();
-        if (current_override != TbotsProto::PlayName::UseAiSelection)
-        {
-            // Override to new play if we're not running Ai Selection
-            TbotsProto::Play play_proto;
-            play_proto.set_name(current_override);
-            overridePlayFromProto(play_proto);
-        }
-        else
-        {
-            // Clear play override if we're running Ai Selection
-            overridePlay(nullptr);
-        }
+void Ai::applyOverridePlayFromConfig()
+{
+    auto current_override = ai_config_snapshot->getOverrideAiPlay();
+    if (current_override != TbotsProto::PlayName::UseAiSelection)
+    {
+        // Override to new play if we're not running Ai Selection
+        TbotsProto::Play play_proto;
+        play_proto.set_name(current_override);
+        overridePlayFromProto(play_proto);
+    }
+    else
+    {
+        // Clear play override if we're running Ai Selection
+        overridePlay(nullptr);
     }
 }
 
@@ -70,25 +95,50 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Ai::getPrimitives(const WorldPtr& worl
 
     checkAiConfig();
 
-    fsm->process_event(PlaySelectionFSM::Update([this](std::unique_ptr<Play> play)
-                                                { current_play = std::move(play); },
-                                                world_ptr->gameState(), *ai_config_ptr));
+    ScopedAiTickTimeBudget tick_time_budget(
+        ai_config_snapshot->getAiConfig().ai_time_budget_config(), time_budget_stats);
+
+#ifdef TRACK_ALLOCATIONS
+    // Profile every tick so that the allocations made by each stage are reported
+    std::optional<ScopedAiTickProfiler> tick_profiler;
+    if (!ScopedAiTickProfiler::isProfilingTick())
+    {
+        tick_profiler.emplace(last_tick_profile);
+    }
+#endif
+
+    {
+        ScopedAiStageTimer play_selection_timer(AiTickStage::PLAY_SELECTION);
+        fsm->process_event(PlaySelectionFSM::Update(
+            [this](std::unique_ptr<Play> play) { current_play = std::move(play); },
+            world_ptr->gameState(), ai_config_snapshot->getAiConfigPtr()));
+    }
 
     std::unique_ptr<TbotsProto::PrimitiveSet> primitive_set;
     if (static_cast<bool>(override_play))
     {
-        primitive_set = override_play->get(world_ptr, inter_play_communication,
-                                           [this](InterPlayCommunication comm) {
-                                               inter_play_communication = std::move(comm);
-                                           });
+        primitive_set = override_play->get(
+            world_ptr, inter_play_communication,
+            [this](InterPlayCommunication comm)
+            { inter_play_communication = std::move(comm); },
+            ai_config_snapshot);
     }
     else
     {
-        primitive_set = current_play->get(world_ptr, inter_play_communication,
-                                          [this](InterPlayCommunication comm) {
-                                              inter_play_communication = std::move(comm);
-                                          });
+        primitive_set = current_play->get(
+            world_ptr, inter_play_communication,
+            [this](InterPlayCommunication comm)
+            { inter_play_communication = std::move(comm); },
+            ai_config_snapshot);
+    }
+
+#ifdef TRACK_ALLOCATIONS
+    if (tick_profiler.has_value())
+    {
+        tick_profiler.reset();
+        plotTickAllocations(last_tick_profile);
     }
+#endif
 
     FrameMarkEnd(TracyConstants::AI_FRAME_MARKER);
 
@@ -121,5 +171,29 @@ TbotsProto::PlayInfo Ai::getPlayInfo() const
         (*info.mutable_robot_tactic_assignment())[robot_id] = tactic_msg;
     }
 
+    TbotsProto::PlayInfo_TimeBudget* time_budget_msg = info.mutable_time_budget();
+    time_budget_msg->set_num_ticks(time_budget_stats.num_ticks);
+    time_budget_msg->set_num_tick_overruns(time_budget_stats.num_tick_overruns);
+    for (AiStage stage : reflective_enum::values<AiStage>())
+    {
+        const std::string stage_name(reflective_enum::nameOf(stage));
+        (*time_budget_msg->mutable_num_stage_overruns())[stage_name] =
+            time_budget_stats.num_stage_overruns[static_cast<std::size_t>(stage)];
+    }
+
+#ifdef TRACK_ALLOCATIONS
+    TbotsProto::PlayInfo_TickAllocations* tick_allocations_msg =
+        info.mutable_tick_allocations();
+    for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+    {
+        const std::string stage_name(reflective_enum::nameOf(stage));
+        const std::size_t index = static_cast<std::size_t>(stage);
+        (*tick_allocations_msg->mutable_num_allocations())[stage_name] =
+            last_tick_profile.stage_num_allocations[index];
+        (*tick_allocations_msg->mutable_num_bytes_allocated())[stage_name] =
+            last_tick_profile.stage_num_bytes_allocated[index];
+    }
+#endif
+
     return info;
 }
@@ -3,8 +3,11 @@
 #include <functional>
 
 #include "proto/play_info_msg.pb.h"
+#include "software/ai/config/ai_config_store.h"
 #include "software/ai/hl/stp/play/play.h"
 #include "software/ai/play_selection_fsm.h"
+#include "software/ai/profiling/ai_tick_profiler.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/time/timestamp.h"
 #include "software/world/world.h"
 
@@ -18,9 +21,9 @@ class Ai final
 
     /**
      * Create an AI with given configurations
-     * @param ai_config_ptr shared pointer to the ai configuration
+     * @param ai_config_store the store to load the latest ai configuration from
      */
-    explicit Ai(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr);
+    explicit Ai(std::shared_ptr<const AiConfigStore> ai_config_store);
 
     /**
      * Overrides the play
@@ -31,7 +34,10 @@ class Ai final
 
     /**
      * Calculates the Primitives that should be run by our Robots given the current
-     * state of the world.
+     * state of the world. The latest ai configuration is loaded from the config store
+     * once at the start, and used for the whole calculation. The calculation runs
+     * within the time budget set in the ai configuration, so its anytime stages may
+     * return early with their best results so far.
      *
      * @param world The state of the World with which to make the decisions
      *
@@ -42,7 +48,8 @@ class Ai final
 
     /**
      * Returns information about the currently running plays and tactics, including the
-     * name of the play, and which robots are running which tactics
+     * name of the play, which robots are running which tactics, and how often the AI
+     * has run out of time
      *
      * @return information about the currently running plays and tactics
      */
@@ -55,22 +62,30 @@ class Ai final
      */
     void overridePlayFromProto(TbotsProto::Play play_proto);
 
+   private:
     /**
-     * Update the AiConfig proto
-     *
-     * @param ai_config The new AiConfig proto
+     * Loads the latest ai configuration from the config store, and resets the play
+     * selection and play override if it has changed since the last time it was loaded
      */
-    void updateAiConfig();
-
-   private:
     void checkAiConfig();
 
-    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
+    /**
+     * Overrides the play with the play set in the current ai configuration, or clears
+     * the override if the AI should select the play
+     */
+    void applyOverridePlayFromConfig();
+
+    std::shared_ptr<const AiConfigStore> ai_config_store;
+    std::shared_ptr<const AiConfigSnapshot> ai_config_snapshot;
     std::unique_ptr<FSM<PlaySelectionFSM>> fsm;
     std::unique_ptr<Play> override_play;
     std::unique_ptr<Play> current_play;
     TbotsProto::Play current_override_play_proto;
-    bool ai_config_changed;
+    AiTimeBudgetStats time_budget_stats;
+
+    // The profile of the last tick, which is only recorded when allocations are
+    // tracked and the caller of getPrimitives isn't profiling the tick itself
+    AiTickProfile last_tick_profile;
 
     // inter play communication
     InterPlayCommunication inter_play_communication;
@@ -0,0 +1,60 @@
+#include "software/ai/config/ai_config_snapshot.h"
+
+AiConfigSnapshot::AiConfigSnapshot(const TbotsProto::AiConfig& ai_config,
+                                   std::uint64_t version,
+                                   std::shared_ptr<WorkerPool> worker_pool)
+    : ai_config_(std::make_shared<const TbotsProto::AiConfig>(ai_config)),
+      passing_params_(ai_config.passing_config()),
+      worker_pool_(std::move(worker_pool)),
+      run_ai_(ai_config.ai_control_config().run_ai()),
+      override_ai_play_(ai_config.ai_control_config().override_ai_play()),
+      version_(version)
+{
+    // The pool runs batches on the calling thread as well as on its worker threads
+    const unsigned int num_worker_threads =
+        ai_config.passing_config().pass_success_num_worker_threads();
+    if (!worker_pool_ || worker_pool_->getNumThreads() != num_worker_threads + 1)
+    {
+        worker_pool_ = std::make_shared<WorkerPool>(num_worker_threads);
+    }
+}
+
+const TbotsProto::AiConfig& AiConfigSnapshot::getAiConfig() const
+{
+    return *ai_config_;
+}
+
+std::shared_ptr<const TbotsProto::AiConfig> AiConfigSnapshot::getAiConfigPtr() const
+{
+    return ai_config_;
+}
+
+const PassingParams& AiConfigSnapshot::getPassingParams() const
+{
+    return passing_params_;
+}
+
+WorkerPool& AiConfigSnapshot::getWorkerPool() const
+{
+    return *worker_pool_;
+}
+
+std::shared_ptr<WorkerPool> AiConfigSnapshot::getWorkerPoolPtr() const
+{
+    return worker_pool_;
+}
+
+bool AiConfigSnapshot::shouldRunAi() const
+{
+    return run_ai_;
+}
+
+TbotsProto::PlayName AiConfigSnapshot::getOverrideAiPlay() const
+{
+    return override_ai_play_;
+}
+
+std::uint64_t AiConfigSnapshot::getVersion() const
+{
+    return version_;
+}
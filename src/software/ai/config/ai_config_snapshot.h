@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "proto/parameters.pb.h"
+#include "proto/play.pb.h"
+#include "software/ai/passing/passing_params.h"
+#include "software/multithreading/worker_pool.h"
+
+/**
+ * An immutable snapshot of the AI configuration.
+ *
+ * A snapshot is compiled once whenever the configuration changes, and is then shared
+ * read-only between everything that runs during an AI tick. Alongside the AiConfig
+ * proto, it holds the parameters that are read on hot paths copied into plain fields,
+ * so that they don't have to be looked up through protobuf accessors every time. It
+ * also holds the WorkerPool that parallel work during a tick runs on, so that the
+ * passing code of every play shares one set of worker threads.
+ */
+class AiConfigSnapshot
+{
+   public:
+    AiConfigSnapshot() = delete;
+
+    /**
+     * Compiles a snapshot of the given AI configuration
+     *
+     * @param ai_config The AI configuration to take a snapshot of
+     * @param version The version of this snapshot. Snapshots published later have a
+     * higher version.
+     * @param worker_pool The worker pool of the previous snapshot. It is reused if it
+     * has as many threads as this configuration asks for, otherwise a new worker pool
+     * is started.
+     */
+    explicit AiConfigSnapshot(const TbotsProto::AiConfig& ai_config,
+                              std::uint64_t version                   = 0,
+                              std::shared_ptr<WorkerPool> worker_pool = nullptr);
+
+    /**
+     * Gets the AiConfig proto this snapshot was compiled from
+     *
+     * @return the AiConfig proto
+     */
+    const TbotsProto::AiConfig& getAiConfig() const;
+
+    /**
+     * Gets a pointer to the AiConfig proto this snapshot was compiled from, for the
+     * plays and tactics that hold on to the config
+     *
+     * @return a shared pointer to the AiConfig proto, which is never modified
+     */
+    std::shared_ptr<const TbotsProto::AiConfig> getAiConfigPtr() const;
+
+    /**
+     * Gets the parameters used to rate passes
+     *
+     * @return the passing parameters
+     */
+    const PassingParams& getPassingParams() const;
+
+    /**
+     * Gets the worker pool to run parallel work on during a tick, such as the rollouts
+     * of the PassSuccessEstimator
+     *
+     * @return the worker pool
+     */
+    WorkerPool& getWorkerPool() const;
+
+    /**
+     * Gets a pointer to the worker pool, so that the next snapshot can reuse it
+     *
+     * @return a shared pointer to the worker pool
+     */
+    std::shared_ptr<WorkerPool> getWorkerPoolPtr() const;
+
+    /**
+     * Gets whether the AI should be run
+     *
+     * @return true if the AI should be run to produce primitives, false otherwise
+     */
+    bool shouldRunAi() const;
+
+    /**
+     * Gets the play that overrides the play selected by the AI
+     *
+     * @return the play to override the AI with, or TbotsProto::PlayName::UseAiSelection
+     * if the AI should select the play
+     */
+    TbotsProto::PlayName getOverrideAiPlay() const;
+
+    /**
+     * Gets the version of this snapshot
+     *
+     * @return the version of this snapshot
+     */
+    std::uint64_t getVersion() const;
+
+   private:
+    std::shared_ptr<const TbotsProto::AiConfig> ai_config_;
+    PassingParams passing_params_;
+    std::shared_ptr<WorkerPool> worker_pool_;
+    bool run_ai_;
+    TbotsProto::PlayName override_ai_play_;
+    std::uint64_t version_;
+};
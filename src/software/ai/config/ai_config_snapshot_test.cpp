@@ -0,0 +1,81 @@
+#include "software/ai/config/ai_config_snapshot.h"
+
+#include <gtest/gtest.h>
+
+TEST(AiConfigSnapshotTest, test_snapshot_copies_passing_params_from_config)
+{
+    TbotsProto::AiConfig ai_config;
+    ai_config.mutable_passing_config()->set_pass_delay_sec(0.7);
+    ai_config.mutable_passing_config()->set_min_pass_shoot_score(0.2);
+    ai_config.mutable_passing_config()->set_max_pass_speed_m_per_s(4.5);
+
+    const AiConfigSnapshot snapshot(ai_config);
+
+    EXPECT_DOUBLE_EQ(snapshot.getPassingParams().pass_delay_sec, 0.7);
+    EXPECT_DOUBLE_EQ(snapshot.getPassingParams().min_pass_shoot_score, 0.2);
+    EXPECT_DOUBLE_EQ(snapshot.getPassingParams().max_pass_speed_m_per_s, 4.5);
+    EXPECT_DOUBLE_EQ(snapshot.getPassingParams().enemy_proximity_importance,
+                     ai_config.passing_config().enemy_proximity_importance());
+}
+
+TEST(AiConfigSnapshotTest, test_snapshot_copies_ai_control_config)
+{
+    TbotsProto::AiConfig ai_config;
+    EXPECT_TRUE(AiConfigSnapshot(ai_config).shouldRunAi());
+    EXPECT_EQ(AiConfigSnapshot(ai_config).getOverrideAiPlay(),
+              TbotsProto::PlayName::UseAiSelection);
+
+    ai_config.mutable_ai_control_config()->set_run_ai(false);
+    ai_config.mutable_ai_control_config()->set_override_ai_play(
+        TbotsProto::PlayName::HaltPlay);
+    EXPECT_FALSE(AiConfigSnapshot(ai_config).shouldRunAi());
+    EXPECT_EQ(AiConfigSnapshot(ai_config).getOverrideAiPlay(),
+              TbotsProto::PlayName::HaltPlay);
+}
+
+TEST(AiConfigSnapshotTest, test_snapshot_is_not_changed_by_changing_source_config)
+{
+    TbotsProto::AiConfig ai_config;
+    ai_config.mutable_passing_config()->set_pass_delay_sec(0.7);
+
+    const AiConfigSnapshot snapshot(ai_config, 3);
+    ai_config.mutable_passing_config()->set_pass_delay_sec(0.1);
+
+    EXPECT_DOUBLE_EQ(snapshot.getAiConfig().passing_config().pass_delay_sec(), 0.7);
+    EXPECT_DOUBLE_EQ(snapshot.getPassingParams().pass_delay_sec, 0.7);
+    EXPECT_EQ(snapshot.getVersion(), 3);
+}
+
+TEST(AiConfigSnapshotTest, test_config_ptr_outlives_snapshot)
+{
+    TbotsProto::AiConfig ai_config;
+    ai_config.mutable_passing_config()->set_pass_delay_sec(0.7);
+
+    std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
+    {
+        const AiConfigSnapshot snapshot(ai_config);
+        ai_config_ptr = snapshot.getAiConfigPtr();
+        EXPECT_EQ(ai_config_ptr.get(), &snapshot.getAiConfig());
+    }
+
+    EXPECT_DOUBLE_EQ(ai_config_ptr->passing_config().pass_delay_sec(), 0.7);
+}
+
+TEST(AiConfigSnapshotTest, test_snapshot_reuses_worker_pool_with_same_number_of_threads)
+{
+    TbotsProto::AiConfig ai_config;
+    ai_config.mutable_passing_config()->set_pass_success_num_worker_threads(2);
+
+    const AiConfigSnapshot first_snapshot(ai_config);
+    EXPECT_EQ(first_snapshot.getWorkerPool().getNumThreads(), 3);
+
+    const AiConfigSnapshot second_snapshot(ai_config, 1,
+                                           first_snapshot.getWorkerPoolPtr());
+    EXPECT_EQ(&second_snapshot.getWorkerPool(), &first_snapshot.getWorkerPool());
+
+    ai_config.mutable_passing_config()->set_pass_success_num_worker_threads(1);
+    const AiConfigSnapshot third_snapshot(ai_config, 2,
+                                          second_snapshot.getWorkerPoolPtr());
+    EXPECT_NE(&third_snapshot.getWorkerPool(), &second_snapshot.getWorkerPool());
+    EXPECT_EQ(third_snapshot.getWorkerPool().getNumThreads(), 2);
+}
@@ -0,0 +1,25 @@
+#include "software/ai/config/ai_config_store.h"
+
+AiConfigStore::AiConfigStore(const TbotsProto::AiConfig& ai_config)
+    : latest_snapshot_(std::make_shared<const AiConfigSnapshot>(ai_config, 0)),
+      next_version_(1)
+{
+}
+
+void AiConfigStore::publish(const TbotsProto::AiConfig& ai_config)
+{
+    std::scoped_lock lock(publish_mutex_);
+
+    // Compile the snapshot before swapping it in, so readers only ever see complete
+    // snapshots. The worker pool is handed on, so that its threads are only restarted
+    // when their number changes.
+    std::shared_ptr<const AiConfigSnapshot> snapshot =
+        std::make_shared<const AiConfigSnapshot>(ai_config, next_version_++,
+                                                 load()->getWorkerPoolPtr());
+    std::atomic_store(&latest_snapshot_, std::move(snapshot));
+}
+
+std::shared_ptr<const AiConfigSnapshot> AiConfigStore::load() const
+{
+    return std::atomic_load(&latest_snapshot_);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/config/ai_config_snapshot.h"
+
+/**
+ * Holds the latest snapshot of the AI configuration, and lets a new configuration be
+ * published while the AI is running, read-copy-update style.
+ *
+ * Publishing a configuration compiles it into a new AiConfigSnapshot and atomically
+ * swaps it in as the latest snapshot. Snapshots are never modified once published, so
+ * readers that loaded the previous snapshot can keep using it without any locking, and
+ * it is freed once the last reader lets go of it. The AI loads the latest snapshot
+ * once at the start of each tick, so a configuration that arrives mid-tick only takes
+ * effect on the next tick.
+ */
+class AiConfigStore
+{
+   public:
+    AiConfigStore() = delete;
+
+    /**
+     * Creates a new AiConfigStore
+     *
+     * @param ai_config The initial AI configuration
+     */
+    explicit AiConfigStore(const TbotsProto::AiConfig& ai_config);
+
+    /**
+     * Compiles the given AI configuration and publishes it as the latest snapshot
+     *
+     * @param ai_config The new AI configuration
+     */
+    void publish(const TbotsProto::AiConfig& ai_config);
+
+    /**
+     * Gets the latest snapshot of the AI configuration. This never blocks on
+     * publish.
+     *
+     * @return the latest snapshot
+     */
+    std::shared_ptr<const AiConfigSnapshot> load() const;
+
+   private:
+    // Only accessed through std::atomic_load and std::atomic_store
+    std::shared_ptr<const AiConfigSnapshot> latest_snapshot_;
+
+    // Serializes publishers, so that snapshot versions are published in order
+    std::mutex publish_mutex_;
+    std::uint64_t next_version_;
+};
@@ -0,0 +1,114 @@
+#include "software/ai/config/ai_config_store.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+/**
+ * Creates an AiConfig where every parameter that is checked by these tests is set to
+ * the given value
+ *
+ * @param value The value to set the parameters to
+ *
+ * @return the AiConfig
+ */
+static TbotsProto::AiConfig createAiConfig(double value)
+{
+    TbotsProto::AiConfig ai_config;
+    ai_config.mutable_passing_config()->set_pass_delay_sec(value);
+    ai_config.mutable_passing_config()->set_min_pass_shoot_score(value);
+    return ai_config;
+}
+
+TEST(AiConfigStoreTest, test_load_initial_config)
+{
+    const AiConfigStore store(createAiConfig(0.5));
+
+    const auto snapshot = store.load();
+    ASSERT_TRUE(snapshot);
+    EXPECT_DOUBLE_EQ(snapshot->getPassingParams().pass_delay_sec, 0.5);
+    EXPECT_EQ(snapshot->getVersion(), 0);
+}
+
+TEST(AiConfigStoreTest, test_load_returns_same_snapshot_until_publish)
+{
+    AiConfigStore store(createAiConfig(0.5));
+
+    const auto first_snapshot = store.load();
+    EXPECT_EQ(store.load(), first_snapshot);
+
+    store.publish(createAiConfig(0.25));
+    const auto second_snapshot = store.load();
+    EXPECT_NE(second_snapshot, first_snapshot);
+    EXPECT_GT(second_snapshot->getVersion(), first_snapshot->getVersion());
+    EXPECT_DOUBLE_EQ(second_snapshot->getPassingParams().pass_delay_sec, 0.25);
+}
+
+TEST(AiConfigStoreTest, test_publish_does_not_change_loaded_snapshot)
+{
+    AiConfigStore store(createAiConfig(0.5));
+
+    const auto snapshot      = store.load();
+    const auto ai_config_ptr = snapshot->getAiConfigPtr();
+
+    std::weak_ptr<const AiConfigSnapshot> weak_snapshot = snapshot;
+
+    store.publish(createAiConfig(0.25));
+
+    EXPECT_DOUBLE_EQ(snapshot->getPassingParams().pass_delay_sec, 0.5);
+    EXPECT_DOUBLE_EQ(ai_config_ptr->passing_config().pass_delay_sec(), 0.5);
+    EXPECT_FALSE(weak_snapshot.expired());
+}
+
+TEST(AiConfigStoreTest, test_publish_keeps_worker_pool)
+{
+    AiConfigStore store(createAiConfig(0.5));
+
+    const auto first_snapshot = store.load();
+    store.publish(createAiConfig(0.25));
+
+    EXPECT_EQ(&store.load()->getWorkerPool(), &first_snapshot->getWorkerPool());
+}
+
+TEST(AiConfigStoreTest, test_readers_only_see_complete_snapshots_while_publishing)
+{
+    AiConfigStore store(createAiConfig(0));
+
+    std::atomic_bool stop_reading              = false;
+    std::atomic_bool saw_torn_snapshot         = false;
+    std::atomic_bool saw_out_of_order_snapshot = false;
+    std::thread reader(
+        [&]()
+        {
+            std::uint64_t last_version = 0;
+            while (!stop_reading)
+            {
+                const auto snapshot         = store.load();
+                const PassingParams& params = snapshot->getPassingParams();
+                if (params.pass_delay_sec != params.min_pass_shoot_score ||
+                    snapshot->getAiConfig().passing_config().pass_delay_sec() !=
+                        params.pass_delay_sec)
+                {
+                    saw_torn_snapshot = true;
+                }
+                if (snapshot->getVersion() < last_version)
+                {
+                    saw_out_of_order_snapshot = true;
+                }
+                last_version = snapshot->getVersion();
+            }
+        });
+
+    for (int i = 1; i <= 1000; i++)
+    {
+        store.publish(createAiConfig(i / 1000.0));
+    }
+    stop_reading = true;
+    reader.join();
+
+    EXPECT_FALSE(saw_torn_snapshot);
+    EXPECT_FALSE(saw_out_of_order_snapshot);
+    EXPECT_DOUBLE_EQ(store.load()->getPassingParams().pass_delay_sec, 1.0);
+    EXPECT_EQ(store.load()->getVersion(), 1000);
+}
@@ -0,0 +1,418 @@
+#include "software/ai/evaluation/ball_intercept_solver.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/ai/evaluation/time_to_travel.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+
+// The ball is considered to have come to rest once its acceleration has slowed it
+// down to this speed
+static constexpr double BALL_STOPPED_SPEED_M_PER_S = 0.001;
+
+/**
+ * Gets a lower bound on when a robot could intercept a ball, given how far away the
+ * ball is at some time. This assumes the robot accelerates straight towards the ball
+ * from its current speed and never has to slow down, and that the ball comes straight
+ * towards the robot at its max speed. Robot::getTimeToPosition can never be shorter
+ * than this, so checking for intercepts before the returned time is pointless.
+ *
+ * @param robot The robot that will intercept the ball
+ * @param robot_start_time_sec When the robot starts moving towards the ball
+ * @param t_sec The time at which the ball is the given distance away from the robot.
+ * Must not be before robot_start_time_sec
+ * @param distance_m How far the ball is from where the robot starts at time t_sec
+ * @param max_ball_speed_m_per_s The max speed of the ball from t_sec onwards
+ *
+ * @return the earliest time the robot could intercept the ball
+ */
+static double getEarliestPossibleInterceptTime(const Robot& robot,
+                                               double robot_start_time_sec, double t_sec,
+                                               double distance_m,
+                                               double max_ball_speed_m_per_s)
+{
+    const double max_speed = robot.robotConstants().robot_trajectory_max_speed_m_per_s;
+    const double max_acceleration = std::max(
+        1e-6, static_cast<double>(
+                  robot.robotConstants().robot_trajectory_max_acceleration_m_per_s_2));
+    const double initial_speed = std::min(robot.velocity().length(), max_speed);
+
+    // The ball closes the distance on its own while the robot hasn't reached t_sec yet
+    const double closing_distance_m =
+        distance_m + max_ball_speed_m_per_s * (t_sec - robot_start_time_sec);
+
+    // Solve for when the distance covered by the robot and the ball adds up to the
+    // closing distance, while the robot is still accelerating
+    const double closing_speed = initial_speed + max_ball_speed_m_per_s;
+    double travel_time_sec =
+        (-closing_speed + std::sqrt(closing_speed * closing_speed +
+                                    2 * max_acceleration * closing_distance_m)) /
+        max_acceleration;
+
+    const double acceleration_time_sec = (max_speed - initial_speed) / max_acceleration;
+    if (travel_time_sec > acceleration_time_sec)
+    {
+        // The robot reaches its max speed before it meets the ball
+        const double acceleration_distance_m =
+            (initial_speed + max_speed) / 2 * acceleration_time_sec;
+        travel_time_sec = acceleration_time_sec +
+                          (closing_distance_m - acceleration_distance_m -
+                           max_ball_speed_m_per_s * acceleration_time_sec) /
+                              (max_speed + max_ball_speed_m_per_s);
+    }
+
+    return robot_start_time_sec + travel_time_sec;
+}
+
+/**
+ * Gets a lower bound on how long a robot takes to get to any point on the given
+ * segment. This assumes the robot starts moving straight towards the closest point on
+ * the segment at its current speed.
+ *
+ * @param robot The robot to move
+ * @param segment The segment to move to
+ * @param max_distance_from_segment_m How far from the segment the points we want to
+ * move to can be
+ *
+ * @return the shortest time the robot could take to get to the segment
+ */
+static double getMinTimeToSegment(const Robot& robot, const Segment& segment,
+                                  double max_distance_from_segment_m)
+{
+    const double max_speed = robot.robotConstants().robot_trajectory_max_speed_m_per_s;
+    const double max_acceleration =
+        robot.robotConstants().robot_trajectory_max_acceleration_m_per_s_2;
+    const double min_distance_m =
+        std::max(0.0, distance(segment, robot.position()) - max_distance_from_segment_m);
+    return getTimeToTravelDistance(min_distance_m, max_speed, max_acceleration,
+                                   std::min(robot.velocity().length(), max_speed))
+        .toSeconds();
+}
+
+BallInterceptSolver::BallInterceptSolver(const Ball& ball, const Field& field)
+    : ball_(ball),
+      field_lines_(Aabb::fromRectangle(field.fieldLines())),
+      stop_time_sec_(std::nullopt),
+      field_entry_time_sec_(std::nullopt),
+      max_ball_speed_m_per_s_(0)
+{
+    const Vector velocity     = ball.velocity();
+    const Vector acceleration = ball.acceleration();
+
+    if (acceleration.lengthSquared() == 0)
+    {
+        if (velocity.lengthSquared() == 0)
+        {
+            stop_time_sec_ = 0.0;
+        }
+    }
+    else
+    {
+        // The ball is slowest when its velocity is perpendicular to its acceleration.
+        // If the acceleration opposes the velocity (ex. friction), the ball stops here
+        // instead of accelerating back the way it came from
+        const double slowest_time_sec =
+            -velocity.dot(acceleration) / acceleration.lengthSquared();
+        if (slowest_time_sec >= 0 &&
+            (velocity + acceleration * slowest_time_sec).length() <
+                BALL_STOPPED_SPEED_M_PER_S)
+        {
+            stop_time_sec_ = slowest_time_sec;
+        }
+    }
+
+    const auto max_num_samples = static_cast<std::size_t>(
+        std::ceil(MAX_INTERCEPT_HORIZON_SEC / TRAJECTORY_SAMPLE_PERIOD_SEC));
+    ball_trajectory_samples_.reserve(max_num_samples + 1);
+    for (std::size_t i = 0; i <= max_num_samples; i++)
+    {
+        const double t_sec = static_cast<double>(i) * TRAJECTORY_SAMPLE_PERIOD_SEC;
+        if (i > 0 && stop_time_sec_ && t_sec >= *stop_time_sec_)
+        {
+            break;
+        }
+
+        const Point ball_position = getBallPosition(t_sec);
+        ball_trajectory_samples_.push_back(ball_position);
+        const bool ball_on_field = contains(field_lines_, ball_position);
+        if (ball_on_field && !field_entry_time_sec_)
+        {
+            // Bisect for when the ball rolls onto the field, so we don't look for
+            // intercepts before then
+            double lower_sec = std::max(0.0, t_sec - TRAJECTORY_SAMPLE_PERIOD_SEC);
+            double upper_sec = t_sec;
+            while (upper_sec - lower_sec > INTERCEPT_TIME_TOLERANCE_SEC)
+            {
+                const double mid_sec = (lower_sec + upper_sec) / 2;
+                if (contains(field_lines_, getBallPosition(mid_sec)))
+                {
+                    upper_sec = mid_sec;
+                }
+                else
+                {
+                    lower_sec = mid_sec;
+                }
+            }
+            field_entry_time_sec_ = upper_sec;
+        }
+        else if (!ball_on_field && field_entry_time_sec_)
+        {
+            break;
+        }
+    }
+
+    // The speed of a ball with constant acceleration is highest at the start or the
+    // end of its trajectory
+    const double end_time_sec =
+        static_cast<double>(ball_trajectory_samples_.size() - 1) *
+        TRAJECTORY_SAMPLE_PERIOD_SEC;
+    max_ball_speed_m_per_s_ =
+        std::max(velocity.length(),
+                 ball.estimateFutureState(Duration::fromSeconds(end_time_sec))
+                     .velocity()
+                     .length());
+}
+
+std::optional<std::pair<Point, Duration>> BallInterceptSolver::findIntercept(
+    const Robot& robot) const
+{
+    if (!field_entry_time_sec_)
+    {
+        return std::nullopt;
+    }
+
+    // The robot can't start moving towards the ball before the timestamp of the robot,
+    // and can only intercept the ball once it is on the field
+    const double robot_start_time_sec =
+        std::max(0.0, (robot.timestamp() - ball_.timestamp()).toSeconds());
+    const double start_time_sec = std::max(robot_start_time_sec, *field_entry_time_sec_);
+
+    // How long before the ball the robot can get to where the ball will be at the given
+    // time. The robot can intercept the ball at the given time if this is not negative
+    auto time_diff_sec = [&](double t_sec, const Point& ball_position)
+    {
+        return t_sec - robot_start_time_sec -
+               robot.getTimeToPosition(ball_position).toSeconds();
+    };
+    auto time_diff_at_sec = [&](double t_sec)
+    { return time_diff_sec(t_sec, getBallPosition(t_sec)); };
+
+    // The earliest time the robot could possibly intercept the ball, given where the
+    // ball is at the given time. No intercept is possible between the given time and
+    // the returned time, so we can skip checking them
+    auto earliest_possible_intercept_time_sec = [&](double t_sec,
+                                                    const Point& ball_position)
+    {
+        const double distance_m = (ball_position - robot.position()).length();
+        return getEarliestPossibleInterceptTime(robot, robot_start_time_sec, t_sec,
+                                                distance_m, max_ball_speed_m_per_s_);
+    };
+
+    // How far the ball can stray from a straight line between its positions at two
+    // times the given duration apart
+    auto max_path_deviation_m = [&](double duration_sec)
+    { return ball_.acceleration().length() * duration_sec * duration_sec / 8; };
+
+    // Find the earliest intercept time to within the tolerance using the Illinois
+    // variant of the false position method. The robot can intercept the ball at the
+    // upper bound of the bracket, but not at the lower bound
+    auto find_earliest_intercept_time_sec = [&](double lower_sec, double lower_diff_sec,
+                                                double upper_sec, double upper_diff_sec)
+    {
+        // Fall back to bisection whenever the bracket doesn't shrink fast enough, so we
+        // never need many more iterations than bisection would
+        double prev_width_sec = upper_sec - lower_sec;
+        bool bisect           = false;
+        int last_moved_bound  = 0;
+        while (upper_sec - lower_sec > INTERCEPT_TIME_TOLERANCE_SEC)
+        {
+            double t_sec = bisect ? (lower_sec + upper_sec) / 2
+                                  : lower_sec - lower_diff_sec * (upper_sec - lower_sec) /
+                                                    (upper_diff_sec - lower_diff_sec);
+            t_sec = std::clamp(t_sec, lower_sec + INTERCEPT_TIME_TOLERANCE_SEC / 2,
+                               upper_sec - INTERCEPT_TIME_TOLERANCE_SEC / 2);
+
+            const double diff_sec = time_diff_at_sec(t_sec);
+            if (diff_sec >= 0)
+            {
+                upper_sec      = t_sec;
+                upper_diff_sec = diff_sec;
+                if (last_moved_bound > 0)
+                {
+                    lower_diff_sec /= 2;
+                }
+                last_moved_bound = 1;
+            }
+            else
+            {
+                lower_sec      = t_sec;
+                lower_diff_sec = diff_sec;
+                if (last_moved_bound < 0)
+                {
+                    upper_diff_sec /= 2;
+                }
+                last_moved_bound = -1;
+            }
+
+            bisect         = upper_sec - lower_sec > prev_width_sec / 2;
+            prev_width_sec = upper_sec - lower_sec;
+        }
+        return upper_sec;
+    };
+
+    // A robot that is close to the path of a fast ball may only be able to intercept it
+    // for a moment as it goes by, which can fall between two samples. When the time
+    // difference peaks between samples, we use a golden section search to find the
+    // peak, which brackets the intercept if the robot can get there in time
+    auto find_peak_time_sec = [&](double lower_sec, double upper_sec)
+    {
+        static const double inverse_golden_ratio = (std::sqrt(5.0) - 1) / 2;
+        double left_sec   = upper_sec - inverse_golden_ratio * (upper_sec - lower_sec);
+        double right_sec  = lower_sec + inverse_golden_ratio * (upper_sec - lower_sec);
+        double left_diff  = time_diff_at_sec(left_sec);
+        double right_diff = time_diff_at_sec(right_sec);
+        while (upper_sec - lower_sec > INTERCEPT_TIME_TOLERANCE_SEC)
+        {
+            if (left_diff >= right_diff)
+            {
+                upper_sec  = right_sec;
+                right_sec  = left_sec;
+                right_diff = left_diff;
+                left_sec   = upper_sec - inverse_golden_ratio * (upper_sec - lower_sec);
+                left_diff  = time_diff_at_sec(left_sec);
+            }
+            else
+            {
+                lower_sec  = left_sec;
+                left_sec   = right_sec;
+                left_diff  = right_diff;
+                right_sec  = lower_sec + inverse_golden_ratio * (upper_sec - lower_sec);
+                right_diff = time_diff_at_sec(right_sec);
+            }
+        }
+        return left_diff >= right_diff ? left_sec : right_sec;
+    };
+
+    // We check the time difference at the start time, every sample of the ball
+    // trajectory after it, and the time the ball stops if it stops on the field
+    const bool ball_leaves_field =
+        !contains(field_lines_, ball_trajectory_samples_.back());
+    const bool ball_stops_on_field = stop_time_sec_.has_value() && !ball_leaves_field;
+    const std::size_t num_checks =
+        ball_trajectory_samples_.size() +
+        (ball_stops_on_field && *stop_time_sec_ > start_time_sec ? 1 : 0);
+    auto check_time_sec = [&](std::size_t i)
+    {
+        return i < ball_trajectory_samples_.size()
+                   ? static_cast<double>(i) * TRAJECTORY_SAMPLE_PERIOD_SEC
+                   : *stop_time_sec_;
+    };
+    auto check_ball_position = [&](std::size_t i)
+    {
+        return i < ball_trajectory_samples_.size() ? ball_trajectory_samples_[i]
+                                                   : getBallPosition(*stop_time_sec_);
+    };
+
+    std::optional<double> intercept_time_sec;
+    double prev_prev_time_sec  = start_time_sec;
+    Point prev_prev_position   = getBallPosition(start_time_sec);
+    double prev_prev_diff_sec  = time_diff_sec(start_time_sec, prev_prev_position);
+    double prev_time_sec       = prev_prev_time_sec;
+    Point prev_position        = prev_prev_position;
+    double prev_diff_sec       = prev_prev_diff_sec;
+    if (prev_diff_sec >= 0)
+    {
+        intercept_time_sec = start_time_sec;
+    }
+
+    std::size_t i =
+        static_cast<std::size_t>(start_time_sec / TRAJECTORY_SAMPLE_PERIOD_SEC) + 1;
+    while (!intercept_time_sec && i < num_checks)
+    {
+        const double skip_to_time_sec =
+            earliest_possible_intercept_time_sec(prev_time_sec, prev_position);
+        if (skip_to_time_sec > check_time_sec(i))
+        {
+            const auto skip_to_index = static_cast<std::size_t>(
+                std::ceil(skip_to_time_sec / TRAJECTORY_SAMPLE_PERIOD_SEC));
+            i = std::min(std::max(i, skip_to_index), num_checks - 1);
+        }
+
+        const double t_sec        = check_time_sec(i);
+        const Point ball_position = check_ball_position(i);
+        const double diff_sec     = time_diff_sec(t_sec, ball_position);
+        if (diff_sec >= 0)
+        {
+            intercept_time_sec = find_earliest_intercept_time_sec(
+                prev_time_sec, prev_diff_sec, t_sec, diff_sec);
+        }
+        else if (prev_diff_sec >= prev_prev_diff_sec && prev_diff_sec >= diff_sec &&
+                 t_sec - robot_start_time_sec -
+                         getMinTimeToSegment(
+                             robot, Segment(prev_prev_position, ball_position),
+                             max_path_deviation_m(t_sec - prev_prev_time_sec)) >=
+                     0)
+        {
+            const double peak_time_sec = find_peak_time_sec(prev_prev_time_sec, t_sec);
+            const double peak_diff_sec = time_diff_at_sec(peak_time_sec);
+            if (peak_diff_sec >= 0)
+            {
+                intercept_time_sec = find_earliest_intercept_time_sec(
+                    prev_prev_time_sec, prev_prev_diff_sec, peak_time_sec, peak_diff_sec);
+            }
+        }
+
+        prev_prev_time_sec = prev_time_sec;
+        prev_prev_position = prev_position;
+        prev_prev_diff_sec = prev_diff_sec;
+        prev_time_sec      = t_sec;
+        prev_position      = ball_position;
+        prev_diff_sec      = diff_sec;
+        i++;
+    }
+
+    // Once the ball has stopped, the robot only has to get to where the ball stopped
+    if (!intercept_time_sec && ball_stops_on_field)
+    {
+        intercept_time_sec =
+            robot_start_time_sec +
+            robot.getTimeToPosition(getBallPosition(*stop_time_sec_)).toSeconds();
+    }
+
+    if (!intercept_time_sec)
+    {
+        return std::nullopt;
+    }
+
+    // Check that the intercept position is actually on the field
+    const Point intercept_position = getBallPosition(*intercept_time_sec);
+    if (!contains(field_lines_, intercept_position))
+    {
+        return std::nullopt;
+    }
+
+    return std::make_pair(intercept_position,
+                          robot.getTimeToPosition(intercept_position));
+}
+
+std::vector<std::optional<std::pair<Point, Duration>>>
+BallInterceptSolver::findIntercepts(const std::vector<Robot>& robots) const
+{
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts;
+    intercepts.reserve(robots.size());
+    for (const Robot& robot : robots)
+    {
+        intercepts.push_back(findIntercept(robot));
+    }
+    return intercepts;
+}
+
+Point BallInterceptSolver::getBallPosition(double t_sec) const
+{
+    if (stop_time_sec_)
+    {
+        t_sec = std::min(t_sec, *stop_time_sec_);
+    }
+    return ball_.estimateFutureState(Duration::fromSeconds(t_sec)).position();
+}
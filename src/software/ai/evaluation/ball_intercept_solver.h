@@ -0,0 +1,105 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "software/geom/point.h"
+#include "software/geom/value_shapes.h"
+#include "software/time/duration.h"
+#include "software/world/ball.h"
+#include "software/world/field.h"
+#include "software/world/robot.h"
+
+/**
+ * Finds where and when robots can intercept a ball.
+ *
+ * The trajectory of the ball is sampled once on construction, up until the ball leaves
+ * the field or comes to rest, and is then shared between every robot that is solved
+ * for. For each robot, the intercept is the earliest time t at which the robot can get
+ * to where the ball will be at time t. This is found by scanning the sampled trajectory
+ * for the first sample where the robot gets to the ball before the ball does, and then
+ * bisecting between that sample and the one before it until the intercept time is known
+ * to within INTERCEPT_TIME_TOLERANCE_SEC. Intercepts that only exist for a moment
+ * between two samples, such as when a fast ball passes right by the robot, are found by
+ * searching for the peak of the time difference between the samples around it.
+ * Samples where the robot could not possibly have reached the ball yet are skipped
+ * without evaluating Robot::getTimeToPosition.
+ *
+ * The ball is assumed to move with the constant acceleration given by Ball, except that
+ * it stays at rest once the acceleration has brought it to a stop.
+ */
+class BallInterceptSolver
+{
+   public:
+    // How far apart in time the samples of the ball trajectory are
+    static constexpr double TRAJECTORY_SAMPLE_PERIOD_SEC = 0.1;
+
+    // How far into the future we will look for an intercept
+    static constexpr double MAX_INTERCEPT_HORIZON_SEC = 10.0;
+
+    // The returned intercept time is at most this much later than the exact
+    // earliest intercept time
+    static constexpr double INTERCEPT_TIME_TOLERANCE_SEC = 0.001;
+
+    /**
+     * Creates a new BallInterceptSolver, and samples the trajectory of the given ball
+     *
+     * @param ball The ball to intercept
+     * @param field The field on which we want the intercept to occur
+     */
+    explicit BallInterceptSolver(const Ball& ball, const Field& field);
+
+    /**
+     * Finds the earliest place on the field where the given robot can intercept the
+     * ball
+     *
+     * @param robot The robot that will hopefully intercept the ball
+     *
+     * @return A pair holding the place that the robot can move to in order to intercept
+     * the ball, and the duration the robot will take to move there, relative to the
+     * timestamp of the robot. If no possible intercept could be found within the field
+     * bounds, returns std::nullopt
+     */
+    std::optional<std::pair<Point, Duration>> findIntercept(const Robot& robot) const;
+
+    /**
+     * Finds the earliest place on the field where each of the given robots can
+     * intercept the ball
+     *
+     * @param robots The robots that will hopefully intercept the ball
+     *
+     * @return The intercept for each robot, in the same order as the given robots. See
+     * findIntercept for what each intercept holds.
+     */
+    std::vector<std::optional<std::pair<Point, Duration>>> findIntercepts(
+        const std::vector<Robot>& robots) const;
+
+   private:
+    /**
+     * Gets the position of the ball at the given time
+     *
+     * @param t_sec The time since the timestamp of the ball
+     *
+     * @return the position of the ball at the given time
+     */
+    Point getBallPosition(double t_sec) const;
+
+    Ball ball_;
+    Aabb field_lines_;
+
+    // The time since the timestamp of the ball at which the ball comes to rest, or
+    // std::nullopt if the acceleration of the ball never stops it
+    std::optional<double> stop_time_sec_;
+
+    // The time since the timestamp of the ball at which the ball is first on the field,
+    // or std::nullopt if the ball doesn't get onto the field
+    std::optional<double> field_entry_time_sec_;
+
+    // The fastest the ball moves over its sampled trajectory
+    double max_ball_speed_m_per_s_;
+
+    // The position of the ball at every TRAJECTORY_SAMPLE_PERIOD_SEC, starting at the
+    // timestamp of the ball. Ends with the first sample after the ball leaves the
+    // field, or the last sample before the ball comes to rest or the horizon is reached.
+    std::vector<Point> ball_trajectory_samples_;
+};
@@ -0,0 +1,188 @@
+#include "software/ai/evaluation/ball_intercept_solver.h"
+
+#include <gtest/gtest.h>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/test_util/test_util.h"
+
+class BallInterceptSolverTest : public testing::Test
+{
+   protected:
+    /**
+     * Finds the earliest time the robot can intercept the ball by checking every
+     * BRUTE_FORCE_STEP_SEC into the future, which is what the solver should agree with
+     *
+     * @param ball The ball to intercept
+     * @param robot The robot that will intercept the ball
+     *
+     * @return the earliest time since the timestamp of the ball at which the robot can
+     * intercept the ball, or std::nullopt if the ball leaves the field first
+     */
+    std::optional<double> bruteForceInterceptTime(const Ball& ball, const Robot& robot)
+    {
+        for (double t = 0; t < BallInterceptSolver::MAX_INTERCEPT_HORIZON_SEC;
+             t += BRUTE_FORCE_STEP_SEC)
+        {
+            const Point ball_position =
+                ball.estimateFutureState(Duration::fromSeconds(t)).position();
+            if (!contains(field.fieldLines(), ball_position))
+            {
+                return std::nullopt;
+            }
+            if (robot.getTimeToPosition(ball_position).toSeconds() <= t)
+            {
+                return t;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Checks that the solver finds the same intercept as the brute force search
+     *
+     * @param ball The ball to intercept
+     * @param robot The robot that will intercept the ball
+     */
+    void expectMatchesBruteForce(const Ball& ball, const Robot& robot)
+    {
+        const auto intercept = BallInterceptSolver(ball, field).findIntercept(robot);
+        const auto expected_time_sec = bruteForceInterceptTime(ball, robot);
+        ASSERT_EQ(intercept.has_value(), expected_time_sec.has_value());
+        if (!intercept)
+        {
+            return;
+        }
+
+        const Point expected_position =
+            ball.estimateFutureState(Duration::fromSeconds(*expected_time_sec))
+                .position();
+        const double max_position_error =
+            ball.velocity().length() *
+            (BallInterceptSolver::INTERCEPT_TIME_TOLERANCE_SEC + BRUTE_FORCE_STEP_SEC);
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(intercept->first, expected_position,
+                                                   max_position_error + 1e-9));
+
+        // The robot must be able to get to the intercept before the ball does
+        EXPECT_LE(intercept->second.toSeconds(),
+                  *expected_time_sec + BallInterceptSolver::INTERCEPT_TIME_TOLERANCE_SEC);
+    }
+
+    static constexpr double BRUTE_FORCE_STEP_SEC = 0.0001;
+    Field field = Field::createSSLDivisionBField();
+};
+
+TEST_F(BallInterceptSolverTest, test_intercepts_match_brute_force_search)
+{
+    const std::vector<Ball> balls = {
+        Ball({0, 0}, {3, 0}, Timestamp::fromSeconds(0)),
+        Ball({0, 0}, {6, 0}, Timestamp::fromSeconds(0)),
+        Ball({0.5, 0.5}, {0.5, 0.5}, Timestamp::fromSeconds(0)),
+        Ball({-3, 2}, {2, -1.5}, Timestamp::fromSeconds(0)),
+        Ball({4, -2}, {-4, 0.5}, Timestamp::fromSeconds(0)),
+    };
+    const std::vector<Robot> robots = {
+        Robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, {2, 0.2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(2, {-1, -1}, {1, 0.5}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(3, {-4, 2.5}, {-1, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    };
+
+    for (const Ball& ball : balls)
+    {
+        for (const Robot& robot : robots)
+        {
+            expectMatchesBruteForce(ball, robot);
+        }
+    }
+}
+
+TEST_F(BallInterceptSolverTest, test_batch_matches_individual_intercepts)
+{
+    const Ball ball({-1, 1}, {2, -1}, Timestamp::fromSeconds(0));
+    const std::vector<Robot> robots = {
+        Robot(0, {2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, {-2, -2}, {0, 1}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(2, {4, 2.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    };
+
+    const BallInterceptSolver solver(ball, field);
+    const auto intercepts = solver.findIntercepts(robots);
+
+    ASSERT_EQ(intercepts.size(), robots.size());
+    for (std::size_t i = 0; i < robots.size(); i++)
+    {
+        const auto expected = solver.findIntercept(robots[i]);
+        ASSERT_EQ(intercepts[i].has_value(), expected.has_value());
+        if (expected)
+        {
+            EXPECT_EQ(intercepts[i]->first, expected->first);
+            EXPECT_EQ(intercepts[i]->second, expected->second);
+        }
+    }
+}
+
+TEST_F(BallInterceptSolverTest, test_robot_already_at_ball)
+{
+    const Ball ball({1, 1}, {1, 0}, Timestamp::fromSeconds(0));
+    const Robot robot(0, {1, 1}, {1, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0));
+
+    const auto intercept = BallInterceptSolver(ball, field).findIntercept(robot);
+    ASSERT_TRUE(intercept);
+    EXPECT_EQ(intercept->first, Point(1, 1));
+    EXPECT_EQ(intercept->second, Duration::fromSeconds(0));
+}
+
+TEST_F(BallInterceptSolverTest, test_intercept_ball_that_stops_from_friction)
+{
+    // The ball stops at (1, 0) after 1 second, before the robot can get there
+    const Ball ball({0, 0}, {2, 0}, Timestamp::fromSeconds(0), {-2, 0});
+    const Robot robot(0, {-4, -2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0));
+
+    const auto intercept = BallInterceptSolver(ball, field).findIntercept(robot);
+    ASSERT_TRUE(intercept);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(intercept->first, Point(1, 0), 1e-6));
+    EXPECT_EQ(intercept->second, robot.getTimeToPosition(Point(1, 0)));
+}
+
+TEST_F(BallInterceptSolverTest, test_only_intercept_after_robot_timestamp)
+{
+    // The robot is sitting on the path of the ball, but its timestamp is after the
+    // ball has already passed it
+    const Ball ball({-2, 0}, {1, 0}, Timestamp::fromSeconds(0));
+    const Robot robot(0, {0, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(3));
+
+    const auto intercept = BallInterceptSolver(ball, field).findIntercept(robot);
+    ASSERT_TRUE(intercept);
+    EXPECT_GT(intercept->first.x(), 1);
+}
+
+TEST_F(BallInterceptSolverTest, test_intercept_ball_rolling_onto_field)
+{
+    const Ball ball({-2, 4}, {0, -2}, Timestamp::fromSeconds(0));
+    const Robot robot(0, {-2, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0));
+
+    const auto intercept = BallInterceptSolver(ball, field).findIntercept(robot);
+    ASSERT_TRUE(intercept);
+    EXPECT_TRUE(contains(field.fieldLines(), intercept->first));
+    EXPECT_NEAR(intercept->first.x(), -2, 1e-9);
+}
+
+TEST_F(BallInterceptSolverTest, test_no_intercept_once_ball_leaves_field)
+{
+    const Ball ball({3, 3}, {1, 1}, Timestamp::fromSeconds(0));
+    const Robot robot(0, {-2, -2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                      Timestamp::fromSeconds(0));
+
+    EXPECT_FALSE(BallInterceptSolver(ball, field).findIntercept(robot));
+}
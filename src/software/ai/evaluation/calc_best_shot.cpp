@@ -1,93 +1,158 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
-std::optional<Shot> calcBestShotOnGoal(const Segment& goal_post, const Point& shot_origin,
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+BestShotCalculator::BestShotCalculator(const Segment& goal_post,
                                        const std::vector<Robot>& robot_obstacles,
                                        TeamType goal, double radius)
+    : goal_post_(goal_post),
+      goal_(goal),
+      radius_(radius),
+      num_obstacles_(robot_obstacles.size()),
+      obstacle_xs_(),
+      obstacle_ys_()
 {
-    // Don't return a shot if the ball is behind the net
-    if ((goal == TeamType::FRIENDLY && shot_origin.x() < goal_post.getStart().x()) ||
-        (goal == TeamType::ENEMY && shot_origin.x() > goal_post.getStart().x()))
+    if (num_obstacles_ > MAX_NUM_OBSTACLES)
     {
-        return std::nullopt;
+        throw std::invalid_argument("BestShotCalculator supports at most " +
+                                    std::to_string(MAX_NUM_OBSTACLES) +
+                                    " obstacles, but got " +
+                                    std::to_string(num_obstacles_));
     }
 
-    size_t max_num_obstacles = robot_obstacles.size();
-
-    Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
-    Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
-
-    std::vector<AngleSegment> obstacles;
-    obstacles.reserve(max_num_obstacles);
-
-    if (goal == TeamType::FRIENDLY)
+    for (std::size_t i = 0; i < num_obstacles_; i++)
     {
-        auto tmp       = pos_post_angle;
-        pos_post_angle = (neg_post_angle + Angle::half()).clamp();
-        neg_post_angle = (tmp + Angle::half()).clamp();
+        obstacle_xs_[i] = robot_obstacles[i].position().x();
+        obstacle_ys_[i] = robot_obstacles[i].position().y();
     }
-    AngleMap angle_map(pos_post_angle, neg_post_angle, max_num_obstacles);
+}
 
-    for (const Robot& robot_obstacle : robot_obstacles)
+std::optional<Shot> BestShotCalculator::calcBestShotOnGoal(const Point& shot_origin) const
+{
+    // Don't return a shot if the ball is behind the net
+    if ((goal_ == TeamType::FRIENDLY && shot_origin.x() < goal_post_.getStart().x()) ||
+        (goal_ == TeamType::ENEMY && shot_origin.x() > goal_post_.getStart().x()))
     {
-        Point enemy_robot_pos    = robot_obstacle.position();
-        Vector perpendicular_vec = (enemy_robot_pos - shot_origin).perpendicular();
-
-        Vector one_end_vec = perpendicular_vec.normalize(radius);
+        return std::nullopt;
+    }
 
-        Point one_end   = enemy_robot_pos + one_end_vec;
-        Point other_end = enemy_robot_pos - one_end_vec;
+    // Angles are measured in the direction of the goal, so shots on the friendly goal
+    // are rotated by half a turn to keep the goal around an angle of zero
+    const double direction = goal_ == TeamType::FRIENDLY ? -1.0 : 1.0;
+    const double origin_x  = shot_origin.x();
+    const double origin_y  = shot_origin.y();
+
+    const Point& top_post    = goal_ == TeamType::FRIENDLY ? goal_post_.getEnd()
+                                                           : goal_post_.getStart();
+    const Point& bottom_post = goal_ == TeamType::FRIENDLY ? goal_post_.getStart()
+                                                           : goal_post_.getEnd();
+    const double goal_top    = std::atan2(direction * (top_post.y() - origin_y),
+                                          direction * (top_post.x() - origin_x));
+    const double goal_bottom = std::atan2(direction * (bottom_post.y() - origin_y),
+                                          direction * (bottom_post.x() - origin_x));
+
+    // The angle interval blocked by each obstacle, between the angles to the two ends
+    // of the diameter of the obstacle perpendicular to the shot. Obstacles that don't
+    // overlap the goal are replaced by an empty interval that never blocks anything.
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    std::array<double, MAX_NUM_OBSTACLES> tops;
+    std::array<double, MAX_NUM_OBSTACLES> bottoms;
+    for (std::size_t i = 0; i < num_obstacles_; i++)
+    {
+        const double dx          = obstacle_xs_[i] - origin_x;
+        const double dy          = obstacle_ys_[i] - origin_y;
+        const double distance    = std::sqrt(dx * dx + dy * dy);
+        const double scale       = distance > 0 ? radius_ / distance : 0.0;
+        const double top         = std::atan2(direction * (dy + dx * scale),
+                                              direction * (dx - dy * scale));
+        const double bottom      = std::atan2(direction * (dy - dx * scale),
+                                              direction * (dx + dy * scale));
+        const bool overlaps_goal = bottom <= goal_top && top >= goal_bottom;
+        tops[i]                  = overlaps_goal ? top : -INF;
+        bottoms[i]               = overlaps_goal ? bottom : INF;
+    }
 
-        Vector top_vec    = one_end - shot_origin;
-        Vector bottom_vec = other_end - shot_origin;
+    // Every open interval starts below the top of the goal or below the bottom of a
+    // blocked interval, and ends at the highest blocked interval below its start or at
+    // the bottom of the goal. Ties are broken in favour of the top interval, then the
+    // bottom interval, then the highest interval in between.
+    double best_top    = 0;
+    double best_bottom = 0;
+    int best_rank      = 0;
 
-        Angle top_angle    = top_vec.orientation();
-        Angle bottom_angle = bottom_vec.orientation();
-        if (goal == TeamType::FRIENDLY)
+    auto consider_open_interval = [&](double top, double bottom, int rank)
+    {
+        const double width      = top - bottom;
+        const double best_width = best_top - best_bottom;
+        if (width > best_width ||
+            (width == best_width && width > 0 &&
+             (rank < best_rank || (rank == best_rank && top > best_top))))
         {
-            top_angle    = (top_vec.orientation() + Angle::half()).clamp();
-            bottom_angle = (bottom_vec.orientation() + Angle::half()).clamp();
+            best_top    = top;
+            best_bottom = bottom;
+            best_rank   = rank;
         }
+    };
+
+    double highest_top = -INF;
+    for (std::size_t i = 0; i < num_obstacles_; i++)
+    {
+        highest_top = std::max(highest_top, tops[i]);
+    }
+    if (highest_top < goal_top)
+    {
+        consider_open_interval(goal_top, std::max(highest_top, goal_bottom), 0);
+    }
 
-        if (bottom_angle > angle_map.getAngleSegment().getAngleTop() ||
-            top_angle < angle_map.getAngleSegment().getAngleBottom())
+    for (std::size_t i = 0; i < num_obstacles_; i++)
+    {
+        const double open_top = bottoms[i];
+        if (!(open_top > goal_bottom && open_top <= goal_top))
         {
             continue;
         }
 
-        AngleSegment non_viable_angle_seg = AngleSegment(top_angle, bottom_angle);
-        obstacles.emplace_back(non_viable_angle_seg);
-    }
-
-    std::sort(obstacles.begin(), obstacles.end(),
-              [](AngleSegment& a, AngleSegment& b) -> bool { return a > b; });
-
-    for (AngleSegment& obstacle_angle_seg : obstacles)
-    {
-        angle_map.addNonViableAngleSegment(obstacle_angle_seg);
+        bool covered         = false;
+        double highest_below = -INF;
+        for (std::size_t j = 0; j < num_obstacles_; j++)
+        {
+            covered = covered || (bottoms[j] < open_top && tops[j] >= open_top);
+            highest_below =
+                std::max(highest_below, tops[j] < open_top ? tops[j] : -INF);
+        }
+        if (!covered)
+        {
+            const bool is_bottom_interval = highest_below < goal_bottom;
+            consider_open_interval(open_top, std::max(highest_below, goal_bottom),
+                                   is_bottom_interval ? 1 : 2);
+        }
     }
 
-    AngleSegment biggest_angle_seg = angle_map.getBiggestViableAngleSegment();
-    if (biggest_angle_seg.getDeltaInDegrees() == 0)
+    if (best_top - best_bottom <= 0)
     {
         return std::nullopt;
     }
 
+    AngleSegment biggest_angle_seg =
+        AngleSegment(Angle::fromRadians(best_top), Angle::fromRadians(best_bottom));
     Angle top_angle    = biggest_angle_seg.getAngleTop();
     Angle bottom_angle = biggest_angle_seg.getAngleBottom();
 
-    if (goal == TeamType::FRIENDLY)
+    if (goal_ == TeamType::FRIENDLY)
     {
         top_angle    = (top_angle + Angle::half()).clamp();
         bottom_angle = (bottom_angle + Angle::half()).clamp();
     }
 
-    Point top_point    = Point(goal_post.getStart().x(),
+    Point top_point    = Point(goal_post_.getStart().x(),
                                (top_angle.sin() / top_angle.cos()) *
-                                       (goal_post.getStart().x() - shot_origin.x()) +
+                                       (goal_post_.getStart().x() - shot_origin.x()) +
                                    shot_origin.y());
-    Point bottom_point = Point(goal_post.getStart().x(),
+    Point bottom_point = Point(goal_post_.getStart().x(),
                                (bottom_angle.sin() / bottom_angle.cos()) *
-                                       (goal_post.getStart().x() - shot_origin.x()) +
+                                       (goal_post_.getStart().x() - shot_origin.x()) +
                                    shot_origin.y());
 
     Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
@@ -96,6 +161,26 @@ std::optional<Shot> calcBestShotOnGoal(const Segment& goal_post, const Point& sh
         Shot(shot_point, Angle::fromDegrees(biggest_angle_seg.getDeltaInDegrees())));
 }
 
+std::vector<std::optional<Shot>> BestShotCalculator::calcBestShotsOnGoal(
+    std::span<const Point> shot_origins) const
+{
+    std::vector<std::optional<Shot>> shots;
+    shots.reserve(shot_origins.size());
+    for (const Point& shot_origin : shot_origins)
+    {
+        shots.emplace_back(calcBestShotOnGoal(shot_origin));
+    }
+    return shots;
+}
+
+std::optional<Shot> calcBestShotOnGoal(const Segment& goal_post, const Point& shot_origin,
+                                       const std::vector<Robot>& robot_obstacles,
+                                       TeamType goal, double radius)
+{
+    return BestShotCalculator(goal_post, robot_obstacles, goal, radius)
+        .calcBestShotOnGoal(shot_origin);
+}
+
 std::optional<Shot> calcBestShotOnGoal(const Field& field, const Team& friendly_team,
                                        const Team& enemy_team, const Point& shot_origin,
                                        TeamType goal,
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
 #include "shared/constants.h"
 #include "software/ai/evaluation/shot.h"
 #include "software/geom/angle_map.h"
@@ -12,6 +17,66 @@
 #include "software/world/team.h"
 #include "software/world/world.h"
 
+/**
+ * Finds the best shot on a goal from many shot origins against the same robot
+ * obstacles, such as every receiver point rated by the pass generator in a tick.
+ *
+ * The positions of the obstacles are stored once as flat arrays, so each query only
+ * loops over plain arrays without allocating. For each shot origin, the angle interval
+ * blocked by each obstacle is computed in one loop over the obstacles. The largest open
+ * interval is then found by checking the gap below the top of the goal and below each
+ * blocked interval, so the blocked intervals never have to be sorted or merged.
+ */
+class BestShotCalculator
+{
+   public:
+    // The most robot obstacles a BestShotCalculator can hold
+    static constexpr std::size_t MAX_NUM_OBSTACLES = 2 * MAX_ROBOT_IDS;
+
+    /**
+     * Creates a BestShotCalculator for shots on the given goal
+     *
+     * @param goal_post The goal post of the net by the y-coordinate
+     * @param robot_obstacles The robots on the field that may obstruct the shots. These
+     * are treated as circular obstacles.
+     * @param goal The goal to shoot at
+     * @param radius The radius for the robot obstacles
+     *
+     * @throws std::invalid_argument if there are more than MAX_NUM_OBSTACLES obstacles
+     */
+    explicit BestShotCalculator(const Segment& goal_post,
+                                const std::vector<Robot>& robot_obstacles, TeamType goal,
+                                double radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Finds the best shot on the goal from the given shot origin
+     *
+     * @param shot_origin The point that the shot will be taken from
+     *
+     * @return the best target to shoot at and the largest open angle interval for the
+     * shot. If no shot is possible, returns `std::nullopt`
+     */
+    std::optional<Shot> calcBestShotOnGoal(const Point& shot_origin) const;
+
+    /**
+     * Finds the best shot on the goal from each of the given shot origins
+     *
+     * @param shot_origins The points that the shots will be taken from
+     *
+     * @return the best shot from each shot origin, in the order of the shot origins
+     */
+    std::vector<std::optional<Shot>> calcBestShotsOnGoal(
+        std::span<const Point> shot_origins) const;
+
+   private:
+    Segment goal_post_;
+    TeamType goal_;
+    double radius_;
+    std::size_t num_obstacles_;
+    std::array<double, MAX_NUM_OBSTACLES> obstacle_xs_;
+    std::array<double, MAX_NUM_OBSTACLES> obstacle_ys_;
+};
+
 /**
  * Finds the best shot on the given goal, and returns the best target to shoot at and
  * the largest open angle interval for the shot (this is the total angle between the
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "shared/constants.h"
 #include "software/test_util/test_util.h"
 
@@ -571,3 +573,234 @@ TEST(CalcBestShotTest, calc_best_shot_out_of_field_bounds)
     // We should not be able to find a shot
     ASSERT_FALSE(result);
 }
+
+/**
+ * Finds the best shot on goal by merging the angle intervals blocked by the obstacles
+ * into an AngleMap, the way calcBestShotOnGoal did before BestShotCalculator. This is
+ * used as an independent reference for the BestShotCalculator.
+ *
+ * @param goal_post The goal post of the net by the y-coordinate
+ * @param shot_origin The point that the shot will be taken from
+ * @param robot_obstacles The robots on the field that may obstruct the shot
+ * @param goal The goal to shoot at
+ *
+ * @return the best shot, or std::nullopt if no shot is possible
+ */
+static std::optional<Shot> calcBestShotOnGoalWithAngleMap(
+    const Segment& goal_post, const Point& shot_origin,
+    const std::vector<Robot>& robot_obstacles, TeamType goal)
+{
+    if ((goal == TeamType::FRIENDLY && shot_origin.x() < goal_post.getStart().x()) ||
+        (goal == TeamType::ENEMY && shot_origin.x() > goal_post.getStart().x()))
+    {
+        return std::nullopt;
+    }
+
+    Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
+    Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
+    if (goal == TeamType::FRIENDLY)
+    {
+        auto tmp       = pos_post_angle;
+        pos_post_angle = (neg_post_angle + Angle::half()).clamp();
+        neg_post_angle = (tmp + Angle::half()).clamp();
+    }
+    AngleMap angle_map(pos_post_angle, neg_post_angle, robot_obstacles.size());
+
+    std::vector<AngleSegment> obstacles;
+    for (const Robot& robot_obstacle : robot_obstacles)
+    {
+        Vector one_end_vec = (robot_obstacle.position() - shot_origin)
+                                 .perpendicular()
+                                 .normalize(ROBOT_MAX_RADIUS_METERS);
+        Vector top_vec     = robot_obstacle.position() + one_end_vec - shot_origin;
+        Vector bottom_vec  = robot_obstacle.position() - one_end_vec - shot_origin;
+
+        Angle top_angle    = top_vec.orientation();
+        Angle bottom_angle = bottom_vec.orientation();
+        if (goal == TeamType::FRIENDLY)
+        {
+            top_angle    = (top_angle + Angle::half()).clamp();
+            bottom_angle = (bottom_angle + Angle::half()).clamp();
+        }
+
+        if (bottom_angle > angle_map.getAngleSegment().getAngleTop() ||
+            top_angle < angle_map.getAngleSegment().getAngleBottom())
+        {
+            continue;
+        }
+        obstacles.emplace_back(top_angle, bottom_angle);
+    }
+
+    std::sort(obstacles.begin(), obstacles.end(),
+              [](AngleSegment& a, AngleSegment& b) -> bool { return a > b; });
+    for (AngleSegment& obstacle : obstacles)
+    {
+        angle_map.addNonViableAngleSegment(obstacle);
+    }
+
+    AngleSegment biggest_angle_seg = angle_map.getBiggestViableAngleSegment();
+    if (biggest_angle_seg.getDeltaInDegrees() == 0)
+    {
+        return std::nullopt;
+    }
+
+    Angle top_angle    = biggest_angle_seg.getAngleTop();
+    Angle bottom_angle = biggest_angle_seg.getAngleBottom();
+    if (goal == TeamType::FRIENDLY)
+    {
+        top_angle    = (top_angle + Angle::half()).clamp();
+        bottom_angle = (bottom_angle + Angle::half()).clamp();
+    }
+
+    const double goal_x = goal_post.getStart().x();
+    Point top_point(goal_x,
+                    top_angle.tan() * (goal_x - shot_origin.x()) + shot_origin.y());
+    Point bottom_point(goal_x,
+                       bottom_angle.tan() * (goal_x - shot_origin.x()) + shot_origin.y());
+    return Shot((top_point - bottom_point) / 2 + bottom_point,
+                Angle::fromDegrees(biggest_angle_seg.getDeltaInDegrees()));
+}
+
+/**
+ * Expects the shots found by the BestShotCalculator to match the shots found by
+ * merging the blocked angle intervals into an AngleMap
+ *
+ * @param goal_post The goal post of the net by the y-coordinate
+ * @param shot_origins The points that the shots will be taken from
+ * @param robot_obstacles The robots on the field that may obstruct the shots
+ * @param goal The goal to shoot at
+ */
+static void expectBestShotsMatchAngleMap(const Segment& goal_post,
+                                         const std::vector<Point>& shot_origins,
+                                         const std::vector<Robot>& robot_obstacles,
+                                         TeamType goal)
+{
+    BestShotCalculator calculator(goal_post, robot_obstacles, goal);
+    std::vector<std::optional<Shot>> shots = calculator.calcBestShotsOnGoal(shot_origins);
+
+    ASSERT_EQ(shot_origins.size(), shots.size());
+    for (std::size_t i = 0; i < shot_origins.size(); i++)
+    {
+        std::optional<Shot> expected_shot = calcBestShotOnGoalWithAngleMap(
+            goal_post, shot_origins[i], robot_obstacles, goal);
+        ASSERT_EQ(expected_shot.has_value(), shots[i].has_value())
+            << "Shot origin " << shot_origins[i];
+        if (expected_shot)
+        {
+            EXPECT_NEAR(expected_shot->getPointToShootAt().x(),
+                        shots[i]->getPointToShootAt().x(), 1e-6)
+                << "Shot origin " << shot_origins[i];
+            EXPECT_NEAR(expected_shot->getPointToShootAt().y(),
+                        shots[i]->getPointToShootAt().y(), 1e-6)
+                << "Shot origin " << shot_origins[i];
+            EXPECT_NEAR(expected_shot->getOpenAngle().toDegrees(),
+                        shots[i]->getOpenAngle().toDegrees(), 1e-6)
+                << "Shot origin " << shot_origins[i];
+        }
+    }
+}
+
+TEST(CalcBestShotTest, best_shot_calculator_open_angle_around_single_obstacle)
+{
+    // An obstacle straight in front of the shot origin splits the goal into two open
+    // intervals of the same size, and the top one is picked
+    Segment goal_post(Point(4.5, 0.5), Point(4.5, -0.5));
+    std::vector<Robot> robot_obstacles = {Robot(0, Point(2, 0), Vector(0, 0),
+                                                Angle::zero(), AngularVelocity::zero(),
+                                                Timestamp::fromSeconds(0))};
+
+    BestShotCalculator calculator(goal_post, robot_obstacles, TeamType::ENEMY);
+    std::optional<Shot> shot = calculator.calcBestShotOnGoal(Point(0, 0));
+
+    ASSERT_TRUE(shot);
+    const double open_angle_radians =
+        std::atan(0.5 / 4.5) - std::atan(ROBOT_MAX_RADIUS_METERS / 2);
+    EXPECT_NEAR(shot->getOpenAngle().toRadians(), open_angle_radians, 1e-9);
+    EXPECT_NEAR(shot->getPointToShootAt().x(), 4.5, 1e-9);
+    EXPECT_NEAR(shot->getPointToShootAt().y(),
+                (0.5 + 4.5 * ROBOT_MAX_RADIUS_METERS / 2) / 2, 1e-9);
+}
+
+TEST(CalcBestShotTest, best_shot_calculator_batch_matches_angle_map)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Segment goal_post(world->field().enemyGoalpostPos(),
+                      world->field().enemyGoalpostNeg());
+    std::vector<Robot> robot_obstacles = {
+        Robot(0, Point(3.5, 0.2), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, Point(3.8, -0.4), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(2, Point(2, 1), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0))};
+    std::vector<Point> shot_origins = {Point(0, 0), Point(2, 1.5), Point(3, -1),
+                                       Point(5, 0)};
+
+    expectBestShotsMatchAngleMap(goal_post, shot_origins, robot_obstacles,
+                                 TeamType::ENEMY);
+
+    // The shot origin behind the net has no shot
+    BestShotCalculator calculator(goal_post, robot_obstacles, TeamType::ENEMY);
+    EXPECT_FALSE(calculator.calcBestShotOnGoal(shot_origins[3]));
+}
+
+TEST(CalcBestShotTest, best_shot_calculator_matches_angle_map_with_random_obstacles)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    std::mt19937 random_num_gen(1010);
+    std::uniform_real_distribution<double> obstacle_x_distribution(1.0, 4.4);
+    std::uniform_real_distribution<double> obstacle_y_distribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> origin_x_distribution(-2.0, 4.0);
+    std::uniform_real_distribution<double> origin_y_distribution(-2.0, 2.0);
+    std::uniform_int_distribution<int> num_obstacles_distribution(0, 11);
+
+    for (TeamType goal : {TeamType::ENEMY, TeamType::FRIENDLY})
+    {
+        // Mirror the obstacles and shot origins onto the half of the goal being shot at
+        const double side = goal == TeamType::ENEMY ? 1.0 : -1.0;
+        Segment goal_post =
+            goal == TeamType::ENEMY
+                ? Segment(world->field().enemyGoalpostPos(),
+                          world->field().enemyGoalpostNeg())
+                : Segment(world->field().friendlyGoalpostPos(),
+                          world->field().friendlyGoalpostNeg());
+
+        for (int layout = 0; layout < 100; layout++)
+        {
+            std::vector<Robot> robot_obstacles;
+            const int num_obstacles = num_obstacles_distribution(random_num_gen);
+            for (int i = 0; i < num_obstacles; i++)
+            {
+                robot_obstacles.emplace_back(
+                    i,
+                    Point(side * obstacle_x_distribution(random_num_gen),
+                          obstacle_y_distribution(random_num_gen)),
+                    Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                    Timestamp::fromSeconds(0));
+            }
+
+            std::vector<Point> shot_origins;
+            for (int i = 0; i < 20; i++)
+            {
+                shot_origins.emplace_back(side * origin_x_distribution(random_num_gen),
+                                          origin_y_distribution(random_num_gen));
+            }
+
+            expectBestShotsMatchAngleMap(goal_post, shot_origins, robot_obstacles, goal);
+        }
+    }
+}
+
+TEST(CalcBestShotTest, best_shot_calculator_with_too_many_obstacles_throws)
+{
+    std::vector<Robot> robot_obstacles;
+    for (unsigned int i = 0; i <= BestShotCalculator::MAX_NUM_OBSTACLES; i++)
+    {
+        robot_obstacles.emplace_back(i, Point(i * 0.1, 0), Vector(0, 0), Angle::zero(),
+                                     AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    }
+
+    EXPECT_THROW(BestShotCalculator(Segment(Point(4.5, 0.5), Point(4.5, -0.5)),
+                                    robot_obstacles, TeamType::ENEMY),
+                 std::invalid_argument);
+}
@@ -1,7 +1,5 @@
 #include "software/ai/evaluation/enemy_threat.h"
 
-#include <deque>
-
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/intercept.h"
@@ -23,23 +21,17 @@ std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> findAllReceiverPasserPa
     {
         for (const auto& receiver : possible_receivers)
         {
-            // Create a vector of obstacles that includes all robots except the
-            // current passer and receiver
-            std::vector<Robot> obstacles = all_robots;
-            obstacles.erase(std::remove(obstacles.begin(), obstacles.end(), passer),
-                            obstacles.end());
-            obstacles.erase(std::remove(obstacles.begin(), obstacles.end(), receiver),
-                            obstacles.end());
-
             // Check if the pass from the passer to the receiver would be blocked by any
-            // robots
+            // robots other than the passer and receiver
+            const Segment pass(passer.position(), receiver.position());
             bool pass_blocked =
-                std::any_of(obstacles.begin(), obstacles.end(),
-                            [passer, receiver](const Robot& obstacle)
+                std::any_of(all_robots.begin(), all_robots.end(),
+                            [&](const Robot& obstacle)
                             {
-                                return intersects(
-                                    Circle(obstacle.position(), ROBOT_MAX_RADIUS_METERS),
-                                    Segment(passer.position(), receiver.position()));
+                                return obstacle != passer && obstacle != receiver &&
+                                       intersects(Circle(obstacle.position(),
+                                                         ROBOT_MAX_RADIUS_METERS),
+                                                  pass);
                             });
 
             if (!pass_blocked)
@@ -68,91 +60,65 @@ std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> findAllReceiverPasserPa
 std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
     const Robot& initial_passer, const Robot& final_receiver, const Team& passing_team,
     const Team& other_team)
+{
+    // The passing team takes the place of the friendly team in the pass lanes
+    return getNumPassesToRobot(initial_passer, final_receiver, TeamType::FRIENDLY,
+                               PassLaneMatrix(passing_team, other_team));
+}
+
+std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
+    const Robot& initial_passer, const Robot& final_receiver, TeamType passing_team,
+    const PassLaneMatrix& pass_lanes)
 {
     if (initial_passer == final_receiver)
     {
         return std::make_pair(0, std::nullopt);
     }
 
+    std::optional<std::size_t> passer_index =
+        pass_lanes.getRobotIndex(initial_passer, passing_team);
+    std::optional<std::size_t> receiver_index =
+        pass_lanes.getRobotIndex(final_receiver, passing_team);
+    if (!passer_index || !receiver_index)
+    {
+        return std::nullopt;
+    }
+
     // We calculate the minimum number of passes it would take for the initial_passer
-    // robot to pass the ball to the final_receiver, assuming both robots are on the given
-    // team
+    // robot to pass the ball to the final_receiver, by searching outwards from the
+    // initial_passer one pass at a time. Each layer holds the robots that can first get
+    // the ball after that many passes.
     //
-    // This algorithm essentially treats the team of robots like a Directed Acyclic
-    // Graph and "traverses" the graph to find the shortest path to the robot
-
-    // The robots that could have the ball and make a pass at each iteration. They
-    // are on the "frontier" of the graph search
-    std::vector<Robot> current_passers{initial_passer};
-    // The remaining robots we haven't checked yet
-    std::vector<Robot> unvisited_robots = passing_team.getAllRobots();
-    // Remove the initial passer since we already start off visiting it, and don't need
-    // to again
-    unvisited_robots.erase(
-        std::remove(unvisited_robots.begin(), unvisited_robots.end(), initial_passer),
-        unvisited_robots.end());
-    std::vector<Robot> all_robots   = passing_team.getAllRobots();
-    std::vector<Robot> other_robots = other_team.getAllRobots();
-    // TODO: possibly re-enable using friendly robots as obstacles if we can find a way to
-    // stop defenders from oscillating between positions See
+    // TODO: possibly re-enable using the other team's robots as obstacles if we can
+    // find a way to stop defenders from oscillating between positions See
     // https://github.com/UBC-Thunderbots/Software/issues/642
-    // all_robots.insert(all_robots.end(), other_robots.begin(), other_robots.end());
+    std::vector<PassLaneMatrix::RobotSet> layers =
+        pass_lanes.getPassLayers(*passer_index, passing_team, passing_team);
 
-    // On each iteration, check what robots can be passed to. These receivers will
-    // become the passers on the next iteration. This is like expanding the frontier
-    // of the graph
-    //
-    // We continue to iterate and check greater numbers of passes until one of the
-    // following cases:
-    // * There are no more passers at the end of the iteration. This means no more
-    //   unvisited robots can be passed to
-    // * There are no more unvisited robots
-    // * We have iterated up to the size of the team. This is a fallback case to
-    //   prevent any infinite loops, just in case
-    //
-    // We already check the case where the passer and receiver are the same. If this was
-    // the case, 0 passes would be required. Since that case is already checked, when we
-    // start the loop we are checking for the possibility of the receiver getting the ball
-    // in 1 pass. This is why pass_num starts at 1.
-    for (unsigned pass_num = 1; pass_num < passing_team.numRobots() &&
-                                !current_passers.empty() && !unvisited_robots.empty();
-         pass_num++)
+    for (std::size_t num_passes = 1; num_passes < layers.size(); num_passes++)
     {
-        std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> receiver_passer_pairs =
-            findAllReceiverPasserPairs(current_passers, unvisited_robots, all_robots);
-
-        // If the robot we are looking for is a receiver, return the number of
-        // passes and the passer to this robot
-        if (receiver_passer_pairs.count(final_receiver) > 0)
+        if (!layers[num_passes].test(*receiver_index))
         {
-            // If there are multiple robots that can pass to the robot, we assume
-            // it will receive the ball from the closest one since this is more
-            // likely
-            auto closest_passer = Team::getNearestRobot(
-                receiver_passer_pairs.at(final_receiver), final_receiver.position());
-            return std::make_pair(pass_num, closest_passer);
+            continue;
         }
 
-        // Create a list of all robots that could receive the ball this iteration
-        std::vector<Robot> all_receivers;
-        for (auto it = receiver_passer_pairs.begin(); it != receiver_passer_pairs.end();
-             it++)
+        // If there are multiple robots that can pass to the robot, we assume
+        // it will receive the ball from the closest one since this is more
+        // likely
+        const PassLaneMatrix::RobotSet& lanes_to_receiver =
+            pass_lanes.getOpenLanes(*receiver_index, passing_team);
+        PassLaneMatrix::RobotSet passers = layers[num_passes - 1] & lanes_to_receiver;
+        std::vector<Robot> passer_robots;
+        for (std::size_t i = 0; i < pass_lanes.getNumRobots(); i++)
         {
-            all_receivers.emplace_back(it->first);
+            if (passers.test(i))
+            {
+                passer_robots.push_back(pass_lanes.getRobot(i));
+            }
         }
-
-        // All robots that could have received the ball now become passers
-        current_passers = all_receivers;
-
-        // Remove any receivers from the unvisited robots, since they have
-        // now been visited
-        unvisited_robots.erase(remove_if(unvisited_robots.begin(), unvisited_robots.end(),
-                                         [&](auto x) {
-                                             return find(all_receivers.begin(),
-                                                         all_receivers.end(),
-                                                         x) != all_receivers.end();
-                                         }),
-                               unvisited_robots.end());
+        auto closest_passer =
+            Team::getNearestRobot(passer_robots, final_receiver.position());
+        return std::make_pair(static_cast<int>(num_passes), closest_passer);
     }
 
     // If we have checked all the robots we can and still haven't found the robot we
@@ -231,6 +197,9 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
 
     std::vector<EnemyThreat> threats;
 
+    // Compute the pass lanes once for all the enemy robots
+    const PassLaneMatrix pass_lanes(friendly_team, enemy_team);
+
     for (const auto& robot : enemy_team.getAllRobots())
     {
         bool has_ball = robot.isNearDribbler(ball.position());
@@ -264,7 +233,7 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field& field, const Team& frie
         if (robot_with_effective_possession)
         {
             auto pass_data = getNumPassesToRobot(robot_with_effective_possession.value(),
-                                                 robot, enemy_team, friendly_team);
+                                                 robot, TeamType::ENEMY, pass_lanes);
             if (pass_data)
             {
                 num_passes = pass_data->first;
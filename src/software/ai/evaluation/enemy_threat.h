@@ -3,6 +3,7 @@
 #include <optional>
 #include <vector>
 
+#include "software/ai/evaluation/pass_lane_matrix.h"
 #include "software/world/world.h"
 
 // This struct stores the concept of an Enemy Threat. It contains all the necessary
@@ -87,6 +88,30 @@ std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
     const Robot& initial_passer, const Robot& final_receiver, const Team& passing_team,
     const Team& other_team);
 
+/**
+ * Returns how many passes it would take for the given passer to pass the ball to the
+ * receiver so the receiver gains possession of the ball, and returns the intermediate
+ * passer the receiver is most likely to receive the ball from, using pass lanes that
+ * have already been computed.
+ *
+ * If the passing and receiving robot are the same, the number of passes is 0 and the
+ * passer value is an std::nullopt. If the receiver cannot be passed to at all
+ * (all passing routes are blocked), then an std::nullopt is returned
+ *
+ * @param initial_passer The robot the passes start from
+ * @param final_receiver The robot trying to be passed to
+ * @param passing_team Which team in the pass lanes the passer and receiver robots are
+ * a part of
+ * @param pass_lanes The pass lanes between the robots on the field
+ *
+ * @return a pair containing the number of passes it will take for the passer robot to
+ * pass the ball to the receiver robot, and the intermediate robot the receiver will
+ * receive the pass from
+ */
+std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
+    const Robot& initial_passer, const Robot& final_receiver, TeamType passing_team,
+    const PassLaneMatrix& pass_lanes);
+
 /**
  * Sorts the given list of threats in order of decreasing threat, so the
  * "most threatening threat" will be at the front of the vector, and the
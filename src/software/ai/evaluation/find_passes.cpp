@@ -37,34 +37,45 @@ std::vector<Robot> findOpenFriendlyRobots(const Team& friendly_team,
 AllPasses findAllPasses(const Robot& robot, const Team& friendly_team,
                         const Team& enemy_team, double radius)
 {
-    std::vector<Robot> open_robots =
-        findOpenFriendlyRobots(friendly_team, enemy_team, radius);
+    return findAllPasses(robot, friendly_team, enemy_team,
+                         PassLaneMatrix(friendly_team, enemy_team, radius));
+}
+
+AllPasses findAllPasses(const Robot& robot, const Team& friendly_team,
+                        const Team& enemy_team, const PassLaneMatrix& pass_lanes)
+{
+    std::optional<std::size_t> robot_index =
+        pass_lanes.getRobotIndex(robot, TeamType::FRIENDLY);
+    if (!robot_index)
+    {
+        return AllPasses{};
+    }
 
-    open_robots.erase(remove(open_robots.begin(), open_robots.end(), robot));
-    std::vector<Robot> robot_obstacles = friendly_team.getAllRobots();
-    robot_obstacles.insert(robot_obstacles.begin(), enemy_team.getAllRobots().begin(),
-                           enemy_team.getAllRobots().end());
-    robot_obstacles.erase(remove(robot_obstacles.begin(), robot_obstacles.end(), robot));
+    std::vector<Robot> open_robots =
+        findOpenFriendlyRobots(friendly_team, enemy_team, pass_lanes.getObstacleRadius());
 
-    std::vector<Circle> obstacles = getObstacles(robot_obstacles, radius);
+    // A pass is direct if no robot on either team other than the passer and receiver
+    // blocks its lane
+    const PassLaneMatrix::RobotSet open_lanes = pass_lanes.getOpenLanes(*robot_index);
     std::vector<Robot> direct_passes;
     std::vector<Robot> indirect_passes;
     for (const Robot& open_robot : open_robots)
     {
-        Circle obstacle = getObstacle(open_robot, radius);
-        obstacles.erase(remove(obstacles.begin(), obstacles.end(), obstacle));
-        Segment possible_pass = Segment(robot.position(), open_robot.position());
-        if (std::any_of(obstacles.begin(), obstacles.end(),
-                        [possible_pass](const Circle obstacle)
-                        { return intersects(possible_pass, obstacle); }))
+        std::optional<std::size_t> open_robot_index =
+            pass_lanes.getRobotIndex(open_robot, TeamType::FRIENDLY);
+        if (*open_robot_index == *robot_index)
         {
-            indirect_passes.push_back(open_robot);
+            continue;
         }
-        else
+
+        if (open_lanes.test(*open_robot_index))
         {
             direct_passes.push_back(open_robot);
         }
-        obstacles.push_back(obstacle);
+        else
+        {
+            indirect_passes.push_back(open_robot);
+        }
     }
     AllPasses all_passes{direct_passes, indirect_passes};
     return all_passes;
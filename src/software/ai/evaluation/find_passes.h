@@ -1,6 +1,7 @@
 #pragma once
 
 #include "shared/constants.h"
+#include "software/ai/evaluation/pass_lane_matrix.h"
 #include "software/ai/passing/pass.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/intersects.h"
@@ -38,6 +39,22 @@ AllPasses findAllPasses(const Robot& robot, const Team& friendly_team,
                         const Team& enemy_team,
                         double radius = ROBOT_MAX_RADIUS_METERS * 1.5);
 
+/**
+ * Finds all direct and indirect passes to open robots, using pass lanes that have
+ * already been computed. The radius the pass lanes were computed with is the radius
+ * around a robot to be treated as an obstacle.
+ *
+ * @param robot The robot that could take the passes
+ * @param friendly_team The same team of the robot with the possession of the ball
+ * @param enemy_team The opposing team of the robot with the possession of the ball
+ * @param pass_lanes The pass lanes between the robots on friendly_team and enemy_team
+ *
+ * @return A vector containing receiving robots of all direct and indirect passes to open
+ * robots on the friendly_team
+ */
+AllPasses findAllPasses(const Robot& robot, const Team& friendly_team,
+                        const Team& enemy_team, const PassLaneMatrix& pass_lanes);
+
 
 /**
  * Return a circle that is treated as an obstacle centered at the robot position with
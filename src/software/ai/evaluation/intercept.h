@@ -18,6 +18,9 @@
  * intercept the ball, and the duration into the future at which the pass would occur,
  *         relative to the timestamp of the robot. If no possible intercept could be
  * found within the field bounds, returns std::nullopt
+ *
+ * NOTE: This samples the trajectory of the ball every time it is called. Use a
+ * BallInterceptSolver to find intercepts for multiple robots with the same ball.
  */
 std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball& ball,
                                                                    const Field& field,
@@ -34,12 +34,14 @@ Point findKeepAwayTargetPoint(const World& world, const Pass& best_pass_so_far,
         initial_keepaway_point = dribble_displacement->getStart();
     }
 
+    const PassingParams passing_params(passing_config);
+
     // the position rating function we want to maximize
     const auto keepaway_point_cost = [&](const std::array<double, 2>& passer_pt_array)
     {
         Point passer_pt(std::get<0>(passer_pt_array), std::get<1>(passer_pt_array));
         return rateKeepAwayPosition(passer_pt, world, best_pass_so_far,
-                                    reduced_field_bounds, passing_config);
+                                    reduced_field_bounds, passing_params);
     };
     GradientDescentOptimizer<2> optimizer{PARAM_WEIGHTS};
     auto passer_pt_array = optimizer.maximize(
@@ -0,0 +1,202 @@
+#include "software/ai/evaluation/pass_lane_matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+PassLaneMatrix::PassLaneMatrix(const Team& friendly_team, const Team& enemy_team,
+                               double obstacle_radius)
+    : robots_(friendly_team.getAllRobots()),
+      num_friendly_robots_(friendly_team.numRobots()),
+      obstacle_radius_(obstacle_radius),
+      clearances_(),
+      open_lanes_()
+{
+    robots_.insert(robots_.end(), enemy_team.getAllRobots().begin(),
+                   enemy_team.getAllRobots().end());
+    if (robots_.size() > MAX_NUM_ROBOTS)
+    {
+        throw std::invalid_argument("PassLaneMatrix supports at most " +
+                                    std::to_string(MAX_NUM_ROBOTS) + " robots, but got " +
+                                    std::to_string(robots_.size()));
+    }
+
+    // Lay the positions out as flat arrays so the loop over obstacles below can be
+    // vectorized
+    const std::size_t num_robots = robots_.size();
+    std::array<double, MAX_NUM_ROBOTS> xs{};
+    std::array<double, MAX_NUM_ROBOTS> ys{};
+    for (std::size_t i = 0; i < num_robots; i++)
+    {
+        xs[i] = robots_[i].position().x();
+        ys[i] = robots_[i].position().y();
+    }
+
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    const std::array<std::pair<std::size_t, std::size_t>, 2> team_ranges = {
+        getTeamRange(TeamType::FRIENDLY), getTeamRange(TeamType::ENEMY)};
+
+    std::array<double, MAX_NUM_ROBOTS> distances_squared{};
+    for (std::size_t from = 0; from < num_robots; from++)
+    {
+        clearances_[0][from][from] = INF;
+        clearances_[1][from][from] = INF;
+
+        for (std::size_t to = from + 1; to < num_robots; to++)
+        {
+            const double lane_x         = xs[to] - xs[from];
+            const double lane_y         = ys[to] - ys[from];
+            const double length_squared = lane_x * lane_x + lane_y * lane_y;
+            const double inv_length_squared =
+                length_squared > 0 ? 1.0 / length_squared : 0.0;
+
+            // The squared distance from every robot to the closest point on the lane
+            for (std::size_t k = 0; k < num_robots; k++)
+            {
+                const double offset_x = xs[k] - xs[from];
+                const double offset_y = ys[k] - ys[from];
+                const double projection =
+                    (offset_x * lane_x + offset_y * lane_y) * inv_length_squared;
+                const double t       = std::clamp(projection, 0.0, 1.0);
+                const double dx      = offset_x - t * lane_x;
+                const double dy      = offset_y - t * lane_y;
+                distances_squared[k] = dx * dx + dy * dy;
+            }
+            distances_squared[from] = INF;
+            distances_squared[to]   = INF;
+
+            for (std::size_t team = 0; team < team_ranges.size(); team++)
+            {
+                const auto [begin, end]     = team_ranges[team];
+                double min_distance_squared = INF;
+                for (std::size_t k = begin; k < end; k++)
+                {
+                    min_distance_squared = std::min(min_distance_squared,
+                                                    distances_squared[k]);
+                }
+
+                const double clearance      = std::sqrt(min_distance_squared);
+                clearances_[team][from][to] = clearance;
+                clearances_[team][to][from] = clearance;
+                if (clearance > obstacle_radius_)
+                {
+                    open_lanes_[team][from].set(to);
+                    open_lanes_[team][to].set(from);
+                }
+            }
+        }
+    }
+}
+
+std::size_t PassLaneMatrix::getNumRobots() const
+{
+    return robots_.size();
+}
+
+const Robot& PassLaneMatrix::getRobot(std::size_t index) const
+{
+    return robots_.at(index);
+}
+
+std::optional<std::size_t> PassLaneMatrix::getRobotIndex(const Robot& robot,
+                                                         TeamType team) const
+{
+    const auto [begin, end] = getTeamRange(team);
+    for (std::size_t i = begin; i < end; i++)
+    {
+        if (robots_[i].id() == robot.id())
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+PassLaneMatrix::RobotSet PassLaneMatrix::getTeamRobots(TeamType team) const
+{
+    RobotSet team_robots;
+    const auto [begin, end] = getTeamRange(team);
+    for (std::size_t i = begin; i < end; i++)
+    {
+        team_robots.set(i);
+    }
+    return team_robots;
+}
+
+double PassLaneMatrix::getObstacleRadius() const
+{
+    return obstacle_radius_;
+}
+
+double PassLaneMatrix::getClearance(std::size_t from, std::size_t to,
+                                    TeamType obstacle_team) const
+{
+    return clearances_[static_cast<std::size_t>(obstacle_team)][from][to];
+}
+
+double PassLaneMatrix::getClearance(std::size_t from, std::size_t to) const
+{
+    return std::min(getClearance(from, to, TeamType::FRIENDLY),
+                    getClearance(from, to, TeamType::ENEMY));
+}
+
+const PassLaneMatrix::RobotSet& PassLaneMatrix::getOpenLanes(
+    std::size_t from, TeamType obstacle_team) const
+{
+    return open_lanes_[static_cast<std::size_t>(obstacle_team)][from];
+}
+
+PassLaneMatrix::RobotSet PassLaneMatrix::getOpenLanes(std::size_t from) const
+{
+    return getOpenLanes(from, TeamType::FRIENDLY) & getOpenLanes(from, TeamType::ENEMY);
+}
+
+bool PassLaneMatrix::isLaneOpen(std::size_t from, std::size_t to,
+                                TeamType obstacle_team) const
+{
+    return getOpenLanes(from, obstacle_team).test(to);
+}
+
+bool PassLaneMatrix::isLaneOpen(std::size_t from, std::size_t to) const
+{
+    return getOpenLanes(from).test(to);
+}
+
+std::vector<PassLaneMatrix::RobotSet> PassLaneMatrix::getPassLayers(
+    std::size_t from, TeamType passing_team, TeamType obstacle_team) const
+{
+    const RobotSet passing_robots = getTeamRobots(passing_team);
+
+    std::vector<RobotSet> layers;
+    layers.emplace_back().set(from);
+    RobotSet visited = layers.back();
+    while (true)
+    {
+        RobotSet next_layer;
+        for (std::size_t i = 0; i < robots_.size(); i++)
+        {
+            if (layers.back().test(i))
+            {
+                next_layer |= getOpenLanes(i, obstacle_team);
+            }
+        }
+        next_layer &= passing_robots & ~visited;
+
+        if (next_layer.none())
+        {
+            return layers;
+        }
+        visited |= next_layer;
+        layers.push_back(next_layer);
+    }
+}
+
+std::pair<std::size_t, std::size_t> PassLaneMatrix::getTeamRange(TeamType team) const
+{
+    if (team == TeamType::FRIENDLY)
+    {
+        return {0, num_friendly_robots_};
+    }
+    return {num_friendly_robots_, robots_.size()};
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/world/team.h"
+
+/**
+ * The pass lanes between every pair of robots on the field, computed in one pass over
+ * the positions of the robots so that evaluations that check many lanes per tick
+ * don't have to intersect each lane with every robot again.
+ *
+ * Robots are referred to by their index, with the robots of the friendly team first
+ * followed by the robots of the enemy team, each in the order of Team::getAllRobots.
+ * A lane between two robots is blocked by a robot if the centre of the robot is within
+ * the obstacle radius of the segment between them. The passer and receiver never
+ * block their own lane. Blocked lanes are kept separately for obstacles on each team,
+ * since some evaluations only treat one team as obstacles.
+ *
+ * Sets of robots are bitsets over the robot indices, so checking a lane is a bit
+ * lookup and searching for multi-pass routes is a breadth-first search over bitsets.
+ */
+class PassLaneMatrix
+{
+   public:
+    static constexpr std::size_t MAX_NUM_ROBOTS = 2 * MAX_ROBOT_IDS;
+    using RobotSet                              = std::bitset<MAX_NUM_ROBOTS>;
+
+    /**
+     * Computes the pass lanes between every pair of robots on the given teams
+     *
+     * @param friendly_team The friendly team
+     * @param enemy_team The enemy team
+     * @param obstacle_radius The distance from a lane within which a robot blocks it
+     *
+     * @throws std::invalid_argument if there are more than MAX_NUM_ROBOTS robots
+     */
+    explicit PassLaneMatrix(const Team& friendly_team, const Team& enemy_team,
+                            double obstacle_radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Gets the number of robots on both teams
+     *
+     * @return the number of robots
+     */
+    std::size_t getNumRobots() const;
+
+    /**
+     * Gets the robot with the given index
+     *
+     * @param index The index of the robot
+     *
+     * @return the robot with the given index
+     */
+    const Robot& getRobot(std::size_t index) const;
+
+    /**
+     * Gets the index of the robot with the same id as the given robot on the given team
+     *
+     * @param robot The robot to find
+     * @param team The team the robot is on
+     *
+     * @return the index of the robot, or std::nullopt if it is not on the team
+     */
+    std::optional<std::size_t> getRobotIndex(const Robot& robot, TeamType team) const;
+
+    /**
+     * Gets the robots on the given team
+     *
+     * @param team The team
+     *
+     * @return the set of robots on the team
+     */
+    RobotSet getTeamRobots(TeamType team) const;
+
+    /**
+     * Gets the obstacle radius the lanes were computed with
+     *
+     * @return the obstacle radius, in metres
+     */
+    double getObstacleRadius() const;
+
+    /**
+     * Gets the distance from the lane between two robots to the closest robot on the
+     * given team, other than the two robots themselves
+     *
+     * @param from The index of one end of the lane
+     * @param to The index of the other end of the lane
+     * @param obstacle_team The team of the robots to measure the distance to
+     *
+     * @return the clearance of the lane, or infinity if there are no such robots
+     */
+    double getClearance(std::size_t from, std::size_t to, TeamType obstacle_team) const;
+
+    /**
+     * Gets the distance from the lane between two robots to the closest other robot
+     *
+     * @param from The index of one end of the lane
+     * @param to The index of the other end of the lane
+     *
+     * @return the clearance of the lane, or infinity if there are no other robots
+     */
+    double getClearance(std::size_t from, std::size_t to) const;
+
+    /**
+     * Gets the robots whose lane from the given robot isn't blocked by any robot on the
+     * given team. A robot has no lane to itself.
+     *
+     * @param from The index of the robot the lanes start from
+     * @param obstacle_team The team of the robots that may block the lanes
+     *
+     * @return the set of robots with an open lane from the given robot
+     */
+    const RobotSet& getOpenLanes(std::size_t from, TeamType obstacle_team) const;
+
+    /**
+     * Gets the robots whose lane from the given robot isn't blocked by any robot
+     *
+     * @param from The index of the robot the lanes start from
+     *
+     * @return the set of robots with an open lane from the given robot
+     */
+    RobotSet getOpenLanes(std::size_t from) const;
+
+    /**
+     * Checks if the lane between two robots isn't blocked by any robot on the given team
+     *
+     * @param from The index of one end of the lane
+     * @param to The index of the other end of the lane
+     * @param obstacle_team The team of the robots that may block the lane
+     *
+     * @return whether the lane is open
+     */
+    bool isLaneOpen(std::size_t from, std::size_t to, TeamType obstacle_team) const;
+
+    /**
+     * Checks if the lane between two robots isn't blocked by any robot
+     *
+     * @param from The index of one end of the lane
+     * @param to The index of the other end of the lane
+     *
+     * @return whether the lane is open
+     */
+    bool isLaneOpen(std::size_t from, std::size_t to) const;
+
+    /**
+     * Finds the robots of the passing team that the ball can get to from the given
+     * robot in each number of passes, passing only between robots of the passing team
+     * along lanes that aren't blocked by robots of the obstacle team
+     *
+     * @param from The index of the robot with the ball
+     * @param passing_team The team passing the ball
+     * @param obstacle_team The team of the robots that may block passes
+     *
+     * @return the sets of robots that the ball first gets to after each number of
+     * passes, starting with the robot with the ball after 0 passes and ending with the
+     * last non-empty set
+     */
+    std::vector<RobotSet> getPassLayers(std::size_t from, TeamType passing_team,
+                                        TeamType obstacle_team) const;
+
+   private:
+    /**
+     * Gets the range of indices of the robots on the given team
+     *
+     * @param team The team
+     *
+     * @return the first index and one past the last index of the robots on the team
+     */
+    std::pair<std::size_t, std::size_t> getTeamRange(TeamType team) const;
+
+    std::vector<Robot> robots_;
+    std::size_t num_friendly_robots_;
+    double obstacle_radius_;
+
+    // The clearance of each lane to the robots of each team, indexed by
+    // [TeamType][from][to]
+    std::array<std::array<std::array<double, MAX_NUM_ROBOTS>, MAX_NUM_ROBOTS>, 2>
+        clearances_;
+
+    // The open lanes from each robot with the robots of each team as obstacles,
+    // indexed by [TeamType][from]
+    std::array<std::array<RobotSet, MAX_NUM_ROBOTS>, 2> open_lanes_;
+};
@@ -0,0 +1,117 @@
+#include "software/ai/evaluation/pass_lane_matrix.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/test_util.h"
+
+class PassLaneMatrixTest : public testing::Test
+{
+   protected:
+    static Team createTeam(const std::vector<Point>& positions)
+    {
+        std::vector<Robot> robots;
+        for (const auto& position : positions)
+        {
+            robots.emplace_back(static_cast<RobotId>(robots.size()), position, Vector(),
+                                Angle::zero(), AngularVelocity::zero(),
+                                Timestamp::fromSeconds(0));
+        }
+        Team team(Duration::fromSeconds(1));
+        team.updateRobots(robots);
+        return team;
+    }
+};
+
+TEST_F(PassLaneMatrixTest, robots_are_indexed_friendly_then_enemy)
+{
+    Team friendly_team = createTeam({Point(0, 0), Point(2, 0)});
+    Team enemy_team    = createTeam({Point(1, 3)});
+
+    PassLaneMatrix pass_lanes(friendly_team, enemy_team);
+
+    EXPECT_EQ(3, pass_lanes.getNumRobots());
+    EXPECT_EQ(1, pass_lanes.getRobotIndex(friendly_team.getAllRobots()[1],
+                                          TeamType::FRIENDLY));
+    EXPECT_EQ(2,
+              pass_lanes.getRobotIndex(enemy_team.getAllRobots()[0], TeamType::ENEMY));
+    EXPECT_EQ(Point(1, 3), pass_lanes.getRobot(2).position());
+    EXPECT_EQ(PassLaneMatrix::RobotSet("011"),
+              pass_lanes.getTeamRobots(TeamType::FRIENDLY));
+    EXPECT_EQ(PassLaneMatrix::RobotSet("100"), pass_lanes.getTeamRobots(TeamType::ENEMY));
+}
+
+TEST_F(PassLaneMatrixTest, clearance_is_distance_to_closest_robot_on_team)
+{
+    Team friendly_team = createTeam({Point(0, 0), Point(4, 0), Point(2, 1)});
+    Team enemy_team    = createTeam({Point(1, -0.5), Point(6, 0)});
+
+    PassLaneMatrix pass_lanes(friendly_team, enemy_team);
+
+    EXPECT_DOUBLE_EQ(1.0, pass_lanes.getClearance(0, 1, TeamType::FRIENDLY));
+    EXPECT_DOUBLE_EQ(0.5, pass_lanes.getClearance(0, 1, TeamType::ENEMY));
+    EXPECT_DOUBLE_EQ(0.5, pass_lanes.getClearance(1, 0));
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              pass_lanes.getClearance(3, 4, TeamType::ENEMY));
+}
+
+TEST_F(PassLaneMatrixTest, robot_close_to_lane_blocks_it)
+{
+    Team friendly_team = createTeam({Point(0, 0), Point(4, 0), Point(0, 2)});
+    Team enemy_team    = createTeam({Point(2, 0.05)});
+
+    PassLaneMatrix pass_lanes(friendly_team, enemy_team);
+
+    EXPECT_FALSE(pass_lanes.isLaneOpen(0, 1));
+    EXPECT_FALSE(pass_lanes.isLaneOpen(1, 0, TeamType::ENEMY));
+    EXPECT_TRUE(pass_lanes.isLaneOpen(0, 1, TeamType::FRIENDLY));
+    EXPECT_TRUE(pass_lanes.isLaneOpen(0, 2));
+    EXPECT_TRUE(pass_lanes.isLaneOpen(1, 2));
+    EXPECT_FALSE(pass_lanes.isLaneOpen(0, 0));
+}
+
+TEST_F(PassLaneMatrixTest, obstacle_radius_sets_which_lanes_are_blocked)
+{
+    Team friendly_team = createTeam({Point(0, 0), Point(4, 0)});
+    Team enemy_team    = createTeam({Point(2, 0.3)});
+
+    EXPECT_TRUE(PassLaneMatrix(friendly_team, enemy_team, 0.2).isLaneOpen(0, 1));
+    EXPECT_FALSE(PassLaneMatrix(friendly_team, enemy_team, 0.4).isLaneOpen(0, 1));
+}
+
+TEST_F(PassLaneMatrixTest, pass_layers_go_around_blocked_lanes)
+{
+    // The lane from robot 0 to robot 2 is blocked by robot 1, so the ball has to go
+    // through robot 3
+    Team friendly_team =
+        createTeam({Point(0, 0), Point(2, 0), Point(4, 0), Point(2, 2), Point(-3, -3)});
+    Team enemy_team = createTeam({Point(-1.5, -1.5)});
+
+    PassLaneMatrix pass_lanes(friendly_team, enemy_team);
+
+    std::vector<PassLaneMatrix::RobotSet> layers =
+        pass_lanes.getPassLayers(0, TeamType::FRIENDLY, TeamType::FRIENDLY);
+    ASSERT_EQ(3, layers.size());
+    EXPECT_EQ(PassLaneMatrix::RobotSet("00001"), layers[0]);
+    EXPECT_EQ(PassLaneMatrix::RobotSet("11010"), layers[1]);
+    EXPECT_EQ(PassLaneMatrix::RobotSet("00100"), layers[2]);
+
+    // The enemy robot blocks the lane from robot 0 to robot 4 instead, when it is
+    // the only obstacle
+    layers = pass_lanes.getPassLayers(0, TeamType::FRIENDLY, TeamType::ENEMY);
+    ASSERT_EQ(3, layers.size());
+    EXPECT_EQ(PassLaneMatrix::RobotSet("01110"), layers[1]);
+    EXPECT_EQ(PassLaneMatrix::RobotSet("10000"), layers[2]);
+}
+
+TEST_F(PassLaneMatrixTest, too_many_robots_throws)
+{
+    std::vector<Point> positions;
+    for (unsigned int i = 0; i <= MAX_ROBOT_IDS; i++)
+    {
+        positions.emplace_back(i, 0);
+    }
+    Team friendly_team = createTeam(positions);
+    Team enemy_team    = createTeam(positions);
+
+    EXPECT_THROW(PassLaneMatrix(friendly_team, enemy_team), std::invalid_argument);
+}
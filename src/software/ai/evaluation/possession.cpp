@@ -1,7 +1,7 @@
 #include "software/ai/evaluation/possession.h"
 
 #include "shared/constants.h"
-#include "software/ai/evaluation/intercept.h"
+#include "software/ai/evaluation/ball_intercept_solver.h"
 #include "software/geom/algorithms/distance.h"
 
 std::optional<Robot> getRobotWithEffectiveBallPossession(const Team& team,
@@ -13,18 +13,20 @@ std::optional<Robot> getRobotWithEffectiveBallPossession(const Team& team,
         return std::nullopt;
     }
 
-    auto best_intercept =
-        findBestInterceptForBall(ball, field, team.getAllRobots().at(0));
-    auto baller_robot = team.getAllRobots().at(0);
+    const std::vector<Robot>& robots = team.getAllRobots();
+    const auto intercepts = BallInterceptSolver(ball, field).findIntercepts(robots);
+
+    auto best_intercept = intercepts.at(0);
+    auto baller_robot   = robots.at(0);
 
     // Find the robot that can intercept the ball the quickest
-    for (const auto& robot : team.getAllRobots())
+    for (std::size_t i = 0; i < robots.size(); i++)
     {
-        auto intercept = findBestInterceptForBall(ball, field, robot);
+        const auto& intercept = intercepts[i];
         if (!best_intercept || (intercept && intercept->second < best_intercept->second))
         {
             best_intercept = intercept;
-            baller_robot   = robot;
+            baller_robot   = robots[i];
         }
     }
 
@@ -25,7 +25,8 @@ void AssignedTacticsPlay::updateControlParams(
 
 std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
     const WorldPtr& world_ptr, const InterPlayCommunication&,
-    const SetInterPlayCommunicationCallback&)
+    const SetInterPlayCommunicationCallback&,
+    const std::shared_ptr<const AiConfigSnapshot>&)
 {
     obstacle_list.Clear();
     path_visualization.Clear();
@@ -52,7 +53,9 @@ std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
 
             if (traj_path.has_value())
             {
-                robot_trajectories.insert_or_assign(robot.id(), traj_path.value());
+                robot_trajectories.insert_or_assign(
+                    robot.id(),
+                    std::make_shared<const SampledTrajectoryPath>(traj_path.value()));
             }
             else
             {
@@ -32,7 +32,8 @@ class AssignedTacticsPlay : public Play
 
     std::unique_ptr<TbotsProto::PrimitiveSet> get(
         const WorldPtr& world_ptr, const InterPlayCommunication&,
-        const SetInterPlayCommunicationCallback&) override;
+        const SetInterPlayCommunicationCallback&,
+        const std::shared_ptr<const AiConfigSnapshot>&) override;
 
    private:
     std::map<RobotId, std::shared_ptr<Tactic>> assigned_tactics;
@@ -21,6 +21,8 @@ TEST(BallPlacementPlayFSMTest, test_transitions)
     world_ptr->updateGameState(game_state);
 
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<BallPlacementPlayFSM> fsm(
         BallPlacementPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
@@ -30,7 +32,8 @@ TEST(BallPlacementPlayFSMTest, test_transitions)
         BallPlacementPlayFSM::ControlParams{},
         PlayUpdate(
             world_ptr, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<BallPlacementPlayFSM::AlignPlacementState>));
 }
@@ -52,6 +55,8 @@ TEST(BallPlacementPlayFSMTest, test_kick_off_wall_transitions)
     world_ptr->updateGameState(game_state);
 
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<BallPlacementPlayFSM> fsm(
         BallPlacementPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
@@ -61,7 +66,8 @@ TEST(BallPlacementPlayFSMTest, test_kick_off_wall_transitions)
         BallPlacementPlayFSM::ControlParams{},
         PlayUpdate(
             world_ptr, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<BallPlacementPlayFSM::KickOffWallState>));
 
@@ -73,7 +79,8 @@ TEST(BallPlacementPlayFSMTest, test_kick_off_wall_transitions)
         BallPlacementPlayFSM::ControlParams{},
         PlayUpdate(
             world_ptr, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<BallPlacementPlayFSM::AlignPlacementState>));
 }
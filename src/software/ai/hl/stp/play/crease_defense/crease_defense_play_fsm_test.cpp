@@ -10,6 +10,8 @@ TEST(CreaseDefensePlayFSMTest, test_transitions)
 {
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<CreaseDefensePlayFSM> fsm(
         CreaseDefensePlayFSM{std::make_shared<TbotsProto::AiConfig>()});
     EXPECT_TRUE(fsm.is(boost::sml::state<CreaseDefensePlayFSM::DefenseState>));
@@ -20,7 +22,7 @@ TEST(CreaseDefensePlayFSMTest, test_transitions)
             .max_allowed_speed_mode = TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     // CreaseDefensePlayFSM always stays in the DefenseState
     EXPECT_TRUE(fsm.is(boost::sml::state<CreaseDefensePlayFSM::DefenseState>));
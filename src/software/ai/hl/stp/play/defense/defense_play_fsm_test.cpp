@@ -10,6 +10,8 @@ TEST(DefensePlayFSMTest, test_transitions)
 {
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<DefensePlayFSM> fsm(DefensePlayFSM{std::make_shared<TbotsProto::AiConfig>()});
     EXPECT_TRUE(fsm.is(boost::sml::state<DefensePlayFSM::DefenseState>));
 
@@ -22,7 +24,7 @@ TEST(DefensePlayFSMTest, test_transitions)
             .max_allowed_speed_mode = TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<DefensePlayFSM::DefenseState>));
 
@@ -37,7 +39,7 @@ TEST(DefensePlayFSMTest, test_transitions)
             .max_allowed_speed_mode = TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<DefensePlayFSM::AggressiveDefenseState>));
 }
@@ -10,6 +10,8 @@ TEST(ExamplePlayFSMTest, test_transitions)
 {
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<ExamplePlayFSM> fsm(ExamplePlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ExamplePlayFSM::MoveState>));
@@ -20,7 +22,8 @@ TEST(ExamplePlayFSMTest, test_transitions)
         ExamplePlayFSM::ControlParams{},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ExamplePlayFSM::MoveState>));
 }
@@ -42,7 +42,7 @@ bool FreeKickPlayFSM::setupDone(const Update& event)
 }
 
 void FreeKickPlayFSM::updateReceiverPositioningTactics(
-    const WorldPtr world, unsigned int num_tactics,
+    const WorldPtr world, const PassingParams& passing_params, unsigned int num_tactics,
     const std::vector<Point>& existing_receiver_positions,
     const std::optional<Point>& pass_origin_override)
 {
@@ -59,7 +59,8 @@ void FreeKickPlayFSM::updateReceiverPositioningTactics(
 
     std::vector<Point> best_receiving_positions =
         receiver_position_generator.getBestReceivingPositions(
-            *world, num_tactics, existing_receiver_positions, pass_origin_override);
+            *world, passing_params, num_tactics, existing_receiver_positions,
+            pass_origin_override);
     // Note that getBestReceivingPositions may return fewer positions than requested
     // if there are not enough robots, so we will need to check the size of the vector.
     for (unsigned int i = 0;
@@ -88,9 +89,9 @@ void FreeKickPlayFSM::setReceiverAndDefenderTactics(
 
     if (num_receivers > 0)
     {
-        updateReceiverPositioningTactics(event.common.world_ptr, num_receivers,
-                                         existing_receiver_positions,
-                                         pass_origin_override);
+        updateReceiverPositioningTactics(
+            event.common.world_ptr, event.common.ai_config_snapshot->getPassingParams(),
+            num_receivers, existing_receiver_positions, pass_origin_override);
         tactics_to_run[0].insert(tactics_to_run[0].end(),
                                  receiver_positioning_tactics.begin(),
                                  receiver_positioning_tactics.end());
@@ -110,7 +111,8 @@ void FreeKickPlayFSM::setReceiverAndDefenderTactics(
                 }
             },
             event.common.inter_play_communication,
-            event.common.set_inter_play_communication_fun));
+            event.common.set_inter_play_communication_fun,
+            event.common.ai_config_snapshot));
     }
 }
 
@@ -233,8 +235,9 @@ void FreeKickPlayFSM::lookForPass(const FreeKickPlayFSM::Update& event)
     {
         robots_to_ignore.push_back(robot_with_ball_opt.value().id());
     }
-    best_pass_and_score_so_far =
-        pass_generator.getBestPass(*event.common.world_ptr, robots_to_ignore);
+    best_pass_and_score_so_far = pass_generator.getBestPass(
+        *event.common.world_ptr, event.common.ai_config_snapshot->getPassingParams(),
+        event.common.ai_config_snapshot->getWorkerPool(), robots_to_ignore);
 
     event.common.set_tactics(tactics_to_run);
 }
@@ -275,7 +278,7 @@ bool FreeKickPlayFSM::shouldAbortPass(const Update& event)
     // Abort pass if the pass score has dropped significantly
     best_pass_and_score_so_far.rating =
         ratePass(*event.common.world_ptr, best_pass_and_score_so_far.pass,
-                 ai_config_ptr->passing_config());
+                 event.common.ai_config_snapshot->getPassingParams());
     double abs_min_pass_score =
         ai_config_ptr->shoot_or_pass_play_config().abs_min_pass_score();
     return best_pass_and_score_so_far.rating < abs_min_pass_score;
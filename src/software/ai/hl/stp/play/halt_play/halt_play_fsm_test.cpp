@@ -10,6 +10,8 @@ TEST(HaltPlayFSMTest, test_transitions)
 {
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<HaltPlayFSM> fsm(HaltPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
     EXPECT_TRUE(fsm.is(boost::sml::state<HaltPlayFSM::HaltState>));
@@ -20,7 +22,8 @@ TEST(HaltPlayFSMTest, test_transitions)
         HaltPlayFSM::ControlParams{},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<HaltPlayFSM::HaltState>));
 }
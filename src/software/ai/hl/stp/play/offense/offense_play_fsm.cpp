@@ -63,7 +63,8 @@ void OffensePlayFSM::setTactics(const Update& event, int num_shoot_or_pass,
                 }
             },
             event.common.inter_play_communication,
-            event.common.set_inter_play_communication_fun));
+            event.common.set_inter_play_communication_fun,
+            event.common.ai_config_snapshot));
     }
 
     defense_play->updateControlParams(TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
@@ -80,7 +81,8 @@ void OffensePlayFSM::setTactics(const Update& event, int num_shoot_or_pass,
                 }
             },
             event.common.inter_play_communication,
-            event.common.set_inter_play_communication_fun));
+            event.common.set_inter_play_communication_fun,
+            event.common.ai_config_snapshot));
     }
 
     event.common.set_tactics(tactics_to_return);
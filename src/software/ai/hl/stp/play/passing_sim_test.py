@@ -95,13 +95,17 @@ def setup_pass_and_robots(
     config.enemy_proximity_importance = 0.01
     config.enemy_interception_time_multiplier = 5
     config.max_receive_speed_m_per_s = 2.0
+    passing_params = tbots_cpp.PassingParams(config)
+    worker_pool = tbots_cpp.WorkerPool(config.pass_success_num_worker_threads)
     pass_generator = tbots_cpp.PassGenerator(config)
 
     # generate the best pass on the world 100 times
     # this improves the passes generated over time
     robots_to_ignore = [0]  # Avoid sampling passes around the attacker robot
     for index in range(0, 100):
-        best_pass_with_score = pass_generator.getBestPass(world, robots_to_ignore)
+        best_pass_with_score = pass_generator.getBestPass(
+            world, passing_params, worker_pool, robots_to_ignore
+        )
 
     best_pass = best_pass_with_score.pass_value
     kick_vec = best_pass.receiverPoint() - best_pass.passerPoint()
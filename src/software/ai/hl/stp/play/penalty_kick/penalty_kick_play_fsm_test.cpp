@@ -19,6 +19,8 @@ TEST(PenaltyKickPlayFSMTest, test_transitions)
 
     int num_tactics = 5;
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<PenaltyKickPlayFSM> fsm(
         PenaltyKickPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
@@ -28,7 +30,8 @@ TEST(PenaltyKickPlayFSMTest, test_transitions)
         PenaltyKickPlayFSM::ControlParams{},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickPlayFSM::SetupPositionState>));
 
@@ -39,7 +42,8 @@ TEST(PenaltyKickPlayFSMTest, test_transitions)
         PenaltyKickPlayFSM::ControlParams{},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickPlayFSM::PerformKickState>));
 
@@ -47,7 +51,8 @@ TEST(PenaltyKickPlayFSMTest, test_transitions)
         PenaltyKickPlayFSM::ControlParams{},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickPlayFSM::PerformKickState>));
 }
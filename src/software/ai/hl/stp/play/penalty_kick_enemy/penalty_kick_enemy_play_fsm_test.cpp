@@ -21,6 +21,8 @@ TEST(PenaltyKickEnemyPlayFSMTest, test_transitions)
     std::shared_ptr<GoalieTactic> goalie_tactic =
         std::make_shared<GoalieTactic>(std::make_shared<TbotsProto::AiConfig>());
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<PenaltyKickEnemyPlayFSM> fsm(
         PenaltyKickEnemyPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
 
@@ -30,7 +32,8 @@ TEST(PenaltyKickEnemyPlayFSMTest, test_transitions)
         PenaltyKickEnemyPlayFSM::ControlParams{goalie_tactic},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickEnemyPlayFSM::SetupPositionState>));
 
@@ -41,7 +44,8 @@ TEST(PenaltyKickEnemyPlayFSMTest, test_transitions)
         PenaltyKickEnemyPlayFSM::ControlParams{goalie_tactic},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickEnemyPlayFSM::DefendKickState>));
 
@@ -49,7 +53,8 @@ TEST(PenaltyKickEnemyPlayFSMTest, test_transitions)
         PenaltyKickEnemyPlayFSM::ControlParams{goalie_tactic},
         PlayUpdate(
             world, num_tactics, [](PriorityTacticVector new_tactics) {},
-            InterPlayCommunication{}, [](InterPlayCommunication comm) {})));
+            InterPlayCommunication{}, [](InterPlayCommunication comm) {},
+            ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<PenaltyKickEnemyPlayFSM::DefendKickState>));
 }
@@ -2,11 +2,10 @@
 
 #include <munkres/munkres.h>
 
-#include <Tracy.hpp>
-
 #include "proto/message_translation/tbots_protobuf.h"
 #include "software/ai/hl/stp/tactic/halt/halt_tactic.h"
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
+#include "software/ai/profiling/ai_tick_profiler.h"
 #include "software/logger/logger.h"
 
 
@@ -26,7 +25,8 @@ Play::Play(std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr,
 
 std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
     const WorldPtr& world_ptr, const InterPlayCommunication& inter_play_communication,
-    const SetInterPlayCommunicationCallback& set_inter_play_communication_fun)
+    const SetInterPlayCommunicationCallback& set_inter_play_communication_fun,
+    const std::shared_ptr<const AiConfigSnapshot>& ai_config_snapshot)
 {
     PriorityTacticVector priority_tactics;
     unsigned int num_tactics =
@@ -37,13 +37,14 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
     }
 
     {
-        ZoneNamedN(_tracy_tactics, "Play: Get Tactics from Play", true);
+        ScopedAiStageTimer play_update_timer(AiTickStage::PLAY_UPDATE);
 
         updateTactics(PlayUpdate(
             world_ptr, num_tactics,
             [&priority_tactics](PriorityTacticVector new_tactics)
             { priority_tactics = std::move(new_tactics); },
-            inter_play_communication, set_inter_play_communication_fun));
+            inter_play_communication, set_inter_play_communication_fun,
+            ai_config_snapshot));
     }
 
     auto primitives_to_run = std::make_unique<TbotsProto::PrimitiveSet>();
@@ -69,16 +70,25 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
 
             auto motion_constraints =
                 buildMotionConstraintSet(world_ptr->gameState(), *goalie_tactic);
-            auto primitives = goalie_tactic->get(world_ptr);
+            std::map<RobotId, std::shared_ptr<Primitive>> primitives;
+            {
+                ScopedAiStageTimer tactic_fsms_timer(AiTickStage::TACTIC_FSMS);
+                primitives = goalie_tactic->get(world_ptr);
+            }
             CHECK(primitives.contains(goalie_robot_id))
                 << "Couldn't find a primitive for robot id " << goalie_robot_id;
-            auto [traj_path, primitive_proto] =
-                primitives[goalie_robot_id]->generatePrimitiveProtoMessage(
+            auto [traj_path, primitive_proto] = [&]()
+            {
+                ScopedAiStageTimer motion_planning_timer(AiTickStage::MOTION_PLANNING);
+                return primitives[goalie_robot_id]->generatePrimitiveProtoMessage(
                     *world_ptr, motion_constraints, robot_trajectories, obstacle_factory);
+            }();
 
             if (traj_path.has_value())
             {
-                robot_trajectories.insert_or_assign(goalie_robot_id, traj_path.value());
+                robot_trajectories.insert_or_assign(
+                    goalie_robot_id,
+                    std::make_shared<const SampledTrajectoryPath>(traj_path.value()));
             }
             else
             {
@@ -113,7 +123,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
     // https://github.com/saebyn/munkres-cpp is the implementation of the Hungarian
     // algorithm that we use here
     {
-        ZoneNamedN(_tracy_tactic_assignment, "Play: Assign tactics to robots", true);
+        ScopedAiStageTimer tactic_assignment_timer(AiTickStage::TACTIC_ASSIGNMENT);
 
         // Assigns halt tactic to robots if there are no more tactics in the play
         priority_tactics.push_back(halt_tactics);
@@ -182,7 +192,10 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
 
     for (auto tactic : tactic_vector)
     {
-        primitive_sets.emplace_back(tactic->get(world_ptr));
+        {
+            ScopedAiStageTimer tactic_fsms_timer(AiTickStage::TACTIC_FSMS);
+            primitive_sets.emplace_back(tactic->get(world_ptr));
+        }
         CHECK(primitive_sets.back().size() == world_ptr->friendlyTeam().numRobots())
             << primitive_sets.back().size() << " primitives from "
             << objectTypeName(*tactic)
@@ -281,14 +294,20 @@ Play::assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
 
                 // Only generate primitive proto message for the final primitive to robot
                 // assignment
-                auto [traj_path, primitive_proto] =
-                    primitives[robot_id]->generatePrimitiveProtoMessage(
+                auto [traj_path, primitive_proto] = [&]()
+                {
+                    ScopedAiStageTimer motion_planning_timer(
+                        AiTickStage::MOTION_PLANNING);
+                    return primitives[robot_id]->generatePrimitiveProtoMessage(
                         *world_ptr, motion_constraints, robot_trajectories,
                         obstacle_factory);
+                }();
 
                 if (traj_path.has_value())
                 {
-                    robot_trajectories.insert_or_assign(robot_id, traj_path.value());
+                    robot_trajectories.insert_or_assign(
+                        robot_id,
+                        std::make_shared<const SampledTrajectoryPath>(traj_path.value()));
                 }
                 else
                 {
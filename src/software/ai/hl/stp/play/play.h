@@ -48,12 +48,14 @@ class Play
      * @param inter_play_communication The inter-play communication struct
      * @param set_inter_play_communication_fun The callback to set the inter-play
      * communication struct
+     * @param ai_config_snapshot The snapshot of the AI config for this tick
      *
      * @return the PrimitiveSet to execute
      */
     virtual std::unique_ptr<TbotsProto::PrimitiveSet> get(
         const WorldPtr& world_ptr, const InterPlayCommunication& inter_play_communication,
-        const SetInterPlayCommunicationCallback& set_inter_play_communication_fun);
+        const SetInterPlayCommunicationCallback& set_inter_play_communication_fun,
+        const std::shared_ptr<const AiConfigSnapshot>& ai_config_snapshot);
 
     /**
      * Get tactic to robot id assignment
@@ -82,8 +84,9 @@ class Play
 
     std::map<std::shared_ptr<const Tactic>, RobotId> tactic_robot_id_assignment;
 
-    // Cached robot trajectories
-    std::map<RobotId, TrajectoryPath> robot_trajectories;
+    // Cached robot trajectories, sampled once when they are planned so every robot
+    // planning after them can check for collisions against the samples
+    std::map<RobotId, SampledTrajectoryPathPtr> robot_trajectories;
 
     // List of all obstacles in the world at the current iteration
     // and all robot paths. Used for visualization
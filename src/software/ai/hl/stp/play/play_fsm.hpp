@@ -1,5 +1,6 @@
 #pragma once
 
+#include "software/ai/config/ai_config_snapshot.h"
 #include "software/ai/hl/stp/tactic/tactic_base.hpp"
 #include "software/ai/passing/pass_with_rating.h"
 #include "software/util/sml_fsm/sml_fsm.h"
@@ -26,12 +27,14 @@ struct PlayUpdate
     PlayUpdate(const WorldPtr& world_ptr, unsigned int num_tactics,
                const SetTacticsCallback& set_tactics_fun,
                const InterPlayCommunication& inter_play_communication,
-               const SetInterPlayCommunicationCallback& set_inter_play_communication_fun)
+               const SetInterPlayCommunicationCallback& set_inter_play_communication_fun,
+               const std::shared_ptr<const AiConfigSnapshot>& ai_config_snapshot)
         : world_ptr(world_ptr),
           num_tactics(num_tactics),
           set_tactics(set_tactics_fun),
           inter_play_communication(inter_play_communication),
-          set_inter_play_communication_fun(set_inter_play_communication_fun)
+          set_inter_play_communication_fun(set_inter_play_communication_fun),
+          ai_config_snapshot(ai_config_snapshot)
     {
     }
     // updated world
@@ -44,6 +47,8 @@ struct PlayUpdate
     InterPlayCommunication inter_play_communication;
     // callback to return inter-play communication
     SetInterPlayCommunicationCallback set_inter_play_communication_fun;
+    // snapshot of the AI config for this tick
+    std::shared_ptr<const AiConfigSnapshot> ai_config_snapshot;
 };
 
 /**
@@ -23,7 +23,7 @@ ShootOrPassPlayFSM::ShootOrPassPlayFSM(
 }
 
 void ShootOrPassPlayFSM::updateOffensivePositioningTactics(
-    const WorldPtr world, unsigned int num_tactics,
+    const WorldPtr world, const PassingParams& passing_params, unsigned int num_tactics,
     const std::vector<Point>& existing_receiver_positions,
     const std::optional<Point>& pass_origin_override)
 {
@@ -40,7 +40,8 @@ void ShootOrPassPlayFSM::updateOffensivePositioningTactics(
 
     std::vector<Point> best_receiving_positions =
         receiver_position_generator.getBestReceivingPositions(
-            *world, num_tactics, existing_receiver_positions, pass_origin_override);
+            *world, passing_params, num_tactics, existing_receiver_positions,
+            pass_origin_override);
     // Note that getBestReceivingPositions may return fewer positions than requested
     // if there are not enough robots, so we will need to check the size of the vector.
     for (unsigned int i = 0;
@@ -59,6 +60,8 @@ void ShootOrPassPlayFSM::updateOffensivePositioningTactics(
 void ShootOrPassPlayFSM::lookForPass(const Update& event)
 {
     PriorityTacticVector ret_tactics = {{attacker_tactic}, {}};
+    const PassingParams& passing_params =
+        event.common.ai_config_snapshot->getPassingParams();
 
     // only look for pass if there are more than 1 robots
     if (event.common.num_tactics > 1)
@@ -78,14 +81,15 @@ void ShootOrPassPlayFSM::lookForPass(const Update& event)
         {
             robots_to_ignore.push_back(robot_with_ball_opt.value().id());
         }
-        best_pass_and_score_so_far =
-            pass_generator.getBestPass(*event.common.world_ptr, robots_to_ignore);
+        best_pass_and_score_so_far = pass_generator.getBestPass(
+            *event.common.world_ptr, passing_params,
+            event.common.ai_config_snapshot->getWorkerPool(), robots_to_ignore);
 
         // update the best pass in the attacker tactic
         attacker_tactic->updateControlParams(best_pass_and_score_so_far.pass, false);
 
         // add remaining tactics based on ranked zones
-        updateOffensivePositioningTactics(event.common.world_ptr,
+        updateOffensivePositioningTactics(event.common.world_ptr, passing_params,
                                           event.common.num_tactics - 1);
         ret_tactics[1].insert(ret_tactics[1].end(), offensive_positioning_tactics.begin(),
                               offensive_positioning_tactics.end());
@@ -128,6 +132,8 @@ void ShootOrPassPlayFSM::takePass(const Update& event)
 
     std::vector<Point> existing_receiver_positions = {
         best_pass_and_score_so_far.pass.receiverPoint()};
+    const PassingParams& passing_params =
+        event.common.ai_config_snapshot->getPassingParams();
 
     if (!attacker_tactic->done())
     {
@@ -135,7 +141,7 @@ void ShootOrPassPlayFSM::takePass(const Update& event)
 
         if (event.common.num_tactics > 2)
         {
-            updateOffensivePositioningTactics(event.common.world_ptr,
+            updateOffensivePositioningTactics(event.common.world_ptr, passing_params,
                                               event.common.num_tactics - 2,
                                               existing_receiver_positions);
             ret_tactics[1].insert(ret_tactics[1].end(),
@@ -151,8 +157,8 @@ void ShootOrPassPlayFSM::takePass(const Update& event)
         if (event.common.num_tactics > 1)
         {
             updateOffensivePositioningTactics(
-                event.common.world_ptr, event.common.num_tactics - 1,
-                existing_receiver_positions,
+                event.common.world_ptr, passing_params,
+                event.common.num_tactics - 1, existing_receiver_positions,
                 best_pass_and_score_so_far.pass.receiverPoint());
             ret_tactics[1].insert(ret_tactics[1].end(),
                                   offensive_positioning_tactics.begin(),
@@ -179,7 +185,7 @@ bool ShootOrPassPlayFSM::shouldAbortPass(const Update& event)
     {
         best_pass_and_score_so_far.rating =
             ratePass(*event.common.world_ptr, best_pass_and_score_so_far.pass,
-                     ai_config_ptr->passing_config());
+                     event.common.ai_config_snapshot->getPassingParams());
         double abs_min_pass_score =
             ai_config_ptr->shoot_or_pass_play_config().abs_min_pass_score();
         if (best_pass_and_score_so_far.rating < abs_min_pass_score)
@@ -40,6 +40,7 @@ struct ShootOrPassPlayFSM : PlayFSM<ShootOrPassPlayFSM>
      * Updates the offensive positioning tactics
      *
      * @param world the world
+     * @param passing_params the parameters to rate receiving positions with
      * @param num_tactics the number of tactics to assign
      * @param existing_receiver_positions A set of positions of existing receiver
      * positions that should be taken into account when assigning additional offensive
@@ -48,7 +49,8 @@ struct ShootOrPassPlayFSM : PlayFSM<ShootOrPassPlayFSM>
      * overridden to
      */
     void updateOffensivePositioningTactics(
-        const WorldPtr world, unsigned int num_tactics,
+        const WorldPtr world, const PassingParams& passing_params,
+        unsigned int num_tactics,
         const std::vector<Point>& existing_receiver_positions = {},
         const std::optional<Point>& pass_origin_override      = std::nullopt);
 
@@ -13,6 +13,8 @@ TEST(ShootOrPassPlayFSMTest, test_transitions)
     ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(1, 0), Point(2, 0)},
                                           Timestamp::fromSeconds(0));
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<ShootOrPassPlayFSM> fsm(
         ShootOrPassPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::StartState>));
@@ -21,7 +23,7 @@ TEST(ShootOrPassPlayFSMTest, test_transitions)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::AttemptShotState>));
 }
@@ -35,6 +37,8 @@ TEST(ShootOrPassPlayFSMTest, test_abort_pass_guard)
         Timestamp::fromSeconds(0));
     world->updateRefereeCommand(RefereeCommand::FORCE_START);
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<ShootOrPassPlayFSM> fsm(
         ShootOrPassPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::StartState>));
@@ -43,7 +47,7 @@ TEST(ShootOrPassPlayFSMTest, test_abort_pass_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 4, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::AttemptShotState>));
 
     world->updateBall(Ball(Point(-1, 0), Vector(0, 0), Timestamp::fromSeconds(1)));
@@ -52,7 +56,7 @@ TEST(ShootOrPassPlayFSMTest, test_abort_pass_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 2, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     Robot friendly_robot_1(1, Point(3, -1), Vector(0, 0), Angle::zero(),
                            AngularVelocity::zero(), Timestamp::fromSeconds(2));
@@ -66,20 +70,20 @@ TEST(ShootOrPassPlayFSMTest, test_abort_pass_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 2, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     // 3 process events needed so that fsm finds a pass between the 2 robots on the field.
     fsm.process_event(ShootOrPassPlayFSM::Update(
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 2, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     fsm.process_event(ShootOrPassPlayFSM::Update(
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 2, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::TakePassState>));
 
@@ -91,7 +95,7 @@ TEST(ShootOrPassPlayFSMTest, test_abort_pass_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 2, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::AttemptShotState>));
 }
@@ -104,6 +108,8 @@ TEST(ShootOrPassPlayFSMTest, test_took_shot_guard)
     ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(1, 0), Point(2, 0)},
                                           Timestamp::fromSeconds(0));
 
+    auto ai_config_snapshot =
+        std::make_shared<const AiConfigSnapshot>(TbotsProto::AiConfig());
     FSM<ShootOrPassPlayFSM> fsm(
         ShootOrPassPlayFSM{std::make_shared<TbotsProto::AiConfig>()});
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::StartState>));
@@ -112,7 +118,7 @@ TEST(ShootOrPassPlayFSMTest, test_took_shot_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     EXPECT_TRUE(fsm.is(boost::sml::state<ShootOrPassPlayFSM::AttemptShotState>));
 
@@ -128,7 +134,7 @@ TEST(ShootOrPassPlayFSMTest, test_took_shot_guard)
         ShootOrPassPlayFSM::ControlParams{},
         PlayUpdate(
             world, 3, [](PriorityTacticVector new_tactics) {}, InterPlayCommunication{},
-            [](InterPlayCommunication comm) {})));
+            [](InterPlayCommunication comm) {}, ai_config_snapshot)));
 
     // friendly robot is in front of goal, no other robots to pass to,
     // he takes the shot and triggers the tookShot guard, fsm goes into termination state
@@ -55,7 +55,7 @@ MovePrimitive::MovePrimitive(
 std::pair<std::optional<TrajectoryPath>, std::unique_ptr<TbotsProto::Primitive>>
 MovePrimitive::generatePrimitiveProtoMessage(
     const World& world, const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-    const std::map<RobotId, TrajectoryPath>& robot_trajectories,
+    const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
     const RobotNavigationObstacleFactory& obstacle_factory)
 {
     // Generate obstacle avoiding trajectory
@@ -111,7 +111,7 @@ MovePrimitive::generatePrimitiveProtoMessage(
     if (prev_trajectory_it != robot_trajectories.end())
     {
         const auto& prev_trajectory_path_nodes =
-            prev_trajectory_it->second.getTrajectoryPathNodes();
+            prev_trajectory_it->second->getTrajectoryPath().getTrajectoryPathNodes();
         if (!prev_trajectory_path_nodes.empty())
         {
             prev_sub_destination =
@@ -189,7 +189,7 @@ MovePrimitive::generatePrimitiveProtoMessage(
 
 void MovePrimitive::updateObstacles(
     const World& world, const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-    const std::map<RobotId, TrajectoryPath>& robot_trajectories,
+    const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
     const RobotNavigationObstacleFactory& obstacle_factory)
 {
     // Separately store the non-robot + non-ball obstacles
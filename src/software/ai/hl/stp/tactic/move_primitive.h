@@ -50,7 +50,7 @@ class MovePrimitive : public Primitive
     generatePrimitiveProtoMessage(
         const World& world,
         const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-        const std::map<RobotId, TrajectoryPath>& robot_trajectories,
+        const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
         const RobotNavigationObstacleFactory& obstacle_factory) override;
 
     /**
@@ -74,10 +74,11 @@ class MovePrimitive : public Primitive
      * @param robot_trajectories A map of the friendly robots' known trajectories
      * @param obstacle_factory Obstacle factory to use
      */
-    void updateObstacles(const World& world,
-                         const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-                         const std::map<RobotId, TrajectoryPath>& robot_trajectories,
-                         const RobotNavigationObstacleFactory& obstacle_factory);
+    void updateObstacles(
+        const World& world,
+        const std::set<TbotsProto::MotionConstraint>& motion_constraints,
+        const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
+        const RobotNavigationObstacleFactory& obstacle_factory);
 
     Robot robot;
     Point destination;
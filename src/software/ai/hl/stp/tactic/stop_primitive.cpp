@@ -3,7 +3,7 @@
 std::pair<std::optional<TrajectoryPath>, std::unique_ptr<TbotsProto::Primitive>>
 StopPrimitive::generatePrimitiveProtoMessage(
     const World& world, const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-    const std::map<RobotId, TrajectoryPath>& robot_trajectories,
+    const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
     const RobotNavigationObstacleFactory& obstacle_factory)
 {
     auto stop_primitive_msg = std::make_unique<TbotsProto::Primitive>();
@@ -24,7 +24,7 @@ class StopPrimitive : public Primitive
     generatePrimitiveProtoMessage(
         const World& world,
         const std::set<TbotsProto::MotionConstraint>& motion_constraints,
-        const std::map<RobotId, TrajectoryPath>& robot_trajectories,
+        const std::map<RobotId, SampledTrajectoryPathPtr>& robot_trajectories,
         const RobotNavigationObstacleFactory& obstacle_factory) override;
 
     /**
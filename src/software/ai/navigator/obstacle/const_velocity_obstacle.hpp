@@ -53,7 +53,7 @@ ConstVelocityObstacle<GEOM_TYPE>::ConstVelocityObstacle(const GEOM_TYPE& geom,
 template <typename GEOM_TYPE>
 bool ConstVelocityObstacle<GEOM_TYPE>::contains(const Point& p, const double t_sec) const
 {
-    return ::contains(this->geom_,
+    return ::contains(this->queryShape(),
                       p - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
 
@@ -61,7 +61,7 @@ template <typename GEOM_TYPE>
 double ConstVelocityObstacle<GEOM_TYPE>::distance(const Point& p,
                                                   const double t_sec) const
 {
-    return ::distance(this->geom_,
+    return ::distance(this->queryShape(),
                       p - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
 
@@ -69,7 +69,7 @@ template <typename GEOM_TYPE>
 double ConstVelocityObstacle<GEOM_TYPE>::signedDistance(const Point& p,
                                                         const double t_sec) const
 {
-    return ::signedDistance(this->geom_,
+    return ::signedDistance(this->queryShape(),
                             p - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
 
@@ -77,6 +77,6 @@ template <typename GEOM_TYPE>
 bool ConstVelocityObstacle<GEOM_TYPE>::intersects(const Segment& segment,
                                                   const double t_sec) const
 {
-    return ::intersects(this->geom_,
+    return ::intersects(this->queryShape(),
                         segment - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
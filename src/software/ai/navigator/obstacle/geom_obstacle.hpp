@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <variant>
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
 #include "software/geom/algorithms/closest_point.h"
@@ -8,11 +10,130 @@
 #include "software/geom/algorithms/distance.h"
 #include "software/geom/algorithms/intersects.h"
 #include "software/geom/algorithms/rasterize.h"
+#include "software/geom/small_polygon.hpp"
+#include "software/geom/value_shapes.h"
+
+// The most points a polygon obstacle stores inline, which covers every polygon that
+// the RobotNavigationObstacleFactory builds from the field
+static constexpr std::size_t MAX_SMALL_POLYGON_OBSTACLE_POINTS = 16;
+
+using SmallObstaclePolygon = SmallPolygon<MAX_SMALL_POLYGON_OBSTACLE_POINTS>;
+
+/**
+ * The shape of a polygon obstacle. Polygons with up to
+ * MAX_SMALL_POLYGON_OBSTACLE_POINTS points are stored inline. Larger ones, such as
+ * virtual obstacles drawn by hand, are kept as a Polygon.
+ */
+using PolygonObstacleShape = std::variant<SmallObstaclePolygon, Polygon>;
+
+/**
+ * The contains, distance, signedDistance and intersects queries of a polygon obstacle
+ * shape, which forward to the queries of the polygon it holds
+ */
+inline bool contains(const PolygonObstacleShape& container, const Point& contained)
+{
+    return std::visit([&](const auto& polygon) { return ::contains(polygon, contained); },
+                      container);
+}
+
+inline double distance(const PolygonObstacleShape& first, const Point& second)
+{
+    return std::visit([&](const auto& polygon) { return ::distance(polygon, second); },
+                      first);
+}
+
+inline double signedDistance(const PolygonObstacleShape& first, const Point& second)
+{
+    return std::visit([&](const auto& polygon)
+                      { return ::signedDistance(polygon, second); },
+                      first);
+}
+
+inline bool intersects(const PolygonObstacleShape& first, const Segment& second)
+{
+    return std::visit([&](const auto& polygon) { return ::intersects(polygon, second); },
+                      first);
+}
+
+/**
+ * The allocation-free value type (see value_shapes.h) that a GeomObstacle stores its
+ * GEOM_TYPE as, and answers its contains, distance and intersects queries with. The
+ * GEOM_TYPE is only built again for the queries that need it, such as creating the
+ * obstacle proto.
+ */
+template <typename GEOM_TYPE>
+struct ObstacleValueShape;
+
+template <>
+struct ObstacleValueShape<Rectangle>
+{
+    using type = Aabb;
+    static type create(const Rectangle& rectangle)
+    {
+        return Aabb::fromRectangle(rectangle);
+    }
+    static Rectangle toGeom(const type& box)
+    {
+        return box.toRectangle();
+    }
+};
+
+template <>
+struct ObstacleValueShape<Circle>
+{
+    using type = CircleShape;
+    static type create(const Circle& circle)
+    {
+        return CircleShape::fromCircle(circle);
+    }
+    static Circle toGeom(const type& circle)
+    {
+        return circle.toCircle();
+    }
+};
+
+template <>
+struct ObstacleValueShape<Stadium>
+{
+    using type = Capsule;
+    static type create(const Stadium& stadium)
+    {
+        return Capsule::fromStadium(stadium);
+    }
+    static Stadium toGeom(const type& capsule)
+    {
+        return capsule.toStadium();
+    }
+};
+
+template <>
+struct ObstacleValueShape<Polygon>
+{
+    using type = PolygonObstacleShape;
+    static type create(const Polygon& polygon)
+    {
+        if (polygon.getPoints().size() <= SmallObstaclePolygon::capacity())
+        {
+            return SmallObstaclePolygon::fromPolygon(polygon);
+        }
+        return polygon;
+    }
+    static Polygon toGeom(const type& shape)
+    {
+        if (const Polygon* polygon = std::get_if<Polygon>(&shape))
+        {
+            return *polygon;
+        }
+        return std::get<SmallObstaclePolygon>(shape).toPolygon();
+    }
+};
 
 template <typename GEOM_TYPE>
 class GeomObstacle : public Obstacle
 {
    public:
+    using ValueShape = typename ObstacleValueShape<GEOM_TYPE>::type;
+
     GeomObstacle() = delete;
 
     /**
@@ -22,6 +143,14 @@ class GeomObstacle : public Obstacle
      */
     explicit GeomObstacle(const GEOM_TYPE& geom);
 
+    /**
+     * Construct a static GeomObstacle from the value type of GEOM_TYPE, without
+     * building the GEOM_TYPE
+     *
+     * @param shape The value type to make obstacle with
+     */
+    explicit GeomObstacle(const ValueShape& shape);
+
     bool contains(const Point& p, const double t_sec = 0) const override;
     double distance(const Point& p, const double t_sec = 0) const override;
     double signedDistance(const Point& p, const double t_sec = 0) const override;
@@ -35,83 +164,104 @@ class GeomObstacle : public Obstacle
     std::size_t hash() const override;
 
     /**
-     * Gets the underlying GEOM_TYPE
+     * Gets the underlying GEOM_TYPE, which is built from the value type on every call
      *
      * @return geom type
      */
     const GEOM_TYPE getGeom(void) const;
 
    protected:
-    const GEOM_TYPE geom_;
+    /**
+     * Gets the shape to answer point and segment queries with
+     *
+     * @return the value type of GEOM_TYPE
+     */
+    const ValueShape& queryShape() const;
+
+   private:
+    const ValueShape value_shape_;
 };
 
 
 template <typename GEOM_TYPE>
-GeomObstacle<GEOM_TYPE>::GeomObstacle(const GEOM_TYPE& geom) : geom_(geom)
+GeomObstacle<GEOM_TYPE>::GeomObstacle(const GEOM_TYPE& geom)
+    : value_shape_(ObstacleValueShape<GEOM_TYPE>::create(geom))
+{
+}
+
+template <typename GEOM_TYPE>
+GeomObstacle<GEOM_TYPE>::GeomObstacle(const ValueShape& shape) : value_shape_(shape)
+{
+}
+
+template <typename GEOM_TYPE>
+const typename GeomObstacle<GEOM_TYPE>::ValueShape& GeomObstacle<GEOM_TYPE>::queryShape()
+    const
 {
+    return value_shape_;
 }
 
 template <typename GEOM_TYPE>
 bool GeomObstacle<GEOM_TYPE>::contains(const Point& p, const double t_sec) const
 {
-    return ::contains(geom_, p);
+    return ::contains(queryShape(), p);
 }
 
 template <typename GEOM_TYPE>
 double GeomObstacle<GEOM_TYPE>::distance(const Point& p, const double t_sec) const
 {
-    return ::distance(geom_, p);
+    return ::distance(queryShape(), p);
 }
 
 template <typename GEOM_TYPE>
 double GeomObstacle<GEOM_TYPE>::signedDistance(const Point& p, const double t_sec) const
 {
-    return ::signedDistance(geom_, p);
+    return ::signedDistance(queryShape(), p);
 }
 
 template <typename GEOM_TYPE>
 bool GeomObstacle<GEOM_TYPE>::intersects(const Segment& segment, const double t_sec) const
 {
-    return ::intersects(geom_, segment);
+    return ::intersects(queryShape(), segment);
 }
 
 template <typename GEOM_TYPE>
 Point GeomObstacle<GEOM_TYPE>::closestPoint(const Point& p) const
 {
-    return ::closestPoint(geom_, p);
+    return ::closestPoint(getGeom(), p);
 }
 
 template <typename GEOM_TYPE>
 std::vector<Point> GeomObstacle<GEOM_TYPE>::rasterize(const double resolution_size) const
 {
-    return ::rasterize(geom_, resolution_size);
+    return ::rasterize(getGeom(), resolution_size);
 }
 
 template <typename GEOM_TYPE>
 TbotsProto::Obstacle GeomObstacle<GEOM_TYPE>::createObstacleProto() const
 {
-    return ::createObstacleProto(geom_);
+    return ::createObstacleProto(getGeom());
 }
 
 template <typename GEOM_TYPE>
 Rectangle GeomObstacle<GEOM_TYPE>::axisAlignedBoundingBox(
     const double inflation_radius) const
 {
-    return ::axisAlignedBoundingBox(geom_, inflation_radius);
+    return ::axisAlignedBoundingBox(getGeom(), inflation_radius);
 }
 
 template <typename GEOM_TYPE>
 std::string GeomObstacle<GEOM_TYPE>::toString(void) const
 {
     std::ostringstream ss;
-    ss << "Obstacle with shape " << geom_;
+    ss << "Obstacle with shape " << getGeom();
     return ss.str();
 }
 
 template <typename GEOM_TYPE>
 const GEOM_TYPE GeomObstacle<GEOM_TYPE>::getGeom(void) const
 {
-    return geom_;
+    return ObstacleValueShape<GEOM_TYPE>::toGeom(value_shape_);
 }
 
 template <typename GEOM_TYPE>
@@ -123,5 +273,5 @@ void GeomObstacle<GEOM_TYPE>::accept(ObstacleVisitor& visitor) const
 template <typename GEOM_TYPE>
 std::size_t GeomObstacle<GEOM_TYPE>::hash() const
 {
-    return std::hash<GEOM_TYPE>{}(geom_);
+    return std::hash<GEOM_TYPE>{}(getGeom());
 }
@@ -8,6 +8,7 @@
 #include "software/geom/point.h"
 #include "software/geom/polygon.h"
 #include "software/geom/rectangle.h"
+#include "software/util/allocation_counter/allocation_counter.h"
 
 TEST(NavigatorObstacleTest, create_from_rectangle)
 {
@@ -228,3 +229,43 @@ TEST(NavigatorObstacleTest, stadium_obstacle_intersects)
     EXPECT_TRUE(obstacle->intersects(intersecting_segment));
     EXPECT_FALSE(obstacle->intersects(non_intersecting_segment));
 }
+
+TEST(NavigatorObstacleTest, value_shape_obstacles_do_not_allocate)
+{
+    const SmallObstaclePolygon polygon(
+        {Point(0, 0), Point(2, 0), Point(2, 1), Point(0, 2)});
+
+    ScopedAllocationCounter allocation_counter;
+    GeomObstacle<Rectangle> rectangle_obstacle(Aabb{-1, -1, 1, 1}.expand(0.1));
+    GeomObstacle<Polygon> polygon_obstacle(PolygonObstacleShape(polygon.expand(0.1)));
+    bool rectangle_contains = rectangle_obstacle.contains(Point(1.05, 0));
+    bool polygon_contains   = polygon_obstacle.contains(Point(1, 1));
+    bool polygon_intersects =
+        polygon_obstacle.intersects(Segment(Point(-1, 3), Point(3, -1)));
+    std::size_t num_allocations = allocation_counter.getNumAllocations();
+
+    EXPECT_EQ(num_allocations, 0);
+    EXPECT_TRUE(rectangle_contains);
+    EXPECT_TRUE(polygon_contains);
+    EXPECT_TRUE(polygon_intersects);
+    EXPECT_EQ(rectangle_obstacle.getGeom(),
+              Rectangle(Point(-1.1, -1.1), Point(1.1, 1.1)));
+    EXPECT_EQ(polygon_obstacle.getGeom(), polygon.toPolygon().expand(0.1));
+}
+
+TEST(NavigatorObstacleTest, large_polygon_obstacle)
+{
+    // More points than a polygon obstacle stores inline
+    std::vector<Point> points;
+    for (int i = 0; i < 20; i++)
+    {
+        points.push_back(Point(0, 0) + Vector::createFromAngle(Angle::full() * i / 20));
+    }
+    const Polygon polygon(points);
+    GeomObstacle<Polygon> polygon_obstacle(polygon);
+
+    EXPECT_EQ(polygon_obstacle.getGeom(), polygon);
+    EXPECT_TRUE(polygon_obstacle.contains(Point(0.5, 0.5)));
+    EXPECT_FALSE(polygon_obstacle.contains(Point(1, 1)));
+    EXPECT_NEAR(polygon_obstacle.distance(Point(3, 0)), 2, 1e-9);
+}
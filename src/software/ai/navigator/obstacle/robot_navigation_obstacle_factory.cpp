@@ -1,6 +1,7 @@
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
+#include "software/ai/navigator/obstacle/sampled_trajectory_obstacle.hpp"
 #include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
 
 RobotNavigationObstacleFactory::RobotNavigationObstacleFactory(
@@ -49,8 +50,8 @@ RobotNavigationObstacleFactory::createObstaclesFromMotionConstraint(
             break;
         case TbotsProto::MotionConstraint::ENEMY_HALF_WITHOUT_CENTRE_CIRCLE:
         {
-            double radius                        = field.centerCircleRadius();
-            Polygon centre_circle_and_enemy_half = Polygon(
+            double radius = field.centerCircleRadius();
+            SmallObstaclePolygon centre_circle_and_enemy_half(
                 {Point(-robot_radius_expansion_amount,
                        field.fieldBoundary().yLength() / 2),
                  Point(-robot_radius_expansion_amount, radius), Point(0, radius),
@@ -68,21 +69,21 @@ RobotNavigationObstacleFactory::createObstaclesFromMotionConstraint(
         }
         case TbotsProto::MotionConstraint::AVOID_FIELD_BOUNDARY_ZONE:
         {
-            Rectangle field_walls    = field.fieldBoundary();
-            Rectangle playable_field = field.fieldLines();
+            const Rectangle& field_walls    = field.fieldBoundary();
+            const Rectangle& playable_field = field.fieldLines();
             // put each boundary zone as an obstacle
-            Rectangle upper_boundary =
-                Rectangle(field_walls.posXNegYCorner(),
-                          {playable_field.xMax(), field_walls.yMax()});
-            Rectangle left_boundary =
-                Rectangle(field_walls.posXNegYCorner(),
-                          {field_walls.xMin(), playable_field.yMin()});
-            Rectangle right_boundary =
-                Rectangle({field_walls.xMax(), playable_field.yMax()},
-                          field_walls.negXPosYCorner());
-            Rectangle lower_boundary =
-                Rectangle({playable_field.xMin(), field_walls.yMin()},
-                          field_walls.negXPosYCorner());
+            Aabb upper_boundary =
+                Aabb::fromCorners(field_walls.posXNegYCorner(),
+                                  {playable_field.xMax(), field_walls.yMax()});
+            Aabb left_boundary =
+                Aabb::fromCorners(field_walls.posXNegYCorner(),
+                                  {field_walls.xMin(), playable_field.yMin()});
+            Aabb right_boundary =
+                Aabb::fromCorners({field_walls.xMax(), playable_field.yMax()},
+                                  field_walls.negXPosYCorner());
+            Aabb lower_boundary =
+                Aabb::fromCorners({playable_field.xMin(), field_walls.yMin()},
+                                  field_walls.negXPosYCorner());
             obstacles.push_back(createFromShape(upper_boundary));
             obstacles.push_back(createFromShape(left_boundary));
             obstacles.push_back(createFromShape(right_boundary));
@@ -233,7 +234,7 @@ ObstaclePtr RobotNavigationObstacleFactory::createStaticObstacleFromRobotPositio
 }
 
 ObstaclePtr RobotNavigationObstacleFactory::createFromMovingRobot(
-    const Robot& robot, const TrajectoryPath& traj) const
+    const Robot& robot, const SampledTrajectoryPathPtr& traj) const
 {
     return createCircleWithTrajectory(Circle(robot.position(), ROBOT_MAX_RADIUS_METERS),
                                       traj);
@@ -246,6 +247,13 @@ ObstaclePtr RobotNavigationObstacleFactory::createCircleWithTrajectory(
         Circle(circle.origin(), circle.radius() + robot_radius_expansion_amount), traj);
 }
 
+ObstaclePtr RobotNavigationObstacleFactory::createCircleWithTrajectory(
+    const Circle& circle, const SampledTrajectoryPathPtr& traj) const
+{
+    return std::make_shared<SampledTrajectoryObstacle<Circle>>(
+        Circle(circle.origin(), circle.radius() + robot_radius_expansion_amount), traj);
+}
+
 ObstaclePtr RobotNavigationObstacleFactory::createCircleWithConstVelocity(
     const Circle& circle, const Vector& velocity) const
 {
@@ -262,15 +270,26 @@ ObstaclePtr RobotNavigationObstacleFactory::createFromShape(const Circle& circle
 
 ObstaclePtr RobotNavigationObstacleFactory::createFromShape(const Polygon& polygon) const
 {
+    if (polygon.getPoints().size() <= SmallObstaclePolygon::capacity())
+    {
+        return std::make_shared<GeomObstacle<Polygon>>(PolygonObstacleShape(
+            SmallObstaclePolygon::fromPolygon(polygon).expand(
+                robot_radius_expansion_amount)));
+    }
     return std::make_shared<GeomObstacle<Polygon>>(
         polygon.expand(robot_radius_expansion_amount));
 }
 
 ObstaclePtr RobotNavigationObstacleFactory::createFromShape(
     const Rectangle& rectangle) const
+{
+    return createFromShape(Aabb::fromRectangle(rectangle));
+}
+
+ObstaclePtr RobotNavigationObstacleFactory::createFromShape(const Aabb& box) const
 {
     return std::make_shared<GeomObstacle<Rectangle>>(
-        rectangle.expand(robot_radius_expansion_amount));
+        box.expand(robot_radius_expansion_amount));
 }
 
 ObstaclePtr RobotNavigationObstacleFactory::createFromShape(const Stadium& stadium) const
@@ -298,8 +317,7 @@ ObstaclePtr RobotNavigationObstacleFactory::createFromFieldRectangle(
     yMax =
         (yMax == field_lines.yMax()) ? field_boundary.yMax() : (yMax + expansion_amount);
 
-    return std::make_shared<GeomObstacle<Rectangle>>(
-        Rectangle(Point(xMin, yMin), Point(xMax, yMax)));
+    return std::make_shared<GeomObstacle<Rectangle>>(Aabb{xMin, yMin, xMax, yMax});
 }
 
 ObstaclePtr RobotNavigationObstacleFactory::createFromBallPlacement(
@@ -4,9 +4,11 @@
 #include "proto/primitive.pb.h"
 #include "shared/constants.h"
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/trajectory/sampled_trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/geom/point.h"
 #include "software/geom/polygon.h"
+#include "software/geom/value_shapes.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
 
@@ -79,12 +81,12 @@ class RobotNavigationObstacleFactory
      * Create dynamic circle obstacle around robot with additional radius scaling
      *
      * @param robot robot to create the obstacle for
-     * @param traj Trajectory which the obstacle is following
+     * @param traj Sampled trajectory which the obstacle is following
      *
      * @return moving obstacle around the robot
      */
     ObstaclePtr createFromMovingRobot(const Robot& robot,
-                                      const TrajectoryPath& traj) const;
+                                      const SampledTrajectoryPathPtr& traj) const;
 
     /**
      * Create circle obstacle around ball
@@ -108,6 +110,7 @@ class RobotNavigationObstacleFactory
     ObstaclePtr createFromShape(const Polygon& polygon) const;
     ObstaclePtr createFromShape(const Rectangle& rectangle) const;
     ObstaclePtr createFromShape(const Stadium& stadium) const;
+    ObstaclePtr createFromShape(const Aabb& box) const;
 
     /**
      * Generate a trajectory based circular obstacle with additional radius scaling
@@ -118,6 +121,8 @@ class RobotNavigationObstacleFactory
      */
     ObstaclePtr createCircleWithTrajectory(const Circle& circle,
                                            const TrajectoryPath& traj) const;
+    ObstaclePtr createCircleWithTrajectory(const Circle& circle,
+                                           const SampledTrajectoryPathPtr& traj) const;
 
     /**
      * Generate a const velocity based circular obstacle with additional radius scaling
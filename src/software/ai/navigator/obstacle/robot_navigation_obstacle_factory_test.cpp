@@ -6,6 +6,7 @@
 
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/geom_obstacle.hpp"
+#include "software/ai/navigator/obstacle/sampled_trajectory_obstacle.hpp"
 #include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
 #include "software/geom/circle.h"
 #include "software/geom/point.h"
@@ -224,12 +225,13 @@ TEST_F(RobotNavigationObstacleFactoryTest, trajectory_robot_obstacle)
                                   origin, end, velocity, KinematicConstraints(1, 1, 1)),
                               BangBangTrajectory2D::generator);
 
-    ObstaclePtr obstacle =
-        robot_navigation_obstacle_factory.createFromMovingRobot(robot, trajectory);
+    ObstaclePtr obstacle = robot_navigation_obstacle_factory.createFromMovingRobot(
+        robot, std::make_shared<const SampledTrajectoryPath>(trajectory));
 
     try
     {
-        auto circle_obstacle = dynamic_cast<TrajectoryObstacle<Circle>&>(*obstacle);
+        auto circle_obstacle =
+            dynamic_cast<SampledTrajectoryObstacle<Circle>&>(*obstacle);
         TestUtil::equalWithinTolerance(
             Circle(origin,
                    ROBOT_MAX_RADIUS_METERS * config.robot_obstacle_inflation_factor()),
@@ -246,8 +248,8 @@ TEST_F(RobotNavigationObstacleFactoryTest, trajectory_robot_obstacle)
     }
     catch (std::bad_cast&)
     {
-        ADD_FAILURE()
-            << "TrajectoryObstacle<Circle>Ptr was not created for a robot with trajectory";
+        ADD_FAILURE() << "SampledTrajectoryObstacle<Circle>Ptr was not created for a "
+                         "robot with trajectory";
     }
 }
 
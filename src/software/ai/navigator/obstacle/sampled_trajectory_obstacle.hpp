@@ -0,0 +1,94 @@
+#pragma once
+
+#include "software/ai/navigator/obstacle/geom_obstacle.hpp"
+#include "software/ai/navigator/trajectory/sampled_trajectory_path.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+/**
+ * An obstacle that follows a SampledTrajectoryPath. It behaves like a
+ * TrajectoryObstacle, but looks up the position of the obstacle in the samples of the
+ * trajectory instead of evaluating the trajectory on every query. The samples are
+ * shared with every other obstacle created from the same trajectory.
+ */
+template <typename GEOM_TYPE>
+class SampledTrajectoryObstacle : public GeomObstacle<GEOM_TYPE>
+{
+   public:
+    SampledTrajectoryObstacle() = delete;
+
+    /**
+     * Construct a SampledTrajectoryObstacle with GEOM_TYPE
+     *
+     * @param geom GEOM_TYPE to make obstacle with
+     * @param traj Sampled trajectory which the obstacle is following
+     */
+    explicit SampledTrajectoryObstacle(const GEOM_TYPE& geom,
+                                       SampledTrajectoryPathPtr traj);
+
+    bool contains(const Point& p, const double t_sec = 0) const override;
+    double distance(const Point& p, const double t_sec = 0) const override;
+    double signedDistance(const Point& p, const double t_sec = 0) const override;
+    bool intersects(const Segment& segment, const double t_sec = 0) const override;
+
+   private:
+    /**
+     * Gets how far the obstacle has moved from its start after the given time
+     *
+     * @param t_sec Time in seconds into the future
+     *
+     * @return the displacement of the obstacle
+     */
+    Vector getDisplacement(double t_sec) const;
+
+    const SampledTrajectoryPathPtr traj_;
+    const Point start_;
+};
+
+
+template <typename GEOM_TYPE>
+SampledTrajectoryObstacle<GEOM_TYPE>::SampledTrajectoryObstacle(
+    const GEOM_TYPE& geom, SampledTrajectoryPathPtr traj)
+    : GeomObstacle<GEOM_TYPE>(geom), traj_(std::move(traj)), start_(traj_->getPosition(0))
+{
+}
+
+template <typename GEOM_TYPE>
+Vector SampledTrajectoryObstacle<GEOM_TYPE>::getDisplacement(double t_sec) const
+{
+    return traj_->getPosition(t_sec) - start_;
+}
+
+/**
+ * Instead of shifting the obstacle, we shift the point in the opposite direction of
+ * the motion of the obstacle
+ */
+
+template <typename GEOM_TYPE>
+bool SampledTrajectoryObstacle<GEOM_TYPE>::contains(const Point& p,
+                                                    const double t_sec) const
+{
+    return ::contains(this->queryShape(), p - getDisplacement(t_sec));
+}
+
+template <typename GEOM_TYPE>
+double SampledTrajectoryObstacle<GEOM_TYPE>::distance(const Point& p,
+                                                      const double t_sec) const
+{
+    return ::distance(this->queryShape(), p - getDisplacement(t_sec));
+}
+
+template <typename GEOM_TYPE>
+double SampledTrajectoryObstacle<GEOM_TYPE>::signedDistance(const Point& p,
+                                                            const double t_sec) const
+{
+    return ::signedDistance(this->queryShape(), p - getDisplacement(t_sec));
+}
+
+template <typename GEOM_TYPE>
+bool SampledTrajectoryObstacle<GEOM_TYPE>::intersects(const Segment& segment,
+                                                      const double t_sec) const
+{
+    return ::intersects(this->queryShape(), segment - getDisplacement(t_sec));
+}
@@ -0,0 +1,77 @@
+#include "software/ai/navigator/obstacle/sampled_trajectory_obstacle.hpp"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/navigator/obstacle/trajectory_obstacle.hpp"
+
+class SampledTrajectoryObstacleTest : public testing::Test
+{
+   public:
+    SampledTrajectoryObstacleTest()
+        : obstacle_traj(std::make_shared<BangBangTrajectory2D>(
+                            start, end, initial_vel, KinematicConstraints(1, 1, 1)),
+                        BangBangTrajectory2D::generator),
+          obstacle(std::make_shared<SampledTrajectoryObstacle<Circle>>(
+              circle, std::make_shared<const SampledTrajectoryPath>(obstacle_traj)))
+    {
+    }
+
+    Point start        = Point(0, 0);
+    Point end          = Point(4, 0);
+    Vector initial_vel = Vector(0, 0);
+    TrajectoryPath obstacle_traj;
+
+    double radius = 1.0;
+    Circle circle = Circle(start, radius);
+    ObstaclePtr obstacle;
+};
+
+TEST_F(SampledTrajectoryObstacleTest, circle_obstacle_contains)
+{
+    EXPECT_FALSE(obstacle->contains(Point(-radius - 0.01, 0), 0.0));
+    EXPECT_TRUE(obstacle->contains(Point(-radius + 0.01, 0), 0.0));
+
+    // 1-sec into the future, the obstacle should not be covering the point
+    // that initially was barely inside it
+    EXPECT_FALSE(obstacle->contains(Point(-radius + 0.01, 0), 1.0));
+
+    // Test the obstacle once it's reached its destination
+    double end_time = obstacle_traj.getTotalTime();
+    EXPECT_TRUE(obstacle->contains(end, end_time));
+    EXPECT_FALSE(obstacle->contains(end + Vector(radius + 0.01, 0.0), end_time));
+}
+
+TEST_F(SampledTrajectoryObstacleTest, circle_obstacle_intersects)
+{
+    Vector offset(0, 2.0);
+    Segment segment_start(start + offset, start - offset);
+    Segment segment_end(end + offset, end - offset);
+
+    EXPECT_TRUE(obstacle->intersects(segment_start, 0.0));
+    EXPECT_FALSE(obstacle->intersects(segment_end, 0.0));
+
+    double end_time = obstacle_traj.getTotalTime();
+    EXPECT_FALSE(obstacle->intersects(segment_start, end_time));
+    EXPECT_TRUE(obstacle->intersects(segment_end, end_time));
+}
+
+TEST_F(SampledTrajectoryObstacleTest, matches_trajectory_obstacle)
+{
+    // The sampled obstacle should agree with the obstacle that evaluates the trajectory
+    // on every query, up to the error of interpolating between samples
+    const TrajectoryObstacle<Circle> trajectory_obstacle(circle, obstacle_traj);
+
+    for (double t = 0; t <= obstacle_traj.getTotalTime() + 0.5; t += 0.05)
+    {
+        for (double x = -2; x <= 6; x += 0.25)
+        {
+            const Point point(x, 0.5);
+            EXPECT_NEAR(obstacle->signedDistance(point, t),
+                        trajectory_obstacle.signedDistance(point, t), 1e-3)
+                << point << " at " << t;
+            EXPECT_NEAR(obstacle->distance(point, t),
+                        trajectory_obstacle.distance(point, t), 1e-3)
+                << point << " at " << t;
+        }
+    }
+}
@@ -45,14 +45,14 @@ bool TrajectoryObstacle<GEOM_TYPE>::contains(const Point& p, const double t_sec)
 {
     if (std::abs(t_sec) < FIXED_EPSILON)
     {
-        return ::contains(this->geom_, p);
+        return ::contains(this->queryShape(), p);
     }
     else
     {
         // Instead of shifting the obstacle, we will shift the point
         // in the opposite direction of the motion of obstacle
         const Vector displacement = traj_.getPosition(t_sec) - traj_.getPosition(0);
-        return ::contains(this->geom_, p - displacement);
+        return ::contains(this->queryShape(), p - displacement);
     }
 }
 
@@ -61,14 +61,14 @@ double TrajectoryObstacle<GEOM_TYPE>::distance(const Point& p, const double t_se
 {
     if (std::abs(t_sec) < FIXED_EPSILON)
     {
-        return ::distance(this->geom_, p);
+        return ::distance(this->queryShape(), p);
     }
     else
     {
         // Instead of shifting the obstacle, we will shift the point
         // in the opposite direction of the motion of obstacle
         const Vector displacement = traj_.getPosition(t_sec) - traj_.getPosition(0);
-        return ::distance(this->geom_, p - displacement);
+        return ::distance(this->queryShape(), p - displacement);
     }
 }
 
@@ -78,14 +78,14 @@ double TrajectoryObstacle<GEOM_TYPE>::signedDistance(const Point& p,
 {
     if (std::abs(t_sec) < FIXED_EPSILON)
     {
-        return ::signedDistance(this->geom_, p);
+        return ::signedDistance(this->queryShape(), p);
     }
     else
     {
         // Instead of shifting the obstacle, we will shift the point
         // in the opposite direction of the motion of obstacle
         const Vector displacement = traj_.getPosition(t_sec) - traj_.getPosition(0);
-        return ::signedDistance(this->geom_, p - displacement);
+        return ::signedDistance(this->queryShape(), p - displacement);
     }
 }
 
@@ -95,13 +95,13 @@ bool TrajectoryObstacle<GEOM_TYPE>::intersects(const Segment& segment,
 {
     if (std::abs(t_sec) < FIXED_EPSILON)
     {
-        return ::intersects(this->geom_, segment);
+        return ::intersects(this->queryShape(), segment);
     }
     else
     {
         // Instead of shifting the obstacle, we will shift the point
         // in the opposite direction of the motion of obstacle
         const Vector displacement = traj_.getPosition(t_sec) - traj_.getPosition(0);
-        return ::intersects(this->geom_, segment - displacement);
+        return ::intersects(this->queryShape(), segment - displacement);
     }
 }
@@ -0,0 +1,124 @@
+#include "software/ai/navigator/trajectory/bounded_trajectory_path.h"
+
+BoundedTrajectoryPath::BoundedTrajectoryPath()
+    : trajectories_(), trajectory_end_times_sec_(), num_nodes_(1)
+{
+    trajectory_end_times_sec_[0] = trajectories_[0].getTotalTime();
+}
+
+void BoundedTrajectoryPath::generate(const Point& initial_pos, const Point& destination,
+                                     const Vector& initial_vel,
+                                     const KinematicConstraints& constraints)
+{
+    trajectories_[0].generate(initial_pos, destination, initial_vel,
+                              constraints.getMaxVelocity(),
+                              constraints.getMaxAcceleration(),
+                              constraints.getMaxDeceleration());
+    trajectory_end_times_sec_[0] = trajectories_[0].getTotalTime();
+    num_nodes_                   = 1;
+}
+
+bool BoundedTrajectoryPath::append(double connection_time_sec, const Point& destination,
+                                   const KinematicConstraints& constraints)
+{
+    // Find the trajectory that the new trajectory should connect to
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        if (connection_time_sec <= trajectory_end_times_sec_[i])
+        {
+            if (i + 1 >= MAX_NUM_NODES)
+            {
+                return false;
+            }
+
+            // Drop all trajectories after the one that is at the connection_time_sec
+            num_nodes_ = i + 1;
+
+            // To have a smooth and continuous trajectory path, we want the start
+            // position and velocity of the newly generated trajectory to be
+            // the end position and velocity of the last trajectory.
+            const Point connection_pos  = getPosition(connection_time_sec);
+            const Vector connection_vel = getVelocity(connection_time_sec);
+
+            num_nodes_ = i + 2;
+            trajectories_[i + 1].generate(connection_pos, destination, connection_vel,
+                                          constraints.getMaxVelocity(),
+                                          constraints.getMaxAcceleration(),
+                                          constraints.getMaxDeceleration());
+            trajectory_end_times_sec_[i + 1] = trajectories_[i + 1].getTotalTime();
+            trajectory_end_times_sec_[i]     = connection_time_sec;
+            return true;
+        }
+
+        connection_time_sec -= trajectory_end_times_sec_[i];
+    }
+    return true;
+}
+
+Point BoundedTrajectoryPath::getPosition(double t_sec) const
+{
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec_[i])
+        {
+            return trajectories_[i].getPosition(t_sec);
+        }
+        t_sec -= trajectory_end_times_sec_[i];
+    }
+
+    return trajectories_[num_nodes_ - 1].getDestination();
+}
+
+Vector BoundedTrajectoryPath::getVelocity(double t_sec) const
+{
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec_[i])
+        {
+            return trajectories_[i].getVelocity(t_sec);
+        }
+        t_sec -= trajectory_end_times_sec_[i];
+    }
+
+    return Vector();
+}
+
+Vector BoundedTrajectoryPath::getAcceleration(double t_sec) const
+{
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        if (t_sec <= trajectory_end_times_sec_[i])
+        {
+            return trajectories_[i].getAcceleration(t_sec);
+        }
+        t_sec -= trajectory_end_times_sec_[i];
+    }
+
+    return Vector();
+}
+
+double BoundedTrajectoryPath::getTotalTime() const
+{
+    double total_time = 0.0;
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        total_time += trajectory_end_times_sec_[i];
+    }
+    return total_time;
+}
+
+std::vector<Rectangle> BoundedTrajectoryPath::getBoundingBoxes() const
+{
+    std::vector<Rectangle> bounding_boxes;
+    for (unsigned int i = 0; i < num_nodes_; i++)
+    {
+        const std::vector<Rectangle> bbs = trajectories_[i].getBoundingBoxes();
+        bounding_boxes.insert(bounding_boxes.end(), bbs.begin(), bbs.end());
+    }
+    return bounding_boxes;
+}
+
+unsigned int BoundedTrajectoryPath::getNumNodes() const
+{
+    return num_nodes_;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
+#include "software/ai/navigator/trajectory/kinematic_constraints.h"
+#include "software/ai/navigator/trajectory/trajectory_2d.h"
+
+/**
+ * BoundedTrajectoryPath is a TrajectoryPath made of BangBangTrajectory2Ds that are
+ * stored by value in a fixed size array, instead of behind shared pointers in a
+ * vector. Regenerating or appending to a BoundedTrajectoryPath never allocates memory,
+ * so it can be rebuilt inside a real-time control loop.
+ *
+ * The trajectories behave exactly like the ones in a TrajectoryPath built with
+ * BangBangTrajectory2D::generator, but a path can hold at most MAX_NUM_NODES of them.
+ */
+class BoundedTrajectoryPath : public Trajectory2D
+{
+   public:
+    // The maximum number of trajectories that can make up a path. The trajectory
+    // planner only ever creates paths with a single sub-destination.
+    static constexpr unsigned int MAX_NUM_NODES = 4;
+
+    /**
+     * Creates an empty trajectory path that stays at the origin
+     */
+    BoundedTrajectoryPath();
+
+    /**
+     * Replaces the path with a single trajectory from the initial position to the
+     * destination. Any previously appended trajectories are discarded.
+     *
+     * @param initial_pos Where the path should start at
+     * @param destination Where the first trajectory of the path should end at
+     * @param initial_vel The initial velocity of the path
+     * @param constraints Constraints of the generated trajectory
+     */
+    void generate(const Point& initial_pos, const Point& destination,
+                  const Vector& initial_vel, const KinematicConstraints& constraints);
+
+    /**
+     * Generate and append a new trajectory to the end of this trajectory path. Has the
+     * same behaviour as TrajectoryPath::append.
+     *
+     * @param connection_time_sec The time where the last existing trajectory should
+     * connect to the newly generated trajectory
+     * @param destination Destination of the newly generated trajectory
+     * @param constraints Constraints of the new generated trajectory
+     *
+     * @return false if the path already has MAX_NUM_NODES trajectories and the new
+     * trajectory could not be appended, true otherwise
+     */
+    bool append(double connection_time_sec, const Point& destination,
+                const KinematicConstraints& constraints);
+
+    /**
+     * Get the position at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The position at time t
+     */
+    Point getPosition(double t_sec) const override;
+
+    /**
+     * Get the velocity at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The velocity at time t
+     */
+    Vector getVelocity(double t_sec) const override;
+
+    /**
+     * Get the acceleration at time t of this trajectory path
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     * @return The acceleration at time t
+     */
+    Vector getAcceleration(double t_sec) const override;
+
+    /**
+     * Get the total duration of the trajectory until it reaches the destination
+     *
+     * @return The total duration for this trajectory path
+     */
+    double getTotalTime() const override;
+
+    /**
+     * Get the bounding boxes of the trajectory path
+     * @return A list of bounding boxes which wrap this trajectory path
+     */
+    std::vector<Rectangle> getBoundingBoxes() const override;
+
+    /**
+     * Get the number of trajectories that make up this trajectory path
+     *
+     * @return The number of trajectories in this trajectory path
+     */
+    unsigned int getNumNodes() const;
+
+   private:
+    std::array<BangBangTrajectory2D, MAX_NUM_NODES> trajectories_;
+    // The time at which each trajectory ends and the next one begins, relative to the
+    // start of that trajectory
+    std::array<double, MAX_NUM_NODES> trajectory_end_times_sec_;
+    unsigned int num_nodes_;
+};
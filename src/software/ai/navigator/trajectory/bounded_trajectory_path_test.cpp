@@ -0,0 +1,114 @@
+#include "software/ai/navigator/trajectory/bounded_trajectory_path.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/test_util/test_util.h"
+
+class BoundedTrajectoryPathTest : public testing::Test
+{
+   protected:
+    static constexpr int NUM_SUB_POINTS = 50;
+    static constexpr double TOLERANCE   = 1e-9;
+
+    void expectPathsEqual(const TrajectoryPath& expected,
+                          const BoundedTrajectoryPath& actual)
+    {
+        EXPECT_NEAR(expected.getTotalTime(), actual.getTotalTime(), TOLERANCE);
+
+        const double sub_point_length_sec = expected.getTotalTime() / NUM_SUB_POINTS;
+        // Step past the end of the path to also check where the path stops
+        for (int i = 0; i <= NUM_SUB_POINTS + 5; i++)
+        {
+            const double t = i * sub_point_length_sec;
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(
+                expected.getPosition(t), actual.getPosition(t), TOLERANCE))
+                << "Position differs at t=" << t;
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(
+                expected.getVelocity(t), actual.getVelocity(t), TOLERANCE))
+                << "Velocity differs at t=" << t;
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(
+                expected.getAcceleration(t), actual.getAcceleration(t), TOLERANCE))
+                << "Acceleration differs at t=" << t;
+        }
+    }
+
+    const KinematicConstraints constraints = KinematicConstraints(3.0, 4.0, 4.0);
+};
+
+TEST_F(BoundedTrajectoryPathTest, test_single_trajectory_matches_trajectory_path)
+{
+    const Point start(-1, 2);
+    const Point destination(3, -1.5);
+    const Vector initial_velocity(1, 1);
+
+    TrajectoryPath expected(std::make_shared<BangBangTrajectory2D>(
+                                start, destination, initial_velocity, constraints),
+                            BangBangTrajectory2D::generator);
+
+    BoundedTrajectoryPath actual;
+    actual.generate(start, destination, initial_velocity, constraints);
+
+    EXPECT_EQ(actual.getNumNodes(), 1);
+    expectPathsEqual(expected, actual);
+}
+
+TEST_F(BoundedTrajectoryPathTest, test_path_with_sub_destination_matches_trajectory_path)
+{
+    const Point start(0, 0);
+    const Point sub_destination(1, 2);
+    const Point destination(3, 0);
+    const Vector initial_velocity(-1, 0);
+    const double connection_time_sec = 0.6;
+
+    TrajectoryPath expected(std::make_shared<BangBangTrajectory2D>(
+                                start, sub_destination, initial_velocity, constraints),
+                            BangBangTrajectory2D::generator);
+    expected.append(connection_time_sec, destination, constraints);
+
+    BoundedTrajectoryPath actual;
+    actual.generate(start, sub_destination, initial_velocity, constraints);
+    EXPECT_TRUE(actual.append(connection_time_sec, destination, constraints));
+
+    EXPECT_EQ(actual.getNumNodes(), 2);
+    expectPathsEqual(expected, actual);
+}
+
+TEST_F(BoundedTrajectoryPathTest, test_generate_discards_appended_trajectories)
+{
+    const Point start(0, 0);
+    const Point destination(-2, 1);
+
+    BoundedTrajectoryPath actual;
+    actual.generate(start, Point(1, 1), Vector(), constraints);
+    actual.append(0.5, Point(2, 0), constraints);
+    actual.generate(start, destination, Vector(), constraints);
+
+    TrajectoryPath expected(
+        std::make_shared<BangBangTrajectory2D>(start, destination, Vector(), constraints),
+        BangBangTrajectory2D::generator);
+
+    EXPECT_EQ(actual.getNumNodes(), 1);
+    expectPathsEqual(expected, actual);
+}
+
+TEST_F(BoundedTrajectoryPathTest, test_append_fails_once_path_is_full)
+{
+    BoundedTrajectoryPath path;
+    path.generate(Point(0, 0), Point(4, 0), Vector(), constraints);
+
+    // Keep connecting to the end of the last trajectory of the path
+    for (unsigned int i = 1; i < BoundedTrajectoryPath::MAX_NUM_NODES; i++)
+    {
+        EXPECT_TRUE(path.append(path.getTotalTime() - 0.1,
+                                Point(4, static_cast<double>(i)), constraints));
+    }
+    EXPECT_EQ(path.getNumNodes(), BoundedTrajectoryPath::MAX_NUM_NODES);
+
+    EXPECT_FALSE(path.append(path.getTotalTime() - 0.1, Point(-4, -4), constraints));
+    EXPECT_EQ(path.getNumNodes(), BoundedTrajectoryPath::MAX_NUM_NODES);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        path.getDestination(),
+        Point(4, static_cast<double>(BoundedTrajectoryPath::MAX_NUM_NODES - 1)),
+        TOLERANCE));
+}
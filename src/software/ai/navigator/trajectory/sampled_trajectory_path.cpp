@@ -0,0 +1,53 @@
+#include "software/ai/navigator/trajectory/sampled_trajectory_path.h"
+
+#include <algorithm>
+#include <cmath>
+
+SampledTrajectoryPath::SampledTrajectoryPath(TrajectoryPath traj_path)
+    : traj_path_(std::move(traj_path))
+{
+    // Sample until the first step at or after the total time, so the last sample is
+    // the destination
+    const double total_time_sec = std::max(traj_path_.getTotalTime(), 0.0);
+    const auto num_samples =
+        static_cast<std::size_t>(std::ceil(total_time_sec / SAMPLE_INTERVAL_SEC)) + 1;
+
+    xs_.reserve(num_samples);
+    ys_.reserve(num_samples);
+    for (std::size_t i = 0; i < num_samples; i++)
+    {
+        const Point position =
+            traj_path_.getPosition(static_cast<double>(i) * SAMPLE_INTERVAL_SEC);
+        xs_.push_back(position.x());
+        ys_.push_back(position.y());
+    }
+}
+
+const TrajectoryPath& SampledTrajectoryPath::getTrajectoryPath() const
+{
+    return traj_path_;
+}
+
+Point SampledTrajectoryPath::getPosition(double t_sec) const
+{
+    const double index = t_sec / SAMPLE_INTERVAL_SEC;
+    if (!(index > 0))
+    {
+        return Point(xs_.front(), ys_.front());
+    }
+
+    const auto i = static_cast<std::size_t>(index);
+    if (i + 1 >= xs_.size())
+    {
+        return Point(xs_.back(), ys_.back());
+    }
+
+    const double fraction = index - static_cast<double>(i);
+    return Point(xs_[i] + (xs_[i + 1] - xs_[i]) * fraction,
+                 ys_[i] + (ys_[i + 1] - ys_[i]) * fraction);
+}
+
+std::size_t SampledTrajectoryPath::getNumSamples() const
+{
+    return xs_.size();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+
+/**
+ * SampledTrajectoryPath is a TrajectoryPath together with its positions sampled at a
+ * fixed time step, stored as flat arrays of x and y coordinates.
+ *
+ * Every robot planning in a tick checks its candidate trajectories against the
+ * trajectories of all other friendly robots, so the same TrajectoryPath would
+ * otherwise be evaluated (walking its nodes and bang-bang phases) thousands of times
+ * per tick. Sampling it once when it is planned turns each of those evaluations into
+ * an array lookup. Between two samples the position is linearly interpolated.
+ */
+class SampledTrajectoryPath
+{
+   public:
+    // The time step between two samples. This is the step the collision evaluator
+    // checks trajectories at, so its queries land exactly on samples.
+    static constexpr double SAMPLE_INTERVAL_SEC = 0.05;
+
+    SampledTrajectoryPath() = delete;
+
+    /**
+     * Samples the given trajectory path from its start until it reaches its destination
+     *
+     * @param traj_path The trajectory path to sample
+     */
+    explicit SampledTrajectoryPath(TrajectoryPath traj_path);
+
+    /**
+     * Gets the trajectory path that was sampled
+     *
+     * @return the trajectory path
+     */
+    const TrajectoryPath& getTrajectoryPath() const;
+
+    /**
+     * Get the position at time t of the trajectory path, interpolated between the two
+     * closest samples. Times before the start and after the end of the path are
+     * clamped to the start and the destination of the path.
+     *
+     * @param t_sec The time elapsed since the start of the trajectory path
+     *
+     * @return The position at time t
+     */
+    Point getPosition(double t_sec) const;
+
+    /**
+     * Get the number of samples of the trajectory path
+     *
+     * @return the number of samples
+     */
+    std::size_t getNumSamples() const;
+
+   private:
+    TrajectoryPath traj_path_;
+    std::vector<double> xs_;
+    std::vector<double> ys_;
+};
+
+/**
+ * A trajectory path is sampled once and then shared by every obstacle created from it
+ * Note: this is a convenience typedef
+ */
+using SampledTrajectoryPathPtr = std::shared_ptr<const SampledTrajectoryPath>;
@@ -0,0 +1,69 @@
+#include "software/ai/navigator/trajectory/sampled_trajectory_path.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
+#include "software/geom/algorithms/distance.h"
+
+class SampledTrajectoryPathTest : public testing::Test
+{
+   public:
+    SampledTrajectoryPathTest()
+        : traj_path(std::make_shared<BangBangTrajectory2D>(
+                        Point(0, 0), Point(3, 1), Vector(0, 1),
+                        KinematicConstraints(2, 3, 3)),
+                    BangBangTrajectory2D::generator)
+    {
+        traj_path.append(0.5, Point(-1, 2), KinematicConstraints(2, 3, 3));
+    }
+
+    TrajectoryPath traj_path;
+};
+
+TEST_F(SampledTrajectoryPathTest, test_samples_whole_trajectory)
+{
+    const SampledTrajectoryPath sampled(traj_path);
+
+    const double num_intervals =
+        traj_path.getTotalTime() / SampledTrajectoryPath::SAMPLE_INTERVAL_SEC;
+    EXPECT_EQ(sampled.getNumSamples(),
+              static_cast<std::size_t>(std::ceil(num_intervals)) + 1);
+    EXPECT_EQ(sampled.getTrajectoryPath().getTrajectoryPathNodes().size(), 2);
+}
+
+TEST_F(SampledTrajectoryPathTest, test_position_at_samples_matches_trajectory)
+{
+    const SampledTrajectoryPath sampled(traj_path);
+
+    // The collision evaluator checks trajectories at multiples of the sample interval
+    for (double t = 0; t < traj_path.getTotalTime();
+         t += SampledTrajectoryPath::SAMPLE_INTERVAL_SEC)
+    {
+        EXPECT_LT(distance(sampled.getPosition(t), traj_path.getPosition(t)), 1e-9)
+            << t;
+    }
+}
+
+TEST_F(SampledTrajectoryPathTest, test_position_between_samples_is_close_to_trajectory)
+{
+    const SampledTrajectoryPath sampled(traj_path);
+
+    // Interpolating a trajectory with a max acceleration of 3 m/s^2 linearly between
+    // samples 0.05s apart is off by at most 3 * 0.05^2 / 8 ~= 1mm
+    for (double t = 0.013; t < traj_path.getTotalTime(); t += 0.031)
+    {
+        EXPECT_LT(distance(sampled.getPosition(t), traj_path.getPosition(t)), 0.001)
+            << t;
+    }
+}
+
+TEST_F(SampledTrajectoryPathTest, test_position_is_clamped_outside_of_trajectory)
+{
+    const SampledTrajectoryPath sampled(traj_path);
+
+    EXPECT_EQ(sampled.getPosition(-1.0), Point(0, 0));
+    EXPECT_LT(distance(sampled.getPosition(traj_path.getTotalTime()), Point(-1, 2)),
+              0.001);
+    EXPECT_LT(distance(sampled.getPosition(traj_path.getTotalTime() + 10), Point(-1, 2)),
+              1e-9);
+}
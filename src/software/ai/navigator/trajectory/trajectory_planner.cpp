@@ -1,8 +1,10 @@
 #include "software/ai/navigator/trajectory/trajectory_planner.h"
 
 #include "collision_evaluator.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/distance.h"
+#include "software/geom/value_shapes.h"
 
 
 TrajectoryPlanner::TrajectoryPlanner()
@@ -33,7 +35,8 @@ std::vector<Point> TrajectoryPlanner::getSubDestinations(
     // Convert the relative sub destinations to actual sub destination points
     // and filter out undesirable sub destinations to reduce trajectory sampling.
     std::vector<Point> sub_destinations;
-    Angle direction = (destination - start).orientation();
+    Angle direction             = (destination - start).orientation();
+    const Aabb navigable_bounds = Aabb::fromRectangle(navigable_area);
     sub_destinations.reserve(relative_sub_destinations.size());
 
     for (const Vector& relative_sub_dest : relative_sub_destinations)
@@ -46,7 +49,7 @@ std::vector<Point> TrajectoryPlanner::getSubDestinations(
         }
 
         Point sub_dest = start + relative_sub_dest;
-        if (!contains(navigable_area, sub_dest))
+        if (!contains(navigable_bounds, sub_dest))
         {
             continue;
         }
@@ -77,8 +80,20 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
 
     // Sample trajectory paths by trying different sub destinations and connection times
     // and store the best trajectory path (min cost)
+    StageDeadline deadline(AiStage::TRAJECTORY_PLANNING);
+    unsigned int num_sub_destinations_sampled = 0;
     for (const Point& sub_dest : getSubDestinations(start, destination, navigable_area))
     {
+        // Use the best trajectory path so far if we are out of time, unless it still
+        // collides and we haven't sampled the minimum number of sub destinations yet
+        if ((!best_traj_with_cost.collides() ||
+             num_sub_destinations_sampled >= MIN_NUM_SUB_DESTINATIONS_SAMPLED) &&
+            deadline.hasExpired())
+        {
+            break;
+        }
+        num_sub_destinations_sampled++;
+
         // Generate a direct trajectory to the sub destination
         TrajectoryPathWithCost sub_trajectory = getDirectTrajectoryWithCost(
             start, sub_dest, initial_velocity, constraints, obstacles);
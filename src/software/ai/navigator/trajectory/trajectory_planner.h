@@ -26,7 +26,9 @@ class TrajectoryPlanner
      * @param navigable_area The navigable area of the field
      * @param prev_sub_destination The previous sub destination of this robot.
      * nullopt if there is no previous sub destination
-     * @return TrajectoryPath which attempts to avoid the obstacles
+     * @return TrajectoryPath which attempts to avoid the obstacles. If the trajectory
+     * planning stage of the AI tick runs out of time, this is the best trajectory path
+     * found so far.
      */
     std::optional<TrajectoryPath> findTrajectory(
         const Point& start, const Point& destination, const Vector& initial_velocity,
@@ -97,6 +99,11 @@ class TrajectoryPlanner
     static constexpr Angle MIN_SUB_DESTINATION_ANGLE = Angle::fromDegrees(20);
     static constexpr Angle MAX_SUB_DESTINATION_ANGLE = Angle::fromDegrees(140);
 
+    // How many sub destinations are sampled when the direct trajectory collides before
+    // giving up on finding a collision-free trajectory once the time budget runs out,
+    // so that a slow tick doesn't leave the robot driving into an obstacle
+    static constexpr unsigned int MIN_NUM_SUB_DESTINATIONS_SAMPLED = 16;
+
     // TODO (#3603): Tune collision threshold constants
     static constexpr double UNAVOIDABLE_COLLISION_TIME_THRESHOLD_S       = 0.2;
     static constexpr double UNAVOIDABLE_COLLISION_VELOCITY_THRESHOLD_M_S = 0.5;
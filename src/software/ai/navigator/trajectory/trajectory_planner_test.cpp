@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/test_util/test_util.h"
 
@@ -107,6 +108,28 @@ TEST_F(TrajectoryPlannerTest, test_traj_avoid_robot_obstacle)
     verifyTrajectoryIsWithinRectangle(traj_path.value(), valid_traj_rectangle);
 }
 
+TEST_F(TrajectoryPlannerTest, test_traj_avoid_robot_obstacle_when_out_of_time)
+{
+    Point start_pos(-1.0, 0.0);
+    Point destination(1.0, 0.0);
+    std::vector obstacles = {robot_obstacle};
+
+    // A budget of zero runs out before the planner samples any sub destinations
+    TbotsProto::AiTimeBudgetConfig time_budget_config;
+    time_budget_config.set_tick_budget_ms(0);
+    time_budget_config.set_trajectory_planning_budget_ms(0);
+    AiTimeBudgetStats time_budget_stats;
+    ScopedAiTickTimeBudget time_budget(time_budget_config, time_budget_stats);
+
+    auto traj_path =
+        traj_planner.findTrajectory(start_pos, destination, Vector(), constraints,
+                                    obstacles, world->field().fieldBoundary());
+
+    ASSERT_TRUE(traj_path.has_value());
+    EXPECT_EQ(traj_path->getDestination(), destination);
+    verifyNoCollision(traj_path.value(), obstacles);
+}
+
 TEST_F(TrajectoryPlannerTest, test_traj_avoid_friendly_defense_area)
 {
     Point start_pos(-4.0, -1.5);
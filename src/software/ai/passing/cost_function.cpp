@@ -14,79 +14,113 @@
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
 
+double ratePass(const World& world, const Pass& pass, const PassingParams& passing_params)
+{
+    return ratePass(world, pass,
+                    createEnemyGoalShotCalculator(world.field(), world.enemyTeam()),
+                    passing_params);
+}
+
+double ratePass(const World& world, const Pass& pass,
+                const BestShotCalculator& best_shot_calculator,
+                const PassingParams& passing_params)
+{
+    return ratePass(world, pass,
+                    best_shot_calculator.calcBestShotOnGoal(pass.receiverPoint()),
+                    passing_params);
+}
+
 double ratePass(const World& world, const Pass& pass,
-                const TbotsProto::PassingConfig& passing_config)
+                const std::optional<Shot>& best_shot,
+                const PassingParams& passing_params)
 {
     double static_pass_quality =
-        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
+        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_params);
 
-    double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_config);
+    double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_params);
 
     double friendly_pass_rating =
-        ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+        ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_params);
 
-    double pass_forward_rating = ratePassForwardQuality(pass, passing_config);
+    double pass_forward_rating = ratePassForwardQuality(pass, passing_params);
 
-    double enemy_pass_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+    double enemy_pass_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_params);
 
-    double shoot_pass_rating =
-        ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
+    double shoot_pass_rating = ratePassShootScore(best_shot, passing_params);
 
     return static_pass_quality * receiver_not_too_close_rating * friendly_pass_rating *
            enemy_pass_rating * pass_forward_rating * shoot_pass_rating;
 }
 
-double ratePassForwardQuality(const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config)
+double ratePassForwardQuality(const Pass& pass, const PassingParams& passing_params)
 {
     // Rate receiving positions up the field higher and discourage passes back to
     // friendly half, if the passer is in the enemy half
     return sigmoid(pass.receiverPoint().x(),
                    std::min(0.0, pass.passerPoint().x()) +
-                       passing_config.backwards_pass_distance_meters(),
+                       passing_params.backwards_pass_distance_meters,
                    4.0);
 }
 
-double ratePassNotTooClose(const Pass& pass,
-                           const TbotsProto::PassingConfig& passing_config)
+double ratePassNotTooClose(const Pass& pass, const PassingParams& passing_params)
 {
     // Encourage passes that are not too close to the passer
     return 1 - circleSigmoid(Circle(pass.passerPoint(),
-                                    passing_config.receiver_ideal_min_distance_meters()),
+                                    passing_params.receiver_ideal_min_distance_meters),
                              pass.receiverPoint(), 2.0);
 }
 
 double rateReceivingPosition(const World& world, const Pass& pass,
-                             const TbotsProto::PassingConfig& passing_config)
+                             const PassingParams& passing_params)
+{
+    return rateReceivingPosition(
+        world, pass, createEnemyGoalShotCalculator(world.field(), world.enemyTeam()),
+        passing_params);
+}
+
+double rateReceivingPosition(const World& world, const Pass& pass,
+                             const BestShotCalculator& best_shot_calculator,
+                             const PassingParams& passing_params)
 {
     double static_recv_quality =
-        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
+        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_params);
 
-    double receiver_up_field_rating = ratePassForwardQuality(pass, passing_config);
+    double receiver_up_field_rating = ratePassForwardQuality(pass, passing_params);
 
     // We want to encourage passes that are not too far away from the passer
     // to stop the robots from trying to pass across the field
     double receiver_not_too_far_rating = circleSigmoid(
-        Circle(pass.passerPoint(), passing_config.receiver_ideal_max_distance_meters()),
+        Circle(pass.passerPoint(), passing_params.receiver_ideal_max_distance_meters),
         pass.receiverPoint(), 2.0);
-    double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_config);
+    double receiver_not_too_close_rating = ratePassNotTooClose(pass, passing_params);
 
-    double enemy_risk_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+    double enemy_risk_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_params);
 
     double pass_shoot_rating =
-        ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
+        ratePassShootScore(best_shot_calculator, pass, passing_params);
 
     return static_recv_quality * receiver_up_field_rating * receiver_not_too_far_rating *
            receiver_not_too_close_rating * enemy_risk_rating * pass_shoot_rating;
 }
 
+BestShotCalculator createEnemyGoalShotCalculator(const Field& field,
+                                                 const Team& enemy_team)
+{
+    return BestShotCalculator(Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()),
+                              enemy_team.getAllRobots(), TeamType::ENEMY);
+}
+
 double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_team,
-                const TbotsProto::PassingConfig& passing_config)
+                const PassingParams& passing_params)
 {
-    auto shot_opt =
+    return rateShot(
         calcBestShotOnGoal(Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()),
-                           shot_origin, enemy_team.getAllRobots(), TeamType::ENEMY);
+                           shot_origin, enemy_team.getAllRobots(), TeamType::ENEMY),
+        passing_params);
+}
 
+double rateShot(const std::optional<Shot>& shot_opt, const PassingParams& passing_params)
+{
     Angle open_angle_to_goal = Angle::zero();
     if (shot_opt && shot_opt.value().getOpenAngle().abs() > Angle::fromDegrees(0))
     {
@@ -94,7 +128,7 @@ double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_
     }
 
     const double min_ideal_angle =
-        passing_config.min_ideal_pass_shoot_goal_open_angle_deg();
+        passing_params.min_ideal_pass_shoot_goal_open_angle_deg;
     double open_angle_to_goal_score = open_angle_to_goal.toDegrees();
 
     // Clamp angle to [0, min_ideal_angle], where all angle >=min_ideal_angle are given
@@ -106,29 +140,52 @@ double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_
 }
 
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
-                          const TbotsProto::PassingConfig& passing_config)
+                          const PassingParams& passing_params)
 {
-    double shot_score = rateShot(pass.receiverPoint(), field, enemy_team, passing_config);
+    return ratePassShootScore(
+        calcBestShotOnGoal(Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()),
+                           pass.receiverPoint(), enemy_team.getAllRobots(),
+                           TeamType::ENEMY),
+        passing_params);
+}
+
+double ratePassShootScore(const BestShotCalculator& best_shot_calculator,
+                          const Pass& pass, const PassingParams& passing_params)
+{
+    return ratePassShootScore(
+        best_shot_calculator.calcBestShotOnGoal(pass.receiverPoint()), passing_params);
+}
+
+double ratePassShootScore(const std::optional<Shot>& best_shot,
+                          const PassingParams& passing_params)
+{
+    double shot_score = rateShot(best_shot, passing_params);
 
     // Linearly scale score to [min_pass_shoot_score, 1.0] to stop this cost function
     // from returning a very low score, causing the other cost functions to be ignored.
     return normalizeValueToRange(shot_score, 0.0, 1.0,
-                                 passing_config.min_pass_shoot_score(), 1.0);
+                                 passing_params.min_pass_shoot_score, 1.0);
+}
+
+double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
+                         const PassingParams& passing_params)
+{
+    return ratePassEnemyRisk(enemy_team, pass, passing_params,
+                             calculateInterceptRisk(enemy_team, pass, passing_params));
 }
 
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
-                         const TbotsProto::PassingConfig& passing_config)
+                         const PassingParams& passing_params, double intercept_risk)
 {
     double enemy_receiver_proximity_risk =
-        calculateProximityRisk(pass.receiverPoint(), enemy_team, passing_config);
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+        calculateProximityRisk(pass.receiverPoint(), enemy_team, passing_params);
 
     // We want to rate a pass more highly if it is lower risk, so subtract from 1
     return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
 }
 
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config)
+                              const PassingParams& passing_params)
 {
     // Return the highest risk for all the enemy robots, if there are any
     const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
@@ -140,12 +197,12 @@ double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
     std::transform(enemy_robots.begin(), enemy_robots.end(),
                    enemy_intercept_risks.begin(),
                    [&](const Robot& robot)
-                   { return calculateInterceptRisk(robot, pass, passing_config); });
+                   { return calculateInterceptRisk(robot, pass, passing_params); });
     return *std::max_element(enemy_intercept_risks.begin(), enemy_intercept_risks.end());
 }
 
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config)
+                              const PassingParams& passing_params)
 {
     // Return early to avoid division by zero
     if (pass.speed() == 0)
@@ -176,13 +233,13 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
     // Scale the time to interception point by the enemy robot's interception capability
     Duration enemy_robot_time_to_interception_point =
         Duration::fromSeconds(enemy_robot_time_to_interception_point_sec *
-                              passing_config.enemy_interception_time_multiplier());
+                              passing_params.enemy_interception_time_multiplier);
 
     // TODO (#2988): We should generate a more realistic ball trajectory
     Duration ball_time_to_interception_point =
         Duration::fromSeconds(distance(pass.passerPoint(), closest_interception_point) /
                               pass.speed()) +
-        Duration::fromSeconds(passing_config.pass_delay_sec());
+        Duration::fromSeconds(passing_params.pass_delay_sec);
 
     Duration interception_delta_time =
         ball_time_to_interception_point - enemy_robot_time_to_interception_point;
@@ -191,12 +248,12 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
     // by whether or not they will be able to reach the pass receive position before
     // the pass does.
     return std::clamp(interception_delta_time.toSeconds() *
-                          passing_config.enemy_interception_risk_importance(),
+                          passing_params.enemy_interception_risk_importance,
                       0.0, 1.0);
 }
 
 double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
-                                  const TbotsProto::PassingConfig& passing_config)
+                                  const PassingParams& passing_params)
 {
     // We need at least one robot to pass to
     if (friendly_team.getAllRobots().empty())
@@ -228,7 +285,7 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
     Duration ball_travel_time =
         Duration::fromSeconds((pass.receiverPoint() - pass.passerPoint()).length() /
                               pass.speed()) +
-        Duration::fromSeconds(passing_config.pass_delay_sec());
+        Duration::fromSeconds(passing_params.pass_delay_sec);
     Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
 
     // Figure out how long it would take our robot to get there
@@ -251,7 +308,7 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
     // point exceeds the time we would need to get there by
     double sigmoid_width = 0.4;
     double time_to_receiver_state_slack_s =
-        passing_config.friendly_time_to_receive_slack_sec();
+        passing_params.friendly_time_to_receive_slack_sec;
 
     return sigmoid(
         receive_time.toSeconds(),
@@ -260,16 +317,16 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
 }
 
 double getStaticPositionQuality(const Field& field, const Point& position,
-                                const TbotsProto::PassingConfig& passing_config)
+                                const PassingParams& passing_params)
 {
     // This constant is used to determine how steep the sigmoid slopes below are
     static const double sig_width = 0.1;
 
     // The offset from the sides of the field for the center of the sigmoid functions
-    double x_offset = passing_config.static_field_position_quality_x_offset();
-    double y_offset = passing_config.static_field_position_quality_y_offset();
+    double x_offset = passing_params.static_field_position_quality_x_offset;
+    double y_offset = passing_params.static_field_position_quality_y_offset;
     double friendly_goal_weight =
-        passing_config.static_field_position_quality_friendly_goal_distance_weight();
+        passing_params.static_field_position_quality_friendly_goal_distance_weight;
 
     // Make a slightly smaller field, and positive weight values in this reduced field
     double half_field_length = field.xLength() / 2;
@@ -296,7 +353,7 @@ double getStaticPositionQuality(const Field& field, const Point& position,
 }
 
 double calculateProximityRisk(const Point& point, const Team& enemy_team,
-                              const TbotsProto::PassingConfig& passing_config)
+                              const PassingParams& passing_params)
 {
     // Calculate a risk score based on the distance of the enemy robots from the given
     // point, based on an exponential function of the distance of each robot from the
@@ -312,7 +369,7 @@ double calculateProximityRisk(const Point& point, const Team& enemy_team,
         double dist_to_enemy =
             std::max(0.0, distance(point, enemy.position()) - ROBOT_MAX_RADIUS_METERS);
         risk += std::exp((-dist_to_enemy * dist_to_enemy) /
-                         passing_config.enemy_proximity_importance());
+                         passing_params.enemy_proximity_importance);
     }
     return sigmoid(risk, 1, 2);
 }
@@ -320,7 +377,7 @@ double calculateProximityRisk(const Point& point, const Team& enemy_team,
 double rateKeepAwayPosition(const Point& keep_away_position, const World& world,
                             const Pass& best_pass_so_far,
                             const Rectangle& dribbling_bounds,
-                            const TbotsProto::PassingConfig& passing_config)
+                            const PassingParams& passing_params)
 {
     static constexpr auto KEEPAWAY_SEARCH_CIRCLE_RADIUS = 0.5;
 
@@ -334,9 +391,9 @@ double rateKeepAwayPosition(const Point& keep_away_position, const World& world,
                            best_pass_so_far.speed());
 
     double enemy_receiver_proximity_risk =
-        calculateProximityRisk(keep_away_position, world.enemyTeam(), passing_config);
+        calculateProximityRisk(keep_away_position, world.enemyTeam(), passing_params);
     double intercept_risk =
-        calculateInterceptRisk(world.enemyTeam(), updated_best_pass, passing_config);
+        calculateInterceptRisk(world.enemyTeam(), updated_best_pass, passing_params);
     // We want to rate a keep away position more highly if it is lower risk, so subtract
     // from 1
     double combined_score = 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
@@ -352,6 +409,8 @@ void samplePassesForVisualization(const World& world,
                                   const TbotsProto::PassingConfig& passing_config,
                                   const std::optional<Pass>& best_pass_so_far)
 {
+    const PassingParams passing_params(passing_config);
+
     // number of rows and columns are configured in parameters.proto
     int num_cols = passing_config.cost_vis_config().num_cols();
     // this is for DivB field, for DivA, it would be num_cols * 3 / 4 as specified in
@@ -373,6 +432,7 @@ void samplePassesForVisualization(const World& world,
     double pass_not_too_close_costs;
 
     // We loop column wise (in the same order as how zones are defined)
+    std::vector<Point> cell_centres;
     for (int i = 0; i < num_cols; i++)
     {
         // x coordinate of the centre of the column
@@ -381,98 +441,111 @@ void samplePassesForVisualization(const World& world,
         {
             // y coordinate of the centre of the row
             double y = height * j + height / 2 - world.field().yLength() / 2;
-            Point curr_point(x, y);
-            auto pass = Pass::fromDestReceiveSpeed(world.ball().position(), curr_point,
-                                                   passing_config);
-
-            // default values
-            static_pos_quality_costs       = 1;
-            pass_friendly_capability_costs = 1;
-            pass_enemy_risk_costs          = 1;
-            enemy_proximity_costs          = 1;
-            enemy_interception_costs       = 1;
-            pass_shoot_score_costs         = 1;
-            receiver_position_costs        = 1;
-            keep_away_position_costs       = 1;
-            pass_forward_costs             = 1;
-            pass_not_too_close_costs       = 1;
-
-            // getStaticPositionQuality
-            if (passing_config.cost_vis_config().static_position_quality())
-            {
-                static_pos_quality_costs = getStaticPositionQuality(
-                    world.field(), pass.receiverPoint(), passing_config);
-            }
-
-            // ratePassForwardQuality
-            if (passing_config.cost_vis_config().pass_forward_quality())
-            {
-                pass_forward_costs = ratePassForwardQuality(pass, passing_config);
-            }
-
-            // ratePassNotTooClose
-            if (passing_config.cost_vis_config().pass_not_too_close_quality())
-            {
-                pass_not_too_close_costs = ratePassNotTooClose(pass, passing_config);
-            }
-
-            // ratePassFriendlyCapability
-            if (passing_config.cost_vis_config().pass_friendly_capability())
-            {
-                pass_friendly_capability_costs = ratePassFriendlyCapability(
-                    world.friendlyTeam(), pass, passing_config);
-            }
-
-            // ratePassEnemyRisk
-            if (passing_config.cost_vis_config().pass_enemy_risk())
-            {
-                pass_enemy_risk_costs =
-                    ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
-            }
-
-            // ratePassShootScore
-            if (passing_config.cost_vis_config().pass_shoot_score())
-            {
-                pass_shoot_score_costs = ratePassShootScore(
-                    world.field(), world.enemyTeam(), pass, passing_config);
-            }
-
-            // calculateInterceptRisk
-            if (passing_config.cost_vis_config().enemy_interception_risk())
-            {
-                enemy_interception_costs =
-                    calculateInterceptRisk(world.enemyTeam(), pass, passing_config);
-            }
-
-            // calculateProximityRisk
-            if (passing_config.cost_vis_config().enemy_proximity_risk())
-            {
-                enemy_proximity_costs =
-                    calculateProximityRisk(curr_point, world.enemyTeam(), passing_config);
-            }
-
-            // rateReceivingPosition
-            if (passing_config.cost_vis_config().receiver_position_score())
-            {
-                receiver_position_costs =
-                    rateReceivingPosition(world, pass, passing_config);
-            }
-
-            // rateKeepAwayPosition
-            if (passing_config.cost_vis_config().passer_position_score() &&
-                best_pass_so_far.has_value())
-            {
-                keep_away_position_costs =
-                    rateKeepAwayPosition(curr_point, world, best_pass_so_far.value(),
-                                         world.field().fieldBoundary(), passing_config);
-            }
-
-            costs.push_back(static_pos_quality_costs * pass_friendly_capability_costs *
-                            pass_enemy_risk_costs * enemy_proximity_costs *
-                            pass_shoot_score_costs * enemy_interception_costs *
-                            receiver_position_costs * keep_away_position_costs *
-                            pass_forward_costs * pass_not_too_close_costs);
+            cell_centres.emplace_back(x, y);
+        }
+    }
+
+    // The enemy robots blocking shots are the same for every cell, so the best shots
+    // from all the cells are found in one batch
+    std::vector<std::optional<Shot>> best_shots;
+    if (passing_config.cost_vis_config().pass_shoot_score())
+    {
+        best_shots = createEnemyGoalShotCalculator(world.field(), world.enemyTeam())
+                         .calcBestShotsOnGoal(cell_centres);
+    }
+
+    for (std::size_t cell = 0; cell < cell_centres.size(); cell++)
+    {
+        const Point& curr_point = cell_centres[cell];
+
+        auto pass = Pass::fromDestReceiveSpeed(world.ball().position(), curr_point,
+                                               passing_config);
+
+        // default values
+        static_pos_quality_costs       = 1;
+        pass_friendly_capability_costs = 1;
+        pass_enemy_risk_costs          = 1;
+        enemy_proximity_costs          = 1;
+        enemy_interception_costs       = 1;
+        pass_shoot_score_costs         = 1;
+        receiver_position_costs        = 1;
+        keep_away_position_costs       = 1;
+        pass_forward_costs             = 1;
+        pass_not_too_close_costs       = 1;
+
+        // getStaticPositionQuality
+        if (passing_config.cost_vis_config().static_position_quality())
+        {
+            static_pos_quality_costs = getStaticPositionQuality(
+                world.field(), pass.receiverPoint(), passing_params);
+        }
+
+        // ratePassForwardQuality
+        if (passing_config.cost_vis_config().pass_forward_quality())
+        {
+            pass_forward_costs = ratePassForwardQuality(pass, passing_params);
+        }
+
+        // ratePassNotTooClose
+        if (passing_config.cost_vis_config().pass_not_too_close_quality())
+        {
+            pass_not_too_close_costs = ratePassNotTooClose(pass, passing_params);
+        }
+
+        // ratePassFriendlyCapability
+        if (passing_config.cost_vis_config().pass_friendly_capability())
+        {
+            pass_friendly_capability_costs = ratePassFriendlyCapability(
+                world.friendlyTeam(), pass, passing_params);
+        }
+
+        // ratePassEnemyRisk
+        if (passing_config.cost_vis_config().pass_enemy_risk())
+        {
+            pass_enemy_risk_costs =
+                ratePassEnemyRisk(world.enemyTeam(), pass, passing_params);
         }
+
+        // ratePassShootScore
+        if (passing_config.cost_vis_config().pass_shoot_score())
+        {
+            pass_shoot_score_costs = ratePassShootScore(best_shots[cell], passing_params);
+        }
+
+        // calculateInterceptRisk
+        if (passing_config.cost_vis_config().enemy_interception_risk())
+        {
+            enemy_interception_costs =
+                calculateInterceptRisk(world.enemyTeam(), pass, passing_params);
+        }
+
+        // calculateProximityRisk
+        if (passing_config.cost_vis_config().enemy_proximity_risk())
+        {
+            enemy_proximity_costs =
+                calculateProximityRisk(curr_point, world.enemyTeam(), passing_params);
+        }
+
+        // rateReceivingPosition
+        if (passing_config.cost_vis_config().receiver_position_score())
+        {
+            receiver_position_costs = rateReceivingPosition(world, pass, passing_params);
+        }
+
+        // rateKeepAwayPosition
+        if (passing_config.cost_vis_config().passer_position_score() &&
+            best_pass_so_far.has_value())
+        {
+            keep_away_position_costs =
+                rateKeepAwayPosition(curr_point, world, best_pass_so_far.value(),
+                                     world.field().fieldBoundary(), passing_params);
+        }
+
+        costs.push_back(static_pos_quality_costs * pass_friendly_capability_costs *
+                        pass_enemy_risk_costs * enemy_proximity_costs *
+                        pass_shoot_score_costs * enemy_interception_costs *
+                        receiver_position_costs * keep_away_position_costs *
+                        pass_forward_costs * pass_not_too_close_costs);
     }
 
     LOG(VISUALIZE) << *createCostVisualization(costs, num_rows, num_cols);
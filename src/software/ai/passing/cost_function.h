@@ -4,7 +4,10 @@
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/parameters.pb.h"
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/shot.h"
 #include "software/ai/passing/pass.h"
+#include "software/ai/passing/passing_params.h"
 #include "software/math/math_functions.h"
 #include "software/util/make_enum/make_enum.hpp"
 #include "software/world/field.h"
@@ -16,26 +19,88 @@
  *
  * @param world The world in which to rate the pass
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the pass, with 1 being an
+ *         ideal pass, and 0 being the worst pass possible
+ */
+double ratePass(const World& world, const Pass& pass,
+                const PassingParams& passing_params);
+
+/**
+ * Calculate the quality of a given pass, finding the best shot from the receiver point
+ * of the pass with the given BestShotCalculator. The calculator can be shared by every
+ * pass rated against the same world.
+ *
+ * @param world The world in which to rate the pass
+ * @param pass The pass to rate
+ * @param best_shot_calculator A BestShotCalculator for shots on the enemy goal in the
+ * given world, as created by createEnemyGoalShotCalculator
+ * @param passing_params The passing parameters used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the pass, with 1 being an
+ *         ideal pass, and 0 being the worst pass possible
+ */
+double ratePass(const World& world, const Pass& pass,
+                const BestShotCalculator& best_shot_calculator,
+                const PassingParams& passing_params);
+
+/**
+ * Calculate the quality of a given pass, given the best shot on enemy goal from the
+ * receiver point of the pass
+ *
+ * @param world The world in which to rate the pass
+ * @param pass The pass to rate
+ * @param best_shot The best shot on enemy goal from the receiver point of the pass, or
+ * std::nullopt if there is no shot
+ * @param passing_params The passing parameters used for tuning
  *
  * @return A value in [0,1] representing the quality of the pass, with 1 being an
  *         ideal pass, and 0 being the worst pass possible
  */
 double ratePass(const World& world, const Pass& pass,
-                const TbotsProto::PassingConfig& passing_config);
+                const std::optional<Shot>& best_shot,
+                const PassingParams& passing_params);
 
 /**
  * Rate a pass based on the quality of the receiving position
  *
  * @param world The world in which to rate the pass
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
+ * @return A value in [0,1] representing the quality of the pass receiving
+ * position, with 1 indicating that the receiving position is ideal, and 0
+ * indicating that the pass will likely not be received.
+ */
+double rateReceivingPosition(const World& world, const Pass& pass,
+                             const PassingParams& passing_params);
+
+/**
+ * Rate a pass based on the quality of the receiving position, finding the best shot
+ * from the receiving position with the given BestShotCalculator
+ *
+ * @param world The world in which to rate the pass
+ * @param pass The pass to rate
+ * @param best_shot_calculator A BestShotCalculator for shots on the enemy goal in the
+ * given world, as created by createEnemyGoalShotCalculator
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] representing the quality of the pass receiving
  * position, with 1 indicating that the receiving position is ideal, and 0
  * indicating that the pass will likely not be received.
  */
 double rateReceivingPosition(const World& world, const Pass& pass,
-                             const TbotsProto::PassingConfig& passing_config);
+                             const BestShotCalculator& best_shot_calculator,
+                             const PassingParams& passing_params);
+
+/**
+ * Creates a BestShotCalculator for shots on the enemy goal, blocked by the enemy robots
+ *
+ * @param field The field we are playing on
+ * @param enemy_team The enemy team
+ * @return A BestShotCalculator for shots on the enemy goal
+ */
+BestShotCalculator createEnemyGoalShotCalculator(const Field& field,
+                                                 const Team& enemy_team);
 
 /**
  * Rate a point to shoot on enemy goal from
@@ -43,12 +108,24 @@ double rateReceivingPosition(const World& world, const Pass& pass,
  * @param shot_origin The point to shoot from
  * @param field The field we are playing on
  * @param enemy_team The enemy team
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] representing the quality of the shot, with 1 being
  *       an ideal shot, and 0 being a shot that will most likely be blocked.
  */
 double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_team,
-                const TbotsProto::PassingConfig& passing_config);
+                const PassingParams& passing_params);
+
+/**
+ * Rate a shot on enemy goal
+ *
+ * @param best_shot The best shot on enemy goal from the point to shoot from, or
+ * std::nullopt if there is no shot
+ * @param passing_params The passing parameters used for tuning
+ * @return A value in [0,1] representing the quality of the shot, with 1 being
+ *       an ideal shot, and 0 being a shot that will most likely be blocked.
+ */
+double rateShot(const std::optional<Shot>& best_shot,
+                const PassingParams& passing_params);
 
 /**
  * Rate pass based on the probability of scoring once we receive the pass
@@ -56,80 +133,125 @@ double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_
  * @param field The field we are playing on
  * @param enemy_team The enemy team
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  *
  * @return A value in [min_pass_shoot_score,1], with min_pass_shoot_score indicating that
  * it's impossible to score off of the pass, and 1 indicating that it is guaranteed to be
  * able to score off of the pass
  */
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
-                          const TbotsProto::PassingConfig& passing_config);
+                          const PassingParams& passing_params);
+
+/**
+ * Rate pass based on the probability of scoring once we receive the pass, finding the
+ * best shot from the receiver point of the pass with the given BestShotCalculator
+ *
+ * @param best_shot_calculator A BestShotCalculator for shots on the enemy goal, as
+ * created by createEnemyGoalShotCalculator
+ * @param pass The pass to rate
+ * @param passing_params The passing parameters used for tuning
+ *
+ * @return A value in [min_pass_shoot_score,1], with min_pass_shoot_score indicating that
+ * it's impossible to score off of the pass, and 1 indicating that it is guaranteed to be
+ * able to score off of the pass
+ */
+double ratePassShootScore(const BestShotCalculator& best_shot_calculator,
+                          const Pass& pass, const PassingParams& passing_params);
+
+/**
+ * Rate pass based on the probability of scoring once we receive the pass, given the
+ * best shot on enemy goal from the receiver point of the pass
+ *
+ * @param best_shot The best shot on enemy goal from the receiver point of the pass, or
+ * std::nullopt if there is no shot
+ * @param passing_params The passing parameters used for tuning
+ *
+ * @return A value in [min_pass_shoot_score,1], with min_pass_shoot_score indicating that
+ * it's impossible to score off of the pass, and 1 indicating that it is guaranteed to be
+ * able to score off of the pass
+ */
+double ratePassShootScore(const std::optional<Shot>& best_shot,
+                          const PassingParams& passing_params);
 
 /**
  * Calculates the risk of an enemy robot interfering with a given pass
  *
  * @param enemy_team The team of enemy robots
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
+ * @return A value in [0,1] indicating the quality of the pass based on the risk
+ *         that an enemy interfere with it, with 1 indicating the pass is guaranteed
+ *         to run without interference, and 0 indicating that the pass will certainly
+ *         be interfered with (and so is very poor)
+ */
+double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
+                         const PassingParams& passing_params);
+
+/**
+ * Calculates the risk of an enemy robot interfering with a given pass, given the risk
+ * of the pass being intercepted (e.g. as estimated by a PassSuccessEstimator)
+ *
+ * @param enemy_team The team of enemy robots
+ * @param pass The pass to rate
+ * @param passing_params The passing parameters used for tuning
+ * @param intercept_risk The probability in [0,1] that the pass is intercepted
  * @return A value in [0,1] indicating the quality of the pass based on the risk
  *         that an enemy interfere with it, with 1 indicating the pass is guaranteed
  *         to run without interference, and 0 indicating that the pass will certainly
  *         be interfered with (and so is very poor)
  */
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
-                         const TbotsProto::PassingConfig& passing_config);
+                         const PassingParams& passing_params, double intercept_risk);
 
 /**
  * Rate the pass based on if it moves the ball up the field or not
  * Passes moving the ball up the field are rated higher
  *
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] indicating the quality of the pass, where
  *        1 indicates the pass is ideal and 0 indicates the pass is bad as
  *        it passes back toward our friendly half.
  */
-double ratePassForwardQuality(const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config);
+double ratePassForwardQuality(const Pass& pass, const PassingParams& passing_params);
 
 /**
  * Encourage passes that are not too close to the passer
  * @param pass The pass to rate
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] indicating the quality of the pass, where
  *        1 indicates the pass is ideal and 0 indicates the pass is bad as
  *        it is too close to the passer.
  */
-double ratePassNotTooClose(const Pass& pass,
-                           const TbotsProto::PassingConfig& passing_config);
+double ratePassNotTooClose(const Pass& pass, const PassingParams& passing_params);
 
 /**
  * Calculates the likelihood that the given pass will be intercepted
  *
  * @param enemy_team The team of robots that we're worried about intercepting our pass
  * @param pass The pass we want to get the intercept probability for
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] indicating the probability that the given pass will be
  *         intercepted by a robot on the given team, with 1 indicating the pass is
  *         guaranteed to be intercepted, and 0 indicating it's impossible for the
  *         pass to be intercepted
  */
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config);
+                              const PassingParams& passing_params);
 
 /**
  * Calculates the likelihood that the given pass will be intercepted by a given robot
  *
  * @param enemy_robot The robot that might intercept our pass
  * @param pass The pass we want to get the intercept probability for
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] indicating the probability that the given pass will be
  *         intercepted by the given robot, with 1 indicating the pass is guaranteed to
  *         be intercepted, and 0 indicating it's impossible for the pass to be
  *         intercepted
  */
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
-                              const TbotsProto::PassingConfig& passing_config);
+                              const PassingParams& passing_params);
 
 
 /**
@@ -140,14 +262,14 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
  *
  * @param friendly_team The team of robots that might receive the given pass
  * @param pass The pass we want a robot to receive
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  *
  * @return A value in [0,1] indicating how likely it would be for a robot on the
  *         friendly team to receive the given pass, with 1 being very likely, 0
  *         being impossible
  */
 double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
-                                  const TbotsProto::PassingConfig& passing_config);
+                                  const PassingParams& passing_params);
 
 /**
  * Calculates the static position quality for a given position on a given field
@@ -158,24 +280,24 @@ double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
  *
  * @param field The field on which to calculate the static position quality
  * @param position The position on the field at which to calculate the quality
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  *
  * @return A value in [0,1] representing the quality of the given point on the given
  *         field, with a higher value representing a more desirable position
  */
 double getStaticPositionQuality(const Field& field, const Point& position,
-                                const TbotsProto::PassingConfig& passing_config);
+                                const PassingParams& passing_params);
 
 /**
  * Returns a function that increases as the point approaches enemy robots.
  *
  * @param point a Point
  * @param enemy_team the enemy team
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return a measure of how close the point is to one or more enemy robots
  */
 double calculateProximityRisk(const Point& point, const Team& enemy_team,
-                              const TbotsProto::PassingConfig& passing_config);
+                              const PassingParams& passing_params);
 
 /**
  * Calculate the quality of a position for staying away from enemy robots
@@ -186,14 +308,14 @@ double calculateProximityRisk(const Point& point, const Team& enemy_team,
  * @param best_pass_so_far The best pass so far used for rating passing opportunity of
  * the keep away position
  * @param dribbling_bounds The bounds of the area the robot can dribble in
- * @param passing_config The passing config used for tuning
+ * @param passing_params The passing parameters used for tuning
  * @return A value in [0,1] representing the quality of the passer position, with 1
  *        being an ideal position to pass from, and 0 being a poor position to pass from.
  */
 double rateKeepAwayPosition(const Point& keep_away_position, const World& world,
                             const Pass& best_pass_so_far,
                             const Rectangle& dribbling_bounds,
-                            const TbotsProto::PassingConfig& passing_config);
+                            const PassingParams& passing_params);
 
 /**
  * Sample passes at different points on the field and rate them, similar to ratePass, to
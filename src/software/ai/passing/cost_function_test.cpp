@@ -19,12 +19,14 @@ class PassingEvaluationTest : public testing::Test
         passing_config.set_max_pass_speed_m_per_s(5.5);
         passing_config.set_pass_delay_sec(0.0);
         passing_config.set_receiver_ideal_min_distance_meters(0.1);
+        passing_params         = PassingParams(passing_config);
         avg_desired_pass_speed = 3.9;
     }
 
     double avg_desired_pass_speed;
 
     TbotsProto::PassingConfig passing_config;
+    PassingParams passing_params = PassingParams(TbotsProto::PassingConfig());
 };
 
 // This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
@@ -102,7 +104,7 @@ TEST_F(PassingEvaluationTest, DISABLED_ratePass_speed_test)
     auto start_time = std::chrono::system_clock::now();
     for (auto pass : passes)
     {
-        ratePass(*world, pass, passing_config);
+        ratePass(*world, pass, passing_params);
     }
 
     double duration_ms = ::TestUtil::millisecondsSince(start_time);
@@ -134,7 +136,7 @@ TEST_F(PassingEvaluationTest, ratePass_enemy_directly_on_pass_trajectory)
     });
     world->updateEnemyTeamState(enemy_team);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.0);
     EXPECT_LE(pass_rating, 0.11);
 }
@@ -162,7 +164,7 @@ TEST_F(PassingEvaluationTest, ratePass_one_friendly_marked_and_one_friendly_free
     });
     world->updateEnemyTeamState(enemy_team);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.65);
     EXPECT_LE(pass_rating, 0.9);
 }
@@ -188,7 +190,7 @@ TEST_F(PassingEvaluationTest, ratePass_only_friendly_marked)
     });
     world->updateEnemyTeamState(enemy_team);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.0);
     EXPECT_LE(pass_rating, 0.1);
 }
@@ -214,7 +216,7 @@ TEST_F(PassingEvaluationTest, ratePass_cross_over_enemy_goal_defender_somewhat_n
     });
     world->updateEnemyTeamState(enemy_team);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.5);
     EXPECT_LE(pass_rating, 1.0);
 }
@@ -240,7 +242,7 @@ TEST_F(PassingEvaluationTest, ratePass_cross_over_enemy_net_goalie_in_net)
     });
     world->updateEnemyTeamState(enemy_team);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
 
     EXPECT_GE(pass_rating, 0.68);
     EXPECT_LE(pass_rating, 1.0);
@@ -260,7 +262,7 @@ TEST_F(PassingEvaluationTest, ratePass_cross_over_enemy_net)
 
     Pass pass({3, 2}, {2, -2}, avg_desired_pass_speed);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
 
     EXPECT_LE(0.8, pass_rating);
     EXPECT_GE(1.0, pass_rating);
@@ -280,7 +282,7 @@ TEST_F(PassingEvaluationTest, ratePass_corner_kick_to_center_no_enemies)
 
     Pass pass(world->field().enemyCornerPos(), {0, 0}, avg_desired_pass_speed);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_LE(0.8, pass_rating);
     EXPECT_GE(1.0, pass_rating);
 }
@@ -314,7 +316,7 @@ TEST_F(PassingEvaluationTest, ratePass_corner_kick_to_marked_robot_at_field_cent
 
     Pass pass(world->field().enemyCornerPos(), {1.8, 0.8}, 4.8);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.1);
     EXPECT_LE(pass_rating, 0.7);
 }
@@ -333,7 +335,7 @@ TEST_F(PassingEvaluationTest, ratePass_below_min_ball_speed)
 
     Pass pass({3, 0}, {2, 0}, passing_config.min_pass_speed_m_per_s() - 0.1);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_LE(0.0, pass_rating);
     EXPECT_GE(0.05, pass_rating);
 }
@@ -352,7 +354,7 @@ TEST_F(PassingEvaluationTest, ratePass_above_max_ball_speed)
 
     Pass pass({3, 0}, {2, 0}, passing_config.max_pass_speed_m_per_s() + 0.1);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_LE(0.0, pass_rating);
     EXPECT_GE(0.05, pass_rating);
 }
@@ -382,7 +384,7 @@ TEST_F(PassingEvaluationTest, ratePass_attempting_to_pass_and_receive_no_shot)
     // receiving the ball
     Pass pass({0, 0}, {1, 0}, avg_desired_pass_speed);
 
-    double pass_rating = ratePass(*world, pass, passing_config);
+    double pass_rating = ratePass(*world, pass, passing_params);
     EXPECT_GE(pass_rating, 0.4);
     EXPECT_LE(pass_rating, 1.0);
 }
@@ -396,7 +398,7 @@ TEST_F(PassingEvaluationTest, ratePassShootScore_no_robots_and_directly_facing_g
     Field field = Field::createSSLDivisionBField();
     Pass pass({4, 0}, {3.5, 0}, 1);
 
-    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_config);
+    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_params);
     EXPECT_LE(0.95, pass_shoot_score);
     EXPECT_GE(1, pass_shoot_score);
 }
@@ -415,7 +417,7 @@ TEST_F(PassingEvaluationTest,
     Field field = Field::createSSLDivisionBField();
     Pass pass({3.5, 0}, {3, 0}, 1);
 
-    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_config);
+    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_params);
     EXPECT_GE(pass_shoot_score, 0.9);
     EXPECT_LE(pass_shoot_score, 1.0);
 }
@@ -433,8 +435,8 @@ TEST_F(PassingEvaluationTest, ratePassShootScore_no_open_shot_to_goal)
     Pass pass({1, 1}, {0, 0}, 1);
 
     // Make the minimum score that ratePassShootScore can return 0.0
-    passing_config.set_min_pass_shoot_score(0.0);
-    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_config);
+    passing_params.min_pass_shoot_score = 0.0;
+    double pass_shoot_score = ratePassShootScore(field, enemy_team, pass, passing_params);
 
     EXPECT_LE(0, pass_shoot_score);
     EXPECT_GE(0.2, pass_shoot_score);
@@ -455,7 +457,7 @@ TEST_F(PassingEvaluationTest, ratePassShootScore_decreasing_open_angle_to_goal)
     });
     std::vector<Robot> robots_on_field = {};
     double pass_shoot_score0 =
-        ratePassShootScore(field, enemy_team, pass, passing_config);
+        ratePassShootScore(field, enemy_team, pass, passing_params);
     enemy_team.updateRobots({
         Robot(0, {3.5, 0.15}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
               Timestamp::fromSeconds(0)),
@@ -463,7 +465,7 @@ TEST_F(PassingEvaluationTest, ratePassShootScore_decreasing_open_angle_to_goal)
               Timestamp::fromSeconds(0)),
     });
     double pass_shoot_score1 =
-        ratePassShootScore(field, enemy_team, pass, passing_config);
+        ratePassShootScore(field, enemy_team, pass, passing_params);
     enemy_team.updateRobots({
         Robot(0, {3.5, 0.2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
               Timestamp::fromSeconds(0)),
@@ -471,7 +473,7 @@ TEST_F(PassingEvaluationTest, ratePassShootScore_decreasing_open_angle_to_goal)
               Timestamp::fromSeconds(0)),
     });
     double pass_shoot_score2 =
-        ratePassShootScore(field, enemy_team, pass, passing_config);
+        ratePassShootScore(field, enemy_team, pass, passing_params);
     EXPECT_LT(pass_shoot_score0, pass_shoot_score1);
     EXPECT_LT(pass_shoot_score1, pass_shoot_score2);
 }
@@ -481,7 +483,7 @@ TEST_F(PassingEvaluationTest, ratePassEnemyRisk_no_enemy_robots)
     Team enemy_team(Duration::fromSeconds(10));
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_config);
+    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_params);
     EXPECT_EQ(1, pass_rating);
 }
 
@@ -496,7 +498,7 @@ TEST_F(PassingEvaluationTest, ratePassEnemyRisk_no_robots_near)
     });
     Pass pass({0, 0}, {10, 10}, 4);
 
-    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_config);
+    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_params);
     EXPECT_GE(pass_rating, 0.9);
     EXPECT_LE(pass_rating, 1.0);
 }
@@ -508,7 +510,7 @@ TEST_F(PassingEvaluationTest, ratePassEnemyRisk_one_robot_near_receiver_point)
                                    AngularVelocity::zero(), Timestamp::fromSeconds(0))});
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_config);
+    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_params);
     EXPECT_LE(0, pass_rating);
     EXPECT_GE(0.1, pass_rating);
 }
@@ -520,7 +522,7 @@ TEST_F(PassingEvaluationTest, ratePassEnemyRisk_robot_near_center_of_pass)
                                    AngularVelocity::zero(), Timestamp::fromSeconds(0))});
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_config);
+    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_params);
     EXPECT_LE(0, pass_rating);
     EXPECT_GE(0.1, pass_rating);
 }
@@ -535,7 +537,7 @@ TEST_F(PassingEvaluationTest,
                                    AngularVelocity::zero(), Timestamp::fromSeconds(0))});
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_config);
+    double pass_rating = ratePassEnemyRisk(enemy_team, pass, passing_params);
     EXPECT_LE(0, pass_rating);
     EXPECT_GE(0.1, pass_rating);
 }
@@ -545,7 +547,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_for_team_no_robots)
     Team enemy_team(Duration::fromSeconds(10));
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_params);
     EXPECT_EQ(0, intercept_risk);
 }
 
@@ -563,7 +565,7 @@ TEST_F(PassingEvaluationTest,
     });
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_params);
     EXPECT_LE(0.9, intercept_risk);
     EXPECT_GE(1, intercept_risk);
 }
@@ -582,7 +584,7 @@ TEST_F(PassingEvaluationTest,
     });
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_params);
     EXPECT_LE(0.9, intercept_risk);
     EXPECT_GE(1, intercept_risk);
 }
@@ -595,7 +597,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_for_robot_sitting_on_pass_t
                       Timestamp::fromSeconds(0));
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0.9, intercept_risk);
     EXPECT_GE(1, intercept_risk);
 }
@@ -609,7 +611,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_for_robot_just_off_pass_tra
                       Timestamp::fromSeconds(0));
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0.9, intercept_risk);
     EXPECT_GE(1, intercept_risk);
 }
@@ -622,7 +624,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_for_robot_far_away_from_tra
                       Timestamp::fromSeconds(0));
     Pass pass({0, 0}, {10, 10}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0, intercept_risk);
     EXPECT_GE(0.1, intercept_risk);
 }
@@ -635,7 +637,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_robot_at_far_end_of_field)
                       Timestamp::fromSeconds(0));
     Pass pass({3, -3}, {3, 3}, 3);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0, intercept_risk);
     EXPECT_GE(0.1, intercept_risk);
 }
@@ -648,7 +650,7 @@ TEST_F(PassingEvaluationTest, calculateInterceptRisk_enemy_moving_far_away)
                       Timestamp::fromSeconds(0));
     Pass pass({1, 1}, {4, 4}, 2);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0, intercept_risk);
     EXPECT_GE(0.1, intercept_risk);
 }
@@ -665,7 +667,7 @@ TEST_F(PassingEvaluationTest,
                       AngularVelocity::zero(), Timestamp::fromSeconds(0));
     Pass pass({0, 0}, {0, 2}, 0.5);
 
-    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_robot, pass, passing_params);
     EXPECT_LE(0.5, intercept_risk);
     EXPECT_GE(1, intercept_risk);
 }
@@ -680,10 +682,10 @@ TEST_F(PassingEvaluationTest, rateReceivingPosition_receiving_position_openness)
     Pass pass_blocked_by_enemy({2, 2}, {2, -2},
                                passing_config.max_pass_speed_m_per_s() - 0.2);
     double pass_blocked_by_enemy_rating =
-        rateReceivingPosition(*world, pass_blocked_by_enemy, passing_config);
+        rateReceivingPosition(*world, pass_blocked_by_enemy, passing_params);
 
     Pass pass_open({2, 2}, {3, -2}, passing_config.max_pass_speed_m_per_s() - 0.2);
-    double pass_open_rating = rateReceivingPosition(*world, pass_open, passing_config);
+    double pass_open_rating = rateReceivingPosition(*world, pass_open, passing_params);
 
     EXPECT_GT(pass_open_rating, pass_blocked_by_enemy_rating);
     // Blocked receiving position should receive a low score
@@ -705,16 +707,42 @@ TEST_F(PassingEvaluationTest, rateReceivingPosition_opportunity_to_take_shot)
     Pass receiver_shot_blocked(world->field().enemyCornerPos(), {2.8, 0.5},
                                passing_config.max_pass_speed_m_per_s() - 0.2);
     double receiver_shot_blocked_rating =
-        rateReceivingPosition(*world, receiver_shot_blocked, passing_config);
+        rateReceivingPosition(*world, receiver_shot_blocked, passing_params);
 
     Pass receiver_shot_open(world->field().enemyCornerPos(), {2.3, -0.4},
                             passing_config.max_pass_speed_m_per_s() - 0.2);
     double receiver_shot_open_rating =
-        rateReceivingPosition(*world, receiver_shot_open, passing_config);
+        rateReceivingPosition(*world, receiver_shot_open, passing_params);
 
     EXPECT_GT(receiver_shot_open_rating, receiver_shot_blocked_rating);
 }
 
+TEST_F(PassingEvaluationTest, rating_with_shared_best_shot_calculator_is_unchanged)
+{
+    auto world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(2.8, 0.5), Point(2.3, -0.4)},
+                                          Timestamp::fromSeconds(0));
+    ::TestUtil::setEnemyRobotPositions(world, {Point(3.3, 0.5), Point(3.3, 0.32)},
+                                       Timestamp::fromSeconds(0));
+    const BestShotCalculator best_shot_calculator =
+        createEnemyGoalShotCalculator(world->field(), world->enemyTeam());
+
+    for (const Point& receiver_point : {Point(2.8, 0.5), Point(2.3, -0.4), Point(0, 0)})
+    {
+        Pass pass(world->field().enemyCornerPos(), receiver_point,
+                  passing_config.max_pass_speed_m_per_s() - 0.2);
+
+        EXPECT_EQ(ratePass(*world, pass, passing_params),
+                  ratePass(*world, pass, best_shot_calculator, passing_params));
+        EXPECT_EQ(rateReceivingPosition(*world, pass, passing_params),
+                  rateReceivingPosition(*world, pass, best_shot_calculator,
+                                        passing_params));
+        EXPECT_EQ(ratePassShootScore(world->field(), world->enemyTeam(), pass,
+                                     passing_params),
+                  ratePassShootScore(best_shot_calculator, pass, passing_params));
+    }
+}
+
 TEST_F(PassingEvaluationTest, calculateProximityRisk_distance_to_a_single_enemy_robot)
 {
     // Compare two positions, one in close proximity to an enemy, and the other farther
@@ -723,9 +751,9 @@ TEST_F(PassingEvaluationTest, calculateProximityRisk_distance_to_a_single_enemy_
     ::TestUtil::setEnemyRobotPositions(world, {Point(2, -2)}, Timestamp::fromSeconds(0));
 
     double closer_proximity_risk =
-        calculateProximityRisk(Point(2.1, -2), world->enemyTeam(), passing_config);
+        calculateProximityRisk(Point(2.1, -2), world->enemyTeam(), passing_params);
     double farther_proximity_risk =
-        calculateProximityRisk(Point(2.5, -2), world->enemyTeam(), passing_config);
+        calculateProximityRisk(Point(2.5, -2), world->enemyTeam(), passing_params);
 
     // Farther point should have a lower risk
     EXPECT_LE(farther_proximity_risk, closer_proximity_risk);
@@ -741,13 +769,13 @@ TEST_F(PassingEvaluationTest, calculateProximityRisk_distance_to_a_multiple_enem
     ::TestUtil::setEnemyRobotPositions(
         world, {Point(2, -1.8), Point(2, -2), Point(2, -2.2)}, Timestamp::fromSeconds(0));
     double multiple_enemy_robots_risk =
-        calculateProximityRisk(Point(1.7, -2), world->enemyTeam(), passing_config);
+        calculateProximityRisk(Point(1.7, -2), world->enemyTeam(), passing_params);
 
     // One close, two farther away
     ::TestUtil::setEnemyRobotPositions(
         world, {Point(2, -2), Point(4, -2), Point(4, -2.2)}, Timestamp::fromSeconds(0));
     double single_enemy_robots_risk =
-        calculateProximityRisk(Point(1.7, -2), world->enemyTeam(), passing_config);
+        calculateProximityRisk(Point(1.7, -2), world->enemyTeam(), passing_params);
 
     EXPECT_LE(single_enemy_robots_risk, multiple_enemy_robots_risk);
 }
@@ -759,7 +787,7 @@ TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_no_robots_on_team)
     Pass pass({0, 0}, {1, 1}, 10);
 
     // If there are no robots on the team, then there is no way we can receive a pass
-    EXPECT_EQ(0, ratePassFriendlyCapability(team, pass, passing_config));
+    EXPECT_EQ(0, ratePassFriendlyCapability(team, pass, passing_params));
 }
 
 TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_pass_speed_0)
@@ -773,7 +801,7 @@ TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_pass_speed_0)
     Pass pass({0, 0}, {1, 1}, 0);
 
     // If there are no robots on the team, then there is no way we can receive a pass
-    EXPECT_EQ(0, ratePassFriendlyCapability(team, pass, passing_config));
+    EXPECT_EQ(0, ratePassFriendlyCapability(team, pass, passing_params));
 }
 
 TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_one_robot_near_pass_one_far_away)
@@ -789,8 +817,8 @@ TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_one_robot_near_pass_one
     Pass pass({0, 0}, {15, -10.1}, 10);
 
     // There should be a very high probability that we can receive this pass
-    EXPECT_LE(0.9, ratePassFriendlyCapability(team, pass, passing_config));
-    EXPECT_GE(1, ratePassFriendlyCapability(team, pass, passing_config));
+    EXPECT_LE(0.9, ratePassFriendlyCapability(team, pass, passing_params));
+    EXPECT_GE(1, ratePassFriendlyCapability(team, pass, passing_params));
 }
 
 TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_should_ignore_passer_robot)
@@ -812,7 +840,7 @@ TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_should_ignore_passer_ro
     Team team({passer, potential_receiver}, Duration::fromSeconds(10));
     Pass pass({2, -2}, {0, 0}, 10);
 
-    double friendly_capability = ratePassFriendlyCapability(team, pass, passing_config);
+    double friendly_capability = ratePassFriendlyCapability(team, pass, passing_params);
     EXPECT_GE(friendly_capability, 0);
     EXPECT_LE(friendly_capability, 0.05);
 }
@@ -830,8 +858,8 @@ TEST_F(PassingEvaluationTest,
                AngularVelocity::fromDegrees(0), Timestamp::fromSeconds(0))});
     Pass pass({0, 0}, {1, 1}, 10);
 
-    EXPECT_GE(0.1, ratePassFriendlyCapability(team, pass, passing_config));
-    EXPECT_LE(0, ratePassFriendlyCapability(team, pass, passing_config));
+    EXPECT_GE(0.1, ratePassFriendlyCapability(team, pass, passing_params));
+    EXPECT_LE(0, ratePassFriendlyCapability(team, pass, passing_params));
 }
 
 TEST_F(PassingEvaluationTest,
@@ -847,8 +875,8 @@ TEST_F(PassingEvaluationTest,
                AngularVelocity::fromDegrees(0), Timestamp::fromSeconds(5))});
     Pass pass({100, 100}, {120, 105}, 1);
 
-    EXPECT_LE(0.9, ratePassFriendlyCapability(team, pass, passing_config));
-    EXPECT_GE(1, ratePassFriendlyCapability(team, pass, passing_config));
+    EXPECT_LE(0.9, ratePassFriendlyCapability(team, pass, passing_params));
+    EXPECT_GE(1, ratePassFriendlyCapability(team, pass, passing_params));
 }
 
 TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_single_robot_cant_turn_in_time)
@@ -861,8 +889,8 @@ TEST_F(PassingEvaluationTest, ratePassFriendlyCapability_single_robot_cant_turn_
                Timestamp::fromSeconds(0))});
     Pass pass({0, 0}, {1, 0}, 6);
 
-    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_config), 0.0);
-    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_config), 0.1);
+    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_params), 0.0);
+    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_params), 0.1);
 }
 
 TEST_F(PassingEvaluationTest,
@@ -875,8 +903,8 @@ TEST_F(PassingEvaluationTest,
         {Robot(0, {1, 0}, {0, 0}, pass.receiverOrientation(),
                AngularVelocity::fromDegrees(0), Timestamp::fromSeconds(0))});
 
-    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_config), 0.80);
-    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_config), 1.0);
+    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_params), 0.80);
+    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_params), 1.0);
 }
 
 
@@ -885,10 +913,10 @@ TEST_F(PassingEvaluationTest, getStaticPositionQuality_on_field_quality)
     Field f = Field::createSSLDivisionBField();
 
     // Check that the static quality is basically 0 at the edge of the field
-    EXPECT_LE(getStaticPositionQuality(f, Point(-4.5, 0), passing_config), 0.13);
-    EXPECT_LE(getStaticPositionQuality(f, Point(4.5, 0), passing_config), 0.13);
-    EXPECT_LE(getStaticPositionQuality(f, Point(0, -3.0), passing_config), 0.13);
-    EXPECT_LE(getStaticPositionQuality(f, Point(0, 3.0), passing_config), 0.13);
+    EXPECT_LE(getStaticPositionQuality(f, Point(-4.5, 0), passing_params), 0.13);
+    EXPECT_LE(getStaticPositionQuality(f, Point(4.5, 0), passing_params), 0.13);
+    EXPECT_LE(getStaticPositionQuality(f, Point(0, -3.0), passing_params), 0.13);
+    EXPECT_LE(getStaticPositionQuality(f, Point(0, 3.0), passing_params), 0.13);
 }
 
 TEST_F(PassingEvaluationTest, getStaticPositionQuality_near_own_goal_quality)
@@ -896,7 +924,7 @@ TEST_F(PassingEvaluationTest, getStaticPositionQuality_near_own_goal_quality)
     Field f = Field::createSSLDivisionBField();
 
     // Check that we have a static quality of almost 0 near our goal
-    EXPECT_LE(getStaticPositionQuality(f, Point(-4.0, 0), passing_config), 0.14);
+    EXPECT_LE(getStaticPositionQuality(f, Point(-4.0, 0), passing_params), 0.14);
 }
 
 TEST_F(PassingEvaluationTest, getStaticPositionQuality_near_enemy_goal_quality)
@@ -904,12 +932,12 @@ TEST_F(PassingEvaluationTest, getStaticPositionQuality_near_enemy_goal_quality)
     Field f = Field::createSSLDivisionBField();
 
     // Check that we have a large static quality near the enemy goal
-    EXPECT_GE(getStaticPositionQuality(f, Point(3.0, 0), passing_config), 0.80);
+    EXPECT_GE(getStaticPositionQuality(f, Point(3.0, 0), passing_params), 0.80);
 
     // But we should have basically 0 static quality too close to the enemy goal,
     // as there is a defense area around the net that we cannot pass to
-    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.3, 1.9), passing_config), 0.0, 0.1);
-    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.3, -1.9), passing_config), 0.0, 0.1);
-    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.4, 1.9), passing_config), 0.0, 0.1);
-    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.4, -1.9), passing_config), 0.0, 0.1);
+    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.3, 1.9), passing_params), 0.0, 0.1);
+    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.3, -1.9), passing_params), 0.0, 0.1);
+    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.4, 1.9), passing_params), 0.0, 0.1);
+    EXPECT_NEAR(getStaticPositionQuality(f, Point(4.4, -1.9), passing_params), 0.0, 0.1);
 }
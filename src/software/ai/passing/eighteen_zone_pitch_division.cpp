@@ -17,12 +17,13 @@ EighteenZonePitchDivision::EighteenZonePitchDivision(const Field& field)
         {
             pitch_division_.emplace_back(Rectangle(
                 Point(pos_x, pos_y), Point(pos_x + zone_width, pos_y - zone_height)));
+            zone_bounds_.emplace_back(Aabb::fromRectangle(pitch_division_.back()));
         }
     }
 
     constexpr auto enum_values = reflective_enum::values<EighteenZoneId>();
     zones_                     = std::vector(enum_values.begin(), enum_values.end());
-    field_lines_               = std::make_shared<Rectangle>(field.fieldLines());
+    field_lines_               = Aabb::fromRectangle(field.fieldLines());
 }
 
 const Rectangle& EighteenZonePitchDivision::getZone(EighteenZoneId zone_id) const
@@ -32,14 +33,18 @@ const Rectangle& EighteenZonePitchDivision::getZone(EighteenZoneId zone_id) cons
 
 EighteenZoneId EighteenZonePitchDivision::getZoneId(const Point& position) const
 {
-    if (!contains(*field_lines_, position))
+    if (!contains(field_lines_, position))
     {
         throw std::invalid_argument("requested position not on field!");
     }
 
     auto zone_id = *std::find_if(zones_.begin(), zones_.end(),
                                  [this, position](const EighteenZoneId& id)
-                                 { return contains(getZone(id), position); });
+                                 {
+                                     return contains(
+                                         zone_bounds_[static_cast<unsigned>(id)],
+                                         position);
+                                 });
     return zone_id;
 }
 
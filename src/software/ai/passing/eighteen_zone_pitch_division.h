@@ -1,8 +1,9 @@
 #pragma once
-#include <memory>
+#include <vector>
 
 #include "software/ai/passing/field_pitch_division.h"
 #include "software/geom/rectangle.h"
+#include "software/geom/value_shapes.h"
 #include "software/util/make_enum/make_enum.hpp"
 
 // clang-format off
@@ -47,7 +48,9 @@ class EighteenZonePitchDivision : public FieldPitchDivision<EighteenZoneId>
     EighteenZoneId getZoneId(const Point& position) const override;
 
    private:
-    std::shared_ptr<Rectangle> field_lines_;
+    Aabb field_lines_;
     std::vector<Rectangle> pitch_division_;
+    // The zones as Aabbs, in the same order as pitch_division_, for getZoneId
+    std::vector<Aabb> zone_bounds_;
     std::vector<EighteenZoneId> zones_;
 };
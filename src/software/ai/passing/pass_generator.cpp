@@ -2,19 +2,26 @@
 
 #include <iomanip>
 
+#include "software/ai/profiling/ai_tick_profiler.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/logger/logger.h"
 
 PassGenerator::PassGenerator(const TbotsProto::PassingConfig& passing_config)
     : optimizer_(optimizer_param_weights),
       random_num_gen_(RNG_SEED),
-      passing_config_(passing_config)
+      passing_config_(passing_config),
+      pass_success_estimator_(passing_config)
 {
 }
 
 PassWithRating PassGenerator::getBestPass(const World& world,
+                                          const PassingParams& passing_params,
+                                          WorkerPool& worker_pool,
                                           const std::vector<RobotId>& robots_to_ignore)
 {
+    ScopedAiStageTimer pass_generation_timer(AiTickStage::PASS_GENERATION);
+
     auto receiving_positions_map =
         sampleReceivingPositionsPerRobot(world, robots_to_ignore);
 
@@ -26,7 +33,9 @@ PassWithRating PassGenerator::getBestPass(const World& world,
     }
 
     // Optimize the receiving positions for each robot and get the best pass
-    PassWithRating best_pass = optimizeReceivingPositions(world, receiving_positions_map);
+    PassWithRating best_pass =
+        optimizeReceivingPositions(world, passing_params, worker_pool,
+                                   receiving_positions_map);
 
     // Visualize the sampled passes and the best pass
     if (passing_config_.pass_gen_vis_config().visualize_sampled_passes())
@@ -119,42 +128,71 @@ std::map<RobotId, std::vector<Point>> PassGenerator::sampleReceivingPositionsPer
 }
 
 PassWithRating PassGenerator::optimizeReceivingPositions(
-    const World& world,
+    const World& world, const PassingParams& passing_params, WorkerPool& worker_pool,
     const std::map<RobotId, std::vector<Point>>& receiving_positions_map)
 {
+    // The enemy robots blocking shots from the receiver points are the same for every
+    // pass rated in this call
+    const BestShotCalculator best_shot_calculator =
+        createEnemyGoalShotCalculator(world.field(), world.enemyTeam());
+
     // The objective function we minimize in gradient descent to improve each pass
     // that we're optimizing
     const auto objective_function =
-        [this, &world](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array)
+        [&world, &passing_params, &best_shot_calculator](
+            const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array)
     {
         // get a pass with the new appropriate speed using the new destination
         return ratePass(world,
-                        Pass::fromDestReceiveSpeed(world.ball().position(),
-                                                   Point(pass_array[0], pass_array[1]),
-                                                   passing_config_),
-                        passing_config_);
+                        Pass::fromDestReceiveSpeed(
+                            world.ball().position(), Point(pass_array[0], pass_array[1]),
+                            passing_params.max_receive_speed_m_per_s,
+                            passing_params.min_pass_speed_m_per_s,
+                            passing_params.max_pass_speed_m_per_s),
+                        best_shot_calculator, passing_params);
     };
 
-    PassWithRating best_pass{Pass(Point(), Point(), 1.0), -1.0};
+    StageDeadline deadline(AiStage::PASS_GENERATION);
+
+    std::vector<PassWithRating> best_passes;
     for (const auto& [robot_id, receiving_positions] : receiving_positions_map)
     {
-        PassWithRating best_pass_for_robot{Pass(Point(), Point(), 1.0), -1.0};
+        std::vector<Pass> optimized_passes;
+        std::vector<Point> optimized_receiver_points;
         for (const Point& receiving_position : receiving_positions)
         {
+            // Once we are out of time, only optimize one pass to each robot, so that
+            // the best pass so far is still considered for every robot
+            if (!optimized_passes.empty() && deadline.hasExpired())
+            {
+                break;
+            }
+
             auto optimized_receiving_pos_array = optimizer_.maximize(
                 objective_function, {receiving_position.x(), receiving_position.y()},
                 passing_config_.number_of_gradient_descent_steps_per_iter());
 
             // get a pass with the new appropriate speed using the optimized destination
-            Pass optimized_pass = Pass::fromDestReceiveSpeed(
+            optimized_passes.push_back(Pass::fromDestReceiveSpeed(
                 world.ball().position(),
                 Point(optimized_receiving_pos_array[0], optimized_receiving_pos_array[1]),
-                passing_config_);
-            double score = ratePass(world, optimized_pass, passing_config_);
+                passing_config_));
+            optimized_receiver_points.push_back(optimized_passes.back().receiverPoint());
+        }
+
+        // Rate the optimized passes with the best shots from all of their receiver
+        // points found in one batch
+        const std::vector<std::optional<Shot>> best_shots =
+            best_shot_calculator.calcBestShotsOnGoal(optimized_receiver_points);
+        PassWithRating best_pass_for_robot{Pass(Point(), Point(), 1.0), -1.0};
+        for (std::size_t i = 0; i < optimized_passes.size(); i++)
+        {
+            double score =
+                ratePass(world, optimized_passes[i], best_shots[i], passing_params);
 
             if (score > best_pass_for_robot.rating)
             {
-                best_pass_for_robot = PassWithRating{optimized_pass, score};
+                best_pass_for_robot = PassWithRating{optimized_passes[i], score};
             }
         }
 
@@ -170,11 +208,57 @@ PassWithRating PassGenerator::optimizeReceivingPositions(
             previous_best_receiving_positions_.erase(robot_id);
         }
 
-        if (best_pass_for_robot.rating > best_pass.rating)
+        best_passes.push_back(best_pass_for_robot);
+    }
+
+    const auto has_lower_rating = [](const PassWithRating& a, const PassWithRating& b)
+    { return a.rating < b.rating; };
+
+    // Re-rate the best few passes with the intercept risk estimated by simulating
+    // them, which is more accurate than the heuristic used while optimizing for chips
+    // and fast enemy robots, but too slow to run on every pass
+    const std::size_t num_top_candidates =
+        std::min(static_cast<std::size_t>(
+                     passing_config_.pass_success_num_top_candidates()),
+                 best_passes.size());
+    if (num_top_candidates > 0 && !deadline.hasExpired())
+    {
+        std::partial_sort(best_passes.begin(), best_passes.begin() + num_top_candidates,
+                          best_passes.end(),
+                          [&](const PassWithRating& a, const PassWithRating& b)
+                          { return has_lower_rating(b, a); });
+
+        std::vector<Pass> top_passes;
+        for (std::size_t i = 0; i < num_top_candidates; i++)
+        {
+            top_passes.push_back(best_passes[i].pass);
+        }
+        const std::vector<double> success_probabilities =
+            pass_success_estimator_.estimateSuccessProbabilities(world, top_passes,
+                                                                 worker_pool);
+
+        for (std::size_t i = 0; i < num_top_candidates; i++)
         {
-            best_pass = best_pass_for_robot;
+            PassWithRating& pass_with_rating = best_passes[i];
+            const double heuristic_enemy_rating = ratePassEnemyRisk(
+                world.enemyTeam(), pass_with_rating.pass, passing_params);
+            if (heuristic_enemy_rating > 0)
+            {
+                pass_with_rating.rating =
+                    pass_with_rating.rating / heuristic_enemy_rating *
+                    ratePassEnemyRisk(world.enemyTeam(), pass_with_rating.pass,
+                                      passing_params, 1 - success_probabilities[i]);
+            }
         }
+
+        // Only the re-rated passes are compared, since the heuristic may have
+        // overrated the others in the same way
+        best_passes.erase(best_passes.begin() + num_top_candidates, best_passes.end());
     }
 
-    return best_pass;
+    if (best_passes.empty())
+    {
+        return PassWithRating{Pass(Point(), Point(), 1.0), -1.0};
+    }
+    return *std::max_element(best_passes.begin(), best_passes.end(), has_lower_rating);
 }
@@ -4,7 +4,9 @@
 
 #include "proto/parameters.pb.h"
 #include "software/ai/passing/cost_function.h"
+#include "software/ai/passing/pass_success_estimator.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/ai/passing/passing_params.h"
 #include "software/optimization/gradient_descent_optimizer.hpp"
 #include "software/world/world.h"
 
@@ -25,11 +27,16 @@ class PassGenerator
      * Generates the best pass based on the state of the world
      *
      * @param world The state of the world
+     * @param passing_params The parameters to rate passes with, usually from the
+     * AiConfigSnapshot of the current tick
+     * @param worker_pool The worker threads to estimate the success of the best passes
+     * on, usually from the AiConfigSnapshot of the current tick
      * @param robots_to_ignore A list of robot ids to ignore when generating passes
      *
      * @return The best pass that can be made and its rating
      */
-    PassWithRating getBestPass(const World& world,
+    PassWithRating getBestPass(const World& world, const PassingParams& passing_params,
+                               WorkerPool& worker_pool,
                                const std::vector<RobotId>& robots_to_ignore = {});
 
    private:
@@ -47,14 +54,20 @@ class PassGenerator
 
     /**
      * Given a map of passes, runs a gradient descent optimizer to find
-     * Update better passes.
+     * Update better passes. If the pass generation stage of the AI tick runs out of
+     * time, the remaining receiving positions are skipped and the best pass found so
+     * far is returned. Otherwise, the best passes are re-rated with the intercept risk
+     * estimated by the PassSuccessEstimator before picking the best one.
      *
      * @param The world
+     * @param passing_params The parameters to rate passes with
+     * @param worker_pool The worker threads to estimate the success of the best passes
+     * on
      * @param The pass receiver position to be optimized mapped to robots
      * @returns Best optimized pass
      */
     PassWithRating optimizeReceivingPositions(
-        const World& world,
+        const World& world, const PassingParams& passing_params, WorkerPool& worker_pool,
         const std::map<RobotId, std::vector<Point>>& receiving_positions_map);
 
     // Weights used to normalize the parameters that we pass to GradientDescent
@@ -80,4 +93,7 @@ class PassGenerator
 
     // Passing configuration
     TbotsProto::PassingConfig passing_config_;
+
+    // Estimates the intercept risk of the best passes by simulating them
+    PassSuccessEstimator pass_success_estimator_;
 };
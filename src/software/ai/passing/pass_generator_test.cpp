@@ -5,6 +5,7 @@
 
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/test_util/test_util.h"
 
@@ -19,6 +20,7 @@ class PassGeneratorTest : public testing::Test
         passing_config.set_min_pass_speed_m_per_s(1);
         passing_config.set_max_pass_speed_m_per_s(5.5);
         passing_config.set_receiver_ideal_min_distance_meters(0.1);
+        passing_params = PassingParams(passing_config);
         pass_generator = PassGenerator(passing_config);
     }
 
@@ -31,19 +33,24 @@ class PassGeneratorTest : public testing::Test
      *
      * @param pass_generator The pass generator to step
      * @param world The world to evaluate passes on
+     * @param passing_params The parameters to rate passes with
+     * @param worker_pool The worker threads to estimate the success of passes on
      * @param max_iters The maximum number of iterations of the PassGenerator to run
      */
     static void stepPassGenerator(PassGenerator pass_generator, const World& world,
-                                  int max_iters)
+                                  const PassingParams& passing_params,
+                                  WorkerPool& worker_pool, int max_iters)
     {
         for (int i = 0; i < max_iters; i++)
         {
-            pass_generator.getBestPass(world);
+            pass_generator.getBestPass(world, passing_params, worker_pool);
         }
     }
 
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
     TbotsProto::PassingConfig passing_config;
+    PassingParams passing_params = PassingParams(passing_config);
+    WorkerPool worker_pool{passing_config.pass_success_num_worker_threads()};
     PassGenerator pass_generator;
 };
 
@@ -84,15 +91,17 @@ TEST_F(PassGeneratorTest, check_pass_converges)
     world->updateEnemyTeamState(enemy_team);
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, *world, passing_params, worker_pool, 100);
 
-    auto [best_pass, score] = pass_generator.getBestPass(*world);
+    auto [best_pass, score] =
+        pass_generator.getBestPass(*world, passing_params, worker_pool);
 
     // After 100 iterations on the same world, we should "converge"
     // to the same pass.
     for (int i = 0; i < 7; i++)
     {
-        auto [pass, score] = pass_generator.getBestPass(*world);
+        auto [pass, score] =
+            pass_generator.getBestPass(*world, passing_params, worker_pool);
 
         EXPECT_LE((best_pass.receiverPoint() - pass.receiverPoint()).length(), 0.7);
         EXPECT_LE(abs(best_pass.speed() - pass.speed()), 0.7);
@@ -134,10 +143,11 @@ TEST_F(PassGeneratorTest, check_pass_does_not_converge_to_self_pass)
     world->updateEnemyTeamState(enemy_team);
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, *world, passing_params, worker_pool, 100);
 
     // Find what pass we converged to
-    auto [converged_pass, converged_score] = pass_generator.getBestPass(*world);
+    auto [converged_pass, converged_score] =
+        pass_generator.getBestPass(*world, passing_params, worker_pool);
 
     // We expect to have converged to a point near robot 2. The tolerance is fairly
     // generous here because the enemies on the field can "force" the point slightly
@@ -185,10 +195,11 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
         Ball(BallState(Point(3, 1), Vector(0, 0)), Timestamp::fromSeconds(0)));
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, *world, passing_params, worker_pool, 100);
 
     // Find what pass we converged to
-    auto converged_pass = pass_generator.getBestPass(*world).pass;
+    auto converged_pass =
+        pass_generator.getBestPass(*world, passing_params, worker_pool).pass;
 
     // We expect to have converged to a point closer to the robot in the pos_y
     // compared to the robot in the neg_y position since the ball is in +y
@@ -201,10 +212,10 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
         Ball(BallState(Point(3, -1), Vector(0, 0)), Timestamp::fromSeconds(0)));
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, *world, passing_params, worker_pool, 100);
 
     // Find what pass we converged to
-    converged_pass = pass_generator.getBestPass(*world).pass;
+    converged_pass = pass_generator.getBestPass(*world, passing_params, worker_pool).pass;
 
     // We expect to have converged to a point closer to the robot in the neg_y
     // compared to the robot in the pos_y position.
@@ -225,7 +236,8 @@ TEST_F(PassGeneratorTest, test_open_pass_score_being_high_2_friendlies)
     Ball ball({0, 0}, {0, 0}, Timestamp::fromSeconds(0));
     world->updateBall(ball);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass =
+        pass_generator.getBestPass(*world, passing_params, worker_pool);
     EXPECT_GE(best_pass.rating, 0.8);
 }
 
@@ -244,7 +256,8 @@ TEST_F(PassGeneratorTest, test_open_pass_score_being_high_3_friendlies)
     Ball ball({0.5, 0}, {0, 0}, Timestamp::fromSeconds(0));
     world->updateBall(ball);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass =
+        pass_generator.getBestPass(*world, passing_params, worker_pool);
     EXPECT_GE(best_pass.rating, 0.8);
 }
 
@@ -272,7 +285,8 @@ TEST_F(PassGeneratorTest, test_two_blocked_friendly_one_open_friendly)
                                    AngularVelocity::zero(), Timestamp::fromSeconds(0))});
     world->updateEnemyTeamState(enemy_team);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass =
+        pass_generator.getBestPass(*world, passing_params, worker_pool);
     EXPECT_GE(best_pass.rating, 0.5);
     // Verify that the pass is to the open friendly
     EXPECT_TRUE((best_pass.pass.receiverPoint() -
@@ -301,10 +315,38 @@ TEST_F(PassGeneratorTest, test_robots_ignore_list)
     world->updateEnemyTeamState(enemy_team);
 
     std::vector<RobotId> ignore_list = {1};
-    PassWithRating best_pass         = pass_generator.getBestPass(*world, ignore_list);
+    PassWithRating best_pass =
+        pass_generator.getBestPass(*world, passing_params, worker_pool, ignore_list);
 
     // Verify that the pass is to the only friendly which is not ignored
     EXPECT_TRUE((best_pass.pass.receiverPoint() -
                  world->friendlyTeam().getRobotById(2)->position())
                     .length() < 0.3);
 }
+
+TEST_F(PassGeneratorTest, test_return_best_pass_so_far_when_out_of_time)
+{
+    world->updateBall(
+        Ball(BallState(Point(0, 0), Vector(0, 0)), Timestamp::fromSeconds(0)));
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots({
+        Robot(0, {2, 1}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(1, {2, -1}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world->updateFriendlyTeamState(friendly_team);
+
+    TbotsProto::AiTimeBudgetConfig time_budget_config;
+    time_budget_config.set_pass_generation_budget_ms(0);
+    AiTimeBudgetStats time_budget_stats;
+    ScopedAiTickTimeBudget tick_time_budget(time_budget_config, time_budget_stats);
+
+    // A pass to one of the robots should still be found, even though there is no
+    // time to optimize any passes beyond the first one to each robot
+    auto [pass, score] = pass_generator.getBestPass(*world, passing_params, worker_pool);
+    EXPECT_GT(score, 0);
+    EXPECT_EQ(time_budget_stats
+                  .num_stage_overruns[static_cast<std::size_t>(AiStage::PASS_GENERATION)],
+              1);
+}
@@ -0,0 +1,310 @@
+#include "software/ai/passing/pass_success_estimator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "shared/constants.h"
+
+namespace
+{
+/**
+ * Calculates the time it takes the ball to travel the given distance, decelerating
+ * with sliding friction and then with rolling friction
+ *
+ * @param initial_speed The speed the ball is kicked at, in m/s
+ * @param distance The distance the ball travels, in m
+ *
+ * @return the time it takes the ball to travel the distance, or infinity if the ball
+ * stops before then
+ */
+inline double ballTimeToTravel(double initial_speed, double distance)
+{
+    constexpr double SLIDING_DECEL =
+        -BALL_SLIDING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+    constexpr double ROLLING_DECEL =
+        -BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+
+    const double rolling_speed = FRICTION_TRANSITION_FACTOR * initial_speed;
+    const double sliding_time  = (initial_speed - rolling_speed) / SLIDING_DECEL;
+    const double sliding_distance =
+        (initial_speed * initial_speed - rolling_speed * rolling_speed) /
+        (2 * SLIDING_DECEL);
+
+    // Both phases are computed and the right one selected, so that this can be
+    // vectorized over the rollouts
+    const double sliding_disc =
+        std::max(0.0, initial_speed * initial_speed - 2 * SLIDING_DECEL * distance);
+    const double time_while_sliding =
+        (initial_speed - std::sqrt(sliding_disc)) / SLIDING_DECEL;
+
+    const double rolling_disc =
+        rolling_speed * rolling_speed - 2 * ROLLING_DECEL * (distance - sliding_distance);
+    const double time_while_rolling =
+        sliding_time +
+        (rolling_speed - std::sqrt(std::max(0.0, rolling_disc))) / ROLLING_DECEL;
+
+    if (distance <= sliding_distance)
+    {
+        return time_while_sliding;
+    }
+    return rolling_disc >= 0 ? time_while_rolling
+                             : std::numeric_limits<double>::infinity();
+}
+
+/**
+ * Calculates the time it takes an enemy robot to travel the given distance with
+ * bang-bang motion, accelerating at its max acceleration up to its max speed
+ *
+ * @param distance The distance to travel, in m
+ * @param initial_speed The initial speed of the robot towards its destination, in m/s.
+ * A negative speed is away from the destination.
+ *
+ * @return the time it takes the robot to travel the distance
+ */
+inline double enemyTimeToTravel(double distance, double initial_speed)
+{
+    const double MAX_ACCEL = ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED;
+    const double MAX_SPEED = ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND;
+
+    // A robot moving away from its destination first has to stop, which is the same
+    // as starting from rest further away
+    const double turn_around_time = std::max(0.0, -initial_speed) / MAX_ACCEL;
+    const double turn_around_distance =
+        turn_around_time * turn_around_time * MAX_ACCEL / 2;
+    const double speed = std::clamp(initial_speed, 0.0, MAX_SPEED);
+    distance += turn_around_distance;
+
+    const double accel_distance =
+        (MAX_SPEED * MAX_SPEED - speed * speed) / (2 * MAX_ACCEL);
+    const double time_accelerating =
+        (std::sqrt(speed * speed + 2 * MAX_ACCEL * distance) - speed) / MAX_ACCEL;
+    const double time_cruising =
+        (MAX_SPEED - speed) / MAX_ACCEL + (distance - accel_distance) / MAX_SPEED;
+
+    return turn_around_time +
+           (distance <= accel_distance ? time_accelerating : time_cruising);
+}
+
+/**
+ * Mixes the bits of the given value, to derive independent seeds from related values
+ *
+ * @param value The value to mix
+ *
+ * @return the mixed value
+ */
+inline std::uint64_t mixSeed(std::uint64_t value)
+{
+    // splitmix64 finalizer
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+}  // namespace
+
+PassSuccessEstimator::PassSuccessEstimator(
+    const TbotsProto::PassingConfig& passing_config)
+    : num_rollouts_(passing_config.pass_success_num_rollouts()),
+      speed_std_dev_m_per_s_(passing_config.pass_success_speed_std_dev_m_per_s()),
+      angle_std_dev_rad_(
+          Angle::fromDegrees(passing_config.pass_success_angle_std_dev_deg())
+              .toRadians()),
+      enemy_reaction_time_sec_(passing_config.pass_success_enemy_reaction_time_sec()),
+      enemy_reaction_time_std_dev_sec_(
+          passing_config.pass_success_enemy_reaction_time_std_dev_sec()),
+      enemy_interception_time_multiplier_(
+          passing_config.enemy_interception_time_multiplier())
+{
+}
+
+std::vector<double> PassSuccessEstimator::estimateSuccessProbabilities(
+    const World& world, const std::vector<Pass>& passes, WorkerPool& worker_pool)
+{
+    if (cached_timestamp_ != world.getMostRecentTimestamp())
+    {
+        cached_timestamp_ = world.getMostRecentTimestamp();
+        cached_probabilities_.clear();
+    }
+
+    // Only simulate the passes that aren't cached yet, once each
+    std::vector<PassKey> keys;
+    std::vector<Pass> passes_to_simulate;
+    std::vector<PassKey> keys_to_simulate;
+    keys.reserve(passes.size());
+    for (const Pass& pass : passes)
+    {
+        PassKey key = createPassKey(pass);
+        if (!cached_probabilities_.contains(key) &&
+            std::find(keys_to_simulate.begin(), keys_to_simulate.end(), key) ==
+                keys_to_simulate.end())
+        {
+            passes_to_simulate.push_back(pass);
+            keys_to_simulate.push_back(key);
+        }
+        keys.push_back(key);
+    }
+
+    if (!passes_to_simulate.empty())
+    {
+        const std::vector<Robot>& enemy_robots = world.enemyTeam().getAllRobots();
+        const std::size_t num_chunks =
+            (num_rollouts_ + ROLLOUT_CHUNK_SIZE - 1) / ROLLOUT_CHUNK_SIZE;
+
+        // Each task simulates one chunk of the rollouts of one pass, and writes the
+        // number of successful rollouts to its own slot
+        std::vector<std::size_t> num_successes(passes_to_simulate.size() * num_chunks);
+        worker_pool.parallelFor(
+            num_successes.size(),
+            [&](std::size_t task_index)
+            {
+                const std::size_t pass_index  = task_index / num_chunks;
+                const std::size_t chunk_index = task_index % num_chunks;
+                const std::size_t num_rollouts_in_chunk = std::min(
+                    ROLLOUT_CHUNK_SIZE, num_rollouts_ - chunk_index * ROLLOUT_CHUNK_SIZE);
+
+                // Seed each chunk from the pass itself, so that a pass gets the same
+                // estimate no matter which batch it is estimated in
+                const auto& [passer_x, passer_y, receiver_x, receiver_y, speed] =
+                    keys_to_simulate[pass_index];
+                std::uint64_t seed = mixSeed(chunk_index);
+                for (std::int64_t value :
+                     {passer_x, passer_y, receiver_x, receiver_y, speed})
+                {
+                    seed = mixSeed(seed ^ static_cast<std::uint64_t>(value));
+                }
+
+                num_successes[task_index] =
+                    simulateRollouts(passes_to_simulate[pass_index], enemy_robots,
+                                     num_rollouts_in_chunk, seed);
+            });
+
+        for (std::size_t i = 0; i < passes_to_simulate.size(); i++)
+        {
+            std::size_t total_successes = 0;
+            for (std::size_t chunk = 0; chunk < num_chunks; chunk++)
+            {
+                total_successes += num_successes[i * num_chunks + chunk];
+            }
+            cached_probabilities_[keys_to_simulate[i]] =
+                static_cast<double>(total_successes) / static_cast<double>(num_rollouts_);
+        }
+    }
+
+    std::vector<double> probabilities;
+    probabilities.reserve(keys.size());
+    for (const PassKey& key : keys)
+    {
+        probabilities.push_back(cached_probabilities_.at(key));
+    }
+    return probabilities;
+}
+
+double PassSuccessEstimator::estimateSuccessProbability(const World& world,
+                                                        const Pass& pass,
+                                                        WorkerPool& worker_pool)
+{
+    return estimateSuccessProbabilities(world, {pass}, worker_pool).front();
+}
+
+PassSuccessEstimator::PassKey PassSuccessEstimator::createPassKey(const Pass& pass)
+{
+    const auto to_mm = [](double value)
+    { return static_cast<std::int64_t>(std::llround(value * MILLIMETERS_PER_METER)); };
+    return PassKey(to_mm(pass.passerPoint().x()), to_mm(pass.passerPoint().y()),
+                   to_mm(pass.receiverPoint().x()), to_mm(pass.receiverPoint().y()),
+                   to_mm(pass.speed()));
+}
+
+std::size_t PassSuccessEstimator::simulateRollouts(const Pass& pass,
+                                                   const std::vector<Robot>& enemy_robots,
+                                                   std::size_t num_rollouts,
+                                                   std::uint64_t seed) const
+{
+    const Vector pass_vector      = pass.receiverPoint() - pass.passerPoint();
+    const double pass_length      = pass_vector.length();
+    const double passer_x         = pass.passerPoint().x();
+    const double passer_y         = pass.passerPoint().y();
+    const double pass_angle       = pass_vector.orientation().toRadians();
+    const double intercept_radius = ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS;
+
+    // Sample the parameters of each rollout. Each parameter is scaled from a standard
+    // normal sample, since std::normal_distribution requires a positive standard
+    // deviation and the configured standard deviations may be 0
+    std::mt19937_64 random_num_gen(seed);
+    std::normal_distribution<double> standard_normal_distribution(0.0, 1.0);
+    const auto sample = [&](double mean, double std_dev)
+    { return mean + std_dev * standard_normal_distribution(random_num_gen); };
+
+    std::array<double, ROLLOUT_CHUNK_SIZE> speeds;
+    std::array<double, ROLLOUT_CHUNK_SIZE> directions_x;
+    std::array<double, ROLLOUT_CHUNK_SIZE> directions_y;
+    std::array<double, ROLLOUT_CHUNK_SIZE> reaction_times;
+    for (std::size_t i = 0; i < num_rollouts; i++)
+    {
+        speeds[i]          = std::max(0.0, sample(pass.speed(), speed_std_dev_m_per_s_));
+        const double angle = sample(pass_angle, angle_std_dev_rad_);
+        directions_x[i]    = std::cos(angle);
+        directions_y[i]    = std::sin(angle);
+        reaction_times[i]  = std::max(
+            0.0, sample(enemy_reaction_time_sec_, enemy_reaction_time_std_dev_sec_));
+    }
+
+    // Times are measured from when the ball is kicked, since the enemy robots can only
+    // start reacting to the pass once they see where the ball is going
+    std::array<double, ROLLOUT_CHUNK_SIZE> ball_times;
+    std::array<double, ROLLOUT_CHUNK_SIZE> ball_x;
+    std::array<double, ROLLOUT_CHUNK_SIZE> ball_y;
+    std::array<std::uint8_t, ROLLOUT_CHUNK_SIZE> intercepted{};
+
+    // The receiver takes the ball as soon as it touches the receiver, so the enemy
+    // robots have to get to the ball before then
+    const double contested_length = std::max(0.0, pass_length - intercept_radius);
+    for (std::size_t sample = 1; sample <= NUM_BALL_PATH_SAMPLES; sample++)
+    {
+        const double distance = contested_length * static_cast<double>(sample) /
+                                static_cast<double>(NUM_BALL_PATH_SAMPLES);
+        for (std::size_t i = 0; i < num_rollouts; i++)
+        {
+            ball_times[i] = ballTimeToTravel(speeds[i], distance);
+            ball_x[i]     = passer_x + directions_x[i] * distance;
+            ball_y[i]     = passer_y + directions_y[i] * distance;
+        }
+
+        for (const Robot& enemy_robot : enemy_robots)
+        {
+            const double robot_x  = enemy_robot.position().x();
+            const double robot_y  = enemy_robot.position().y();
+            const double robot_vx = enemy_robot.velocity().x();
+            const double robot_vy = enemy_robot.velocity().y();
+            for (std::size_t i = 0; i < num_rollouts; i++)
+            {
+                // The robot keeps its velocity until it reacts to the pass
+                const double reacted_x = robot_x + robot_vx * reaction_times[i];
+                const double reacted_y = robot_y + robot_vy * reaction_times[i];
+                const double dx        = ball_x[i] - reacted_x;
+                const double dy        = ball_y[i] - reacted_y;
+                const double distance_to_ball = std::sqrt(dx * dx + dy * dy);
+                const double speed_to_ball    = (robot_vx * dx + robot_vy * dy) /
+                                             std::max(distance_to_ball, 1e-9);
+
+                const double robot_time =
+                    reaction_times[i] +
+                    enemy_interception_time_multiplier_ *
+                        enemyTimeToTravel(
+                            std::max(0.0, distance_to_ball - intercept_radius),
+                            speed_to_ball);
+                intercepted[i] |= static_cast<std::uint8_t>(robot_time <= ball_times[i]);
+            }
+        }
+    }
+
+    std::size_t num_successes = 0;
+    for (std::size_t i = 0; i < num_rollouts; i++)
+    {
+        num_successes += intercepted[i] == 0;
+    }
+    return num_successes;
+}
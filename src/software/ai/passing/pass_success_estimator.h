@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/passing/pass.h"
+#include "software/multithreading/worker_pool.h"
+#include "software/world/world.h"
+
+/**
+ * Estimates the probability that passes get to their receiver without being
+ * intercepted, by simulating rollouts of each pass and of the enemy robots' response
+ * to it.
+ *
+ * Each rollout samples the speed and direction the ball is kicked with, and the time
+ * it takes the enemy robots to react to the kick. The ball decelerates with the same
+ * sliding and rolling friction model as Pass::getPassSpeed. Each enemy robot keeps
+ * moving at its current velocity until it reacts, and then drives at full acceleration
+ * towards points along the path of the ball. The pass is intercepted if any enemy
+ * robot can get to one of those points before the ball does.
+ *
+ * The rollouts of a batch of passes are split into chunks that are simulated in
+ * parallel on a WorkerPool. Each chunk is laid out as flat arrays, so that the inner
+ * loops over the rollouts of a chunk can be vectorized by the compiler. The estimates
+ * are cached until the world's timestamp changes, so each pass is only simulated once
+ * per tick. The WorkerPool is passed in by the caller, so that every estimator in the AI
+ * shares the worker threads of the AiConfigSnapshot instead of starting its own.
+ *
+ * This is meant for re-rating the best few passes found by the PassGenerator. The
+ * throughput target is 10 000 rollouts against 11 enemy robots in under 2 ms on 8
+ * cores.
+ */
+class PassSuccessEstimator
+{
+   public:
+    /**
+     * Creates a PassSuccessEstimator
+     *
+     * @param passing_config The passing config with the rollout parameters
+     */
+    explicit PassSuccessEstimator(const TbotsProto::PassingConfig& passing_config);
+
+    /**
+     * Estimates the probability that each of the given passes gets to its receiver
+     * without being intercepted by the enemy team
+     *
+     * @param world The state of the world
+     * @param passes The passes to estimate
+     * @param worker_pool The worker threads to simulate the rollouts on
+     *
+     * @return the probability of success of each pass, in the order of the passes
+     */
+    std::vector<double> estimateSuccessProbabilities(const World& world,
+                                                     const std::vector<Pass>& passes,
+                                                     WorkerPool& worker_pool);
+
+    /**
+     * Estimates the probability that the given pass gets to its receiver without
+     * being intercepted by the enemy team
+     *
+     * @param world The state of the world
+     * @param pass The pass to estimate
+     * @param worker_pool The worker threads to simulate the rollouts on
+     *
+     * @return the probability of success of the pass
+     */
+    double estimateSuccessProbability(const World& world, const Pass& pass,
+                                      WorkerPool& worker_pool);
+
+   private:
+    // Passes are cached by their passer point, receiver point and speed, in mm and
+    // mm/s
+    using PassKey = std::tuple<std::int64_t, std::int64_t, std::int64_t, std::int64_t,
+                               std::int64_t>;
+
+    /**
+     * Creates the key a pass is cached by
+     *
+     * @param pass The pass
+     *
+     * @return the key of the pass
+     */
+    static PassKey createPassKey(const Pass& pass);
+
+    /**
+     * Simulates a chunk of rollouts of a pass
+     *
+     * @param pass The pass to simulate
+     * @param enemy_robots The enemy robots that may intercept the pass
+     * @param num_rollouts The number of rollouts to simulate, at most
+     * ROLLOUT_CHUNK_SIZE
+     * @param seed The seed of the random rollout parameters
+     *
+     * @return the number of rollouts in which the pass was not intercepted
+     */
+    std::size_t simulateRollouts(const Pass& pass, const std::vector<Robot>& enemy_robots,
+                                 std::size_t num_rollouts, std::uint64_t seed) const;
+
+    // The number of rollouts simulated together by one task
+    static constexpr std::size_t ROLLOUT_CHUNK_SIZE = 256;
+
+    // The number of points along the path of the ball that the enemy robots try to
+    // intercept the ball at
+    static constexpr std::size_t NUM_BALL_PATH_SAMPLES = 16;
+
+    std::size_t num_rollouts_;
+    double speed_std_dev_m_per_s_;
+    double angle_std_dev_rad_;
+    double enemy_reaction_time_sec_;
+    double enemy_reaction_time_std_dev_sec_;
+    double enemy_interception_time_multiplier_;
+
+    std::optional<Timestamp> cached_timestamp_;
+    std::map<PassKey, double> cached_probabilities_;
+};
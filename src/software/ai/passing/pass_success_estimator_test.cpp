@@ -0,0 +1,151 @@
+#include "software/ai/passing/pass_success_estimator.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/test_util.h"
+
+class PassSuccessEstimatorTest : public testing::Test
+{
+   protected:
+    PassSuccessEstimatorTest()
+        : world(::TestUtil::createBlankTestingWorld()),
+          worker_pool(passing_config.pass_success_num_worker_threads()),
+          estimator(passing_config)
+    {
+    }
+
+    void setEnemyRobots(const std::vector<std::pair<Point, Vector>>& states)
+    {
+        std::vector<Robot> robots;
+        for (const auto& [position, velocity] : states)
+        {
+            robots.emplace_back(static_cast<RobotId>(robots.size()), position, velocity,
+                                Angle::zero(), AngularVelocity::zero(),
+                                world->getMostRecentTimestamp());
+        }
+        Team enemy_team(Duration::fromSeconds(10));
+        enemy_team.updateRobots(robots);
+        world->updateEnemyTeamState(enemy_team);
+    }
+
+    TbotsProto::PassingConfig passing_config;
+    std::shared_ptr<World> world;
+    WorkerPool worker_pool;
+    PassSuccessEstimator estimator;
+};
+
+TEST_F(PassSuccessEstimatorTest, pass_with_no_enemy_robots_always_succeeds)
+{
+    Pass pass({0, 0}, {3, 0}, 4);
+
+    EXPECT_EQ(1.0, estimator.estimateSuccessProbability(*world, pass, worker_pool));
+}
+
+TEST_F(PassSuccessEstimatorTest, pass_through_enemy_robot_fails)
+{
+    setEnemyRobots({{Point(1.5, 0), Vector()}});
+    Pass pass({0, 0}, {3, 0}, 4);
+
+    EXPECT_LT(estimator.estimateSuccessProbability(*world, pass, worker_pool), 0.05);
+}
+
+TEST_F(PassSuccessEstimatorTest, pass_far_from_enemy_robot_succeeds)
+{
+    setEnemyRobots({{Point(1.5, 3), Vector()}});
+    Pass pass({0, 0}, {3, 0}, 5);
+
+    EXPECT_GT(estimator.estimateSuccessProbability(*world, pass, worker_pool), 0.95);
+}
+
+TEST_F(PassSuccessEstimatorTest, slow_pass_is_riskier_than_fast_pass)
+{
+    setEnemyRobots({{Point(1.5, 0.8), Vector()}});
+    Pass slow_pass({0, 0}, {3, 0}, 2);
+    Pass fast_pass({0, 0}, {3, 0}, 5);
+
+    std::vector<double> probabilities = estimator.estimateSuccessProbabilities(
+        *world, {slow_pass, fast_pass}, worker_pool);
+
+    ASSERT_EQ(2, probabilities.size());
+    EXPECT_LT(probabilities[0], probabilities[1]);
+}
+
+TEST_F(PassSuccessEstimatorTest, enemy_robot_moving_towards_pass_is_riskier)
+{
+    Pass pass({0, 0}, {3, 0}, 5);
+
+    setEnemyRobots({{Point(1.5, 2.5), Vector()}});
+    double stationary_enemy_probability =
+        estimator.estimateSuccessProbability(*world, pass, worker_pool);
+
+    world->updateTimestamp(world->getMostRecentTimestamp() + Duration::fromSeconds(1));
+    setEnemyRobots({{Point(1.5, 2.5), Vector(0, -3)}});
+    double moving_enemy_probability =
+        estimator.estimateSuccessProbability(*world, pass, worker_pool);
+
+    EXPECT_LT(moving_enemy_probability, stationary_enemy_probability);
+}
+
+TEST_F(PassSuccessEstimatorTest, estimate_does_not_depend_on_batch)
+{
+    setEnemyRobots({{Point(1.5, 0.6), Vector(0.5, -0.5)}, {Point(2, -1), Vector()}});
+    Pass pass({0, 0}, {3, 0}, 3.5);
+    Pass other_pass({0, 0}, {2, 2}, 3.5);
+
+    double batched_probability = estimator.estimateSuccessProbabilities(
+        *world, {other_pass, pass}, worker_pool)[1];
+
+    // Move to the next tick, so that the pass is simulated again instead of cached
+    world->updateTimestamp(world->getMostRecentTimestamp() + Duration::fromSeconds(1));
+    double single_probability =
+        estimator.estimateSuccessProbability(*world, pass, worker_pool);
+
+    EXPECT_EQ(batched_probability, single_probability);
+}
+
+TEST_F(PassSuccessEstimatorTest, zero_std_devs_simulate_the_mean_pass)
+{
+    passing_config.set_pass_success_speed_std_dev_m_per_s(0.0);
+    passing_config.set_pass_success_angle_std_dev_deg(0.0);
+    passing_config.set_pass_success_enemy_reaction_time_std_dev_sec(0.0);
+    PassSuccessEstimator deterministic_estimator(passing_config);
+    Pass pass({0, 0}, {3, 0}, 4);
+
+    setEnemyRobots({{Point(1.5, 0), Vector()}});
+    double blocked_probability =
+        deterministic_estimator.estimateSuccessProbability(*world, pass, worker_pool);
+
+    world->updateTimestamp(world->getMostRecentTimestamp() + Duration::fromSeconds(1));
+    setEnemyRobots({{Point(1.5, 3), Vector()}});
+    double open_probability =
+        deterministic_estimator.estimateSuccessProbability(*world, pass, worker_pool);
+
+    EXPECT_EQ(0.0, blocked_probability);
+    EXPECT_EQ(1.0, open_probability);
+}
+
+TEST_F(PassSuccessEstimatorTest, test_throughput)
+{
+    // This isn't a test, but rather a tool for reporting the throughput of the
+    // estimator against a full enemy team
+    std::vector<std::pair<Point, Vector>> enemy_states;
+    for (int i = 0; i < 11; i++)
+    {
+        enemy_states.emplace_back(Point(-4 + i * 0.8, (i % 3) - 1.0), Vector(0.5, -0.5));
+    }
+    setEnemyRobots(enemy_states);
+
+    std::vector<Pass> passes;
+    for (int i = 0; i < 10; i++)
+    {
+        passes.emplace_back(Point(0, 0), Point(3, -2 + i * 0.4), 4);
+    }
+
+    auto start_time = std::chrono::system_clock::now();
+    estimator.estimateSuccessProbabilities(*world, passes, worker_pool);
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << duration_ms << "ms to run "
+              << passes.size() * passing_config.pass_success_num_rollouts()
+              << " rollouts" << std::endl;
+}
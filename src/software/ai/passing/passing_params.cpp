@@ -0,0 +1,30 @@
+#include "software/ai/passing/passing_params.h"
+
+PassingParams::PassingParams(const TbotsProto::PassingConfig& passing_config)
+    : min_pass_speed_m_per_s(passing_config.min_pass_speed_m_per_s()),
+      max_pass_speed_m_per_s(passing_config.max_pass_speed_m_per_s()),
+      max_receive_speed_m_per_s(passing_config.max_receive_speed_m_per_s()),
+      static_field_position_quality_x_offset(
+          passing_config.static_field_position_quality_x_offset()),
+      static_field_position_quality_y_offset(
+          passing_config.static_field_position_quality_y_offset()),
+      static_field_position_quality_friendly_goal_distance_weight(
+          passing_config.static_field_position_quality_friendly_goal_distance_weight()),
+      pass_delay_sec(passing_config.pass_delay_sec()),
+      friendly_time_to_receive_slack_sec(
+          passing_config.friendly_time_to_receive_slack_sec()),
+      enemy_proximity_importance(passing_config.enemy_proximity_importance()),
+      enemy_interception_time_multiplier(
+          passing_config.enemy_interception_time_multiplier()),
+      enemy_interception_risk_importance(
+          passing_config.enemy_interception_risk_importance()),
+      backwards_pass_distance_meters(passing_config.backwards_pass_distance_meters()),
+      receiver_ideal_max_distance_meters(
+          passing_config.receiver_ideal_max_distance_meters()),
+      receiver_ideal_min_distance_meters(
+          passing_config.receiver_ideal_min_distance_meters()),
+      min_ideal_pass_shoot_goal_open_angle_deg(
+          passing_config.min_ideal_pass_shoot_goal_open_angle_deg()),
+      min_pass_shoot_score(passing_config.min_pass_shoot_score())
+{
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "proto/parameters.pb.h"
+
+/**
+ * The parameters from a TbotsProto::PassingConfig that are read while rating passes,
+ * copied into plain fields.
+ *
+ * The pass rating functions are evaluated thousands of times per tick by the
+ * PassGenerator, so they read their parameters from this struct instead of through
+ * the protobuf accessors of the PassingConfig.
+ */
+struct PassingParams
+{
+    /**
+     * Copies the parameters out of the given PassingConfig. This is explicit so that
+     * the parameters are not silently copied on every call to a rating function; on
+     * the AI tick, use the PassingParams from the AiConfigSnapshot instead.
+     *
+     * @param passing_config The passing config to copy the parameters from
+     */
+    explicit PassingParams(const TbotsProto::PassingConfig& passing_config);
+
+    double min_pass_speed_m_per_s;
+    double max_pass_speed_m_per_s;
+    double max_receive_speed_m_per_s;
+    double static_field_position_quality_x_offset;
+    double static_field_position_quality_y_offset;
+    double static_field_position_quality_friendly_goal_distance_weight;
+    double pass_delay_sec;
+    double friendly_time_to_receive_slack_sec;
+    double enemy_proximity_importance;
+    double enemy_interception_time_multiplier;
+    double enemy_interception_risk_importance;
+    double backwards_pass_distance_meters;
+    double receiver_ideal_max_distance_meters;
+    double receiver_ideal_min_distance_meters;
+    double min_ideal_pass_shoot_goal_open_angle_deg;
+    double min_pass_shoot_score;
+};
@@ -8,6 +8,9 @@
 #include "software/ai/passing/field_pitch_division.h"
 #include "software/ai/passing/pass.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/ai/passing/passing_params.h"
+#include "software/ai/profiling/ai_tick_profiler.h"
+#include "software/ai/time_budget/time_budget.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
 
@@ -37,6 +40,8 @@ class ReceiverPositionGenerator
      * Generates the best receiving positions for the friendly robots to go to
      *
      * @param world The world to generate the best receiving positions based on
+     * @param passing_params The parameters to rate receiving positions with, usually
+     * from the AiConfigSnapshot of the current tick
      * @param num_positions The number of receiving positions to generate
      * @param existing_receiver_positions A set of existing receiver positions that will
      * be avoided, if possible, when generating the new receiver positions.
@@ -49,7 +54,8 @@ class ReceiverPositionGenerator
      * positions that the receivers could use.
      */
     std::vector<Point> getBestReceivingPositions(
-        const World& world, unsigned int num_positions,
+        const World& world, const PassingParams& passing_params,
+        unsigned int num_positions,
         const std::vector<Point>& existing_receiver_positions = {},
         const std::optional<Point>& pass_origin_override      = std::nullopt);
 
@@ -62,14 +68,22 @@ class ReceiverPositionGenerator
      * @param best_receiving_positions The map of the best receiving positions for each
      * zone found so far, and their ratings.
      * @param world The world to sample receiving positions in
+     * @param best_shot_calculator A BestShotCalculator for shots on the enemy goal in
+     * the world, shared by every receiving position rated
+     * @param passing_params The parameters to rate receiving positions with
      * @param pass_origin The origin of the pass
      * @param zones_to_sample The subset of the zones to sample receiving positions in
      * @param num_samples_per_zone The number of samples to take per zone
+     * @param deadline The deadline of this run of the receiver position generation
+     * stage. Once it expires, only zones without any receiving position yet are
+     * sampled, and only once.
      */
     void updateBestReceiverPositions(
         std::map<ZoneEnum, PassWithRating>& best_receiving_positions, const World& world,
-        const Point& pass_origin, const std::vector<ZoneEnum>& zones_to_sample,
-        unsigned int num_samples_per_zone);
+        const BestShotCalculator& best_shot_calculator,
+        const PassingParams& passing_params, const Point& pass_origin,
+        const std::vector<ZoneEnum>& zones_to_sample, unsigned int num_samples_per_zone,
+        StageDeadline& deadline);
 
     /**
      * Helper function for getting the top num_positions zones from the current
@@ -128,13 +142,18 @@ ReceiverPositionGenerator<ZoneEnum>::ReceiverPositionGenerator(
 
 template <class ZoneEnum>
 std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPositions(
-    const World& world, unsigned int num_positions,
+    const World& world, const PassingParams& passing_params, unsigned int num_positions,
     const std::vector<Point>& existing_receiver_positions,
     const std::optional<Point>& pass_origin_override)
 {
+    ScopedAiStageTimer receiver_position_generation_timer(
+        AiTickStage::RECEIVER_POSITION_GENERATION);
+
     std::map<ZoneEnum, PassWithRating> best_receiving_positions;
     debug_shapes.clear();
 
+    StageDeadline deadline(AiStage::RECEIVER_POSITION_GENERATION);
+
     Point pass_origin           = pass_origin_override.value_or(world.ball().position());
     const auto& receiver_config = passing_config_.receiver_position_generator_config();
 
@@ -151,6 +170,11 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
                                                   existing_receiver_positions.size());
     }
 
+    // The enemy robots blocking shots from the receiving positions are the same for
+    // every receiving position rated in this call
+    const BestShotCalculator best_shot_calculator =
+        createEnemyGoalShotCalculator(world.field(), world.enemyTeam());
+
     // Add the previous best sampled receiving positions with their updated rating
     for (const auto& [zone, prev_best_receiving_position] : prev_best_receiving_positions)
     {
@@ -159,7 +183,7 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
         // Increase the rating of the previous best receiving positions to
         // discourage changing the receiver positions too much.
         double receiver_position_rating =
-            rateReceivingPosition(world, pass, passing_config_) *
+            rateReceivingPosition(world, pass, best_shot_calculator, passing_params) *
             receiver_config.previous_best_receiver_position_score_multiplier();
         best_receiving_positions.insert_or_assign(
             zone, PassWithRating{pass, receiver_position_rating});
@@ -167,9 +191,10 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
 
     // Begin by sampling a few passes per zone to get an initial estimate of the best
     // receiving zones
-    updateBestReceiverPositions(best_receiving_positions, world, pass_origin,
+    updateBestReceiverPositions(best_receiving_positions, world, best_shot_calculator,
+                                passing_params, pass_origin,
                                 pitch_division_->getAllZoneIds(),
-                                receiver_config.num_initial_samples_per_zone());
+                                receiver_config.num_initial_samples_per_zone(), deadline);
 
     // Get the top zones based on the initial sampling
     std::vector<ZoneEnum> top_zones =
@@ -177,8 +202,10 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
                     existing_receiver_positions);
 
     // Sample more passes from only the top zones and update their ranking
-    updateBestReceiverPositions(best_receiving_positions, world, pass_origin, top_zones,
-                                receiver_config.num_additional_samples_per_top_zone());
+    updateBestReceiverPositions(best_receiving_positions, world, best_shot_calculator,
+                                passing_params, pass_origin, top_zones,
+                                receiver_config.num_additional_samples_per_top_zone(),
+                                deadline);
     std::sort(top_zones.begin(), top_zones.end(),
               [&](const ZoneEnum& z1, const ZoneEnum& z2)
               {
@@ -231,8 +258,9 @@ void ReceiverPositionGenerator<ZoneEnum>::visualizeBestReceivingPositionsAndZone
 template <class ZoneEnum>
 void ReceiverPositionGenerator<ZoneEnum>::updateBestReceiverPositions(
     std::map<ZoneEnum, PassWithRating>& best_receiving_positions, const World& world,
+    const BestShotCalculator& best_shot_calculator, const PassingParams& passing_params,
     const Point& pass_origin, const std::vector<ZoneEnum>& zones_to_sample,
-    unsigned int num_samples_per_zone)
+    unsigned int num_samples_per_zone, StageDeadline& deadline)
 {
     for (const auto& zone_id : zones_to_sample)
     {
@@ -252,11 +280,19 @@ void ReceiverPositionGenerator<ZoneEnum>::updateBestReceiverPositions(
         // Randomly sample receiving positions in the zone
         for (unsigned int i = 0; i < num_samples_per_zone; ++i)
         {
+            // Every zone needs a receiving position to be ranked, even once we are
+            // out of time
+            if (best_pass_for_receiving.rating >= 0 && deadline.hasExpired())
+            {
+                break;
+            }
+
             auto pass = Pass::fromDestReceiveSpeed(
                 pass_origin,
                 Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
                 passing_config_);
-            double rating = rateReceivingPosition(world, pass, passing_config_);
+            double rating =
+                rateReceivingPosition(world, pass, best_shot_calculator, passing_params);
 
             if (rating > best_pass_for_receiving.rating)
             {
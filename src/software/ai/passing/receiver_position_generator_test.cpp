@@ -51,13 +51,14 @@ class ReceiverPositionGeneratorTest : public testing::Test
         for (int i = 0; i < 100; ++i)
         {
             best_receiving_positions =
-                receiver_position_generator.getBestReceivingPositions(*world,
-                                                                      num_positions);
+                receiver_position_generator.getBestReceivingPositions(
+                    *world, passing_params, num_positions);
         }
         return best_receiving_positions;
     }
 
     TbotsProto::PassingConfig passing_config;
+    PassingParams passing_params = PassingParams(passing_config);
     ReceiverPositionGenerator<EighteenZoneId> receiver_position_generator;
     // Empty world
     std::shared_ptr<World> world;
@@ -142,12 +143,13 @@ TEST_F(ReceiverPositionGeneratorTest, test_receiving_position_rating_not_degradi
     for (int i = 0; i < 10; ++i)
     {
         std::vector<Point> best_receiving_positions =
-            receiver_position_generator.getBestReceivingPositions(*world, 1);
+            receiver_position_generator.getBestReceivingPositions(*world,
+                                                                  passing_params, 1);
         double score = rateReceivingPosition(
             *world,
             Pass::fromDestReceiveSpeed(ball_pos, best_receiving_positions[0],
                                        passing_config),
-            passing_config);
+            passing_params);
         EXPECT_GE(score, prev_score);
         prev_score = score;
     }
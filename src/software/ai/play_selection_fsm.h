@@ -15,15 +15,17 @@ struct PlaySelectionFSM
     struct Update
     {
         Update(const std::function<void(std::unique_ptr<Play>)>& set_current_play,
-               const GameState& game_state, const TbotsProto::AiConfig& ai_config)
+               const GameState& game_state,
+               std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr)
             : set_current_play(set_current_play),
               game_state(game_state),
-              ai_config(ai_config)
+              ai_config_ptr(std::move(ai_config_ptr))
         {
         }
         std::function<void(std::unique_ptr<Play>)> set_current_play;
         GameState game_state;
-        TbotsProto::AiConfig ai_config;
+        // Shared rather than copied, since the config is never modified once published
+        std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr;
     };
 
     /**
@@ -26,7 +26,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
 
@@ -34,7 +34,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
 
@@ -42,7 +42,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_US);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickPlay", objectTypeName(*current_play));
 
@@ -51,7 +51,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     EXPECT_TRUE(game_state.isReadyState());
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickPlay", objectTypeName(*current_play));
 
@@ -61,7 +61,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick)
     EXPECT_TRUE(game_state.isPlaying());
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
 }
@@ -73,7 +73,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
 
@@ -81,7 +81,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
 
@@ -89,7 +89,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isTheirPenalty());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickEnemyPlay", objectTypeName(*current_play));
@@ -98,7 +98,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickEnemyPlay", objectTypeName(*current_play));
@@ -107,7 +107,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::GOAL_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isStopped());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
@@ -116,7 +116,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_KICKOFF_US);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isSetupState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("KickoffFriendlyPlay", objectTypeName(*current_play));
@@ -125,7 +125,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("KickoffFriendlyPlay", objectTypeName(*current_play));
@@ -134,7 +134,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_out_of_penalty_kick_enemy_when_goal
     game_state.setRestartCompleted();
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isPlaying());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
@@ -148,7 +148,7 @@ TEST_F(PlaySelectionFSMTest,
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
 
@@ -156,7 +156,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
 
@@ -164,7 +164,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.updateRefereeCommand(RefereeCommand::PREPARE_PENALTY_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isTheirPenalty());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickEnemyPlay", objectTypeName(*current_play));
@@ -173,7 +173,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.updateRefereeCommand(RefereeCommand::NORMAL_START);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("PenaltyKickEnemyPlay", objectTypeName(*current_play));
@@ -182,7 +182,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isStopped());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
@@ -191,7 +191,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.updateRefereeCommand(RefereeCommand::DIRECT_FREE_US);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isOurDirectFree());
     EXPECT_TRUE(game_state.isReadyState());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
@@ -201,7 +201,7 @@ TEST_F(PlaySelectionFSMTest,
     game_state.setRestartCompleted();
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isPlaying());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
@@ -214,7 +214,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     // Start in halt
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Halt>));
     EXPECT_EQ("HaltPlay", objectTypeName(*current_play));
 
@@ -222,7 +222,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.updateRefereeCommand(RefereeCommand::STOP);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Stop>));
     EXPECT_EQ("StopPlay", objectTypeName(*current_play));
 
@@ -230,7 +230,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.updateRefereeCommand(RefereeCommand::BALL_PLACEMENT_US);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isOurBallPlacement());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("BallPlacementPlay", objectTypeName(*current_play));
@@ -239,7 +239,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.updateRefereeCommand(RefereeCommand::DIRECT_FREE_US);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isOurDirectFree());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("FreeKickPlay", objectTypeName(*current_play));
@@ -248,7 +248,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.updateRefereeCommand(RefereeCommand::BALL_PLACEMENT_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isTheirBallPlacement());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("EnemyBallPlacementPlay", objectTypeName(*current_play));
@@ -257,7 +257,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.updateRefereeCommand(RefereeCommand::DIRECT_FREE_THEM);
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isTheirDirectFree());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::SetPlay>));
     EXPECT_EQ("EnemyFreeKickPlay", objectTypeName(*current_play));
@@ -266,7 +266,7 @@ TEST_F(PlaySelectionFSMTest, test_transition_between_ball_placement_and_free_kic
     game_state.setRestartCompleted();
     fsm->process_event(PlaySelectionFSM::Update(
         [&current_play](std::unique_ptr<Play> play) { current_play = std::move(play); },
-        game_state, ai_config));
+        game_state, ai_config_ptr));
     EXPECT_TRUE(game_state.isPlaying());
     EXPECT_TRUE(fsm->is(boost::sml::state<PlaySelectionFSM::Playing>));
     EXPECT_EQ("OffensePlay", objectTypeName(*current_play));
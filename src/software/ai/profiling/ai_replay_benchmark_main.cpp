@@ -0,0 +1,361 @@
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+#include "proto/parameters.pb.h"
+#include "proto/sensor_msg.pb.h"
+#include "shared/constants.h"
+#include "software/ai/ai.h"
+#include "software/ai/config/ai_config_store.h"
+#include "software/ai/profiling/ai_tick_profiler.h"
+#include "software/logger/logger.h"
+#include "software/logger/proto_replay_reader.h"
+#include "software/sensor_fusion/sensor_fusion.h"
+#include "software/util/allocation_counter/allocation_counter.h"
+
+/*
+ * This standalone program replays the sensor messages of a replay log through
+ * SensorFusion and the AI as fast as possible on a single thread, and prints how long
+ * each stage of every AI tick took and how many heap allocations each tick made as
+ * JSON. When built with --//software/util/allocation_counter:track_allocations, the
+ * heap allocations made by each stage are printed as well.
+ *
+ * The AI runs with the default config, except that the pass success rollouts are run
+ * on the AI thread and the time budgets are raised to their maximum, so that the AI
+ * makes the same decisions on every run and the results of two commits can be
+ * compared.
+ */
+
+/**
+ * Reads the sensor messages of a replay log. If the log contains SensorProtos they are
+ * used as they are, otherwise each SSL_WrapperPacket, Referee and RobotStatus in the
+ * log is wrapped in a SensorProto the same way the backend does.
+ *
+ * @param replay_dir The folder containing the replay chunks
+ * @param max_num_vision_msgs Stop reading once this many vision messages have been
+ * read, or read the whole log if 0
+ *
+ * @return the sensor messages in the order they were received
+ */
+static std::vector<SensorProto> readSensorMsgs(const std::string& replay_dir,
+                                               std::size_t max_num_vision_msgs)
+{
+    const std::string sensor_type_name = SensorProto::descriptor()->full_name();
+    const std::string vision_type_name =
+        SSLProto::SSL_WrapperPacket::descriptor()->full_name();
+    const std::string referee_type_name = SSLProto::Referee::descriptor()->full_name();
+    const std::string robot_status_type_name =
+        TbotsProto::RobotStatus::descriptor()->full_name();
+
+    std::vector<SensorProto> logged_sensor_msgs;
+    std::vector<SensorProto> wrapped_sensor_msgs;
+    std::size_t num_logged_vision_msgs  = 0;
+    std::size_t num_wrapped_vision_msgs = 0;
+
+    // The wrapped messages are only used if the log has no SensorProtos
+    auto is_done = [&]()
+    {
+        const std::size_t num_vision_msgs = logged_sensor_msgs.empty()
+                                                ? num_wrapped_vision_msgs
+                                                : num_logged_vision_msgs;
+        return max_num_vision_msgs > 0 && num_vision_msgs >= max_num_vision_msgs;
+    };
+
+    ProtoReplayReader reader(replay_dir);
+    for (std::size_t chunk_index = 0; chunk_index < reader.getNumChunks() && !is_done();
+         chunk_index++)
+    {
+        for (const ReplayLogEntry& entry : reader.getChunkEntries(chunk_index))
+        {
+            if (is_done())
+            {
+                break;
+            }
+
+            if (entry.protobuf_type_full_name == sensor_type_name)
+            {
+                logged_sensor_msgs.push_back(
+                    static_cast<const SensorProto&>(*entry.message));
+                num_logged_vision_msgs +=
+                    logged_sensor_msgs.back().has_ssl_vision_msg() ? 1 : 0;
+            }
+            else if (entry.protobuf_type_full_name == vision_type_name)
+            {
+                *wrapped_sensor_msgs.emplace_back().mutable_ssl_vision_msg() =
+                    static_cast<const SSLProto::SSL_WrapperPacket&>(*entry.message);
+                num_wrapped_vision_msgs++;
+            }
+            else if (entry.protobuf_type_full_name == referee_type_name)
+            {
+                *wrapped_sensor_msgs.emplace_back().mutable_ssl_referee_msg() =
+                    static_cast<const SSLProto::Referee&>(*entry.message);
+            }
+            else if (entry.protobuf_type_full_name == robot_status_type_name)
+            {
+                *wrapped_sensor_msgs.emplace_back().add_robot_status_msgs() =
+                    static_cast<const TbotsProto::RobotStatus&>(*entry.message);
+            }
+        }
+    }
+
+    return logged_sensor_msgs.empty() ? wrapped_sensor_msgs : logged_sensor_msgs;
+}
+
+/**
+ * Writes the distribution of a set of samples as a JSON object
+ *
+ * @param os The stream to write to
+ * @param name The key of the object
+ * @param samples The samples. Sorted in place.
+ * @param scale What to multiply each sample by when writing it
+ */
+static void writeDistribution(std::ostream& os, const std::string& name,
+                              std::vector<double>& samples, double scale)
+{
+    std::sort(samples.begin(), samples.end());
+
+    // The smallest sample that is greater than or equal to percentile% of the samples
+    auto get_percentile = [&samples](double percentile)
+    {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(percentile / 100.0 * static_cast<double>(samples.size())));
+        return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    const double mean =
+        samples.empty() ? 0.0
+                        : std::accumulate(samples.begin(), samples.end(), 0.0) /
+                              static_cast<double>(samples.size());
+
+    os << "\"" << name << "\": {\"count\": " << samples.size()
+       << ", \"mean\": " << mean * scale;
+    for (const auto& [percentile_name, percentile] :
+         {std::pair("p50", 50.0), std::pair("p90", 90.0), std::pair("p99", 99.0)})
+    {
+        os << ", \"" << percentile_name << "\": "
+           << (samples.empty() ? 0.0 : get_percentile(percentile) * scale);
+    }
+    os << ", \"max\": " << (samples.empty() ? 0.0 : samples.back() * scale) << "}";
+}
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                   = false;
+        std::string replay_dir      = "";
+        std::string runtime_dir     = "/tmp/tbots";
+        std::string output_file     = "";
+        bool friendly_colour_yellow = false;
+        std::size_t max_ticks       = 0;
+        std::size_t warmup_ticks    = 60;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("replay_dir",
+                       boost::program_options::value<std::string>(&args.replay_dir),
+                       "Folder containing the replay chunks to run the AI on");
+    desc.add_options()("runtime_dir",
+                       boost::program_options::value<std::string>(&args.runtime_dir),
+                       "The directory to output logs.");
+    desc.add_options()("output_file",
+                       boost::program_options::value<std::string>(&args.output_file),
+                       "File to write the JSON results to. Written to stdout if empty.");
+    desc.add_options()("friendly_colour_yellow",
+                       boost::program_options::bool_switch(&args.friendly_colour_yellow),
+                       "Run the AI for the yellow team instead of the blue team");
+    desc.add_options()(
+        "max_ticks", boost::program_options::value<std::size_t>(&args.max_ticks),
+        "Stop after at most this many AI ticks. Runs the whole log if 0.");
+    desc.add_options()(
+        "warmup_ticks", boost::program_options::value<std::size_t>(&args.warmup_ticks),
+        "Number of AI ticks to run before recording results");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if (args.replay_dir.empty())
+    {
+        std::cerr << "--replay_dir must be specified" << std::endl;
+        std::cerr << desc << std::endl;
+        return 1;
+    }
+
+    LoggerSingleton::initializeLogger(args.runtime_dir, nullptr, false);
+
+    // Read the whole log up front so that decoding it isn't part of the results
+    const std::vector<SensorProto> sensor_msgs = readSensorMsgs(
+        args.replay_dir, args.max_ticks > 0 ? args.max_ticks + args.warmup_ticks : 0);
+
+    TbotsProto::ThunderbotsConfig config;
+    config.mutable_sensor_fusion_config()->set_friendly_color_yellow(
+        args.friendly_colour_yellow);
+
+    TbotsProto::AiConfig& ai_config = *config.mutable_ai_config();
+    ai_config.mutable_passing_config()->set_pass_success_num_worker_threads(0);
+    TbotsProto::AiTimeBudgetConfig& time_budget_config =
+        *ai_config.mutable_ai_time_budget_config();
+    time_budget_config.set_tick_budget_ms(100);
+    time_budget_config.set_pass_generation_budget_ms(100);
+    time_budget_config.set_receiver_position_generation_budget_ms(100);
+    time_budget_config.set_trajectory_planning_budget_ms(100);
+
+    SensorFusion sensor_fusion(config.sensor_fusion_config());
+    Ai ai(std::make_shared<const AiConfigStore>(ai_config));
+
+    constexpr std::size_t NUM_STAGES = reflective_enum::size<AiTickStage>();
+    std::vector<double> sensor_fusion_ns;
+    std::vector<double> tick_ns;
+    std::vector<double> unprofiled_ns;
+    std::array<std::vector<double>, NUM_STAGES> stage_ns;
+    std::vector<double> num_allocations;
+    std::vector<double> num_bytes_allocated;
+    std::array<std::vector<double>, NUM_STAGES> stage_num_allocations;
+
+    std::size_t num_ticks = 0;
+    std::chrono::nanoseconds sensor_fusion_duration(0);
+    AiTickProfile profile;
+
+    for (const SensorProto& sensor_msg : sensor_msgs)
+    {
+        if (args.max_ticks > 0 && num_ticks >= args.max_ticks + args.warmup_ticks)
+        {
+            break;
+        }
+
+        // Worlds are only sent to the AI on vision messages, like ThreadedSensorFusion
+        const auto sensor_fusion_start_time = std::chrono::steady_clock::now();
+        sensor_fusion.processSensorProto(sensor_msg);
+        std::optional<World> world;
+        if (sensor_msg.has_ssl_vision_msg())
+        {
+            world = sensor_fusion.getWorld();
+        }
+        sensor_fusion_duration +=
+            std::chrono::steady_clock::now() - sensor_fusion_start_time;
+
+        if (!world.has_value())
+        {
+            continue;
+        }
+
+        const auto world_ptr = std::make_shared<const World>(world.value());
+
+        std::chrono::nanoseconds tick_duration;
+        std::size_t tick_num_allocations;
+        std::size_t tick_num_bytes_allocated;
+        {
+            ScopedAllocationCounter allocation_counter;
+            ScopedAiTickProfiler tick_profiler(profile);
+
+            const auto tick_start_time = std::chrono::steady_clock::now();
+            ai.getPrimitives(world_ptr);
+            tick_duration = std::chrono::steady_clock::now() - tick_start_time;
+
+            tick_num_allocations     = allocation_counter.getNumAllocations();
+            tick_num_bytes_allocated = allocation_counter.getNumBytesAllocated();
+        }
+
+        if (num_ticks++ >= args.warmup_ticks)
+        {
+            sensor_fusion_ns.push_back(
+                static_cast<double>(sensor_fusion_duration.count()));
+            tick_ns.push_back(static_cast<double>(tick_duration.count()));
+
+            std::chrono::nanoseconds unprofiled_duration = tick_duration;
+            for (std::size_t stage = 0; stage < NUM_STAGES; stage++)
+            {
+                stage_ns[stage].push_back(
+                    static_cast<double>(profile.stage_durations[stage].count()));
+                unprofiled_duration -= profile.stage_durations[stage];
+                stage_num_allocations[stage].push_back(
+                    static_cast<double>(profile.stage_num_allocations[stage]));
+            }
+            unprofiled_ns.push_back(static_cast<double>(unprofiled_duration.count()));
+
+            num_allocations.push_back(static_cast<double>(tick_num_allocations));
+            num_bytes_allocated.push_back(static_cast<double>(tick_num_bytes_allocated));
+        }
+        sensor_fusion_duration = std::chrono::nanoseconds(0);
+    }
+
+    if (tick_ns.empty())
+    {
+        LOG(WARNING) << "The replay log in " << args.replay_dir
+                     << " has no vision messages after the warmup ticks";
+        return 1;
+    }
+
+    const TbotsProto::PlayInfo_TimeBudget time_budget = ai.getPlayInfo().time_budget();
+    const double ns_to_us = MICROSECONDS_PER_SECOND / NANOSECONDS_PER_SECOND;
+
+    std::ofstream output_file;
+    if (!args.output_file.empty())
+    {
+        output_file.open(args.output_file);
+    }
+    std::ostream& os = args.output_file.empty() ? std::cout : output_file;
+
+    os << std::fixed << std::setprecision(3);
+    os << "{\"num_ticks\": " << tick_ns.size()
+       << ", \"num_warmup_ticks\": " << args.warmup_ticks << ",\n";
+
+    // Time budget overruns mean that the AI's decisions depended on how fast it ran,
+    // so the results can't be compared with another run
+    os << "\"time_budget_overruns\": {\"tick\": " << time_budget.num_tick_overruns();
+    for (AiStage stage : reflective_enum::values<AiStage>())
+    {
+        const std::string stage_name(reflective_enum::nameOf(stage));
+        os << ", \"" << stage_name
+           << "\": " << time_budget.num_stage_overruns().at(stage_name);
+    }
+    os << "},\n";
+
+    os << "\"stage_durations_us\": {";
+    writeDistribution(os, "SENSOR_FUSION", sensor_fusion_ns, ns_to_us);
+    os << ",\n";
+    writeDistribution(os, "TICK", tick_ns, ns_to_us);
+    for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+    {
+        os << ",\n";
+        writeDistribution(os, std::string(reflective_enum::nameOf(stage)),
+                          stage_ns[static_cast<std::size_t>(stage)], ns_to_us);
+    }
+    os << ",\n";
+    writeDistribution(os, "UNPROFILED", unprofiled_ns, ns_to_us);
+    os << "},\n";
+
+    writeDistribution(os, "allocations_per_tick", num_allocations, 1.0);
+    os << ",\n";
+    writeDistribution(os, "bytes_allocated_per_tick", num_bytes_allocated, 1.0);
+
+#ifdef TRACK_ALLOCATIONS
+    os << ",\n\"stage_allocations\": {";
+    for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+    {
+        os << (stage == reflective_enum::values<AiTickStage>().front() ? "" : ",\n");
+        writeDistribution(os, std::string(reflective_enum::nameOf(stage)),
+                          stage_num_allocations[static_cast<std::size_t>(stage)], 1.0);
+    }
+    os << "}";
+#endif
+    os << "}" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "software/ai/profiling/ai_tick_profiler.h"
+
+#include <optional>
+#include <string>
+
+#ifdef TRACK_ALLOCATIONS
+#include "software/util/allocation_counter/allocation_counter.h"
+
+// Counts the heap allocations made by each thread while it runs a profiled tick
+static thread_local std::optional<ScopedAllocationCounter> tick_allocation_counter;
+#endif
+
+// The profiler of the AI tick running on each thread, or nullptr if there isn't one
+static thread_local ScopedAiTickProfiler* current_tick_profiler = nullptr;
+
+#ifdef TRACY_ENABLE
+/**
+ * Gets the name of the Tracy zone of a stage. Stages that replaced one of the zones
+ * the AI was already instrumented with keep that zone's name, so that the allocations
+ * Tracy attributes to the zone are the ones counted for the stage.
+ *
+ * @param stage The stage
+ *
+ * @return the name of the Tracy zone of the stage
+ */
+static const char* getStageZoneName(AiTickStage stage)
+{
+    switch (stage)
+    {
+        case AiTickStage::PLAY_SELECTION:
+            return "AI: Select play";
+        case AiTickStage::PLAY_UPDATE:
+            return "Play: Get Tactics from Play";
+        case AiTickStage::TACTIC_FSMS:
+            return "Play: Update tactic FSMs";
+        case AiTickStage::PASS_GENERATION:
+            return "PassGenerator: Generate passes";
+        case AiTickStage::RECEIVER_POSITION_GENERATION:
+            return "ReceiverPositionGenerator: Generate receiver positions";
+        case AiTickStage::TACTIC_ASSIGNMENT:
+            return "Play: Assign tactics to robots";
+        case AiTickStage::MOTION_PLANNING:
+            return "Play: Plan motion";
+    }
+    return "AI: Unknown stage";
+}
+
+/**
+ * Gets the source location that names the Tracy zone of a stage
+ *
+ * @param stage The stage
+ *
+ * @return the source location of the stage, which lives as long as the program since
+ * Tracy keeps a pointer to it
+ */
+static const tracy::SourceLocationData* getStageSourceLocation(AiTickStage stage)
+{
+    static const auto source_locations = []()
+    {
+        std::array<tracy::SourceLocationData, reflective_enum::size<AiTickStage>()>
+            locations;
+        for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+        {
+            locations[static_cast<std::size_t>(stage)] = tracy::SourceLocationData{
+                getStageZoneName(stage), "ScopedAiStageTimer", __FILE__, __LINE__, 0};
+        }
+        return locations;
+    }();
+
+    return &source_locations[static_cast<std::size_t>(stage)];
+}
+#endif
+
+ScopedAiTickProfiler::ScopedAiTickProfiler(AiTickProfile& profile)
+    : profile_(profile),
+      current_stage_timer_(nullptr),
+      previous_tick_profiler_(current_tick_profiler)
+{
+    profile_ = AiTickProfile();
+
+#ifdef TRACK_ALLOCATIONS
+    if (!tick_allocation_counter.has_value())
+    {
+        tick_allocation_counter.emplace();
+    }
+#endif
+
+    current_tick_profiler = this;
+}
+
+ScopedAiTickProfiler::~ScopedAiTickProfiler()
+{
+    current_tick_profiler = previous_tick_profiler_;
+
+#ifdef TRACK_ALLOCATIONS
+    if (current_tick_profiler == nullptr)
+    {
+        tick_allocation_counter.reset();
+    }
+#endif
+}
+
+bool ScopedAiTickProfiler::isProfilingTick()
+{
+    return current_tick_profiler != nullptr;
+}
+
+ScopedAiStageTimer::ScopedAiStageTimer(AiTickStage stage)
+    :
+#ifdef TRACY_ENABLE
+      tracy_zone_(getStageSourceLocation(stage)),
+#endif
+      stage_(stage),
+      tick_profiler_(current_tick_profiler),
+      parent_stage_timer_(nullptr)
+{
+    if (tick_profiler_ == nullptr)
+    {
+        return;
+    }
+
+    start_ = getCheckpoint();
+
+    // Pause the stage that this one is running inside of
+    parent_stage_timer_ = tick_profiler_->current_stage_timer_;
+    if (parent_stage_timer_ != nullptr)
+    {
+        parent_stage_timer_->chargeUntil(start_);
+    }
+    tick_profiler_->current_stage_timer_ = this;
+}
+
+ScopedAiStageTimer::~ScopedAiStageTimer()
+{
+    if (tick_profiler_ == nullptr)
+    {
+        return;
+    }
+
+    const Checkpoint end = getCheckpoint();
+    chargeUntil(end);
+
+    // Resume the stage that this one was running inside of
+    if (parent_stage_timer_ != nullptr)
+    {
+        parent_stage_timer_->start_ = end;
+    }
+    tick_profiler_->current_stage_timer_ = parent_stage_timer_;
+}
+
+void ScopedAiStageTimer::chargeUntil(const Checkpoint& end)
+{
+    AiTickProfile& profile  = tick_profiler_->profile_;
+    const std::size_t index = static_cast<std::size_t>(stage_);
+    profile.stage_durations[index] += end.time - start_.time;
+    profile.stage_num_allocations[index] += end.num_allocations - start_.num_allocations;
+    profile.stage_num_bytes_allocated[index] +=
+        end.num_bytes_allocated - start_.num_bytes_allocated;
+}
+
+ScopedAiStageTimer::Checkpoint ScopedAiStageTimer::getCheckpoint()
+{
+    Checkpoint checkpoint{std::chrono::steady_clock::now(), 0, 0};
+#ifdef TRACK_ALLOCATIONS
+    checkpoint.num_allocations     = tick_allocation_counter->getNumAllocations();
+    checkpoint.num_bytes_allocated = tick_allocation_counter->getNumBytesAllocated();
+#endif
+    return checkpoint;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <Tracy.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "software/util/make_enum/make_enum.hpp"
+
+// The stages of the AI tick that are profiled. Stages can run inside each other (e.g.
+// pass generation runs while a play is updating its tactics), in which case the time
+// spent in the inner stage is only counted towards the inner stage.
+MAKE_ENUM(AiTickStage, PLAY_SELECTION, PLAY_UPDATE, TACTIC_FSMS, PASS_GENERATION,
+          RECEIVER_POSITION_GENERATION, TACTIC_ASSIGNMENT, MOTION_PLANNING);
+
+/**
+ * How long an AI tick spent in each of its stages, and how many heap allocations each
+ * stage made
+ */
+struct AiTickProfile
+{
+    // Indexed by AiTickStage
+    std::array<std::chrono::nanoseconds, reflective_enum::size<AiTickStage>()>
+        stage_durations = {};
+
+    // The heap allocations made by the thread running the tick, indexed by
+    // AiTickStage. These are only counted when built with TRACK_ALLOCATIONS, and are
+    // always 0 otherwise.
+    std::array<std::size_t, reflective_enum::size<AiTickStage>()> stage_num_allocations =
+        {};
+    std::array<std::size_t, reflective_enum::size<AiTickStage>()>
+        stage_num_bytes_allocated = {};
+};
+
+class ScopedAiStageTimer;
+
+/**
+ * Profiles the AI tick that is running on the current thread while it is alive.
+ *
+ * Like ScopedAiTickTimeBudget, the profiler is looked up by the ScopedAiStageTimers
+ * deep inside plays and tactics through the thread they run on, rather than being
+ * passed down to them. Stage timers that are run outside of a profiled tick, which is
+ * always the case outside of benchmarks, do nothing.
+ */
+class ScopedAiTickProfiler
+{
+   public:
+    /**
+     * Starts profiling an AI tick on the current thread
+     *
+     * @param profile The profile to record the time spent in each stage in. It is
+     * cleared first, and must outlive this object.
+     */
+    explicit ScopedAiTickProfiler(AiTickProfile& profile);
+
+    /**
+     * Stops profiling the tick
+     */
+    ~ScopedAiTickProfiler();
+
+    ScopedAiTickProfiler(const ScopedAiTickProfiler&)            = delete;
+    ScopedAiTickProfiler& operator=(const ScopedAiTickProfiler&) = delete;
+
+    /**
+     * Checks if an AI tick is being profiled on the current thread
+     *
+     * @return true if a ScopedAiTickProfiler is active on the current thread
+     */
+    static bool isProfilingTick();
+
+   private:
+    friend class ScopedAiStageTimer;
+
+    AiTickProfile& profile_;
+
+    // The innermost stage that is running, or nullptr if no stage is running
+    ScopedAiStageTimer* current_stage_timer_;
+
+    // The profiler that was active on this thread before this one, which is restored
+    // when this one ends
+    ScopedAiTickProfiler* previous_tick_profiler_;
+};
+
+/**
+ * Times a single run of a stage of the AI tick, and counts the heap allocations it
+ * makes, from when it is created until it is destroyed, if a ScopedAiTickProfiler is
+ * active on the current thread. When built with TRACY_ENABLE, each run of a stage is
+ * also a Tracy zone, whether or not the tick is profiled. Tracy attributes allocations
+ * to any zone, but only while a client is connected; the stage counts are what
+ * PlayInfo and the benchmarks report.
+ *
+ * The timer of the stage that was running when this one is created is paused until
+ * this one is destroyed, so that each stage is only charged for the time spent and
+ * allocations made in the stage itself. A ScopedAiStageTimer must only be created as
+ * a local variable, and must not be alive across a coroutine yield, since stages must
+ * end in the reverse order that they started.
+ */
+class ScopedAiStageTimer
+{
+   public:
+    /**
+     * Starts timing a run of the given stage
+     *
+     * @param stage The stage that is being run
+     */
+    explicit ScopedAiStageTimer(AiTickStage stage);
+
+    /**
+     * Stops timing the stage, and resumes timing the stage it was run inside of
+     */
+    ~ScopedAiStageTimer();
+
+    ScopedAiStageTimer(const ScopedAiStageTimer&)            = delete;
+    ScopedAiStageTimer& operator=(const ScopedAiStageTimer&) = delete;
+
+   private:
+    /**
+     * The time and the number of allocations made by the current thread at a point
+     * in the tick
+     */
+    struct Checkpoint
+    {
+        std::chrono::steady_clock::time_point time;
+        std::size_t num_allocations;
+        std::size_t num_bytes_allocated;
+    };
+
+    /**
+     * Charges this stage for the time spent and allocations made from when it was
+     * started or last resumed until the given checkpoint
+     *
+     * @param end The checkpoint to charge this stage until
+     */
+    void chargeUntil(const Checkpoint& end);
+
+    /**
+     * Gets the current checkpoint of the tick running on the current thread
+     *
+     * @return the current checkpoint
+     */
+    static Checkpoint getCheckpoint();
+
+#ifdef TRACY_ENABLE
+    // Declared first so that the zone covers all of the stage's bookkeeping
+    tracy::ScopedZone tracy_zone_;
+#endif
+
+    AiTickStage stage_;
+    ScopedAiTickProfiler* tick_profiler_;
+    ScopedAiStageTimer* parent_stage_timer_;
+
+    // When this stage was started or last resumed
+    Checkpoint start_;
+};
@@ -0,0 +1,155 @@
+#include "software/ai/profiling/ai_tick_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+class AiTickProfilerTest : public testing::Test
+{
+   protected:
+    /**
+     * Gets the time spent in the given stage
+     *
+     * @param stage The stage
+     *
+     * @return the time spent in the stage
+     */
+    std::chrono::nanoseconds getStageDuration(AiTickStage stage) const
+    {
+        return profile.stage_durations[static_cast<std::size_t>(stage)];
+    }
+
+    /**
+     * Sleeps for the given number of milliseconds
+     *
+     * @param milliseconds How long to sleep for
+     */
+    static void sleepFor(int milliseconds)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    }
+
+    AiTickProfile profile;
+};
+
+TEST_F(AiTickProfilerTest, test_stage_timer_does_nothing_outside_of_tick)
+{
+    {
+        ScopedAiTickProfiler tick_profiler(profile);
+    }
+
+    {
+        ScopedAiStageTimer stage_timer(AiTickStage::PLAY_UPDATE);
+        sleepFor(1);
+    }
+    EXPECT_EQ(getStageDuration(AiTickStage::PLAY_UPDATE).count(), 0);
+}
+
+TEST_F(AiTickProfilerTest, test_stage_timer_records_stage_duration)
+{
+    ScopedAiTickProfiler tick_profiler(profile);
+    {
+        ScopedAiStageTimer stage_timer(AiTickStage::PLAY_SELECTION);
+        sleepFor(2);
+    }
+
+    EXPECT_GE(getStageDuration(AiTickStage::PLAY_SELECTION),
+              std::chrono::milliseconds(2));
+    EXPECT_EQ(getStageDuration(AiTickStage::MOTION_PLANNING).count(), 0);
+}
+
+TEST_F(AiTickProfilerTest, test_repeated_stage_durations_are_summed)
+{
+    ScopedAiTickProfiler tick_profiler(profile);
+    for (int i = 0; i < 3; i++)
+    {
+        ScopedAiStageTimer stage_timer(AiTickStage::MOTION_PLANNING);
+        sleepFor(1);
+    }
+
+    EXPECT_GE(getStageDuration(AiTickStage::MOTION_PLANNING),
+              std::chrono::milliseconds(3));
+}
+
+TEST_F(AiTickProfilerTest, test_inner_stage_is_not_counted_towards_outer_stage)
+{
+    ScopedAiTickProfiler tick_profiler(profile);
+    {
+        ScopedAiStageTimer outer_stage_timer(AiTickStage::PLAY_UPDATE);
+        sleepFor(1);
+        {
+            ScopedAiStageTimer inner_stage_timer(AiTickStage::PASS_GENERATION);
+            sleepFor(20);
+        }
+        sleepFor(1);
+    }
+
+    EXPECT_GE(getStageDuration(AiTickStage::PASS_GENERATION),
+              std::chrono::milliseconds(20));
+    EXPECT_GE(getStageDuration(AiTickStage::PLAY_UPDATE), std::chrono::milliseconds(2));
+    EXPECT_LT(getStageDuration(AiTickStage::PLAY_UPDATE), std::chrono::milliseconds(20));
+}
+
+TEST_F(AiTickProfilerTest, test_profile_is_cleared_at_start_of_tick)
+{
+    {
+        ScopedAiTickProfiler tick_profiler(profile);
+        ScopedAiStageTimer stage_timer(AiTickStage::TACTIC_FSMS);
+        sleepFor(1);
+    }
+    EXPECT_GT(getStageDuration(AiTickStage::TACTIC_FSMS).count(), 0);
+
+    ScopedAiTickProfiler tick_profiler(profile);
+    EXPECT_EQ(getStageDuration(AiTickStage::TACTIC_FSMS).count(), 0);
+}
+
+TEST_F(AiTickProfilerTest, test_profiler_is_restored_after_nested_tick)
+{
+    ScopedAiTickProfiler tick_profiler(profile);
+    {
+        AiTickProfile nested_profile;
+        ScopedAiTickProfiler nested_tick_profiler(nested_profile);
+    }
+
+    {
+        ScopedAiStageTimer stage_timer(AiTickStage::TACTIC_ASSIGNMENT);
+        sleepFor(1);
+    }
+    EXPECT_GE(getStageDuration(AiTickStage::TACTIC_ASSIGNMENT),
+              std::chrono::milliseconds(1));
+}
+
+TEST_F(AiTickProfilerTest, test_stage_allocations_are_only_counted_in_innermost_stage)
+{
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(3);
+    {
+        ScopedAiTickProfiler tick_profiler(profile);
+        ScopedAiStageTimer outer_stage_timer(AiTickStage::PLAY_UPDATE);
+        values.push_back(std::make_unique<int>(1));
+        {
+            ScopedAiStageTimer inner_stage_timer(AiTickStage::PASS_GENERATION);
+            values.push_back(std::make_unique<int>(2));
+            values.push_back(std::make_unique<int>(3));
+        }
+    }
+
+#ifdef TRACK_ALLOCATIONS
+    EXPECT_EQ(profile.stage_num_allocations[static_cast<std::size_t>(
+                  AiTickStage::PASS_GENERATION)],
+              2);
+    EXPECT_EQ(profile.stage_num_bytes_allocated[static_cast<std::size_t>(
+                  AiTickStage::PASS_GENERATION)],
+              2 * sizeof(int));
+    EXPECT_EQ(
+        profile.stage_num_allocations[static_cast<std::size_t>(AiTickStage::PLAY_UPDATE)],
+        1);
+#else
+    for (AiTickStage stage : reflective_enum::values<AiTickStage>())
+    {
+        EXPECT_EQ(profile.stage_num_allocations[static_cast<std::size_t>(stage)], 0);
+    }
+#endif
+}
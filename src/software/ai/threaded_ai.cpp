@@ -12,9 +12,8 @@ ThreadedAi::ThreadedAi(const TbotsProto::AiConfig& ai_config)
     // always want AI to use the latest World
     : FirstInFirstOutThreadedObserver<World>(),
       FirstInFirstOutThreadedObserver<TbotsProto::ThunderbotsConfig>(),
-      ai_config_ptr(std::make_shared<TbotsProto::AiConfig>(ai_config)),
-      ai(ai_config_ptr),
-      ai_control_config(ai_config.ai_control_config())
+      ai_config_store(std::make_shared<AiConfigStore>(ai_config)),
+      ai(ai_config_store)
 {
 }
 
@@ -29,6 +28,8 @@ void ThreadedAi::overrideTactics(
 {
     std::scoped_lock lock(ai_mutex);
 
+    const std::shared_ptr<const TbotsProto::AiConfig> ai_config_ptr =
+        ai_config_store->load()->getAiConfigPtr();
     auto play = std::make_unique<AssignedTacticsPlay>(ai_config_ptr);
     std::map<RobotId, std::shared_ptr<Tactic>> tactic_assignment_map;
 
@@ -53,19 +54,14 @@ void ThreadedAi::onValueReceived(World world)
 
 void ThreadedAi::onValueReceived(TbotsProto::ThunderbotsConfig config)
 {
-    std::scoped_lock lock(ai_mutex);
-
-    // Update the AI with thew new config
-    *ai_config_ptr    = config.ai_config();
-    ai_control_config = config.ai_config().ai_control_config();
-
-    ai.updateAiConfig();
+    // The AI picks up the new config at the start of its next tick
+    ai_config_store->publish(config.ai_config());
 }
 
 void ThreadedAi::runAiAndSendPrimitives(const WorldPtr& world_ptr)
 {
     std::scoped_lock lock(ai_mutex);
-    if (ai_control_config.run_ai())
+    if (ai_config_store->load()->shouldRunAi())
     {
         auto new_primitives = ai.getPrimitives(world_ptr);
 
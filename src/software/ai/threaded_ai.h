@@ -9,6 +9,7 @@
 #include "proto/tactic.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/ai/ai.h"
+#include "software/ai/config/ai_config_store.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/world/world.h"
@@ -59,8 +60,9 @@ class ThreadedAi : public FirstInFirstOutThreadedObserver<World>,
      */
     void runAiAndSendPrimitives(const WorldPtr& world_ptr);
 
-    std::shared_ptr<TbotsProto::AiConfig> ai_config_ptr;
+    // New configs are published to the store without waiting for the AI to finish
+    // its current tick
+    std::shared_ptr<AiConfigStore> ai_config_store;
     Ai ai;
-    TbotsProto::AiControlConfig ai_control_config;
     std::mutex ai_mutex;
 };
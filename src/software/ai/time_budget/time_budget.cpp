@@ -0,0 +1,74 @@
+#include "software/ai/time_budget/time_budget.h"
+
+#include <algorithm>
+
+// The budget of the AI tick running on each thread, or nullptr if there isn't one
+static thread_local ScopedAiTickTimeBudget* current_tick_budget = nullptr;
+
+/**
+ * Converts a budget in milliseconds from the config to a duration
+ *
+ * @param budget_ms The budget in milliseconds
+ *
+ * @return the budget as a duration
+ */
+static std::chrono::nanoseconds toBudgetDuration(double budget_ms)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double, std::milli>(budget_ms));
+}
+
+ScopedAiTickTimeBudget::ScopedAiTickTimeBudget(
+    const TbotsProto::AiTimeBudgetConfig& time_budget_config, AiTimeBudgetStats& stats)
+    : tick_deadline_(std::chrono::steady_clock::now() +
+                     toBudgetDuration(time_budget_config.tick_budget_ms())),
+      stats_(stats),
+      previous_tick_budget_(current_tick_budget)
+{
+    stage_budgets_[static_cast<std::size_t>(AiStage::PASS_GENERATION)] =
+        toBudgetDuration(time_budget_config.pass_generation_budget_ms());
+    stage_budgets_[static_cast<std::size_t>(AiStage::RECEIVER_POSITION_GENERATION)] =
+        toBudgetDuration(time_budget_config.receiver_position_generation_budget_ms());
+    stage_budgets_[static_cast<std::size_t>(AiStage::TRAJECTORY_PLANNING)] =
+        toBudgetDuration(time_budget_config.trajectory_planning_budget_ms());
+
+    current_tick_budget = this;
+}
+
+ScopedAiTickTimeBudget::~ScopedAiTickTimeBudget()
+{
+    stats_.num_ticks++;
+    if (std::chrono::steady_clock::now() > tick_deadline_)
+    {
+        stats_.num_tick_overruns++;
+    }
+
+    current_tick_budget = previous_tick_budget_;
+}
+
+StageDeadline::StageDeadline(AiStage stage)
+    : stage_(stage), tick_budget_(current_tick_budget), expired_(false)
+{
+    if (tick_budget_ != nullptr)
+    {
+        deadline_ = std::min(
+            tick_budget_->tick_deadline_,
+            std::chrono::steady_clock::now() +
+                tick_budget_->stage_budgets_[static_cast<std::size_t>(stage_)]);
+    }
+}
+
+bool StageDeadline::hasExpired()
+{
+    if (tick_budget_ == nullptr || expired_)
+    {
+        return expired_;
+    }
+
+    if (std::chrono::steady_clock::now() >= deadline_)
+    {
+        expired_ = true;
+        tick_budget_->stats_.num_stage_overruns[static_cast<std::size_t>(stage_)]++;
+    }
+    return expired_;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "proto/parameters.pb.h"
+#include "software/util/make_enum/make_enum.hpp"
+
+// The stages of the AI tick that are anytime algorithms, which return the best result
+// they have found so far once they run out of time
+MAKE_ENUM(AiStage, PASS_GENERATION, RECEIVER_POSITION_GENERATION, TRAJECTORY_PLANNING);
+
+/**
+ * How many AI ticks and anytime stages ran out of time
+ */
+struct AiTimeBudgetStats
+{
+    std::size_t num_ticks         = 0;
+    std::size_t num_tick_overruns = 0;
+
+    // Indexed by AiStage
+    std::array<std::size_t, reflective_enum::size<AiStage>()> num_stage_overruns = {};
+};
+
+/**
+ * Sets the time budget of the AI tick that is running on the current thread while it
+ * is alive.
+ *
+ * The anytime stages of the AI tick are run deep inside plays and tactics, so rather
+ * than passing the budget down to them, each stage creates a StageDeadline that looks
+ * up the budget of the tick running on its thread. Plays run as coroutines on the
+ * thread that runs the AI tick, so they see the budget as well. Stages that are run
+ * outside of an AI tick, such as in unit tests, are never cut short.
+ *
+ * Ticks and stages that run out of time are counted in the given AiTimeBudgetStats.
+ */
+class ScopedAiTickTimeBudget
+{
+   public:
+    /**
+     * Starts the time budget of an AI tick on the current thread
+     *
+     * @param time_budget_config The time budgets of the tick and each of its stages
+     * @param stats The stats to count ticks and stages that run out of time in. Must
+     * outlive this object.
+     */
+    explicit ScopedAiTickTimeBudget(
+        const TbotsProto::AiTimeBudgetConfig& time_budget_config,
+        AiTimeBudgetStats& stats);
+
+    /**
+     * Ends the time budget of the tick, counting the tick as an overrun if it took
+     * longer than its budget
+     */
+    ~ScopedAiTickTimeBudget();
+
+    ScopedAiTickTimeBudget(const ScopedAiTickTimeBudget&)            = delete;
+    ScopedAiTickTimeBudget& operator=(const ScopedAiTickTimeBudget&) = delete;
+
+   private:
+    friend class StageDeadline;
+
+    std::chrono::steady_clock::time_point tick_deadline_;
+    std::array<std::chrono::nanoseconds, reflective_enum::size<AiStage>()> stage_budgets_;
+    AiTimeBudgetStats& stats_;
+
+    // The budget that was active on this thread before this one, which is restored
+    // when this one ends
+    ScopedAiTickTimeBudget* previous_tick_budget_;
+};
+
+/**
+ * The deadline of a single run of an anytime stage of the AI tick.
+ *
+ * The deadline is when the budget of the stage runs out, counting from when the
+ * StageDeadline is created, or when the budget of the whole tick runs out, whichever
+ * comes first. A StageDeadline must not outlive the ScopedAiTickTimeBudget that was
+ * active when it was created, so it should only be created as a local variable.
+ */
+class StageDeadline
+{
+   public:
+    /**
+     * Starts the deadline for a run of the given stage
+     *
+     * @param stage The stage that is being run
+     */
+    explicit StageDeadline(AiStage stage);
+
+    /**
+     * Checks whether the stage has run out of time. The first time this returns true,
+     * the stage is counted as having overrun its budget.
+     *
+     * @return true if the stage should return its best result so far, false otherwise
+     */
+    bool hasExpired();
+
+   private:
+    AiStage stage_;
+    ScopedAiTickTimeBudget* tick_budget_;
+    std::chrono::steady_clock::time_point deadline_;
+    bool expired_;
+};
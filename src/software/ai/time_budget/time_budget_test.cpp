@@ -0,0 +1,110 @@
+#include "software/ai/time_budget/time_budget.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+class TimeBudgetTest : public testing::Test
+{
+   protected:
+    /**
+     * Gets the number of times the given stage ran out of time
+     *
+     * @param stage The stage
+     *
+     * @return the number of times the stage ran out of time
+     */
+    std::size_t getNumStageOverruns(AiStage stage) const
+    {
+        return stats.num_stage_overruns[static_cast<std::size_t>(stage)];
+    }
+
+    TbotsProto::AiTimeBudgetConfig config;
+    AiTimeBudgetStats stats;
+};
+
+TEST_F(TimeBudgetTest, test_stage_deadline_never_expires_outside_of_tick)
+{
+    config.set_pass_generation_budget_ms(0);
+    {
+        ScopedAiTickTimeBudget tick_budget(config, stats);
+    }
+
+    StageDeadline deadline(AiStage::PASS_GENERATION);
+    EXPECT_FALSE(deadline.hasExpired());
+}
+
+TEST_F(TimeBudgetTest, test_stage_deadline_expires_after_stage_budget)
+{
+    config.set_tick_budget_ms(100);
+    config.set_pass_generation_budget_ms(1);
+    ScopedAiTickTimeBudget tick_budget(config, stats);
+
+    StageDeadline deadline(AiStage::PASS_GENERATION);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_TRUE(deadline.hasExpired());
+
+    // Each run of a stage only counts as one overrun
+    EXPECT_TRUE(deadline.hasExpired());
+    EXPECT_EQ(getNumStageOverruns(AiStage::PASS_GENERATION), 1);
+    EXPECT_EQ(getNumStageOverruns(AiStage::TRAJECTORY_PLANNING), 0);
+}
+
+TEST_F(TimeBudgetTest, test_stage_deadline_within_stage_budget)
+{
+    config.set_tick_budget_ms(100);
+    config.set_trajectory_planning_budget_ms(100);
+    ScopedAiTickTimeBudget tick_budget(config, stats);
+
+    StageDeadline deadline(AiStage::TRAJECTORY_PLANNING);
+    EXPECT_FALSE(deadline.hasExpired());
+    EXPECT_EQ(getNumStageOverruns(AiStage::TRAJECTORY_PLANNING), 0);
+}
+
+TEST_F(TimeBudgetTest, test_stage_deadline_expires_when_tick_runs_out_of_time)
+{
+    config.set_tick_budget_ms(1);
+    config.set_receiver_position_generation_budget_ms(100);
+    ScopedAiTickTimeBudget tick_budget(config, stats);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    StageDeadline deadline(AiStage::RECEIVER_POSITION_GENERATION);
+    EXPECT_TRUE(deadline.hasExpired());
+    EXPECT_EQ(getNumStageOverruns(AiStage::RECEIVER_POSITION_GENERATION), 1);
+}
+
+TEST_F(TimeBudgetTest, test_tick_overruns_are_counted)
+{
+    config.set_tick_budget_ms(100);
+    {
+        ScopedAiTickTimeBudget tick_budget(config, stats);
+    }
+    EXPECT_EQ(stats.num_ticks, 1);
+    EXPECT_EQ(stats.num_tick_overruns, 0);
+
+    config.set_tick_budget_ms(1);
+    {
+        ScopedAiTickTimeBudget tick_budget(config, stats);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_EQ(stats.num_ticks, 2);
+    EXPECT_EQ(stats.num_tick_overruns, 1);
+}
+
+TEST_F(TimeBudgetTest, test_budget_is_only_active_on_its_own_thread)
+{
+    config.set_pass_generation_budget_ms(0);
+    ScopedAiTickTimeBudget tick_budget(config, stats);
+
+    bool expired_on_other_thread = true;
+    std::thread other_thread(
+        [&]()
+        {
+            StageDeadline deadline(AiStage::PASS_GENERATION);
+            expired_on_other_thread = deadline.hasExpired();
+        });
+    other_thread.join();
+
+    EXPECT_FALSE(expired_on_other_thread);
+    EXPECT_EQ(getNumStageOverruns(AiStage::PASS_GENERATION), 0);
+}
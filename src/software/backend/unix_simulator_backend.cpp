@@ -13,68 +13,81 @@
 #include "software/util/generic_factory/generic_factory.h"
 
 UnixSimulatorBackend::UnixSimulatorBackend(
-    std::string runtime_dir, const std::shared_ptr<ProtoLogger>& proto_logger)
+    std::string runtime_dir, const std::shared_ptr<ProtoLogger>& proto_logger,
+    const IpcChannelConfig& ipc_channel_config)
     : proto_logger(proto_logger)
 {
     // Protobuf Inputs
-    robot_status_input.reset(new ThreadedProtoUnixListener<TbotsProto::RobotStatus>(
+    robot_status_input.reset(new ThreadedProtoIpcListener<TbotsProto::RobotStatus>(
         runtime_dir + ROBOT_STATUS_PATH,
+        ipc_channel_config.getTransport(ROBOT_STATUS_PATH),
         [&](TbotsProto::RobotStatus& msg) { receiveRobotStatus(msg); }, proto_logger));
 
-    ssl_wrapper_input.reset(new ThreadedProtoUnixListener<SSLProto::SSL_WrapperPacket>(
-        runtime_dir + SSL_WRAPPER_PATH,
+    ssl_wrapper_input.reset(new ThreadedProtoIpcListener<SSLProto::SSL_WrapperPacket>(
+        runtime_dir + SSL_WRAPPER_PATH, ipc_channel_config.getTransport(SSL_WRAPPER_PATH),
         [&](SSLProto::SSL_WrapperPacket& msg) { receiveSSLWrapperPacket(msg); },
         proto_logger));
 
-    ssl_referee_input.reset(new ThreadedProtoUnixListener<SSLProto::Referee>(
-        runtime_dir + SSL_REFEREE_PATH,
+    ssl_referee_input.reset(new ThreadedProtoIpcListener<SSLProto::Referee>(
+        runtime_dir + SSL_REFEREE_PATH, ipc_channel_config.getTransport(SSL_REFEREE_PATH),
         [&](SSLProto::Referee& msg) { receiveSSLReferee(msg); }, proto_logger));
 
-    sensor_proto_input.reset(new ThreadedProtoUnixListener<SensorProto>(
+    sensor_proto_input.reset(new ThreadedProtoIpcListener<SensorProto>(
         runtime_dir + SENSOR_PROTO_PATH,
+        ipc_channel_config.getTransport(SENSOR_PROTO_PATH),
         [&](SensorProto& msg) { receiveSensorProto(msg); }, proto_logger));
 
     dynamic_parameter_update_request_listener.reset(
-        new ThreadedProtoUnixListener<TbotsProto::ThunderbotsConfig>(
+        new ThreadedProtoIpcListener<TbotsProto::ThunderbotsConfig>(
             runtime_dir + DYNAMIC_PARAMETER_UPDATE_REQUEST_PATH,
+            ipc_channel_config.getTransport(DYNAMIC_PARAMETER_UPDATE_REQUEST_PATH),
             [&](TbotsProto::ThunderbotsConfig& msg) { receiveThunderbotsConfig(msg); },
             proto_logger));
 
     // external obstacles for bang bang trajectory planner
     external_obstacles_list_.reset(
-        new ThreadedProtoUnixListener<TbotsProto::VirtualObstacles>(
+        new ThreadedProtoIpcListener<TbotsProto::VirtualObstacles>(
             runtime_dir + VIRTUAL_OBSTACLES_UNIX_PATH,
+            ipc_channel_config.getTransport(VIRTUAL_OBSTACLES_UNIX_PATH),
             [&](TbotsProto::VirtualObstacles& msg) { receiveObstacleList(msg); },
             proto_logger));
 
     // The following listeners have an empty callback since their values are
     // only used by proto_logger for replay purposes.
     validation_proto_set_listener.reset(
-        new ThreadedProtoUnixListener<TbotsProto::ValidationProtoSet>(
+        new ThreadedProtoIpcListener<TbotsProto::ValidationProtoSet>(
             runtime_dir + VALIDATION_PROTO_SET_PATH,
+            ipc_channel_config.getTransport(VALIDATION_PROTO_SET_PATH),
             [](TbotsProto::ValidationProtoSet& v) {}, proto_logger));
 
-    robot_log_listener.reset(new ThreadedProtoUnixListener<TbotsProto::RobotLog>(
-        runtime_dir + ROBOT_LOG_PATH, [](TbotsProto::RobotLog& v) {}, proto_logger));
+    robot_log_listener.reset(new ThreadedProtoIpcListener<TbotsProto::RobotLog>(
+        runtime_dir + ROBOT_LOG_PATH, ipc_channel_config.getTransport(ROBOT_LOG_PATH),
+        [](TbotsProto::RobotLog& v) {}, proto_logger));
 
-    robot_crash_listener.reset(new ThreadedProtoUnixListener<TbotsProto::RobotCrash>(
-        runtime_dir + ROBOT_CRASH_PATH, [](TbotsProto::RobotCrash& v) {}, proto_logger));
+    robot_crash_listener.reset(new ThreadedProtoIpcListener<TbotsProto::RobotCrash>(
+        runtime_dir + ROBOT_CRASH_PATH, ipc_channel_config.getTransport(ROBOT_CRASH_PATH),
+        [](TbotsProto::RobotCrash& v) {}, proto_logger));
 
     replay_bookmark_listener.reset(
-        new ThreadedProtoUnixListener<TbotsProto::ReplayBookmark>(
-            runtime_dir + REPLAY_BOOKMARK_PATH, [](TbotsProto::ReplayBookmark& v) {},
-            proto_logger));
+        new ThreadedProtoIpcListener<TbotsProto::ReplayBookmark>(
+            runtime_dir + REPLAY_BOOKMARK_PATH,
+            ipc_channel_config.getTransport(REPLAY_BOOKMARK_PATH),
+            [](TbotsProto::ReplayBookmark& v) {}, proto_logger));
 
     // Protobuf Outputs
-    world_output.reset(new ThreadedProtoUnixSender<TbotsProto::World>(
-        runtime_dir + WORLD_PATH, proto_logger));
+    world_output.reset(new ThreadedProtoIpcSender<TbotsProto::WorldDelta>(
+        runtime_dir + WORLD_PATH, ipc_channel_config.getTransport(WORLD_PATH),
+        proto_logger));
 
-    primitive_output.reset(new ThreadedProtoUnixSender<TbotsProto::PrimitiveSet>(
-        runtime_dir + PRIMITIVE_PATH, proto_logger));
+    primitive_output.reset(new ThreadedProtoIpcSender<TbotsProto::PrimitiveSet>(
+        runtime_dir + PRIMITIVE_PATH, ipc_channel_config.getTransport(PRIMITIVE_PATH),
+        proto_logger));
 
     dynamic_parameter_update_respone_sender.reset(
-        new ThreadedProtoUnixSender<TbotsProto::ThunderbotsConfig>(
-            runtime_dir + DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH, proto_logger));
+        new ThreadedProtoIpcSender<TbotsProto::ThunderbotsConfig>(
+            runtime_dir + DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH,
+            ipc_channel_config.getTransport(DYNAMIC_PARAMETER_UPDATE_RESPONSE_PATH),
+            proto_logger));
 }
 
 void UnixSimulatorBackend::receiveThunderbotsConfig(TbotsProto::ThunderbotsConfig request)
@@ -98,7 +111,8 @@ void UnixSimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 
 void UnixSimulatorBackend::onValueReceived(World world)
 {
-    world_output->sendProto(*createWorldWithSequenceNumber(world, sequence_number++));
+    world_output->sendProto(world_delta_encoder.encode(
+        *createWorldWithSequenceNumber(world, sequence_number++)));
 
     LOG(VISUALIZE) << *createNamedValue(
         "World Hz",
@@ -2,6 +2,7 @@
 
 #include <mutex>
 
+#include "proto/message_translation/world_delta.h"
 #include "proto/parameters.pb.h"
 #include "proto/replay_bookmark.pb.h"
 #include "proto/robot_crash_msg.pb.h"
@@ -13,8 +14,9 @@
 #include "proto/world.pb.h"
 #include "software/backend/backend.h"
 #include "software/logger/proto_logger.h"
-#include "software/networking/unix/threaded_proto_unix_listener.hpp"
-#include "software/networking/unix/threaded_proto_unix_sender.hpp"
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/ipc/threaded_proto_ipc_listener.hpp"
+#include "software/networking/ipc/threaded_proto_ipc_sender.hpp"
 
 class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::ThunderbotsConfig>
 {
@@ -23,9 +25,13 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
      * Constructs a new UnixSimulatorBackend
      *
      * @param runtime_dir The directory to setup the unix sockets
+     * @param proto_logger The proto logger to save the sent and received protos to
+     * @param ipc_channel_config Selects the channels that use shared memory instead of
+     * unix sockets
      */
     UnixSimulatorBackend(std::string runtime_dir,
-                         const std::shared_ptr<ProtoLogger>& proto_logger);
+                         const std::shared_ptr<ProtoLogger>& proto_logger,
+                         const IpcChannelConfig& ipc_channel_config = IpcChannelConfig());
 
     /**
      * Get the timestamp (in seconds) of the last World received
@@ -37,30 +43,29 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
     void onValueReceived(World world) override;
 
-    // ThreadedProtoUnix** to communicate with Thunderscope
+    // ThreadedProtoIpc** to communicate with Thunderscope
     // Inputs
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::VirtualObstacles>>
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::VirtualObstacles>>
         external_obstacles_list_;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::RobotStatus>>
-        robot_status_input;
-    std::unique_ptr<ThreadedProtoUnixListener<SSLProto::SSL_WrapperPacket>>
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::RobotStatus>> robot_status_input;
+    std::unique_ptr<ThreadedProtoIpcListener<SSLProto::SSL_WrapperPacket>>
         ssl_wrapper_input;
-    std::unique_ptr<ThreadedProtoUnixListener<SSLProto::Referee>> ssl_referee_input;
-    std::unique_ptr<ThreadedProtoUnixListener<SensorProto>> sensor_proto_input;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::ThunderbotsConfig>>
+    std::unique_ptr<ThreadedProtoIpcListener<SSLProto::Referee>> ssl_referee_input;
+    std::unique_ptr<ThreadedProtoIpcListener<SensorProto>> sensor_proto_input;
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::ThunderbotsConfig>>
         dynamic_parameter_update_request_listener;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::ValidationProtoSet>>
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::ValidationProtoSet>>
         validation_proto_set_listener;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::RobotLog>> robot_log_listener;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::RobotCrash>>
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::RobotLog>> robot_log_listener;
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::RobotCrash>>
         robot_crash_listener;
-    std::unique_ptr<ThreadedProtoUnixListener<TbotsProto::ReplayBookmark>>
+    std::unique_ptr<ThreadedProtoIpcListener<TbotsProto::ReplayBookmark>>
         replay_bookmark_listener;
 
     // Outputs
-    std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::World>> world_output;
-    std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::PrimitiveSet>> primitive_output;
-    std::unique_ptr<ThreadedProtoUnixSender<TbotsProto::ThunderbotsConfig>>
+    std::unique_ptr<ThreadedProtoIpcSender<TbotsProto::WorldDelta>> world_output;
+    std::unique_ptr<ThreadedProtoIpcSender<TbotsProto::PrimitiveSet>> primitive_output;
+    std::unique_ptr<ThreadedProtoIpcSender<TbotsProto::ThunderbotsConfig>>
         dynamic_parameter_update_respone_sender;
 
     std::shared_ptr<ProtoLogger> proto_logger;
@@ -68,6 +73,10 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
     // World protobuf sequence number counter
     uint64_t sequence_number = 0;
 
+    // Delta encodes the World protobufs sent to Thunderscope and saved to the logs, so
+    // that the field and game state aren't sent every frame
+    WorldDeltaEncoder world_delta_encoder;
+
     // The timestamp of the last world received
     std::atomic<double> last_world_time_sec = 0;
 };
@@ -0,0 +1,250 @@
+#include "software/benchmarks/benchmark_fixtures.h"
+
+#include <array>
+#include <optional>
+
+#include "shared/constants.h"
+
+#ifdef TRACK_ALLOCATIONS
+#include "software/util/allocation_counter/allocation_counter.h"
+#endif
+
+namespace
+{
+/**
+ * Where a robot or the ball is in a formation. Positions are relative to the size of
+ * the field, where (1, 1) is the corner of the field on the enemy side and positive y
+ * side. Velocities are in metres per second.
+ */
+struct Placement
+{
+    double x;
+    double y;
+    double vx = 0.0;
+    double vy = 0.0;
+};
+
+/**
+ * The placement of every robot and the ball in a formation. Robots are ordered by how
+ * much they matter in the situation, with the goalie first, and only the first
+ * DIV_B_NUM_ROBOTS robots of each team are placed on a Division B field.
+ */
+struct FormationPlacements
+{
+    std::array<Placement, DIV_A_NUM_ROBOTS> friendly_robots;
+    std::array<Placement, DIV_A_NUM_ROBOTS> enemy_robots;
+    Placement ball;
+};
+
+const FormationPlacements KICKOFF_PLACEMENTS = {
+    .friendly_robots = {{{-0.95, 0.0},
+                         {-0.1, 0.0},
+                         {-0.15, 0.45},
+                         {-0.15, -0.45},
+                         {-0.5, 0.2},
+                         {-0.5, -0.2},
+                         {-0.3, 0.8},
+                         {-0.3, -0.8},
+                         {-0.65, 0.6},
+                         {-0.65, -0.6},
+                         {-0.4, 0.0}}},
+    .enemy_robots    = {{{0.95, 0.0},
+                         {0.2, 0.1},
+                         {0.25, 0.5},
+                         {0.25, -0.5},
+                         {0.55, 0.25},
+                         {0.55, -0.25},
+                         {0.35, 0.85},
+                         {0.35, -0.85},
+                         {0.68, 0.6},
+                         {0.68, -0.6},
+                         {0.45, 0.0}}},
+    .ball            = {0.0, 0.0},
+};
+
+const FormationPlacements ATTACK_PLACEMENTS = {
+    .friendly_robots = {{{-0.9, 0.05},
+                         {0.52, 0.18, 0.5, 0.0},
+                         {0.6, -0.45, 0.3, 0.5},
+                         {0.45, 0.7, 0.8, -0.3},
+                         {0.3, -0.1, 1.0, 0.0},
+                         {0.1, 0.4, 0.6, -0.2},
+                         {0.0, -0.6, 1.2, 0.2},
+                         {-0.25, 0.2, 0.5, 0.0},
+                         {-0.4, -0.3, 0.4, 0.1},
+                         {0.62, 0.0, 0.2, 0.4},
+                         {-0.1, 0.75, 0.7, -0.1}}},
+    .enemy_robots    = {{{0.95, 0.05},
+                         {0.68, 0.2, 0.0, 0.2},
+                         {0.68, -0.1, 0.0, 0.1},
+                         {0.72, 0.45, 0.0, -0.2},
+                         {0.6, 0.3, -0.3, 0.0},
+                         {0.62, -0.4, 0.1, 0.3},
+                         {0.45, 0.6, 0.4, -0.4},
+                         {0.4, -0.2, 0.5, 0.3},
+                         {0.3, 0.2, 0.6, 0.0},
+                         {0.2, -0.5, 0.8, 0.2},
+                         {-0.1, 0.1, 0.3, 0.0}}},
+    .ball            = {0.545, 0.18, 0.5, 0.0},
+};
+
+/**
+ * Rotates a placement half a turn around the centre of the field, which swaps the
+ * side of the field it is on
+ *
+ * @param placement The placement to rotate
+ *
+ * @return the rotated placement
+ */
+Placement rotateHalfTurn(const Placement& placement)
+{
+    return Placement{-placement.x, -placement.y, -placement.vx, -placement.vy};
+}
+
+/**
+ * Gets the placements of a formation
+ *
+ * @param formation The formation
+ *
+ * @return the placements of every robot and the ball
+ */
+FormationPlacements getFormationPlacements(BenchmarkFormation formation)
+{
+    switch (formation)
+    {
+        case BenchmarkFormation::KICKOFF:
+            return KICKOFF_PLACEMENTS;
+        case BenchmarkFormation::ATTACK:
+            return ATTACK_PLACEMENTS;
+        case BenchmarkFormation::DEFENSE:
+        {
+            // Defending is attacking with the teams swapped
+            FormationPlacements placements;
+            for (unsigned int i = 0; i < DIV_A_NUM_ROBOTS; i++)
+            {
+                placements.friendly_robots[i] =
+                    rotateHalfTurn(ATTACK_PLACEMENTS.enemy_robots[i]);
+                placements.enemy_robots[i] =
+                    rotateHalfTurn(ATTACK_PLACEMENTS.friendly_robots[i]);
+            }
+            placements.ball = rotateHalfTurn(ATTACK_PLACEMENTS.ball);
+            return placements;
+        }
+    }
+    throw std::invalid_argument("Unknown BenchmarkFormation");
+}
+
+/**
+ * Creates a team from the placements of its robots. Every robot faces the ball, and
+ * the first robot is the goalie.
+ *
+ * @param field The field the team is on
+ * @param robot_placements The placements of the robots
+ * @param num_robots The number of robots to place
+ * @param ball_position Where the ball is
+ * @param timestamp When the robots were seen
+ *
+ * @return the team
+ */
+Team createTeam(const Field& field,
+                const std::array<Placement, DIV_A_NUM_ROBOTS>& robot_placements,
+                unsigned int num_robots, const Point& ball_position,
+                const Timestamp& timestamp)
+{
+    std::vector<Robot> robots;
+    for (RobotId id = 0; id < num_robots; id++)
+    {
+        const Placement& placement = robot_placements[id];
+        const Point position(placement.x * field.xLength() / 2,
+                             placement.y * field.yLength() / 2);
+        robots.emplace_back(id,
+                            RobotState(position, Vector(placement.vx, placement.vy),
+                                       (ball_position - position).orientation(),
+                                       AngularVelocity::zero()),
+                            timestamp);
+    }
+
+    Team team(robots);
+    team.assignGoalie(0);
+    return team;
+}
+
+#ifdef TRACK_ALLOCATIONS
+/**
+ * Counts the heap allocations made by each benchmark, which Google Benchmark reports
+ * per iteration in an extra run of the benchmark
+ */
+class AllocationMemoryManager : public benchmark::MemoryManager
+{
+   public:
+    void Start() override
+    {
+        allocation_counter_.emplace();
+    }
+
+    void Stop(Result& result) override
+    {
+        result.num_allocs =
+            static_cast<int64_t>(allocation_counter_->getNumAllocations());
+        result.total_allocated_bytes =
+            static_cast<int64_t>(allocation_counter_->getNumBytesAllocated());
+        allocation_counter_.reset();
+    }
+
+   private:
+    std::optional<ScopedAllocationCounter> allocation_counter_;
+};
+
+AllocationMemoryManager allocation_memory_manager;
+
+// Registered while the benchmark binary is initialized, before main runs the
+// benchmarks
+const bool allocation_memory_manager_registered = []()
+{
+    benchmark::RegisterMemoryManager(&allocation_memory_manager);
+    return true;
+}();
+#endif
+}  // namespace
+
+std::shared_ptr<World> createBenchmarkWorld(TbotsProto::FieldType field_type,
+                                            BenchmarkFormation formation)
+{
+    const Field field = Field::createField(field_type);
+    const unsigned int num_robots =
+        field_type == TbotsProto::FieldType::DIV_A ? DIV_A_NUM_ROBOTS : DIV_B_NUM_ROBOTS;
+    const FormationPlacements placements = getFormationPlacements(formation);
+    const Timestamp timestamp            = Timestamp::fromSeconds(1);
+
+    const Point ball_position(placements.ball.x * field.xLength() / 2,
+                              placements.ball.y * field.yLength() / 2);
+    const Ball ball(ball_position, Vector(placements.ball.vx, placements.ball.vy),
+                    timestamp);
+
+    return std::make_shared<World>(
+        field, ball,
+        createTeam(field, placements.friendly_robots, num_robots, ball_position,
+                   timestamp),
+        createTeam(field, placements.enemy_robots, num_robots, ball_position,
+                   timestamp));
+}
+
+void addFieldAndFormationArgs(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"field", "formation"});
+    benchmark->ArgsProduct(
+        {{TbotsProto::FieldType::DIV_A, TbotsProto::FieldType::DIV_B},
+         benchmark::CreateDenseRange(
+             0, static_cast<int>(reflective_enum::size<BenchmarkFormation>()) - 1, 1)});
+}
+
+std::shared_ptr<World> getBenchmarkWorld(benchmark::State& state)
+{
+    const auto field_type = static_cast<TbotsProto::FieldType>(state.range(0));
+    const BenchmarkFormation formation =
+        reflective_enum::values<BenchmarkFormation>().at(
+            static_cast<std::size_t>(state.range(1)));
+
+    state.SetLabel(TbotsProto::FieldType_Name(field_type) + "/" + formation);
+    return createBenchmarkWorld(field_type, formation);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "proto/world.pb.h"
+#include "software/util/make_enum/make_enum.hpp"
+#include "software/world/world.h"
+
+/**
+ * Worlds to run the benchmarks on, so that every benchmark measures the same kinds of
+ * game situations the AI sees in a match.
+ *
+ * Each formation is a snapshot of a typical game situation, with the positions and
+ * velocities of every robot and the ball given relative to the size of the field. A
+ * formation is scaled onto either a Division A field with 11 robots per team or a
+ * Division B field with 6 robots per team, where the 6 robots are the goalie and the
+ * 5 robots that matter most in the situation.
+ */
+
+// The game situations that benchmark worlds can be created for. The friendly team
+// defends the negative x side of the field.
+//  - KICKOFF: Both teams are in their own half, with the ball at centre
+//  - ATTACK: The friendly team has the ball near the enemy defense area, and the enemy
+//    team is packed in around its net
+//  - DEFENSE: The enemy team has the ball near the friendly defense area, and the
+//    friendly team is packed in around its net
+MAKE_ENUM(BenchmarkFormation, KICKOFF, ATTACK, DEFENSE);
+
+/**
+ * Creates a World with both teams in the given formation
+ *
+ * @param field_type The field to play on, which decides the number of robots per team
+ * @param formation The formation of both teams and the ball
+ *
+ * @return the World
+ */
+std::shared_ptr<World> createBenchmarkWorld(TbotsProto::FieldType field_type,
+                                            BenchmarkFormation formation);
+
+/**
+ * Runs a benchmark on every combination of field and formation. The benchmark gets
+ * its World from getBenchmarkWorld.
+ *
+ * @param benchmark The benchmark to add the field and formation arguments to
+ */
+void addFieldAndFormationArgs(benchmark::internal::Benchmark* benchmark);
+
+/**
+ * Creates the World for the field and formation arguments of a benchmark run, and
+ * labels the run with them
+ *
+ * @param state The state of the benchmark run, with the arguments added by
+ * addFieldAndFormationArgs
+ *
+ * @return the World
+ */
+std::shared_ptr<World> getBenchmarkWorld(benchmark::State& state);
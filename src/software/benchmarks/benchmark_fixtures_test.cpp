@@ -0,0 +1,72 @@
+#include "software/benchmarks/benchmark_fixtures.h"
+
+#include <gtest/gtest.h>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
+
+class BenchmarkFixturesTest
+    : public ::testing::TestWithParam<
+          std::tuple<TbotsProto::FieldType, BenchmarkFormation>>
+{
+};
+
+TEST_P(BenchmarkFixturesTest, world_has_full_teams_on_the_field)
+{
+    const auto [field_type, formation] = GetParam();
+    std::shared_ptr<World> world       = createBenchmarkWorld(field_type, formation);
+
+    const size_t num_robots =
+        field_type == TbotsProto::FieldType::DIV_A ? DIV_A_NUM_ROBOTS : DIV_B_NUM_ROBOTS;
+    EXPECT_EQ(num_robots, world->friendlyTeam().numRobots());
+    EXPECT_EQ(num_robots, world->enemyTeam().numRobots());
+
+    const Rectangle& field_lines = world->field().fieldLines();
+    EXPECT_TRUE(contains(field_lines, world->ball().position()));
+    for (const Team& team : {world->friendlyTeam(), world->enemyTeam()})
+    {
+        for (const Robot& robot : team.getAllRobots())
+        {
+            EXPECT_TRUE(contains(field_lines, robot.position())) << robot.position();
+        }
+    }
+}
+
+TEST_P(BenchmarkFixturesTest, goalies_are_in_their_defense_areas)
+{
+    const auto [field_type, formation] = GetParam();
+    std::shared_ptr<World> world       = createBenchmarkWorld(field_type, formation);
+
+    ASSERT_TRUE(world->friendlyTeam().goalie().has_value());
+    ASSERT_TRUE(world->enemyTeam().goalie().has_value());
+    EXPECT_TRUE(world->field().pointInFriendlyDefenseArea(
+        world->friendlyTeam().goalie()->position()));
+    EXPECT_TRUE(
+        world->field().pointInEnemyDefenseArea(world->enemyTeam().goalie()->position()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    AllFieldsAndFormations, BenchmarkFixturesTest,
+    ::testing::Combine(
+        ::testing::Values(TbotsProto::FieldType::DIV_A, TbotsProto::FieldType::DIV_B),
+        ::testing::ValuesIn(reflective_enum::values<BenchmarkFormation>())));
+
+TEST(BenchmarkFixturesMirrorTest, defense_is_attack_with_teams_swapped)
+{
+    std::shared_ptr<World> attack =
+        createBenchmarkWorld(TbotsProto::FieldType::DIV_A, BenchmarkFormation::ATTACK);
+    std::shared_ptr<World> defense =
+        createBenchmarkWorld(TbotsProto::FieldType::DIV_A, BenchmarkFormation::DEFENSE);
+
+    EXPECT_EQ(attack->ball().position(), -defense->ball().position());
+    EXPECT_EQ(attack->ball().velocity(), -defense->ball().velocity());
+
+    const std::vector<Robot> attackers = attack->friendlyTeam().getAllRobots();
+    const std::vector<Robot> defenders = defense->enemyTeam().getAllRobots();
+    ASSERT_EQ(attackers.size(), defenders.size());
+    for (size_t i = 0; i < attackers.size(); i++)
+    {
+        EXPECT_EQ(attackers[i].position(), -defenders[i].position());
+        EXPECT_EQ(attackers[i].velocity(), -defenders[i].velocity());
+    }
+}
@@ -0,0 +1,228 @@
+"""Compares two runs of the benchmarks and flags statistically significant regressions.
+
+Each run is the JSON output of a benchmark binary run with repetitions, e.g.
+
+    bazel run //software/benchmarks:geom_benchmark -- \
+        --benchmark_repetitions=20 \
+        --benchmark_out=/tmp/baseline.json --benchmark_out_format=json
+
+The repetitions of each benchmark in both runs are compared with a two-sided
+Mann-Whitney U test, which doesn't assume the timings are normally distributed. A
+benchmark has regressed if its timings differ significantly and its median got slower
+by more than the minimum change, so that tiny but consistent differences (e.g. from
+code alignment) aren't flagged.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import math
+import statistics
+import sys
+from dataclasses import dataclass
+
+# Fewer repetitions than this can't show a significant difference at the usual alphas
+MIN_NUM_REPETITIONS = 5
+
+
+@dataclass
+class BenchmarkComparison:
+    """The comparison of a benchmark between two runs"""
+
+    name: str
+    baseline_median: float
+    contender_median: float
+    time_unit: str
+    p_value: float
+
+    @property
+    def change(self) -> float:
+        """The relative change of the median, where positive means slower"""
+        return (self.contender_median - self.baseline_median) / self.baseline_median
+
+
+def load_benchmark_times(path: str, metric: str) -> dict[str, tuple[list[float], str]]:
+    """Loads the time of every repetition of every benchmark in a run
+
+    :param path: The path to the JSON output of the benchmark binary
+    :param metric: The time to compare, either "real_time" or "cpu_time"
+    :return: The times and time unit of each benchmark, keyed by benchmark name
+    """
+    with open(path) as file:
+        run = json.load(file)
+
+    benchmark_times = {}
+    for benchmark in run["benchmarks"]:
+        # Skip the aggregates (mean, median, stddev) of the repetitions
+        if benchmark.get("run_type", "iteration") != "iteration":
+            continue
+
+        name = benchmark.get("run_name", benchmark["name"])
+        times, _ = benchmark_times.setdefault(name, ([], benchmark["time_unit"]))
+        times.append(benchmark[metric])
+
+    return benchmark_times
+
+
+def mann_whitney_u_test(first: list[float], second: list[float]) -> float:
+    """Runs a two-sided Mann-Whitney U test on two samples, using the normal
+    approximation with a correction for ties
+
+    :param first: The first sample
+    :param second: The second sample
+    :return: The p-value of the samples coming from the same distribution
+    """
+    num_first = len(first)
+    num_second = len(second)
+    num_total = num_first + num_second
+
+    # Rank the combined samples, giving tied values the average of their ranks
+    values = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    ranks = [0.0] * num_total
+    tie_correction = 0.0
+    i = 0
+    while i < num_total:
+        j = i
+        while j + 1 < num_total and values[j + 1][0] == values[i][0]:
+            j += 1
+        num_tied = j - i + 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        tie_correction += num_tied**3 - num_tied
+        i = j + 1
+
+    rank_sum_first = sum(
+        rank for rank, (_, sample) in zip(ranks, values) if sample == 0
+    )
+    u = rank_sum_first - num_first * (num_first + 1) / 2
+
+    mean_u = num_first * num_second / 2
+    variance_u = (
+        num_first
+        * num_second
+        / 12
+        * ((num_total + 1) - tie_correction / (num_total * (num_total - 1)))
+    )
+    if variance_u <= 0:
+        return 1.0
+
+    # Continuity correction towards the mean
+    z = (abs(u - mean_u) - 0.5) / math.sqrt(variance_u)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+
+def compare_runs(
+    baseline: dict[str, tuple[list[float], str]],
+    contender: dict[str, tuple[list[float], str]],
+) -> list[BenchmarkComparison]:
+    """Compares every benchmark that is in both runs
+
+    :param baseline: The benchmark times of the baseline run
+    :param contender: The benchmark times of the run to compare against the baseline
+    :return: The comparison of each benchmark, in the order of the baseline run
+    """
+    comparisons = []
+    for name, (baseline_times, time_unit) in baseline.items():
+        if name not in contender:
+            continue
+
+        contender_times, contender_time_unit = contender[name]
+        if contender_time_unit != time_unit:
+            print(
+                f"Skipping {name}: time units differ "
+                f"({time_unit}, {contender_time_unit})",
+                file=sys.stderr,
+            )
+            continue
+
+        comparisons.append(
+            BenchmarkComparison(
+                name=name,
+                baseline_median=statistics.median(baseline_times),
+                contender_median=statistics.median(contender_times),
+                time_unit=time_unit,
+                p_value=mann_whitney_u_test(baseline_times, contender_times),
+            )
+        )
+
+    return comparisons
+
+
+def main() -> int:
+    """Compares two benchmark runs and prints the change of every benchmark
+
+    :return: 1 if any benchmark regressed, 0 otherwise
+    """
+    parser = argparse.ArgumentParser(
+        description="Compares two benchmark runs and flags significant regressions"
+    )
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("contender", help="JSON output of the run to compare")
+    parser.add_argument(
+        "--alpha",
+        type=float,
+        default=0.01,
+        help="Significance level of the Mann-Whitney U test",
+    )
+    parser.add_argument(
+        "--min_change",
+        type=float,
+        default=0.05,
+        help="Smallest relative slowdown of the median that counts as a regression",
+    )
+    parser.add_argument(
+        "--metric",
+        choices=["real_time", "cpu_time"],
+        default="cpu_time",
+        help="Which time to compare",
+    )
+    args = parser.parse_args()
+
+    baseline = load_benchmark_times(args.baseline, args.metric)
+    contender = load_benchmark_times(args.contender, args.metric)
+
+    num_repetitions = min(
+        len(times) for times, _ in list(baseline.values()) + list(contender.values())
+    )
+    if num_repetitions < MIN_NUM_REPETITIONS:
+        print(
+            f"Warning: some benchmarks only have {num_repetitions} repetitions. Run "
+            f"with --benchmark_repetitions={MIN_NUM_REPETITIONS * 4} or more for "
+            "significant results.",
+            file=sys.stderr,
+        )
+
+    comparisons = compare_runs(baseline, contender)
+    name_width = max([len(comparison.name) for comparison in comparisons] + [9])
+
+    print(
+        f"{'Benchmark':<{name_width}} {'Baseline':>12} {'Contender':>12} "
+        f"{'Change':>8} {'p-value':>8}"
+    )
+    regressions = []
+    for comparison in comparisons:
+        significant = comparison.p_value < args.alpha
+        if significant and comparison.change > args.min_change:
+            verdict = "REGRESSION"
+            regressions.append(comparison)
+        elif significant and comparison.change < -args.min_change:
+            verdict = "improvement"
+        else:
+            verdict = ""
+
+        print(
+            f"{comparison.name:<{name_width}} "
+            f"{comparison.baseline_median:>9.1f} {comparison.time_unit:<2} "
+            f"{comparison.contender_median:>9.1f} {comparison.time_unit:<2} "
+            f"{comparison.change:>+8.1%} {comparison.p_value:>8.4f} {verdict}"
+        )
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/enemy_threat.h"
+#include "software/benchmarks/benchmark_fixtures.h"
+
+static void BM_CalcBestShotOnGoal(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const std::vector<Robot> shooters  = world->friendlyTeam().getAllRobots();
+
+    // Every friendly robot shoots at the enemy goal, ignoring itself as an obstacle
+    for (auto _ : state)
+    {
+        for (const Robot& shooter : shooters)
+        {
+            benchmark::DoNotOptimize(calcBestShotOnGoal(
+                world->field(), world->friendlyTeam(), world->enemyTeam(),
+                shooter.position(), TeamType::ENEMY, {shooter}));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(shooters.size()));
+}
+BENCHMARK(BM_CalcBestShotOnGoal)->Apply(addFieldAndFormationArgs);
+
+static void BM_GetAllEnemyThreats(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(getAllEnemyThreats(world->field(), world->friendlyTeam(),
+                                                    world->enemyTeam(), world->ball(),
+                                                    false));
+    }
+}
+BENCHMARK(BM_GetAllEnemyThreats)->Apply(addFieldAndFormationArgs);
@@ -0,0 +1,206 @@
+#include <benchmark/benchmark.h>
+
+#include "shared/constants.h"
+#include "software/benchmarks/benchmark_fixtures.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersection.h"
+#include "software/geom/algorithms/intersects.h"
+
+// How far ahead (in seconds) robots are swept along their velocity, which is about how
+// far ahead navigation checks for collisions
+static constexpr double SWEEP_DURATION_S = 0.5;
+
+/**
+ * Gets the area each robot of a team sweeps through over the next SWEEP_DURATION_S,
+ * assuming it keeps its current velocity
+ *
+ * @param team The team
+ *
+ * @return the stadium swept by each robot of the team
+ */
+static std::vector<Stadium> getSweptRobotStadiums(const Team& team)
+{
+    std::vector<Stadium> stadiums;
+    for (const Robot& robot : team.getAllRobots())
+    {
+        stadiums.emplace_back(robot.position(),
+                              robot.position() + robot.velocity() * SWEEP_DURATION_S,
+                              ROBOT_MAX_RADIUS_METERS);
+    }
+    return stadiums;
+}
+
+/**
+ * Gets the polygons that navigation and evaluation commonly test shapes against: both
+ * defense areas inflated by a robot radius, and a polygon around every enemy robot
+ *
+ * @param world The world
+ *
+ * @return the polygons
+ */
+static std::vector<Polygon> getObstaclePolygons(const World& world)
+{
+    std::vector<Polygon> polygons = {
+        world.field().friendlyDefenseArea().expand(ROBOT_MAX_RADIUS_METERS),
+        world.field().enemyDefenseArea().expand(ROBOT_MAX_RADIUS_METERS)};
+    for (const Robot& robot : world.enemyTeam().getAllRobots())
+    {
+        polygons.push_back(Polygon::fromSegment(
+            Segment(robot.position(),
+                    robot.position() + robot.velocity() * SWEEP_DURATION_S),
+            2 * ROBOT_MAX_RADIUS_METERS));
+    }
+    return polygons;
+}
+
+/**
+ * Gets the segments from the ball to every friendly robot, which are the lanes passes
+ * travel along
+ *
+ * @param world The world
+ *
+ * @return the pass lanes
+ */
+static std::vector<Segment> getPassLanes(const World& world)
+{
+    std::vector<Segment> pass_lanes;
+    for (const Robot& robot : world.friendlyTeam().getAllRobots())
+    {
+        pass_lanes.emplace_back(world.ball().position(), robot.position());
+    }
+    return pass_lanes;
+}
+
+/**
+ * Gets a grid of points covering the field
+ *
+ * @param field The field
+ *
+ * @return the points
+ */
+static std::vector<Point> getFieldGridPoints(const Field& field)
+{
+    static constexpr int NUM_GRID_POINTS_PER_SIDE = 20;
+
+    std::vector<Point> points;
+    const Rectangle& field_lines = field.fieldLines();
+    for (int i = 0; i < NUM_GRID_POINTS_PER_SIDE; i++)
+    {
+        for (int j = 0; j < NUM_GRID_POINTS_PER_SIDE; j++)
+        {
+            points.emplace_back(field_lines.xMin() + field_lines.xLength() * i /
+                                                         NUM_GRID_POINTS_PER_SIDE,
+                                field_lines.yMin() + field_lines.yLength() * j /
+                                                         NUM_GRID_POINTS_PER_SIDE);
+        }
+    }
+    return points;
+}
+
+static void BM_IntersectsStadiumPolygon(benchmark::State& state)
+{
+    const std::shared_ptr<World> world   = getBenchmarkWorld(state);
+    const std::vector<Stadium> stadiums  = getSweptRobotStadiums(world->friendlyTeam());
+    const std::vector<Polygon> polygons  = getObstaclePolygons(*world);
+
+    for (auto _ : state)
+    {
+        for (const Stadium& stadium : stadiums)
+        {
+            for (const Polygon& polygon : polygons)
+            {
+                benchmark::DoNotOptimize(intersects(stadium, polygon));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(stadiums.size() * polygons.size()));
+}
+BENCHMARK(BM_IntersectsStadiumPolygon)->Apply(addFieldAndFormationArgs);
+
+static void BM_IntersectsStadiumStadium(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const std::vector<Stadium> friendly_stadiums =
+        getSweptRobotStadiums(world->friendlyTeam());
+    const std::vector<Stadium> enemy_stadiums = getSweptRobotStadiums(world->enemyTeam());
+
+    for (auto _ : state)
+    {
+        for (const Stadium& friendly_stadium : friendly_stadiums)
+        {
+            for (const Stadium& enemy_stadium : enemy_stadiums)
+            {
+                benchmark::DoNotOptimize(intersects(friendly_stadium, enemy_stadium));
+            }
+        }
+    }
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<int64_t>(friendly_stadiums.size() * enemy_stadiums.size()));
+}
+BENCHMARK(BM_IntersectsStadiumStadium)->Apply(addFieldAndFormationArgs);
+
+static void BM_IntersectionPolygonSegment(benchmark::State& state)
+{
+    const std::shared_ptr<World> world  = getBenchmarkWorld(state);
+    const std::vector<Segment> lanes    = getPassLanes(*world);
+    const std::vector<Polygon> polygons = getObstaclePolygons(*world);
+
+    for (auto _ : state)
+    {
+        for (const Segment& lane : lanes)
+        {
+            for (const Polygon& polygon : polygons)
+            {
+                benchmark::DoNotOptimize(intersection(polygon, lane));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(lanes.size() * polygons.size()));
+}
+BENCHMARK(BM_IntersectionPolygonSegment)->Apply(addFieldAndFormationArgs);
+
+static void BM_ContainsPolygonPoint(benchmark::State& state)
+{
+    const std::shared_ptr<World> world  = getBenchmarkWorld(state);
+    const std::vector<Point> points     = getFieldGridPoints(world->field());
+    const std::vector<Polygon> polygons = getObstaclePolygons(*world);
+
+    for (auto _ : state)
+    {
+        for (const Polygon& polygon : polygons)
+        {
+            for (const Point& point : points)
+            {
+                benchmark::DoNotOptimize(contains(polygon, point));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(points.size() * polygons.size()));
+}
+BENCHMARK(BM_ContainsPolygonPoint)->Apply(addFieldAndFormationArgs);
+
+static void BM_DistancePointPolygon(benchmark::State& state)
+{
+    const std::shared_ptr<World> world  = getBenchmarkWorld(state);
+    const std::vector<Point> points     = getFieldGridPoints(world->field());
+    const std::vector<Polygon> polygons = getObstaclePolygons(*world);
+
+    for (auto _ : state)
+    {
+        for (const Polygon& polygon : polygons)
+        {
+            for (const Point& point : points)
+            {
+                benchmark::DoNotOptimize(distance(point, polygon));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(points.size() * polygons.size()));
+}
+BENCHMARK(BM_DistancePointPolygon)->Apply(addFieldAndFormationArgs);
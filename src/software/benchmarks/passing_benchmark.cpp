@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/passing/cost_function.h"
+#include "software/ai/passing/pass_generator.h"
+#include "software/benchmarks/benchmark_fixtures.h"
+
+/**
+ * Creates the default passing config, with the pass success rollouts run on the
+ * benchmark thread so that the results don't depend on how busy the other cores are
+ *
+ * @return the passing config
+ */
+static TbotsProto::PassingConfig createPassingConfig()
+{
+    TbotsProto::PassingConfig passing_config;
+    passing_config.set_pass_success_num_worker_threads(0);
+    return passing_config;
+}
+
+static void BM_RatePass(benchmark::State& state)
+{
+    static constexpr int NUM_RECEIVER_POINTS_PER_SIDE = 10;
+
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const TbotsProto::PassingConfig passing_config = createPassingConfig();
+    const PassingParams passing_params(passing_config);
+
+    // Passes from the ball to a grid of receiver points covering the field
+    std::vector<Pass> passes;
+    const Rectangle& field_lines = world->field().fieldLines();
+    for (int i = 0; i < NUM_RECEIVER_POINTS_PER_SIDE; i++)
+    {
+        for (int j = 0; j < NUM_RECEIVER_POINTS_PER_SIDE; j++)
+        {
+            const Point receiver_point(
+                field_lines.xMin() + field_lines.xLength() * (i + 0.5) /
+                                         NUM_RECEIVER_POINTS_PER_SIDE,
+                field_lines.yMin() + field_lines.yLength() * (j + 0.5) /
+                                         NUM_RECEIVER_POINTS_PER_SIDE);
+            passes.push_back(Pass::fromDestReceiveSpeed(world->ball().position(),
+                                                        receiver_point, passing_config));
+        }
+    }
+
+    for (auto _ : state)
+    {
+        // The pass generator shares one BestShotCalculator between every pass it rates
+        const BestShotCalculator best_shot_calculator =
+            createEnemyGoalShotCalculator(world->field(), world->enemyTeam());
+        for (const Pass& pass : passes)
+        {
+            benchmark::DoNotOptimize(
+                ratePass(*world, pass, best_shot_calculator, passing_params));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(passes.size()));
+}
+BENCHMARK(BM_RatePass)->Apply(addFieldAndFormationArgs);
+
+static void BM_PassGeneratorGetBestPass(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const TbotsProto::PassingConfig passing_config = createPassingConfig();
+    const PassingParams passing_params(passing_config);
+    WorkerPool worker_pool(passing_config.pass_success_num_worker_threads());
+    PassGenerator pass_generator(passing_config);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            pass_generator.getBestPass(*world, passing_params, worker_pool));
+    }
+}
+BENCHMARK(BM_PassGeneratorGetBestPass)
+    ->Apply(addFieldAndFormationArgs)
+    ->Unit(benchmark::kMillisecond);
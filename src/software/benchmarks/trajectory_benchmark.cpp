@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
+#include "software/ai/navigator/trajectory/trajectory_planner.h"
+#include "software/benchmarks/benchmark_fixtures.h"
+
+// The kinematic constraints robots are planned with
+static constexpr double MAX_SPEED_M_PER_S         = 3.0;
+static constexpr double MAX_ACCELERATION_M_PER_S2 = 3.0;
+static constexpr double MAX_DECELERATION_M_PER_S2 = 3.0;
+
+/**
+ * A robot that navigation plans a trajectory for
+ */
+struct PlanningRequest
+{
+    Point start;
+    Point destination;
+    Vector initial_velocity;
+    std::vector<ObstaclePtr> obstacles;
+};
+
+/**
+ * Creates a planning request for every friendly robot other than the goalie, to a
+ * destination on the other side of the field so that the trajectory crosses the
+ * other robots. The obstacles are both defense areas, the other friendly robots and
+ * the enemy robots.
+ *
+ * @param world The world
+ * @param obstacle_factory The factory to create the obstacles with
+ *
+ * @return the planning requests
+ */
+static std::vector<PlanningRequest> createPlanningRequests(
+    const World& world, const RobotNavigationObstacleFactory& obstacle_factory)
+{
+    const std::vector<ObstaclePtr> field_obstacles =
+        obstacle_factory.createObstaclesFromMotionConstraints(
+            {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+             TbotsProto::MotionConstraint::ENEMY_DEFENSE_AREA},
+            world);
+    auto in_field_obstacle = [&field_obstacles](const Point& point)
+    {
+        return std::any_of(field_obstacles.begin(), field_obstacles.end(),
+                           [&point](const ObstaclePtr& obstacle)
+                           { return obstacle->contains(point); });
+    };
+
+    std::vector<PlanningRequest> requests;
+    for (const Robot& robot : world.friendlyTeam().getAllRobots())
+    {
+        if (world.friendlyTeam().getGoalieId() == robot.id())
+        {
+            continue;
+        }
+
+        PlanningRequest request{robot.position(), -robot.position(), robot.velocity(),
+                                field_obstacles};
+        if (in_field_obstacle(request.destination))
+        {
+            request.destination = Point(robot.position().x(), -robot.position().y());
+        }
+
+        for (const Robot& other_robot : world.friendlyTeam().getAllRobots())
+        {
+            if (other_robot.id() != robot.id())
+            {
+                request.obstacles.push_back(
+                    obstacle_factory.createStaticObstacleFromRobotPosition(
+                        other_robot.position()));
+            }
+        }
+        for (const Robot& enemy_robot : world.enemyTeam().getAllRobots())
+        {
+            request.obstacles.push_back(
+                obstacle_factory.createStadiumEnemyRobotObstacle(enemy_robot));
+        }
+
+        requests.push_back(std::move(request));
+    }
+    return requests;
+}
+
+static void BM_BangBangTrajectory2DGenerate(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const RobotNavigationObstacleFactory obstacle_factory(
+        (TbotsProto::RobotNavigationObstacleConfig()));
+    const std::vector<PlanningRequest> requests =
+        createPlanningRequests(*world, obstacle_factory);
+
+    BangBangTrajectory2D trajectory;
+    for (auto _ : state)
+    {
+        for (const PlanningRequest& request : requests)
+        {
+            trajectory.generate(request.start, request.destination,
+                                request.initial_velocity, MAX_SPEED_M_PER_S,
+                                MAX_ACCELERATION_M_PER_S2, MAX_DECELERATION_M_PER_S2);
+            benchmark::DoNotOptimize(trajectory);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(requests.size()));
+}
+BENCHMARK(BM_BangBangTrajectory2DGenerate)->Apply(addFieldAndFormationArgs);
+
+static void BM_TrajectoryPlannerFindTrajectory(benchmark::State& state)
+{
+    const std::shared_ptr<World> world = getBenchmarkWorld(state);
+    const RobotNavigationObstacleFactory obstacle_factory(
+        (TbotsProto::RobotNavigationObstacleConfig()));
+    const std::vector<PlanningRequest> requests =
+        createPlanningRequests(*world, obstacle_factory);
+    const KinematicConstraints constraints(MAX_SPEED_M_PER_S, MAX_ACCELERATION_M_PER_S2,
+                                           MAX_DECELERATION_M_PER_S2);
+
+    TrajectoryPlanner planner;
+    for (auto _ : state)
+    {
+        for (const PlanningRequest& request : requests)
+        {
+            benchmark::DoNotOptimize(planner.findTrajectory(
+                request.start, request.destination, request.initial_velocity,
+                constraints, request.obstacles, world->field().fieldBoundary()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(requests.size()));
+}
+BENCHMARK(BM_TrajectoryPlannerFindTrajectory)->Apply(addFieldAndFormationArgs);
@@ -3,7 +3,7 @@
 #include "software/geom/algorithms/distance.h"
 
 Vector PositionController::step(const Point& position,
-                                const TrajectoryPath& target_trajectory,
+                                const Trajectory2D& target_trajectory,
                                 Duration elapsed_time, Duration delta_time)
 {
     // feedforward trajectory velocity with small pid control effort
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/ai/navigator/trajectory/trajectory_2d.h"
 #include "software/embedded/motion_control/controller.h"
 #include "software/embedded/motion_control/pid_controller.h"
 #include "software/geom/point.h"
 #include "software/geom/vector.h"
 #include "software/time/duration.h"
 
-class PositionController : public MotionController<Point, TrajectoryPath, Vector>
+class PositionController : public MotionController<Point, Trajectory2D, Vector>
 {
    public:
     /**
@@ -21,11 +21,11 @@ class PositionController : public MotionController<Point, TrajectoryPath, Vector
      * minimize error between the two.
      *
      * @param position The actual position.
-     * @param target_trajectory The target 2D trajectory path.
+     * @param target_trajectory The target 2D trajectory.
      * @param elapsed_time The elapsed time since the trajectory was created.
      * @param delta_time The time passed since last time step.
      */
-    Vector step(const Point& position, const TrajectoryPath& target_trajectory,
+    Vector step(const Point& position, const Trajectory2D& target_trajectory,
                 Duration elapsed_time, Duration delta_time) override;
 
     /**
@@ -4,6 +4,8 @@
 
 #include <memory>
 
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+
 // TODO(#3743): write proper tests after pid constants have been tuned
 
 TEST(PositionControllerTest, BasicTest)
@@ -0,0 +1,161 @@
+#include "software/embedded/motor_controller/fake_stspin_motor_driver.h"
+
+#include <algorithm>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include "cppcrc.h"
+#pragma GCC diagnostic pop
+
+// AUTOSAR variant of CRC-8
+// (https://reveng.sourceforge.io/crc-catalogue/all.htm#crc.cat.crc-8-autosar)
+using Crc8Autosar = crc_utils::crc<uint8_t, 0x2F, 0xFF, false, false, 0xFF>;
+
+static constexpr std::size_t SEQ_INDEX    = STSPIN_MESSAGE_DELIMITER.size();
+static constexpr std::size_t OPCODE_INDEX = SEQ_INDEX + 1;
+
+/**
+ * Reads a big-endian 16 bit value out of a message
+ *
+ * @param message The message
+ * @param index The index of the most significant byte of the value
+ *
+ * @return the value
+ */
+static int16_t readInt16(const std::array<uint8_t, STSPIN_MESSAGE_SIZE>& message,
+                         const std::size_t index)
+{
+    return static_cast<int16_t>((static_cast<uint16_t>(message[index]) << 8) |
+                                message[index + 1]);
+}
+
+/**
+ * Writes a big-endian 16 bit value into a message
+ *
+ * @param message The message
+ * @param index The index of the most significant byte of the value
+ * @param value The value
+ */
+static void writeInt16(std::array<uint8_t, STSPIN_MESSAGE_SIZE>& message,
+                       const std::size_t index, const int16_t value)
+{
+    message[index]     = static_cast<uint8_t>(0xFF & (value >> 8));
+    message[index + 1] = static_cast<uint8_t>(0xFF & value);
+}
+
+FakeStSpinMotorDriver::FakeStSpinMotorDriver()
+    : next_reply_{},
+      response_type_(StSpinResponseType::SPEED_AND_FAULTS),
+      fault_flags_(0),
+      enabled_(false),
+      target_speed_(0),
+      speed_pid_gains_{},
+      num_messages_received_(0)
+{
+}
+
+void FakeStSpinMotorDriver::transfer(const std::span<const uint8_t> tx,
+                                     const std::span<uint8_t> rx)
+{
+    std::scoped_lock lock(mutex_);
+
+    std::fill(rx.begin(), rx.end(), 0);
+    std::copy_n(next_reply_.begin(), std::min(rx.size(), next_reply_.size()),
+                rx.begin());
+
+    // Nothing to reply with unless this transfer held a valid message
+    next_reply_.fill(0);
+
+    if (tx.size() != STSPIN_MESSAGE_SIZE ||
+        !std::equal(STSPIN_MESSAGE_DELIMITER.begin(), STSPIN_MESSAGE_DELIMITER.end(),
+                    tx.begin()) ||
+        Crc8Autosar::calc(tx.data(), STSPIN_MESSAGE_SIZE - 1) !=
+            tx[STSPIN_MESSAGE_SIZE - 1])
+    {
+        return;
+    }
+
+    std::array<uint8_t, STSPIN_MESSAGE_SIZE> message{};
+    std::copy(tx.begin(), tx.end(), message.begin());
+    handleMessage(message);
+}
+
+void FakeStSpinMotorDriver::handleMessage(
+    const std::array<uint8_t, STSPIN_MESSAGE_SIZE>& message)
+{
+    num_messages_received_++;
+
+    switch (static_cast<StSpinOpcode>(message[OPCODE_INDEX]))
+    {
+        case StSpinOpcode::SET_TARGET_SPEED:
+            enabled_      = message[OPCODE_INDEX + 1] != 0;
+            target_speed_ = readInt16(message, OPCODE_INDEX + 2);
+            break;
+        case StSpinOpcode::SET_RESPONSE_TYPE:
+            response_type_ = static_cast<StSpinResponseType>(message[OPCODE_INDEX + 1]);
+            break;
+        case StSpinOpcode::SET_PID_SPEED_KP_KI:
+            speed_pid_gains_ = SetPidSpeedKpKiMessage{
+                .kp = readInt16(message, OPCODE_INDEX + 1),
+                .ki = readInt16(message, OPCODE_INDEX + 3),
+            };
+            break;
+        default:
+            break;
+    }
+
+    const int16_t speed = enabled_ ? target_speed_ : 0;
+
+    std::copy(STSPIN_MESSAGE_DELIMITER.begin(), STSPIN_MESSAGE_DELIMITER.end(),
+              next_reply_.begin());
+    next_reply_[SEQ_INDEX]    = message[SEQ_INDEX];
+    next_reply_[OPCODE_INDEX] = static_cast<uint8_t>(response_type_);
+
+    switch (response_type_)
+    {
+        case StSpinResponseType::SPEED_AND_FAULTS:
+            writeInt16(next_reply_, OPCODE_INDEX + 1, speed);
+            writeInt16(next_reply_, OPCODE_INDEX + 3, static_cast<int16_t>(fault_flags_));
+            break;
+        case StSpinResponseType::SPEED_AND_SPEED_REF:
+            writeInt16(next_reply_, OPCODE_INDEX + 1, speed);
+            writeInt16(next_reply_, OPCODE_INDEX + 3, target_speed_);
+            break;
+        default:
+            // The ideal motor draws no current
+            break;
+    }
+
+    next_reply_[STSPIN_MESSAGE_SIZE - 1] =
+        Crc8Autosar::calc(next_reply_.data(), STSPIN_MESSAGE_SIZE - 1);
+}
+
+void FakeStSpinMotorDriver::setFaultFlags(const uint16_t fault_flags)
+{
+    std::scoped_lock lock(mutex_);
+    fault_flags_ = fault_flags;
+}
+
+bool FakeStSpinMotorDriver::isEnabled() const
+{
+    std::scoped_lock lock(mutex_);
+    return enabled_;
+}
+
+int16_t FakeStSpinMotorDriver::getTargetSpeed() const
+{
+    std::scoped_lock lock(mutex_);
+    return target_speed_;
+}
+
+SetPidSpeedKpKiMessage FakeStSpinMotorDriver::getSpeedPidGains() const
+{
+    std::scoped_lock lock(mutex_);
+    return speed_pid_gains_;
+}
+
+std::size_t FakeStSpinMotorDriver::getNumMessagesReceived() const
+{
+    std::scoped_lock lock(mutex_);
+    return num_messages_received_;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "software/embedded/motor_controller/stspin_types.h"
+#include "software/embedded/spi/fake_spi_bus.h"
+
+/**
+ * An in-memory fake of an MDv6 motor driver board, which speaks the same SPI frame
+ * protocol as the real board so that StSpinMotorController can be tested off the
+ * robot.
+ *
+ * The fake drives an ideal motor: its speed is its target speed while it's enabled,
+ * and 0 otherwise. Like the real board, the reply to a message is sent in the transfer
+ * after it, since the board is still receiving the message during its own transfer.
+ */
+class FakeStSpinMotorDriver : public FakeSpiDevice
+{
+   public:
+    FakeStSpinMotorDriver();
+
+    void transfer(std::span<const uint8_t> tx, std::span<uint8_t> rx) override;
+
+    /**
+     * Sets the faults that the board reports
+     *
+     * @param fault_flags The StSpinFaultCodes of the faults, or'd together
+     */
+    void setFaultFlags(uint16_t fault_flags);
+
+    /**
+     * Gets whether the motor was enabled by the last SetTargetSpeed message
+     *
+     * @return whether the motor is enabled
+     */
+    bool isEnabled() const;
+
+    /**
+     * Gets the target speed set by the last SetTargetSpeed message
+     *
+     * @return the target speed in RPM
+     */
+    int16_t getTargetSpeed() const;
+
+    /**
+     * Gets the speed PID gains set by the last SetPidSpeedKpKi message
+     *
+     * @return the proportional and integral gains
+     */
+    SetPidSpeedKpKiMessage getSpeedPidGains() const;
+
+    /**
+     * Gets the number of valid messages the board has received
+     *
+     * @return the number of messages received
+     */
+    std::size_t getNumMessagesReceived() const;
+
+   private:
+    /**
+     * Handles a valid message received by the board, and builds the reply to it
+     *
+     * @param message The message
+     */
+    void handleMessage(const std::array<uint8_t, STSPIN_MESSAGE_SIZE>& message);
+
+    mutable std::mutex mutex_;
+
+    std::array<uint8_t, STSPIN_MESSAGE_SIZE> next_reply_;
+    StSpinResponseType response_type_;
+    uint16_t fault_flags_;
+    bool enabled_;
+    int16_t target_speed_;
+    SetPidSpeedKpKiMessage speed_pid_gains_;
+    std::size_t num_messages_received_;
+};
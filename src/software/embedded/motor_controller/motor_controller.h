@@ -36,12 +36,22 @@ class MotorController
     /**
      * Reads the current velocity and writes a new target velocity for a motor.
      *
+     * Controllers that talk to the motors asynchronously only send the target once
+     * submitCycle is called, and return the velocity measured in an earlier cycle.
+     *
      * @param motor the motor to command
      * @param target_velocity the desired target velocity for the motor in mechanical RPM
      * @return the current measured velocity of the motor in mechanical RPM
      */
     virtual int readThenWriteVelocity(MotorIndex motor, int target_velocity) = 0;
 
+    /**
+     * Submits the target velocities written since the last cycle to the motors, for
+     * controllers that talk to the motors asynchronously. Does nothing for
+     * controllers that send each target as soon as it is written.
+     */
+    virtual void submitCycle() {}
+
     /**
      * Immediately disables all motors.
      */
@@ -1,7 +1,5 @@
 #include "software/embedded/motor_controller/stspin_motor_controller.h"
 
-#include <linux/spi/spidev.h>
-
 #include <algorithm>
 #include <chrono>
 #include <iomanip>
@@ -15,37 +13,94 @@
 #include "proto/message_translation/tbots_protobuf.h"
 #include "software/embedded/gpio/gpio_char_dev.h"
 #include "software/embedded/motor_controller/stspin_types.h"
-#include "software/embedded/spi_utils.h"
+#include "software/embedded/spi/spidev_bus.h"
 #include "software/logger/logger.h"
 
 // AUTOSAR variant of CRC-8
 // (https://reveng.sourceforge.io/crc-catalogue/all.htm#crc.cat.crc-8-autosar)
 using Crc8Autosar = crc_utils::crc<uint8_t, 0x2F, 0xFF, false, false, 0xFF>;
 
+/**
+ * Gets the path of the spidev device of each drive motor's board
+ *
+ * @param spi_paths the path of each drive motor's spidev device
+ *
+ * @return the paths, indexed by MotorIndex
+ */
+static std::vector<std::string> getSpiDevicePaths(
+    const std::unordered_map<MotorIndex, const char*>& spi_paths)
+{
+    std::vector<std::string> device_paths;
+    for (const MotorIndex motor : driveMotors())
+    {
+        device_paths.emplace_back(spi_paths.at(motor));
+    }
+    return device_paths;
+}
+
 StSpinMotorController::StSpinMotorController(
     const robot_constants::RobotConstants& robot_constants)
+    : StSpinMotorController(
+          robot_constants,
+          std::make_unique<SpidevBus>(getSpiDevicePaths(SPI_PATHS), SPI_MODE, SPI_BITS,
+                                      MAX_SPI_SPEED_HZ, SPI_SPEED_HZ),
+          std::make_unique<GpioCharDev>(RESET_GPIO_PIN, GpioDirection::OUTPUT,
+                                        GpioState::HIGH))
+{
+}
+
+StSpinMotorController::StSpinMotorController(
+    const robot_constants::RobotConstants& robot_constants,
+    std::unique_ptr<SpiBus> spi_bus, std::unique_ptr<Gpio> reset_gpio)
     : robot_constants_(robot_constants),
-      reset_gpio_(std::make_unique<GpioCharDev>(RESET_GPIO_PIN, GpioDirection::OUTPUT,
-                                                GpioState::HIGH))
+      spi_bus_(std::move(spi_bus)),
+      reset_gpio_(std::move(reset_gpio)),
+      num_cycles_without_ack_{},
+      cycle_tx_{},
+      cycle_rx_{},
+      cycle_transfers_{},
+      next_commands_{},
+      submitted_commands_{},
+      has_new_motor_status_(false),
+      stop_io_thread_(false),
+      num_submitted_cycles_(0),
+      num_completed_cycles_(0)
 {
-    for (const MotorIndex motor : driveMotors())
+    for (std::vector<uint8_t>& received_data : received_data_)
     {
-        openSpiFileDescriptor(motor);
+        received_data.reserve(2 * MESSAGE_SIZE);
     }
 }
 
+StSpinMotorController::~StSpinMotorController()
+{
+    stopIoThread();
+}
+
 void StSpinMotorController::setup()
 {
+    stopIoThread();
+
     reset();
 
-    for (const MotorIndex motor : reflective_enum::values<MotorIndex>())
     {
-        motor_status_[motor]         = MotorStatus();
-        motor_status_[motor].enabled = true;
+        std::scoped_lock lock(spi_mutex_);
+        for (const MotorIndex motor : reflective_enum::values<MotorIndex>())
+        {
+            motor_status_[motor] = MotorStatus();
+        }
+        for (std::vector<uint8_t>& received_data : received_data_)
+        {
+            received_data.clear();
+        }
+        num_cycles_without_ack_.fill(0);
     }
 
     for (const MotorIndex motor : driveMotors())
     {
+        next_commands_.at(static_cast<std::size_t>(motor)) =
+            MotorCommand{.enabled = true, .target_speed_rpm = 0};
+
         sendAndReceiveMessage(motor,
                               SetPidSpeedKpKiMessage{.kp = SPEED_PID_PROPORTIONAL_GAIN,
                                                      .ki = SPEED_PID_INTEGRAL_GAIN});
@@ -53,6 +108,13 @@ void StSpinMotorController::setup()
                               SetPidTorqueKpKiMessage{.kp = TORQUE_PID_PROPORTIONAL_GAIN,
                                                       .ki = TORQUE_PID_INTEGRAL_GAIN});
     }
+
+    {
+        std::scoped_lock lock(spi_mutex_);
+        control_motor_status_ = motor_status_;
+    }
+
+    startIoThread();
 }
 
 void StSpinMotorController::reset()
@@ -65,7 +127,7 @@ void StSpinMotorController::reset()
 
 const MotorFaultIndicator& StSpinMotorController::checkFaults(const MotorIndex motor)
 {
-    return motor_status_.at(motor).faults;
+    return control_motor_status_.at(motor).faults;
 }
 
 void StSpinMotorController::updateFaults(const MotorIndex motor,
@@ -181,47 +243,172 @@ int StSpinMotorController::readThenWriteVelocity(const MotorIndex motor,
         return 0;
     }
 
-    const auto outgoing_message = SetTargetSpeedMessage{
-        .motor_enabled          = motor_status_.at(motor).enabled,
-        .motor_target_speed_rpm = static_cast<int16_t>(target_velocity),
-    };
+    next_commands_.at(static_cast<std::size_t>(motor)).target_speed_rpm =
+        static_cast<int16_t>(target_velocity);
 
-    sendAndReceiveMessage(motor, outgoing_message);
+    return control_motor_status_.at(motor).speed;
+}
 
-    return motor_status_.at(motor).speed;
+void StSpinMotorController::submitCycle()
+{
+    {
+        std::scoped_lock lock(io_mutex_);
+        submitted_commands_ = next_commands_;
+        num_submitted_cycles_++;
+
+        if (has_new_motor_status_)
+        {
+            std::swap(control_motor_status_, published_motor_status_);
+            has_new_motor_status_ = false;
+        }
+    }
+    cycle_requested_cv_.notify_one();
 }
 
 void StSpinMotorController::immediatelyDisable()
 {
-    for (const MotorIndex motor : reflective_enum::values<MotorIndex>())
+    for (MotorCommand& command : next_commands_)
+    {
+        command = MotorCommand{.enabled = false, .target_speed_rpm = 0};
+    }
+
+    if (!io_thread_.joinable())
+    {
+        for (const MotorIndex motor : driveMotors())
+        {
+            sendAndReceiveMessage(
+                motor, SetTargetSpeedMessage{.motor_enabled          = false,
+                                             .motor_target_speed_rpm = 0});
+        }
+        return;
+    }
+
+    submitCycle();
+
+    std::unique_lock lock(io_mutex_);
+    const uint64_t disable_cycle = num_submitted_cycles_;
+    if (!cycle_completed_cv_.wait_for(lock, IMMEDIATELY_DISABLE_TIMEOUT,
+                                      [&]
+                                      { return num_completed_cycles_ >= disable_cycle; }))
+    {
+        LOG(WARNING) << "Timed out waiting for the motors to be disabled";
+    }
+}
+
+void StSpinMotorController::startIoThread()
+{
+    {
+        std::scoped_lock lock(io_mutex_);
+        stop_io_thread_       = false;
+        has_new_motor_status_ = false;
+        num_completed_cycles_ = num_submitted_cycles_;
+    }
+    io_thread_ = std::thread(&StSpinMotorController::runIoThread, this);
+}
+
+void StSpinMotorController::stopIoThread()
+{
+    if (!io_thread_.joinable())
+    {
+        return;
+    }
+
     {
-        motor_status_[motor].enabled = false;
-        readThenWriteVelocity(motor, 0);
+        std::scoped_lock lock(io_mutex_);
+        stop_io_thread_ = true;
     }
+    cycle_requested_cv_.notify_one();
+    io_thread_.join();
 }
 
-void StSpinMotorController::openSpiFileDescriptor(const MotorIndex motor)
+void StSpinMotorController::runIoThread()
 {
-    spi_fds_[motor] = open(SPI_PATHS.at(motor), O_RDWR);
-    CHECK(spi_fds_[motor] >= 0)
-        << "can't open device: " << motor << "error: " << strerror(errno);
+    while (true)
+    {
+        std::array<MotorCommand, NUM_DRIVE_MOTORS> commands{};
+        uint64_t cycle = 0;
+        {
+            std::unique_lock lock(io_mutex_);
+            cycle_requested_cv_.wait(lock,
+                                     [this]
+                                     {
+                                         return stop_io_thread_ ||
+                                                num_completed_cycles_ <
+                                                    num_submitted_cycles_;
+                                     });
+            if (stop_io_thread_)
+            {
+                return;
+            }
 
-    int ret = ioctl(spi_fds_[motor], SPI_IOC_WR_MODE32, &SPI_MODE);
-    CHECK(ret != -1) << "can't set spi mode for: " << motor
-                     << "error: " << strerror(errno);
+            // Cycles submitted while the last one was running are merged into one
+            // with the latest commands
+            commands = submitted_commands_;
+            cycle    = num_submitted_cycles_;
+        }
 
-    ret = ioctl(spi_fds_[motor], SPI_IOC_WR_BITS_PER_WORD, &SPI_BITS);
-    CHECK(ret != -1) << "can't set bits_per_word for: " << motor
-                     << "error: " << strerror(errno);
+        std::scoped_lock spi_lock(spi_mutex_);
+        runIoCycle(commands);
 
-    ret = ioctl(spi_fds_[motor], SPI_IOC_WR_MAX_SPEED_HZ, &MAX_SPI_SPEED_HZ);
-    CHECK(ret != -1) << "can't set spi max speed hz for: " << motor
-                     << "error: " << strerror(errno);
+        {
+            std::scoped_lock lock(io_mutex_);
+            published_motor_status_ = motor_status_;
+            has_new_motor_status_   = true;
+            num_completed_cycles_   = cycle;
+        }
+        cycle_completed_cv_.notify_all();
+    }
+}
+
+void StSpinMotorController::runIoCycle(
+    const std::array<MotorCommand, NUM_DRIVE_MOTORS>& commands)
+{
+    for (const MotorIndex motor : driveMotors())
+    {
+        const std::size_t index = static_cast<std::size_t>(motor);
+
+        motor_status_.at(motor).seq_num++;
+        populateTx(motor,
+                   SetTargetSpeedMessage{
+                       .motor_enabled          = commands[index].enabled,
+                       .motor_target_speed_rpm = commands[index].target_speed_rpm,
+                   },
+                   cycle_tx_[index]);
+
+        cycle_transfers_[index] = SpiTransfer{
+            .device = static_cast<unsigned int>(index),
+            .tx     = cycle_tx_[index].data(),
+            .rx     = cycle_rx_[index].data(),
+            .len    = MESSAGE_SIZE,
+        };
+    }
+
+    spi_bus_->transfer(cycle_transfers_);
+
+    for (const MotorIndex motor : driveMotors())
+    {
+        const std::size_t index              = static_cast<std::size_t>(motor);
+        std::vector<uint8_t>& received_data = received_data_[index];
+        received_data.insert(received_data.end(), cycle_rx_[index].begin(),
+                             cycle_rx_[index].end());
+
+        if (processReceivedData(motor, received_data))
+        {
+            num_cycles_without_ack_[index] = 0;
+        }
+        else if (++num_cycles_without_ack_[index] == MAX_SPI_TRANSFER_ATTEMPTS)
+        {
+            LOG(WARNING) << "Motor " << motor << " has not acknowledged a message in "
+                         << MAX_SPI_TRANSFER_ATTEMPTS << " cycles";
+        }
+    }
 }
 
 void StSpinMotorController::sendAndReceiveMessage(const MotorIndex motor,
                                                   const OutgoingMessage& outgoing_message)
 {
+    std::scoped_lock lock(spi_mutex_);
+
     std::array<uint8_t, MESSAGE_SIZE> tx{};
     std::array<uint8_t, MESSAGE_SIZE> rx{};
 
@@ -229,12 +416,35 @@ void StSpinMotorController::sendAndReceiveMessage(const MotorIndex motor,
 
     populateTx(motor, outgoing_message, tx);
 
+    const SpiTransfer transfer{
+        .device = static_cast<unsigned int>(motor),
+        .tx     = tx.data(),
+        .rx     = rx.data(),
+        .len    = MESSAGE_SIZE,
+    };
+
     std::vector<uint8_t> received_data;
     for (unsigned int attempt = 0; attempt < MAX_SPI_TRANSFER_ATTEMPTS; ++attempt)
     {
-        spiTransfer(spi_fds_[motor], tx.data(), rx.data(), MESSAGE_SIZE, SPI_SPEED_HZ);
+        spi_bus_->transfer(std::span(&transfer, 1));
         received_data.insert(received_data.end(), rx.begin(), rx.end());
 
+        if (processReceivedData(motor, received_data))
+        {
+            return;
+        }
+    }
+
+    LOG(WARNING) << "Motor " << motor << " did not acknowledge message (seq_num "
+                 << static_cast<int>(motor_status_.at(motor).seq_num) << ") after "
+                 << MAX_SPI_TRANSFER_ATTEMPTS << " SPI attempts; giving up";
+}
+
+bool StSpinMotorController::processReceivedData(const MotorIndex motor,
+                                                std::vector<uint8_t>& received_data)
+{
+    while (true)
+    {
         auto delimiter_pos =
             std::search(received_data.begin(), received_data.end(),
                         MESSAGE_DELIMITER.begin(), MESSAGE_DELIMITER.end());
@@ -243,14 +453,15 @@ void StSpinMotorController::sendAndReceiveMessage(const MotorIndex motor,
         {
             // No delimiter sequence found, discard everything
             received_data.clear();
-            continue;
+            return false;
         }
 
         if (std::distance(delimiter_pos, received_data.end()) < MESSAGE_SIZE)
         {
             // Not enough bytes after delimiter sequence for a full message,
             // wait for more bytes
-            continue;
+            received_data.erase(received_data.begin(), delimiter_pos);
+            return false;
         }
 
         // Message integrity check
@@ -277,7 +488,8 @@ void StSpinMotorController::sendAndReceiveMessage(const MotorIndex motor,
                           message.begin());
                 processRx(motor, message);
 
-                return;
+                received_data.clear();
+                return true;
             }
         }
 
@@ -285,10 +497,6 @@ void StSpinMotorController::sendAndReceiveMessage(const MotorIndex motor,
         // potential message
         received_data.erase(received_data.begin(), std::next(delimiter_pos));
     }
-
-    LOG(WARNING) << "Motor " << motor << " did not acknowledge message (seq_num "
-                 << static_cast<int>(motor_status_.at(motor).seq_num) << ") after "
-                 << MAX_SPI_TRANSFER_ATTEMPTS << " SPI attempts; giving up";
 }
 
 void StSpinMotorController::populateTx(const MotorIndex motor,
@@ -471,6 +679,7 @@ void StSpinMotorController::sendMotorStatusToPlotJuggler(const MotorIndex motor)
         sendAndReceiveMessage(motor, SetResponseTypeMessage{response_type});
     }
 
+    std::scoped_lock lock(spi_mutex_);
     const MotorStatus& motor_status = motor_status_.at(motor);
 
     LOG(PLOTJUGGLER) << *createPlotJugglerValue({
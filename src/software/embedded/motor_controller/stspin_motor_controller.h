@@ -2,12 +2,19 @@
 
 #include <array>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <variant>
+#include <vector>
 
 #include "software/embedded/gpio/gpio.h"
 #include "software/embedded/motor_controller/motor_controller.h"
 #include "software/embedded/motor_controller/motor_fault_indicator.h"
 #include "software/embedded/motor_controller/motor_index.h"
 #include "software/embedded/motor_controller/stspin_types.h"
+#include "software/embedded/spi/spi_bus.h"
 
 /**
  * Motor controller for controlling our 6th generation STSPIN motor drivers.
@@ -15,13 +22,39 @@
  * We communicate with our MDv6 boards over SPI in full-duplex mode using a custom
  * frame-based protocol. This protocol is documented in the MDv6 firmware repo, which
  * can be found at https://github.com/UBC-Thunderbots/MDv6_Firmware
+ *
+ * Once set up, velocities are sent asynchronously: readThenWriteVelocity only records
+ * the target, and submitCycle hands the targets of all the drive motors to a dedicated
+ * I/O thread, which sends them to every board in one batched SPI submission. The
+ * speeds and faults read back are handed to the control loop when it submits its next
+ * cycle, so the control loop never waits on SPI.
  */
 class StSpinMotorController : public MotorController
 {
    public:
+    /**
+     * Creates a motor controller that talks to the motor boards over the robot's SPI
+     * bus
+     *
+     * @param robot_constants The robot constants
+     */
     explicit StSpinMotorController(
         const robot_constants::RobotConstants& robot_constants);
 
+    /**
+     * Creates a motor controller that talks to the motor boards over the given SPI bus
+     *
+     * @param robot_constants The robot constants
+     * @param spi_bus The SPI bus, where the device number of each drive motor's board
+     * is the value of its MotorIndex
+     * @param reset_gpio The GPIO that resets the motor boards
+     */
+    StSpinMotorController(const robot_constants::RobotConstants& robot_constants,
+                          std::unique_ptr<SpiBus> spi_bus,
+                          std::unique_ptr<Gpio> reset_gpio);
+
+    ~StSpinMotorController() override;
+
     void setup() override;
 
     void reset() override;
@@ -30,6 +63,8 @@ class StSpinMotorController : public MotorController
 
     int readThenWriteVelocity(MotorIndex motor, int target_velocity) override;
 
+    void submitCycle() override;
+
     void immediatelyDisable() override;
 
    private:
@@ -40,17 +75,22 @@ class StSpinMotorController : public MotorController
                      SetPidFluxKpKiMessage, SetPidSpeedKpKiMessage,
                      SetSpeedFeedForwardKaKvMessage, SetSpeedFeedForwardKsMessage>;
 
-    // Length of message (in number of bytes)
-    static constexpr unsigned int MESSAGE_SIZE = 10;
+    static constexpr unsigned int MESSAGE_SIZE = STSPIN_MESSAGE_SIZE;
 
-    // Delimiter sequence used to indicate start of a message
-    static constexpr std::array<uint8_t, 3> MESSAGE_DELIMITER = {0xAA, 0xBB, 0xCC};
+    static constexpr std::array<uint8_t, 3> MESSAGE_DELIMITER = STSPIN_MESSAGE_DELIMITER;
+
+    static constexpr std::size_t NUM_DRIVE_MOTORS = 4;
 
     // Maximum number of SPI transfer attempts to wait for an acknowledgement
     // before giving up. Prevents unresponsive MD (e.g. firmware crash or
-    // SPI desynced) from blocking Thunderloop indefinitely
+    // SPI desynced) from blocking Thunderloop indefinitely. Also the number of
+    // I/O cycles in a row without an acknowledgement before warning about a motor
     static constexpr unsigned int MAX_SPI_TRANSFER_ATTEMPTS = 100;
 
+    // How long immediatelyDisable waits for the disable to be sent to the motors
+    static constexpr std::chrono::milliseconds IMMEDIATELY_DISABLE_TIMEOUT =
+        std::chrono::milliseconds(100);
+
     // clang-format off
     static const inline std::unordered_map<MotorIndex, const char*> SPI_PATHS = {
         {MotorIndex::FRONT_LEFT,  "/dev/spidev0.3"},
@@ -74,15 +114,13 @@ class StSpinMotorController : public MotorController
 
     robot_constants::RobotConstants robot_constants_;
 
-    // SPI file descriptors
-    std::unordered_map<MotorIndex, int> spi_fds_;
+    std::unique_ptr<SpiBus> spi_bus_;
 
     std::unique_ptr<Gpio> reset_gpio_;
 
     struct MotorStatus
     {
         uint8_t seq_num;
-        bool enabled;
         MotorFaultIndicator faults;
         uint16_t fault_flags;
         int16_t speed;
@@ -98,23 +136,96 @@ class StSpinMotorController : public MotorController
         std::chrono::steady_clock::time_point last_message_ack_time;
     };
 
+    struct MotorCommand
+    {
+        bool enabled;
+        int16_t target_speed_rpm;
+    };
+
+    // The status of each motor as last received over SPI. Guarded by spi_mutex_, along
+    // with the SPI bus, since messages are sent both by the I/O thread and by setup
     std::unordered_map<MotorIndex, MotorStatus> motor_status_;
+    std::mutex spi_mutex_;
+
+    // Bytes received from each drive motor by the I/O thread that haven't been
+    // processed yet, since a reply can straddle two cycles. Guarded by spi_mutex_
+    std::array<std::vector<uint8_t>, NUM_DRIVE_MOTORS> received_data_;
+
+    // The number of I/O cycles in a row that each drive motor hasn't acknowledged a
+    // message. Guarded by spi_mutex_
+    std::array<unsigned int, NUM_DRIVE_MOTORS> num_cycles_without_ack_;
+
+    // Buffers of the messages of an I/O cycle, kept so that cycles don't allocate.
+    // Guarded by spi_mutex_
+    std::array<std::array<uint8_t, MESSAGE_SIZE>, NUM_DRIVE_MOTORS> cycle_tx_;
+    std::array<std::array<uint8_t, MESSAGE_SIZE>, NUM_DRIVE_MOTORS> cycle_rx_;
+    std::array<SpiTransfer, NUM_DRIVE_MOTORS> cycle_transfers_;
+
+    // The commands and motor status used by the control loop, which are only touched
+    // by the thread that calls into the MotorController interface
+    std::array<MotorCommand, NUM_DRIVE_MOTORS> next_commands_;
+    std::unordered_map<MotorIndex, MotorStatus> control_motor_status_;
+
+    // Hands commands from the control loop to the I/O thread, and the status read
+    // back to the control loop. Everything below is guarded by io_mutex_
+    std::mutex io_mutex_;
+    std::condition_variable cycle_requested_cv_;
+    std::condition_variable cycle_completed_cv_;
+    std::array<MotorCommand, NUM_DRIVE_MOTORS> submitted_commands_;
+    std::unordered_map<MotorIndex, MotorStatus> published_motor_status_;
+    bool has_new_motor_status_;
+    bool stop_io_thread_;
+    uint64_t num_submitted_cycles_;
+    uint64_t num_completed_cycles_;
+
+    std::thread io_thread_;
+
+    /**
+     * Starts the I/O thread, which sends the submitted commands to the motors
+     */
+    void startIoThread();
+
+    /**
+     * Stops the I/O thread, if it is running, and waits for it to finish its cycle
+     */
+    void stopIoThread();
 
     /**
-     * Opens a SPI file descriptor for the given motor.
+     * Runs I/O cycles whenever one is submitted, until the I/O thread is stopped
+     */
+    void runIoThread();
+
+    /**
+     * Sends the commands to the drive motors in one submission to the SPI bus, and
+     * processes the replies received. Must be called with spi_mutex_ held.
      *
-     * @param motor the motor to open a SPI file descriptor for
+     * @param commands the command of each drive motor, indexed by MotorIndex
      */
-    void openSpiFileDescriptor(MotorIndex motor);
+    void runIoCycle(const std::array<MotorCommand, NUM_DRIVE_MOTORS>& commands);
 
     /**
-     * Transmits a message to the given motor and receives a message back over SPI.
+     * Transmits a message to the given motor and receives a message back over SPI,
+     * retrying until the motor acknowledges it.
      *
      * @param motor the motor to send the message to
      * @param outgoing_message the outgoing message to send to the motor
      */
     void sendAndReceiveMessage(MotorIndex motor, const OutgoingMessage& outgoing_message);
 
+    /**
+     * Looks through the bytes received from the given motor for a reply to the
+     * current or previous message sent to it, and processes the first one found.
+     * Must be called with spi_mutex_ held.
+     *
+     * @param motor the motor that the bytes were received from
+     * @param received_data the bytes received from the motor that haven't been
+     * processed yet. Bytes that can't be the start of a reply are removed from it,
+     * and it is cleared once a reply is found
+     *
+     * @return whether a reply was found
+     */
+    bool processReceivedData(MotorIndex motor, std::vector<uint8_t>& received_data);
+
     /**
      * Populates the transmit buffer with the data from an outgoing message.
      *
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "shared/robot_constants.h"
+#include "software/embedded/motor_controller/fake_stspin_motor_driver.h"
+#include "software/embedded/motor_controller/stspin_motor_controller.h"
+#include "software/embedded/spi/fake_spi_bus.h"
+
+class FakeGpio : public Gpio
+{
+   public:
+    void setValue(GpioState state) override
+    {
+        state_ = state;
+    }
+
+    GpioState getValue() override
+    {
+        return state_;
+    }
+
+   private:
+    GpioState state_ = GpioState::HIGH;
+};
+
+class StSpinMotorControllerAsyncTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates and sets up a motor controller on a bus of fake motor drivers
+     *
+     * @param submission_latency How long each submission to the bus takes
+     */
+    void createMotorController(std::chrono::nanoseconds submission_latency)
+    {
+        std::vector<std::shared_ptr<FakeSpiDevice>> devices;
+        for (std::shared_ptr<FakeStSpinMotorDriver>& driver : drivers_)
+        {
+            driver = std::make_shared<FakeStSpinMotorDriver>();
+            devices.push_back(driver);
+        }
+
+        auto spi_bus = std::make_unique<FakeSpiBus>(devices, submission_latency,
+                                                    SPI_SPEED_HZ);
+        spi_bus_     = spi_bus.get();
+
+        motor_controller_ = std::make_unique<StSpinMotorController>(
+            robot_constants::createRobotConstants(), std::move(spi_bus),
+            std::make_unique<FakeGpio>());
+        motor_controller_->setup();
+    }
+
+    /**
+     * Checks whether a condition holds for every drive motor
+     *
+     * @param condition The condition
+     *
+     * @return whether the condition holds for every drive motor
+     */
+    static bool allDriveMotors(const std::function<bool(MotorIndex)>& condition)
+    {
+        const auto drive_motors = driveMotors();
+        return std::all_of(drive_motors.begin(), drive_motors.end(), condition);
+    }
+
+    /**
+     * Runs control cycles that write the target velocities, until the condition
+     * holds or too many cycles have run
+     *
+     * @param condition The condition to wait for
+     *
+     * @return whether the condition held
+     */
+    bool runCyclesUntil(const std::function<bool()>& condition)
+    {
+        for (int cycle = 0; cycle < 500; cycle++)
+        {
+            for (const MotorIndex motor : driveMotors())
+            {
+                measured_velocities_[motor] = motor_controller_->readThenWriteVelocity(
+                    motor, target_velocities_.at(motor));
+            }
+            motor_controller_->submitCycle();
+
+            if (condition())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    FakeStSpinMotorDriver& driver(MotorIndex motor)
+    {
+        return *drivers_.at(static_cast<std::size_t>(motor));
+    }
+
+    static constexpr uint32_t SPI_SPEED_HZ = 500000;
+
+    std::array<std::shared_ptr<FakeStSpinMotorDriver>, 4> drivers_;
+    FakeSpiBus* spi_bus_;
+    std::unique_ptr<StSpinMotorController> motor_controller_;
+
+    std::unordered_map<MotorIndex, int> target_velocities_ = {
+        {MotorIndex::FRONT_LEFT, 100},
+        {MotorIndex::FRONT_RIGHT, -200},
+        {MotorIndex::BACK_LEFT, 300},
+        {MotorIndex::BACK_RIGHT, -400},
+    };
+    std::unordered_map<MotorIndex, int> measured_velocities_;
+};
+
+TEST_F(StSpinMotorControllerAsyncTest, setup_sends_pid_gains_to_every_motor)
+{
+    createMotorController(std::chrono::nanoseconds(0));
+
+    for (const MotorIndex motor : driveMotors())
+    {
+        EXPECT_EQ(439, driver(motor).getSpeedPidGains().kp) << motor;
+        EXPECT_EQ(535, driver(motor).getSpeedPidGains().ki) << motor;
+    }
+}
+
+TEST_F(StSpinMotorControllerAsyncTest, velocities_are_sent_and_read_back)
+{
+    createMotorController(std::chrono::nanoseconds(0));
+
+    EXPECT_TRUE(runCyclesUntil(
+        [&]()
+        {
+            return allDriveMotors(
+                [&](MotorIndex motor)
+                {
+                    return measured_velocities_.at(motor) ==
+                           target_velocities_.at(motor);
+                });
+        }));
+
+    for (const MotorIndex motor : driveMotors())
+    {
+        EXPECT_TRUE(driver(motor).isEnabled()) << motor;
+        EXPECT_EQ(target_velocities_.at(motor), driver(motor).getTargetSpeed()) << motor;
+    }
+}
+
+TEST_F(StSpinMotorControllerAsyncTest, control_loop_doesnt_wait_on_slow_spi)
+{
+    createMotorController(std::chrono::milliseconds(50));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int cycle = 0; cycle < 10; cycle++)
+    {
+        for (const MotorIndex motor : driveMotors())
+        {
+            motor_controller_->readThenWriteVelocity(motor, target_velocities_.at(motor));
+        }
+        motor_controller_->submitCycle();
+    }
+
+    // A single SPI submission takes longer than all ten control cycles combined
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(25));
+}
+
+TEST_F(StSpinMotorControllerAsyncTest, each_cycle_is_one_submission_to_the_bus)
+{
+    createMotorController(std::chrono::nanoseconds(0));
+
+    const std::size_t num_submissions = spi_bus_->getNumSubmissions();
+    const std::size_t num_transfers   = spi_bus_->getNumTransfers();
+
+    for (const MotorIndex motor : driveMotors())
+    {
+        motor_controller_->readThenWriteVelocity(motor, target_velocities_.at(motor));
+    }
+    motor_controller_->submitCycle();
+
+    // Give the cycle time to run, and to make any extra submissions it shouldn't
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(num_submissions + 1, spi_bus_->getNumSubmissions());
+    EXPECT_EQ(num_transfers + driveMotors().size(), spi_bus_->getNumTransfers());
+}
+
+TEST_F(StSpinMotorControllerAsyncTest, immediately_disable_disables_every_motor)
+{
+    createMotorController(std::chrono::milliseconds(1));
+
+    EXPECT_TRUE(runCyclesUntil(
+        [&]()
+        {
+            return allDriveMotors([&](MotorIndex motor)
+                                  { return driver(motor).isEnabled(); });
+        }));
+
+    motor_controller_->immediatelyDisable();
+
+    for (const MotorIndex motor : driveMotors())
+    {
+        EXPECT_FALSE(driver(motor).isEnabled()) << motor;
+        EXPECT_EQ(0, driver(motor).getTargetSpeed()) << motor;
+    }
+}
+
+TEST_F(StSpinMotorControllerAsyncTest, faults_are_reported_to_control_loop)
+{
+    createMotorController(std::chrono::nanoseconds(0));
+    driver(MotorIndex::BACK_LEFT)
+        .setFaultFlags(static_cast<uint16_t>(StSpinFaultCode::OVER_TEMP));
+
+    EXPECT_TRUE(runCyclesUntil(
+        [&]()
+        {
+            return !motor_controller_->checkFaults(MotorIndex::BACK_LEFT)
+                        .drive_enabled;
+        }));
+
+    EXPECT_TRUE(motor_controller_->checkFaults(MotorIndex::BACK_LEFT)
+                    .faults.contains(TbotsProto::MotorFault::OVER_TEMP));
+    EXPECT_TRUE(motor_controller_->checkFaults(MotorIndex::FRONT_LEFT).drive_enabled);
+}
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
+// Length of every message in the MDv6 SPI protocol (in number of bytes)
+constexpr unsigned int STSPIN_MESSAGE_SIZE = 10;
+
+// Delimiter sequence used to indicate start of a message
+constexpr std::array<uint8_t, 3> STSPIN_MESSAGE_DELIMITER = {0xAA, 0xBB, 0xCC};
+
 enum class StSpinOpcode
 {
     NO_OP                        = 0x00,
@@ -12,7 +12,11 @@
 
 PrimitiveExecutor::PrimitiveExecutor(
     const robot_constants::RobotConstants& robot_constants)
-    : state_(), current_primitive_(), robot_constants_(robot_constants)
+    : state_(),
+      current_primitive_(),
+      robot_constants_(robot_constants),
+      trajectory_path_(),
+      has_trajectory_path_(false)
 {
 }
 
@@ -22,15 +26,14 @@ void PrimitiveExecutor::updatePrimitive(const TbotsProto::Primitive& primitive_m
 
     if (current_primitive_.has_move())
     {
-        const auto new_trajectory_path =
-            createTrajectoryPathFromParams(current_primitive_.move().xy_traj_params(),
-                                           state_.velocity(), robot_constants_);
+        has_trajectory_path_ = generateTrajectoryPathFromParams(
+            current_primitive_.move().xy_traj_params(), state_.velocity(),
+            robot_constants_, trajectory_path_);
 
         const auto new_angular_trajectory =
             createAngularTrajectoryFromParams(current_primitive_.move().w_traj_params(),
                                               state_.angularVelocity(), robot_constants_);
 
-        trajectory_path_ = new_trajectory_path;
         position_controller_.reset();
         time_since_linear_trajectory_creation_ =
             Duration::fromSeconds(VISION_TO_ROBOT_DELAY_S);
@@ -50,7 +53,7 @@ void PrimitiveExecutor::updateState(const RobotState& state)
 Vector PrimitiveExecutor::stepTargetLinearVelocity(const Duration& delta_time)
 {
     Vector target_v_global =
-        position_controller_.step(state_.position(), *trajectory_path_,
+        position_controller_.step(state_.position(), trajectory_path_,
                                   time_since_linear_trajectory_creation_, delta_time);
 
     // make sure robot doesn't go faster than max speed (speed is frame-invariant)
@@ -94,8 +97,9 @@ AngularVelocity PrimitiveExecutor::stepTargetAngularVelocity(const Duration& del
 }
 
 
-std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimitive(
-    TbotsProto::PrimitiveExecutorStatus& status, const Duration& delta_time)
+void PrimitiveExecutor::stepPrimitive(TbotsProto::PrimitiveExecutorStatus& status,
+                                      const Duration& delta_time,
+                                      TbotsProto::DirectControlPrimitive& direct_control)
 {
     time_since_linear_trajectory_creation_ += delta_time;
     time_since_angular_trajectory_creation_ += delta_time;
@@ -105,13 +109,12 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
     {
         case TbotsProto::Primitive::kStop:
         {
-            auto prim   = createDirectControlPrimitive(Vector(), AngularVelocity(), 0.0,
-                                                       TbotsProto::AutoChipOrKick());
-            auto output = std::make_unique<TbotsProto::DirectControlPrimitive>(
-                prim->direct_control());
+            setDirectVelocityControl(Vector(), AngularVelocity(), 0,
+                                     TbotsProto::AutoChipOrKick::default_instance(),
+                                     direct_control);
             status.set_running_primitive(false);
             setPrevCommandedVelocity(Vector(), AngularVelocity());
-            return output;
+            return;
         }
         case TbotsProto::Primitive::kDirectControl:
         {
@@ -128,21 +131,20 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
             {
                 setPrevCommandedVelocity(Vector(), AngularVelocity());
             }
-            return std::make_unique<TbotsProto::DirectControlPrimitive>(
-                current_primitive_.direct_control());
+            direct_control = current_primitive_.direct_control();
+            return;
         }
         case TbotsProto::Primitive::kMove:
         {
-            if (!trajectory_path_.has_value() || !angular_trajectory_.has_value())
+            if (!has_trajectory_path_ || !angular_trajectory_.has_value())
             {
-                auto prim = createDirectControlPrimitive(Vector(), AngularVelocity(), 0.0,
-                                                         TbotsProto::AutoChipOrKick());
-                auto output = std::make_unique<TbotsProto::DirectControlPrimitive>(
-                    prim->direct_control());
+                setDirectVelocityControl(Vector(), AngularVelocity(), 0,
+                                         TbotsProto::AutoChipOrKick::default_instance(),
+                                         direct_control);
                 LOG(INFO)
                     << "Not moving because trajectory_path_ or angular_trajectory_ is not set";
                 setPrevCommandedVelocity(Vector(), AngularVelocity());
-                return output;
+                return;
             }
 
             Vector local_velocity            = stepTargetLinearVelocity(delta_time);
@@ -151,14 +153,12 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
             // For debugging:
             // sendLinearMotionToPlotJuggler(local_velocity, delta_time);
 
-            auto output = createDirectControlPrimitive(
+            setDirectVelocityControl(
                 local_velocity, angular_velocity,
                 convertDribblerModeToDribblerSpeed(
                     current_primitive_.move().dribbler_mode(), robot_constants_),
-                current_primitive_.move().auto_chip_or_kick());
-
-            return std::make_unique<TbotsProto::DirectControlPrimitive>(
-                output->direct_control());
+                current_primitive_.move().auto_chip_or_kick(), direct_control);
+            return;
         }
         case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
         {
@@ -170,7 +170,7 @@ std::unique_ptr<TbotsProto::DirectControlPrimitive> PrimitiveExecutor::stepPrimi
         }
     }
     setPrevCommandedVelocity(Vector(), AngularVelocity());
-    return std::make_unique<TbotsProto::DirectControlPrimitive>();
+    direct_control.Clear();
 }
 
 void PrimitiveExecutor::setPrevCommandedVelocity(const Vector& local_velocity,
@@ -181,15 +181,39 @@ void PrimitiveExecutor::setPrevCommandedVelocity(const Vector& local_velocity,
     prev_target_angular_velocity_ = angular_velocity;
 }
 
+void PrimitiveExecutor::setDirectVelocityControl(
+    const Vector& local_velocity, const AngularVelocity& angular_velocity,
+    int dribbler_speed_rpm, const TbotsProto::AutoChipOrKick& auto_chip_or_kick,
+    TbotsProto::DirectControlPrimitive& direct_control)
+{
+    // Only set fields through the mutable_ accessors, which reuse sub-messages that
+    // have already been allocated, and reset every field that
+    // createDirectControlPrimitive would leave as default
+    TbotsProto::MotorControl* motor_control = direct_control.mutable_motor_control();
+    TbotsProto::MotorControl::DirectVelocityControl* direct_velocity_control =
+        motor_control->mutable_direct_velocity_control();
+    direct_velocity_control->mutable_velocity()->set_x_component_meters(
+        local_velocity.x());
+    direct_velocity_control->mutable_velocity()->set_y_component_meters(
+        local_velocity.y());
+    direct_velocity_control->mutable_angular_velocity()->set_radians_per_second(
+        angular_velocity.toRadians());
+    motor_control->set_dribbler_speed_rpm(dribbler_speed_rpm);
+
+    TbotsProto::PowerControl* power_control = direct_control.mutable_power_control();
+    *(power_control->mutable_chicker()->mutable_auto_chip_or_kick()) = auto_chip_or_kick;
+    power_control->clear_geneva_slot();
+}
+
 void PrimitiveExecutor::sendLinearMotionToPlotJuggler(const Vector& target_local_velocity,
                                                       const Duration& delta_time) const
 {
     const Vector& local_acceleration =
         (target_local_velocity - state_.localVelocity()) / delta_time.toSeconds();
-    LOG(PLOTJUGGLER) << *createPlotJugglerValue({{"x", state_.position().x()},
-                                                 {"y", state_.position().y()},
-                                                 {"v_x", target_local_velocity.x()},
-                                                 {"v_y", target_local_velocity.y()},
-                                                 {"a_x", local_acceleration.x()},
-                                                 {"a_y", local_acceleration.y()}});
+    TELEMETRY("x", state_.position().x());
+    TELEMETRY("y", state_.position().y());
+    TELEMETRY("v_x", target_local_velocity.x());
+    TELEMETRY("v_y", target_local_velocity.y());
+    TELEMETRY("a_x", local_acceleration.x());
+    TELEMETRY("a_y", local_acceleration.y());
 }
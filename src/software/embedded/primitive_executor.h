@@ -3,7 +3,7 @@
 #include "proto/robot_status_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_1d_angular.h"
-#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/ai/navigator/trajectory/bounded_trajectory_path.h"
 #include "software/embedded/motion_control/orientation_controller.h"
 #include "software/embedded/motion_control/position_controller.h"
 #include "software/geom/vector.h"
@@ -35,17 +35,21 @@ class PrimitiveExecutor
     void updateState(const RobotState& state);
 
     /**
-     * Steps the current primitive and returns a direct control primitive with the
-     * target wheel velocities
+     * Steps the current primitive and writes a direct control primitive with the
+     * target velocities into the given message.
+     *
+     * The message is owned by the caller so that it can be reused across steps. Once
+     * it has held the output of a primitive of the same kind, stepping a Move or Stop
+     * primitive writes into the existing message without allocating memory.
      *
      * @param status The status of the primitive executor, set to false if current
      * primitive is a Stop primitive
      * @param delta_time The elapsed time since the last primitive step
-     *
-     * @returns DirectControlPrimitive The direct control primitive msg
+     * @param direct_control The direct control primitive msg to write the output to
      */
-    std::unique_ptr<TbotsProto::DirectControlPrimitive> stepPrimitive(
-        TbotsProto::PrimitiveExecutorStatus& status, const Duration& delta_time);
+    void stepPrimitive(TbotsProto::PrimitiveExecutorStatus& status,
+                       const Duration& delta_time,
+                       TbotsProto::DirectControlPrimitive& direct_control);
 
    private:
     /*
@@ -85,11 +89,31 @@ class PrimitiveExecutor
     void setPrevCommandedVelocity(const Vector& local_velocity,
                                   const AngularVelocity& angular_velocity);
 
+    /**
+     * Overwrites the given direct control primitive with a direct velocity control
+     * command, reusing the message's existing sub-messages instead of allocating new
+     * ones. Equivalent to the direct control primitive created by
+     * createDirectControlPrimitive.
+     *
+     * @param local_velocity The local velocity to command
+     * @param angular_velocity The angular velocity to command
+     * @param dribbler_speed_rpm The dribbler speed to command
+     * @param auto_chip_or_kick The auto chip or kick mode to command
+     * @param direct_control The direct control primitive to overwrite
+     */
+    static void setDirectVelocityControl(
+        const Vector& local_velocity, const AngularVelocity& angular_velocity,
+        int dribbler_speed_rpm, const TbotsProto::AutoChipOrKick& auto_chip_or_kick,
+        TbotsProto::DirectControlPrimitive& direct_control);
+
     RobotState state_;
     TbotsProto::Primitive current_primitive_;
     robot_constants::RobotConstants robot_constants_;
 
-    std::optional<TrajectoryPath> trajectory_path_;
+    // The trajectories are regenerated in place whenever a new Move primitive arrives,
+    // so that updating the primitive does not allocate memory
+    BoundedTrajectoryPath trajectory_path_;
+    bool has_trajectory_path_;
     std::optional<BangBangTrajectory1DAngular> angular_trajectory_;
 
     Duration time_since_linear_trajectory_creation_;
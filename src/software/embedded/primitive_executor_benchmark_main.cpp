@@ -0,0 +1,236 @@
+#include <array>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "shared/constants.h"
+#include "shared/robot_constants.h"
+#include "software/embedded/primitive_executor.h"
+#include "software/embedded/realtime/periodic_realtime_executor.h"
+#include "software/logger/logger.h"
+#include "software/physics/velocity_conversion_util.h"
+#include "software/util/allocation_counter/allocation_counter.h"
+
+/*
+ * This standalone program runs the PrimitiveExecutor on a PeriodicRealtimeExecutor on
+ * a normal Linux machine, to benchmark how long each step takes and check that the
+ * step path does not allocate memory. The robot follows the commanded velocities
+ * exactly, and is sent a new Move primitive to a different destination at the rate
+ * the AI sends primitives.
+ */
+
+/**
+ * Creates a Move primitive from the robot's current position to the given destination
+ *
+ * @param state The current state of the robot
+ * @param destination Where the robot should move to
+ * @param final_angle The orientation the robot should end up at
+ *
+ * @return the Move primitive
+ */
+static TbotsProto::Primitive createMovePrimitive(const RobotState& state,
+                                                 const Point& destination,
+                                                 const Angle& final_angle)
+{
+    TbotsProto::Primitive primitive;
+    TbotsProto::MovePrimitive* move = primitive.mutable_move();
+
+    *(move->mutable_xy_traj_params()->mutable_start_position()) =
+        *createPointProto(state.position());
+    *(move->mutable_xy_traj_params()->mutable_destination()) =
+        *createPointProto(destination);
+    move->mutable_xy_traj_params()->set_max_speed_mode(
+        TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+    *(move->mutable_w_traj_params()->mutable_start_angle()) =
+        *createAngleProto(state.orientation());
+    *(move->mutable_w_traj_params()->mutable_final_angle()) =
+        *createAngleProto(final_angle);
+
+    return primitive;
+}
+
+/**
+ * Prints a row of the results table
+ *
+ * @param name the name of the row
+ * @param histogram the histogram to print
+ */
+static void printHistogram(const std::string& name, const LatencyHistogram& histogram)
+{
+    auto to_us = [](auto nanoseconds)
+    {
+        return static_cast<double>(nanoseconds) / NANOSECONDS_PER_MILLISECOND *
+               MICROSECONDS_PER_MILLISECOND;
+    };
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(10) << histogram.getCount()
+              << std::setw(10) << to_us(histogram.getMeanNanoseconds()) << std::setw(10)
+              << to_us(histogram.getPercentileNanoseconds(50)) << std::setw(10)
+              << to_us(histogram.getPercentileNanoseconds(99)) << std::setw(10)
+              << to_us(histogram.getPercentileNanoseconds(99.9)) << std::setw(10)
+              << to_us(histogram.getMaxNanoseconds()) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help               = false;
+        std::string runtime_dir = "/tmp/tbots";
+        int loop_hz             = 1000;
+        int primitive_hz        = 60;
+        double duration_s       = 10.0;
+        int cpu_core            = -1;
+        int sched_fifo_priority = 0;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("runtime_dir",
+                       boost::program_options::value<std::string>(&args.runtime_dir),
+                       "The directory to output logs.");
+    desc.add_options()("loop_hz", boost::program_options::value<int>(&args.loop_hz),
+                       "The rate to step the primitive executor at.");
+    desc.add_options()("primitive_hz",
+                       boost::program_options::value<int>(&args.primitive_hz),
+                       "The rate to send new Move primitives at.");
+    desc.add_options()("duration_s",
+                       boost::program_options::value<double>(&args.duration_s),
+                       "How long to run the benchmark for (s).");
+    desc.add_options()("cpu_core", boost::program_options::value<int>(&args.cpu_core),
+                       "CPU core to pin the loop to. Not pinned if negative.");
+    desc.add_options()(
+        "sched_fifo_priority",
+        boost::program_options::value<int>(&args.sched_fifo_priority),
+        "SCHED_FIFO priority (1 - 99) to run the loop with. Uses the default scheduler if 0.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    LoggerSingleton::initializeLogger(args.runtime_dir, nullptr, false);
+
+    RealtimeExecutorConfig config;
+    config.lock_memory = true;
+    if (args.cpu_core >= 0)
+    {
+        config.cpu_core = args.cpu_core;
+    }
+    if (args.sched_fifo_priority > 0)
+    {
+        config.sched_fifo_priority = args.sched_fifo_priority;
+    }
+
+    const robot_constants::RobotConstants robot_constants =
+        robot_constants::createRobotConstants();
+    PrimitiveExecutor primitive_executor(robot_constants);
+    RobotState robot_state(Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero());
+    primitive_executor.updateState(robot_state);
+
+    // Bounce between two destinations so the robot is always moving
+    const std::array<Point, 2> destinations = {Point(-2, -1), Point(2, 1)};
+    const auto iterations_per_primitive =
+        static_cast<std::size_t>(std::max(1, args.loop_hz / args.primitive_hz));
+
+    TbotsProto::PrimitiveExecutorStatus status;
+    TbotsProto::DirectControlPrimitive direct_control;
+    LatencyHistogram step_histogram;
+    LatencyHistogram update_primitive_histogram;
+    std::size_t num_step_allocations             = 0;
+    std::size_t num_update_primitive_allocations = 0;
+
+    PeriodicRealtimeExecutor executor(args.loop_hz, config);
+    const RealtimeSetupResult setup_result = executor.setupRealtimeThread();
+
+    const auto num_iterations =
+        static_cast<std::size_t>(args.duration_s * static_cast<double>(args.loop_hz));
+    executor.run(
+        [&](const RealtimeIterationInfo& info)
+        {
+            const Duration delta_time = Duration::fromSeconds(1.0 / args.loop_hz);
+
+            if (info.iteration_number % iterations_per_primitive == 0)
+            {
+                // Head to the other destination every second
+                const std::size_t destination_index =
+                    (info.iteration_number / static_cast<std::size_t>(args.loop_hz)) %
+                    destinations.size();
+                const TbotsProto::Primitive primitive = createMovePrimitive(
+                    robot_state, destinations[destination_index], Angle::half());
+
+                ScopedAllocationCounter allocation_counter;
+                const auto start_time = std::chrono::steady_clock::now();
+                primitive_executor.updatePrimitive(primitive);
+                update_primitive_histogram.recordNanoseconds(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start_time)
+                        .count());
+                num_update_primitive_allocations +=
+                    allocation_counter.getNumAllocations();
+            }
+
+            {
+                ScopedAllocationCounter allocation_counter;
+                const auto start_time = std::chrono::steady_clock::now();
+                primitive_executor.updateState(robot_state);
+                primitive_executor.stepPrimitive(status, delta_time, direct_control);
+                step_histogram.recordNanoseconds(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start_time)
+                        .count());
+                // The first step allocates the sub-messages of direct_control
+                if (info.iteration_number > 0)
+                {
+                    num_step_allocations += allocation_counter.getNumAllocations();
+                }
+            }
+
+            // Move the robot exactly as commanded
+            const auto& velocity_control =
+                direct_control.motor_control().direct_velocity_control();
+            const Vector global_velocity = localToGlobalVelocity(
+                createVector(velocity_control.velocity()), robot_state.orientation());
+            const AngularVelocity angular_velocity =
+                createAngularVelocity(velocity_control.angular_velocity());
+            robot_state = RobotState(
+                robot_state.position() + global_velocity * delta_time.toSeconds(),
+                global_velocity,
+                robot_state.orientation() + angular_velocity * delta_time.toSeconds(),
+                angular_velocity);
+        },
+        num_iterations);
+
+    const RealtimeLoopStats& stats = executor.getStats();
+
+    std::cout << "CPU pinned: " << setup_result.cpu_pinned
+              << ", memory locked: " << setup_result.memory_locked
+              << ", SCHED_FIFO: " << setup_result.realtime_scheduling << std::endl;
+    std::cout << "Overruns: " << stats.num_overruns
+              << ", skipped periods: " << stats.num_skipped_periods << std::endl;
+    std::cout << "Heap allocations: " << num_step_allocations << " in stepPrimitive, "
+              << num_update_primitive_allocations << " in updatePrimitive" << std::endl
+              << std::endl;
+
+    std::cout << std::left << std::setw(20) << "(us)" << std::right << std::setw(10)
+              << "count" << std::setw(10) << "mean" << std::setw(10) << "p50"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(10)
+              << "max" << std::endl;
+    printHistogram("period", stats.period);
+    printHistogram("step", step_histogram);
+    printHistogram("update primitive", update_primitive_histogram);
+
+    return num_step_allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+#include "software/embedded/primitive_executor.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "proto/primitive/primitive_msg_factory.h"
+#include "shared/constants.h"
+#include "software/util/allocation_counter/allocation_counter.h"
+
+class PrimitiveExecutorTest : public testing::Test
+{
+   protected:
+    PrimitiveExecutorTest()
+        : robot_constants(robot_constants::createRobotConstants()),
+          executor(robot_constants),
+          delta_time(Duration::fromSeconds(1.0 / THUNDERLOOP_HZ))
+    {
+        executor.updateState(RobotState(Point(0, 0), Vector(), Angle::zero(),
+                                        AngularVelocity::zero()));
+    }
+
+    /**
+     * Creates a Move primitive from the origin to the given destination
+     *
+     * @param destination Where the robot should move to
+     * @param final_angle The orientation the robot should end up at
+     *
+     * @return the Move primitive
+     */
+    static TbotsProto::Primitive createMovePrimitive(const Point& destination,
+                                                     const Angle& final_angle)
+    {
+        TbotsProto::Primitive primitive;
+        TbotsProto::MovePrimitive* move = primitive.mutable_move();
+
+        *(move->mutable_xy_traj_params()->mutable_start_position()) =
+            *createPointProto(Point(0, 0));
+        *(move->mutable_xy_traj_params()->mutable_destination()) =
+            *createPointProto(destination);
+        move->mutable_xy_traj_params()->set_max_speed_mode(
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+        *(move->mutable_w_traj_params()->mutable_start_angle()) =
+            *createAngleProto(Angle::zero());
+        *(move->mutable_w_traj_params()->mutable_final_angle()) =
+            *createAngleProto(final_angle);
+
+        move->set_dribbler_mode(TbotsProto::DribblerMode::OFF);
+        move->mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(3.0f);
+        return primitive;
+    }
+
+    robot_constants::RobotConstants robot_constants;
+    PrimitiveExecutor executor;
+    Duration delta_time;
+    TbotsProto::PrimitiveExecutorStatus status;
+    TbotsProto::DirectControlPrimitive direct_control;
+};
+
+TEST_F(PrimitiveExecutorTest, test_stop_primitive_stops_robot)
+{
+    executor.updatePrimitive(*createStopPrimitiveProto());
+    executor.stepPrimitive(status, delta_time, direct_control);
+
+    const auto expected = createDirectControlPrimitive(Vector(), AngularVelocity(), 0,
+                                                       TbotsProto::AutoChipOrKick());
+    EXPECT_EQ(direct_control.DebugString(), expected->direct_control().DebugString());
+    EXPECT_FALSE(status.running_primitive());
+}
+
+TEST_F(PrimitiveExecutorTest, test_move_primitive_moves_towards_destination)
+{
+    executor.updatePrimitive(createMovePrimitive(Point(2, 0), Angle::zero()));
+    executor.stepPrimitive(status, delta_time, direct_control);
+
+    ASSERT_TRUE(direct_control.motor_control().has_direct_velocity_control());
+    EXPECT_GT(direct_control.motor_control()
+                  .direct_velocity_control()
+                  .velocity()
+                  .x_component_meters(),
+              0.0);
+    EXPECT_FLOAT_EQ(direct_control.power_control()
+                        .chicker()
+                        .auto_chip_or_kick()
+                        .autokick_speed_m_per_s(),
+                    3.0f);
+    EXPECT_TRUE(status.running_primitive());
+}
+
+TEST_F(PrimitiveExecutorTest, test_velocity_control_overwrites_direct_control_output)
+{
+    TbotsProto::Primitive primitive;
+    primitive.mutable_direct_control()
+        ->mutable_power_control()
+        ->mutable_chicker()
+        ->set_kick_speed_m_per_s(4.0f);
+    primitive.mutable_direct_control()->mutable_power_control()->set_geneva_slot(
+        TbotsProto::Geneva::RIGHT);
+    executor.updatePrimitive(primitive);
+    executor.stepPrimitive(status, delta_time, direct_control);
+    EXPECT_TRUE(direct_control.power_control().chicker().has_kick_speed_m_per_s());
+
+    // Nothing from the direct control primitive should leak into the output once the
+    // executor switches to a primitive that commands velocities
+    executor.updatePrimitive(*createStopPrimitiveProto());
+    executor.stepPrimitive(status, delta_time, direct_control);
+
+    const auto expected = createDirectControlPrimitive(Vector(), AngularVelocity(), 0,
+                                                       TbotsProto::AutoChipOrKick());
+    EXPECT_EQ(direct_control.DebugString(), expected->direct_control().DebugString());
+}
+
+TEST_F(PrimitiveExecutorTest, test_steady_state_step_does_not_allocate)
+{
+    executor.updatePrimitive(createMovePrimitive(Point(2, 1), Angle::half()));
+
+    // The first step allocates the sub-messages of the output
+    executor.stepPrimitive(status, delta_time, direct_control);
+
+    ScopedAllocationCounter allocation_counter;
+    for (int i = 0; i < THUNDERLOOP_HZ; i++)
+    {
+        executor.updateState(RobotState(Point(0.001 * i, 0), Vector(0.3, 0),
+                                        Angle::fromDegrees(i), AngularVelocity::zero()));
+        executor.stepPrimitive(status, delta_time, direct_control);
+    }
+    EXPECT_EQ(allocation_counter.getNumAllocations(), 0);
+}
+
+TEST_F(PrimitiveExecutorTest, test_stop_after_move_does_not_allocate)
+{
+    const TbotsProto::Primitive stop_primitive = *createStopPrimitiveProto();
+    executor.updatePrimitive(createMovePrimitive(Point(-1, 1), Angle::zero()));
+    executor.stepPrimitive(status, delta_time, direct_control);
+
+    executor.updatePrimitive(stop_primitive);
+
+    ScopedAllocationCounter allocation_counter;
+    for (int i = 0; i < THUNDERLOOP_HZ; i++)
+    {
+        executor.stepPrimitive(status, delta_time, direct_control);
+    }
+    EXPECT_EQ(allocation_counter.getNumAllocations(), 0);
+}
@@ -0,0 +1,135 @@
+#include "software/embedded/realtime/latency_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "shared/constants.h"
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::recordNanoseconds(int64_t value_ns)
+{
+    value_ns = std::max<int64_t>(value_ns, 0);
+
+    buckets_[getBucketIndex(static_cast<uint64_t>(value_ns))]++;
+    min_ns_ = count_ == 0 ? value_ns : std::min(min_ns_, value_ns);
+    max_ns_ = count_ == 0 ? value_ns : std::max(max_ns_, value_ns);
+    sum_ns_ += static_cast<double>(value_ns);
+    count_++;
+}
+
+void LatencyHistogram::recordMilliseconds(double value_ms)
+{
+    recordNanoseconds(std::llround(value_ms * NANOSECONDS_PER_MILLISECOND));
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    if (other.count_ == 0)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        buckets_[i] += other.buckets_[i];
+    }
+    min_ns_ = count_ == 0 ? other.min_ns_ : std::min(min_ns_, other.min_ns_);
+    max_ns_ = count_ == 0 ? other.max_ns_ : std::max(max_ns_, other.max_ns_);
+    sum_ns_ += other.sum_ns_;
+    count_ += other.count_;
+}
+
+void LatencyHistogram::reset()
+{
+    buckets_.fill(0);
+    count_  = 0;
+    min_ns_ = 0;
+    max_ns_ = 0;
+    sum_ns_ = 0.0;
+}
+
+int64_t LatencyHistogram::getPercentileNanoseconds(double percentile) const
+{
+    if (count_ == 0)
+    {
+        return 0;
+    }
+
+    // The rank of the value at the percentile, counting from 1
+    const double clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t rank             = std::max<uint64_t>(
+        1, static_cast<uint64_t>(
+               std::ceil(clamped_percentile / 100.0 * static_cast<double>(count_))));
+
+    uint64_t num_values_seen = 0;
+    for (std::size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        num_values_seen += buckets_[i];
+        if (num_values_seen >= rank)
+        {
+            // Every value in the bucket is reported as the bucket's upper bound, which
+            // may be larger than anything actually recorded
+            return std::clamp(static_cast<int64_t>(getBucketUpperBound(i)), min_ns_,
+                              max_ns_);
+        }
+    }
+    return max_ns_;
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    return count_;
+}
+
+int64_t LatencyHistogram::getMinNanoseconds() const
+{
+    return min_ns_;
+}
+
+int64_t LatencyHistogram::getMaxNanoseconds() const
+{
+    return max_ns_;
+}
+
+double LatencyHistogram::getMeanNanoseconds() const
+{
+    return count_ == 0 ? 0.0 : sum_ns_ / static_cast<double>(count_);
+}
+
+std::size_t LatencyHistogram::getBucketIndex(uint64_t value_ns)
+{
+    // Small values are recorded exactly
+    if (value_ns < SUB_BUCKET_COUNT)
+    {
+        return static_cast<std::size_t>(value_ns);
+    }
+
+    value_ns = std::min<uint64_t>(value_ns, (1ull << MAX_VALUE_BITS) - 1);
+
+    // The power of two range the value is in, and the sub-bucket within that range
+    // given by the SUB_BUCKET_BITS bits after the most significant bit
+    const unsigned int magnitude =
+        static_cast<unsigned int>(std::bit_width(value_ns)) - 1 - SUB_BUCKET_BITS;
+    const uint64_t sub_bucket = (value_ns >> magnitude) - SUB_BUCKET_COUNT;
+
+    return static_cast<std::size_t>(SUB_BUCKET_COUNT + magnitude * SUB_BUCKET_COUNT +
+                                    sub_bucket);
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(std::size_t bucket_index)
+{
+    if (bucket_index < SUB_BUCKET_COUNT)
+    {
+        return bucket_index;
+    }
+
+    const uint64_t magnitude  = (bucket_index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    const uint64_t sub_bucket = (bucket_index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+    const uint64_t lower_bound = (SUB_BUCKET_COUNT + sub_bucket) << magnitude;
+    return lower_bound + (1ull << magnitude) - 1;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/**
+ * A fixed size histogram of latencies in the style of HdrHistogram.
+ *
+ * Values are bucketed log-linearly: every power of two range is split into
+ * SUB_BUCKET_COUNT equal sub-buckets, so any recorded value can be recovered to within
+ * 1 / SUB_BUCKET_COUNT (~3%) of its true value, from nanoseconds up to minutes.
+ * Recording is O(1) and never allocates, so it is safe to use from real-time loops.
+ * The minimum, maximum and mean are tracked exactly.
+ *
+ * Not thread-safe.
+ */
+class LatencyHistogram
+{
+   public:
+    LatencyHistogram();
+
+    /**
+     * Records a latency. Negative values are recorded as zero and values larger than
+     * the histogram's range are recorded in the highest bucket.
+     *
+     * @param value_ns the latency in nanoseconds
+     */
+    void recordNanoseconds(int64_t value_ns);
+
+    /**
+     * Records a latency
+     *
+     * @param value_ms the latency in milliseconds
+     */
+    void recordMilliseconds(double value_ms);
+
+    /**
+     * Adds all values recorded in another histogram to this one
+     *
+     * @param other the histogram to add
+     */
+    void add(const LatencyHistogram& other);
+
+    /**
+     * Clears all recorded values
+     */
+    void reset();
+
+    /**
+     * Gets the value at the given percentile, i.e. the smallest value that is greater
+     * than or equal to percentile% of the recorded values, to within the histogram's
+     * precision
+     *
+     * @param percentile the percentile in [0, 100]
+     *
+     * @return the value at the percentile in nanoseconds, or 0 if nothing was recorded
+     */
+    int64_t getPercentileNanoseconds(double percentile) const;
+
+    /**
+     * Gets the number of recorded values
+     */
+    uint64_t getCount() const;
+
+    /**
+     * Gets the smallest recorded value in nanoseconds, or 0 if nothing was recorded
+     */
+    int64_t getMinNanoseconds() const;
+
+    /**
+     * Gets the largest recorded value in nanoseconds, or 0 if nothing was recorded
+     */
+    int64_t getMaxNanoseconds() const;
+
+    /**
+     * Gets the mean of the recorded values in nanoseconds, or 0 if nothing was recorded
+     */
+    double getMeanNanoseconds() const;
+
+    // Number of bits of precision kept for each value
+    static constexpr unsigned int SUB_BUCKET_BITS = 5;
+    static constexpr uint64_t SUB_BUCKET_COUNT    = 1ull << SUB_BUCKET_BITS;
+
+    // Values are recorded exactly up to 2^(MAX_VALUE_BITS) - 1 ns (~18 minutes)
+    static constexpr unsigned int MAX_VALUE_BITS = 40;
+
+    static constexpr std::size_t NUM_BUCKETS =
+        SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+    /**
+     * Gets the index of the bucket the given value is recorded in
+     *
+     * @param value_ns the value in nanoseconds
+     *
+     * @return the index of the bucket
+     */
+    static std::size_t getBucketIndex(uint64_t value_ns);
+
+    /**
+     * Gets the largest value that is recorded in the given bucket
+     *
+     * @param bucket_index the index of the bucket
+     *
+     * @return the largest value in nanoseconds that is recorded in the bucket
+     */
+    static uint64_t getBucketUpperBound(std::size_t bucket_index);
+
+   private:
+    std::array<uint64_t, NUM_BUCKETS> buckets_;
+    uint64_t count_;
+    int64_t min_ns_;
+    int64_t max_ns_;
+    double sum_ns_;
+};
@@ -0,0 +1,123 @@
+#include "software/embedded/realtime/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+TEST(LatencyHistogramTest, empty_histogram)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getCount(), 0);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(50), 0);
+    EXPECT_EQ(histogram.getMaxNanoseconds(), 0);
+    EXPECT_EQ(histogram.getMinNanoseconds(), 0);
+    EXPECT_EQ(histogram.getMeanNanoseconds(), 0.0);
+}
+
+TEST(LatencyHistogramTest, small_values_are_recorded_exactly)
+{
+    LatencyHistogram histogram;
+    const auto sub_bucket_count = static_cast<int64_t>(LatencyHistogram::SUB_BUCKET_COUNT);
+    for (int64_t value = 0; value < sub_bucket_count; value++)
+    {
+        histogram.recordNanoseconds(value);
+    }
+
+    EXPECT_EQ(histogram.getPercentileNanoseconds(0), 0);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(50), 15);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(100), 31);
+}
+
+TEST(LatencyHistogramTest, buckets_cover_values_within_precision)
+{
+    // Every value must fall in a bucket whose upper bound is within the histogram's
+    // precision of the value
+    const double max_relative_error = 1.0 / LatencyHistogram::SUB_BUCKET_COUNT;
+    for (uint64_t value = 1; value < (1ull << 36); value = value * 3 / 2 + 1)
+    {
+        const std::size_t bucket = LatencyHistogram::getBucketIndex(value);
+        ASSERT_LT(bucket, LatencyHistogram::NUM_BUCKETS);
+
+        const uint64_t upper_bound = LatencyHistogram::getBucketUpperBound(bucket);
+        EXPECT_GE(upper_bound, value);
+        EXPECT_LE(static_cast<double>(upper_bound - value) / static_cast<double>(value),
+                  max_relative_error);
+        if (bucket > 0)
+        {
+            EXPECT_LT(LatencyHistogram::getBucketUpperBound(bucket - 1), value);
+        }
+    }
+}
+
+TEST(LatencyHistogramTest, percentiles_of_uniform_values)
+{
+    LatencyHistogram histogram;
+
+    // 1 ms to 10 ms in 1 us steps
+    for (int64_t value_us = 1000; value_us <= 10000; value_us++)
+    {
+        histogram.recordNanoseconds(value_us * 1000);
+    }
+
+    auto expect_near_percentile = [&](double percentile, double expected_ns)
+    {
+        EXPECT_NEAR(static_cast<double>(histogram.getPercentileNanoseconds(percentile)),
+                    expected_ns, expected_ns / LatencyHistogram::SUB_BUCKET_COUNT)
+            << "percentile " << percentile;
+    };
+    expect_near_percentile(50, 5.5e6);
+    expect_near_percentile(90, 9.1e6);
+    expect_near_percentile(99, 9.91e6);
+
+    EXPECT_EQ(histogram.getPercentileNanoseconds(100), 10000000);
+    EXPECT_EQ(histogram.getMaxNanoseconds(), 10000000);
+    EXPECT_EQ(histogram.getMinNanoseconds(), 1000000);
+    EXPECT_DOUBLE_EQ(histogram.getMeanNanoseconds(), 5.5e6);
+    EXPECT_EQ(histogram.getCount(), 9001);
+}
+
+TEST(LatencyHistogramTest, tail_is_visible)
+{
+    LatencyHistogram histogram;
+    for (int i = 0; i < 999; i++)
+    {
+        histogram.recordMilliseconds(1.0);
+    }
+    histogram.recordMilliseconds(20.0);
+
+    EXPECT_NEAR(static_cast<double>(histogram.getPercentileNanoseconds(99)), 1e6,
+                1e6 / LatencyHistogram::SUB_BUCKET_COUNT);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(99.95), 20000000);
+    EXPECT_EQ(histogram.getMaxNanoseconds(), 20000000);
+}
+
+TEST(LatencyHistogramTest, out_of_range_values_are_clamped)
+{
+    LatencyHistogram histogram;
+    histogram.recordNanoseconds(-5);
+    histogram.recordNanoseconds(std::numeric_limits<int64_t>::max());
+
+    EXPECT_EQ(histogram.getCount(), 2);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(0), 0);
+    EXPECT_EQ(histogram.getMaxNanoseconds(), std::numeric_limits<int64_t>::max());
+}
+
+TEST(LatencyHistogramTest, add_and_reset)
+{
+    LatencyHistogram histogram;
+    histogram.recordMilliseconds(1.0);
+
+    LatencyHistogram other;
+    other.recordMilliseconds(3.0);
+    other.recordMilliseconds(5.0);
+
+    histogram.add(other);
+    EXPECT_EQ(histogram.getCount(), 3);
+    EXPECT_EQ(histogram.getMinNanoseconds(), 1000000);
+    EXPECT_EQ(histogram.getMaxNanoseconds(), 5000000);
+    EXPECT_DOUBLE_EQ(histogram.getMeanNanoseconds(), 3e6);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.getCount(), 0);
+    EXPECT_EQ(histogram.getPercentileNanoseconds(100), 0);
+}
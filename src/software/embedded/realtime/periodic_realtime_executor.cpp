@@ -0,0 +1,186 @@
+#include "software/embedded/realtime/periodic_realtime_executor.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "shared/constants.h"
+#include "software/logger/logger.h"
+#include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
+
+/**
+ * Adds the given number of nanoseconds to a timespec, keeping it normalized
+ *
+ * @param time the timespec to add to
+ * @param nanoseconds the number of nanoseconds to add
+ */
+static void addNanoseconds(struct timespec& time, int64_t nanoseconds)
+{
+    const auto nanoseconds_per_second = static_cast<int64_t>(NANOSECONDS_PER_SECOND);
+    const int64_t total_ns            = time.tv_nsec + nanoseconds;
+    time.tv_sec += static_cast<time_t>(total_ns / nanoseconds_per_second);
+    time.tv_nsec = static_cast<long>(total_ns % nanoseconds_per_second);
+}
+
+PeriodicRealtimeExecutor::PeriodicRealtimeExecutor(int loop_hz,
+                                                   const RealtimeExecutorConfig& config)
+    : period_ns_(static_cast<long>(NANOSECONDS_PER_SECOND / loop_hz)),
+      config_(config),
+      setup_result_(std::nullopt),
+      num_iterations_run_(0)
+{
+}
+
+void PeriodicRealtimeExecutor::runForever(const IterationFunction& iteration)
+{
+    setupRealtimeThread();
+    for (;;)
+    {
+        runIteration(iteration);
+    }
+}
+
+void PeriodicRealtimeExecutor::run(const IterationFunction& iteration,
+                                   std::size_t num_iterations)
+{
+    setupRealtimeThread();
+    for (std::size_t i = 0; i < num_iterations; i++)
+    {
+        runIteration(iteration);
+    }
+}
+
+RealtimeSetupResult PeriodicRealtimeExecutor::setupRealtimeThread()
+{
+    if (setup_result_.has_value())
+    {
+        return setup_result_.value();
+    }
+
+    RealtimeSetupResult result;
+
+    if (config_.lock_memory)
+    {
+        // Lock all current and future pages so the loop never page faults
+        result.memory_locked = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+        if (!result.memory_locked)
+        {
+            LOG(WARNING) << "PeriodicRealtimeExecutor: mlockall failed: "
+                         << std::strerror(errno);
+        }
+    }
+
+    if (config_.cpu_core.has_value())
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(config_.cpu_core.value(), &cpu_set);
+        const int error =
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        result.cpu_pinned = error == 0;
+        if (!result.cpu_pinned)
+        {
+            LOG(WARNING) << "PeriodicRealtimeExecutor: failed to pin to CPU "
+                         << config_.cpu_core.value() << ": " << std::strerror(error);
+        }
+    }
+
+    if (config_.sched_fifo_priority.has_value())
+    {
+        struct sched_param param;
+        param.sched_priority = config_.sched_fifo_priority.value();
+        const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        result.realtime_scheduling = error == 0;
+        if (!result.realtime_scheduling)
+        {
+            LOG(WARNING) << "PeriodicRealtimeExecutor: failed to set SCHED_FIFO priority "
+                         << param.sched_priority << ": " << std::strerror(error);
+        }
+    }
+
+    // The first iteration starts one period from now
+    clock_gettime(CLOCK_MONOTONIC, &next_shot_);
+    prev_iteration_start_time_ = next_shot_;
+    addNanoseconds(next_shot_, period_ns_);
+
+    setup_result_ = result;
+    return result;
+}
+
+const RealtimeLoopStats& PeriodicRealtimeExecutor::getStats() const
+{
+    return stats_;
+}
+
+void PeriodicRealtimeExecutor::resetStats()
+{
+    stats_.wakeup_latency.reset();
+    stats_.period.reset();
+    stats_.iteration_time.reset();
+    stats_.num_overruns        = 0;
+    stats_.num_skipped_periods = 0;
+}
+
+long PeriodicRealtimeExecutor::getPeriodNanoseconds() const
+{
+    return period_ns_;
+}
+
+void PeriodicRealtimeExecutor::runIteration(const IterationFunction& iteration)
+{
+    // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since CLOCK_REALTIME can jump
+    // backwards
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot_, NULL);
+
+    struct timespec iteration_start_time;
+    clock_gettime(CLOCK_MONOTONIC, &iteration_start_time);
+
+    RealtimeIterationInfo info{num_iterations_run_, {}};
+    ScopedTimespecTimer::timespecDiff(&iteration_start_time, &prev_iteration_start_time_,
+                                      &info.time_since_prev_iteration);
+    prev_iteration_start_time_ = iteration_start_time;
+
+    stats_.wakeup_latency.recordNanoseconds(timespecToNanoseconds(iteration_start_time) -
+                                            timespecToNanoseconds(next_shot_));
+    if (num_iterations_run_ > 0)
+    {
+        stats_.period.recordNanoseconds(
+            timespecToNanoseconds(info.time_since_prev_iteration));
+    }
+
+    iteration(info);
+    num_iterations_run_++;
+
+    struct timespec iteration_end_time;
+    clock_gettime(CLOCK_MONOTONIC, &iteration_end_time);
+    const int64_t iteration_end_ns = timespecToNanoseconds(iteration_end_time);
+    stats_.iteration_time.recordNanoseconds(
+        iteration_end_ns - timespecToNanoseconds(iteration_start_time));
+
+    // Schedule the next iteration (which is an absolute time)
+    addNanoseconds(next_shot_, period_ns_);
+
+    const int64_t overrun_ns = iteration_end_ns - timespecToNanoseconds(next_shot_);
+    if (overrun_ns > 0)
+    {
+        stats_.num_overruns++;
+
+        if (config_.overrun_policy == OverrunPolicy::SKIP_MISSED_PERIODS)
+        {
+            // Move to the first period boundary that is still in the future
+            const int64_t num_missed_periods = overrun_ns / period_ns_ + 1;
+            addNanoseconds(next_shot_, num_missed_periods * period_ns_);
+            stats_.num_skipped_periods += static_cast<uint64_t>(num_missed_periods);
+        }
+    }
+}
+
+int64_t timespecToNanoseconds(const struct timespec& time)
+{
+    return static_cast<int64_t>(time.tv_sec) *
+               static_cast<int64_t>(NANOSECONDS_PER_SECOND) +
+           static_cast<int64_t>(time.tv_nsec);
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <time.h>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+
+#include "software/embedded/realtime/latency_histogram.h"
+#include "software/util/make_enum/make_enum.hpp"
+
+// What to do when an iteration runs past the start of the next period
+MAKE_ENUM(OverrunPolicy,
+          // Skip the periods that were missed and wake up at the next period boundary
+          // that is still in the future, so the loop stays in phase and never runs
+          // iterations back to back
+          SKIP_MISSED_PERIODS,
+          // Run the missed iterations back to back until the loop catches up
+          CATCH_UP);
+
+/**
+ * How the PeriodicRealtimeExecutor sets up the thread it runs on. Each option is best
+ * effort: if it can't be applied (e.g. SCHED_FIFO without CAP_SYS_NICE on a development
+ * machine) a warning is logged and the loop runs anyway.
+ */
+struct RealtimeExecutorConfig
+{
+    // The CPU core to pin the loop's thread to
+    std::optional<int> cpu_core = std::nullopt;
+
+    // Run the loop's thread under SCHED_FIFO with this priority (1 - 99)
+    std::optional<int> sched_fifo_priority = std::nullopt;
+
+    // Lock all current and future pages of the process into RAM with mlockall
+    bool lock_memory = false;
+
+    OverrunPolicy overrun_policy = OverrunPolicy::SKIP_MISSED_PERIODS;
+};
+
+/**
+ * Which parts of the RealtimeExecutorConfig were applied successfully
+ */
+struct RealtimeSetupResult
+{
+    bool cpu_pinned          = false;
+    bool memory_locked       = false;
+    bool realtime_scheduling = false;
+};
+
+/**
+ * Timing information passed to each iteration of the loop
+ */
+struct RealtimeIterationInfo
+{
+    // The number of iterations run before this one
+    std::size_t iteration_number;
+
+    // Time between the start of the previous iteration and the start of this one
+    struct timespec time_since_prev_iteration;
+};
+
+/**
+ * Timing statistics for the loop run by a PeriodicRealtimeExecutor
+ */
+struct RealtimeLoopStats
+{
+    // How late each iteration started relative to its scheduled start time
+    LatencyHistogram wakeup_latency;
+
+    // Time between the starts of consecutive iterations
+    LatencyHistogram period;
+
+    // Time each iteration took to run
+    LatencyHistogram iteration_time;
+
+    // Number of iterations that ran past the start of the next period
+    uint64_t num_overruns = 0;
+
+    // Number of periods skipped due to overruns under SKIP_MISSED_PERIODS
+    uint64_t num_skipped_periods = 0;
+};
+
+/**
+ * Runs a function periodically on the calling thread, sleeping until absolute period
+ * boundaries with clock_nanosleep on CLOCK_MONOTONIC so that the time spent in each
+ * iteration doesn't accumulate as drift.
+ *
+ * Before the first iteration the calling thread is set up for real-time use according to
+ * the RealtimeExecutorConfig. While running, the executor records the wake up latency,
+ * period and iteration time of every iteration and detects overruns.
+ */
+class PeriodicRealtimeExecutor
+{
+   public:
+    using IterationFunction = std::function<void(const RealtimeIterationInfo&)>;
+
+    /**
+     * Creates a new PeriodicRealtimeExecutor
+     *
+     * @param loop_hz the rate to run the loop at
+     * @param config how to set up the thread the loop runs on
+     */
+    explicit PeriodicRealtimeExecutor(int loop_hz,
+                                      const RealtimeExecutorConfig& config = {});
+
+    /**
+     * Runs the given function every period, forever
+     *
+     * @param iteration the function to run
+     */
+    [[noreturn]] void runForever(const IterationFunction& iteration);
+
+    /**
+     * Runs the given function every period for the given number of iterations
+     *
+     * @param iteration the function to run
+     * @param num_iterations the number of iterations to run
+     */
+    void run(const IterationFunction& iteration, std::size_t num_iterations);
+
+    /**
+     * Applies the RealtimeExecutorConfig to the calling thread. Called automatically
+     * before the first iteration is run, and only applied once.
+     *
+     * @return which parts of the config were applied successfully
+     */
+    RealtimeSetupResult setupRealtimeThread();
+
+    /**
+     * Gets the timing statistics recorded since the last reset. Must be called from the
+     * thread running the loop (e.g. from within an iteration).
+     *
+     * @return the loop's timing statistics
+     */
+    const RealtimeLoopStats& getStats() const;
+
+    /**
+     * Clears the timing statistics. Must be called from the thread running the loop.
+     */
+    void resetStats();
+
+    /**
+     * Gets the period of the loop in nanoseconds
+     */
+    long getPeriodNanoseconds() const;
+
+   private:
+    /**
+     * Sleeps until the next period and runs a single iteration
+     *
+     * @param iteration the function to run
+     */
+    void runIteration(const IterationFunction& iteration);
+
+    const long period_ns_;
+    const RealtimeExecutorConfig config_;
+    std::optional<RealtimeSetupResult> setup_result_;
+
+    RealtimeLoopStats stats_;
+
+    std::size_t num_iterations_run_;
+    struct timespec next_shot_;
+    struct timespec prev_iteration_start_time_;
+};
+
+/**
+ * Converts a timespec to nanoseconds
+ *
+ * @param time the timespec
+ *
+ * @return the time in nanoseconds
+ */
+int64_t timespecToNanoseconds(const struct timespec& time);
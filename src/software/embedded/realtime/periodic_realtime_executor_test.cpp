@@ -0,0 +1,114 @@
+#include "software/embedded/realtime/periodic_realtime_executor.h"
+
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <thread>
+
+TEST(PeriodicRealtimeExecutorTest, runs_requested_number_of_iterations_at_loop_rate)
+{
+    constexpr int LOOP_HZ            = 500;
+    constexpr std::size_t ITERATIONS = 100;
+
+    PeriodicRealtimeExecutor executor(LOOP_HZ);
+    std::vector<std::size_t> iteration_numbers;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    executor.run([&](const RealtimeIterationInfo& info)
+                 { iteration_numbers.push_back(info.iteration_number); },
+                 ITERATIONS);
+    const double elapsed_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    ASSERT_EQ(iteration_numbers.size(), ITERATIONS);
+    for (std::size_t i = 0; i < ITERATIONS; i++)
+    {
+        EXPECT_EQ(iteration_numbers[i], i);
+    }
+
+    // The loop sleeps to absolute times, so it can't finish early
+    EXPECT_GE(elapsed_s, static_cast<double>(ITERATIONS) / LOOP_HZ);
+
+    const RealtimeLoopStats& stats = executor.getStats();
+    EXPECT_EQ(stats.wakeup_latency.getCount(), ITERATIONS);
+    EXPECT_EQ(stats.iteration_time.getCount(), ITERATIONS);
+    EXPECT_EQ(stats.period.getCount(), ITERATIONS - 1);
+    EXPECT_NEAR(stats.period.getMeanNanoseconds(),
+                static_cast<double>(executor.getPeriodNanoseconds()),
+                0.5 * static_cast<double>(executor.getPeriodNanoseconds()));
+}
+
+TEST(PeriodicRealtimeExecutorTest, overruns_skip_missed_periods)
+{
+    constexpr int LOOP_HZ = 1000;
+
+    PeriodicRealtimeExecutor executor(LOOP_HZ);
+
+    // Overrun by a bit more than 3 periods on every other iteration
+    executor.run(
+        [](const RealtimeIterationInfo& info)
+        {
+            if (info.iteration_number % 2 == 1)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(3500));
+            }
+        },
+        10);
+
+    // Each overrun misses at least 3 periods, which are skipped rather than run late
+    const RealtimeLoopStats& stats = executor.getStats();
+    EXPECT_GE(stats.num_overruns, 5);
+    EXPECT_GE(stats.num_skipped_periods, 3 * stats.num_overruns);
+}
+
+TEST(PeriodicRealtimeExecutorTest, overruns_catch_up)
+{
+    constexpr int LOOP_HZ = 1000;
+
+    RealtimeExecutorConfig config;
+    config.overrun_policy = OverrunPolicy::CATCH_UP;
+    PeriodicRealtimeExecutor executor(LOOP_HZ, config);
+
+    executor.run(
+        [](const RealtimeIterationInfo& info)
+        {
+            if (info.iteration_number == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        },
+        6);
+
+    const RealtimeLoopStats& stats = executor.getStats();
+    EXPECT_GE(stats.num_overruns, 1);
+    EXPECT_EQ(stats.num_skipped_periods, 0);
+
+    // The missed iterations run late, immediately after the overrun
+    EXPECT_GE(stats.wakeup_latency.getMaxNanoseconds(),
+              2 * executor.getPeriodNanoseconds());
+}
+
+TEST(PeriodicRealtimeExecutorTest, realtime_setup_is_best_effort)
+{
+    // Run on a separate thread so the scheduling changes don't leak into other tests
+    std::thread loop_thread(
+        []()
+        {
+            // Without privileges SCHED_FIFO fails, but the loop must still run
+            RealtimeExecutorConfig config;
+            config.cpu_core            = sched_getcpu();
+            config.sched_fifo_priority = 10;
+            PeriodicRealtimeExecutor executor(1000, config);
+
+            const RealtimeSetupResult result = executor.setupRealtimeThread();
+            EXPECT_TRUE(result.cpu_pinned);
+            EXPECT_FALSE(result.memory_locked);
+
+            int num_iterations = 0;
+            executor.run([&](const RealtimeIterationInfo&) { num_iterations++; }, 5);
+            EXPECT_EQ(num_iterations, 5);
+        });
+    loop_thread.join();
+}
@@ -0,0 +1,230 @@
+#include <boost/program_options.hpp>
+#include <iomanip>
+#include <iostream>
+
+#include "proto/primitive/primitive_msg_factory.h"
+#include "shared/constants.h"
+#include "shared/robot_constants.h"
+#include "software/embedded/primitive_executor.h"
+#include "software/embedded/realtime/periodic_realtime_executor.h"
+#include "software/embedded/robot_localizer.h"
+#include "software/logger/logger.h"
+
+/*
+ * This standalone program runs the same sequence of stages as Thunderloop on a
+ * PeriodicRealtimeExecutor, so the loop's timing and jitter can be benchmarked on a
+ * normal Linux machine. The robot localizer and primitive executor are the real ones,
+ * while the network, motor and power services are stubbed out by busy waiting for
+ * roughly as long as they take on the robot.
+ */
+
+/**
+ * Busy waits for the given duration, standing in for a service talking to hardware
+ *
+ * @param duration_us how long to wait in microseconds
+ */
+static void simulateServicePoll(int duration_us)
+{
+    const auto end_time =
+        std::chrono::steady_clock::now() + std::chrono::microseconds(duration_us);
+    while (std::chrono::steady_clock::now() < end_time)
+    {
+    }
+}
+
+/**
+ * Times the given stage and records its duration in the histogram
+ *
+ * @param histogram the histogram to record the duration in
+ * @param stage the stage to run
+ */
+template <typename Stage>
+static void runStage(LatencyHistogram& histogram, Stage&& stage)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    stage();
+    histogram.recordNanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - start_time)
+                                    .count());
+}
+
+/**
+ * Prints a row of the results table
+ *
+ * @param name the name of the row
+ * @param histogram the histogram to print
+ */
+static void printHistogram(const std::string& name, const LatencyHistogram& histogram)
+{
+    auto to_ms = [](auto nanoseconds)
+    { return static_cast<double>(nanoseconds) / NANOSECONDS_PER_MILLISECOND; };
+
+    std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+              << std::setprecision(4) << std::setw(10) << histogram.getCount()
+              << std::setw(10) << to_ms(histogram.getMeanNanoseconds()) << std::setw(10)
+              << to_ms(histogram.getPercentileNanoseconds(50)) << std::setw(10)
+              << to_ms(histogram.getPercentileNanoseconds(90)) << std::setw(10)
+              << to_ms(histogram.getPercentileNanoseconds(99)) << std::setw(10)
+              << to_ms(histogram.getPercentileNanoseconds(99.9)) << std::setw(10)
+              << to_ms(histogram.getMaxNanoseconds()) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                = false;
+        std::string runtime_dir  = "/tmp/tbots";
+        int loop_hz              = THUNDERLOOP_HZ;
+        double duration_s        = 10.0;
+        int cpu_core             = -1;
+        int sched_fifo_priority  = 0;
+        bool lock_memory         = false;
+        bool catch_up_overruns   = false;
+        int network_poll_time_us = 50;
+        int motor_poll_time_us   = 400;
+        int power_poll_time_us   = 100;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("runtime_dir",
+                       boost::program_options::value<std::string>(&args.runtime_dir),
+                       "The directory to output logs.");
+    desc.add_options()("loop_hz", boost::program_options::value<int>(&args.loop_hz),
+                       "The rate to run the loop at.");
+    desc.add_options()("duration_s",
+                       boost::program_options::value<double>(&args.duration_s),
+                       "How long to run the benchmark for (s).");
+    desc.add_options()("cpu_core", boost::program_options::value<int>(&args.cpu_core),
+                       "CPU core to pin the loop to. Not pinned if negative.");
+    desc.add_options()(
+        "sched_fifo_priority",
+        boost::program_options::value<int>(&args.sched_fifo_priority),
+        "SCHED_FIFO priority (1 - 99) to run the loop with. Uses the default scheduler if 0.");
+    desc.add_options()("lock_memory",
+                       boost::program_options::bool_switch(&args.lock_memory),
+                       "Lock the process's memory with mlockall.");
+    desc.add_options()("catch_up_overruns",
+                       boost::program_options::bool_switch(&args.catch_up_overruns),
+                       "Run missed iterations back to back instead of skipping them.");
+    desc.add_options()(
+        "network_poll_time_us",
+        boost::program_options::value<int>(&args.network_poll_time_us),
+        "How long the stubbed network service takes to poll (us).");
+    desc.add_options()("motor_poll_time_us",
+                       boost::program_options::value<int>(&args.motor_poll_time_us),
+                       "How long the stubbed motor service takes to poll (us).");
+    desc.add_options()("power_poll_time_us",
+                       boost::program_options::value<int>(&args.power_poll_time_us),
+                       "How long the stubbed power service takes to poll (us).");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    LoggerSingleton::initializeLogger(args.runtime_dir, nullptr, false);
+
+    RealtimeExecutorConfig config;
+    config.lock_memory    = args.lock_memory;
+    config.overrun_policy = args.catch_up_overruns ? OverrunPolicy::CATCH_UP
+                                                   : OverrunPolicy::SKIP_MISSED_PERIODS;
+    if (args.cpu_core >= 0)
+    {
+        config.cpu_core = args.cpu_core;
+    }
+    if (args.sched_fifo_priority > 0)
+    {
+        config.sched_fifo_priority = args.sched_fifo_priority;
+    }
+
+    const robot_constants::RobotConstants robot_constants =
+        robot_constants::createRobotConstants();
+    PrimitiveExecutor primitive_executor(robot_constants);
+    primitive_executor.updatePrimitive(*createStopPrimitiveProto());
+    RobotLocalizer robot_localizer(RobotLocalizer::RobotLocalizerConfig{
+        robot_constants.kalman_process_noise_variance_rad_per_s_4,
+        robot_constants.kalman_vision_noise_variance_rad_2,
+        robot_constants.kalman_motor_sensor_noise_variance_rad_per_s_2});
+
+    TbotsProto::DirectControlPrimitive direct_control;
+
+    LatencyHistogram network_poll_histogram;
+    LatencyHistogram localization_histogram;
+    LatencyHistogram primitive_step_histogram;
+    LatencyHistogram motor_poll_histogram;
+    LatencyHistogram power_poll_histogram;
+
+    PeriodicRealtimeExecutor executor(args.loop_hz, config);
+    const RealtimeSetupResult setup_result = executor.setupRealtimeThread();
+
+    const auto num_iterations =
+        static_cast<std::size_t>(args.duration_s * static_cast<double>(args.loop_hz));
+    executor.run(
+        [&](const RealtimeIterationInfo& info)
+        {
+            const auto time_since_prev_iteration_ns =
+                timespecToNanoseconds(info.time_since_prev_iteration);
+            const Duration delta_time = Duration::fromSeconds(
+                static_cast<double>(time_since_prev_iteration_ns) /
+                NANOSECONDS_PER_SECOND);
+
+            runStage(network_poll_histogram,
+                     [&]() { simulateServicePoll(args.network_poll_time_us); });
+            runStage(localization_histogram,
+                     [&]()
+                     {
+                         robot_localizer.step(Vector());
+                         primitive_executor.updateState(
+                             RobotState(robot_localizer.getPosition(),
+                                        robot_localizer.getVelocity(),
+                                        robot_localizer.getOrientation(),
+                                        robot_localizer.getAngularVelocity()));
+                     });
+            runStage(primitive_step_histogram,
+                     [&]()
+                     {
+                         TbotsProto::PrimitiveExecutorStatus status;
+                         primitive_executor.stepPrimitive(status, delta_time,
+                                                          direct_control);
+                     });
+            runStage(motor_poll_histogram,
+                     [&]() { simulateServicePoll(args.motor_poll_time_us); });
+            runStage(power_poll_histogram,
+                     [&]() { simulateServicePoll(args.power_poll_time_us); });
+        },
+        num_iterations);
+
+    const RealtimeLoopStats& stats = executor.getStats();
+
+    std::cout << "CPU pinned: " << setup_result.cpu_pinned
+              << ", memory locked: " << setup_result.memory_locked
+              << ", SCHED_FIFO: " << setup_result.realtime_scheduling << std::endl;
+    std::cout << "Overruns: " << stats.num_overruns
+              << ", skipped periods: " << stats.num_skipped_periods << std::endl
+              << std::endl;
+
+    std::cout << std::left << std::setw(26) << "(ms)" << std::right << std::setw(10)
+              << "count" << std::setw(10) << "mean" << std::setw(10) << "p50"
+              << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10)
+              << "p99.9" << std::setw(10) << "max" << std::endl;
+    printHistogram("wakeup latency", stats.wakeup_latency);
+    printHistogram("period", stats.period);
+    printHistogram("iteration time", stats.iteration_time);
+    printHistogram("network service poll", network_poll_histogram);
+    printHistogram("localization", localization_histogram);
+    printHistogram("primitive executor step", primitive_step_histogram);
+    printHistogram("motor service poll", motor_poll_histogram);
+    printHistogram("power service poll", power_poll_histogram);
+
+    return 0;
+}
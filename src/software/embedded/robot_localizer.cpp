@@ -4,7 +4,8 @@
 
 RobotLocalizer::RobotLocalizer(const RobotLocalizerConfig& config)
     : process_linear_acceleration_noise_variance_(config.process_noise_variance),
-      process_angular_acceleration_noise_variance_(config.process_noise_variance)
+      process_angular_acceleration_noise_variance_(config.process_noise_variance),
+      history(MAX_HISTORY_SIZE)
 {
     filter_.state_covariance =
         Eigen::Vector<double, STATE_SIZE>(1, 1, 1, 1, 1, 1).asDiagonal();
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <Eigen/Dense>
-#include <deque>
+#include <boost/circular_buffer.hpp>
 #include <optional>
 
 #include "proto/world.pb.h"
@@ -173,6 +173,12 @@ class RobotLocalizer
 
     std::chrono::time_point<std::chrono::steady_clock> last_step_time_;
 
-    // History is ordered newest-first (front is the most recent step)
-    std::deque<FilterStep> history;
+    // History is ordered newest-first (front is the most recent step). Once it is full,
+    // each new step replaces the oldest one, so that recording a step never allocates
+    boost::circular_buffer<FilterStep> history;
+
+    // Enough steps to rewind well past the age of a vision sample (RTT_S / 2) at
+    // THUNDERLOOP_HZ, which records an IMU update, a motor update and a prediction
+    // every iteration
+    static constexpr std::size_t MAX_HISTORY_SIZE = 128;
 };
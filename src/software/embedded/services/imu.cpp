@@ -49,7 +49,7 @@ static __s32 i2c_smbus_write_byte_data(int file, __u8 command, __u8 value)
 }
 
 
-ImuService::ImuService() : initialized_(false)
+I2cImuService::I2cImuService() : initialized_(false)
 {
     // Establish connection to the IMU and verify that the who am I pin is correct.
     file_descriptor_ = open(IMU_DEVICE.c_str(), O_RDWR);
@@ -134,7 +134,7 @@ ImuService::ImuService() : initialized_(false)
     // LOG(INFO) << "error: " << deviation.x() << deviation.y()  << ".";
 }
 
-std::optional<ImuData> ImuService::poll()
+std::optional<ImuData> I2cImuService::poll()
 {
     std::optional<AngularVelocity> angular_velocity = pollAngularVelocity();
     std::optional<AngularAcceleration> angular_acceleration =
@@ -151,7 +151,8 @@ std::optional<ImuData> ImuService::poll()
 
     return ImuData{angular_velocity, angular_acceleration, linear_acceleration};
 }
-std::optional<int16_t> ImuService::readAndCombineByteData(uint8_t ls_reg, uint8_t ms_reg)
+std::optional<int16_t> I2cImuService::readAndCombineByteData(uint8_t ls_reg,
+                                                             uint8_t ms_reg)
 {
     int least_significant = i2c_smbus_read_byte_data(file_descriptor_, ls_reg);
     int most_significant  = i2c_smbus_read_byte_data(file_descriptor_, ms_reg);
@@ -167,7 +168,7 @@ std::optional<int16_t> ImuService::readAndCombineByteData(uint8_t ls_reg, uint8_
     return static_cast<int16_t>(combined);
 }
 
-std::optional<AngularVelocity> ImuService::pollAngularVelocity()
+std::optional<AngularVelocity> I2cImuService::pollAngularVelocity()
 {
     if (!initialized_)
     {
@@ -191,7 +192,7 @@ std::optional<AngularVelocity> ImuService::pollAngularVelocity()
 }
 
 
-std::optional<AngularAcceleration> ImuService::pollAngularAcceleration(
+std::optional<AngularAcceleration> I2cImuService::pollAngularAcceleration(
     std::optional<AngularVelocity> curr_angular_velocity)
 {
     if (!initialized_)
@@ -223,7 +224,7 @@ std::optional<AngularAcceleration> ImuService::pollAngularAcceleration(
 
 
 
-std::optional<Eigen::Vector2d> ImuService::pollLinearAcceleration()
+std::optional<Eigen::Vector2d> I2cImuService::pollLinearAcceleration()
 {
     if (!initialized_)
     {
@@ -252,9 +253,8 @@ std::optional<Eigen::Vector2d> ImuService::pollLinearAcceleration()
     return Eigen::Vector2d(a_x, a_y);
 }
 
-Eigen::Vector2d ImuService::transformLinearAcceleration(AngularVelocity omega,
-                                                        AngularAcceleration alpha,
-                                                        Eigen::Vector2d imu_acceleration)
+Eigen::Vector2d I2cImuService::transformLinearAcceleration(
+    AngularVelocity omega, AngularAcceleration alpha, Eigen::Vector2d imu_acceleration)
 {
     Eigen::Vector2d r(IMU_OFFSET_X, IMU_OFFSET_Y);
 
@@ -270,7 +270,7 @@ Eigen::Vector2d ImuService::transformLinearAcceleration(AngularVelocity omega,
     return imu_acceleration + tangential - centripetal;
 }
 
-Eigen::Vector2d ImuService::calibrate_imu()
+Eigen::Vector2d I2cImuService::calibrate_imu()
 {
     LOG(INFO) << "Start IMU x,y calibration" << std::endl;
     Eigen::MatrixXd A(2 * 100, 2);
@@ -18,21 +18,41 @@ struct ImuData
     std::optional<AngularAcceleration> angular_acceleration;
     std::optional<Eigen::Vector2d> linear_acceleration;
 };
+
+/**
+ * A service that reads the IMU
+ */
 class ImuService
 {
    public:
+    virtual ~ImuService() = default;
+
     /**
-     * Constructs and initializes a new IMU service object.
+     * Polls the latest IMU readings
      *
-     * If successfully initialized, will try to do a simple calibration of the IMU.
+     * @return the latest IMU readings
      */
-    ImuService();
-
-    std::optional<ImuData> poll();
+    virtual std::optional<ImuData> poll() = 0;
 
     // Variance from datasheet (in rad^2/s^2)
     static constexpr double IMU_VARIANCE =
         (4.0 * 14.4222 / 1000.0 * M_PI / 180.0) * (4.0 * 14.4222 / 1000.0 * M_PI / 180.0);
+};
+
+/**
+ * An ImuService that reads the robot's IMU over I2C
+ */
+class I2cImuService : public ImuService
+{
+   public:
+    /**
+     * Constructs and initializes a new IMU service object.
+     *
+     * If successfully initialized, will try to do a simple calibration of the IMU.
+     */
+    I2cImuService();
+
+    std::optional<ImuData> poll() override;
 
    private:
     /**
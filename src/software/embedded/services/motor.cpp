@@ -6,7 +6,8 @@
 #include "software/embedded/motor_controller/tmc_motor_controller.h"
 #include "software/logger/logger.h"
 
-MotorService::MotorService(const robot_constants::RobotConstants& robot_constants)
+MotorBoardService::MotorBoardService(
+    const robot_constants::RobotConstants& robot_constants)
     : robot_constants_(robot_constants),
       motor_controller_(setupMotorController()),
       euclidean_to_four_wheel_(robot_constants),
@@ -16,7 +17,7 @@ MotorService::MotorService(const robot_constants::RobotConstants& robot_constant
 {
 }
 
-void MotorService::setup()
+void MotorBoardService::setup()
 {
     prev_wheel_velocities_   = WheelSpace_t::Zero();
     target_wheel_velocities_ = WheelSpace_t::Zero();
@@ -24,12 +25,12 @@ void MotorService::setup()
     motor_controller_->setup();
 }
 
-void MotorService::reset()
+void MotorBoardService::reset()
 {
     motor_controller_->reset();
 }
 
-std::unique_ptr<MotorController> MotorService::setupMotorController()
+std::unique_ptr<MotorController> MotorBoardService::setupMotorController()
 {
     if constexpr (MOTOR_BOARD == MotorBoard::TRINAMIC)
     {
@@ -41,7 +42,7 @@ std::unique_ptr<MotorController> MotorService::setupMotorController()
     }
 }
 
-TbotsProto::MotorStatus MotorService::createMotorStatus(
+TbotsProto::MotorStatus MotorBoardService::createMotorStatus(
     const WheelSpace_t& current_wheel_velocities, const double dribbler_rpm) const
 {
     TbotsProto::MotorStatus motor_status;
@@ -104,9 +105,9 @@ TbotsProto::MotorStatus MotorService::createMotorStatus(
     return motor_status;
 }
 
-void MotorService::poll(const TbotsProto::DirectControlPrimitive& primitive,
-                        TbotsProto::RobotStatus& robot_status,
-                        const double time_elapsed_since_last_poll_s)
+void MotorBoardService::poll(const TbotsProto::DirectControlPrimitive& primitive,
+                             TbotsProto::RobotStatus& robot_status,
+                             const double time_elapsed_since_last_poll_s)
 {
     if (anyMotorRequiresReset())
     {
@@ -132,6 +133,8 @@ void MotorService::poll(const TbotsProto::DirectControlPrimitive& primitive,
     const double dribbler_rpm = motor_controller_->readThenWriteVelocity(
         MotorIndex::DRIBBLER, dribbler_target_rpm_);
 
+    motor_controller_->submitCycle();
+
     const WheelSpace_t current_wheel_velocities =
         current_wheel_rpms.cast<double>() * drive_motor_mps_per_rpm_;
 
@@ -253,7 +256,7 @@ void MotorService::poll(const TbotsProto::DirectControlPrimitive& primitive,
     *(robot_status.mutable_motor_status()) = motor_status;
 }
 
-void MotorService::trackMotorReset()
+void MotorBoardService::trackMotorReset()
 {
     const auto now = std::chrono::steady_clock::now();
 
@@ -286,7 +289,7 @@ void MotorService::trackMotorReset()
     }
 }
 
-bool MotorService::anyMotorRequiresReset() const
+bool MotorBoardService::anyMotorRequiresReset() const
 {
     return std::any_of(reflective_enum::values<MotorIndex>().begin(),
                        reflective_enum::values<MotorIndex>().end(),
@@ -11,21 +11,11 @@
 
 /**
  * A service that interacts with the motors.
- *
- * It is responsible for:
- * - Converting Euclidean velocities to wheel velocities
- * - Communicating with the motor
- * - Detecting and handling faults
  */
 class MotorService
 {
    public:
-    /**
-     * Service that interacts with the motors.
-     *
-     * @param robot_constants The robot constants
-     */
-    explicit MotorService(const robot_constants::RobotConstants& robot_constants);
+    virtual ~MotorService() = default;
 
     /**
      * Polls the motor service to execute the given DirectControlPrimitive and
@@ -35,19 +25,47 @@ class MotorService
      * @param robot_status RobotStatus message to modify with the current motor status
      * @param time_elapsed_since_last_poll_s The time since the last poll in seconds
      */
-    void poll(const TbotsProto::DirectControlPrimitive& primitive,
-              TbotsProto::RobotStatus& robot_status,
-              double time_elapsed_since_last_poll_s);
+    virtual void poll(const TbotsProto::DirectControlPrimitive& primitive,
+                      TbotsProto::RobotStatus& robot_status,
+                      double time_elapsed_since_last_poll_s) = 0;
 
     /**
      * Clears previous faults, configures the motor and checks encoder connections.
      */
-    void setup();
+    virtual void setup() = 0;
 
     /**
      * Resets the motors, effectively stopping them from moving.
      */
-    void reset();
+    virtual void reset() = 0;
+};
+
+/**
+ * A MotorService that drives the motors through the motor board selected at compile
+ * time.
+ *
+ * It is responsible for:
+ * - Converting Euclidean velocities to wheel velocities
+ * - Communicating with the motor
+ * - Detecting and handling faults
+ */
+class MotorBoardService : public MotorService
+{
+   public:
+    /**
+     * Service that interacts with the motors.
+     *
+     * @param robot_constants The robot constants
+     */
+    explicit MotorBoardService(const robot_constants::RobotConstants& robot_constants);
+
+    void poll(const TbotsProto::DirectControlPrimitive& primitive,
+              TbotsProto::RobotStatus& robot_status,
+              double time_elapsed_since_last_poll_s) override;
+
+    void setup() override;
+
+    void reset() override;
 
    private:
     /**
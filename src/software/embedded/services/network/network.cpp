@@ -3,14 +3,16 @@
 #include "software/logger/network_logger.h"
 #include "software/networking/tbots_network_exception.h"
 
-NetworkService::NetworkService(const RobotId& robot_id, const std::string& ip_address,
-                               unsigned short primitive_listener_port,
-                               unsigned short robot_status_sender_port,
-                               unsigned short full_system_to_robot_ip_notification_port,
-                               unsigned short robot_to_full_system_ip_notification_port,
-                               unsigned short robot_logs_port,
-                               const std::string& interface)
-    : interface(interface),
+UdpNetworkService::UdpNetworkService(
+    const RobotId& robot_id, const std::string& ip_address,
+    unsigned short primitive_listener_port,
+    unsigned short compact_primitive_set_listener_port,
+    unsigned short robot_status_sender_port,
+    unsigned short full_system_to_robot_ip_notification_port,
+    unsigned short robot_to_full_system_ip_notification_port,
+    unsigned short robot_logs_port, const std::string& interface)
+    : robot_id(robot_id),
+      interface(interface),
       robot_status_sender_port(robot_status_sender_port),
       primitive_tracker(ProtoTracker("primitive set"))
 {
@@ -19,7 +21,7 @@ NetworkService::NetworkService(const RobotId& robot_id, const std::string& ip_ad
         fullsystem_to_robot_ip_listener =
             std::make_unique<ThreadedProtoUdpListener<TbotsProto::IpNotification>>(
                 ip_address, full_system_to_robot_ip_notification_port, interface,
-                std::bind(&NetworkService::onFullSystemIpNotification, this,
+                std::bind(&UdpNetworkService::onFullSystemIpNotification, this,
                           std::placeholders::_1),
                 true);
 
@@ -32,6 +34,11 @@ NetworkService::NetworkService(const RobotId& robot_id, const std::string& ip_ad
             std::make_unique<ThreadedProtoUdpListener<TbotsProto::Primitive>>(
                 primitive_listener_port,
                 [&](TbotsProto::Primitive primitive) { primitiveCallback(primitive); });
+
+        udp_listener_compact_primitive_set = std::make_unique<ThreadedUdpListener>(
+            ip_address, compact_primitive_set_listener_port, interface, true,
+            [&](const char* data, const size_t& size)
+            { compactPrimitiveSetCallback(data, size); });
     }
     catch (const TbotsNetworkException& e)
     {
@@ -50,7 +57,7 @@ NetworkService::NetworkService(const RobotId& robot_id, const std::string& ip_ad
     }
 }
 
-void NetworkService::onFullSystemIpNotification(
+void UdpNetworkService::onFullSystemIpNotification(
     const TbotsProto::IpNotification& ip_notification)
 {
     std::string new_fullsystem_ip = ip_notification.ip_address();
@@ -88,7 +95,8 @@ void NetworkService::onFullSystemIpNotification(
     }
 }
 
-TbotsProto::Primitive NetworkService::poll(TbotsProto::RobotStatus& robot_status)
+bool UdpNetworkService::poll(TbotsProto::RobotStatus& robot_status,
+                             TbotsProto::Primitive& primitive)
 {
     std::scoped_lock lock{primitive_mutex};
 
@@ -112,10 +120,18 @@ TbotsProto::Primitive NetworkService::poll(TbotsProto::RobotStatus& robot_status
         (ip_notification_ticks + 1) % IP_DISCOVERY_NOTIFICATION_RATE_HZ;
 
     thunderloop_ticks = (thunderloop_ticks + 1) % THUNDERLOOP_HZ;
-    return primitive_msg;
+
+    if (primitive_msg.time_sent().epoch_timestamp_seconds() <=
+        primitive.time_sent().epoch_timestamp_seconds())
+    {
+        return false;
+    }
+
+    primitive = primitive_msg;
+    return true;
 }
 
-bool NetworkService::shouldSendNewRobotStatus(
+bool UdpNetworkService::shouldSendNewRobotStatus(
     const TbotsProto::RobotStatus& robot_status) const
 {
     bool has_motor_fault =
@@ -135,7 +151,7 @@ bool NetworkService::shouldSendNewRobotStatus(
            require_heartbeat_status_update;
 }
 
-void NetworkService::sendRobotStatus(const TbotsProto::RobotStatus& robot_status)
+void UdpNetworkService::sendRobotStatus(const TbotsProto::RobotStatus& robot_status)
 {
     std::scoped_lock lock(robot_status_sender_mutex);
 
@@ -145,21 +161,39 @@ void NetworkService::sendRobotStatus(const TbotsProto::RobotStatus& robot_status
     }
 }
 
-void NetworkService::primitiveCallback(const TbotsProto::Primitive& input)
+bool UdpNetworkService::trackNewPrimitive(const TbotsProto::Primitive& new_primitive)
 {
-    std::scoped_lock<std::mutex> lock(primitive_mutex);
-    const uint64_t seq_num = input.sequence_number();
+    logNewPrimitive(new_primitive);
 
-    logNewPrimitive(input);
+    primitive_tracker.send(new_primitive.sequence_number());
+    return primitive_tracker.isLastValid();
+}
 
-    primitive_tracker.send(seq_num);
-    if (primitive_tracker.isLastValid())
+void UdpNetworkService::primitiveCallback(const TbotsProto::Primitive& input)
+{
+    std::scoped_lock<std::mutex> lock(primitive_mutex);
+    if (trackNewPrimitive(input))
     {
         primitive_msg = input;
     }
 }
 
-void NetworkService::logNewPrimitive(const TbotsProto::Primitive& new_primitive)
+void UdpNetworkService::compactPrimitiveSetCallback(const char* data, const size_t& size)
+{
+    std::scoped_lock<std::mutex> lock(primitive_mutex);
+    if (!decodeCompactPrimitive(std::span(data, size), robot_id,
+                                decoded_compact_primitive))
+    {
+        return;
+    }
+
+    if (trackNewPrimitive(decoded_compact_primitive))
+    {
+        primitive_msg.Swap(&decoded_compact_primitive);
+    }
+}
+
+void UdpNetworkService::logNewPrimitive(const TbotsProto::Primitive& new_primitive)
 {
     if (primitive_rtt.size() >= PRIMITIVE_DEQUE_MAX_SIZE)
     {
@@ -175,7 +209,7 @@ void NetworkService::logNewPrimitive(const TbotsProto::Primitive& new_primitive)
         return;
     }
 
-    NetworkService::RoundTripTime current_round_trip_time;
+    UdpNetworkService::RoundTripTime current_round_trip_time;
     current_round_trip_time.primitive_sequence_num = new_primitive.sequence_number();
     current_round_trip_time.thunderscope_sent_time_seconds =
         new_primitive.time_sent().epoch_timestamp_seconds();
@@ -185,7 +219,7 @@ void NetworkService::logNewPrimitive(const TbotsProto::Primitive& new_primitive)
     primitive_rtt.emplace_back(current_round_trip_time);
 }
 
-void NetworkService::updatePrimitiveLog(TbotsProto::RobotStatus& robot_status)
+void UdpNetworkService::updatePrimitiveLog(TbotsProto::RobotStatus& robot_status)
 {
     uint64_t seq_num = robot_status.last_handled_primitive_set();
     while (!primitive_rtt.empty())
@@ -206,7 +240,7 @@ void NetworkService::updatePrimitiveLog(TbotsProto::RobotStatus& robot_status)
     }
 }
 
-double NetworkService::getCurrentEpochTimeInSeconds()
+double UdpNetworkService::getCurrentEpochTimeInSeconds()
 {
     const auto clock_time = std::chrono::system_clock::now();
     double time_in_seconds =
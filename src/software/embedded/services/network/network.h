@@ -4,6 +4,7 @@
 #include <queue>
 
 #include "proto/ip_notification.pb.h"
+#include "proto/message_translation/compact_primitive_set.h"
 #include "proto/primitive.pb.h"
 #include "proto/robot_log_msg.pb.h"
 #include "proto/robot_status_msg.pb.h"
@@ -12,11 +13,40 @@
 #include "software/embedded/services/network/proto_tracker.h"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_sender.hpp"
+#include "software/networking/udp/threaded_udp_listener.h"
 #include "software/time/duration.h"
 #include "software/time/timestamp.h"
 #include "software/world/robot_state.h"
 
+/**
+ * A service that communicates with our AI: it receives primitives and sends back the
+ * robot status.
+ */
 class NetworkService
+{
+   public:
+    virtual ~NetworkService() = default;
+
+    /**
+     * Sends the robot status if needed, and copies the most recent primitive into the
+     * given primitive if it was sent after the given primitive. The primitive is only
+     * copied when it is new, so that polling does not allocate.
+     *
+     * @param robot_status The robot status to send, which is updated with the network
+     * status
+     * @param primitive The primitive currently being run, which the most recent
+     * primitive is copied into if it is newer
+     *
+     * @return true if a newer primitive was copied into the given primitive
+     */
+    virtual bool poll(TbotsProto::RobotStatus& robot_status,
+                      TbotsProto::Primitive& primitive) = 0;
+};
+
+/**
+ * A NetworkService that communicates with our AI over UDP
+ */
+class UdpNetworkService : public NetworkService
 {
    public:
     /**
@@ -26,6 +56,8 @@ class NetworkService
      * @param robot_id The robot id of the robot
      * @param ip_address The IP Address the service should connect to
      * @param primitive_listener_port The port to listen for primitive protos
+     * @param compact_primitive_set_listener_port The port to listen for compact
+     * primitive sets multicast to every robot on the channel
      * @param robot_status_sender_port The port to send robot status
      * @param full_system_to_robot_ip_notification_port The port to listen for full system
      * IP discovery notification
@@ -34,20 +66,16 @@ class NetworkService
      * @param robot_logs_port The port to send logs from
      * @param interface the interface to listen and send on
      */
-    NetworkService(const RobotId& robot_id, const std::string& ip_address,
-                   unsigned short primitive_listener_port,
-                   unsigned short robot_status_sender_port,
-                   unsigned short full_system_to_robot_ip_notification_port,
-                   unsigned short robot_to_full_system_ip_notification_port,
-                   unsigned short robot_logs_port, const std::string& interface);
+    UdpNetworkService(const RobotId& robot_id, const std::string& ip_address,
+                      unsigned short primitive_listener_port,
+                      unsigned short compact_primitive_set_listener_port,
+                      unsigned short robot_status_sender_port,
+                      unsigned short full_system_to_robot_ip_notification_port,
+                      unsigned short robot_to_full_system_ip_notification_port,
+                      unsigned short robot_logs_port, const std::string& interface);
 
-    /**
-     * When the network service is polled, it sends the robot_status and returns
-     * a tuple of the most recent Primitive
-     *
-     * @returns a tuple of the stored primitive
-     */
-    TbotsProto::Primitive poll(TbotsProto::RobotStatus& robot_status);
+    bool poll(TbotsProto::RobotStatus& robot_status,
+              TbotsProto::Primitive& primitive) override;
 
    private:
     /**
@@ -85,6 +113,15 @@ class NetworkService
      */
     double getCurrentEpochTimeInSeconds();
 
+    /**
+     * Tracks a newly received primitive for packet loss and round-trip time
+     *
+     * @param new_primitive The primitive received
+     *
+     * @return true if the primitive is newer than the last one and should be used
+     */
+    bool trackNewPrimitive(const TbotsProto::Primitive& new_primitive);
+
     /**
      * Handler for received primitive packets
      *
@@ -92,6 +129,15 @@ class NetworkService
      */
     void primitiveCallback(const TbotsProto::Primitive& input);
 
+    /**
+     * Handler for received compact primitive sets. Decodes the primitive of this robot,
+     * if the set has one, straight into the cached primitive.
+     *
+     * @param data The compact primitive set received
+     * @param size The size of the compact primitive set
+     */
+    void compactPrimitiveSetCallback(const char* data, const size_t& size);
+
     /**
      * Handler for received full system IP notification packets
      *
@@ -118,10 +164,17 @@ class NetworkService
 
     // Variables
 
+    // The id of this robot
+    RobotId robot_id;
+
     // Mutex protects the primitive message
     std::mutex primitive_mutex;
     TbotsProto::Primitive primitive_msg;
 
+    // The primitive compact primitive sets are decoded into, which is swapped with the
+    // primitive message so that neither is reallocated for every set received
+    TbotsProto::Primitive decoded_compact_primitive;
+
     // Mutex protects the fullsystem IP address
     std::mutex fullsystem_ip_mutex;
     std::optional<std::string> fullsystem_ip;
@@ -136,6 +189,7 @@ class NetworkService
         robot_to_fullsystem_ip_sender;
     std::unique_ptr<ThreadedProtoUdpListener<TbotsProto::Primitive>>
         udp_listener_primitive;
+    std::unique_ptr<ThreadedUdpListener> udp_listener_compact_primitive_set;
     std::shared_ptr<ThreadedProtoUdpSender<TbotsProto::RobotLog>> robot_log_sender;
 
     // The network interface to listen and send messages on
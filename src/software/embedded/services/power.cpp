@@ -5,8 +5,8 @@
 
 #include "proto/power_frame_msg.pb.h"
 
-PowerService::PowerService(const double kick_coefficient, const int kick_constant,
-                           const int chip_constant)
+UartPowerService::UartPowerService(const double kick_coefficient,
+                                   const int kick_constant, const int chip_constant)
     : kick_coefficient_(kick_coefficient),
       kick_constant_(kick_constant),
       chip_constant_(chip_constant),
@@ -23,13 +23,13 @@ PowerService::PowerService(const double kick_coefficient, const int kick_constan
     this->read_thread_ = std::thread([&] { continuousRead(); });
 }
 
-PowerService::~PowerService()
+UartPowerService::~UartPowerService()
 {
     is_running_ = false;
     read_thread_.join();
 }
 
-void PowerService::continuousRead()
+void UartPowerService::continuousRead()
 {
     while (is_running_)
     {
@@ -37,7 +37,7 @@ void PowerService::continuousRead()
     }
 }
 
-void PowerService::tick()
+void UartPowerService::tick()
 {
     std::optional<TbotsProto_PowerStatus> power_status = readPowerStatus();
     if (power_status.has_value())
@@ -55,7 +55,7 @@ void PowerService::tick()
     writePowerFrame(createUartFrame(dribbler_command));
 }
 
-std::optional<TbotsProto_PowerStatus> PowerService::readPowerStatus() const
+std::optional<TbotsProto_PowerStatus> UartPowerService::readPowerStatus() const
 {
     std::vector<uint8_t> power_status;
     try
@@ -78,7 +78,7 @@ std::optional<TbotsProto_PowerStatus> PowerService::readPowerStatus() const
     return status_frame.power_msg.power_status;
 }
 
-void PowerService::writePowerFrame(const TbotsProto_PowerFrame& frame) const
+void UartPowerService::writePowerFrame(const TbotsProto_PowerFrame& frame) const
 {
     try
     {
@@ -95,8 +95,8 @@ void PowerService::writePowerFrame(const TbotsProto_PowerFrame& frame) const
     }
 }
 
-void PowerService::poll(const TbotsProto::DirectControlPrimitive& primitive,
-                        TbotsProto::RobotStatus& robot_status)
+void UartPowerService::poll(const TbotsProto::DirectControlPrimitive& primitive,
+                            TbotsProto::RobotStatus& robot_status)
 {
     power_pulse_command_ = createNanoPbPowerPulseControl(
         primitive.power_control(), kick_coefficient_, kick_constant_, chip_constant_);
@@ -13,7 +13,29 @@ extern "C"
 #include "proto/power_frame_msg.pb.h"
 }
 
+/**
+ * A service that interacts with the power board.
+ */
 class PowerService
+{
+   public:
+    virtual ~PowerService() = default;
+
+    /**
+     * Polls the power service to execute the given DirectControlPrimitive and update
+     * the current power status.
+     *
+     * @param primitive DirectControlPrimitive to execute
+     * @param robot_status RobotStatus message to modify with the current power status
+     */
+    virtual void poll(const TbotsProto::DirectControlPrimitive& primitive,
+                      TbotsProto::RobotStatus& robot_status) = 0;
+};
+
+/**
+ * A PowerService that talks to the power board over UART
+ */
+class UartPowerService : public PowerService
 {
    public:
     /**
@@ -24,18 +46,12 @@ class PowerService
      * @param kick_constant The constant used in kick speed to pulse width conversion
      * @param chip_constant The constant used in chip distance to pulse width conversion
      */
-    explicit PowerService(double kick_coefficient, int kick_constant, int chip_constant);
-    ~PowerService();
+    explicit UartPowerService(double kick_coefficient, int kick_constant,
+                              int chip_constant);
+    ~UartPowerService() override;
 
-    /**
-     * Polls the power service to execute the given DirectControlPrimitive and update
-     * the current power status.
-     *
-     * @param primitive DirectControlPrimitive to execute
-     * @param robot_status RobotStatus message to modify with the current power status
-     */
     void poll(const TbotsProto::DirectControlPrimitive& primitive,
-              TbotsProto::RobotStatus& robot_status);
+              TbotsProto::RobotStatus& robot_status) override;
 
     /**
      * Handler method called every time the timer expires a new read is requested
@@ -0,0 +1,48 @@
+#include "software/embedded/spi/fake_spi_bus.h"
+
+#include <thread>
+
+#include "software/logger/logger.h"
+
+FakeSpiBus::FakeSpiBus(std::vector<std::shared_ptr<FakeSpiDevice>> devices,
+                       const std::chrono::nanoseconds submission_latency,
+                       const uint32_t speed_hz)
+    : devices_(std::move(devices)),
+      submission_latency_(submission_latency),
+      speed_hz_(speed_hz),
+      num_submissions_(0),
+      num_transfers_(0)
+{
+}
+
+void FakeSpiBus::transfer(const std::span<const SpiTransfer> transfers)
+{
+    uint64_t num_bits = 0;
+    for (const SpiTransfer& transfer : transfers)
+    {
+        CHECK(transfer.device < devices_.size())
+            << "SPI transfer to unknown device: " << transfer.device;
+
+        devices_[transfer.device]->transfer(
+            std::span<const uint8_t>(transfer.tx, transfer.len),
+            std::span<uint8_t>(transfer.rx, transfer.len));
+        num_bits += transfer.len * 8;
+    }
+
+    std::this_thread::sleep_for(submission_latency_ +
+                                std::chrono::nanoseconds(num_bits * 1'000'000'000 /
+                                                         speed_hz_));
+
+    num_transfers_ += transfers.size();
+    num_submissions_++;
+}
+
+std::size_t FakeSpiBus::getNumSubmissions() const
+{
+    return num_submissions_;
+}
+
+std::size_t FakeSpiBus::getNumTransfers() const
+{
+    return num_transfers_;
+}
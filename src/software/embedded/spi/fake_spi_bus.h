@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "software/embedded/spi/spi_bus.h"
+
+/**
+ * A fake device on a FakeSpiBus
+ */
+class FakeSpiDevice
+{
+   public:
+    virtual ~FakeSpiDevice() = default;
+
+    /**
+     * Runs a full-duplex transfer with the device
+     *
+     * @param tx The bytes sent to the device
+     * @param rx The buffer to fill with the bytes the device sends back, which is the
+     * same length as tx
+     */
+    virtual void transfer(std::span<const uint8_t> tx, std::span<uint8_t> rx) = 0;
+};
+
+/**
+ * A SPI bus of fake devices that runs in memory, so that code that talks to devices
+ * over SPI can be tested without the hardware.
+ *
+ * Transfers take about as long as they would on a real bus, so that tests can check
+ * that slow SPI doesn't hold up the code using it.
+ */
+class FakeSpiBus : public SpiBus
+{
+   public:
+    /**
+     * Creates a FakeSpiBus
+     *
+     * @param devices The device behind each chip select, indexed by the device number
+     * used in transfers
+     * @param submission_latency How long each submission takes on top of clocking out
+     * its bytes, e.g. for the syscall and scheduling the controller
+     * @param speed_hz The clock speed of the bus
+     */
+    FakeSpiBus(std::vector<std::shared_ptr<FakeSpiDevice>> devices,
+               std::chrono::nanoseconds submission_latency, uint32_t speed_hz);
+
+    void transfer(std::span<const SpiTransfer> transfers) override;
+
+    /**
+     * Gets the number of batches of transfers submitted to the bus
+     *
+     * @return the number of submissions
+     */
+    std::size_t getNumSubmissions() const;
+
+    /**
+     * Gets the number of transfers run on the bus
+     *
+     * @return the number of transfers
+     */
+    std::size_t getNumTransfers() const;
+
+   private:
+    std::vector<std::shared_ptr<FakeSpiDevice>> devices_;
+    std::chrono::nanoseconds submission_latency_;
+    uint32_t speed_hz_;
+
+    std::atomic<std::size_t> num_submissions_;
+    std::atomic<std::size_t> num_transfers_;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+/**
+ * A full-duplex transfer with one device on a SPI bus
+ */
+struct SpiTransfer
+{
+    // The device on the bus to transfer with, i.e. which chip select to assert
+    unsigned int device;
+
+    // The bytes to send
+    const uint8_t* tx;
+
+    // The buffer to receive into, which must be able to hold len bytes
+    uint8_t* rx;
+
+    // The number of bytes to send and receive
+    uint32_t len;
+};
+
+/**
+ * An abstract interface for a SPI bus, so that code that talks to devices over SPI
+ * can be run against fake devices off the robot
+ */
+class SpiBus
+{
+   public:
+    virtual ~SpiBus() = default;
+
+    /**
+     * Runs a batch of transfers in order, and returns once all of them are done.
+     *
+     * The batch is submitted to the bus together rather than one transfer at a time,
+     * and each transfer is its own chip select assertion.
+     *
+     * @param transfers The transfers to run
+     */
+    virtual void transfer(std::span<const SpiTransfer> transfers) = 0;
+};
@@ -0,0 +1,87 @@
+#include "software/embedded/spi/spidev_bus.h"
+
+#include <fcntl.h>
+#include <linux/ioctl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "software/logger/logger.h"
+
+SpidevBus::SpidevBus(const std::vector<std::string>& device_paths, const uint32_t mode,
+                     const uint8_t bits_per_word, const uint32_t max_speed_hz,
+                     const uint32_t speed_hz)
+    : bits_per_word_(bits_per_word), speed_hz_(speed_hz)
+{
+    for (const std::string& device_path : device_paths)
+    {
+        const int fd = open(device_path.c_str(), O_RDWR);
+        CHECK(fd >= 0) << "can't open device: " << device_path
+                       << " error: " << strerror(errno);
+
+        int ret = ioctl(fd, SPI_IOC_WR_MODE32, &mode);
+        CHECK(ret != -1) << "can't set spi mode for: " << device_path
+                         << " error: " << strerror(errno);
+
+        ret = ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits_per_word);
+        CHECK(ret != -1) << "can't set bits_per_word for: " << device_path
+                         << " error: " << strerror(errno);
+
+        ret = ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &max_speed_hz);
+        CHECK(ret != -1) << "can't set spi max speed hz for: " << device_path
+                         << " error: " << strerror(errno);
+
+        fds_.push_back(fd);
+    }
+
+    ioc_transfers_.reserve(device_paths.size());
+}
+
+SpidevBus::~SpidevBus()
+{
+    for (const int fd : fds_)
+    {
+        close(fd);
+    }
+}
+
+void SpidevBus::transfer(const std::span<const SpiTransfer> transfers)
+{
+    std::size_t start = 0;
+    while (start < transfers.size())
+    {
+        const unsigned int device = transfers[start].device;
+        CHECK(device < fds_.size()) << "SPI transfer to unknown device: " << device;
+
+        // Batch the run of consecutive transfers to the same device into one message
+        ioc_transfers_.clear();
+        std::size_t end = start;
+        for (; end < transfers.size() && transfers[end].device == device; ++end)
+        {
+            const SpiTransfer& transfer = transfers[end];
+
+            spi_ioc_transfer ioc_transfer{};
+            ioc_transfer.tx_buf        = reinterpret_cast<unsigned long>(transfer.tx);
+            ioc_transfer.rx_buf        = reinterpret_cast<unsigned long>(transfer.rx);
+            ioc_transfer.len           = transfer.len;
+            ioc_transfer.speed_hz      = speed_hz_;
+            ioc_transfer.bits_per_word = bits_per_word_;
+
+            // Deassert chip select between transfers, as if each was its own message
+            ioc_transfer.cs_change = 1;
+
+            ioc_transfers_.push_back(ioc_transfer);
+        }
+        ioc_transfers_.back().cs_change = 0;
+
+        // SPI_IOC_MESSAGE(n) needs n to be a constant, so build the request by hand
+        const unsigned long request =
+            _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, SPI_MSGSIZE(ioc_transfers_.size()));
+        const int ret = ioctl(fds_[device], request, ioc_transfers_.data());
+        CHECK(ret >= 1) << "SPI Transfer to device " << device
+                        << " failed, not safe to proceed: errno " << strerror(errno);
+
+        start = end;
+    }
+}
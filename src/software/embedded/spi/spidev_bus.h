@@ -0,0 +1,48 @@
+#pragma once
+
+#include <linux/spi/spidev.h>
+
+#include <string>
+#include <vector>
+
+#include "software/embedded/spi/spi_bus.h"
+
+/**
+ * A SPI bus whose devices are accessed through the Linux spidev interface
+ * (https://www.kernel.org/doc/html/latest/spi/spidev.html)
+ *
+ * spidev exposes each chip select as its own device file, so a batch of transfers is
+ * submitted as one SPI_IOC_MESSAGE per run of consecutive transfers with the same
+ * device, instead of one ioctl per transfer.
+ */
+class SpidevBus : public SpiBus
+{
+   public:
+    /**
+     * Opens and configures the spidev device of every chip select on the bus
+     *
+     * @param device_paths The path of the spidev device of each chip select, indexed by
+     * the device number used in transfers
+     * @param mode The SPI mode of the devices
+     * @param bits_per_word The number of bits per word of the devices
+     * @param max_speed_hz The maximum clock speed of the devices
+     * @param speed_hz The clock speed to run transfers at
+     */
+    SpidevBus(const std::vector<std::string>& device_paths, uint32_t mode,
+              uint8_t bits_per_word, uint32_t max_speed_hz, uint32_t speed_hz);
+
+    /**
+     * Closes the spidev devices
+     */
+    ~SpidevBus() override;
+
+    void transfer(std::span<const SpiTransfer> transfers) override;
+
+   private:
+    std::vector<int> fds_;
+    uint8_t bits_per_word_;
+    uint32_t speed_hz_;
+
+    // Reused by every submission so that transferring doesn't allocate
+    std::vector<spi_ioc_transfer> ioc_transfers_;
+};
@@ -21,13 +21,6 @@
 #include "software/util/scoped_timespec_timer/scoped_timespec_timer.h"
 #include "software/world/robot_state.h"
 
-/**
- * https://web.archive.org/web/20210308013218/https://rt.wiki.kernel.org/index.php/Squarewave-example
- * using clock_nanosleep of librt
- */
-extern int clock_nanosleep(clockid_t __clock_id, int __flags,
-                           __const struct timespec* __req, struct timespec* __rem);
-
 // signal handling is done by csignal which requires a function pointer with C linkage
 extern "C"
 {
@@ -72,20 +65,37 @@ extern "C"
     }
 }
 
+/**
+ * Creates the config of the robot localizer from the robot constants
+ *
+ * @param robot_constants The robot constants
+ *
+ * @return the config of the robot localizer
+ */
+static RobotLocalizer::RobotLocalizerConfig createRobotLocalizerConfig(
+    const robot_constants::RobotConstants& robot_constants)
+{
+    return RobotLocalizer::RobotLocalizerConfig{
+        robot_constants.kalman_process_noise_variance_rad_per_s_4,
+        robot_constants.kalman_vision_noise_variance_rad_2,
+        robot_constants.kalman_motor_sensor_noise_variance_rad_per_s_2};
+}
+
 Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
-                         bool enable_log_merging, const int loop_hz)
+                         bool enable_log_merging, const int loop_hz,
+                         const RealtimeExecutorConfig& realtime_config)
     : toml_config_client_(std::make_unique<TomlConfigClient>(TOML_CONFIG_FILE_PATH)),
+      stop_primitive_(*createStopPrimitiveProto()),
+      primitive_timed_out_(false),
       robot_constants_(robot_constants),
       robot_id_(std::stoi(toml_config_client_->get(ROBOT_ID_CONFIG_KEY))),
       channel_id_(
           std::stoi(toml_config_client_->get(ROBOT_MULTICAST_CHANNEL_CONFIG_KEY))),
       network_interface_(toml_config_client_->get(ROBOT_NETWORK_INTERFACE_CONFIG_KEY)),
       loop_hz_(loop_hz),
+      realtime_executor_(loop_hz, realtime_config),
       primitive_executor_(robot_constants),
-      robot_localizer_(RobotLocalizer::RobotLocalizerConfig{
-          robot_constants.kalman_process_noise_variance_rad_per_s_4,
-          robot_constants.kalman_vision_noise_variance_rad_2,
-          robot_constants.kalman_motor_sensor_noise_variance_rad_per_s_2})
+      robot_localizer_(createRobotLocalizerConfig(robot_constants))
 {
     waitForNetworkUp();
 
@@ -110,15 +120,16 @@ Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
     LOG(INFO)
         << "THUNDERLOOP: Network Logger initialized! Next initializing Network Service";
 
-    network_service_ = std::make_unique<NetworkService>(
+    network_service_ = std::make_unique<UdpNetworkService>(
         robot_id, std::string(ROBOT_MULTICAST_CHANNELS.at(channel_id_)), PRIMITIVE_PORT,
-        ROBOT_STATUS_PORT, FULL_SYSTEM_TO_ROBOT_IP_NOTIFICATION_PORT,
+        COMPACT_PRIMITIVE_SET_PORT, ROBOT_STATUS_PORT,
+        FULL_SYSTEM_TO_ROBOT_IP_NOTIFICATION_PORT,
         ROBOT_TO_FULL_SYSTEM_IP_NOTIFICATION_PORT, ROBOT_LOGS_PORT, network_interface);
     LOG(INFO)
         << "THUNDERLOOP: Network Service initialized! Next initializing Power Service";
 
 #ifndef DISABLE_POWER_SERVICE
-    power_service_ = std::make_unique<PowerService>(
+    power_service_ = std::make_unique<UartPowerService>(
         std::stod(toml_config_client_->get(ROBOT_KICK_EXP_COEFF_CONFIG_KEY)),
         std::stoi(toml_config_client_->get(ROBOT_KICK_CONSTANT_CONFIG_KEY)),
         std::stoi(toml_config_client_->get(ROBOT_CHIP_PULSE_WIDTH_CONFIG_KEY)));
@@ -129,7 +140,7 @@ Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
 #endif
 
 #ifndef DISABLE_MOTOR_SERVICE
-    motor_service_  = std::make_unique<MotorService>(robot_constants);
+    motor_service_  = std::make_unique<MotorBoardService>(robot_constants);
     g_motor_service = motor_service_.get();
     motor_service_->setup();
 
@@ -138,7 +149,7 @@ Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
     LOG(INFO) << "THUNDERLOOP: Motor Service DISABLED! Next initializing IMU Service";
 #endif
 
-    imu_service_ = std::make_unique<ImuService>();
+    imu_service_ = std::make_unique<I2cImuService>();
 
     LOG(INFO) << "THUNDERLOOP: finished initialization with ROBOT ID: " << robot_id_
               << ", CHANNEL ID: " << channel_id_
@@ -147,6 +158,34 @@ Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
         << "THUNDERLOOP: to update Thunderloop configuration, edit TOML config file and restart Thunderloop";
 }
 
+Thunderloop::Thunderloop(const robot_constants::RobotConstants& robot_constants,
+                         const int robot_id, const int loop_hz,
+                         std::unique_ptr<NetworkService> network_service,
+                         std::unique_ptr<PowerService> power_service,
+                         std::unique_ptr<MotorService> motor_service,
+                         std::unique_ptr<ImuService> imu_service,
+                         const RealtimeExecutorConfig& realtime_config)
+    : motor_service_(std::move(motor_service)),
+      network_service_(std::move(network_service)),
+      power_service_(std::move(power_service)),
+      imu_service_(std::move(imu_service)),
+      stop_primitive_(*createStopPrimitiveProto()),
+      primitive_timed_out_(false),
+      robot_constants_(robot_constants),
+      robot_id_(robot_id),
+      channel_id_(0),
+      loop_hz_(loop_hz),
+      realtime_executor_(loop_hz, realtime_config),
+      primitive_executor_(robot_constants),
+      robot_localizer_(createRobotLocalizerConfig(robot_constants))
+{
+    // Start the loop timing state here too, so that iterations can be run without
+    // runLoop
+    clock_gettime(CLOCK_MONOTONIC, &last_primitive_received_time_);
+    clock_gettime(CLOCK_MONOTONIC, &last_chipper_fired_);
+    clock_gettime(CLOCK_MONOTONIC, &last_kicker_fired_);
+}
+
 Thunderloop::~Thunderloop() {}
 
 /*
@@ -159,26 +198,15 @@ Thunderloop::~Thunderloop() {}
  */
 void Thunderloop::runLoop()
 {
-    // Timing local to the loop. Cross-iteration timing state lives in members
-    // (last_primitive_received_time_, last_chipper_fired_, last_kicker_fired_) so the
-    // stage helpers can read and update it without threading it through their signatures.
-    struct timespec next_shot;
-    struct timespec iteration_time;
-    struct timespec current_time;
-    struct timespec prev_iter_start_time;
-
-    // Loop interval
-    int interval =
-        static_cast<int>(1.0f / static_cast<float>(loop_hz_) * NANOSECONDS_PER_SECOND);
-
-    // Get current time
+    // Cross-iteration timing state lives in members (last_primitive_received_time_,
+    // last_chipper_fired_, last_kicker_fired_) so the stage helpers can read and update
+    // it without threading it through their signatures.
+    //
     // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since
     // CLOCK_REALTIME can jump backwards
-    clock_gettime(CLOCK_MONOTONIC, &next_shot);
     clock_gettime(CLOCK_MONOTONIC, &last_primitive_received_time_);
     clock_gettime(CLOCK_MONOTONIC, &last_chipper_fired_);
     clock_gettime(CLOCK_MONOTONIC, &last_kicker_fired_);
-    clock_gettime(CLOCK_MONOTONIC, &prev_iter_start_time);
 
     // Initial version setup
     std::string thunderloop_hash, thunderloop_date_flashed;
@@ -194,72 +222,147 @@ void Thunderloop::runLoop()
     *(robot_status_.mutable_motor_status()) = TbotsProto::MotorStatus();
     *(robot_status_.mutable_power_status()) = TbotsProto::PowerStatus();
 
-    for (;;)
-    {
-        struct timespec time_since_prev_iter;
-        clock_gettime(CLOCK_MONOTONIC, &current_time);
-        ScopedTimespecTimer::timespecDiff(&current_time, &prev_iter_start_time,
-                                          &time_since_prev_iter);
-        prev_iter_start_time = current_time;
-        {
-            // Wait until next shot
-            //
-            // Note: CLOCK_MONOTONIC is used over CLOCK_REALTIME since
-            // CLOCK_REALTIME can jump backwards
-            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_shot, NULL);
+    const RealtimeSetupResult setup_result = realtime_executor_.setupRealtimeThread();
+    TbotsProto::ThunderloopTimingStats& timing_stats =
+        *robot_status_.mutable_thunderloop_status()->mutable_timing_stats();
+    timing_stats.set_cpu_pinned(setup_result.cpu_pinned);
+    timing_stats.set_memory_locked(setup_result.memory_locked);
+    timing_stats.set_realtime_scheduling(setup_result.realtime_scheduling);
 
-            FrameMarkStart(TracyConstants::THUNDERLOOP_FRAME_MARKER);
+    realtime_executor_.runForever([this](const RealtimeIterationInfo& info)
+                                  { runIteration(info); });
+}
 
-            ScopedTimespecTimer iteration_timer(&iteration_time);
+void Thunderloop::runIteration(const RealtimeIterationInfo& info)
+{
+    struct timespec iteration_time;
+
+    {
+        FrameMarkStart(TracyConstants::THUNDERLOOP_FRAME_MARKER);
 
-            const Duration delta_time = Duration::fromSeconds(
-                getMilliseconds(time_since_prev_iter) * SECONDS_PER_MILLISECOND);
+        ScopedTimespecTimer iteration_timer(&iteration_time);
 
-            // Network Service: receive newest primitives and send out the last
-            // robot status
-            const NetworkPollResult network_result = pollNetwork();
+        const Duration delta_time = Duration::fromSeconds(
+            getMilliseconds(info.time_since_prev_iteration) * SECONDS_PER_MILLISECOND);
 
-            // Robot Localizer: fuse sensor measurements into a robot state estimate
-            // and hand it to the primitive executor
+        // Network Service: receive newest primitives and send out the last
+        // robot status
+        const NetworkPollResult network_result = pollNetwork();
+        stage_histograms_.network_service_poll.recordMilliseconds(
+            network_result.poll_time_ms);
+
+        // Robot Localizer: fuse sensor measurements into a robot state estimate
+        // and hand it to the primitive executor
+        struct timespec localization_time;
+        {
+            ScopedTimespecTimer timer(&localization_time);
             primitive_executor_.updateState(updateLocalization());
+        }
+        stage_histograms_.localization.recordMilliseconds(
+            getMilliseconds(localization_time));
 
-            // Primitive Executor: run the last primitive if we have not timed out,
-            // producing the control command for this iteration
-            const PrimitiveStepResult primitive_result = stepActivePrimitive(delta_time);
+        // Primitive Executor: run the last primitive if we have not timed out,
+        // producing the control command for this iteration
+        const PrimitiveStepResult primitive_result = stepActivePrimitive(delta_time);
+        stage_histograms_.primitive_executor_step.recordMilliseconds(
+            primitive_result.step_time_ms);
 
-            // Chicker: track time since the last kick/chip event
-            const TbotsProto::ChipperKickerStatus chicker_status =
-                trackChicker(primitive_result.direct_control);
+        // Chicker: track time since the last kick/chip event
+        const TbotsProto::ChipperKickerStatus chicker_status =
+            trackChicker(direct_control_);
 
-            std::optional<double> motor_poll_time_ms;
-            std::optional<double> power_poll_time_ms;
+        std::optional<double> motor_poll_time_ms;
+        std::optional<double> power_poll_time_ms;
 
 #ifndef DISABLE_MOTOR_SERVICE
-            // Motor Service: execute the motor control command
-            motor_poll_time_ms =
-                pollMotorService(primitive_result.direct_control, time_since_prev_iter);
+        // Motor Service: execute the motor control command
+        motor_poll_time_ms = pollMotorService(direct_control_,
+                                              info.time_since_prev_iteration);
+        stage_histograms_.motor_service_poll.recordMilliseconds(
+            motor_poll_time_ms.value());
 #endif
 
 #ifndef DISABLE_POWER_SERVICE
-            // Power Service: execute the power control command
-            power_poll_time_ms = pollPowerService(primitive_result.direct_control);
+        // Power Service: execute the power control command
+        power_poll_time_ms = pollPowerService(direct_control_);
+        stage_histograms_.power_service_poll.recordMilliseconds(
+            power_poll_time_ms.value());
 #endif
 
-            // Robot Status: compose the per-stage results into the outgoing status
-            assembleRobotStatus(network_result, primitive_result, chicker_status,
-                                motor_poll_time_ms, power_poll_time_ms);
-        }
+        updateTimingStats(info.iteration_number);
+
+        // Robot Status: compose the per-stage results into the outgoing status
+        assembleRobotStatus(network_result, primitive_result, chicker_status,
+                            motor_poll_time_ms, power_poll_time_ms);
+    }
 
-        auto loop_duration_ns = getNanoseconds(iteration_time);
-        thunderloop_status_.set_iteration_time_ms(loop_duration_ns /
-                                                  NANOSECONDS_PER_MILLISECOND);
+    auto loop_duration_ns = getNanoseconds(iteration_time);
+    robot_status_.mutable_thunderloop_status()->set_iteration_time_ms(
+        loop_duration_ns / NANOSECONDS_PER_MILLISECOND);
 
-        // Calculate next shot (which is an absolute time)
-        next_shot.tv_nsec += interval;
-        timespecNorm(next_shot);
+    FrameMarkEnd(TracyConstants::THUNDERLOOP_FRAME_MARKER);
+}
+
+/**
+ * Summarizes a latency histogram
+ *
+ * @param histogram The histogram to summarize
+ * @param summary The summary to fill in
+ */
+static void summarizeLatencyHistogram(const LatencyHistogram& histogram,
+                                      TbotsProto::LatencySummary& summary)
+{
+    auto to_ms = [](auto nanoseconds)
+    { return static_cast<double>(nanoseconds) / NANOSECONDS_PER_MILLISECOND; };
+
+    summary.set_count(histogram.getCount());
+    summary.set_mean_ms(to_ms(histogram.getMeanNanoseconds()));
+    summary.set_p50_ms(to_ms(histogram.getPercentileNanoseconds(50)));
+    summary.set_p90_ms(to_ms(histogram.getPercentileNanoseconds(90)));
+    summary.set_p99_ms(to_ms(histogram.getPercentileNanoseconds(99)));
+    summary.set_p999_ms(to_ms(histogram.getPercentileNanoseconds(99.9)));
+    summary.set_max_ms(to_ms(histogram.getMaxNanoseconds()));
+}
 
-        FrameMarkEnd(TracyConstants::THUNDERLOOP_FRAME_MARKER);
+void Thunderloop::updateTimingStats(std::size_t iteration_number)
+{
+    const auto iterations_per_window = static_cast<std::size_t>(
+        std::max(1.0, TIMING_STATS_WINDOW_S * static_cast<double>(loop_hz_)));
+    if ((iteration_number + 1) % iterations_per_window != 0)
+    {
+        return;
     }
+
+    const RealtimeLoopStats& loop_stats = realtime_executor_.getStats();
+    TbotsProto::ThunderloopTimingStats& timing_stats =
+        *robot_status_.mutable_thunderloop_status()->mutable_timing_stats();
+
+    timing_stats.set_window_duration_s(TIMING_STATS_WINDOW_S);
+    summarizeLatencyHistogram(loop_stats.wakeup_latency,
+                              *timing_stats.mutable_wakeup_latency());
+    summarizeLatencyHistogram(loop_stats.period, *timing_stats.mutable_period());
+    summarizeLatencyHistogram(loop_stats.iteration_time,
+                              *timing_stats.mutable_iteration_time());
+    timing_stats.set_num_overruns(loop_stats.num_overruns);
+    timing_stats.set_num_skipped_periods(loop_stats.num_skipped_periods);
+
+    summarizeLatencyHistogram(stage_histograms_.network_service_poll,
+                              *timing_stats.mutable_network_service_poll());
+    summarizeLatencyHistogram(stage_histograms_.localization,
+                              *timing_stats.mutable_localization());
+    summarizeLatencyHistogram(stage_histograms_.primitive_executor_step,
+                              *timing_stats.mutable_primitive_executor_step());
+    summarizeLatencyHistogram(stage_histograms_.motor_service_poll,
+                              *timing_stats.mutable_motor_service_poll());
+    summarizeLatencyHistogram(stage_histograms_.power_service_poll,
+                              *timing_stats.mutable_power_service_poll());
+
+    realtime_executor_.resetStats();
+    stage_histograms_.network_service_poll.reset();
+    stage_histograms_.localization.reset();
+    stage_histograms_.primitive_executor_step.reset();
+    stage_histograms_.motor_service_poll.reset();
+    stage_histograms_.power_service_poll.reset();
 }
 
 inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
@@ -267,7 +370,7 @@ inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
     NetworkPollResult result;
     struct timespec poll_time;
     struct timespec current_time;
-    TbotsProto::Primitive new_primitive;
+    bool new_primitive_received;
 
     // Network Service: receive newest primitives and send out the last robot status
     {
@@ -275,7 +378,7 @@ inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
 
         ZoneNamedN(_tracy_network_poll, "Thunderloop: Poll NetworkService", true);
 
-        new_primitive = network_service_->poll(robot_status_);
+        new_primitive_received = network_service_->poll(robot_status_, primitive_);
     }
 
     result.poll_time_ms = getMilliseconds(poll_time);
@@ -288,14 +391,10 @@ inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
     result.network_status.set_ms_since_last_primitive_received(
         getMilliseconds(time_since_last_primitive_received));
 
-    // If the primitive msg is new, update the internal buffer and start the new
-    // primitive.
-    if (new_primitive.time_sent().epoch_timestamp_seconds() >
-        primitive_.time_sent().epoch_timestamp_seconds())
+    // If the primitive msg is new, start the new primitive. The network service has
+    // already copied it into primitive_.
+    if (new_primitive_received)
     {
-        // Save new primitive
-        primitive_ = new_primitive;
-
         // Feed the trajectory's starting pose to the localizer as a vision update.
         if (primitive_.has_move())
         {
@@ -309,6 +408,7 @@ inline Thunderloop::NetworkPollResult Thunderloop::pollNetwork()
         }
 
         clock_gettime(CLOCK_MONOTONIC, &last_primitive_received_time_);
+        primitive_timed_out_ = false;
 
         // Start new primitive
         struct timespec start_time;
@@ -338,7 +438,7 @@ inline RobotState Thunderloop::updateLocalization()
     // the localizer
     if (robot_status_.has_motor_status())
     {
-        const auto status = robot_status_.motor_status();
+        const auto& status = robot_status_.motor_status();
 
         robot_localizer_.update(RobotLocalizer::MotorData{
             localToGlobalVelocity(createVector(status.local_velocity()),
@@ -386,13 +486,15 @@ inline Thunderloop::PrimitiveStepResult Thunderloop::stepActivePrimitive(
         auto nanoseconds_elapsed_since_last_primitive =
             getNanoseconds(time_since_last_primitive_received);
 
-        if (nanoseconds_elapsed_since_last_primitive > PACKET_TIMEOUT_NS)
+        if (nanoseconds_elapsed_since_last_primitive > PACKET_TIMEOUT_NS &&
+            !primitive_timed_out_)
         {
-            primitive_executor_.updatePrimitive(*createStopPrimitiveProto());
+            primitive_executor_.updatePrimitive(stop_primitive_);
+            primitive_timed_out_ = true;
         }
 
-        result.direct_control =
-            *primitive_executor_.stepPrimitive(result.executor_status, delta_time);
+        primitive_executor_.stepPrimitive(result.executor_status, delta_time,
+                                          direct_control_);
     }
 
     result.step_time_ms = getMilliseconds(poll_time);
@@ -444,20 +546,24 @@ inline void Thunderloop::assembleRobotStatus(
 {
     // Fold the per-stage timing into the sticky telemetry. Fields whose stage did not run
     // this iteration (a new primitive start, a disabled service) keep their last value.
-    thunderloop_status_.set_network_service_poll_time_ms(network.poll_time_ms);
+    // The status is written in place, since copying it in would reallocate its timing
+    // stats every iteration.
+    TbotsProto::ThunderloopStatus& thunderloop_status =
+        *robot_status_.mutable_thunderloop_status();
+    thunderloop_status.set_network_service_poll_time_ms(network.poll_time_ms);
     if (network.primitive_start_time_ms.has_value())
     {
-        thunderloop_status_.set_primitive_executor_start_time_ms(
+        thunderloop_status.set_primitive_executor_start_time_ms(
             network.primitive_start_time_ms.value());
     }
-    thunderloop_status_.set_primitive_executor_step_time_ms(primitive.step_time_ms);
+    thunderloop_status.set_primitive_executor_step_time_ms(primitive.step_time_ms);
     if (motor_poll_time_ms.has_value())
     {
-        thunderloop_status_.set_motor_service_poll_time_ms(motor_poll_time_ms.value());
+        thunderloop_status.set_motor_service_poll_time_ms(motor_poll_time_ms.value());
     }
     if (power_poll_time_ms.has_value())
     {
-        thunderloop_status_.set_power_service_poll_time_ms(power_poll_time_ms.value());
+        thunderloop_status.set_power_service_poll_time_ms(power_poll_time_ms.value());
     }
 
     struct timespec current_time;
@@ -470,7 +576,6 @@ inline void Thunderloop::assembleRobotStatus(
     robot_status_.set_robot_id(robot_id_);
     robot_status_.set_last_handled_primitive_set(primitive_.sequence_number());
     *(robot_status_.mutable_time_sent())                 = time_sent;
-    *(robot_status_.mutable_thunderloop_status())        = thunderloop_status_;
     *(robot_status_.mutable_network_status())            = network.network_status;
     *(robot_status_.mutable_chipper_kicker_status())     = chicker_status;
     *(robot_status_.mutable_primitive_executor_status()) = primitive.executor_status;
@@ -490,15 +595,6 @@ double Thunderloop::getNanoseconds(timespec time)
            static_cast<double>(time.tv_nsec);
 }
 
-void Thunderloop::timespecNorm(struct timespec& ts)
-{
-    while (ts.tv_nsec >= static_cast<int>(NANOSECONDS_PER_SECOND))
-    {
-        ts.tv_nsec -= static_cast<int>(NANOSECONDS_PER_SECOND);
-        ts.tv_sec++;
-    }
-}
-
 double Thunderloop::getCpuTemperature()
 {
     // Get the CPU temperature
@@ -11,6 +11,7 @@
 #include "shared/constants.h"
 #include "shared/robot_constants.h"
 #include "software/embedded/primitive_executor.h"
+#include "software/embedded/realtime/periodic_realtime_executor.h"
 #include "software/embedded/robot_localizer.h"
 #include "software/embedded/services/imu.h"
 #include "software/embedded/services/motor.h"
@@ -50,9 +51,32 @@ class Thunderloop
      * @param robot_constants The robot constants
      * @param enable_log_merging Whether to merge repeated log message or not
      * @param loop_hz The rate to run the loop
+     * @param realtime_config How to set up the loop's thread for real-time use
      */
     Thunderloop(const robot_constants::RobotConstants& robot_constants,
-                bool enable_log_merging, const int loop_hz);
+                bool enable_log_merging, const int loop_hz,
+                const RealtimeExecutorConfig& realtime_config = {});
+
+    /**
+     * Creates a Thunderloop that runs with the given services, instead of connecting to
+     * the robot's hardware and network. The robot's TOML config is not read, and the
+     * network logger and signal handlers are not set up.
+     *
+     * @param robot_constants The robot constants
+     * @param robot_id The id of the robot
+     * @param loop_hz The rate to run the loop
+     * @param network_service The service that communicates with the AI
+     * @param power_service The service that interacts with the power board
+     * @param motor_service The service that interacts with the motors
+     * @param imu_service The service that reads the IMU
+     * @param realtime_config How to set up the loop's thread for real-time use
+     */
+    Thunderloop(const robot_constants::RobotConstants& robot_constants, int robot_id,
+                int loop_hz, std::unique_ptr<NetworkService> network_service,
+                std::unique_ptr<PowerService> power_service,
+                std::unique_ptr<MotorService> motor_service,
+                std::unique_ptr<ImuService> imu_service,
+                const RealtimeExecutorConfig& realtime_config = {});
 
     ~Thunderloop();
 
@@ -68,6 +92,8 @@ class Thunderloop
     std::unique_ptr<TomlConfigClient> toml_config_client_;
 
    private:
+    friend class ThunderloopTest;
+
     struct NetworkPollResult
     {
         TbotsProto::NetworkStatus network_status;
@@ -78,19 +104,24 @@ class Thunderloop
 
     struct PrimitiveStepResult
     {
-        TbotsProto::DirectControlPrimitive direct_control;
         TbotsProto::PrimitiveExecutorStatus executor_status;
         double step_time_ms = 0.0;
     };
 
-    /*
-     * The struct timespec consists of nanoseconds and seconds. If the nanoseconds
-     * are getting bigger than 1000000000 (= 1 second) the variable containing
-     * seconds has to be incremented and the nanoseconds decremented by 1000000000.
+    /**
+     * Runs a single iteration of the loop
+     *
+     * @param info Timing information about the iteration
+     */
+    void runIteration(const RealtimeIterationInfo& info);
+
+    /**
+     * Summarizes the loop and stage timing histograms into robot_status_ once
+     * every TIMING_STATS_WINDOW_S, then starts a new window
      *
-     * @param ts timespec to modify
+     * @param iteration_number The number of iterations run before this one
      */
-    void timespecNorm(struct timespec& ts);
+    void updateTimingStats(std::size_t iteration_number);
 
     /**
      * Get the CPU temp thunderloop is running on
@@ -199,11 +230,18 @@ class Thunderloop
     // The current primitive being executed.
     TbotsProto::Primitive primitive_;
 
+    // The control command produced by the primitive executor this iteration. Kept
+    // across iterations so the executor can write into it without allocating.
+    TbotsProto::DirectControlPrimitive direct_control_;
+
+    // The primitive to run once primitives stop arriving. Built once so that timing
+    // out does not allocate, and only handed to the executor when the timeout starts.
+    const TbotsProto::Primitive stop_primitive_;
+    bool primitive_timed_out_;
+
     // The outgoing robot status.
     TbotsProto::RobotStatus robot_status_;
 
-    TbotsProto::ThunderloopStatus thunderloop_status_;
-
     // Current State
     robot_constants::RobotConstants robot_constants_;
     int robot_id_;
@@ -211,6 +249,20 @@ class Thunderloop
     std::string network_interface_;
     int loop_hz_;
 
+    // Runs the loop at loop_hz_ and records its wake up latency, period and overruns
+    PeriodicRealtimeExecutor realtime_executor_;
+
+    // Timing of each stage of the loop over the current timing stats window
+    struct StageHistograms
+    {
+        LatencyHistogram network_service_poll;
+        LatencyHistogram localization;
+        LatencyHistogram primitive_executor_step;
+        LatencyHistogram motor_service_poll;
+        LatencyHistogram power_service_poll;
+    };
+    StageHistograms stage_histograms_;
+
     // Primitive Executor
     PrimitiveExecutor primitive_executor_;
 
@@ -226,6 +278,9 @@ class Thunderloop
     // 500 millisecond timeout on receiving primitives before we stop the robots
     const double PACKET_TIMEOUT_NS = 500.0 * NANOSECONDS_PER_MILLISECOND;
 
+    // How often the timing histograms are summarized into the robot status
+    const double TIMING_STATS_WINDOW_S = 1.0;
+
     // Timeout after a failed ping request
     const int PING_RETRY_DELAY_S = 1;
 
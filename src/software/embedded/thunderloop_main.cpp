@@ -3,7 +3,6 @@
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/mman.h>      // Needed for mlockall()
 #include <sys/resource.h>  // needed for getrusage
 #include <sys/time.h>      // needed for getrusage
 #include <unistd.h>        // needed for sysconf(int name);
@@ -32,19 +31,13 @@ std::string BANNER =
 
 
 /*
- * Configure malloc for real-time linux
+ * Configure malloc for real-time linux. Pages are locked into RAM by the
+ * PeriodicRealtimeExecutor running Thunderloop.
  *
  * https://rt.wiki.kernel.org/index.php/Dynamic_memory_allocation_example
  */
 static void configureMallocBehaviour(void)
 {
-    // Now lock all current and future pages
-    // from preventing of being paged
-    if (mlockall(MCL_CURRENT | MCL_FUTURE))
-    {
-        perror("mlockall failed:");
-    }
-
     // Turn off malloc trimming.
     mallopt(M_TRIM_THRESHOLD, -1);
 
@@ -91,6 +84,8 @@ int main(int argc, char** argv)
     struct CommandLineArgs
     {
         bool enable_log_merging = true;
+        int cpu_core            = -1;
+        int sched_fifo_priority = 0;
     };
 
     CommandLineArgs args;
@@ -99,6 +94,12 @@ int main(int argc, char** argv)
     desc.add_options()("enable_log_merging",
                        boost::program_options::value<bool>(&args.enable_log_merging),
                        "merging repeated log messages");
+    desc.add_options()("cpu_core", boost::program_options::value<int>(&args.cpu_core),
+                       "CPU core to pin the loop to. Not pinned if negative");
+    desc.add_options()(
+        "sched_fifo_priority",
+        boost::program_options::value<int>(&args.sched_fifo_priority),
+        "SCHED_FIFO priority (1 - 99) to run the loop with. Uses the default scheduler if 0");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -111,8 +112,20 @@ int main(int argc, char** argv)
     const int pre_allocation_size = 20 * 1024 * 1024;
     reserveProcessMemory(pre_allocation_size);
 
-    auto thunderloop = Thunderloop(robot_constants::createRobotConstants(),
-                                   args.enable_log_merging, THUNDERLOOP_HZ);
+    RealtimeExecutorConfig realtime_config;
+    realtime_config.lock_memory = true;
+    if (args.cpu_core >= 0)
+    {
+        realtime_config.cpu_core = args.cpu_core;
+    }
+    if (args.sched_fifo_priority > 0)
+    {
+        realtime_config.sched_fifo_priority = args.sched_fifo_priority;
+    }
+
+    auto thunderloop =
+        Thunderloop(robot_constants::createRobotConstants(), args.enable_log_merging,
+                    THUNDERLOOP_HZ, realtime_config);
     thunderloop.runLoop();
 
     return 0;
@@ -0,0 +1,204 @@
+#include "software/embedded/thunderloop.h"
+
+#include <gtest/gtest.h>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "shared/constants.h"
+#include "software/util/allocation_counter/allocation_counter.h"
+
+/**
+ * A NetworkService that hands Thunderloop a primitive set by the test
+ */
+class FakeNetworkService : public NetworkService
+{
+   public:
+    bool poll(TbotsProto::RobotStatus& robot_status,
+              TbotsProto::Primitive& primitive) override
+    {
+        robot_status.mutable_network_status()->set_primitive_packet_loss_percentage(0);
+
+        if (primitive_to_send.time_sent().epoch_timestamp_seconds() <=
+            primitive.time_sent().epoch_timestamp_seconds())
+        {
+            return false;
+        }
+
+        primitive = primitive_to_send;
+        return true;
+    }
+
+    TbotsProto::Primitive primitive_to_send;
+};
+
+/**
+ * A PowerService that reports a charged battery and capacitor
+ */
+class FakePowerService : public PowerService
+{
+   public:
+    void poll(const TbotsProto::DirectControlPrimitive& primitive,
+              TbotsProto::RobotStatus& robot_status) override
+    {
+        TbotsProto::PowerStatus& power_status = *robot_status.mutable_power_status();
+        power_status.set_battery_voltage(24.0f);
+        power_status.set_capacitor_voltage(200.0f);
+        power_status.set_breakbeam_tripped(false);
+    }
+};
+
+/**
+ * A MotorService that reports the robot moving at a constant velocity
+ */
+class FakeMotorService : public MotorService
+{
+   public:
+    void poll(const TbotsProto::DirectControlPrimitive& primitive,
+              TbotsProto::RobotStatus& robot_status,
+              double time_elapsed_since_last_poll_s) override
+    {
+        TbotsProto::MotorStatus& motor_status = *robot_status.mutable_motor_status();
+        motor_status.mutable_local_velocity()->set_x_component_meters(0.5);
+        motor_status.mutable_local_velocity()->set_y_component_meters(0.0);
+        motor_status.mutable_angular_velocity()->set_radians_per_second(0.1);
+    }
+
+    void setup() override {}
+
+    void reset() override {}
+};
+
+/**
+ * An ImuService that reports the robot turning at a constant rate
+ */
+class FakeImuService : public ImuService
+{
+   public:
+    std::optional<ImuData> poll() override
+    {
+        return ImuData{AngularVelocity::fromRadians(0.1), std::nullopt, std::nullopt};
+    }
+};
+
+class ThunderloopTest : public testing::Test
+{
+   protected:
+    ThunderloopTest()
+    {
+        auto network_service = std::make_unique<FakeNetworkService>();
+        fake_network_service = network_service.get();
+
+        thunderloop = std::make_unique<Thunderloop>(
+            robot_constants::createRobotConstants(), 0, LOOP_HZ,
+            std::move(network_service), std::make_unique<FakePowerService>(),
+            std::make_unique<FakeMotorService>(), std::make_unique<FakeImuService>());
+
+        // Read the kernel log from a file that is always empty, so that the test does
+        // not depend on the machine it runs on
+        thunderloop->log_file = std::ifstream("/dev/null");
+    }
+
+    /**
+     * Creates a Move primitive from the origin to the given destination
+     *
+     * @param destination Where the robot should move to
+     * @param time_sent When the AI sent the primitive, in seconds
+     *
+     * @return the Move primitive
+     */
+    static TbotsProto::Primitive createMovePrimitive(const Point& destination,
+                                                     double time_sent)
+    {
+        TbotsProto::Primitive primitive;
+        TbotsProto::MovePrimitive* move = primitive.mutable_move();
+
+        *(move->mutable_xy_traj_params()->mutable_start_position()) =
+            *createPointProto(Point(0, 0));
+        *(move->mutable_xy_traj_params()->mutable_destination()) =
+            *createPointProto(destination);
+        move->mutable_xy_traj_params()->set_max_speed_mode(
+            TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+        *(move->mutable_w_traj_params()->mutable_start_angle()) =
+            *createAngleProto(Angle::zero());
+        *(move->mutable_w_traj_params()->mutable_final_angle()) =
+            *createAngleProto(Angle::quarter());
+
+        move->set_dribbler_mode(TbotsProto::DribblerMode::OFF);
+        move->mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(3.0f);
+
+        primitive.mutable_time_sent()->set_epoch_timestamp_seconds(time_sent);
+        return primitive;
+    }
+
+    /**
+     * Runs the given number of iterations of the loop
+     *
+     * @param num_iterations The number of iterations to run
+     */
+    void runIterations(int num_iterations)
+    {
+        for (int i = 0; i < num_iterations; i++)
+        {
+            RealtimeIterationInfo info;
+            info.iteration_number                  = iteration_number++;
+            info.time_since_prev_iteration.tv_sec  = 0;
+            info.time_since_prev_iteration.tv_nsec = NANOSECONDS_PER_SECOND / LOOP_HZ;
+            thunderloop->runIteration(info);
+        }
+    }
+
+    /**
+     * Gets the status the robot last sent
+     *
+     * @return the robot status
+     */
+    const TbotsProto::RobotStatus& getRobotStatus() const
+    {
+        return thunderloop->robot_status_;
+    }
+
+    static constexpr int LOOP_HZ = THUNDERLOOP_HZ;
+
+    FakeNetworkService* fake_network_service;
+    std::unique_ptr<Thunderloop> thunderloop;
+    std::size_t iteration_number = 0;
+};
+
+TEST_F(ThunderloopTest, test_runs_primitive_from_network_service)
+{
+    fake_network_service->primitive_to_send = createMovePrimitive(Point(2, 0), 1.0);
+    fake_network_service->primitive_to_send.set_sequence_number(7);
+
+    runIterations(10);
+
+    EXPECT_EQ(getRobotStatus().last_handled_primitive_set(), 7);
+    EXPECT_EQ(getRobotStatus().power_status().battery_voltage(), 24.0f);
+    EXPECT_EQ(getRobotStatus().error_code_size(), 0);
+}
+
+TEST_F(ThunderloopTest, test_steady_state_iteration_does_not_allocate)
+{
+    fake_network_service->primitive_to_send = createMovePrimitive(Point(2, 1), 1.0);
+
+    // Warm up until the robot status has been assembled and the timing stats have been
+    // summarized once, which allocates their sub-messages
+    runIterations(2 * LOOP_HZ);
+
+    ScopedAllocationCounter allocation_counter;
+    runIterations(2 * LOOP_HZ);
+    EXPECT_EQ(allocation_counter.getNumAllocations(), 0);
+}
+
+TEST_F(ThunderloopTest, test_new_primitive_then_steady_state_does_not_allocate)
+{
+    fake_network_service->primitive_to_send = createMovePrimitive(Point(2, 1), 1.0);
+    runIterations(2 * LOOP_HZ);
+
+    // Starting a new primitive may allocate, but running it must not
+    fake_network_service->primitive_to_send = createMovePrimitive(Point(-1, 0), 2.0);
+    runIterations(1);
+
+    ScopedAllocationCounter allocation_counter;
+    runIterations(2 * LOOP_HZ);
+    EXPECT_EQ(allocation_counter.getNumAllocations(), 0);
+}
@@ -7,18 +7,21 @@
 #include "proto/world.pb.h"
 #include "software/constants.h"
 #include "software/logger/logger.h"
-#include "software/networking/unix/threaded_proto_unix_listener.hpp"
-#include "software/networking/unix/threaded_proto_unix_sender.hpp"
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/ipc/threaded_proto_ipc_listener.hpp"
+#include "software/networking/ipc/threaded_proto_ipc_sender.hpp"
 #include "software/simulation/er_force_simulator.h"
 
 int main(int argc, char** argv)
 {
     struct CommandLineArgs
     {
-        bool help               = false;
-        std::string runtime_dir = "/tmp/tbots";
-        std::string division    = "div_b";
-        bool enable_realism     = false;  // realism flag
+        bool help                          = false;
+        std::string runtime_dir            = "/tmp/tbots";
+        std::string division               = "div_b";
+        bool enable_realism                = false;  // realism flag
+        bool throughput_mode               = false;
+        std::string shared_memory_channels = "";
     };
 
     CommandLineArgs args;
@@ -35,6 +38,14 @@ int main(int argc, char** argv)
     desc.add_options()("enable_realism",
                        boost::program_options::bool_switch(&args.enable_realism),
                        "realism simulator");  // install terminal flag
+    desc.add_options()("throughput_mode",
+                       boost::program_options::bool_switch(&args.throughput_mode),
+                       "trade physics fidelity for simulation throughput");
+    desc.add_options()(
+        "shared_memory_channels",
+        boost::program_options::value<std::string>(&args.shared_memory_channels),
+        "Comma-separated list of the channels in the runtime directory that use shared "
+        "memory instead of unix sockets (ex. /blue_world,/ssl_wrapper)");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -47,7 +58,9 @@ int main(int argc, char** argv)
     else
     {
         std::string runtime_dir = args.runtime_dir;
-        LoggerSingleton::initializeLogger(runtime_dir, nullptr);
+        const IpcChannelConfig ipc_channel_config(args.shared_memory_channels);
+        LoggerSingleton::initializeLogger(runtime_dir, nullptr, true, DEBUG,
+                                          ipc_channel_config);
 
         /**
          * Creates a ER force simulator and sets up the appropriate
@@ -85,17 +98,27 @@ int main(int argc, char** argv)
             realism_config = ErForceSimulator::createDefaultRealismConfig();
         }
 
+        camun::simulator::SimulatorFidelity fidelity;
+        if (args.throughput_mode)
+        {
+            fidelity = camun::simulator::SimulatorFidelity::throughput();
+        }
+
         if (args.division == "div_a")
         {
             er_force_sim = std::make_shared<ErForceSimulator>(
                 TbotsProto::FieldType::DIV_A, robot_constants::createRobotConstants(),
-                realism_config);
+                realism_config, false,
+                Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK),
+                fidelity);
         }
         else
         {
             er_force_sim = std::make_shared<ErForceSimulator>(
                 TbotsProto::FieldType::DIV_B, robot_constants::createRobotConstants(),
-                realism_config);
+                realism_config, false,
+                Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK),
+                fidelity);
         }
 
         std::mutex simulator_mutex;
@@ -107,38 +130,45 @@ int main(int argc, char** argv)
         // Outputs
         // SSL Wrapper Output
         auto blue_ssl_wrapper_output =
-            ThreadedProtoUnixSender<SSLProto::SSL_WrapperPacket>(runtime_dir +
-                                                                 BLUE_SSL_WRAPPER_PATH);
+            ThreadedProtoIpcSender<SSLProto::SSL_WrapperPacket>(
+                runtime_dir + BLUE_SSL_WRAPPER_PATH,
+                ipc_channel_config.getTransport(BLUE_SSL_WRAPPER_PATH));
         auto yellow_ssl_wrapper_output =
-            ThreadedProtoUnixSender<SSLProto::SSL_WrapperPacket>(runtime_dir +
-                                                                 YELLOW_SSL_WRAPPER_PATH);
+            ThreadedProtoIpcSender<SSLProto::SSL_WrapperPacket>(
+                runtime_dir + YELLOW_SSL_WRAPPER_PATH,
+                ipc_channel_config.getTransport(YELLOW_SSL_WRAPPER_PATH));
         auto common_ssl_wrapper_output =
-            ThreadedProtoUnixSender<SSLProto::SSL_WrapperPacket>(runtime_dir +
-                                                                 SSL_WRAPPER_PATH);
+            ThreadedProtoIpcSender<SSLProto::SSL_WrapperPacket>(
+                runtime_dir + SSL_WRAPPER_PATH,
+                ipc_channel_config.getTransport(SSL_WRAPPER_PATH));
 
         // Robot Status Outputs
-        auto blue_robot_status_output = ThreadedProtoUnixSender<TbotsProto::RobotStatus>(
-            runtime_dir + BLUE_ROBOT_STATUS_PATH);
-        auto yellow_robot_status_output =
-            ThreadedProtoUnixSender<TbotsProto::RobotStatus>(runtime_dir +
-                                                             YELLOW_ROBOT_STATUS_PATH);
+        auto blue_robot_status_output = ThreadedProtoIpcSender<TbotsProto::RobotStatus>(
+            runtime_dir + BLUE_ROBOT_STATUS_PATH,
+            ipc_channel_config.getTransport(BLUE_ROBOT_STATUS_PATH));
+        auto yellow_robot_status_output = ThreadedProtoIpcSender<TbotsProto::RobotStatus>(
+            runtime_dir + YELLOW_ROBOT_STATUS_PATH,
+            ipc_channel_config.getTransport(YELLOW_ROBOT_STATUS_PATH));
 
         // Simulator State as World State Output
-        auto simulator_state_output = ThreadedProtoUnixSender<world::SimulatorState>(
-            runtime_dir + SIMULATOR_STATE_PATH);
+        auto simulator_state_output = ThreadedProtoIpcSender<world::SimulatorState>(
+            runtime_dir + SIMULATOR_STATE_PATH,
+            ipc_channel_config.getTransport(SIMULATOR_STATE_PATH));
 
 
         // World State Received Trigger as Simulator Output
         auto world_state_received_trigger =
-            ThreadedProtoUnixSender<TbotsProto::WorldStateReceivedTrigger>(
-                runtime_dir + WORLD_STATE_RECEIVED_TRIGGER_PATH);
+            ThreadedProtoIpcSender<TbotsProto::WorldStateReceivedTrigger>(
+                runtime_dir + WORLD_STATE_RECEIVED_TRIGGER_PATH,
+                ipc_channel_config.getTransport(WORLD_STATE_RECEIVED_TRIGGER_PATH));
 
         bool has_sent_world_state_trigger = false;
 
         // Inputs
         // World State Input: Configures the ERForceSimulator
-        auto world_state_input = ThreadedProtoUnixListener<TbotsProto::WorldState>(
+        auto world_state_input = ThreadedProtoIpcListener<TbotsProto::WorldState>(
             runtime_dir + WORLD_STATE_PATH,
+            ipc_channel_config.getTransport(WORLD_STATE_PATH),
             [&](TbotsProto::WorldState input)
             {
                 std::scoped_lock lock(simulator_mutex);
@@ -156,16 +186,18 @@ int main(int argc, char** argv)
 
         // World Input: Buffer vision until we have primitives to tick
         // the simulator with
-        auto blue_world_input = ThreadedProtoUnixListener<TbotsProto::World>(
+        auto blue_world_input = ThreadedProtoIpcListener<TbotsProto::World>(
             runtime_dir + BLUE_WORLD_PATH,
+            ipc_channel_config.getTransport(BLUE_WORLD_PATH),
             [&](TbotsProto::World input)
             {
                 std::scoped_lock lock(simulator_mutex);
                 blue_vision = input;
             });
 
-        auto yellow_world_input = ThreadedProtoUnixListener<TbotsProto::World>(
+        auto yellow_world_input = ThreadedProtoIpcListener<TbotsProto::World>(
             runtime_dir + YELLOW_WORLD_PATH,
+            ipc_channel_config.getTransport(YELLOW_WORLD_PATH),
             [&](TbotsProto::World input)
             {
                 std::scoped_lock lock(simulator_mutex);
@@ -174,8 +206,9 @@ int main(int argc, char** argv)
 
         // PrimitiveSet Input: set the primitive set with cached vision
         auto yellow_primitive_set_input =
-            ThreadedProtoUnixListener<TbotsProto::PrimitiveSet>(
+            ThreadedProtoIpcListener<TbotsProto::PrimitiveSet>(
                 runtime_dir + YELLOW_PRIMITIVE_SET,
+                ipc_channel_config.getTransport(YELLOW_PRIMITIVE_SET),
                 [&](TbotsProto::PrimitiveSet input)
                 {
                     std::scoped_lock lock(simulator_mutex);
@@ -184,8 +217,9 @@ int main(int argc, char** argv)
                 });
 
         auto blue_primitive_set_input =
-            ThreadedProtoUnixListener<TbotsProto::PrimitiveSet>(
+            ThreadedProtoIpcListener<TbotsProto::PrimitiveSet>(
                 runtime_dir + BLUE_PRIMITIVE_SET,
+                ipc_channel_config.getTransport(BLUE_PRIMITIVE_SET),
                 [&](TbotsProto::PrimitiveSet input)
                 {
                     std::scoped_lock lock(simulator_mutex);
@@ -194,8 +228,9 @@ int main(int argc, char** argv)
                 });
 
         // Simulator Tick Input
-        auto simulator_tick = ThreadedProtoUnixListener<TbotsProto::SimulatorTick>(
+        auto simulator_tick = ThreadedProtoIpcListener<TbotsProto::SimulatorTick>(
             runtime_dir + SIMULATION_TICK_PATH,
+            ipc_channel_config.getTransport(SIMULATION_TICK_PATH),
             [&](TbotsProto::SimulatorTick input)
             {
                 std::scoped_lock lock(simulator_mutex);
@@ -4,92 +4,143 @@
 #include <utility>
 
 #include "software/logger/logger.h"
+#include "software/uart/boost_uart_communication.h"
 
-ThreadedEstopReader::ThreadedEstopReader(std::unique_ptr<UartCommunication> uart_reader)
-    : estop_state(EstopState::STOP),
-      timer(io_service, boost::posix_time::milliseconds(INTERVAL_BETWEEN_READS_MS)),
-      uart_reader(std::move(uart_reader))
+ThreadedEstopReader::ThreadedEstopReader(const std::string& uart_port, int baud_rate)
+    : estop_state(EstopState::STOP), serial_port(io_service, uart_port)
 {
-    estop_thread = std::thread(std::bind(&ThreadedEstopReader::continousRead, this));
+    BoostUartCommunication::configureSerialPort(serial_port, baud_rate);
+
+    // Discard anything the estop sent before we started listening, so that the first
+    // state we report is current
+    tcflush(serial_port.native_handle(), UartCommunication::flush_receive);
+
+    startAsyncRead();
+    estop_thread = std::thread([this]() { io_service.run(); });
+}
+
+bool ThreadedEstopReader::isEstopPlay() const
+{
+    return getEstopState() == EstopState::PLAY;
 }
 
-void ThreadedEstopReader::continousRead()
+EstopState ThreadedEstopReader::getEstopState() const
 {
-    timer.async_wait(
-        std::bind(&ThreadedEstopReader::tick, this, boost::asio::placeholders::error));
-    io_service.run();
+    return estop_state.load(std::memory_order_acquire);
 }
 
-bool ThreadedEstopReader::isEstopPlay()
+EstopReaderStatistics ThreadedEstopReader::getStatistics() const
 {
-    return estop_state == EstopState::PLAY;
+    std::scoped_lock lock(statistics_mutex);
+    return statistics;
 }
 
-void ThreadedEstopReader::tick(const boost::system::error_code& error)
+void ThreadedEstopReader::startAsyncRead()
 {
-    if (in_destructor)
+    serial_port.async_read_some(
+        boost::asio::buffer(read_buffer),
+        [this](const boost::system::error_code& error, std::size_t num_bytes_read)
+        { handleRead(error, num_bytes_read); });
+}
+
+void ThreadedEstopReader::handleRead(const boost::system::error_code& error,
+                                     std::size_t num_bytes_read)
+{
+    const auto wakeup_time = std::chrono::steady_clock::now();
+
+    if (in_destructor || error == boost::asio::error::operation_aborted)
     {
-        timer.cancel();
+        return;
     }
-    else
+
+    if (error)
+    {
+        LOG(FATAL)
+            << "crashing system and timing out robots as we have lost connection to ESTOP source : "
+            << error.message();
+    }
+
+    if (num_bytes_read == 0)
     {
-        std::vector<unsigned char> estop_msg;
-        try
+        startAsyncRead();
+        return;
+    }
+
+    // The estop sends its current state over and over, so only the most recent message
+    // matters. Older messages in the buffer are already stale.
+    EstopState new_state;
+    switch (static_cast<int>(read_buffer.at(num_bytes_read - 1)))
+    {
+        case ESTOP_PLAY_MSG:
         {
-            uart_reader->flushSerialPort(uart_reader->flush_receive);
-            estop_msg = uart_reader->serialRead(ESTOP_MESSAGE_SIZE_BYTES);
+            new_state                    = EstopState::PLAY;
+            num_consecutive_status_error = 0;
+            break;
         }
-        catch (const std::exception& e)
+        case ESTOP_STOP_MSG:
         {
-            LOG(FATAL)
-                << "crashing system and timing out robots as we have lost connection to ESTOP source : "
-                << e.what();
+            new_state                    = EstopState::STOP;
+            num_consecutive_status_error = 0;
+            break;
         }
-
-        EstopState new_state;
-
-        switch (static_cast<int>(estop_msg.at(0)))
+        default:
         {
-            case ESTOP_PLAY_MSG:
-            {
-                new_state                    = EstopState::PLAY;
-                num_consecutive_status_error = 0;
-                break;
-            }
-            case ESTOP_STOP_MSG:
-            {
-                new_state                    = EstopState::STOP;
-                num_consecutive_status_error = 0;
-                break;
-            }
-            default:
-            {
-                new_state = EstopState::STATUS_ERROR;
-                LOG(WARNING) << "read unexpected estop message";
-                num_consecutive_status_error++;
-                break;
-            }
+            new_state = EstopState::STATUS_ERROR;
+            LOG(WARNING) << "read unexpected estop message";
+            num_consecutive_status_error++;
+            break;
         }
+    }
 
-        if (new_state != estop_state)
-        {
-            LOG(INFO) << "ESTOP changed from " << estop_state << " to " << new_state;
-            estop_state = new_state;
-        }
+    const EstopState old_state =
+        estop_state.exchange(new_state, std::memory_order_acq_rel);
+    const bool state_changed = old_state != new_state;
+    updateStatistics(wakeup_time, num_bytes_read, state_changed);
 
-        CHECK(num_consecutive_status_error <= MAXIMUM_CONSECUTIVE_STATUS_ERROR)
-            << "ESTOP Consecutive Unexpected messages";
+    if (state_changed)
+    {
+        LOG(INFO) << "ESTOP changed from " << old_state << " to " << new_state;
+    }
 
-        boost::posix_time::milliseconds next_interval(INTERVAL_BETWEEN_READS_MS);
+    CHECK(num_consecutive_status_error <= MAXIMUM_CONSECUTIVE_STATUS_ERROR)
+        << "ESTOP Consecutive Unexpected messages";
 
-        // Reschedule the timer for interval seconds in the future:
-        timer.expires_from_now(next_interval);
-        // Posts the timer event
-        timer.async_wait(std::bind(&ThreadedEstopReader::tick, this,
-                                   boost::asio::placeholders::error));
-    }
+    startAsyncRead();
 }
 
+void ThreadedEstopReader::updateStatistics(
+    const std::chrono::steady_clock::time_point& wakeup_time, std::size_t num_bytes_read,
+    bool state_changed)
+{
+    const auto publish_time = std::chrono::steady_clock::now();
+    const double handler_latency_us =
+        std::chrono::duration<double, std::micro>(publish_time - wakeup_time).count();
+
+    std::scoped_lock lock(statistics_mutex);
+
+    statistics.num_reads++;
+    statistics.num_messages += num_bytes_read;
+    total_handler_latency_us += handler_latency_us;
+    statistics.mean_handler_latency_us =
+        total_handler_latency_us / static_cast<double>(statistics.num_reads);
+    statistics.max_handler_latency_us =
+        std::max(statistics.max_handler_latency_us, handler_latency_us);
+
+    if (last_read_time.has_value())
+    {
+        statistics.max_time_between_reads_ms = std::max(
+            statistics.max_time_between_reads_ms,
+            std::chrono::duration<double, std::milli>(wakeup_time - *last_read_time)
+                .count());
+    }
+    last_read_time = wakeup_time;
+
+    if (state_changed)
+    {
+        statistics.num_state_changes++;
+        statistics.last_state_change_time = publish_time;
+    }
+}
 
 ThreadedEstopReader::~ThreadedEstopReader()
 {
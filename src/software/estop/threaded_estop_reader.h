@@ -1,79 +1,137 @@
 #pragma once
 
-#pragma once
-
-
+#include <array>
+#include <atomic>
 #include <boost/asio.hpp>
-#include <iostream>
+#include <chrono>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
 
 #include "shared/constants.h"
-#include "software/uart/uart_communication.h"
 #include "software/util/make_enum/make_enum.hpp"
 
 // enum that represents the possible states of estop
 MAKE_ENUM(EstopState, PLAY, STOP, STATUS_ERROR);
 
+/**
+ * Statistics on how quickly the ThreadedEstopReader reacts to the estop
+ */
+struct EstopReaderStatistics
+{
+    // number of times the reader was woken up by bytes arriving from the estop
+    unsigned long num_reads = 0;
+
+    // number of estop messages (bytes) received
+    unsigned long num_messages = 0;
+
+    // number of times the estop state changed
+    unsigned long num_state_changes = 0;
+
+    // time from the read handler waking up until the new state is visible to
+    // isEstopPlay. The serial port doesn't timestamp when bytes arrive, so this does not
+    // include the time the bytes waited before the handler ran
+    double mean_handler_latency_us = 0.0;
+    double max_handler_latency_us  = 0.0;
+
+    // longest time between consecutive wake ups. The estop streams its state
+    // continuously, so this bounds how stale the estop state can be
+    double max_time_between_reads_ms = 0.0;
+
+    // when the estop state last changed, used to measure end to end latency from when
+    // the estop was pressed
+    std::optional<std::chrono::steady_clock::time_point> last_state_change_time;
+};
+
 /*
- * class that reads status of estop at periodic intervals of time
+ * class that reads the status of the estop as soon as it is sent over UART
+ *
+ * Rather than polling the UART at a fixed interval, an asynchronous read is always
+ * pending on the serial port so the reader wakes up as soon as bytes arrive. The estop
+ * state is stored atomically and can be read from any thread without locking.
  */
 class ThreadedEstopReader
 {
    public:
     /**
-     * creates and starts a threadedEstopReader with the given parameters to read estop
-     * value every 5 milliseconds
-     * @param uart_reader the UART device acting as source of estop values
+     * creates and starts a ThreadedEstopReader on the given serial device
+     *
+     * @param uart_port the serial device the estop is connected to
+     * @param baud_rate the baud rate the estop sends at
+     * @throws boost::system::system_error if the serial device could not be opened
      */
-    ThreadedEstopReader(std::unique_ptr<UartCommunication> uart_reader);
+    ThreadedEstopReader(const std::string& uart_port, int baud_rate);
     ~ThreadedEstopReader();
 
     /**
      * Returns true if estop is in play state and false otherwise
      */
-    bool isEstopPlay();
+    bool isEstopPlay() const;
 
+    /**
+     * Returns the current state of the estop
+     */
+    EstopState getEstopState() const;
+
+    /**
+     * Returns a snapshot of the statistics on how quickly the estop is read
+     */
+    EstopReaderStatistics getStatistics() const;
 
    private:
-    /*
-     * handler method that is called every time the timer expires and a new read is
-     * requested
+    /**
+     * starts an asynchronous read that completes as soon as any bytes arrive
+     */
+    void startAsyncRead();
+
+    /**
+     * handler called when an asynchronous read completes
+     *
+     * @param error the error that occurred during the read, if any
+     * @param num_bytes_read the number of bytes read into read_buffer
      */
-    void tick(const boost::system::error_code&);
+    void handleRead(const boost::system::error_code& error, std::size_t num_bytes_read);
 
-    /*
-     * method that initiates timer
+    /**
+     * Records the statistics for a read
+     *
+     * @param wakeup_time when the reader was woken up by the read
+     * @param num_bytes_read the number of bytes that were read
+     * @param state_changed whether the estop state changed
      */
-    void continousRead();
+    void updateStatistics(const std::chrono::steady_clock::time_point& wakeup_time,
+                          std::size_t num_bytes_read, bool state_changed);
 
     // In the case where we read an unknown message (not PLAY or STOP) we try again this
     // number of times
     static constexpr unsigned int MAXIMUM_CONSECUTIVE_STATUS_ERROR = 5;
 
-    // time between consecutive reads
-    static constexpr int INTERVAL_BETWEEN_READS_MS = 5;
+    // The estop sends its state continuously, so the read buffer only needs to be large
+    // enough to drain whatever arrived since the last wake up
+    static constexpr std::size_t READ_BUFFER_SIZE_BYTES = 64;
 
-    // thread that will periodically pull values from the buffer
+    // thread that runs the io_service and handles reads
     std::thread estop_thread;
     std::atomic_bool in_destructor = false;
 
     // current state of estop
     std::atomic<EstopState> estop_state;
+    static_assert(std::atomic<EstopState>::is_always_lock_free);
 
     // tracks the number of unknown messages received in a row
     unsigned int num_consecutive_status_error = 0;
 
-    // Time between reads
-    unsigned int regular_read_interval_ms;
-
-
     // boost construct for managing io operations
     boost::asio::io_service io_service;
 
-    // timer that expires after every specified interval of time
-    boost::asio::deadline_timer timer;
+    // the serial port the estop is connected to
+    boost::asio::serial_port serial_port;
+
+    std::array<unsigned char, READ_BUFFER_SIZE_BYTES> read_buffer;
 
-    // the UART device acting as source of estop values
-    std::unique_ptr<UartCommunication> uart_reader;
+    mutable std::mutex statistics_mutex;
+    EstopReaderStatistics statistics;
+    double total_handler_latency_us = 0.0;
+    std::optional<std::chrono::steady_clock::time_point> last_read_time;
 };
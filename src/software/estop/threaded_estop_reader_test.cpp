@@ -1,237 +1,169 @@
 #include "threaded_estop_reader.h"
 
-#include <gmock/gmock.h>
-
-#include "gtest/gtest.h"
-#include "software/uart/mock_uart_communication.h"
-#include "software/uart/uart_communication.h"
-
-using ::testing::_;
-using ::testing::AtLeast;
-using ::testing::InvokeWithoutArgs;
-using ::testing::Return;
-using ::testing::TimeInMillis;
-
-TEST(ThreadedEstopReaderTest, estop_play_is_false_by_default_before_startup)
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+/*
+ * These tests use a pseudo-terminal in place of the Arduino: the reader opens the
+ * slave side as its serial device and the tests write estop messages into the master
+ * side, exactly like the Arduino writing to the USB serial port.
+ */
+class ThreadedEstopReaderTest : public ::testing::Test
 {
-    std::unique_ptr<MockUart> mock_uart = std::make_unique<MockUart>();
-
-    std::vector<unsigned char> ret_val(1, ESTOP_PLAY_MSG);
+   protected:
+    void SetUp() override
+    {
+        pty_master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+        ASSERT_GE(pty_master_fd, 0);
+        ASSERT_EQ(grantpt(pty_master_fd), 0);
+        ASSERT_EQ(unlockpt(pty_master_fd), 0);
+        pty_slave_path = ptsname(pty_master_fd);
+    }
+
+    void TearDown() override
+    {
+        close(pty_master_fd);
+    }
+
+    /**
+     * Writes the given estop messages to the estop reader, as a single write
+     *
+     * @param messages the messages to write
+     */
+    void sendEstopMessages(const std::vector<unsigned char>& messages)
+    {
+        ASSERT_EQ(write(pty_master_fd, messages.data(), messages.size()),
+                  static_cast<ssize_t>(messages.size()));
+    }
+
+    /**
+     * Waits until the estop reader reports the given state
+     *
+     * @param estop_reader the estop reader
+     * @param state the state to wait for
+     *
+     * @return true if the state was reached before the timeout
+     */
+    static bool waitForEstopState(const ThreadedEstopReader& estop_reader,
+                                  EstopState state)
+    {
+        const auto timeout = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+        while (estop_reader.getEstopState() != state)
+        {
+            if (std::chrono::steady_clock::now() > timeout)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    static constexpr std::chrono::milliseconds WAIT_TIMEOUT{1000};
+
+    int pty_master_fd = -1;
+    std::string pty_slave_path;
+};
+
+TEST_F(ThreadedEstopReaderTest, estop_play_is_false_by_default_before_startup)
+{
+    ThreadedEstopReader estop_reader(pty_slave_path, ARDUINO_BAUD_RATE);
 
-    auto mock_uart_ptr = mock_uart.get();
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_)).WillRepeatedly(Return(ret_val));
-    EXPECT_CALL(*mock_uart_ptr, flushSerialPort(_)).WillRepeatedly(Return(true));
+    EXPECT_FALSE(estop_reader.isEstopPlay());
+    EXPECT_EQ(estop_reader.getEstopState(), EstopState::STOP);
+}
 
+TEST_F(ThreadedEstopReaderTest, estop_state_changes_based_on_read_val)
+{
+    ThreadedEstopReader estop_reader(pty_slave_path, ARDUINO_BAUD_RATE);
 
+    sendEstopMessages({ESTOP_PLAY_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::PLAY));
+    EXPECT_TRUE(estop_reader.isEstopPlay());
 
-    ThreadedEstopReader estopReader(std::move(mock_uart));
+    sendEstopMessages({ESTOP_STOP_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::STOP));
+    EXPECT_FALSE(estop_reader.isEstopPlay());
 
-    EXPECT_FALSE(estopReader.isEstopPlay());
+    sendEstopMessages({ESTOP_PLAY_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::PLAY));
+    EXPECT_TRUE(estop_reader.isEstopPlay());
 }
 
-TEST(ThreadedEstopReaderTest, estop_tick_is_called_multiple_times)
+TEST_F(ThreadedEstopReaderTest, estop_play_is_false_after_reading_unexpected_message)
 {
-    std::unique_ptr<MockUart> mock_uart = std::make_unique<MockUart>();
-
-    int test_timeout_ms                 = 100;
     unsigned char arbitrary_garbage_val = 0b10111011;
-    std::vector<unsigned char> play_ret_val(1, ESTOP_PLAY_MSG);
-    std::vector<unsigned char> garbage_ret_val(1, arbitrary_garbage_val);
-    std::vector<unsigned char> stop_ret_val(1, ESTOP_STOP_MSG);
-
-    auto mock_uart_ptr = mock_uart.get();
-
-    std::mutex m;
-    std::unique_lock lock(m);
-    std::condition_variable cv;
-    bool ready = false;
-
-    EXPECT_CALL(*mock_uart_ptr, flushSerialPort(_)).WillRepeatedly(Return(true));
-
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .Times(AtLeast(5))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(testing::DoAll(InvokeWithoutArgs(
-                                     [&cv, &ready]
-                                     {
-                                         ready = true;
-                                         cv.notify_one();
-                                     }),
-                                 Return(play_ret_val)))
-        .WillRepeatedly(Return(play_ret_val));
-
-    ThreadedEstopReader estopReader(std::move(mock_uart));
-    auto now = std::chrono::system_clock::now();
-    EXPECT_TRUE(cv.wait_until(lock, now + std::chrono::milliseconds(test_timeout_ms),
-                              [&ready] { return ready; }));
-}
+    ThreadedEstopReader estop_reader(pty_slave_path, ARDUINO_BAUD_RATE);
 
-TEST(ThreadedEstopReaderTest, estop_state_changes_based_on_read_val)
-{
-    std::unique_ptr<MockUart> mock_uart = std::make_unique<MockUart>();
-
-    std::vector<unsigned char> play_ret_val(1, ESTOP_PLAY_MSG);
-    std::vector<unsigned char> stop_ret_val(1, ESTOP_STOP_MSG);
-
-    int test_timeout_ms     = 1000;
-    int startup_interval_ms = 5;
-    auto mock_uart_ptr      = mock_uart.get();
-
-    std::mutex m;
-    std::unique_lock lock(m);
-    std::condition_variable cv;
-    std::atomic_bool ready;
-
-
-    EXPECT_CALL(*mock_uart_ptr, flushSerialPort(_)).WillRepeatedly(Return(true));
-
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(testing::DoAll(InvokeWithoutArgs(
-                                     [&cv, &ready]
-                                     {
-                                         ready = true;
-                                         cv.notify_one();
-                                     }),
-                                 Return(play_ret_val)))
-        .WillRepeatedly(Return(play_ret_val));
-
-    ThreadedEstopReader estopReader(std::move(mock_uart));
-
-    EXPECT_TRUE(cv.wait_until(
-        lock,
-        std::chrono::system_clock::now() +
-            std::chrono::milliseconds(startup_interval_ms + test_timeout_ms),
-        [&ready] { return ready == true; }));
-    EXPECT_TRUE(estopReader.isEstopPlay());
-
-    // change uart return value to stop
-    ready = false;
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .WillOnce(Return(stop_ret_val))
-        .WillOnce(testing::DoAll(InvokeWithoutArgs(
-                                     [&cv, &ready]
-                                     {
-                                         ready = true;
-                                         cv.notify_one();
-                                     }),
-                                 Return(stop_ret_val)))
-        .WillRepeatedly(Return(stop_ret_val));
-    EXPECT_TRUE(cv.wait_until(
-        lock,
-        std::chrono::system_clock::now() + std::chrono::milliseconds(test_timeout_ms),
-        [&ready] { return ready == true; }));
-    EXPECT_FALSE(estopReader.isEstopPlay());
-
-    // change uart return value back to play
-    ready = false;
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(testing::DoAll(InvokeWithoutArgs(
-                                     [&cv, &ready]
-                                     {
-                                         ready = true;
-                                         cv.notify_one();
-                                     }),
-                                 Return(play_ret_val)))
-        .WillRepeatedly(Return(play_ret_val));
-    EXPECT_TRUE(cv.wait_until(
-        lock,
-        std::chrono::system_clock::now() + std::chrono::milliseconds(test_timeout_ms),
-        [&ready] { return ready == true; }));
-    EXPECT_TRUE(estopReader.isEstopPlay());
+    sendEstopMessages({ESTOP_PLAY_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::PLAY));
+
+    sendEstopMessages({arbitrary_garbage_val});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::STATUS_ERROR));
+    EXPECT_FALSE(estop_reader.isEstopPlay());
+
+    sendEstopMessages({ESTOP_PLAY_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::PLAY));
 }
 
-TEST(ThreadedEstopReaderTest, estop_play_is_false_after_reading_unexpected_message)
+TEST_F(ThreadedEstopReaderTest, most_recent_message_decides_state)
 {
-    std::unique_ptr<MockUart> mock_uart = std::make_unique<MockUart>();
-    auto mock_uart_ptr                  = mock_uart.get();
+    ThreadedEstopReader estop_reader(pty_slave_path, ARDUINO_BAUD_RATE);
 
-    int test_timeout_ms = 1000;
+    sendEstopMessages({ESTOP_PLAY_MSG, ESTOP_PLAY_MSG, ESTOP_STOP_MSG, ESTOP_PLAY_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::PLAY));
 
-    unsigned char arbitrary_garbage_val = 0b10111011;
-    std::vector<unsigned char> play_ret_val(1, ESTOP_PLAY_MSG);
-    std::vector<unsigned char> garbage_ret_val(1, arbitrary_garbage_val);
-
-    std::mutex m;
-    std::unique_lock lock(m);
-    std::condition_variable cv;
-    std::atomic_bool ready;
-
-    EXPECT_CALL(*mock_uart_ptr, flushSerialPort(_)).WillRepeatedly(Return(true));
-
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .Times(AtLeast(3))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(Return(garbage_ret_val))
-        .WillOnce(testing::DoAll(InvokeWithoutArgs(
-                                     [&cv, &ready]
-                                     {
-                                         ready = true;
-                                         cv.notify_one();
-                                     }),
-                                 Return(garbage_ret_val)))
-        .WillOnce(Return(garbage_ret_val))
-        .WillOnce(Return(garbage_ret_val))
-        .WillRepeatedly(Return(play_ret_val));
-
-    int startup_interval_ms = 1;
-
-    ThreadedEstopReader estopReader(std::move(mock_uart));
-
-    EXPECT_TRUE(cv.wait_until(
-        lock,
-        std::chrono::system_clock::now() +
-            std::chrono::milliseconds(startup_interval_ms + test_timeout_ms),
-        [&ready] { return ready == true; }));
-    EXPECT_FALSE(estopReader.isEstopPlay());
+    sendEstopMessages({ESTOP_PLAY_MSG, ESTOP_PLAY_MSG, ESTOP_STOP_MSG});
+    EXPECT_TRUE(waitForEstopState(estop_reader, EstopState::STOP));
 }
 
-TEST(ThreadedEstopReaderTest,
-     estop_play_is_true_after_reading_play_message_following_multiple_unexpected_message)
+TEST_F(ThreadedEstopReaderTest, estop_reaction_latency_is_below_old_poll_interval)
 {
-    std::unique_ptr<MockUart> mock_uart = std::make_unique<MockUart>();
-
-    unsigned char arbitrary_garbage_val = 0b10111011;
-    std::vector<unsigned char> play_ret_val(1, ESTOP_PLAY_MSG);
-    std::vector<unsigned char> garbage_ret_val(1, arbitrary_garbage_val);
-    std::vector<unsigned char> stop_ret_val(1, ESTOP_STOP_MSG);
-    int test_timeout_ms = 1000;
-
-
-    std::mutex m;
-    std::unique_lock lock(m);
-    std::condition_variable cv;
-    std::atomic_bool ready;
-
-    auto mock_uart_ptr = mock_uart.get();
-    EXPECT_CALL(*mock_uart_ptr, flushSerialPort(_)).WillRepeatedly(Return(true));
-
-    EXPECT_CALL(*mock_uart_ptr, serialRead(_))
-        .Times(AtLeast(5))
-        .WillOnce(Return(play_ret_val))
-        .WillOnce(Return(garbage_ret_val))
-        .WillOnce(Return(garbage_ret_val))
-        .WillOnce(Return(play_ret_val))
-        .WillRepeatedly(testing::DoAll(InvokeWithoutArgs(
-                                           [&cv, &ready]
-                                           {
-                                               ready = true;
-                                               cv.notify_one();
-                                           }),
-                                       Return(play_ret_val)));
-
-    int startup_interval_ms = 5;
-
-    ThreadedEstopReader estopReader(std::move(mock_uart));
-
-    EXPECT_TRUE(cv.wait_until(
-        lock,
-        std::chrono::system_clock::now() +
-            std::chrono::milliseconds(startup_interval_ms + test_timeout_ms),
-        [&ready] { return ready == true; }));
-    EXPECT_TRUE(estopReader.isEstopPlay());
+    // The reader used to poll every 5 ms, so an event driven reader should react to a
+    // change well within that in the common case
+    constexpr double OLD_POLL_INTERVAL_MS     = 5.0;
+    constexpr unsigned long NUM_STATE_CHANGES = 50;
+
+    ThreadedEstopReader estop_reader(pty_slave_path, ARDUINO_BAUD_RATE);
+
+    std::vector<double> latencies_ms;
+    for (unsigned long i = 0; i < NUM_STATE_CHANGES; i++)
+    {
+        const bool play      = i % 2 == 0;
+        const auto send_time = std::chrono::steady_clock::now();
+        sendEstopMessages({play ? ESTOP_PLAY_MSG : ESTOP_STOP_MSG});
+        ASSERT_TRUE(waitForEstopState(estop_reader,
+                                      play ? EstopState::PLAY : EstopState::STOP));
+        latencies_ms.push_back(std::chrono::duration<double, std::milli>(
+                                   std::chrono::steady_clock::now() - send_time)
+                                   .count());
+    }
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    const double median_latency_ms = latencies_ms[latencies_ms.size() / 2];
+    RecordProperty("median_reaction_latency_us",
+                   static_cast<int>(median_latency_ms * 1000));
+    RecordProperty("max_reaction_latency_us",
+                   static_cast<int>(latencies_ms.back() * 1000));
+    EXPECT_LT(median_latency_ms, OLD_POLL_INTERVAL_MS);
+
+    // Statistics are recorded just after the new state is published
+    const auto timeout = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    EstopReaderStatistics statistics = estop_reader.getStatistics();
+    while (statistics.num_state_changes < NUM_STATE_CHANGES &&
+           std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::yield();
+        statistics = estop_reader.getStatistics();
+    }
+
+    EXPECT_EQ(statistics.num_state_changes, NUM_STATE_CHANGES);
+    EXPECT_GE(statistics.num_reads, NUM_STATE_CHANGES);
+    EXPECT_EQ(statistics.num_messages, NUM_STATE_CHANGES);
+    EXPECT_GT(statistics.max_handler_latency_us, 0.0);
+    EXPECT_LE(statistics.mean_handler_latency_us, statistics.max_handler_latency_us);
+    EXPECT_TRUE(statistics.last_state_change_time.has_value());
 }
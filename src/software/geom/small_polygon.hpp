@@ -0,0 +1,402 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/point.h"
+#include "software/geom/polygon.h"
+#include "software/geom/segment.h"
+#include "software/geom/value_shapes.h"
+
+/**
+ * A polygon with at most N points, stored inline instead of on the heap. This is the
+ * value type counterpart of Polygon for the small polygons (such as the polygon
+ * obstacles the navigator builds every tick) that are queried in hot loops, and has
+ * the same contains, expand and intersects semantics as Polygon.
+ *
+ * @tparam N The maximum number of points of the polygon
+ */
+template <std::size_t N>
+class SmallPolygon
+{
+   public:
+    /**
+     * Creates a SmallPolygon with no points
+     */
+    SmallPolygon() = default;
+
+    /**
+     * Creates a SmallPolygon from the given points, where each point is connected to
+     * the next point and the last point is connected to the first
+     *
+     * @param points The points of the polygon
+     * @throws std::invalid_argument if there are more than N points
+     */
+    explicit SmallPolygon(const std::initializer_list<Point>& points);
+
+    /**
+     * Creates a SmallPolygon with the same points as the given Polygon
+     *
+     * @param polygon The Polygon to convert
+     * @throws std::invalid_argument if the Polygon has more than N points
+     *
+     * @return the SmallPolygon with the points of the Polygon
+     */
+    static SmallPolygon fromPolygon(const Polygon& polygon);
+
+    /**
+     * Converts this SmallPolygon back to a Polygon
+     *
+     * @return the Polygon with the points of this SmallPolygon
+     */
+    Polygon toPolygon() const;
+
+    /**
+     * Appends a point to the end of the polygon
+     *
+     * @param point The point to append
+     * @throws std::invalid_argument if the polygon already has N points
+     */
+    void addPoint(const Point& point);
+
+    /**
+     * Returns the number of points of the polygon
+     *
+     * @return the number of points of the polygon
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the maximum number of points of the polygon
+     *
+     * @return the maximum number of points of the polygon
+     */
+    static constexpr std::size_t capacity();
+
+    /**
+     * Returns the x coordinate of the point at the given index
+     *
+     * @param index The index of the point
+     *
+     * @return the x coordinate of the point
+     */
+    double x(std::size_t index) const;
+
+    /**
+     * Returns the y coordinate of the point at the given index
+     *
+     * @param index The index of the point
+     *
+     * @return the y coordinate of the point
+     */
+    double y(std::size_t index) const;
+
+    /**
+     * Returns the point at the given index
+     *
+     * @param index The index of the point
+     *
+     * @return the point at the given index
+     */
+    Point getPoint(std::size_t index) const;
+
+    /**
+     * Returns the edge of the polygon from the point at the given index to the next
+     * point, wrapping around to the first point after the last one
+     *
+     * @param index The index of the point the edge starts at
+     *
+     * @return the edge starting at the point at the given index
+     */
+    Segment getSegment(std::size_t index) const;
+
+    /**
+     * Returns the centroid of the polygon, in the same way as Polygon::centroid
+     *
+     * @return the centroid of the polygon
+     */
+    Point centroid() const;
+
+    /**
+     * Returns the polygon expanded in all directions by the expansion_amount, in the
+     * same way as Polygon::expand
+     *
+     * @param expansion_amount The amount to expand the polygon
+     * @throws std::invalid_argument if expansion_amount is negative
+     *
+     * @return the polygon expanded in all directions by the expansion amount
+     */
+    SmallPolygon expand(double expansion_amount) const;
+
+    /**
+     * Returns the axis-aligned box around the polygon
+     *
+     * @return the axis-aligned box around the polygon
+     */
+    Aabb boundingBox() const;
+
+   private:
+    std::array<double, N> xs_ = {};
+    std::array<double, N> ys_ = {};
+    std::size_t size_         = 0;
+};
+
+template <std::size_t N>
+SmallPolygon<N>::SmallPolygon(const std::initializer_list<Point>& points)
+{
+    for (const Point& point : points)
+    {
+        addPoint(point);
+    }
+}
+
+template <std::size_t N>
+SmallPolygon<N> SmallPolygon<N>::fromPolygon(const Polygon& polygon)
+{
+    SmallPolygon<N> small_polygon;
+    for (const Point& point : polygon.getPoints())
+    {
+        small_polygon.addPoint(point);
+    }
+    return small_polygon;
+}
+
+template <std::size_t N>
+Polygon SmallPolygon<N>::toPolygon() const
+{
+    std::vector<Point> points;
+    points.reserve(size_);
+    for (std::size_t i = 0; i < size_; i++)
+    {
+        points.emplace_back(xs_[i], ys_[i]);
+    }
+    return Polygon(points);
+}
+
+template <std::size_t N>
+void SmallPolygon<N>::addPoint(const Point& point)
+{
+    if (size_ == N)
+    {
+        throw std::invalid_argument("SmallPolygon can not hold more than " +
+                                    std::to_string(N) + " points");
+    }
+    xs_[size_] = point.x();
+    ys_[size_] = point.y();
+    size_++;
+}
+
+template <std::size_t N>
+std::size_t SmallPolygon<N>::size() const
+{
+    return size_;
+}
+
+template <std::size_t N>
+constexpr std::size_t SmallPolygon<N>::capacity()
+{
+    return N;
+}
+
+template <std::size_t N>
+double SmallPolygon<N>::x(std::size_t index) const
+{
+    return xs_[index];
+}
+
+template <std::size_t N>
+double SmallPolygon<N>::y(std::size_t index) const
+{
+    return ys_[index];
+}
+
+template <std::size_t N>
+Point SmallPolygon<N>::getPoint(std::size_t index) const
+{
+    return Point(xs_[index], ys_[index]);
+}
+
+template <std::size_t N>
+Segment SmallPolygon<N>::getSegment(std::size_t index) const
+{
+    return Segment(getPoint(index), getPoint((index + 1) % size_));
+}
+
+template <std::size_t N>
+Point SmallPolygon<N>::centroid() const
+{
+    double x_centre    = 0;
+    double y_centre    = 0;
+    double signed_area = 0;
+    for (std::size_t i = 0; i < size_; i++)
+    {
+        const double x0 = xs_[i];
+        const double y0 = ys_[i];
+        const double x1 = xs_[(i + 1) % size_];
+        const double y1 = ys_[(i + 1) % size_];
+        const double a  = (x0 * y1) - (x1 * y0);
+
+        x_centre += (x0 + x1) * a;
+        y_centre += (y0 + y1) * a;
+        signed_area += a;
+    }
+    return Point((Vector(x_centre, y_centre) / (3 * signed_area)));
+}
+
+template <std::size_t N>
+SmallPolygon<N> SmallPolygon<N>::expand(double expansion_amount) const
+{
+    if (expansion_amount < 0)
+    {
+        throw std::invalid_argument(
+            "SmallPolygon::expand: expansion_amount must be non-negative");
+    }
+    const Point centroid_point = centroid();
+    SmallPolygon<N> expanded_polygon;
+
+    // Each point is moved out by the expansions of both of the edges next to it
+    Vector last_expansion =
+        (getSegment(0).midPoint() - centroid_point).normalize(expansion_amount);
+    const Point first_point = getPoint(0) + last_expansion;
+    for (std::size_t i = 1; i < size_; i++)
+    {
+        const Vector current_expansion =
+            (getSegment(i).midPoint() - centroid_point).normalize(expansion_amount);
+        expanded_polygon.addPoint(getPoint(i) + current_expansion + last_expansion);
+        last_expansion = current_expansion;
+    }
+    expanded_polygon.addPoint(first_point + last_expansion);
+    return expanded_polygon;
+}
+
+template <std::size_t N>
+Aabb SmallPolygon<N>::boundingBox() const
+{
+    if (size_ == 0)
+    {
+        return Aabb();
+    }
+    Aabb box{xs_[0], ys_[0], xs_[0], ys_[0]};
+    for (std::size_t i = 1; i < size_; i++)
+    {
+        box.x_min = std::min(box.x_min, xs_[i]);
+        box.y_min = std::min(box.y_min, ys_[i]);
+        box.x_max = std::max(box.x_max, xs_[i]);
+        box.y_max = std::max(box.y_max, ys_[i]);
+    }
+    return box;
+}
+
+/**
+ * Returns true if the polygon contains the point. See contains(Polygon, Point) for how
+ * points on the boundary are treated.
+ *
+ * @param container The polygon that may contain the point
+ * @param contained The point that may be contained
+ *
+ * @return true if the polygon contains the point, false otherwise
+ */
+template <std::size_t N>
+bool contains(const SmallPolygon<N>& container, const Point& contained)
+{
+    const double px         = contained.x();
+    const double py         = contained.y();
+    bool point_is_contained = false;
+    for (std::size_t i = 0, j = container.size() - 1; i < container.size(); j = i++)
+    {
+        const double pix = container.x(i);
+        const double piy = container.y(i);
+        const double pjx = container.x(j);
+        const double pjy = container.y(j);
+        if (((piy > py) != (pjy > py)) &&
+            ((pjy == piy) || (px < (pjx - pix) * (py - piy) / (pjy - piy) + pix)))
+        {
+            point_is_contained = !point_is_contained;
+        }
+    }
+    return point_is_contained;
+}
+
+/**
+ * Finds the shortest distance between the perimeter of a polygon and a point. If the
+ * point is inside the polygon, the distance is negative.
+ *
+ * @param first The polygon
+ * @param second The point
+ *
+ * @return the signed distance between the perimeter of the polygon and the point
+ */
+template <std::size_t N>
+double signedDistance(const SmallPolygon<N>& first, const Point& second)
+{
+    double min_distance_squared = std::numeric_limits<double>::max();
+    for (std::size_t i = 0, j = first.size() - 1; i < first.size(); j = i++)
+    {
+        min_distance_squared = std::min(
+            min_distance_squared,
+            distanceSquaredToSegment(second.x(), second.y(), first.x(i), first.y(i),
+                                     first.x(j), first.y(j)));
+    }
+    const double min_distance = std::sqrt(min_distance_squared);
+    return contains(first, second) ? -min_distance : min_distance;
+}
+template <std::size_t N>
+double signedDistance(const Point& first, const SmallPolygon<N>& second)
+{
+    return signedDistance(second, first);
+}
+
+/**
+ * Finds the shortest distance between a polygon and a point. If the point is inside
+ * the polygon, the distance is 0.
+ *
+ * @param first The polygon
+ * @param second The point
+ *
+ * @return the distance between the polygon and the point
+ */
+template <std::size_t N>
+double distance(const SmallPolygon<N>& first, const Point& second)
+{
+    return std::max(signedDistance(first, second), 0.0);
+}
+template <std::size_t N>
+double distance(const Point& first, const SmallPolygon<N>& second)
+{
+    return distance(second, first);
+}
+
+/**
+ * Returns true if the segment overlaps the polygon, including if it is entirely inside
+ * of it
+ *
+ * @param first The polygon
+ * @param second The segment
+ *
+ * @return true if the segment overlaps the polygon, false otherwise
+ */
+template <std::size_t N>
+bool intersects(const SmallPolygon<N>& first, const Segment& second)
+{
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        if (intersects(first.getSegment(i), second))
+        {
+            return true;
+        }
+    }
+    return contains(first, second.getStart());
+}
+template <std::size_t N>
+bool intersects(const Segment& first, const SmallPolygon<N>& second)
+{
+    return intersects(second, first);
+}
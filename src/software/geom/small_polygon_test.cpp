@@ -0,0 +1,90 @@
+#include "software/geom/small_polygon.hpp"
+
+#include <gtest/gtest.h>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/algorithms/signed_distance.h"
+
+TEST(SmallPolygonTest, test_round_trips_through_polygon)
+{
+    const Polygon polygon({Point(0, 0), Point(2, 0), Point(3, 1), Point(1, 2)});
+    const SmallPolygon<6> small_polygon = SmallPolygon<6>::fromPolygon(polygon);
+
+    EXPECT_EQ(small_polygon.size(), 4);
+    EXPECT_EQ(SmallPolygon<6>::capacity(), 6);
+    EXPECT_EQ(small_polygon.getPoint(2), Point(3, 1));
+    EXPECT_EQ(small_polygon.toPolygon(), polygon);
+}
+
+TEST(SmallPolygonTest, test_too_many_points_throws)
+{
+    const Polygon polygon({Point(0, 0), Point(2, 0), Point(3, 1), Point(1, 2)});
+
+    EXPECT_THROW(SmallPolygon<3>::fromPolygon(polygon), std::invalid_argument);
+    EXPECT_THROW(SmallPolygon<2>({Point(0, 0), Point(1, 0), Point(1, 1)}),
+                 std::invalid_argument);
+}
+
+TEST(SmallPolygonTest, test_bounding_box)
+{
+    const SmallPolygon<4> small_polygon({Point(0, -1), Point(2, 0), Point(-1, 3)});
+    const Aabb box = small_polygon.boundingBox();
+
+    EXPECT_EQ(box.x_min, -1);
+    EXPECT_EQ(box.y_min, -1);
+    EXPECT_EQ(box.x_max, 2);
+    EXPECT_EQ(box.y_max, 3);
+}
+
+TEST(SmallPolygonTest, test_matches_polygon)
+{
+    // A concave polygon, to make sure the crossing rules are the same as Polygon's
+    const Polygon polygon({Point(-2, -1), Point(2, -1), Point(2, 2), Point(0, 0.5),
+                           Point(-2, 2)});
+    const SmallPolygon<8> small_polygon = SmallPolygon<8>::fromPolygon(polygon);
+
+    for (double x = -3; x <= 3; x += 0.25)
+    {
+        for (double y = -2; y <= 3; y += 0.25)
+        {
+            const Point point(x, y);
+            EXPECT_EQ(contains(small_polygon, point), contains(polygon, point)) << point;
+            EXPECT_NEAR(distance(small_polygon, point), distance(polygon, point), 1e-9)
+                << point;
+            EXPECT_NEAR(signedDistance(small_polygon, point),
+                        signedDistance(polygon, point), 1e-9)
+                << point;
+        }
+    }
+}
+
+TEST(SmallPolygonTest, test_expand_matches_polygon)
+{
+    const Polygon polygon({Point(-2, -1), Point(2, -1), Point(2, 2), Point(0, 0.5),
+                           Point(-2, 2)});
+    const SmallPolygon<8> small_polygon = SmallPolygon<8>::fromPolygon(polygon);
+
+    EXPECT_EQ(small_polygon.centroid(), polygon.centroid());
+    EXPECT_EQ(small_polygon.expand(0.3).toPolygon(), polygon.expand(0.3));
+    EXPECT_THROW(small_polygon.expand(-0.1), std::invalid_argument);
+}
+
+TEST(SmallPolygonTest, test_intersects_matches_polygon)
+{
+    const Polygon polygon({Point(-2, -1), Point(2, -1), Point(2, 2), Point(0, 0.5),
+                           Point(-2, 2)});
+    const SmallPolygon<8> small_polygon = SmallPolygon<8>::fromPolygon(polygon);
+
+    for (double x = -3; x <= 3; x += 0.5)
+    {
+        for (double y = -2; y <= 3; y += 0.5)
+        {
+            // Segments that start inside, cross, touch and miss the polygon
+            const Segment segment(Point(x, y), Point(-y, x + 0.25));
+            EXPECT_EQ(intersects(small_polygon, segment), intersects(polygon, segment))
+                << segment.getStart() << " to " << segment.getEnd();
+        }
+    }
+}
@@ -0,0 +1,517 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/geom/segment.h"
+#include "software/geom/stadium.h"
+
+/*
+ * Value types for the shapes that are queried in hot loops (navigation, passing and
+ * evaluation). Unlike Rectangle, Circle and Stadium these are plain structs of doubles
+ * that never allocate, are trivially copyable, and have inline contains, distance,
+ * signedDistance and intersects overloads that the compiler can see through.
+ *
+ * Convert from the existing geom classes once, outside of the loop, and query the
+ * value type inside of it. The conversions only copy coordinates.
+ */
+
+/**
+ * Finds the squared distance from a point to a segment
+ *
+ * @param px The x coordinate of the point
+ * @param py The y coordinate of the point
+ * @param ax The x coordinate of the start of the segment
+ * @param ay The y coordinate of the start of the segment
+ * @param bx The x coordinate of the end of the segment
+ * @param by The y coordinate of the end of the segment
+ *
+ * @return the squared distance from the point to the segment
+ */
+constexpr double distanceSquaredToSegment(double px, double py, double ax, double ay,
+                                          double bx, double by)
+{
+    const double abx     = bx - ax;
+    const double aby     = by - ay;
+    const double apx     = px - ax;
+    const double apy     = py - ay;
+    const double ab_len2 = abx * abx + aby * aby;
+    const double t =
+        ab_len2 > 0 ? std::clamp((apx * abx + apy * aby) / ab_len2, 0.0, 1.0) : 0.0;
+    const double dx = apx - t * abx;
+    const double dy = apy - t * aby;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * An axis-aligned box, stored as its minimum and maximum coordinates
+ */
+struct Aabb
+{
+    double x_min = 0;
+    double y_min = 0;
+    double x_max = 0;
+    double y_max = 0;
+
+    /**
+     * Creates an Aabb from two diagonally-opposite corners
+     *
+     * @param point1 One of the corners
+     * @param point2 The corner diagonally-opposite to point1
+     *
+     * @return the Aabb with the given corners
+     */
+    static Aabb fromCorners(const Point& point1, const Point& point2);
+
+    /**
+     * Creates an Aabb covering the same area as the given Rectangle
+     *
+     * @param rectangle The Rectangle to convert
+     *
+     * @return the Aabb covering the Rectangle
+     */
+    static Aabb fromRectangle(const Rectangle& rectangle);
+
+    /**
+     * Converts this Aabb back to a Rectangle
+     *
+     * @return the Rectangle covering this Aabb
+     */
+    Rectangle toRectangle() const;
+
+    /**
+     * Returns the length along the x-axis of the box
+     *
+     * @return The length along the x-axis of the box
+     */
+    constexpr double xLength() const;
+
+    /**
+     * Returns the length along the y-axis of the box
+     *
+     * @return The length along the y-axis of the box
+     */
+    constexpr double yLength() const;
+
+    /**
+     * Returns the centre of the box
+     *
+     * @return The centre of the box
+     */
+    Point centre() const;
+
+    /**
+     * Returns the box expanded in all directions by the expansion_amount. Unlike
+     * Rectangle::expand, a negative expansion_amount shrinks the box.
+     *
+     * @param expansion_amount How far to move each side of the box outwards
+     *
+     * @return the expanded box
+     */
+    constexpr Aabb expand(double expansion_amount) const;
+};
+
+/**
+ * A circle, stored as the coordinates of its origin and its radius
+ */
+struct CircleShape
+{
+    double x      = 0;
+    double y      = 0;
+    double radius = 0;
+
+    /**
+     * Creates a CircleShape covering the same area as the given Circle
+     *
+     * @param circle The Circle to convert
+     *
+     * @return the CircleShape covering the Circle
+     */
+    static CircleShape fromCircle(const Circle& circle);
+
+    /**
+     * Converts this CircleShape back to a Circle
+     *
+     * @throws std::invalid_argument if the radius is negative
+     *
+     * @return the Circle covering this CircleShape
+     */
+    Circle toCircle() const;
+
+    /**
+     * Returns the origin of the circle
+     *
+     * @return the origin of the circle
+     */
+    Point origin() const;
+};
+
+/**
+ * A capsule (the value type counterpart of Stadium), stored as the coordinates of the
+ * ends of the segment between the centres of its semicircles and its radius
+ */
+struct Capsule
+{
+    double start_x = 0;
+    double start_y = 0;
+    double end_x   = 0;
+    double end_y   = 0;
+    double radius  = 0;
+
+    /**
+     * Creates a Capsule covering the same area as the given Stadium
+     *
+     * @param stadium The Stadium to convert
+     *
+     * @return the Capsule covering the Stadium
+     */
+    static Capsule fromStadium(const Stadium& stadium);
+
+    /**
+     * Converts this Capsule back to a Stadium
+     *
+     * @return the Stadium covering this Capsule
+     */
+    Stadium toStadium() const;
+
+    /**
+     * Finds the squared distance from a point to the segment between the centres of
+     * the semicircles of the capsule
+     *
+     * @param px The x coordinate of the point
+     * @param py The y coordinate of the point
+     *
+     * @return the squared distance from the point to the segment
+     */
+    constexpr double axisDistanceSquared(double px, double py) const;
+};
+
+inline Aabb Aabb::fromCorners(const Point& point1, const Point& point2)
+{
+    return Aabb{std::min(point1.x(), point2.x()), std::min(point1.y(), point2.y()),
+                std::max(point1.x(), point2.x()), std::max(point1.y(), point2.y())};
+}
+
+inline Aabb Aabb::fromRectangle(const Rectangle& rectangle)
+{
+    return Aabb{rectangle.xMin(), rectangle.yMin(), rectangle.xMax(), rectangle.yMax()};
+}
+
+inline Rectangle Aabb::toRectangle() const
+{
+    return Rectangle(Point(x_min, y_min), Point(x_max, y_max));
+}
+
+constexpr double Aabb::xLength() const
+{
+    return x_max - x_min;
+}
+
+constexpr double Aabb::yLength() const
+{
+    return y_max - y_min;
+}
+
+inline Point Aabb::centre() const
+{
+    return Point((x_min + x_max) / 2, (y_min + y_max) / 2);
+}
+
+constexpr Aabb Aabb::expand(double expansion_amount) const
+{
+    return Aabb{x_min - expansion_amount, y_min - expansion_amount,
+                x_max + expansion_amount, y_max + expansion_amount};
+}
+
+inline CircleShape CircleShape::fromCircle(const Circle& circle)
+{
+    return CircleShape{circle.origin().x(), circle.origin().y(), circle.radius()};
+}
+
+inline Circle CircleShape::toCircle() const
+{
+    return Circle(origin(), radius);
+}
+
+inline Point CircleShape::origin() const
+{
+    return Point(x, y);
+}
+
+inline Capsule Capsule::fromStadium(const Stadium& stadium)
+{
+    const Segment& segment = stadium.segment();
+    return Capsule{segment.getStart().x(), segment.getStart().y(), segment.getEnd().x(),
+                   segment.getEnd().y(), stadium.radius()};
+}
+
+inline Stadium Capsule::toStadium() const
+{
+    return Stadium(Point(start_x, start_y), Point(end_x, end_y), radius);
+}
+
+constexpr double Capsule::axisDistanceSquared(double px, double py) const
+{
+    return distanceSquaredToSegment(px, py, start_x, start_y, end_x, end_y);
+}
+
+/**
+ * Returns true if the container contains the given point. Points on the boundary are
+ * contained.
+ *
+ * @param container The shape that may contain the point
+ * @param px The x coordinate of the point
+ * @param py The y coordinate of the point
+ *
+ * @return true if the container contains the point, false otherwise
+ */
+constexpr bool contains(const Aabb& container, double px, double py)
+{
+    return px >= container.x_min && px <= container.x_max && py >= container.y_min &&
+           py <= container.y_max;
+}
+inline bool contains(const Aabb& container, const Point& contained)
+{
+    return contains(container, contained.x(), contained.y());
+}
+constexpr bool contains(const CircleShape& container, double px, double py)
+{
+    const double dx = px - container.x;
+    const double dy = py - container.y;
+    return dx * dx + dy * dy <= container.radius * container.radius;
+}
+inline bool contains(const CircleShape& container, const Point& contained)
+{
+    return contains(container, contained.x(), contained.y());
+}
+constexpr bool contains(const Capsule& container, double px, double py)
+{
+    return container.axisDistanceSquared(px, py) <= container.radius * container.radius;
+}
+inline bool contains(const Capsule& container, const Point& contained)
+{
+    return contains(container, contained.x(), contained.y());
+}
+
+/**
+ * Returns true if the container fully contains the contained box
+ *
+ * @param container The box that may contain the other box
+ * @param contained The box that may be contained
+ *
+ * @return true if the container contains the other box, false otherwise
+ */
+constexpr bool contains(const Aabb& container, const Aabb& contained)
+{
+    return contained.x_min >= container.x_min && contained.x_max <= container.x_max &&
+           contained.y_min >= container.y_min && contained.y_max <= container.y_max;
+}
+
+/**
+ * Finds the shortest distance between the perimeter of a shape and a point. If the
+ * point is inside the shape, the distance is negative.
+ *
+ * @param first The shape
+ * @param second The point
+ *
+ * @return the signed distance between the perimeter of the shape and the point
+ */
+inline double signedDistance(const Aabb& first, const Point& second)
+{
+    const double dx = std::max(first.x_min - second.x(), second.x() - first.x_max);
+    const double dy = std::max(first.y_min - second.y(), second.y() - first.y_max);
+    return std::hypot(std::max(dx, 0.0), std::max(dy, 0.0)) +
+           std::min(std::max(dx, dy), 0.0);
+}
+inline double signedDistance(const Point& first, const Aabb& second)
+{
+    return signedDistance(second, first);
+}
+inline double signedDistance(const CircleShape& first, const Point& second)
+{
+    return std::hypot(second.x() - first.x, second.y() - first.y) - first.radius;
+}
+inline double signedDistance(const Point& first, const CircleShape& second)
+{
+    return signedDistance(second, first);
+}
+inline double signedDistance(const Capsule& first, const Point& second)
+{
+    return std::sqrt(first.axisDistanceSquared(second.x(), second.y())) - first.radius;
+}
+inline double signedDistance(const Point& first, const Capsule& second)
+{
+    return signedDistance(second, first);
+}
+
+/**
+ * Finds the shortest distance between a shape and a point. If the point is inside the
+ * shape, the distance is 0.
+ *
+ * @param first The shape
+ * @param second The point
+ *
+ * @return the distance between the shape and the point
+ */
+inline double distance(const Aabb& first, const Point& second)
+{
+    return std::max(signedDistance(first, second), 0.0);
+}
+inline double distance(const Point& first, const Aabb& second)
+{
+    return distance(second, first);
+}
+inline double distance(const CircleShape& first, const Point& second)
+{
+    return std::max(signedDistance(first, second), 0.0);
+}
+inline double distance(const Point& first, const CircleShape& second)
+{
+    return distance(second, first);
+}
+inline double distance(const Capsule& first, const Point& second)
+{
+    return std::max(signedDistance(first, second), 0.0);
+}
+inline double distance(const Point& first, const Capsule& second)
+{
+    return distance(second, first);
+}
+
+/**
+ * Returns true if the two shapes overlap, including if they only touch
+ *
+ * @param first The first shape
+ * @param second The second shape
+ *
+ * @return true if the shapes overlap, false otherwise
+ */
+constexpr bool intersects(const Aabb& first, const Aabb& second)
+{
+    return first.x_min <= second.x_max && second.x_min <= first.x_max &&
+           first.y_min <= second.y_max && second.y_min <= first.y_max;
+}
+constexpr bool intersects(const CircleShape& first, const CircleShape& second)
+{
+    const double dx         = first.x - second.x;
+    const double dy         = first.y - second.y;
+    const double radius_sum = first.radius + second.radius;
+    return dx * dx + dy * dy <= radius_sum * radius_sum;
+}
+constexpr bool intersects(const Aabb& first, const CircleShape& second)
+{
+    const double dx = second.x - std::clamp(second.x, first.x_min, first.x_max);
+    const double dy = second.y - std::clamp(second.y, first.y_min, first.y_max);
+    return dx * dx + dy * dy <= second.radius * second.radius;
+}
+constexpr bool intersects(const CircleShape& first, const Aabb& second)
+{
+    return intersects(second, first);
+}
+constexpr bool intersects(const Capsule& first, const CircleShape& second)
+{
+    const double radius_sum = first.radius + second.radius;
+    return first.axisDistanceSquared(second.x, second.y) <= radius_sum * radius_sum;
+}
+constexpr bool intersects(const CircleShape& first, const Capsule& second)
+{
+    return intersects(second, first);
+}
+
+/**
+ * Returns true if the segment overlaps the shape, including if it is entirely inside
+ * of it
+ *
+ * @param first The shape
+ * @param second The segment
+ *
+ * @return true if the segment overlaps the shape, false otherwise
+ */
+inline bool intersects(const Aabb& first, const Segment& second)
+{
+    // Clip the segment against the x and y slabs of the box (Liang-Barsky)
+    const double start[2] = {second.getStart().x(), second.getStart().y()};
+    const double end[2]   = {second.getEnd().x(), second.getEnd().y()};
+    const double mins[2]  = {first.x_min, first.y_min};
+    const double maxs[2]  = {first.x_max, first.y_max};
+    double t_enter        = 0;
+    double t_exit         = 1;
+    for (int axis = 0; axis < 2; axis++)
+    {
+        const double delta = end[axis] - start[axis];
+        if (delta == 0)
+        {
+            if (start[axis] < mins[axis] || start[axis] > maxs[axis])
+            {
+                return false;
+            }
+            continue;
+        }
+        double t0 = (mins[axis] - start[axis]) / delta;
+        double t1 = (maxs[axis] - start[axis]) / delta;
+        if (t0 > t1)
+        {
+            std::swap(t0, t1);
+        }
+        t_enter = std::max(t_enter, t0);
+        t_exit  = std::min(t_exit, t1);
+        if (t_enter > t_exit)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+inline bool intersects(const Segment& first, const Aabb& second)
+{
+    return intersects(second, first);
+}
+inline bool intersects(const CircleShape& first, const Segment& second)
+{
+    return distanceSquaredToSegment(first.x, first.y, second.getStart().x(),
+                                     second.getStart().y(), second.getEnd().x(),
+                                     second.getEnd().y()) <=
+           first.radius * first.radius;
+}
+inline bool intersects(const Segment& first, const CircleShape& second)
+{
+    return intersects(second, first);
+}
+inline bool intersects(const Capsule& first, const Segment& second)
+{
+    const double ax = second.getStart().x();
+    const double ay = second.getStart().y();
+    const double bx = second.getEnd().x();
+    const double by = second.getEnd().y();
+
+    // If the segment crosses the axis of the capsule, they are 0 apart. Otherwise the
+    // closest points are at one of the four segment ends.
+    auto cross = [](double ox, double oy, double px, double py, double qx, double qy)
+    { return (px - ox) * (qy - oy) - (py - oy) * (qx - ox); };
+    const bool crosses_axis =
+        cross(first.start_x, first.start_y, first.end_x, first.end_y, ax, ay) *
+                cross(first.start_x, first.start_y, first.end_x, first.end_y, bx, by) <
+            0 &&
+        cross(ax, ay, bx, by, first.start_x, first.start_y) *
+                cross(ax, ay, bx, by, first.end_x, first.end_y) <
+            0;
+    if (crosses_axis)
+    {
+        return true;
+    }
+
+    const double radius_squared = first.radius * first.radius;
+    return first.axisDistanceSquared(ax, ay) <= radius_squared ||
+           first.axisDistanceSquared(bx, by) <= radius_squared ||
+           distanceSquaredToSegment(first.start_x, first.start_y, ax, ay, bx, by) <=
+               radius_squared ||
+           distanceSquaredToSegment(first.end_x, first.end_y, ax, ay, bx, by) <=
+               radius_squared;
+}
+inline bool intersects(const Segment& first, const Capsule& second)
+{
+    return intersects(second, first);
+}
@@ -0,0 +1,157 @@
+#include "software/geom/value_shapes.h"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/algorithms/signed_distance.h"
+
+static_assert(std::is_trivially_copyable_v<Aabb>);
+static_assert(std::is_trivially_copyable_v<CircleShape>);
+static_assert(std::is_trivially_copyable_v<Capsule>);
+static_assert(contains(Aabb{-1, -1, 1, 1}, 0.5, -1.0));
+static_assert(!contains(CircleShape{0, 0, 1}, 1.0, 1.0));
+static_assert(intersects(Aabb{0, 0, 1, 1}, Aabb{1, 1, 2, 2}));
+static_assert(Aabb{0, 0, 1, 2}.expand(0.5).yLength() == 3);
+
+class ValueShapesTest : public testing::Test
+{
+   protected:
+    // Points around and inside of the shapes below, including points on their
+    // boundaries
+    std::vector<Point> test_points = {
+        Point(0, 0),      Point(1, 0.5),   Point(-1, -0.5), Point(2, 1),
+        Point(-2.5, 3),   Point(0.3, -2),  Point(4, 4),     Point(-1.2, 0.4),
+        Point(3, -0.25),  Point(1, -1),    Point(0, 1.5),   Point(-0.7, -0.7),
+        Point(2.5, 1.75), Point(-3, -2.5), Point(1.5, 0),   Point(0.6, 0.8),
+    };
+};
+
+TEST_F(ValueShapesTest, test_aabb_round_trips_through_rectangle)
+{
+    const Rectangle rectangle(Point(2, -1), Point(-1, 1.5));
+    const Aabb aabb = Aabb::fromRectangle(rectangle);
+
+    EXPECT_EQ(aabb.x_min, -1);
+    EXPECT_EQ(aabb.y_min, -1);
+    EXPECT_EQ(aabb.x_max, 2);
+    EXPECT_EQ(aabb.y_max, 1.5);
+    EXPECT_EQ(aabb.toRectangle(), rectangle);
+    EXPECT_EQ(aabb.centre(), rectangle.centre());
+    EXPECT_DOUBLE_EQ(aabb.xLength(), rectangle.xLength());
+    EXPECT_DOUBLE_EQ(aabb.yLength(), rectangle.yLength());
+
+    const Aabb from_corners = Aabb::fromCorners(Point(2, -1), Point(-1, 1.5));
+    EXPECT_EQ(from_corners.toRectangle(), rectangle);
+}
+
+TEST_F(ValueShapesTest, test_aabb_matches_rectangle)
+{
+    const Rectangle rectangle(Point(-1, -0.5), Point(1.5, 1));
+    const Aabb aabb = Aabb::fromRectangle(rectangle);
+
+    for (const Point& point : test_points)
+    {
+        EXPECT_EQ(contains(aabb, point), contains(rectangle, point)) << point;
+        EXPECT_NEAR(distance(aabb, point), distance(rectangle, point), 1e-9) << point;
+        EXPECT_NEAR(signedDistance(aabb, point), signedDistance(rectangle, point), 1e-9)
+            << point;
+
+        for (const Point& other_point : test_points)
+        {
+            // Polygon's intersects treats zero length segments inconsistently
+            if (point == other_point)
+            {
+                continue;
+            }
+            const Segment segment(point, other_point);
+            EXPECT_EQ(intersects(aabb, segment), intersects(rectangle, segment))
+                << point << " to " << other_point;
+        }
+    }
+}
+
+TEST_F(ValueShapesTest, test_aabb_intersects_aabb)
+{
+    const Aabb aabb{0, 0, 2, 1};
+
+    EXPECT_TRUE(intersects(aabb, Aabb{1, 0.5, 3, 3}));
+    EXPECT_TRUE(intersects(aabb, Aabb{0.5, 0.25, 1, 0.5}));
+    EXPECT_TRUE(intersects(aabb, Aabb{2, 1, 3, 3}));
+    EXPECT_FALSE(intersects(aabb, Aabb{2.1, 0, 3, 1}));
+    EXPECT_FALSE(intersects(aabb, Aabb{0, -2, 2, -0.1}));
+
+    EXPECT_TRUE(contains(aabb, Aabb{0.5, 0.25, 1, 0.5}));
+    EXPECT_FALSE(contains(aabb, Aabb{1, 0.5, 3, 3}));
+}
+
+TEST_F(ValueShapesTest, test_circle_shape_matches_circle)
+{
+    const Circle circle(Point(0.5, -0.25), 1.25);
+    const CircleShape circle_shape = CircleShape::fromCircle(circle);
+    EXPECT_EQ(circle_shape.toCircle(), circle);
+
+    for (const Point& point : test_points)
+    {
+        EXPECT_EQ(contains(circle_shape, point), contains(circle, point)) << point;
+        EXPECT_NEAR(distance(circle_shape, point), distance(circle, point), 1e-9)
+            << point;
+        EXPECT_NEAR(signedDistance(circle_shape, point), signedDistance(circle, point),
+                    1e-9)
+            << point;
+
+        for (const Point& other_point : test_points)
+        {
+            const Segment segment(point, other_point);
+            EXPECT_EQ(intersects(circle_shape, segment), intersects(circle, segment))
+                << point << " to " << other_point;
+        }
+    }
+}
+
+TEST_F(ValueShapesTest, test_circle_shape_intersects)
+{
+    const CircleShape circle_shape{0, 0, 1};
+
+    EXPECT_TRUE(intersects(circle_shape, CircleShape{2, 0, 1}));
+    EXPECT_FALSE(intersects(circle_shape, CircleShape{2, 0.1, 1}));
+    EXPECT_TRUE(intersects(circle_shape, Aabb{0.5, 0.5, 2, 2}));
+    EXPECT_TRUE(intersects(circle_shape, Aabb{-5, -5, 5, 5}));
+    EXPECT_FALSE(intersects(circle_shape, Aabb{0.8, 0.8, 2, 2}));
+    EXPECT_TRUE(intersects(circle_shape, Capsule{-3, 1.5, 3, 1.5, 0.5}));
+    EXPECT_FALSE(intersects(circle_shape, Capsule{-3, 1.5, 3, 1.5, 0.4}));
+}
+
+TEST_F(ValueShapesTest, test_capsule_matches_stadium)
+{
+    const Stadium stadium(Point(-1, -0.5), Point(1.5, 1), 0.75);
+    const Capsule capsule = Capsule::fromStadium(stadium);
+    EXPECT_EQ(capsule.toStadium(), stadium);
+
+    for (const Point& point : test_points)
+    {
+        EXPECT_EQ(contains(capsule, point), contains(stadium, point)) << point;
+        EXPECT_NEAR(distance(capsule, point), distance(stadium, point), 1e-9) << point;
+        EXPECT_NEAR(signedDistance(capsule, point), signedDistance(stadium, point), 1e-9)
+            << point;
+
+        for (const Point& other_point : test_points)
+        {
+            const Segment segment(point, other_point);
+            EXPECT_EQ(intersects(capsule, segment), intersects(stadium, segment))
+                << point << " to " << other_point;
+        }
+    }
+}
+
+TEST_F(ValueShapesTest, test_capsule_intersects_segment_crossing_its_axis)
+{
+    // The segment crosses the axis of the capsule far away from the ends of both
+    const Capsule capsule{-10, 0, 10, 0, 0.1};
+
+    EXPECT_TRUE(intersects(capsule, Segment(Point(0, -10), Point(0, 10))));
+    EXPECT_FALSE(intersects(capsule, Segment(Point(-10, 1), Point(10, 1))));
+}
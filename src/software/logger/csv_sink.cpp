@@ -15,10 +15,14 @@ void CSVSink::appendToFile(g3::LogMessageMover log_entry)
         {
             std::string file_name = msg.substr(0, pos);
             std::string file_data = msg.substr(pos, msg.length());
-            std::ofstream csv_file(log_directory + "/" + file_name,
-                                   std::ios::out | std::ios_base::app);
-            csv_file << file_data;
-            csv_file.close();
+            std::unique_ptr<std::ofstream>& csv_file = csv_files[file_name];
+            if (!csv_file)
+            {
+                csv_file = std::make_unique<std::ofstream>(
+                    log_directory + "/" + file_name, std::ios::out | std::ios_base::app);
+            }
+            *csv_file << file_data;
+            csv_file->flush();
         }
     }
 }
@@ -2,6 +2,8 @@
 #include <fstream>
 #include <g3log/logmessage.hpp>
 #include <iostream>
+#include <memory>
+#include <unordered_map>
 
 #include "software/logger/custom_logging_levels.h"
 
@@ -30,4 +32,8 @@ class CSVSink
    private:
     std::string log_directory;
     const std::string file_ext = ".csv";
+
+    // The files that have been appended to, kept open so they don't have to be
+    // reopened for every message
+    std::unordered_map<std::string, std::unique_ptr<std::ofstream>> csv_files;
 };
@@ -0,0 +1,53 @@
+#include "software/logger/csv_telemetry_sink.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
+CSVTelemetrySink::CSVTelemetrySink(const std::string& log_directory)
+    : log_directory_(log_directory)
+{
+}
+
+void CSVTelemetrySink::writeSamples(const std::vector<TelemetrySample>& samples,
+                                    const std::vector<std::string>& channel_names)
+{
+    for (const TelemetrySample& sample : samples)
+    {
+        std::ofstream& file =
+            getChannelFile(sample.channel_id, channel_names.at(sample.channel_id));
+        file << sample.timestamp << "," << sample.value << "\n";
+    }
+}
+
+void CSVTelemetrySink::flush()
+{
+    for (const std::unique_ptr<std::ofstream>& file : channel_files_)
+    {
+        if (file)
+        {
+            file->flush();
+        }
+    }
+}
+
+std::ofstream& CSVTelemetrySink::getChannelFile(TelemetryChannelId channel_id,
+                                                const std::string& channel_name)
+{
+    if (channel_id >= channel_files_.size())
+    {
+        channel_files_.resize(channel_id + 1);
+    }
+
+    std::unique_ptr<std::ofstream>& file = channel_files_[channel_id];
+    if (!file)
+    {
+        std::string file_name = channel_name;
+        std::replace(file_name.begin(), file_name.end(), '/', '_');
+        file = std::make_unique<std::ofstream>(log_directory_ + "/" + file_name + ".csv",
+                                               std::ios::out | std::ios::trunc);
+        *file << std::setprecision(std::numeric_limits<double>::max_digits10);
+        *file << "timestamp," << channel_name << "\n";
+    }
+    return *file;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "software/logger/telemetry_sink.h"
+
+/**
+ * A telemetry sink that writes each channel to its own CSV file in a directory, with a
+ * "timestamp,<channel name>" header and one row per sample. Slashes in channel names
+ * are replaced with underscores in the file names.
+ *
+ * The files are opened the first time a channel is written and kept open, and are only
+ * flushed once per telemetry flush.
+ */
+class CSVTelemetrySink : public TelemetrySink
+{
+   public:
+    /**
+     * Creates a CSVTelemetrySink that writes files to the given directory
+     *
+     * @param log_directory The directory to write the files to
+     */
+    explicit CSVTelemetrySink(const std::string& log_directory);
+
+    void writeSamples(const std::vector<TelemetrySample>& samples,
+                      const std::vector<std::string>& channel_names) override;
+
+    void flush() override;
+
+   private:
+    /**
+     * Gets the file of the given channel, opening it if it isn't open yet
+     *
+     * @param channel_id The id of the channel
+     * @param channel_name The name of the channel
+     *
+     * @return the file of the channel
+     */
+    std::ofstream& getChannelFile(TelemetryChannelId channel_id,
+                                  const std::string& channel_name);
+
+    std::string log_directory_;
+
+    // The open file of each channel, indexed by channel id
+    std::vector<std::unique_ptr<std::ofstream>> channel_files_;
+};
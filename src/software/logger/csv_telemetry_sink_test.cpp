@@ -0,0 +1,27 @@
+#include "software/logger/csv_telemetry_sink.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+TEST(CSVTelemetrySinkTest, each_channel_is_written_to_its_own_file)
+{
+    const std::string log_directory = std::filesystem::temp_directory_path();
+    std::vector<std::string> channel_names = {"csv_telemetry_test/a",
+                                              "csv_telemetry_test_b"};
+
+    CSVTelemetrySink sink(log_directory);
+    sink.writeSamples({{0, 1.5, 10}, {1, 1.5, 20}, {0, 2.5, 11}}, channel_names);
+    sink.flush();
+
+    std::ifstream file_a(log_directory + "/csv_telemetry_test_a.csv");
+    std::string output_a((std::istreambuf_iterator<char>(file_a)),
+                         std::istreambuf_iterator<char>());
+    EXPECT_EQ("timestamp,csv_telemetry_test/a\n1.5,10\n2.5,11\n", output_a);
+
+    std::ifstream file_b(log_directory + "/csv_telemetry_test_b.csv");
+    std::string output_b((std::istreambuf_iterator<char>(file_b)),
+                         std::istreambuf_iterator<char>());
+    EXPECT_EQ("timestamp,csv_telemetry_test_b\n1.5,20\n", output_b);
+}
@@ -10,4 +10,7 @@
 // over radio
 const LEVELS CSV{INFO.value + 1, {"CSV"}};
 const LEVELS VISUALIZE{INFO.value + 2, {"VISUALIZE"}};
+// Numeric signals logged at high rates, such as from control loops, should use
+// TELEMETRY (see telemetry.h) instead of the CSV and PLOTJUGGLER levels, since every
+// message on a level goes through every g3log sink
 const LEVELS PLOTJUGGLER{INFO.value + 3, {"PLOTJUGGLER"}};
@@ -10,9 +10,12 @@
 #include "compat_flags.h"
 #include "software/logger/coloured_cout_sink.h"
 #include "software/logger/csv_sink.h"
+#include "software/logger/csv_telemetry_sink.h"
 #include "software/logger/custom_logging_levels.h"
 #include "software/logger/plotjuggler_sink.h"
+#include "software/logger/plotjuggler_telemetry_sink.h"
 #include "software/logger/protobuf_sink.h"
+#include "software/logger/telemetry.h"
 
 // This undefines LOG macro defined by g3log
 #undef LOG
@@ -59,20 +62,25 @@ class LoggerSingleton
      * @param proto_logger The proto logger to log VISUALIZE protos
      * @param reduce_repetition Whether logs should be merged whenever possible to reduce
      * spam
+     * @param minimum_log_level The lowest level of logs to output
+     * @param ipc_channel_config Selects the visualization channels that use shared
+     * memory instead of unix sockets
      */
-    static void initializeLogger(const std::string& runtime_dir,
-                                 const std::shared_ptr<ProtoLogger>& proto_logger,
-                                 const bool reduce_repetition   = true,
-                                 const LEVELS minimum_log_level = DEBUG)
+    static void initializeLogger(
+        const std::string& runtime_dir, const std::shared_ptr<ProtoLogger>& proto_logger,
+        const bool reduce_repetition               = true,
+        const LEVELS minimum_log_level             = DEBUG,
+        const IpcChannelConfig& ipc_channel_config = IpcChannelConfig())
     {
         static LoggerSingleton s(runtime_dir, proto_logger, reduce_repetition,
-                                 minimum_log_level);
+                                 minimum_log_level, ipc_channel_config);
     }
 
    private:
     LoggerSingleton(const std::string& runtime_dir,
                     const std::shared_ptr<ProtoLogger>& proto_logger,
-                    const bool reduce_repetition, const LEVELS minimum_log_level)
+                    const bool reduce_repetition, const LEVELS minimum_log_level,
+                    const IpcChannelConfig& ipc_channel_config)
     {
         logWorker = g3::LogWorker::createLogWorker();
         // Default locations
@@ -115,9 +123,9 @@ class LoggerSingleton
             &LogRotateWithFilter::save);
 
         // Sink for visualization
-        auto visualization_handle =
-            logWorker->addSink(std::make_unique<ProtobufSink>(runtime_dir, proto_logger),
-                               &ProtobufSink::sendProtobuf);
+        auto visualization_handle = logWorker->addSink(
+            std::make_unique<ProtobufSink>(runtime_dir, proto_logger, ipc_channel_config),
+            &ProtobufSink::sendProtobuf);
 
         // Sink for PlotJuggler plotting
         auto plotjuggler_handle = logWorker->addSink(std::make_unique<PlotJugglerSink>(),
@@ -131,6 +139,17 @@ class LoggerSingleton
         g3::only_change_at_initialization::addLogLevel(PLOTJUGGLER);
 
         g3::initializeLogging(logWorker.get());
+
+        // Sinks for TELEMETRY, which doesn't go through g3log
+        const std::string telemetry_dir = runtime_dir + "/" + telemetry_dir_name;
+        if (!fs::exists(telemetry_dir))
+        {
+            fs::create_directories(telemetry_dir);
+        }
+        std::vector<std::unique_ptr<TelemetrySink>> telemetry_sinks;
+        telemetry_sinks.emplace_back(std::make_unique<CSVTelemetrySink>(telemetry_dir));
+        telemetry_sinks.emplace_back(std::make_unique<PlotJugglerTelemetrySink>());
+        Telemetry::start(std::move(telemetry_sinks));
     }
 
     // levels is this vector are filtered out of the filtered log rotate sink
@@ -139,5 +158,6 @@ class LoggerSingleton
     std::vector<LEVELS> default_level_filter  = {VISUALIZE, CSV, PLOTJUGGLER};
     const std::string filter_suffix           = "_filtered";
     const std::string log_name                = "thunderbots";
+    const std::string telemetry_dir_name      = "telemetry";
     std::unique_ptr<g3::LogWorker> logWorker;
 };
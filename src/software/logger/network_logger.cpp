@@ -2,6 +2,8 @@
 
 #include "software/logger/csv_sink.h"
 #include "software/logger/plotjuggler_sink.h"
+#include "software/logger/plotjuggler_telemetry_sink.h"
+#include "software/logger/telemetry.h"
 
 std::shared_ptr<NetworkLoggerSingleton> NetworkLoggerSingleton::instance;
 
@@ -28,6 +30,13 @@ NetworkLoggerSingleton::NetworkLoggerSingleton(RobotId robot_id, bool enable_log
     g3::only_change_at_initialization::addLogLevel(PLOTJUGGLER);
 
     g3::initializeLogging(logWorker.get());
+
+    // TELEMETRY is only sent to PlotJuggler on robots, since writing it to files at
+    // control loop rates would fill up the robot's storage
+    std::vector<std::unique_ptr<TelemetrySink>> telemetry_sinks;
+    telemetry_sinks.emplace_back(
+        std::make_unique<PlotJugglerTelemetrySink>(network_interface));
+    Telemetry::start(std::move(telemetry_sinks));
 }
 
 void NetworkLoggerSingleton::initializeLogger(RobotId robot_id, bool enable_log_merging,
@@ -0,0 +1,126 @@
+#include "software/logger/plotjuggler_telemetry_sink.h"
+
+#include <bit>
+#include <cstdint>
+
+namespace
+{
+// CBOR major types, see RFC 8949
+constexpr std::uint8_t CBOR_TEXT_STRING = 3;
+constexpr std::uint8_t CBOR_MAP         = 5;
+constexpr std::uint8_t CBOR_FLOAT64     = 0xfb;
+
+/**
+ * Appends the head of a CBOR data item with the given major type and argument
+ *
+ * @param major_type The major type of the data item
+ * @param argument The length of the data item
+ * @param frame The frame to append to
+ */
+void appendCborHead(std::uint8_t major_type, std::uint64_t argument, std::string& frame)
+{
+    const auto initial_byte = static_cast<std::uint8_t>(major_type << 5);
+    int num_argument_bytes  = 0;
+    if (argument < 24)
+    {
+        frame.push_back(static_cast<char>(initial_byte | argument));
+    }
+    else if (argument <= UINT8_MAX)
+    {
+        frame.push_back(static_cast<char>(initial_byte | 24));
+        num_argument_bytes = 1;
+    }
+    else if (argument <= UINT16_MAX)
+    {
+        frame.push_back(static_cast<char>(initial_byte | 25));
+        num_argument_bytes = 2;
+    }
+    else
+    {
+        frame.push_back(static_cast<char>(initial_byte | 26));
+        num_argument_bytes = 4;
+    }
+
+    for (int i = num_argument_bytes - 1; i >= 0; i--)
+    {
+        frame.push_back(static_cast<char>((argument >> (8 * i)) & 0xff));
+    }
+}
+
+/**
+ * Appends a CBOR text string
+ *
+ * @param text The text to append
+ * @param frame The frame to append to
+ */
+void appendCborText(const std::string& text, std::string& frame)
+{
+    appendCborHead(CBOR_TEXT_STRING, text.size(), frame);
+    frame.append(text);
+}
+
+/**
+ * Appends a CBOR double-precision float
+ *
+ * @param value The value to append
+ * @param frame The frame to append to
+ */
+void appendCborFloat64(double value, std::string& frame)
+{
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    frame.push_back(static_cast<char>(CBOR_FLOAT64));
+    for (int i = 7; i >= 0; i--)
+    {
+        frame.push_back(static_cast<char>((bits >> (8 * i)) & 0xff));
+    }
+}
+}  // namespace
+
+PlotJugglerTelemetrySink::PlotJugglerTelemetrySink(const std::string& interface)
+    : udp_sender_(PLOTJUGGLER_GUI_DEFAULT_HOST, PLOTJUGGLER_TELEMETRY_DEFAULT_PORT,
+                  interface, false)
+{
+}
+
+void PlotJugglerTelemetrySink::writeSamples(const std::vector<TelemetrySample>& samples,
+                                            const std::vector<std::string>& channel_names)
+{
+    channel_frames_.resize(channel_names.size(), 0);
+
+    // Frames are numbered from 1, so that no channel starts out in the current frame
+    std::size_t frame_begin = 0;
+    num_frames_++;
+    for (std::size_t i = 0; i < samples.size(); i++)
+    {
+        std::size_t& channel_frame = channel_frames_.at(samples[i].channel_id);
+        if (channel_frame == num_frames_)
+        {
+            udp_sender_.sendString(createPlotJugglerFrame(
+                std::span(samples).subspan(frame_begin, i - frame_begin), channel_names));
+            frame_begin = i;
+            num_frames_++;
+        }
+        channel_frame = num_frames_;
+    }
+
+    if (frame_begin < samples.size())
+    {
+        udp_sender_.sendString(createPlotJugglerFrame(
+            std::span(samples).subspan(frame_begin), channel_names));
+    }
+}
+
+std::string createPlotJugglerFrame(std::span<const TelemetrySample> samples,
+                                   const std::vector<std::string>& channel_names)
+{
+    std::string frame;
+    appendCborHead(CBOR_MAP, samples.size() + 1, frame);
+    appendCborText("timestamp", frame);
+    appendCborFloat64(samples.front().timestamp, frame);
+    for (const TelemetrySample& sample : samples)
+    {
+        appendCborText(channel_names.at(sample.channel_id), frame);
+        appendCborFloat64(sample.value, frame);
+    }
+    return frame;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/logger/telemetry_sink.h"
+#include "software/networking/udp/threaded_udp_sender.h"
+
+/**
+ * A telemetry sink that sends samples to PlotJuggler over UDP as binary CBOR frames.
+ *
+ * The frames are sent to PLOTJUGGLER_TELEMETRY_DEFAULT_PORT, separately from the JSON
+ * sent by PlotJugglerSink, so receiving them needs its own PlotJuggler UDP server
+ * using the CBOR protocol with "timestamp" as the timestamp field.
+ *
+ * Each frame holds one sample of each of a run of consecutive channels, such as the
+ * channels recorded in one iteration of a control loop. A new frame is started when a
+ * channel repeats, and each frame is timestamped with its first sample.
+ */
+class PlotJugglerTelemetrySink : public TelemetrySink
+{
+   public:
+    /**
+     * Creates a PlotJugglerTelemetrySink that sends UDP packets to the PlotJuggler
+     * server
+     *
+     * @param interface The interface to send PlotJuggler UDP packets on
+     */
+    explicit PlotJugglerTelemetrySink(const std::string& interface = LOOPBACK_INTERFACE);
+
+    void writeSamples(const std::vector<TelemetrySample>& samples,
+                      const std::vector<std::string>& channel_names) override;
+
+   private:
+    ThreadedUdpSender udp_sender_;
+
+    // The frame each channel was last added to, indexed by channel id
+    std::vector<std::size_t> channel_frames_;
+    std::size_t num_frames_ = 0;
+};
+
+/**
+ * Encodes samples as a CBOR map from channel name to value, with the timestamp of the
+ * first sample under "timestamp"
+ *
+ * @param samples The samples to encode, which must not be empty
+ * @param channel_names The names of the channels, indexed by channel id
+ *
+ * @return the encoded frame
+ */
+std::string createPlotJugglerFrame(std::span<const TelemetrySample> samples,
+                                   const std::vector<std::string>& channel_names);
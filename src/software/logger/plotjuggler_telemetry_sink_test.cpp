@@ -0,0 +1,36 @@
+#include "software/logger/plotjuggler_telemetry_sink.h"
+
+#include <gtest/gtest.h>
+
+TEST(PlotJugglerTelemetrySinkTest, frame_is_encoded_as_cbor_map)
+{
+    std::vector<std::string> channel_names = {"x", "v_x"};
+    std::vector<TelemetrySample> samples   = {{0, 1.0, 2.0}, {1, 1.5, -0.5}};
+
+    std::string frame = createPlotJugglerFrame(samples, channel_names);
+
+    // {"timestamp": 1.0, "x": 2.0, "v_x": -0.5}
+    const char expected_frame[] =
+        "\xa3"
+        "\x69timestamp"
+        "\xfb\x3f\xf0\x00\x00\x00\x00\x00\x00"
+        "\x61x"
+        "\xfb\x40\x00\x00\x00\x00\x00\x00\x00"
+        "\x63v_x"
+        "\xfb\xbf\xe0\x00\x00\x00\x00\x00\x00";
+    EXPECT_EQ(std::string(expected_frame, sizeof(expected_frame) - 1), frame);
+}
+
+TEST(PlotJugglerTelemetrySinkTest, long_channel_name_uses_one_byte_length)
+{
+    std::vector<std::string> channel_names = {std::string(30, 'a')};
+    std::vector<TelemetrySample> samples   = {{0, 0.0, 0.0}};
+
+    std::string frame = createPlotJugglerFrame(samples, channel_names);
+
+    // The map head, the timestamp key and value, then the channel name head
+    std::size_t name_head_index = 1 + 10 + 9;
+    EXPECT_EQ('\x78', frame[name_head_index]);
+    EXPECT_EQ(30, frame[name_head_index + 1]);
+    EXPECT_EQ(frame.size(), name_head_index + 2 + 30 + 9);
+}
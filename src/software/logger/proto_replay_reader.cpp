@@ -0,0 +1,688 @@
+#include "software/logger/proto_replay_reader.h"
+
+#include <google/protobuf/descriptor.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/asio/post.hpp>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "base64.h"
+#include "proto/replay_bookmark.pb.h"
+#include "shared/constants.h"
+#include "software/logger/compat_flags.h"
+
+namespace
+{
+    // Size of the blocks read from the gzip stream while decompressing a chunk
+    constexpr unsigned int GZIP_READ_BLOCK_SIZE_BYTES = 256 * 1024;
+
+    /**
+     * Decompresses a gzip compressed file into memory
+     *
+     * @param path The path to the file
+     *
+     * @return the decompressed contents, or std::nullopt if the file could not be read
+     */
+    std::optional<std::string> readGzipFile(const std::string& path)
+    {
+        gzFile gz_file = gzopen(path.c_str(), "rb");
+        if (!gz_file)
+        {
+            return std::nullopt;
+        }
+        gzbuffer(gz_file, GZIP_READ_BLOCK_SIZE_BYTES);
+
+        std::string contents;
+        std::vector<char> block(GZIP_READ_BLOCK_SIZE_BYTES);
+        int num_bytes_read = 0;
+        while ((num_bytes_read = gzread(gz_file, block.data(),
+                                        static_cast<unsigned>(block.size()))) > 0)
+        {
+            contents.append(block.data(), static_cast<std::size_t>(num_bytes_read));
+        }
+
+        // A truncated chunk (e.g. the last chunk of a log from a crashed full system)
+        // returns an error on the final read, but everything read up to that point
+        // is still valid so we keep it
+        gzclose(gz_file);
+        return contents;
+    }
+
+    /**
+     * Calls the given function on every line of the given text, excluding the
+     * trailing newline characters
+     *
+     * @param text The text to split
+     * @param on_line The function to call for each line
+     */
+    template <typename Func>
+    void forEachLine(std::string_view text, Func&& on_line)
+    {
+        while (!text.empty())
+        {
+            std::size_t newline_pos = text.find('\n');
+            std::string_view line   = text.substr(0, newline_pos);
+            on_line(line);
+            if (newline_pos == std::string_view::npos)
+            {
+                break;
+            }
+            text.remove_prefix(newline_pos + 1);
+        }
+    }
+
+    /**
+     * Splits a log entry into its timestamp, protobuf type and payload fields
+     *
+     * @param log_entry The log entry to split
+     * @param timestamp_sec Set to the timestamp of the entry
+     * @param protobuf_type_full_name Set to the protobuf type of the entry
+     * @param payload Set to the base64 encoded payload of the entry
+     *
+     * @return true if the entry is well formed, false otherwise
+     */
+    bool splitLogEntry(std::string_view log_entry, double& timestamp_sec,
+                       std::string_view& protobuf_type_full_name,
+                       std::string_view& payload)
+    {
+        std::size_t first_delimiter = log_entry.find(REPLAY_METADATA_DELIMITER);
+        if (first_delimiter == std::string_view::npos)
+        {
+            return false;
+        }
+        std::size_t second_delimiter =
+            log_entry.find(REPLAY_METADATA_DELIMITER, first_delimiter + 1);
+        if (second_delimiter == std::string_view::npos)
+        {
+            return false;
+        }
+
+        std::string_view timestamp_str = log_entry.substr(0, first_delimiter);
+        auto [ptr, error] =
+            std::from_chars(timestamp_str.data(),
+                            timestamp_str.data() + timestamp_str.size(), timestamp_sec);
+        if (error != std::errc() || ptr != timestamp_str.data() + timestamp_str.size())
+        {
+            return false;
+        }
+
+        protobuf_type_full_name = log_entry.substr(
+            first_delimiter + 1, second_delimiter - first_delimiter - 1);
+        payload = log_entry.substr(second_delimiter + 1);
+        return !protobuf_type_full_name.empty();
+    }
+
+    /**
+     * Strips the metadata line from the start of a decompressed chunk, if the chunk
+     * format version has one
+     *
+     * @param contents The decompressed chunk
+     * @param version The replay file format version of the chunk
+     *
+     * @return the chunk contents without the metadata line
+     */
+    std::string_view stripMetadata(std::string_view contents, unsigned int version)
+    {
+        // Starting version 2, the first line of the chunk contains the version
+        if (version >= 2 && contents.rfind(REPLAY_FILE_VERSION_PREFIX, 0) == 0)
+        {
+            std::size_t newline_pos = contents.find('\n');
+            contents.remove_prefix(newline_pos == std::string_view::npos
+                                       ? contents.size()
+                                       : newline_pos + 1);
+        }
+        return contents;
+    }
+
+    /**
+     * Summarizes a replay chunk for the time index without deserializing its protos
+     *
+     * @param chunk_path The path to the chunk
+     * @param version The replay file format version of the chunk
+     * @param bookmark_timestamps Populated with the timestamps of all bookmarks in
+     * the chunk
+     *
+     * @return the index entry for the chunk
+     */
+    ReplayChunkIndex scanChunk(const std::string& chunk_path, unsigned int version,
+                               std::vector<double>& bookmark_timestamps)
+    {
+        const std::string bookmark_type_name =
+            TbotsProto::ReplayBookmark::descriptor()->full_name();
+
+        ReplayChunkIndex index = {
+            .chunk_file_name = fs::path(chunk_path).filename().string(),
+            .file_size_bytes = fs::file_size(chunk_path),
+            .start_time_sec  = 0.0,
+            .end_time_sec    = 0.0,
+            .num_entries     = 0,
+        };
+
+        std::optional<std::string> contents = readGzipFile(chunk_path);
+        if (!contents.has_value())
+        {
+            std::cerr << "ProtoReplayReader: Failed to open replay chunk: " << chunk_path
+                      << std::endl;
+            return index;
+        }
+
+        forEachLine(stripMetadata(contents.value(), version),
+                    [&](std::string_view line) {
+                        double timestamp_sec = 0.0;
+                        std::string_view type_name;
+                        std::string_view payload;
+                        if (!splitLogEntry(line, timestamp_sec, type_name, payload))
+                        {
+                            return;
+                        }
+
+                        if (index.num_entries == 0)
+                        {
+                            index.start_time_sec = timestamp_sec;
+                        }
+                        index.end_time_sec = timestamp_sec;
+                        index.num_entries++;
+
+                        if (type_name == bookmark_type_name)
+                        {
+                            bookmark_timestamps.push_back(timestamp_sec);
+                        }
+                    });
+
+        return index;
+    }
+
+    /**
+     * Extracts the numeric chunk index from a chunk path (e.g. 12 for 12.replay)
+     *
+     * @param chunk_path The path of the chunk
+     *
+     * @return the chunk index, or std::nullopt if the file name is not a number
+     */
+    std::optional<unsigned long> chunkNumber(const fs::path& chunk_path)
+    {
+        std::string stem     = chunk_path.stem().string();
+        unsigned long number = 0;
+        auto [ptr, error] =
+            std::from_chars(stem.data(), stem.data() + stem.size(), number);
+        if (error != std::errc() || ptr != stem.data() + stem.size())
+        {
+            return std::nullopt;
+        }
+        return number;
+    }
+}  // namespace
+
+ProtoReplayReader::ProtoReplayReader(const std::string& log_folder_path,
+                                     unsigned int num_decoder_threads,
+                                     unsigned int num_read_ahead_chunks)
+    : log_folder_path_(log_folder_path),
+      num_read_ahead_chunks_(num_read_ahead_chunks),
+      replay_file_version_(1),
+      decoder_pool_(std::max(1u, num_decoder_threads))
+{
+    std::vector<std::pair<unsigned long, std::string>> numbered_chunks;
+    if (fs::is_directory(log_folder_path_))
+    {
+        for (const auto& dir_entry : fs::directory_iterator(log_folder_path_))
+        {
+            const fs::path& path = dir_entry.path();
+            if (path.extension() != "." + REPLAY_FILE_EXTENSION)
+            {
+                continue;
+            }
+            std::optional<unsigned long> number = chunkNumber(path);
+            if (number.has_value())
+            {
+                numbered_chunks.emplace_back(number.value(), path.string());
+            }
+        }
+    }
+
+    if (numbered_chunks.empty())
+    {
+        throw std::invalid_argument("ProtoReplayReader: No replay files found in " +
+                                    log_folder_path_);
+    }
+
+    // Sort the chunks by their chunk number rather than lexicographically
+    std::sort(numbered_chunks.begin(), numbered_chunks.end());
+    for (const auto& [_, path] : numbered_chunks)
+    {
+        sorted_chunk_paths_.push_back(path);
+    }
+
+    replay_file_version_ = readReplayFileVersion(sorted_chunk_paths_.front());
+
+    loadOrBuildIndex();
+}
+
+ProtoReplayReader::~ProtoReplayReader()
+{
+    // Drop any read-ahead that has not started yet, and wait for the rest
+    decoder_pool_.stop();
+    decoder_pool_.join();
+}
+
+std::vector<ReplayLogEntry> ProtoReplayReader::getEntriesInTimeRange(
+    double start_time_sec, double end_time_sec)
+{
+    std::vector<ReplayLogEntry> entries;
+    if (chunk_index_.empty() || end_time_sec < start_time_sec)
+    {
+        return entries;
+    }
+
+    for (std::size_t chunk_index = getChunkIndexForTime(start_time_sec);
+         chunk_index < chunk_index_.size() &&
+         chunk_index_[chunk_index].start_time_sec <= end_time_sec;
+         chunk_index++)
+    {
+        if (chunk_index_[chunk_index].end_time_sec < start_time_sec)
+        {
+            continue;
+        }
+
+        DecodedChunk chunk = requestChunk(chunk_index).get();
+        auto first_entry   = std::lower_bound(
+            chunk->begin(), chunk->end(), start_time_sec,
+            [](const ReplayLogEntry& entry, double time_sec) {
+                return entry.timestamp_sec < time_sec;
+            });
+        auto last_entry = std::upper_bound(
+            first_entry, chunk->end(), end_time_sec,
+            [](double time_sec, const ReplayLogEntry& entry) {
+                return time_sec < entry.timestamp_sec;
+            });
+        entries.insert(entries.end(), first_entry, last_entry);
+    }
+
+    return entries;
+}
+
+std::vector<ReplayLogEntry> ProtoReplayReader::getChunkEntries(std::size_t chunk_index)
+{
+    if (chunk_index >= chunk_index_.size())
+    {
+        throw std::out_of_range("ProtoReplayReader: Invalid chunk index " +
+                                std::to_string(chunk_index));
+    }
+    return *requestChunk(chunk_index).get();
+}
+
+std::size_t ProtoReplayReader::getChunkIndexForTime(double time_sec) const
+{
+    // Find the first chunk that starts after the given time, the chunk before it
+    // is the one that contains the time
+    auto next_chunk = std::upper_bound(
+        chunk_index_.begin(), chunk_index_.end(), time_sec,
+        [](double time, const ReplayChunkIndex& chunk) {
+            return time < chunk.start_time_sec;
+        });
+    if (next_chunk == chunk_index_.begin())
+    {
+        return 0;
+    }
+    return static_cast<std::size_t>(std::distance(chunk_index_.begin(), next_chunk)) -
+           1;
+}
+
+std::size_t ProtoReplayReader::getNumChunks() const
+{
+    return chunk_index_.size();
+}
+
+const std::vector<ReplayChunkIndex>& ProtoReplayReader::getChunkIndex() const
+{
+    return chunk_index_;
+}
+
+const std::vector<double>& ProtoReplayReader::getBookmarkTimestamps() const
+{
+    return bookmark_timestamps_;
+}
+
+double ProtoReplayReader::getStartTime() const
+{
+    return chunk_index_.empty() ? 0.0 : chunk_index_.front().start_time_sec;
+}
+
+double ProtoReplayReader::getEndTime() const
+{
+    return chunk_index_.empty() ? 0.0 : chunk_index_.back().end_time_sec;
+}
+
+unsigned int ProtoReplayReader::getReplayFileVersion() const
+{
+    return replay_file_version_;
+}
+
+unsigned int ProtoReplayReader::readReplayFileVersion(const std::string& chunk_path)
+{
+    // Default to version 1, which has no metadata line
+    unsigned int version = 1;
+
+    gzFile gz_file = gzopen(chunk_path.c_str(), "rb");
+    if (!gz_file)
+    {
+        return version;
+    }
+
+    std::array<char, 64> line_buffer = {};
+    if (gzgets(gz_file, line_buffer.data(), static_cast<int>(line_buffer.size())))
+    {
+        std::string_view line(line_buffer.data());
+        if (line.rfind(REPLAY_FILE_VERSION_PREFIX, 0) == 0)
+        {
+            line.remove_prefix(REPLAY_FILE_VERSION_PREFIX.size());
+            std::from_chars(line.data(), line.data() + line.size(), version);
+        }
+    }
+
+    gzclose(gz_file);
+    return version;
+}
+
+std::vector<ReplayLogEntry> ProtoReplayReader::decodeChunk(const std::string& chunk_path,
+                                                           unsigned int version)
+{
+    std::vector<ReplayLogEntry> entries;
+
+    std::optional<std::string> contents = readGzipFile(chunk_path);
+    if (!contents.has_value())
+    {
+        std::cerr << "ProtoReplayReader: Failed to open replay chunk: " << chunk_path
+                  << std::endl;
+        return entries;
+    }
+
+    unsigned int num_corrupt_entries = 0;
+    forEachLine(stripMetadata(contents.value(), version), [&](std::string_view line) {
+        std::optional<ReplayLogEntry> entry = parseLogEntry(line, version);
+        if (entry.has_value())
+        {
+            entries.push_back(std::move(entry.value()));
+        }
+        else
+        {
+            num_corrupt_entries++;
+        }
+    });
+
+    if (num_corrupt_entries > 0)
+    {
+        std::cerr << "ProtoReplayReader: Ignored " << num_corrupt_entries
+                  << " corrupt log entries in " << chunk_path << std::endl;
+    }
+
+    return entries;
+}
+
+std::optional<ReplayLogEntry> ProtoReplayReader::parseLogEntry(
+    std::string_view log_entry, unsigned int version)
+{
+    double timestamp_sec = 0.0;
+    std::string_view type_name;
+    std::string_view payload;
+    if (!splitLogEntry(log_entry, timestamp_sec, type_name, payload))
+    {
+        return std::nullopt;
+    }
+
+    if (version == 1)
+    {
+        // Version 1 stored the payload as a python bytes literal, i.e. b'<base64>'
+        if (payload.size() < 3 || payload.substr(0, 2) != "b'" || payload.back() != '\'')
+        {
+            return std::nullopt;
+        }
+        payload = payload.substr(2, payload.size() - 3);
+    }
+    else if (version != 2)
+    {
+        return std::nullopt;
+    }
+
+    const google::protobuf::Descriptor* descriptor =
+        google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(
+            std::string(type_name));
+    if (!descriptor)
+    {
+        return std::nullopt;
+    }
+    const google::protobuf::Message* prototype =
+        google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor);
+    if (!prototype)
+    {
+        return std::nullopt;
+    }
+
+    std::shared_ptr<google::protobuf::Message> message(prototype->New());
+    std::string serialized_proto;
+    try
+    {
+        serialized_proto = base64_decode(payload);
+    }
+    catch (const std::runtime_error&)
+    {
+        return std::nullopt;
+    }
+    if (!message->ParseFromString(serialized_proto))
+    {
+        return std::nullopt;
+    }
+
+    return ReplayLogEntry{
+        .timestamp_sec           = timestamp_sec,
+        .protobuf_type_full_name = std::string(type_name),
+        .message                 = std::move(message),
+    };
+}
+
+void ProtoReplayReader::loadOrBuildIndex()
+{
+    if (!loadIndex())
+    {
+        buildIndex();
+    }
+
+    // Empty chunks are kept in the index file so that it can be validated against
+    // the folder contents, but they have nothing to play back
+    std::vector<std::string> playable_chunk_paths;
+    std::vector<ReplayChunkIndex> playable_chunk_index;
+    for (std::size_t i = 0; i < chunk_index_.size(); i++)
+    {
+        if (chunk_index_[i].num_entries > 0)
+        {
+            playable_chunk_paths.push_back(sorted_chunk_paths_[i]);
+            playable_chunk_index.push_back(chunk_index_[i]);
+        }
+    }
+    sorted_chunk_paths_ = std::move(playable_chunk_paths);
+    chunk_index_        = std::move(playable_chunk_index);
+}
+
+bool ProtoReplayReader::loadIndex()
+{
+    std::ifstream index_file(
+        (fs::path(log_folder_path_) / REPLAY_TIME_INDEX_FILENAME).string());
+    if (!index_file.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(index_file, line) ||
+        line != REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_TIME_INDEX_VERSION))
+    {
+        return false;
+    }
+
+    std::vector<ReplayChunkIndex> chunk_index;
+    std::vector<double> bookmark_timestamps;
+    while (std::getline(index_file, line))
+    {
+        std::stringstream line_stream(line);
+        std::string record_type;
+        std::getline(line_stream, record_type, ',');
+        if (record_type == "chunk")
+        {
+            ReplayChunkIndex chunk;
+            char delimiter;
+            std::getline(line_stream, chunk.chunk_file_name, ',');
+            line_stream >> chunk.file_size_bytes >> delimiter >> chunk.start_time_sec >>
+                delimiter >> chunk.end_time_sec >> delimiter >> chunk.num_entries;
+            if (line_stream.fail())
+            {
+                return false;
+            }
+            chunk_index.push_back(chunk);
+        }
+        else if (record_type == "bookmark")
+        {
+            double timestamp_sec;
+            line_stream >> timestamp_sec;
+            if (line_stream.fail())
+            {
+                return false;
+            }
+            bookmark_timestamps.push_back(timestamp_sec);
+        }
+    }
+
+    // The index is stale if the chunks have changed since it was built, e.g. if it
+    // was built while the log was still being recorded
+    if (chunk_index.size() != sorted_chunk_paths_.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < chunk_index.size(); i++)
+    {
+        const fs::path chunk_path(sorted_chunk_paths_[i]);
+        if (chunk_index[i].chunk_file_name != chunk_path.filename().string() ||
+            chunk_index[i].file_size_bytes != fs::file_size(chunk_path))
+        {
+            return false;
+        }
+    }
+
+    chunk_index_         = std::move(chunk_index);
+    bookmark_timestamps_ = std::move(bookmark_timestamps);
+    return true;
+}
+
+void ProtoReplayReader::buildIndex()
+{
+    using ScanResult = std::pair<ReplayChunkIndex, std::vector<double>>;
+
+    // Scan every chunk in parallel on the decoder pool
+    std::vector<std::future<ScanResult>> scan_futures;
+    for (const std::string& chunk_path : sorted_chunk_paths_)
+    {
+        auto scan_task = std::make_shared<std::packaged_task<ScanResult()>>(
+            [chunk_path, version = replay_file_version_]() {
+                std::vector<double> bookmark_timestamps;
+                ReplayChunkIndex index =
+                    scanChunk(chunk_path, version, bookmark_timestamps);
+                return ScanResult(index, bookmark_timestamps);
+            });
+        scan_futures.push_back(scan_task->get_future());
+        boost::asio::post(decoder_pool_, [scan_task]() { (*scan_task)(); });
+    }
+
+    chunk_index_.clear();
+    bookmark_timestamps_.clear();
+    for (auto& scan_future : scan_futures)
+    {
+        auto [index, bookmark_timestamps] = scan_future.get();
+        chunk_index_.push_back(index);
+        bookmark_timestamps_.insert(bookmark_timestamps_.end(),
+                                    bookmark_timestamps.begin(),
+                                    bookmark_timestamps.end());
+    }
+
+    const std::string index_path =
+        (fs::path(log_folder_path_) / REPLAY_TIME_INDEX_FILENAME).string();
+    std::ofstream index_file(index_path);
+    if (!index_file.is_open())
+    {
+        std::cerr << "ProtoReplayReader: Failed to save replay time index to "
+                  << index_path << std::endl;
+        return;
+    }
+
+    index_file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    index_file << REPLAY_FILE_VERSION_PREFIX << REPLAY_TIME_INDEX_VERSION << "\n";
+    for (const ReplayChunkIndex& chunk : chunk_index_)
+    {
+        index_file << "chunk," << chunk.chunk_file_name << "," << chunk.file_size_bytes
+                   << "," << chunk.start_time_sec << "," << chunk.end_time_sec << ","
+                   << chunk.num_entries << "\n";
+    }
+    for (double timestamp_sec : bookmark_timestamps_)
+    {
+        index_file << "bookmark," << timestamp_sec << "\n";
+    }
+}
+
+std::shared_future<ProtoReplayReader::DecodedChunk> ProtoReplayReader::requestChunk(
+    std::size_t chunk_index)
+{
+    std::scoped_lock lock(cache_mutex_);
+
+    std::shared_future<DecodedChunk> requested_chunk = scheduleChunkLocked(chunk_index);
+
+    // Read ahead so that sequential playback finds the next chunks already decoded
+    std::size_t read_ahead_end =
+        std::min(chunk_index + num_read_ahead_chunks_, chunk_index_.size() - 1);
+    for (std::size_t i = chunk_index + 1; i <= read_ahead_end; i++)
+    {
+        scheduleChunkLocked(i);
+    }
+
+    // Keep the previous chunk around so that small backwards seeks are cheap
+    std::size_t window_start = chunk_index == 0 ? 0 : chunk_index - 1;
+    for (auto it = chunk_cache_.begin(); it != chunk_cache_.end();)
+    {
+        if (it->first < window_start || it->first > read_ahead_end)
+        {
+            it = chunk_cache_.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    return requested_chunk;
+}
+
+std::shared_future<ProtoReplayReader::DecodedChunk>
+ProtoReplayReader::scheduleChunkLocked(std::size_t chunk_index)
+{
+    auto cached_chunk = chunk_cache_.find(chunk_index);
+    if (cached_chunk != chunk_cache_.end())
+    {
+        return cached_chunk->second;
+    }
+
+    auto decode_task = std::make_shared<std::packaged_task<DecodedChunk()>>(
+        [chunk_path = sorted_chunk_paths_[chunk_index],
+         version    = replay_file_version_]() -> DecodedChunk {
+            return std::make_shared<const std::vector<ReplayLogEntry>>(
+                decodeChunk(chunk_path, version));
+        });
+    std::shared_future<DecodedChunk> decoded_chunk = decode_task->get_future().share();
+    boost::asio::post(decoder_pool_, [decode_task]() { (*decode_task)(); });
+
+    chunk_cache_.emplace(chunk_index, decoded_chunk);
+    return decoded_chunk;
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <boost/asio/thread_pool.hpp>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * A single deserialized entry of a replay log
+ */
+struct ReplayLogEntry
+{
+    // Time the protobuf was received, relative to the start of the log
+    double timestamp_sec;
+    // The full name of the protobuf message type (e.g. TbotsProto.World)
+    std::string protobuf_type_full_name;
+    // The deserialized protobuf. Shared so that entries can be handed out from the
+    // chunk cache without copying the underlying message.
+    std::shared_ptr<const google::protobuf::Message> message;
+};
+
+/**
+ * Summary of a single replay chunk, as stored in the replay time index
+ */
+struct ReplayChunkIndex
+{
+    // The file name of the chunk, relative to the log folder (e.g. 0.replay)
+    std::string chunk_file_name;
+    // The size of the compressed chunk file, used to detect stale index entries
+    std::uintmax_t file_size_bytes;
+    // Timestamps of the first and last valid entry in the chunk
+    double start_time_sec;
+    double end_time_sec;
+    // The number of valid entries in the chunk
+    std::size_t num_entries;
+};
+
+/**
+ * Reads replay logs written by ProtoLogger.
+ *
+ * On construction, the reader loads the time index stored in the log folder
+ * (REPLAY_TIME_INDEX_FILENAME), rebuilding it in parallel if it is missing or out of
+ * date with the chunks on disk. The index records the time span of every chunk and
+ * the timestamps of all ReplayBookmarks, so opening a log does not require
+ * decompressing it.
+ *
+ * Chunks are decompressed, base64 decoded and deserialized on a background thread
+ * pool. Whenever a chunk is requested, the following chunks are scheduled for
+ * decoding as well (read-ahead) so that sequential playback never waits on
+ * decompression. Only a small window of decoded chunks around the most recent
+ * request is kept in memory.
+ *
+ * The public API is thread-safe.
+ */
+class ProtoReplayReader
+{
+   public:
+    /**
+     * Creates a new ProtoReplayReader
+     *
+     * @param log_folder_path The folder containing the replay chunks
+     * @param num_decoder_threads The number of threads used to decode chunks
+     * @param num_read_ahead_chunks The number of chunks to decode ahead of the most
+     * recently requested chunk
+     *
+     * @throws std::invalid_argument if the folder does not contain any replay chunks
+     */
+    explicit ProtoReplayReader(
+        const std::string& log_folder_path,
+        unsigned int num_decoder_threads   = DEFAULT_NUM_DECODER_THREADS,
+        unsigned int num_read_ahead_chunks = DEFAULT_NUM_READ_AHEAD_CHUNKS);
+
+    ProtoReplayReader() = delete;
+
+    ProtoReplayReader(const ProtoReplayReader&)            = delete;
+    ProtoReplayReader& operator=(const ProtoReplayReader&) = delete;
+
+    ~ProtoReplayReader();
+
+    /**
+     * Gets all entries with a timestamp in [start_time_sec, end_time_sec], in
+     * chronological order. Blocks until all chunks overlapping the range are decoded.
+     *
+     * @param start_time_sec The start of the time range
+     * @param end_time_sec The end of the time range
+     *
+     * @return the entries in the given time range
+     */
+    std::vector<ReplayLogEntry> getEntriesInTimeRange(double start_time_sec,
+                                                      double end_time_sec);
+
+    /**
+     * Gets all entries of the given chunk, in chronological order. Blocks until the
+     * chunk is decoded.
+     *
+     * @param chunk_index The index of the chunk, must be less than getNumChunks()
+     *
+     * @throws std::out_of_range if the chunk index is invalid
+     *
+     * @return the entries of the chunk
+     */
+    std::vector<ReplayLogEntry> getChunkEntries(std::size_t chunk_index);
+
+    /**
+     * Gets the index of the chunk containing the given time, i.e. the last chunk that
+     * starts at or before the given time
+     *
+     * @param time_sec The time to look up
+     *
+     * @return the index of the chunk containing the given time
+     */
+    std::size_t getChunkIndexForTime(double time_sec) const;
+
+    /**
+     * Getters for the contents of the time index
+     */
+    std::size_t getNumChunks() const;
+    const std::vector<ReplayChunkIndex>& getChunkIndex() const;
+    const std::vector<double>& getBookmarkTimestamps() const;
+    double getStartTime() const;
+    double getEndTime() const;
+    unsigned int getReplayFileVersion() const;
+
+    /**
+     * Reads the replay file format version from the metadata line of a chunk
+     *
+     * @param chunk_path The path to the replay chunk
+     *
+     * @return the replay file format version, defaulting to 1 if the chunk has no
+     * metadata line
+     */
+    static unsigned int readReplayFileVersion(const std::string& chunk_path);
+
+    /**
+     * Decompresses and deserializes every entry of a replay chunk. Corrupt entries
+     * and entries of unknown protobuf types are skipped.
+     *
+     * @param chunk_path The path to the replay chunk
+     * @param version The replay file format version of the chunk
+     *
+     * @return the valid entries in the chunk
+     */
+    static std::vector<ReplayLogEntry> decodeChunk(const std::string& chunk_path,
+                                                   unsigned int version);
+
+    /**
+     * Parses a single line of a replay chunk
+     *
+     * @param log_entry The line, without its trailing newline
+     * @param version The replay file format version of the chunk
+     *
+     * @return the parsed entry, or std::nullopt if the line is corrupt
+     */
+    static std::optional<ReplayLogEntry> parseLogEntry(std::string_view log_entry,
+                                                       unsigned int version);
+
+    static constexpr unsigned int DEFAULT_NUM_DECODER_THREADS   = 4;
+    static constexpr unsigned int DEFAULT_NUM_READ_AHEAD_CHUNKS = 3;
+    static constexpr unsigned int REPLAY_TIME_INDEX_VERSION     = 1;
+    static inline const std::string REPLAY_TIME_INDEX_FILENAME  = "replay_time.index";
+
+   private:
+    using DecodedChunk = std::shared_ptr<const std::vector<ReplayLogEntry>>;
+
+    /**
+     * Loads the time index from disk if it exists and matches the chunks in the log
+     * folder, otherwise builds it and saves it to disk
+     */
+    void loadOrBuildIndex();
+
+    /**
+     * Loads the time index from disk
+     *
+     * @return true if an up-to-date index was loaded, false otherwise
+     */
+    bool loadIndex();
+
+    /**
+     * Builds the time index by decoding every chunk on the decoder pool, and saves it
+     * to disk
+     */
+    void buildIndex();
+
+    /**
+     * Gets the future for a decoded chunk, scheduling it for decoding if it is not
+     * already cached. Also schedules read-ahead of the following chunks and evicts
+     * chunks outside of the cache window.
+     *
+     * @param chunk_index The index of the chunk
+     *
+     * @return the future of the decoded chunk
+     */
+    std::shared_future<DecodedChunk> requestChunk(std::size_t chunk_index);
+
+    /**
+     * Schedules a chunk for decoding on the decoder pool. cache_mutex_ must be held.
+     *
+     * @param chunk_index The index of the chunk
+     *
+     * @return the future of the decoded chunk
+     */
+    std::shared_future<DecodedChunk> scheduleChunkLocked(std::size_t chunk_index);
+
+    std::string log_folder_path_;
+    unsigned int num_read_ahead_chunks_;
+    unsigned int replay_file_version_;
+
+    std::vector<std::string> sorted_chunk_paths_;
+    std::vector<ReplayChunkIndex> chunk_index_;
+    std::vector<double> bookmark_timestamps_;
+
+    boost::asio::thread_pool decoder_pool_;
+
+    std::mutex cache_mutex_;
+    std::map<std::size_t, std::shared_future<DecodedChunk>> chunk_cache_;
+};
@@ -0,0 +1,215 @@
+#include "software/logger/proto_replay_reader.h"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include "proto/replay_bookmark.pb.h"
+#include "proto/tbots_timestamp_msg.pb.h"
+#include "shared/constants.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/proto_logger.h"
+
+class ProtoReplayReaderTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(log_folder);
+        fs::create_directories(log_folder);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(log_folder);
+    }
+
+    /**
+     * Writes a replay chunk in the format produced by ProtoLogger. Every entry is a
+     * Timestamp proto holding the index of the entry in the whole log.
+     *
+     * @param chunk_number The number of the chunk
+     * @param start_time_sec The timestamp of the first entry
+     * @param num_entries The number of entries to write
+     * @param bookmark_time_sec If set, a bookmark is written at this time
+     */
+    void writeChunk(unsigned int chunk_number, double start_time_sec,
+                    unsigned int num_entries,
+                    std::optional<double> bookmark_time_sec = std::nullopt)
+    {
+        std::string chunk_path = log_folder + "/" + std::to_string(chunk_number) + "." +
+                                 REPLAY_FILE_EXTENSION;
+        gzFile gz_file = gzopen(chunk_path.c_str(), "wb");
+        ASSERT_TRUE(gz_file);
+
+        std::string contents =
+            REPLAY_FILE_VERSION_PREFIX + std::to_string(REPLAY_FILE_VERSION) + "\n";
+        for (unsigned int i = 0; i < num_entries; i++)
+        {
+            TbotsProto::Timestamp timestamp;
+            timestamp.set_epoch_timestamp_seconds(chunk_number * num_entries + i);
+            contents += ProtoLogger::createLogEntry(
+                TbotsProto::Timestamp::descriptor()->full_name(),
+                timestamp.SerializeAsString(), start_time_sec + i * ENTRY_PERIOD_SEC);
+        }
+        if (bookmark_time_sec.has_value())
+        {
+            contents += ProtoLogger::createLogEntry(
+                TbotsProto::ReplayBookmark::descriptor()->full_name(),
+                TbotsProto::ReplayBookmark().SerializeAsString(),
+                bookmark_time_sec.value());
+        }
+
+        gzwrite(gz_file, contents.data(), static_cast<unsigned>(contents.size()));
+        gzclose(gz_file);
+    }
+
+    const std::string log_folder           = "/tmp/proto_replay_reader_test";
+    static constexpr double ENTRY_PERIOD_SEC = 0.5;
+};
+
+TEST_F(ProtoReplayReaderTest, test_throws_on_empty_folder)
+{
+    EXPECT_THROW(ProtoReplayReader reader(log_folder), std::invalid_argument);
+}
+
+TEST_F(ProtoReplayReaderTest, test_parse_log_entry)
+{
+    TbotsProto::Timestamp timestamp;
+    timestamp.set_epoch_timestamp_seconds(3.0);
+    std::string log_entry = ProtoLogger::createLogEntry(
+        TbotsProto::Timestamp::descriptor()->full_name(), timestamp.SerializeAsString(),
+        1.5);
+    log_entry.pop_back();
+
+    auto entry = ProtoReplayReader::parseLogEntry(log_entry, REPLAY_FILE_VERSION);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_DOUBLE_EQ(entry->timestamp_sec, 1.5);
+    EXPECT_EQ(entry->protobuf_type_full_name, "TbotsProto.Timestamp");
+    EXPECT_EQ(entry->message->SerializeAsString(), timestamp.SerializeAsString());
+}
+
+TEST_F(ProtoReplayReaderTest, test_parse_corrupt_log_entries)
+{
+    EXPECT_FALSE(ProtoReplayReader::parseLogEntry("", REPLAY_FILE_VERSION).has_value());
+    EXPECT_FALSE(ProtoReplayReader::parseLogEntry("1.0TbotsProto.Timestamp,CAM=",
+                                                  REPLAY_FILE_VERSION)
+                     .has_value());
+    EXPECT_FALSE(ProtoReplayReader::parseLogEntry("1.0,TbotsProto.NotAProto,CAM=",
+                                                  REPLAY_FILE_VERSION)
+                     .has_value());
+    EXPECT_FALSE(ProtoReplayReader::parseLogEntry("abc,TbotsProto.Timestamp,CAM=",
+                                                  REPLAY_FILE_VERSION)
+                     .has_value());
+}
+
+TEST_F(ProtoReplayReaderTest, test_builds_and_reloads_index)
+{
+    writeChunk(0, 0.0, 10);
+    writeChunk(1, 5.0, 10, 7.0);
+    writeChunk(2, 10.0, 10);
+
+    {
+        ProtoReplayReader reader(log_folder);
+        ASSERT_EQ(reader.getNumChunks(), 3);
+        EXPECT_DOUBLE_EQ(reader.getStartTime(), 0.0);
+        EXPECT_DOUBLE_EQ(reader.getEndTime(), 10.0 + 9 * ENTRY_PERIOD_SEC);
+        ASSERT_EQ(reader.getBookmarkTimestamps().size(), 1);
+        EXPECT_DOUBLE_EQ(reader.getBookmarkTimestamps()[0], 7.0);
+    }
+
+    ASSERT_TRUE(
+        fs::exists(log_folder + "/" + ProtoReplayReader::REPLAY_TIME_INDEX_FILENAME));
+
+    ProtoReplayReader reader(log_folder);
+    ASSERT_EQ(reader.getNumChunks(), 3);
+    EXPECT_EQ(reader.getChunkIndex()[1].chunk_file_name, "1.replay");
+    EXPECT_DOUBLE_EQ(reader.getChunkIndex()[1].start_time_sec, 5.0);
+    EXPECT_EQ(reader.getChunkIndex()[1].num_entries, 11);
+    EXPECT_EQ(reader.getBookmarkTimestamps().size(), 1);
+}
+
+TEST_F(ProtoReplayReaderTest, test_rebuilds_stale_index)
+{
+    writeChunk(0, 0.0, 10);
+    {
+        ProtoReplayReader reader(log_folder);
+        EXPECT_EQ(reader.getNumChunks(), 1);
+    }
+
+    // Simulate the log still being recorded when the index was built
+    writeChunk(1, 5.0, 10);
+
+    ProtoReplayReader reader(log_folder);
+    EXPECT_EQ(reader.getNumChunks(), 2);
+    EXPECT_DOUBLE_EQ(reader.getEndTime(), 5.0 + 9 * ENTRY_PERIOD_SEC);
+}
+
+TEST_F(ProtoReplayReaderTest, test_chunks_sorted_numerically)
+{
+    for (unsigned int i = 0; i < 12; i++)
+    {
+        writeChunk(i, i * 5.0, 10);
+    }
+
+    ProtoReplayReader reader(log_folder);
+    ASSERT_EQ(reader.getNumChunks(), 12);
+    EXPECT_EQ(reader.getChunkIndex()[2].chunk_file_name, "2.replay");
+    EXPECT_EQ(reader.getChunkIndex()[11].chunk_file_name, "11.replay");
+    EXPECT_EQ(reader.getChunkIndexForTime(12.0), 2);
+    EXPECT_EQ(reader.getChunkIndexForTime(-1.0), 0);
+    EXPECT_EQ(reader.getChunkIndexForTime(1000.0), 11);
+}
+
+TEST_F(ProtoReplayReaderTest, test_get_entries_in_time_range_across_chunks)
+{
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        writeChunk(i, i * 5.0, 10);
+    }
+
+    ProtoReplayReader reader(log_folder, 2, 2);
+    std::vector<ReplayLogEntry> entries = reader.getEntriesInTimeRange(3.0, 12.0);
+
+    // 3.0 to 4.5 from chunk 0, all of chunk 1, 10.0 to 12.0 from chunk 2
+    ASSERT_EQ(entries.size(), 4 + 10 + 5);
+    EXPECT_DOUBLE_EQ(entries.front().timestamp_sec, 3.0);
+    EXPECT_DOUBLE_EQ(entries.back().timestamp_sec, 12.0);
+    for (std::size_t i = 1; i < entries.size(); i++)
+    {
+        EXPECT_LT(entries[i - 1].timestamp_sec, entries[i].timestamp_sec);
+    }
+
+    TbotsProto::Timestamp first_timestamp;
+    ASSERT_TRUE(
+        first_timestamp.ParseFromString(entries.front().message->SerializeAsString()));
+    EXPECT_DOUBLE_EQ(first_timestamp.epoch_timestamp_seconds(), 6.0);
+}
+
+TEST_F(ProtoReplayReaderTest, test_get_chunk_entries)
+{
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        writeChunk(i, i * 5.0, 10);
+    }
+
+    ProtoReplayReader reader(log_folder);
+    for (std::size_t i = 0; i < reader.getNumChunks(); i++)
+    {
+        std::vector<ReplayLogEntry> entries = reader.getChunkEntries(i);
+        ASSERT_EQ(entries.size(), 10);
+        EXPECT_DOUBLE_EQ(entries.front().timestamp_sec, i * 5.0);
+    }
+    EXPECT_THROW(reader.getChunkEntries(4), std::out_of_range);
+}
+
+TEST_F(ProtoReplayReaderTest, test_skips_empty_chunks)
+{
+    writeChunk(0, 0.0, 10);
+    writeChunk(1, 5.0, 0);
+    writeChunk(2, 10.0, 10);
+
+    ProtoReplayReader reader(log_folder);
+    ASSERT_EQ(reader.getNumChunks(), 2);
+    EXPECT_EQ(reader.getChunkIndex()[1].chunk_file_name, "2.replay");
+    EXPECT_EQ(reader.getEntriesInTimeRange(0.0, 100.0).size(), 20);
+}
@@ -8,12 +8,14 @@
 #include "shared/constants.h"
 
 ProtobufSink::ProtobufSink(std::string runtime_dir,
-                           const std::shared_ptr<ProtoLogger>& proto_logger)
-    : proto_logger(proto_logger)
+                           const std::shared_ptr<ProtoLogger>& proto_logger,
+                           const IpcChannelConfig& ipc_channel_config)
+    : ipc_channel_config_(ipc_channel_config), proto_logger(proto_logger)
 {
     // Setup the logs
-    unix_senders_["log"] = std::make_unique<ThreadedUnixSender>(runtime_dir + "/log");
-    runtime_dir_         = runtime_dir;
+    ipc_senders_["log"] = std::make_unique<ThreadedIpcSender>(
+        runtime_dir + "/log", ipc_channel_config.getTransport("/log"));
+    runtime_dir_ = runtime_dir;
 }
 
 void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
@@ -45,15 +47,15 @@ void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
             file_name = "/" + proto_type_name;
         }
 
-        // If we don't already have a unix sender for this type, let's create it
-        if (unix_senders_.count(file_name) == 0)
+        // If we don't already have a sender for this type, let's create it
+        if (ipc_senders_.count(file_name) == 0)
         {
-            unix_senders_[file_name] =
-                std::make_unique<ThreadedUnixSender>(runtime_dir_ + file_name);
+            ipc_senders_[file_name] = std::make_unique<ThreadedIpcSender>(
+                runtime_dir_ + file_name, ipc_channel_config_.getTransport(file_name));
         }
 
         // Send the protobuf
-        unix_senders_[file_name]->sendString(serialized_proto);
+        ipc_senders_[file_name]->sendString(serialized_proto);
     }
     else
     {
@@ -76,7 +78,7 @@ void ProtobufSink::sendProtobuf(g3::LogMessageMover log_entry)
 
             std::string log_msg;
             log_msg_proto.SerializeToString(&log_msg);
-            unix_senders_["log"]->sendString(log_msg);
+            ipc_senders_["log"]->sendString(log_msg);
         }
     }
 }
@@ -6,13 +6,14 @@
 #include "google/protobuf/any.pb.h"
 #include "software/logger/custom_logging_levels.h"
 #include "software/logger/proto_logger.h"
-#include "software/networking/unix/threaded_unix_sender.h"
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/ipc/threaded_ipc_sender.h"
 
 static const std::string TYPE_DELIMITER = "!!!";
 
 
-using UnixSenderMap =
-    std::unordered_map<std::string, std::unique_ptr<ThreadedUnixSender>>;
+using IpcSenderMap =
+    std::unordered_map<std::string, std::unique_ptr<ThreadedIpcSender>>;
 
 
 class ProtobufSink
@@ -34,8 +35,9 @@ class ProtobufSink
     void sendProtobuf(g3::LogMessageMover log_entry);
 
    private:
-    UnixSenderMap unix_senders_;
+    IpcSenderMap ipc_senders_;
     std::string runtime_dir_;
+    IpcChannelConfig ipc_channel_config_;
     std::shared_ptr<ProtoLogger> proto_logger;
 };
 
@@ -0,0 +1,192 @@
+#include "software/logger/telemetry.h"
+
+TelemetryChannelId Telemetry::getChannelId(const std::string& name)
+{
+    Telemetry& telemetry = getInstance();
+    std::scoped_lock lock(telemetry.channel_mutex_);
+
+    auto iter = telemetry.channel_ids_.find(name);
+    if (iter != telemetry.channel_ids_.end())
+    {
+        return iter->second;
+    }
+
+    const auto channel_id =
+        static_cast<TelemetryChannelId>(telemetry.channel_names_.size());
+    telemetry.channel_names_.push_back(name);
+    telemetry.channel_ids_.emplace(name, channel_id);
+    return channel_id;
+}
+
+void Telemetry::record(TelemetryChannelId channel_id, double value)
+{
+    Telemetry& telemetry = getInstance();
+    if (!telemetry.started_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const double timestamp =
+        std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+
+    ThreadBuffer& buffer          = telemetry.getThreadBuffer();
+    const std::size_t write_index = buffer.write_index.load(std::memory_order_relaxed);
+    const std::size_t read_index  = buffer.read_index.load(std::memory_order_acquire);
+    if (write_index - read_index == BUFFER_CAPACITY)
+    {
+        telemetry.num_dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.samples[write_index % BUFFER_CAPACITY] = {channel_id, timestamp, value};
+    buffer.write_index.store(write_index + 1, std::memory_order_release);
+}
+
+void Telemetry::start(std::vector<std::unique_ptr<TelemetrySink>> sinks,
+                      std::chrono::milliseconds flush_period)
+{
+    Telemetry& telemetry = getInstance();
+    std::scoped_lock lifecycle_lock(telemetry.lifecycle_mutex_);
+    telemetry.stopFlusher();
+
+    {
+        std::scoped_lock buffer_lock(telemetry.buffer_mutex_);
+        telemetry.sinks_ = std::move(sinks);
+    }
+    telemetry.flush_period_   = flush_period;
+    telemetry.stop_flusher_   = false;
+    telemetry.started_        = true;
+    telemetry.flusher_thread_ = std::thread(&Telemetry::runFlusher, &telemetry);
+}
+
+void Telemetry::stop()
+{
+    Telemetry& telemetry = getInstance();
+    std::scoped_lock lifecycle_lock(telemetry.lifecycle_mutex_);
+    telemetry.stopFlusher();
+}
+
+void Telemetry::flush()
+{
+    getInstance().drainBuffers();
+}
+
+std::uint64_t Telemetry::getNumDroppedSamples()
+{
+    return getInstance().num_dropped_samples_.load();
+}
+
+Telemetry::ThreadBufferHandle::~ThreadBufferHandle()
+{
+    if (buffer)
+    {
+        buffer->thread_alive.store(false, std::memory_order_release);
+    }
+}
+
+Telemetry::~Telemetry()
+{
+    std::scoped_lock lifecycle_lock(lifecycle_mutex_);
+    stopFlusher();
+}
+
+Telemetry& Telemetry::getInstance()
+{
+    static Telemetry telemetry;
+    return telemetry;
+}
+
+Telemetry::ThreadBuffer& Telemetry::getThreadBuffer()
+{
+    thread_local ThreadBufferHandle handle;
+    if (!handle.buffer)
+    {
+        auto buffer   = std::make_unique<ThreadBuffer>();
+        handle.buffer = buffer.get();
+
+        std::scoped_lock lock(buffer_mutex_);
+        thread_buffers_.push_back(std::move(buffer));
+    }
+    return *handle.buffer;
+}
+
+void Telemetry::drainBuffers()
+{
+    std::vector<std::string> channel_names;
+    {
+        std::scoped_lock lock(channel_mutex_);
+        channel_names = channel_names_;
+    }
+
+    std::scoped_lock lock(buffer_mutex_);
+    for (auto iter = thread_buffers_.begin(); iter != thread_buffers_.end();)
+    {
+        ThreadBuffer& buffer = **iter;
+
+        // Check if the thread has exited before draining, so that every sample it
+        // recorded is drained before its buffer is freed below
+        const bool thread_exited = !buffer.thread_alive.load(std::memory_order_acquire);
+
+        const std::size_t read_index = buffer.read_index.load(std::memory_order_relaxed);
+        const std::size_t write_index =
+            buffer.write_index.load(std::memory_order_acquire);
+        if (read_index != write_index)
+        {
+            drained_samples_.clear();
+            for (std::size_t i = read_index; i < write_index; i++)
+            {
+                drained_samples_.push_back(buffer.samples[i % BUFFER_CAPACITY]);
+            }
+            buffer.read_index.store(write_index, std::memory_order_release);
+
+            for (const std::unique_ptr<TelemetrySink>& sink : sinks_)
+            {
+                sink->writeSamples(drained_samples_, channel_names);
+            }
+        }
+
+        if (thread_exited)
+        {
+            iter = thread_buffers_.erase(iter);
+        }
+        else
+        {
+            iter++;
+        }
+    }
+
+    for (const std::unique_ptr<TelemetrySink>& sink : sinks_)
+    {
+        sink->flush();
+    }
+}
+
+void Telemetry::runFlusher()
+{
+    while (true)
+    {
+        drainBuffers();
+
+        std::unique_lock lock(stop_mutex_);
+        if (stop_cv_.wait_for(lock, flush_period_, [this] { return stop_flusher_; }))
+        {
+            return;
+        }
+    }
+}
+
+void Telemetry::stopFlusher()
+{
+    started_ = false;
+    if (flusher_thread_.joinable())
+    {
+        {
+            std::scoped_lock lock(stop_mutex_);
+            stop_flusher_ = true;
+        }
+        stop_cv_.notify_all();
+        flusher_thread_.join();
+    }
+    drainBuffers();
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "software/logger/telemetry_sink.h"
+
+/**
+ * Records a numeric sample on a telemetry channel. The channel name must not change
+ * between calls from the same call site, since it is only looked up the first time
+ * the call site runs. Recording does nothing until Telemetry is started.
+ *
+ * Example: TELEMETRY("primitive_executor/v_x", velocity.x());
+ *
+ * @param name The name of the channel
+ * @param value The value of the sample
+ */
+#define TELEMETRY(name, value)                                                           \
+    do                                                                                   \
+    {                                                                                    \
+        static const TelemetryChannelId telemetry_channel_id =                           \
+            Telemetry::getChannelId(name);                                               \
+        Telemetry::record(telemetry_channel_id, static_cast<double>(value));             \
+    } while (false)
+
+/**
+ * Records numeric telemetry from any thread without blocking it, and writes the
+ * samples to telemetry sinks on a background thread.
+ *
+ * Channel names are interned into integer ids once per call site, so recording a sample
+ * only timestamps it and pushes it into a fixed-size buffer owned by the recording
+ * thread. Each buffer is a single-producer single-consumer ring buffer, so the recording
+ * thread never takes a lock or allocates. If a buffer is full because the flusher has
+ * fallen behind, the sample is dropped and counted rather than blocking the recording
+ * thread.
+ *
+ * The flusher thread drains the buffers of all threads every flush period and writes the
+ * samples of each thread to every sink as one batch.
+ */
+class Telemetry
+{
+   public:
+    // The number of samples each thread can buffer between flushes
+    static constexpr std::size_t BUFFER_CAPACITY = 8192;
+
+    /**
+     * Gets the id of the channel with the given name, creating the channel if it
+     * doesn't exist yet
+     *
+     * @param name The name of the channel
+     *
+     * @return the id of the channel
+     */
+    static TelemetryChannelId getChannelId(const std::string& name);
+
+    /**
+     * Records a sample on the given channel, timestamped with the current time. This
+     * does nothing if Telemetry isn't started.
+     *
+     * @param channel_id The id of the channel
+     * @param value The value of the sample
+     */
+    static void record(TelemetryChannelId channel_id, double value);
+
+    /**
+     * Starts the flusher thread, which writes the recorded samples to the given sinks.
+     * If Telemetry is already started, it is stopped and restarted with the new sinks.
+     *
+     * @param sinks The sinks to write the samples to
+     * @param flush_period How often the samples are written to the sinks
+     */
+    static void start(std::vector<std::unique_ptr<TelemetrySink>> sinks,
+                      std::chrono::milliseconds flush_period = DEFAULT_FLUSH_PERIOD);
+
+    /**
+     * Writes any remaining samples to the sinks and stops the flusher thread
+     */
+    static void stop();
+
+    /**
+     * Writes the samples recorded so far to the sinks immediately, instead of waiting
+     * for the next flush period
+     */
+    static void flush();
+
+    /**
+     * Gets the number of samples dropped because the buffer of their thread was full
+     *
+     * @return the number of dropped samples since the program started
+     */
+    static std::uint64_t getNumDroppedSamples();
+
+   private:
+    static constexpr std::chrono::milliseconds DEFAULT_FLUSH_PERIOD{10};
+
+    /**
+     * The samples recorded by one thread, in a ring buffer written only by that thread
+     * and read only by the flusher
+     */
+    struct ThreadBuffer
+    {
+        std::array<TelemetrySample, BUFFER_CAPACITY> samples;
+        std::atomic<std::size_t> write_index = 0;
+        std::atomic<std::size_t> read_index  = 0;
+
+        // Cleared when the thread exits, so the flusher can free the buffer once it
+        // has been drained
+        std::atomic_bool thread_alive = true;
+    };
+
+    /**
+     * Owns the buffer of the calling thread, and marks it as orphaned when the thread
+     * exits
+     */
+    struct ThreadBufferHandle
+    {
+        ~ThreadBufferHandle();
+
+        ThreadBuffer* buffer = nullptr;
+    };
+
+    Telemetry() = default;
+    ~Telemetry();
+
+    /**
+     * Gets the Telemetry instance shared by all threads
+     *
+     * @return the Telemetry instance
+     */
+    static Telemetry& getInstance();
+
+    /**
+     * Gets the buffer of the calling thread, creating it the first time a thread
+     * records a sample
+     *
+     * @return the buffer of the calling thread
+     */
+    ThreadBuffer& getThreadBuffer();
+
+    /**
+     * Drains the buffers of all threads and writes their samples to the sinks. Only
+     * one thread drains the buffers at a time.
+     */
+    void drainBuffers();
+
+    /**
+     * The loop the flusher thread runs, draining the buffers every flush period until
+     * it is stopped
+     */
+    void runFlusher();
+
+    /**
+     * Stops and joins the flusher thread, then drains the buffers one last time
+     */
+    void stopFlusher();
+
+    std::atomic_bool started_                       = false;
+    std::atomic<std::uint64_t> num_dropped_samples_ = 0;
+
+    // Guards the channels
+    std::mutex channel_mutex_;
+    std::vector<std::string> channel_names_;
+    std::unordered_map<std::string, TelemetryChannelId> channel_ids_;
+
+    // Guards the buffers and the sinks, and is held while the buffers are drained
+    std::mutex buffer_mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers_;
+    std::vector<std::unique_ptr<TelemetrySink>> sinks_;
+    std::vector<TelemetrySample> drained_samples_;
+
+    // Held while the flusher thread is started or stopped
+    std::mutex lifecycle_mutex_;
+    std::chrono::milliseconds flush_period_ = DEFAULT_FLUSH_PERIOD;
+    std::thread flusher_thread_;
+
+    // Wakes the flusher thread up early when it is stopped
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stop_flusher_ = false;
+};
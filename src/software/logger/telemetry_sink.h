@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The id a telemetry channel name is interned to
+using TelemetryChannelId = std::uint32_t;
+
+/**
+ * A numeric sample recorded on a telemetry channel
+ */
+struct TelemetrySample
+{
+    TelemetryChannelId channel_id;
+    // Seconds since the epoch of the system clock
+    double timestamp;
+    double value;
+};
+
+/**
+ * Writes batches of telemetry samples somewhere, such as to files or over the network.
+ * Sinks are only called from the telemetry flusher thread.
+ */
+class TelemetrySink
+{
+   public:
+    virtual ~TelemetrySink() = default;
+
+    /**
+     * Writes a batch of samples, all recorded by the same thread in the order they were
+     * recorded
+     *
+     * @param samples The samples to write
+     * @param channel_names The names of the channels, indexed by channel id
+     */
+    virtual void writeSamples(const std::vector<TelemetrySample>& samples,
+                              const std::vector<std::string>& channel_names) = 0;
+
+    /**
+     * Called after every batch of a flush has been written, so that buffered sinks can
+     * flush their output
+     */
+    virtual void flush() {}
+};
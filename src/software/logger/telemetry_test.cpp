@@ -0,0 +1,154 @@
+#include "software/logger/telemetry.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+
+/**
+ * A telemetry sink that stores the samples written to it
+ */
+class FakeTelemetrySink : public TelemetrySink
+{
+   public:
+    // Written by the flusher thread and read by the tests, so guarded by mutex
+    struct WrittenSamples
+    {
+        std::mutex mutex;
+        std::vector<std::vector<TelemetrySample>> batches;
+        std::vector<std::string> channel_names;
+        int num_flushes = 0;
+    };
+
+    explicit FakeTelemetrySink(std::shared_ptr<WrittenSamples> written_samples)
+        : written_samples(written_samples)
+    {
+    }
+
+    void writeSamples(const std::vector<TelemetrySample>& samples,
+                      const std::vector<std::string>& channel_names) override
+    {
+        std::scoped_lock lock(written_samples->mutex);
+        written_samples->batches.push_back(samples);
+        written_samples->channel_names = channel_names;
+    }
+
+    void flush() override
+    {
+        std::scoped_lock lock(written_samples->mutex);
+        written_samples->num_flushes++;
+    }
+
+   private:
+    std::shared_ptr<WrittenSamples> written_samples;
+};
+
+class TelemetryTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        written_samples = std::make_shared<FakeTelemetrySink::WrittenSamples>();
+        std::vector<std::unique_ptr<TelemetrySink>> sinks;
+        sinks.emplace_back(std::make_unique<FakeTelemetrySink>(written_samples));
+
+        // Flush manually in the tests
+        Telemetry::start(std::move(sinks), std::chrono::hours(1));
+    }
+
+    void TearDown() override
+    {
+        Telemetry::stop();
+    }
+
+    std::vector<TelemetrySample> getAllSamples() const
+    {
+        std::scoped_lock lock(written_samples->mutex);
+        std::vector<TelemetrySample> samples;
+        for (const auto& batch : written_samples->batches)
+        {
+            samples.insert(samples.end(), batch.begin(), batch.end());
+        }
+        return samples;
+    }
+
+    std::shared_ptr<FakeTelemetrySink::WrittenSamples> written_samples;
+};
+
+TEST_F(TelemetryTest, channel_names_are_interned)
+{
+    TelemetryChannelId channel_a = Telemetry::getChannelId("telemetry_test/a");
+    TelemetryChannelId channel_b = Telemetry::getChannelId("telemetry_test/b");
+
+    EXPECT_NE(channel_a, channel_b);
+    EXPECT_EQ(channel_a, Telemetry::getChannelId("telemetry_test/a"));
+}
+
+TEST_F(TelemetryTest, samples_are_written_in_order_on_flush)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        TELEMETRY("telemetry_test/count", i);
+        TELEMETRY("telemetry_test/square", i * i);
+    }
+    Telemetry::flush();
+
+    std::vector<TelemetrySample> samples = getAllSamples();
+    ASSERT_EQ(6, samples.size());
+    TelemetryChannelId count_channel  = Telemetry::getChannelId("telemetry_test/count");
+    TelemetryChannelId square_channel = Telemetry::getChannelId("telemetry_test/square");
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(count_channel, samples[2 * i].channel_id);
+        EXPECT_EQ(i, samples[2 * i].value);
+        EXPECT_EQ(square_channel, samples[2 * i + 1].channel_id);
+        EXPECT_EQ(i * i, samples[2 * i + 1].value);
+    }
+    EXPECT_LE(samples.front().timestamp, samples.back().timestamp);
+    std::scoped_lock lock(written_samples->mutex);
+    EXPECT_EQ("telemetry_test/square", written_samples->channel_names.at(square_channel));
+    EXPECT_GE(written_samples->num_flushes, 1);
+}
+
+TEST_F(TelemetryTest, samples_are_not_recorded_when_stopped)
+{
+    Telemetry::stop();
+    TELEMETRY("telemetry_test/stopped", 1.0);
+    Telemetry::flush();
+
+    EXPECT_TRUE(getAllSamples().empty());
+}
+
+TEST_F(TelemetryTest, samples_from_exited_thread_are_written)
+{
+    std::thread thread([]() { TELEMETRY("telemetry_test/thread", 42); });
+    thread.join();
+    Telemetry::flush();
+
+    std::vector<TelemetrySample> samples = getAllSamples();
+    ASSERT_EQ(1, samples.size());
+    EXPECT_EQ(42, samples[0].value);
+
+    // The buffer of the exited thread has been freed, so nothing is written again
+    {
+        std::scoped_lock lock(written_samples->mutex);
+        written_samples->batches.clear();
+    }
+    Telemetry::flush();
+    EXPECT_TRUE(getAllSamples().empty());
+}
+
+TEST_F(TelemetryTest, samples_are_dropped_when_buffer_is_full)
+{
+    std::uint64_t num_dropped_samples = Telemetry::getNumDroppedSamples();
+    for (std::size_t i = 0; i < Telemetry::BUFFER_CAPACITY + 10; i++)
+    {
+        TELEMETRY("telemetry_test/full", i);
+    }
+    Telemetry::flush();
+
+    EXPECT_EQ(num_dropped_samples + 10, Telemetry::getNumDroppedSamples());
+    std::vector<TelemetrySample> samples = getAllSamples();
+    ASSERT_EQ(Telemetry::BUFFER_CAPACITY, samples.size());
+    EXPECT_EQ(Telemetry::BUFFER_CAPACITY - 1, samples.back().value);
+}
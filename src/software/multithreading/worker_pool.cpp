@@ -0,0 +1,116 @@
+#include "software/multithreading/worker_pool.h"
+
+WorkerPool::WorkerPool(unsigned int num_worker_threads)
+    : task_(nullptr),
+      num_tasks_(0),
+      batch_number_(0),
+      num_busy_workers_(0),
+      stopping_(false),
+      next_task_(0),
+      num_finished_tasks_(0)
+{
+    worker_threads_.reserve(num_worker_threads);
+    for (unsigned int i = 0; i < num_worker_threads; i++)
+    {
+        worker_threads_.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::scoped_lock lock(mutex_);
+        stopping_ = true;
+    }
+    batch_started_.notify_all();
+
+    for (std::thread& worker_thread : worker_threads_)
+    {
+        worker_thread.join();
+    }
+}
+
+void WorkerPool::parallelFor(std::size_t num_tasks,
+                             const std::function<void(std::size_t)>& task)
+{
+    if (num_tasks == 0)
+    {
+        return;
+    }
+
+    std::scoped_lock batch_lock(batch_mutex_);
+    {
+        // A worker that woke up too late for the previous batch may still be leaving
+        // it, and must not see the state of this batch change underneath it
+        std::unique_lock lock(mutex_);
+        batch_finished_.wait(lock, [this]() { return num_busy_workers_ == 0; });
+
+        task_      = &task;
+        num_tasks_ = num_tasks;
+        next_task_.store(0);
+        num_finished_tasks_.store(0);
+        batch_number_++;
+    }
+    batch_started_.notify_all();
+
+    runTasks();
+
+    std::unique_lock lock(mutex_);
+    batch_finished_.wait(lock,
+                         [this]() { return num_finished_tasks_.load() == num_tasks_; });
+    task_ = nullptr;
+}
+
+unsigned int WorkerPool::getNumThreads() const
+{
+    return static_cast<unsigned int>(worker_threads_.size()) + 1;
+}
+
+void WorkerPool::workerLoop()
+{
+    std::uint64_t last_batch_number = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(mutex_);
+            batch_started_.wait(lock, [&]()
+                                { return stopping_ || batch_number_ != last_batch_number; });
+            if (stopping_)
+            {
+                return;
+            }
+            last_batch_number = batch_number_;
+            num_busy_workers_++;
+        }
+
+        runTasks();
+
+        {
+            std::scoped_lock lock(mutex_);
+            num_busy_workers_--;
+        }
+        batch_finished_.notify_all();
+    }
+}
+
+void WorkerPool::runTasks()
+{
+    while (true)
+    {
+        const std::size_t task_index = next_task_.fetch_add(1);
+        if (task_index >= num_tasks_)
+        {
+            return;
+        }
+
+        (*task_)(task_index);
+
+        if (num_finished_tasks_.fetch_add(1) + 1 == num_tasks_)
+        {
+            // Take the lock so the notification can't be missed by parallelFor
+            // between checking the condition and starting to wait
+            std::scoped_lock lock(mutex_);
+            batch_finished_.notify_all();
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads that run batches of independent tasks in parallel.
+ *
+ * The threads are started once and wait for work in between batches, so a batch can be
+ * run every AI tick without paying for creating threads. The thread that runs a batch
+ * works on the tasks of the batch as well, so a WorkerPool with no worker threads runs
+ * every task on the calling thread.
+ */
+class WorkerPool
+{
+   public:
+    /**
+     * Creates a WorkerPool and starts its worker threads
+     *
+     * @param num_worker_threads The number of threads to start, in addition to the
+     * thread that runs the batches
+     */
+    explicit WorkerPool(unsigned int num_worker_threads);
+
+    /**
+     * Stops and joins the worker threads
+     */
+    ~WorkerPool();
+
+    // Copying this class is not permitted
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Runs task(0), task(1), ..., task(num_tasks - 1) on the worker threads and the
+     * calling thread, and blocks until all of them have returned. Tasks may run in any
+     * order and must not throw. Batches from different threads are run one at a time.
+     *
+     * @param num_tasks The number of tasks to run
+     * @param task The task to run, which is given the index of the task
+     */
+    void parallelFor(std::size_t num_tasks, const std::function<void(std::size_t)>& task);
+
+    /**
+     * Gets the number of threads that run the tasks of a batch, including the thread
+     * that runs the batch
+     *
+     * @return the number of threads that run tasks
+     */
+    unsigned int getNumThreads() const;
+
+   private:
+    /**
+     * The loop each worker thread runs, waiting for and working on batches
+     */
+    void workerLoop();
+
+    /**
+     * Claims and runs tasks of the current batch until there are none left
+     */
+    void runTasks();
+
+    std::vector<std::thread> worker_threads_;
+
+    // Serializes calls to parallelFor
+    std::mutex batch_mutex_;
+
+    // Guards the state of the current batch below
+    std::mutex mutex_;
+    std::condition_variable batch_started_;
+    std::condition_variable batch_finished_;
+    const std::function<void(std::size_t)>* task_;
+    std::size_t num_tasks_;
+    std::uint64_t batch_number_;
+    unsigned int num_busy_workers_;
+    bool stopping_;
+
+    std::atomic<std::size_t> next_task_;
+    std::atomic<std::size_t> num_finished_tasks_;
+};
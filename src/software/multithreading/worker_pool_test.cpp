@@ -0,0 +1,63 @@
+#include "software/multithreading/worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+TEST(WorkerPoolTest, test_runs_every_task_once)
+{
+    WorkerPool worker_pool(3);
+    EXPECT_EQ(worker_pool.getNumThreads(), 4);
+
+    std::vector<std::atomic<int>> num_runs(1000);
+    worker_pool.parallelFor(num_runs.size(),
+                            [&num_runs](std::size_t i) { num_runs[i].fetch_add(1); });
+
+    for (const std::atomic<int>& runs : num_runs)
+    {
+        EXPECT_EQ(runs.load(), 1);
+    }
+}
+
+TEST(WorkerPoolTest, test_runs_many_batches)
+{
+    WorkerPool worker_pool(2);
+
+    std::vector<int> results(64);
+    for (int batch = 0; batch < 200; batch++)
+    {
+        worker_pool.parallelFor(results.size(), [&results, batch](std::size_t i)
+                                { results[i] = batch + static_cast<int>(i); });
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i], batch + static_cast<int>(i));
+        }
+    }
+}
+
+TEST(WorkerPoolTest, test_runs_tasks_on_calling_thread_without_workers)
+{
+    WorkerPool worker_pool(0);
+    EXPECT_EQ(worker_pool.getNumThreads(), 1);
+
+    const std::thread::id calling_thread_id = std::this_thread::get_id();
+    std::vector<std::thread::id> thread_ids(10);
+    worker_pool.parallelFor(thread_ids.size(), [&thread_ids](std::size_t i)
+                            { thread_ids[i] = std::this_thread::get_id(); });
+
+    for (const std::thread::id& thread_id : thread_ids)
+    {
+        EXPECT_EQ(thread_id, calling_thread_id);
+    }
+}
+
+TEST(WorkerPoolTest, test_empty_batch_returns_immediately)
+{
+    WorkerPool worker_pool(2);
+
+    bool ran_task = false;
+    worker_pool.parallelFor(0, [&ran_task](std::size_t) { ran_task = true; });
+
+    EXPECT_FALSE(ran_task);
+}
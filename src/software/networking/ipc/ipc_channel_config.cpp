@@ -0,0 +1,28 @@
+#include "software/networking/ipc/ipc_channel_config.h"
+
+#include <sstream>
+
+IpcChannelConfig::IpcChannelConfig(const std::string& shared_memory_channels)
+{
+    std::istringstream channels(shared_memory_channels);
+    std::string channel;
+    while (std::getline(channels, channel, ','))
+    {
+        const std::size_t start = channel.find_first_not_of(" \t");
+        if (start == std::string::npos)
+        {
+            continue;
+        }
+        const std::size_t end = channel.find_last_not_of(" \t");
+        shared_memory_channels_.insert(channel.substr(start, end - start + 1));
+    }
+}
+
+IpcTransport IpcChannelConfig::getTransport(const std::string& channel) const
+{
+    if (shared_memory_channels_.contains(channel))
+    {
+        return IpcTransport::SHARED_MEMORY;
+    }
+    return IpcTransport::UNIX_SOCKET;
+}
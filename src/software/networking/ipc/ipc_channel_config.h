@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include "software/util/make_enum/make_enum.hpp"
+
+MAKE_ENUM(IpcTransport, UNIX_SOCKET, SHARED_MEMORY);
+
+/**
+ * Selects the transport that each channel between full_system, the simulator and
+ * Thunderscope uses. Channels are named by their path relative to the runtime
+ * directory (ex. "/world"), and use unix sockets unless they are selected to use shared
+ * memory.
+ */
+class IpcChannelConfig
+{
+   public:
+    /**
+     * Creates an IpcChannelConfig
+     *
+     * @param shared_memory_channels A comma-separated list of the channels that use
+     * shared memory (ex. "/world,/primitive")
+     */
+    explicit IpcChannelConfig(const std::string& shared_memory_channels = "");
+
+    /**
+     * Gets the transport the given channel uses
+     *
+     * @param channel The path of the channel relative to the runtime directory
+     *
+     * @return the transport of the channel
+     */
+    IpcTransport getTransport(const std::string& channel) const;
+
+   private:
+    std::unordered_set<std::string> shared_memory_channels_;
+};
@@ -0,0 +1,20 @@
+#include "software/networking/ipc/ipc_channel_config.h"
+
+#include <gtest/gtest.h>
+
+TEST(IpcChannelConfigTest, channels_use_unix_sockets_by_default)
+{
+    IpcChannelConfig config;
+
+    EXPECT_EQ(IpcTransport::UNIX_SOCKET, config.getTransport("/world"));
+}
+
+TEST(IpcChannelConfigTest, selected_channels_use_shared_memory)
+{
+    IpcChannelConfig config("/world, /primitive,,");
+
+    EXPECT_EQ(IpcTransport::SHARED_MEMORY, config.getTransport("/world"));
+    EXPECT_EQ(IpcTransport::SHARED_MEMORY, config.getTransport("/primitive"));
+    EXPECT_EQ(IpcTransport::UNIX_SOCKET, config.getTransport("/log"));
+    EXPECT_EQ(IpcTransport::UNIX_SOCKET, config.getTransport(""));
+}
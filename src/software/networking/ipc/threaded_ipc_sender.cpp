@@ -0,0 +1,39 @@
+#include "software/networking/ipc/threaded_ipc_sender.h"
+
+#include <iostream>
+
+ThreadedIpcSender::ThreadedIpcSender(const std::string& path, IpcTransport transport)
+    : path_(path)
+{
+    if (transport == IpcTransport::SHARED_MEMORY)
+    {
+        shared_memory_writer_ = std::make_unique<SharedMemoryRingWriter>(path);
+    }
+    else
+    {
+        unix_sender_ = std::make_unique<ThreadedUnixSender>(path);
+    }
+}
+
+void ThreadedIpcSender::sendString(const std::string& message)
+{
+    if (unix_sender_)
+    {
+        unix_sender_->sendString(message);
+        return;
+    }
+
+    if (!shared_memory_writer_->write(message))
+    {
+        log_counter_++;
+        if (log_counter_ > MAX_SEND_FAILURES_BEFORE_LOG)
+        {
+            // NOTE: g3log relies on the ThreadedIpcSender so we can't use g3log here
+            // without creating a circular dependency
+            std::cerr << "\033[33m Shared Memory Send Failure for " << path_ << ". "
+                      << message.size() << " byte message is larger than a slot\033[m"
+                      << std::endl;
+            log_counter_ = 0;
+        }
+    }
+}
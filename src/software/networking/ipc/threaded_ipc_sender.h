@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/shm/shared_memory_ring.h"
+#include "software/networking/unix/threaded_unix_sender.h"
+
+/**
+ * Sends strings over a channel using either a unix socket or a shared memory ring
+ */
+class ThreadedIpcSender
+{
+   public:
+    /**
+     * Creates a ThreadedIpcSender
+     *
+     * @param path The path of the unix socket to send to, which also names the shared
+     * memory ring of the channel
+     * @param transport The transport to send over
+     */
+    ThreadedIpcSender(const std::string& path, IpcTransport transport);
+
+    /**
+     * Sends the string over the channel
+     *
+     * @param message The string message to send
+     */
+    void sendString(const std::string& message);
+
+   private:
+    std::string path_;
+
+    // Only the sender of the selected transport is created
+    std::unique_ptr<ThreadedUnixSender> unix_sender_;
+    std::unique_ptr<SharedMemoryRingWriter> shared_memory_writer_;
+
+    // Failed to send log throttling
+    const unsigned MAX_SEND_FAILURES_BEFORE_LOG = 100;
+    unsigned log_counter_                       = 0;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/shm/threaded_proto_shm_listener.hpp"
+#include "software/networking/unix/threaded_proto_unix_listener.hpp"
+
+/**
+ * A threaded listener that receives serialized ReceiveProtoT protos over a channel using
+ * the transport selected for it
+ */
+template <class ReceiveProtoT>
+class ThreadedProtoIpcListener
+{
+   public:
+    /**
+     * Listens for messages over the channel and triggers the receive_callback on a new
+     * message.
+     *
+     * @param path The path of the unix socket to listen on, which also names the shared
+     * memory ring of the channel
+     * @param transport The transport to listen over
+     * @param receive_callback The callback to trigger on a new message
+     * @param proto_logger The proto logger to save the received messages to
+     */
+    ThreadedProtoIpcListener(const std::string& path, IpcTransport transport,
+                             std::function<void(ReceiveProtoT&)> receive_callback,
+                             const std::shared_ptr<ProtoLogger>& proto_logger = nullptr)
+    {
+        if (transport == IpcTransport::SHARED_MEMORY)
+        {
+            shared_memory_listener_ =
+                std::make_unique<ThreadedProtoShmListener<ReceiveProtoT>>(
+                    path, receive_callback, proto_logger);
+        }
+        else
+        {
+            unix_listener_ = std::make_unique<ThreadedProtoUnixListener<ReceiveProtoT>>(
+                path, receive_callback, proto_logger);
+        }
+    }
+
+   private:
+    // Only the listener of the selected transport is created
+    std::unique_ptr<ThreadedProtoUnixListener<ReceiveProtoT>> unix_listener_;
+    std::unique_ptr<ThreadedProtoShmListener<ReceiveProtoT>> shared_memory_listener_;
+};
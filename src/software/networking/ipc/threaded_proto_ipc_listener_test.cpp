@@ -0,0 +1,69 @@
+#include "software/networking/ipc/threaded_proto_ipc_listener.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "google/protobuf/wrappers.pb.h"
+#include "software/networking/ipc/threaded_proto_ipc_sender.hpp"
+
+class ThreadedProtoIpcListenerTest : public ::testing::TestWithParam<IpcTransport>
+{
+   protected:
+    void SetUp() override
+    {
+        SharedMemoryRingWriter::unlink(PATH);
+    }
+
+    void TearDown() override
+    {
+        SharedMemoryRingWriter::unlink(PATH);
+    }
+
+    const std::string PATH = "/tmp/threaded_proto_ipc_listener_test";
+};
+
+TEST_P(ThreadedProtoIpcListenerTest, receives_every_message_in_order)
+{
+    constexpr int NUM_MESSAGES = 50;
+
+    std::mutex mutex;
+    std::condition_variable message_received;
+    std::vector<std::string> received;
+
+    ThreadedProtoIpcListener<google::protobuf::StringValue> listener(
+        PATH, GetParam(),
+        [&](const google::protobuf::StringValue& message)
+        {
+            std::scoped_lock lock(mutex);
+            received.push_back(message.value());
+            message_received.notify_all();
+        });
+    ThreadedProtoIpcSender<google::protobuf::StringValue> sender(PATH, GetParam());
+
+    for (int i = 0; i < NUM_MESSAGES; i++)
+    {
+        google::protobuf::StringValue message;
+        message.set_value(std::to_string(i));
+        sender.sendProto(message);
+
+        // Pace the messages so that the unix socket doesn't drop any
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(message_received.wait_for(
+        lock, std::chrono::seconds(5), [&] { return received.size() == NUM_MESSAGES; }));
+    for (int i = 0; i < NUM_MESSAGES; i++)
+    {
+        EXPECT_EQ(std::to_string(i), received[i]);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllTransports, ThreadedProtoIpcListenerTest,
+                        ::testing::Values(IpcTransport::UNIX_SOCKET,
+                                          IpcTransport::SHARED_MEMORY));
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+#include "software/logger/proto_logger.h"
+#include "software/networking/ipc/threaded_ipc_sender.h"
+
+/**
+ * Sends protobufs over a channel using the transport selected for it
+ */
+template <class SendProto>
+class ThreadedProtoIpcSender : private ThreadedIpcSender
+{
+   public:
+    /**
+     * Create a ThreadedProtoIpcSender
+     *
+     * @param path The path of the unix socket to send to, which also names the shared
+     * memory ring of the channel
+     * @param transport The transport to send over
+     * @param proto_logger The proto logger to save the sent messages to
+     */
+    ThreadedProtoIpcSender(const std::string& path, IpcTransport transport,
+                           const std::shared_ptr<ProtoLogger>& proto_logger = nullptr)
+        : ThreadedIpcSender(path, transport), proto_logger(proto_logger)
+    {
+    }
+
+    /**
+     * Sends a protobuf message over the channel
+     *
+     * @param message The protobuf message to send
+     */
+    void sendProto(const SendProto& message);
+
+   private:
+    std::string data_buffer;
+
+    std::shared_ptr<ProtoLogger> proto_logger;
+};
+
+template <class SendProtoT>
+void ThreadedProtoIpcSender<SendProtoT>::sendProto(const SendProtoT& message)
+{
+    message.SerializeToString(&data_buffer);
+    sendString(data_buffer);
+
+    if (proto_logger)
+    {
+        proto_logger->saveSerializedProto<SendProtoT>(data_buffer);
+    }
+}
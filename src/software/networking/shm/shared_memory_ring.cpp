@@ -0,0 +1,441 @@
+#include "software/networking/shm/shared_memory_ring.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "software/networking/tbots_network_exception.h"
+
+namespace
+{
+// Marks a ring that has been initialized by its writer, and the version of its layout
+constexpr std::uint32_t RING_MAGIC   = 0x54425348;
+constexpr std::uint32_t RING_VERSION = 1;
+
+// Shared fields are kept on separate cache lines so that readers polling the write
+// index don't contend with the counters
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// How often a reader checks if the writer has created the ring
+constexpr std::chrono::milliseconds MAP_POLL_PERIOD{10};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free &&
+                  std::atomic<std::uint64_t>::is_always_lock_free,
+              "Atomics shared between processes must be lock-free");
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "The futex word must have the layout of a uint32_t");
+
+/**
+ * The header at the start of a ring
+ */
+struct RingHeader
+{
+    std::atomic<std::uint32_t> magic;
+    std::uint32_t version;
+    std::uint64_t slot_count;
+    std::uint64_t slot_size;
+
+    // The sequence number of the next message to write
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> write_index;
+
+    // Incremented on every write, and waited on by readers
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint32_t> futex_word;
+    std::atomic<std::uint32_t> num_waiters;
+    std::atomic<std::uint64_t> num_total_overruns;
+};
+
+/**
+ * The header at the start of every slot, which is followed by the message
+ */
+struct SlotHeader
+{
+    // One more than the sequence number of the message in the slot, or 0 while the
+    // slot is being written
+    std::atomic<std::uint64_t> sequence;
+    std::atomic<std::uint32_t> size;
+};
+
+constexpr std::size_t roundUpToCacheLine(std::size_t size)
+{
+    return (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+constexpr std::size_t RING_HEADER_SIZE = roundUpToCacheLine(sizeof(RingHeader));
+
+constexpr std::size_t getSlotStride(std::size_t slot_size)
+{
+    return roundUpToCacheLine(sizeof(SlotHeader) + slot_size);
+}
+
+constexpr std::size_t getRingSize(std::size_t slot_count, std::size_t slot_size)
+{
+    return RING_HEADER_SIZE + slot_count * getSlotStride(slot_size);
+}
+
+RingHeader& getRingHeader(void* memory)
+{
+    return *static_cast<RingHeader*>(memory);
+}
+
+SlotHeader& getSlotHeader(void* memory, std::size_t slot_stride, std::size_t slot_count,
+                          std::uint64_t index)
+{
+    char* slot = static_cast<char*>(memory) + RING_HEADER_SIZE +
+                 (index % slot_count) * slot_stride;
+    return *reinterpret_cast<SlotHeader*>(slot);
+}
+
+char* getSlotData(SlotHeader& slot_header)
+{
+    return reinterpret_cast<char*>(&slot_header) + sizeof(SlotHeader);
+}
+
+/**
+ * Waits on the futex word while it still holds the expected value. The futex isn't
+ * private since it is shared between processes.
+ */
+void futexWait(std::atomic<std::uint32_t>& futex_word, std::uint32_t expected,
+               const timespec& timeout)
+{
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&futex_word), FUTEX_WAIT,
+            expected, &timeout, nullptr, 0);
+}
+
+void futexWakeAll(std::atomic<std::uint32_t>& futex_word)
+{
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&futex_word), FUTEX_WAKE,
+            INT_MAX, nullptr, nullptr, 0);
+}
+}  // namespace
+
+std::string getSharedMemoryRingName(const std::string& channel_path)
+{
+    std::string name = channel_path.substr(channel_path.find_first_not_of('/'));
+    std::replace(name.begin(), name.end(), '/', '.');
+    return "/" + name;
+}
+
+SharedMemoryRingWriter::SharedMemoryRingWriter(const std::string& channel_path,
+                                               std::size_t slot_count,
+                                               std::size_t slot_size)
+    : channel_path_(channel_path),
+      memory_size_(getRingSize(slot_count, slot_size)),
+      slot_count_(slot_count),
+      slot_size_(slot_size),
+      slot_stride_(getSlotStride(slot_size))
+{
+    const std::string name = getSharedMemoryRingName(channel_path);
+
+    // Reuse the ring if it already exists with the same layout, so that readers that
+    // have mapped it keep receiving messages when the writer is restarted
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd >= 0)
+    {
+        struct stat ring_stat;
+        if (fstat(fd, &ring_stat) == 0 &&
+            static_cast<std::size_t>(ring_stat.st_size) == memory_size_)
+        {
+            void* memory =
+                mmap(nullptr, memory_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (memory != MAP_FAILED)
+            {
+                const RingHeader& header = getRingHeader(memory);
+                if (header.magic.load(std::memory_order_acquire) == RING_MAGIC &&
+                    header.version == RING_VERSION && header.slot_count == slot_count &&
+                    header.slot_size == slot_size)
+                {
+                    memory_ = memory;
+                }
+                else
+                {
+                    munmap(memory, memory_size_);
+                }
+            }
+        }
+        close(fd);
+    }
+
+    if (memory_)
+    {
+        return;
+    }
+
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+    if (fd < 0)
+    {
+        throw TbotsNetworkException("Failed to create shared memory ring " + name + ": " +
+                                    std::strerror(errno));
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(memory_size_)) != 0)
+    {
+        const std::string error = std::strerror(errno);
+        close(fd);
+        throw TbotsNetworkException("Failed to size shared memory ring " + name + ": " +
+                                    error);
+    }
+
+    void* memory =
+        mmap(nullptr, memory_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        throw TbotsNetworkException("Failed to map shared memory ring " + name + ": " +
+                                    std::strerror(errno));
+    }
+
+    // The memory of a new shared memory object is zeroed, so every slot starts out
+    // empty. The magic is set last so that readers only map the ring once it is ready.
+    RingHeader* header = new (memory) RingHeader{};
+    header->version    = RING_VERSION;
+    header->slot_count = slot_count;
+    header->slot_size  = slot_size;
+    header->magic.store(RING_MAGIC, std::memory_order_release);
+
+    memory_ = memory;
+}
+
+SharedMemoryRingWriter::~SharedMemoryRingWriter()
+{
+    munmap(memory_, memory_size_);
+}
+
+bool SharedMemoryRingWriter::write(std::span<const char> message)
+{
+    if (message.size() > slot_size_)
+    {
+        return false;
+    }
+
+    RingHeader& header        = getRingHeader(memory_);
+    const std::uint64_t index = header.write_index.load(std::memory_order_relaxed);
+    SlotHeader& slot = getSlotHeader(memory_, slot_stride_, slot_count_, index);
+
+    // Clear the sequence number before overwriting the slot, so that a reader copying
+    // the old message out of the slot can tell that it was overwritten
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(getSlotData(slot), message.data(), message.size());
+    slot.size.store(static_cast<std::uint32_t>(message.size()),
+                    std::memory_order_relaxed);
+    slot.sequence.store(index + 1, std::memory_order_release);
+    header.write_index.store(index + 1, std::memory_order_seq_cst);
+
+    // Only make the wake up syscall if a reader is waiting. A reader that starts
+    // waiting after the futex word was incremented sees the new value and doesn't
+    // sleep.
+    header.futex_word.fetch_add(1, std::memory_order_seq_cst);
+    if (header.num_waiters.load(std::memory_order_seq_cst) > 0)
+    {
+        futexWakeAll(header.futex_word);
+    }
+
+    return true;
+}
+
+std::uint64_t SharedMemoryRingWriter::getNumMessagesWritten() const
+{
+    return getRingHeader(memory_).write_index.load(std::memory_order_acquire);
+}
+
+void SharedMemoryRingWriter::unlink(const std::string& channel_path)
+{
+    shm_unlink(getSharedMemoryRingName(channel_path).c_str());
+}
+
+SharedMemoryRingReader::SharedMemoryRingReader(const std::string& channel_path)
+    : channel_path_(channel_path)
+{
+    tryMap(false);
+}
+
+SharedMemoryRingReader::~SharedMemoryRingReader()
+{
+    if (memory_)
+    {
+        munmap(memory_, memory_size_);
+    }
+}
+
+bool SharedMemoryRingReader::read(std::string& message, std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    // Poll for the writer to create the ring. Every message in the ring was written
+    // after this reader was created, so they are all read.
+    while (!memory_ && !tryMap(true))
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+            MAP_POLL_PERIOD, deadline - now));
+    }
+
+    RingHeader& header = getRingHeader(memory_);
+
+    std::uint64_t read_index = read_index_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const std::uint64_t write_index =
+            header.write_index.load(std::memory_order_acquire);
+        if (read_index == write_index)
+        {
+            if (!waitForMessage(deadline))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        // Skip the messages that have already been overwritten
+        if (write_index - read_index > slot_count_)
+        {
+            countOverruns(write_index - slot_count_ - read_index);
+            read_index = write_index - slot_count_;
+        }
+
+        SlotHeader& slot = getSlotHeader(memory_, slot_stride_, slot_count_, read_index);
+        if (slot.sequence.load(std::memory_order_acquire) == read_index + 1)
+        {
+            const std::uint32_t size = slot.size.load(std::memory_order_relaxed);
+            if (size <= slot_size_)
+            {
+                message.assign(getSlotData(slot), size);
+
+                // The message is only valid if the writer didn't start overwriting the
+                // slot while it was being copied
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == read_index + 1)
+                {
+                    read_index_.store(read_index + 1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        // The writer lapped this reader and overwrote the slot before it was read
+        countOverruns(1);
+        read_index++;
+        read_index_.store(read_index, std::memory_order_relaxed);
+    }
+}
+
+SharedMemoryRingStats SharedMemoryRingReader::getStats() const
+{
+    if (!memory_)
+    {
+        return SharedMemoryRingStats();
+    }
+
+    const RingHeader& header        = getRingHeader(memory_);
+    const std::uint64_t write_index = header.write_index.load(std::memory_order_acquire);
+
+    const std::uint64_t read_index  = read_index_.load(std::memory_order_relaxed);
+
+    SharedMemoryRingStats stats;
+    stats.occupancy = static_cast<std::size_t>(
+        std::min<std::uint64_t>(write_index - read_index, slot_count_));
+    stats.capacity             = slot_count_;
+    stats.num_overruns         = num_overruns_.load(std::memory_order_relaxed);
+    stats.num_total_overruns   = header.num_total_overruns.load();
+    stats.num_messages_written = write_index;
+    return stats;
+}
+
+bool SharedMemoryRingReader::tryMap(bool read_oldest)
+{
+    const int fd =
+        shm_open(getSharedMemoryRingName(channel_path_).c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat ring_stat;
+    if (fstat(fd, &ring_stat) != 0 ||
+        static_cast<std::size_t>(ring_stat.st_size) < RING_HEADER_SIZE)
+    {
+        close(fd);
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(ring_stat.st_size);
+    void* memory    = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const RingHeader& header = getRingHeader(memory);
+    if (header.magic.load(std::memory_order_acquire) != RING_MAGIC ||
+        header.version != RING_VERSION ||
+        getRingSize(header.slot_count, header.slot_size) != size)
+    {
+        munmap(memory, size);
+        return false;
+    }
+
+    memory_      = memory;
+    memory_size_ = size;
+    slot_count_  = header.slot_count;
+    slot_size_   = header.slot_size;
+    slot_stride_ = getSlotStride(slot_size_);
+    const std::uint64_t write_index = header.write_index.load(std::memory_order_acquire);
+    read_index_.store(
+        read_oldest ? write_index - std::min<std::uint64_t>(write_index, slot_count_)
+                    : write_index,
+        std::memory_order_relaxed);
+    return true;
+}
+
+bool SharedMemoryRingReader::waitForMessage(
+    std::chrono::steady_clock::time_point deadline)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline)
+    {
+        return false;
+    }
+
+    // Register as a waiter before checking for a message, so that the writer either
+    // sees the waiter and wakes it up, or wrote the message before the check below
+    RingHeader& header = getRingHeader(memory_);
+    header.num_waiters.fetch_add(1, std::memory_order_seq_cst);
+    const std::uint32_t futex_word = header.futex_word.load(std::memory_order_seq_cst);
+    if (header.write_index.load(std::memory_order_seq_cst) ==
+        read_index_.load(std::memory_order_relaxed))
+    {
+        const auto remaining =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+        const timespec timeout = {
+            .tv_sec  = static_cast<time_t>(remaining.count() / 1'000'000'000),
+            .tv_nsec = static_cast<long>(remaining.count() % 1'000'000'000)};
+        futexWait(header.futex_word, futex_word, timeout);
+    }
+    header.num_waiters.fetch_sub(1, std::memory_order_seq_cst);
+    return true;
+}
+
+void SharedMemoryRingReader::countOverruns(std::uint64_t num_overruns)
+{
+    num_overruns_.fetch_add(num_overruns, std::memory_order_relaxed);
+    getRingHeader(memory_).num_total_overruns.fetch_add(num_overruns,
+                                                        std::memory_order_relaxed);
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "software/constants.h"
+
+/**
+ * A ring of message slots in POSIX shared memory that one process writes to and any
+ * number of processes read from, so that messages between processes on the same machine
+ * are copied straight into and out of the memory the processes share instead of going
+ * through a socket.
+ *
+ * The ring is single-producer multiple-consumer and lock-free. Every slot has a sequence
+ * number that the writer clears before it overwrites the slot and sets once the message
+ * in the slot is complete, so a reader can tell when the writer overwrote a slot while
+ * it was being read. Readers never block the writer: each reader keeps its own position
+ * in the ring, and a reader that falls more than a ring behind skips the messages that
+ * were overwritten and counts them as overruns.
+ *
+ * Readers wait for new messages on a futex in the shared memory, which the writer only
+ * wakes when a reader is waiting on it.
+ */
+
+// The number of messages a ring holds by default
+static constexpr std::size_t SHARED_MEMORY_RING_DEFAULT_SLOT_COUNT = 64;
+
+// The largest message a ring holds by default, which is the same as the largest message
+// that can be sent over a unix socket
+static constexpr std::size_t SHARED_MEMORY_RING_DEFAULT_SLOT_SIZE = UNIX_BUFFER_SIZE;
+
+/**
+ * The occupancy and overrun counters of a shared memory ring, as seen by one reader
+ */
+struct SharedMemoryRingStats
+{
+    // The number of messages written that the reader hasn't read yet
+    std::size_t occupancy = 0;
+
+    // The number of messages the ring holds
+    std::size_t capacity = 0;
+
+    // The number of messages the reader missed because they were overwritten before
+    // they were read
+    std::uint64_t num_overruns = 0;
+
+    // The number of messages missed by all readers of the ring
+    std::uint64_t num_total_overruns = 0;
+
+    // The number of messages written to the ring
+    std::uint64_t num_messages_written = 0;
+};
+
+/**
+ * Gets the name of the shared memory object for the ring of the given channel
+ *
+ * @param channel_path The path of the channel, for example the path of the unix socket
+ * the channel would otherwise use
+ *
+ * @return the name of the shared memory object, which is the path with its slashes
+ * replaced so that it is a valid shared memory object name
+ */
+std::string getSharedMemoryRingName(const std::string& channel_path);
+
+/**
+ * Writes messages to the shared memory ring of a channel, creating the ring if it
+ * doesn't exist yet
+ */
+class SharedMemoryRingWriter
+{
+   public:
+    /**
+     * Creates a SharedMemoryRingWriter. If the ring of the channel already exists with
+     * the same layout, it is reused so that readers mapping it keep receiving messages.
+     * Otherwise, the ring is created, and readers mapping an old ring must be restarted.
+     *
+     * @param channel_path The path of the channel to write to
+     * @param slot_count The number of messages the ring holds
+     * @param slot_size The size of the largest message the ring holds, in bytes
+     *
+     * @throws TbotsNetworkException if the ring couldn't be created
+     */
+    explicit SharedMemoryRingWriter(
+        const std::string& channel_path,
+        std::size_t slot_count = SHARED_MEMORY_RING_DEFAULT_SLOT_COUNT,
+        std::size_t slot_size  = SHARED_MEMORY_RING_DEFAULT_SLOT_SIZE);
+
+    ~SharedMemoryRingWriter();
+
+    SharedMemoryRingWriter(const SharedMemoryRingWriter&)            = delete;
+    SharedMemoryRingWriter& operator=(const SharedMemoryRingWriter&) = delete;
+
+    /**
+     * Writes a message to the ring and wakes up any readers waiting for it. This never
+     * blocks.
+     *
+     * @param message The message to write
+     *
+     * @return true if the message was written, false if it is larger than a slot
+     */
+    bool write(std::span<const char> message);
+
+    /**
+     * Gets the number of messages written to the ring
+     *
+     * @return the number of messages written to the ring by any writer
+     */
+    std::uint64_t getNumMessagesWritten() const;
+
+    /**
+     * Removes the name of the ring of the given channel, so that the next writer
+     * creates a new ring. Processes that have already mapped the ring keep it until
+     * they unmap it.
+     *
+     * @param channel_path The path of the channel
+     */
+    static void unlink(const std::string& channel_path);
+
+   private:
+    std::string channel_path_;
+    void* memory_            = nullptr;
+    std::size_t memory_size_ = 0;
+    std::size_t slot_count_  = 0;
+    std::size_t slot_size_   = 0;
+    std::size_t slot_stride_ = 0;
+};
+
+/**
+ * Reads messages from the shared memory ring of a channel. A reader only reads messages
+ * written after it was created.
+ *
+ * A reader can be created before the writer of its channel, in which case it maps the
+ * ring once the writer creates it, and reads every message still in the ring.
+ *
+ * Only one thread may read from a reader at a time, but its stats can be gotten from any
+ * thread.
+ */
+class SharedMemoryRingReader
+{
+   public:
+    /**
+     * Creates a SharedMemoryRingReader
+     *
+     * @param channel_path The path of the channel to read from
+     */
+    explicit SharedMemoryRingReader(const std::string& channel_path);
+
+    ~SharedMemoryRingReader();
+
+    SharedMemoryRingReader(const SharedMemoryRingReader&)            = delete;
+    SharedMemoryRingReader& operator=(const SharedMemoryRingReader&) = delete;
+
+    /**
+     * Reads the next message from the ring, waiting up to the timeout for one to be
+     * written
+     *
+     * @param message The string to copy the message into. Its capacity is reused.
+     * @param timeout How long to wait for a message
+     *
+     * @return true if a message was read, false if the timeout expired first
+     */
+    bool read(std::string& message, std::chrono::milliseconds timeout);
+
+    /**
+     * Gets the occupancy and overrun counters of the ring as seen by this reader
+     *
+     * @return the counters, which are all zero if the ring hasn't been mapped yet
+     */
+    SharedMemoryRingStats getStats() const;
+
+   private:
+    /**
+     * Maps the ring of the channel if it exists and has been initialized by its writer
+     *
+     * @param read_oldest Whether to start reading from the oldest message in the ring
+     * instead of only reading messages written after it is mapped
+     *
+     * @return true if the ring is mapped
+     */
+    bool tryMap(bool read_oldest);
+
+    /**
+     * Waits for the writer to write a new message, or for the deadline to pass
+     *
+     * @param deadline When to stop waiting
+     *
+     * @return false if the deadline passed before waiting, true otherwise
+     */
+    bool waitForMessage(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Counts messages this reader missed because they were overwritten
+     *
+     * @param num_overruns The number of messages missed
+     */
+    void countOverruns(std::uint64_t num_overruns);
+
+    std::string channel_path_;
+    void* memory_            = nullptr;
+    std::size_t memory_size_ = 0;
+    std::size_t slot_count_  = 0;
+    std::size_t slot_size_   = 0;
+    std::size_t slot_stride_ = 0;
+
+    // The sequence number of the next message to read. These are only written by the
+    // reading thread, and are atomic so that the stats can be gotten from other threads.
+    std::atomic<std::uint64_t> read_index_   = 0;
+    std::atomic<std::uint64_t> num_overruns_ = 0;
+};
@@ -0,0 +1,205 @@
+#include "software/networking/shm/shared_memory_ring.h"
+
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <optional>
+#include <thread>
+
+class SharedMemoryRingTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        SharedMemoryRingWriter::unlink(CHANNEL_PATH);
+    }
+
+    void TearDown() override
+    {
+        SharedMemoryRingWriter::unlink(CHANNEL_PATH);
+    }
+
+    const std::string CHANNEL_PATH          = "/tmp/tbots/shared_memory_ring_test";
+    const std::chrono::milliseconds TIMEOUT = std::chrono::milliseconds(100);
+};
+
+TEST_F(SharedMemoryRingTest, get_shared_memory_ring_name)
+{
+    EXPECT_EQ("/tmp.tbots.blue.world", getSharedMemoryRingName("/tmp/tbots/blue/world"));
+    EXPECT_EQ("/log", getSharedMemoryRingName("log"));
+}
+
+TEST_F(SharedMemoryRingTest, reads_messages_in_order)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+
+    for (int i = 0; i < 20; i++)
+    {
+        const std::string sent = "message " + std::to_string(i);
+        ASSERT_TRUE(writer.write(sent));
+
+        std::string received;
+        ASSERT_TRUE(reader.read(received, TIMEOUT));
+        EXPECT_EQ(sent, received);
+    }
+
+    EXPECT_EQ(0, reader.getStats().num_overruns);
+}
+
+TEST_F(SharedMemoryRingTest, read_times_out_without_messages)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+
+    std::string received;
+    EXPECT_FALSE(reader.read(received, std::chrono::milliseconds(10)));
+}
+
+TEST_F(SharedMemoryRingTest, reader_only_reads_messages_written_after_it_mapped_the_ring)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    ASSERT_TRUE(writer.write(std::string("old")));
+
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+    ASSERT_TRUE(writer.write(std::string("new")));
+
+    std::string received;
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("new", received);
+}
+
+TEST_F(SharedMemoryRingTest, reader_created_before_writer)
+{
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+    std::string received;
+    EXPECT_FALSE(reader.read(received, std::chrono::milliseconds(1)));
+    EXPECT_EQ(0, reader.getStats().capacity);
+
+    // The reader maps the ring once it is created, and reads the messages written
+    // before then
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    ASSERT_TRUE(writer.write(std::string("first")));
+    ASSERT_TRUE(writer.write(std::string("second")));
+
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("first", received);
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("second", received);
+    EXPECT_EQ(8, reader.getStats().capacity);
+}
+
+TEST_F(SharedMemoryRingTest, rejects_message_larger_than_slot)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+
+    EXPECT_TRUE(writer.write(std::string(64, 'a')));
+    EXPECT_FALSE(writer.write(std::string(65, 'a')));
+    EXPECT_EQ(1, writer.getNumMessagesWritten());
+}
+
+TEST_F(SharedMemoryRingTest, counts_overruns_when_reader_falls_behind)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+
+    for (int i = 0; i < 13; i++)
+    {
+        ASSERT_TRUE(writer.write(std::to_string(i)));
+    }
+
+    SharedMemoryRingStats stats = reader.getStats();
+    EXPECT_EQ(8, stats.occupancy);
+    EXPECT_EQ(8, stats.capacity);
+    EXPECT_EQ(13, stats.num_messages_written);
+
+    // The oldest 5 messages were overwritten, so the reader skips to the oldest message
+    // still in the ring
+    std::string received;
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("5", received);
+
+    stats = reader.getStats();
+    EXPECT_EQ(7, stats.occupancy);
+    EXPECT_EQ(5, stats.num_overruns);
+    EXPECT_EQ(5, stats.num_total_overruns);
+}
+
+TEST_F(SharedMemoryRingTest, every_reader_reads_every_message)
+{
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 8, 64);
+    SharedMemoryRingReader first_reader(CHANNEL_PATH);
+    SharedMemoryRingReader second_reader(CHANNEL_PATH);
+
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(writer.write(std::to_string(i)));
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        std::string received;
+        ASSERT_TRUE(first_reader.read(received, TIMEOUT));
+        EXPECT_EQ(std::to_string(i), received);
+        ASSERT_TRUE(second_reader.read(received, TIMEOUT));
+        EXPECT_EQ(std::to_string(i), received);
+    }
+}
+
+TEST_F(SharedMemoryRingTest, restarted_writer_reuses_ring)
+{
+    std::optional<SharedMemoryRingWriter> writer;
+    writer.emplace(CHANNEL_PATH, 8, 64);
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+
+    ASSERT_TRUE(writer->write(std::string("before")));
+    writer.reset();
+    writer.emplace(CHANNEL_PATH, 8, 64);
+    ASSERT_TRUE(writer->write(std::string("after")));
+
+    std::string received;
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("before", received);
+    ASSERT_TRUE(reader.read(received, TIMEOUT));
+    EXPECT_EQ("after", received);
+}
+
+TEST_F(SharedMemoryRingTest, waiting_reader_is_woken_up_by_writer_in_another_process)
+{
+    constexpr int NUM_MESSAGES = 1000;
+
+    SharedMemoryRingWriter writer(CHANNEL_PATH, 16, 64);
+    SharedMemoryRingReader reader(CHANNEL_PATH);
+
+    const pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+    if (pid == 0)
+    {
+        // Pace the messages so that the reader keeps up and has to wait for each one
+        SharedMemoryRingWriter child_writer(CHANNEL_PATH, 16, 64);
+        for (int i = 0; i < NUM_MESSAGES; i++)
+        {
+            child_writer.write(std::to_string(i));
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        _exit(0);
+    }
+
+    int num_received = 0;
+    std::string received;
+    while (num_received + reader.getStats().num_overruns < NUM_MESSAGES &&
+           reader.read(received, std::chrono::seconds(1)))
+    {
+        EXPECT_EQ(std::to_string(num_received + reader.getStats().num_overruns),
+                  received);
+        num_received++;
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    const SharedMemoryRingStats stats = reader.getStats();
+    EXPECT_EQ(NUM_MESSAGES, num_received + stats.num_overruns);
+    EXPECT_EQ(0, stats.occupancy);
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "software/logger/logger.h"
+#include "software/logger/proto_logger.h"
+#include "software/networking/shm/shared_memory_ring.h"
+#include "software/util/typename/typename.h"
+
+/**
+ * A threaded listener that receives serialized ReceiveProtoT protos from the shared
+ * memory ring of a channel
+ */
+template <class ReceiveProtoT>
+class ThreadedProtoShmListener
+{
+   public:
+    /**
+     * Listens for messages on the shared memory ring of the channel and triggers the
+     * receive_callback on a new message.
+     *
+     * @param channel_path The path of the channel to listen on
+     * @param receive_callback The callback to trigger on a new message
+     * @param proto_logger The proto logger to save the received messages to
+     */
+    ThreadedProtoShmListener(const std::string& channel_path,
+                             std::function<void(ReceiveProtoT&)> receive_callback,
+                             const std::shared_ptr<ProtoLogger>& proto_logger = nullptr);
+
+    ~ThreadedProtoShmListener();
+
+    /**
+     * Gets the occupancy and overrun counters of the ring as seen by this listener
+     *
+     * @return the counters of the ring
+     */
+    SharedMemoryRingStats getStats() const;
+
+   private:
+    /**
+     * The loop the listener thread runs, reading messages until the listener is
+     * destroyed
+     */
+    void listen();
+
+    // How long the listener thread waits for a message before checking if it should
+    // stop
+    static constexpr std::chrono::milliseconds READ_TIMEOUT{100};
+
+    // How often overruns are logged, so that a slow callback doesn't spam the logs
+    static constexpr std::chrono::seconds OVERRUN_LOG_PERIOD{1};
+
+    std::string channel_path_;
+    SharedMemoryRingReader reader_;
+    std::function<void(ReceiveProtoT&)> receive_callback_;
+    std::shared_ptr<ProtoLogger> proto_logger_;
+
+    std::atomic_bool in_destructor_ = false;
+    std::thread listener_thread_;
+};
+
+template <class ReceiveProtoT>
+ThreadedProtoShmListener<ReceiveProtoT>::ThreadedProtoShmListener(
+    const std::string& channel_path, std::function<void(ReceiveProtoT&)> receive_callback,
+    const std::shared_ptr<ProtoLogger>& proto_logger)
+    : channel_path_(channel_path),
+      reader_(channel_path),
+      receive_callback_(receive_callback),
+      proto_logger_(proto_logger),
+      listener_thread_([this]() { listen(); })
+{
+}
+
+template <class ReceiveProtoT>
+ThreadedProtoShmListener<ReceiveProtoT>::~ThreadedProtoShmListener()
+{
+    in_destructor_ = true;
+    listener_thread_.join();
+}
+
+template <class ReceiveProtoT>
+SharedMemoryRingStats ThreadedProtoShmListener<ReceiveProtoT>::getStats() const
+{
+    return reader_.getStats();
+}
+
+template <class ReceiveProtoT>
+void ThreadedProtoShmListener<ReceiveProtoT>::listen()
+{
+    std::string message;
+    ReceiveProtoT packet_data;
+    std::uint64_t num_overruns_logged = 0;
+    auto last_overrun_log_time        = std::chrono::steady_clock::now();
+
+    while (!in_destructor_)
+    {
+        if (!reader_.read(message, READ_TIMEOUT))
+        {
+            continue;
+        }
+
+        packet_data.Clear();
+        packet_data.ParseFromString(message);
+        receive_callback_(packet_data);
+
+        if (proto_logger_)
+        {
+            proto_logger_->saveSerializedProto<ReceiveProtoT>(message);
+        }
+
+        const std::uint64_t num_overruns = reader_.getStats().num_overruns;
+        const auto now                   = std::chrono::steady_clock::now();
+        if (num_overruns > num_overruns_logged &&
+            now - last_overrun_log_time > OVERRUN_LOG_PERIOD)
+        {
+            LOG(WARNING) << "Missed " << num_overruns - num_overruns_logged << " "
+                         << TYPENAME(ReceiveProtoT) << " messages on " << channel_path_
+                         << " because the shared memory ring overran";
+            num_overruns_logged   = num_overruns;
+            last_overrun_log_time = now;
+        }
+    }
+}
@@ -0,0 +1,73 @@
+import queue
+from threading import Thread
+
+import software.python_bindings as tbots_cpp
+from software.logger.logger import create_logger
+
+logger = create_logger(__name__)
+
+
+class ThreadedShmListener:
+    # How long to wait for a message before checking if the listener should stop
+    READ_TIMEOUT_MS = 100
+
+    def __init__(self, channel_path, proto_class, max_buffer_size=100):
+        """Receive protobuf from the shared memory ring of a channel and buffers them
+
+        :param channel_path: The path of the channel, which names its shared memory ring
+        :param proto_class: The protobuf to unpack from
+        :param max_buffer_size: The size of the buffer
+        """
+        self.channel_path = channel_path
+        self.proto_class = proto_class
+        self.reader = tbots_cpp.SharedMemoryRingReader(channel_path)
+        self.proto_buffer = queue.Queue(max_buffer_size)
+        self.stop = False
+
+        # We want to set daemon to true so that the program can exit
+        # even if there are still shared memory listener threads running
+        self.thread = Thread(target=self.start, daemon=True)
+        self.thread.start()
+
+    def __buffer_protobuf(self, proto):
+        """Buffer the protobuf, and raise a warning if we overrun the buffer
+
+        :param proto: The protobuf to buffer
+        :raises: Warning
+        """
+        try:
+            self.proto_buffer.put_nowait(proto)
+        except queue.Full:
+            logger.warning("buffer overrun for {}".format(self.channel_path))
+
+    def get_stats(self):
+        """Get the occupancy and overrun counters of the shared memory ring
+
+        :return: The SharedMemoryRingStats of the ring as seen by this listener
+        """
+        return self.reader.get_stats()
+
+    def force_stop(self):
+        """Stop reading messages"""
+        self.stop = True
+
+    def start(self):
+        """Read messages until force_stop is called"""
+        self.stop = False
+        num_overruns_logged = 0
+
+        while not self.stop:
+            message = self.reader.read(ThreadedShmListener.READ_TIMEOUT_MS)
+            if message is None:
+                continue
+
+            self.__buffer_protobuf(self.proto_class.FromString(message))
+
+            num_overruns = self.reader.get_stats().num_overruns
+            if num_overruns > num_overruns_logged:
+                logger.warning(
+                    "shared memory ring overrun for {}, missed {} messages".format(
+                        self.channel_path, num_overruns - num_overruns_logged
+                    )
+                )
+                num_overruns_logged = num_overruns
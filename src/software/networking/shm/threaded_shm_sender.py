@@ -0,0 +1,72 @@
+from __future__ import annotations
+
+import logging
+import queue
+from threading import Thread
+from typing import Generic, TypeVar
+
+import software.python_bindings as tbots_cpp
+from google.protobuf.message import EncodeError, Message
+from software.thunderscope.thread_safe_buffer import ThreadSafeBuffer
+
+T = TypeVar("T", bound=Message)
+
+
+class ThreadedShmSender(Generic[T]):
+    def __init__(
+        self, channel_path: str, proto_type: type[T], max_buffer_size: int = 3
+    ) -> None:
+        """Send protobufs over the shared memory ring of a channel
+
+        :param channel_path: The path of the channel, which names its shared memory ring
+        :param proto_type: The type of protobuf to send
+        :param max_buffer_size: The size of the send buffer. If
+                the buffer gets spammed faster than the thread can
+                send them out, a buffer overrun msg will be logged.
+
+        """
+        self.channel_path = channel_path
+        self.proto_buffer = ThreadSafeBuffer(max_buffer_size, proto_type)
+        self.writer = tbots_cpp.SharedMemoryRingWriter(channel_path)
+
+        self.stop = False
+
+        # We want to set daemon to true so that the program can exit
+        # even if there are still shared memory sender threads running
+        self.thread = Thread(target=self.__send_protobuf, daemon=True)
+        self.thread.start()
+
+    def force_stop(self) -> None:
+        """Stop sending messages"""
+        self.stop = True
+
+    def __send_protobuf(self) -> None:
+        """Send the buffered protobuf"""
+        while not self.stop:
+            proto = self.proto_buffer.get(block=True, return_cached=False)
+            if proto is None:
+                continue
+
+            try:
+                if not self.writer.write(proto.SerializeToString()):
+                    logging.warning(
+                        "{} is too large to send on {}".format(
+                            proto.DESCRIPTOR.full_name, self.channel_path
+                        )
+                    )
+            except EncodeError:
+                logging.error(
+                    "Received an invalid proto of type {}".format(
+                        proto.DESCRIPTOR.full_name
+                    )
+                )
+
+    def send(self, proto: T):
+        """Buffer a protobuf to be sent by the send thread
+
+        :param proto: The protobuf to send
+        """
+        try:
+            self.proto_buffer.put(proto)
+        except queue.Full:
+            logging.warning("send buffer overrun for {}".format(self.channel_path))
@@ -1,12 +1,16 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 
 #include "software/logger/logger.h"
+#include "software/logger/telemetry.h"
 #include "software/networking/udp/network_utils.h"
 #include "software/networking/udp/udp_listener.h"
 #include "software/util/typename/typename.h"
@@ -33,11 +37,15 @@ class ProtoUdpListener
      * @param receive_callback The function to run for every ReceiveProtoT packet received
      * from the network
      * @param multicast If true, joins the multicast group of given ip_address
+     * @param batch_receive If true, drains every packet that is ready each time the
+     * socket wakes up and parses the packets into a reused ReceiveProtoT. The latency
+     * between the kernel receiving each packet and it being parsed is recorded as
+     * telemetry.
      */
     ProtoUdpListener(boost::asio::io_service& io_service, const std::string& ip_address,
                      unsigned short port, const std::string& listen_interface,
                      std::function<void(ReceiveProtoT&)> receive_callback,
-                     bool multicast);
+                     bool multicast, bool batch_receive = false);
 
     /**
      * Creates an ProtoUdpListener that will listen for ReceiveProtoT packets from
@@ -52,9 +60,12 @@ class ProtoUdpListener
      * @param port The port on which to listen for ReceiveProtoT packets
      * @param receive_callback The function to run for every ReceiveProtoT packet received
      * from the network
+     * @param batch_receive If true, drains every packet that is ready each time the
+     * socket wakes up and parses the packets into a reused ReceiveProtoT
      */
     ProtoUdpListener(boost::asio::io_service& io_service, unsigned short port,
-                     std::function<void(ReceiveProtoT&)> receive_callback);
+                     std::function<void(ReceiveProtoT&)> receive_callback,
+                     bool batch_receive = false);
 
     /**
      * Closes the socket associated to the UDP listener
@@ -76,36 +87,69 @@ class ProtoUdpListener
     void handleDataReception(const char* buffer, const size_t& num_bytes_received);
 
     /**
-     * Start listening for data
+     * This function is setup as the callback to handle batches of packets received over
+     * the network when receiving in batches.
+     *
+     * @param datagrams The packets received
      */
-    void startListen();
+    void handleBatchDataReception(std::span<const UdpDatagram> datagrams);
 
-    UdpListener udp_listener_;  // The underlying UDP listener
+    std::unique_ptr<UdpListener> udp_listener_;  // The underlying UDP listener
     // The function to call on every received packet of ReceiveProtoT data
     std::function<void(ReceiveProtoT&)> receive_callback;
+    // The packet that batches of packets are parsed into, reused so that parsing a
+    // packet can reuse the memory allocated for the previous ones
+    ReceiveProtoT received_packet_;
 };
 
 template <class ReceiveProtoT>
 ProtoUdpListener<ReceiveProtoT>::ProtoUdpListener(
     boost::asio::io_service& io_service, const std::string& ip_address,
     const unsigned short port, const std::string& listen_interface,
-    std::function<void(ReceiveProtoT&)> receive_callback, bool multicast)
-    : udp_listener_(io_service, ip_address, port, listen_interface, multicast,
-                    std::bind(&ProtoUdpListener<ReceiveProtoT>::handleDataReception, this,
-                              std::placeholders::_1, std::placeholders::_2)),
-      receive_callback(receive_callback)
+    std::function<void(ReceiveProtoT&)> receive_callback, bool multicast,
+    bool batch_receive)
+    : receive_callback(receive_callback)
 {
+    if (batch_receive)
+    {
+        udp_listener_ = std::make_unique<UdpListener>(
+            io_service, ip_address, port, listen_interface, multicast,
+            BatchReceiveCallback(
+                [this](std::span<const UdpDatagram> datagrams)
+                { handleBatchDataReception(datagrams); }));
+    }
+    else
+    {
+        udp_listener_ = std::make_unique<UdpListener>(
+            io_service, ip_address, port, listen_interface, multicast,
+            ReceiveCallback(
+                [this](const char* buffer, const size_t& num_bytes_received)
+                { handleDataReception(buffer, num_bytes_received); }));
+    }
 }
 
 template <class ReceiveProtoT>
 ProtoUdpListener<ReceiveProtoT>::ProtoUdpListener(
     boost::asio::io_service& io_service, const unsigned short port,
-    std::function<void(ReceiveProtoT&)> receive_callback)
-    : udp_listener_(io_service, port,
-                    std::bind(&ProtoUdpListener<ReceiveProtoT>::handleDataReception, this,
-                              std::placeholders::_1, std::placeholders::_2)),
-      receive_callback(receive_callback)
+    std::function<void(ReceiveProtoT&)> receive_callback, bool batch_receive)
+    : receive_callback(receive_callback)
 {
+    if (batch_receive)
+    {
+        udp_listener_ = std::make_unique<UdpListener>(
+            io_service, port,
+            BatchReceiveCallback(
+                [this](std::span<const UdpDatagram> datagrams)
+                { handleBatchDataReception(datagrams); }));
+    }
+    else
+    {
+        udp_listener_ = std::make_unique<UdpListener>(
+            io_service, port,
+            ReceiveCallback(
+                [this](const char* buffer, const size_t& num_bytes_received)
+                { handleDataReception(buffer, num_bytes_received); }));
+    }
 }
 
 template <class ReceiveProtoT>
@@ -117,6 +161,25 @@ void ProtoUdpListener<ReceiveProtoT>::handleDataReception(
     receive_callback(packet_data);
 }
 
+template <class ReceiveProtoT>
+void ProtoUdpListener<ReceiveProtoT>::handleBatchDataReception(
+    std::span<const UdpDatagram> datagrams)
+{
+    for (const UdpDatagram& datagram : datagrams)
+    {
+        if (datagram.receive_time)
+        {
+            const std::chrono::duration<double, std::milli> receive_latency =
+                std::chrono::system_clock::now() - *datagram.receive_time;
+            TELEMETRY("udp_listener/" + TYPENAME(ReceiveProtoT) + "/receive_latency_ms",
+                      receive_latency.count());
+        }
+
+        received_packet_.ParseFromArray(datagram.data, static_cast<int>(datagram.size));
+        receive_callback(received_packet_);
+    }
+}
+
 template <class ReceiveProtoT>
 ProtoUdpListener<ReceiveProtoT>::~ProtoUdpListener()
 {
@@ -125,5 +188,5 @@ ProtoUdpListener<ReceiveProtoT>::~ProtoUdpListener()
 template <class ReceiveProtoT>
 void ProtoUdpListener<ReceiveProtoT>::close()
 {
-    udp_listener_.close();
+    udp_listener_->close();
 }
@@ -25,11 +25,14 @@ class ThreadedProtoUdpListener
      * @param receive_callback The function to run for every ReceiveProtoT packet received
      * from the network
      * @param multicast If true, joins the multicast group of given ip_address
+     * @param batch_receive If true, drains every packet that is ready each time the
+     * socket wakes up instead of waking up once per packet. Use this for high rate
+     * streams such as SSL vision.
      */
     ThreadedProtoUdpListener(const std::string& ip_address, unsigned short port,
                              const std::string& interface,
                              std::function<void(ReceiveProtoT)> receive_callback,
-                             bool multicast);
+                             bool multicast, bool batch_receive = false);
 
     /**
      * Creates a ThreadedProtoUdpListener that will listen for ReceiveProtoT packets
@@ -44,9 +47,12 @@ class ThreadedProtoUdpListener
      * @param interface The interface on which to listen for ReceiveProtoT packets
      * @param receive_callback The function to run for every ReceiveProtoT packet received
      * from the network
+     * @param batch_receive If true, drains every packet that is ready each time the
+     * socket wakes up instead of waking up once per packet
      */
     ThreadedProtoUdpListener(unsigned short port,
-                             std::function<void(ReceiveProtoT)> receive_callback);
+                             std::function<void(ReceiveProtoT)> receive_callback,
+                             bool batch_receive = false);
 
     /**
      * Closes the socket and stops the IO service thread
@@ -73,9 +79,10 @@ template <class ReceiveProtoT>
 ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
     const std::string& ip_address, const unsigned short port,
     const std::string& interface, std::function<void(ReceiveProtoT)> receive_callback,
-    bool multicast)
+    bool multicast, bool batch_receive)
     : io_service(),
-      udp_listener(io_service, ip_address, port, interface, receive_callback, multicast)
+      udp_listener(io_service, ip_address, port, interface, receive_callback, multicast,
+                   batch_receive)
 {
     // start the thread to run the io_service in the background
     io_service_thread = std::thread([this]() { io_service.run(); });
@@ -83,8 +90,9 @@ ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
 
 template <class ReceiveProtoT>
 ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
-    const unsigned short port, std::function<void(ReceiveProtoT)> receive_callback)
-    : io_service(), udp_listener(io_service, port, receive_callback)
+    const unsigned short port, std::function<void(ReceiveProtoT)> receive_callback,
+    bool batch_receive)
+    : io_service(), udp_listener(io_service, port, receive_callback, batch_receive)
 {
     // start the thread to run the io_service in the background
     io_service_thread = std::thread([this]() { io_service.run(); });
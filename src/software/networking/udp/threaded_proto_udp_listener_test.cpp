@@ -2,9 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 #include "google/protobuf/empty.pb.h"
 #include "shared/constants.h"
 #include "software/networking/tbots_network_exception.h"
+#include "software/networking/udp/threaded_proto_udp_sender.hpp"
 
 TEST(ThreadedProtoUdpListenerTest, error_finding_local_ip_address)
 {
@@ -27,3 +32,34 @@ TEST(ThreadedProtoUdpListenerTest, no_error_creating_socket)
     ThreadedProtoUdpListener<google::protobuf::Empty>(
         "224.5.23.0", 40000, LOOPBACK_INTERFACE, [](const auto&) {}, true);
 }
+
+TEST(ThreadedProtoUdpListenerTest, batch_receive_receives_every_packet)
+{
+    constexpr int NUM_PACKETS = 100;
+
+    std::mutex mutex;
+    std::condition_variable packet_received;
+    int num_packets_received = 0;
+
+    ThreadedProtoUdpListener<google::protobuf::Empty> listener(
+        40001,
+        [&](const auto&)
+        {
+            std::scoped_lock lock(mutex);
+            num_packets_received++;
+            packet_received.notify_all();
+        },
+        true);
+    ThreadedProtoUdpSender<google::protobuf::Empty> sender("127.0.0.1", 40001,
+                                                           LOOPBACK_INTERFACE, false);
+
+    for (int i = 0; i < NUM_PACKETS; i++)
+    {
+        sender.sendProto(google::protobuf::Empty());
+    }
+
+    std::unique_lock lock(mutex);
+    EXPECT_TRUE(packet_received.wait_for(
+        lock, std::chrono::seconds(5),
+        [&] { return num_packets_received == NUM_PACKETS; }));
+}
@@ -0,0 +1,45 @@
+#include "software/networking/udp/threaded_udp_listener.h"
+
+ThreadedUdpListener::ThreadedUdpListener(const std::string& ip_address,
+                                         const unsigned short port,
+                                         const std::string& interface, bool multicast,
+                                         ReceiveCallback receive_callback)
+    : io_service(),
+      udp_listener(io_service, ip_address, port, interface, multicast, receive_callback),
+      io_service_thread([this]() { io_service.run(); })
+{
+}
+
+ThreadedUdpListener::ThreadedUdpListener(const unsigned short port,
+                                         ReceiveCallback receive_callback)
+    : io_service(),
+      udp_listener(io_service, port, receive_callback),
+      io_service_thread([this]() { io_service.run(); })
+{
+}
+
+ThreadedUdpListener::~ThreadedUdpListener()
+{
+    close();
+}
+
+void ThreadedUdpListener::close()
+{
+    if (!io_service_thread.joinable())
+    {
+        return;
+    }
+
+    udp_listener.close();
+
+    // Stop the io_service. This is safe to call from another thread.
+    // https://stackoverflow.com/questions/4808848/boost-asio-stopping-io-service
+    // This MUST be done before attempting to join the thread because otherwise the
+    // io_service will not stop and the thread will not join
+    io_service.stop();
+
+    // Join the io_service_thread so that we wait for it to exit before destructing the
+    // thread object. If we do not wait for the thread to finish executing, it will call
+    // `std::terminate` when we deallocate the thread object and kill our whole program
+    io_service_thread.join();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <string>
+#include <thread>
+
+#include "software/networking/udp/udp_listener.h"
+
+/**
+ * A threaded listener that receives raw datagrams over the network, for messages that
+ * aren't serialized protobufs
+ */
+class ThreadedUdpListener
+{
+   public:
+    /**
+     * Creates a ThreadedUdpListener that listens for datagrams on the given address and
+     * port, and calls the receive_callback for every datagram received.
+     *
+     * @throws TbotsNetworkException if we detect an issue with setting up this listener
+     *
+     * @param ip_address If multicast is true, this address is the multicast group to
+     * join. Otherwise, this is the IP address of the local interface to listen on
+     * @param port The port to listen on
+     * @param interface The interface to listen on
+     * @param multicast If true, joins the multicast group of given ip_address
+     * @param receive_callback The function to run for every datagram received
+     */
+    ThreadedUdpListener(const std::string& ip_address, unsigned short port,
+                        const std::string& interface, bool multicast,
+                        ReceiveCallback receive_callback);
+
+    /**
+     * Creates a ThreadedUdpListener that listens for datagrams on any local address with
+     * the given port, and calls the receive_callback for every datagram received. This
+     * constructor should not be used for multicast communication.
+     *
+     * @throws TbotsNetworkException if we detect an issue with setting up this listener
+     *
+     * @param port The port to listen on
+     * @param receive_callback The function to run for every datagram received
+     */
+    ThreadedUdpListener(unsigned short port, ReceiveCallback receive_callback);
+
+    /**
+     * Closes the socket and stops the IO service thread
+     */
+    void close();
+
+    /**
+     * Destructor will close the socket and the IO service thread
+     */
+    ~ThreadedUdpListener();
+
+   private:
+    // The io_service that will be used to service all network requests
+    boost::asio::io_service io_service;
+
+    // The UdpListener that will be used to receive data from the network
+    UdpListener udp_listener;
+
+    // The thread running the io_service in the background. This thread will run for the
+    // entire lifetime of the class
+    std::thread io_service_thread;
+};
@@ -0,0 +1,49 @@
+#include "software/networking/udp/threaded_udp_listener.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "shared/constants.h"
+#include "software/networking/tbots_network_exception.h"
+#include "software/networking/udp/threaded_udp_sender.h"
+
+TEST(ThreadedUdpListenerTest, error_finding_local_ip_address)
+{
+    EXPECT_THROW(ThreadedUdpListener("224.5.23.1", 40000, "interfacemcinterfaceface",
+                                     true, [](const char*, const size_t&) {}),
+                 TbotsNetworkException);
+}
+
+TEST(ThreadedUdpListenerTest, receives_every_datagram)
+{
+    constexpr int NUM_DATAGRAMS = 100;
+
+    std::mutex mutex;
+    std::condition_variable datagram_received;
+    int num_datagrams_received = 0;
+    bool contents_match        = true;
+
+    ThreadedUdpListener listener(40002,
+                                 [&](const char* data, const size_t& size)
+                                 {
+                                     std::scoped_lock lock(mutex);
+                                     contents_match &= std::string(data, size) == "hello";
+                                     num_datagrams_received++;
+                                     datagram_received.notify_all();
+                                 });
+    ThreadedUdpSender sender("127.0.0.1", 40002, LOOPBACK_INTERFACE, false);
+
+    for (int i = 0; i < NUM_DATAGRAMS; i++)
+    {
+        sender.sendString("hello");
+    }
+
+    std::unique_lock lock(mutex);
+    EXPECT_TRUE(datagram_received.wait_for(
+        lock, std::chrono::seconds(5),
+        [&] { return num_datagrams_received == NUM_DATAGRAMS; }));
+    EXPECT_TRUE(contents_match);
+}
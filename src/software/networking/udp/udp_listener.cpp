@@ -1,14 +1,100 @@
 #include "software/networking/udp/udp_listener.h"
 
+#include <sys/socket.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+
 #include "software/logger/logger.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/networking/udp/network_utils.h"
 
+struct UdpListener::BatchReceiveBuffers
+{
+    std::array<std::array<char, MAX_BUFFER_LENGTH>, MAX_BATCH_SIZE> data;
+    std::array<iovec, MAX_BATCH_SIZE> iovecs;
+    // Room for the receive timestamp attached to each datagram
+    alignas(cmsghdr)
+        std::array<std::array<char, CMSG_SPACE(sizeof(timespec))>, MAX_BATCH_SIZE> control;
+    std::array<mmsghdr, MAX_BATCH_SIZE> headers;
+    std::array<UdpDatagram, MAX_BATCH_SIZE> datagrams;
+};
+
+namespace
+{
+/**
+ * Gets the time the kernel received a datagram from the control messages attached to it
+ *
+ * @param header The header the datagram was received with
+ *
+ * @return the time the kernel received the datagram, or std::nullopt if the kernel
+ * didn't attach a receive timestamp
+ */
+std::optional<std::chrono::system_clock::time_point> getReceiveTime(msghdr& header)
+{
+    for (cmsghdr* control_message = CMSG_FIRSTHDR(&header); control_message != nullptr;
+         control_message          = CMSG_NXTHDR(&header, control_message))
+    {
+        if (control_message->cmsg_level == SOL_SOCKET &&
+            control_message->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            timespec receive_time;
+            std::memcpy(&receive_time, CMSG_DATA(control_message), sizeof(receive_time));
+            return std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::seconds(receive_time.tv_sec) +
+                    std::chrono::nanoseconds(receive_time.tv_nsec)));
+        }
+    }
+    return std::nullopt;
+}
+}  // namespace
+
 UdpListener::UdpListener(boost::asio::io_service& io_service,
                          const std::string& ip_address, unsigned short port,
                          const std::string& listen_interface, bool multicast,
                          ReceiveCallback receive_callback)
     : running_(true), socket_(io_service), receive_callback_(receive_callback)
+{
+    bindSocket(ip_address, port, listen_interface, multicast);
+    startListen();
+}
+
+UdpListener::UdpListener(boost::asio::io_service& io_service, const unsigned short port,
+                         ReceiveCallback receive_callback)
+    : running_(true), socket_(io_service), receive_callback_(receive_callback)
+{
+    bindSocket(port);
+    startListen();
+}
+
+UdpListener::UdpListener(boost::asio::io_service& io_service,
+                         const std::string& ip_address, unsigned short port,
+                         const std::string& listen_interface, bool multicast,
+                         BatchReceiveCallback batch_receive_callback)
+    : running_(true),
+      socket_(io_service),
+      batch_receive_callback_(batch_receive_callback)
+{
+    bindSocket(ip_address, port, listen_interface, multicast);
+    setupBatchReceive();
+    startListen();
+}
+
+UdpListener::UdpListener(boost::asio::io_service& io_service, const unsigned short port,
+                         BatchReceiveCallback batch_receive_callback)
+    : running_(true),
+      socket_(io_service),
+      batch_receive_callback_(batch_receive_callback)
+{
+    bindSocket(port);
+    setupBatchReceive();
+    startListen();
+}
+
+void UdpListener::bindSocket(const std::string& ip_address, unsigned short port,
+                             const std::string& listen_interface, bool multicast)
 {
     boost::asio::ip::address boost_ip = boost::asio::ip::make_address(ip_address);
     if (isIpv6(ip_address))
@@ -38,13 +124,9 @@ UdpListener::UdpListener(boost::asio::io_service& io_service,
     {
         setupMulticast(boost_ip, listen_interface);
     }
-
-    startListen();
 }
 
-UdpListener::UdpListener(boost::asio::io_service& io_service, const unsigned short port,
-                         ReceiveCallback receive_callback)
-    : running_(true), socket_(io_service), receive_callback_(receive_callback)
+void UdpListener::bindSocket(unsigned short port)
 {
     boost::asio::ip::udp::endpoint listen_endpoint(boost::asio::ip::udp::v6(), port);
     socket_.open(listen_endpoint.protocol());
@@ -65,8 +147,39 @@ UdpListener::UdpListener(boost::asio::io_service& io_service, const unsigned sho
            << port << ")";
         throw TbotsNetworkException(ss.str());
     }
+}
 
-    startListen();
+void UdpListener::setupBatchReceive()
+{
+    batch_receive_buffers_ = std::make_unique<BatchReceiveBuffers>();
+
+    // Point each message header at its own data and control buffers. recvmmsg only
+    // overwrites the lengths, which are reset before every call
+    BatchReceiveBuffers& buffers = *batch_receive_buffers_;
+    for (unsigned int i = 0; i < MAX_BATCH_SIZE; i++)
+    {
+        buffers.iovecs[i].iov_base = buffers.data[i].data();
+        buffers.iovecs[i].iov_len  = MAX_BUFFER_LENGTH;
+
+        msghdr& header        = buffers.headers[i].msg_hdr;
+        header.msg_name       = nullptr;
+        header.msg_namelen    = 0;
+        header.msg_iov        = &buffers.iovecs[i];
+        header.msg_iovlen     = 1;
+        header.msg_control    = buffers.control[i].data();
+        header.msg_controllen = buffers.control[i].size();
+        header.msg_flags      = 0;
+    }
+
+    // Ask the kernel to attach the time it received each datagram, so the latency
+    // between the datagram arriving and being handled can be measured
+    int enable_timestamps = 1;
+    if (setsockopt(socket_.native_handle(), SOL_SOCKET, SO_TIMESTAMPNS,
+                   &enable_timestamps, sizeof(enable_timestamps)) != 0)
+    {
+        LOG(WARNING) << "UdpListener: Could not enable kernel receive timestamps: "
+                     << std::strerror(errno);
+    }
 }
 
 void UdpListener::setupMulticast(const boost::asio::ip::address& ip_address,
@@ -110,6 +223,16 @@ void UdpListener::close()
 
 void UdpListener::startListen()
 {
+    if (batch_receive_callback_)
+    {
+        // Wait until there is data to read, then drain everything that is ready in
+        // handleBatchDataReception
+        socket_.async_wait(boost::asio::ip::udp::socket::wait_read,
+                           [this](const boost::system::error_code& error)
+                           { handleBatchDataReception(error); });
+        return;
+    }
+
     // Start listening for data asynchronously
     // See here for a great explanation about asynchronous operations:
     // https://stackoverflow.com/questions/34680985/what-is-the-difference-between-asynchronous-programming-and-multithreading
@@ -119,7 +242,6 @@ void UdpListener::startListen()
                                          boost::asio::placeholders::error,
                                          boost::asio::placeholders::bytes_transferred));
 }
-
 void UdpListener::handleDataReception(const boost::system::error_code& error,
                                       std::size_t num_bytes_received)
 {
@@ -150,3 +272,68 @@ void UdpListener::handleDataReception(const boost::system::error_code& error,
     // Start listening for more data
     startListen();
 }
+
+void UdpListener::handleBatchDataReception(const boost::system::error_code& error)
+{
+    if (!running_)
+    {
+        return;
+    }
+
+    if (error)
+    {
+        LOG(WARNING) << "UdpListener: Error waiting for data: " << error.message()
+                     << std::endl;
+        startListen();
+        return;
+    }
+
+    BatchReceiveBuffers& buffers = *batch_receive_buffers_;
+    while (true)
+    {
+        for (unsigned int i = 0; i < MAX_BATCH_SIZE; i++)
+        {
+            buffers.headers[i].msg_hdr.msg_controllen = buffers.control[i].size();
+        }
+
+        const int num_received = recvmmsg(socket_.native_handle(), buffers.headers.data(),
+                                          MAX_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (num_received < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                LOG(WARNING) << "UdpListener: Error receiving data: "
+                             << std::strerror(errno) << std::endl;
+            }
+            break;
+        }
+
+        for (int i = 0; i < num_received; i++)
+        {
+            mmsghdr& header = buffers.headers[i];
+            if (header.msg_hdr.msg_flags & MSG_TRUNC)
+            {
+                LOG(WARNING)
+                    << "Received a datagram larger than MAX_BUFFER_LENGTH, "
+                    << "which means that the receive buffer is full and data loss has occurred. "
+                    << "Consider increasing MAX_BUFFER_LENGTH";
+            }
+
+            buffers.datagrams[i] =
+                UdpDatagram{.data         = buffers.data[i].data(),
+                            .size         = header.msg_len,
+                            .receive_time = getReceiveTime(header.msg_hdr)};
+        }
+        batch_receive_callback_(std::span<const UdpDatagram>(buffers.datagrams.data(),
+                                                             num_received));
+
+        // A partial batch means the socket has been drained
+        if (num_received < static_cast<int>(MAX_BATCH_SIZE))
+        {
+            break;
+        }
+    }
+
+    // Wait for more data
+    startListen();
+}
@@ -1,11 +1,35 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+
+/**
+ * A datagram received from the network
+ */
+struct UdpDatagram
+{
+    // The received data, which is only valid until the receive callback returns
+    const char* data;
+    std::size_t size;
+    // The time the kernel received the datagram, if the kernel reported it
+    std::optional<std::chrono::system_clock::time_point> receive_time;
+};
 
 typedef std::function<void(const char*, const size_t&)> ReceiveCallback;
+typedef std::function<void(std::span<const UdpDatagram>)> BatchReceiveCallback;
 
 /**
  * Creates a UDP listener that can listen on a given port and interface.
+ *
+ * A listener created with a ReceiveCallback receives one datagram per wakeup of the
+ * io_service. A listener created with a BatchReceiveCallback instead waits until the
+ * socket is readable and drains every datagram that is ready with as few recvmmsg
+ * system calls as possible, passing them to the callback in batches along with the
+ * time the kernel received each of them. The batched mode is meant for high rate
+ * streams such as SSL vision, where one wakeup per datagram adds up.
  */
 class UdpListener
 {
@@ -44,6 +68,40 @@ class UdpListener
     UdpListener(boost::asio::io_service& io_service, const unsigned short port,
                 ReceiveCallback receive_callback);
 
+    /**
+     * Creates a UDP listener that receives datagrams in batches.
+     *
+     * @throws TbotsNetworkException if the listener could not be created
+     *
+     * @param io_service The service thread to use for the network communication resource
+     * @param ip_address If multicast is true, this address is the multicast group to
+     * join. Otherwise, this is the IP address of the local interface to listen on
+     * @param port The port to listen on
+     * @param interface The networking interface to listen on
+     * @param multicast If true, the listener will join the multicast group given by
+     * `ip_address`, otherwise it will listen on the local interface given by `ip_address`
+     * and `interface`
+     * @param batch_receive_callback The callback to call with every batch of datagrams
+     * received
+     */
+    UdpListener(boost::asio::io_service& io_service, const std::string& ip_address,
+                unsigned short port, const std::string& interface, bool multicast,
+                BatchReceiveCallback batch_receive_callback);
+
+    /**
+     * Creates a UDP listener that receives datagrams in batches on the given port on all
+     * interfaces.
+     *
+     * @throws TbotsNetworkException if the listener could not be created
+     *
+     * @param io_service The service thread to use for the network communication resource
+     * @param port The port to listen on
+     * @param batch_receive_callback The callback to call with every batch of datagrams
+     * received
+     */
+    UdpListener(boost::asio::io_service& io_service, const unsigned short port,
+                BatchReceiveCallback batch_receive_callback);
+
     /**
      * Destructor.
      */
@@ -55,6 +113,9 @@ class UdpListener
     void close();
 
    private:
+    // The buffers recvmmsg receives a batch of datagrams into
+    struct BatchReceiveBuffers;
+
     /**
      * Handles the reception of data from the network as well as any errors that may occur
      * before calling the user-provided callback.
@@ -62,11 +123,47 @@ class UdpListener
     void handleDataReception(const boost::system::error_code& error,
                              std::size_t bytes_transferred);
 
+    /**
+     * Drains every datagram that is ready on the socket in batches once the socket is
+     * readable, calling the user-provided batch callback with each batch.
+     */
+    void handleBatchDataReception(const boost::system::error_code& error);
+
     /**
      * Starts listening for data on the socket.
      */
     void startListen();
 
+    /**
+     * Opens the socket and binds it to the given address
+     *
+     * @throws TbotsNetworkException if the socket could not be bound or the multicast
+     * group could not be joined
+     *
+     * @param ip_address If multicast is true, this address is the multicast group to
+     * join. Otherwise, this is the IP address of the local interface to listen on
+     * @param port The port to listen on
+     * @param listen_interface The networking interface to listen on
+     * @param multicast If true, joins the multicast group given by `ip_address`
+     */
+    void bindSocket(const std::string& ip_address, unsigned short port,
+                    const std::string& listen_interface, bool multicast);
+
+    /**
+     * Opens the socket and binds it to the given port on all interfaces
+     *
+     * @throws TbotsNetworkException if the socket could not be bound
+     *
+     * @param port The port to listen on
+     */
+    void bindSocket(unsigned short port);
+
+    /**
+     * Allocates the batch receive buffers and asks the kernel to timestamp every
+     * datagram it receives on the socket
+     */
+    void setupBatchReceive();
+
     /**
      * Sets up multicast for the given ip_address and listen_interface
      *
@@ -81,6 +178,9 @@ class UdpListener
     // The maximum buffer length for the raw data received from the network
     static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
 
+    // The maximum number of datagrams received by one recvmmsg call
+    static constexpr unsigned int MAX_BATCH_SIZE = 32;
+
     // Whether this listener should continue running
     bool running_;
 
@@ -95,4 +195,10 @@ class UdpListener
 
     // Callback once a new message is received
     ReceiveCallback receive_callback_;
+
+    // Callback once a batch of new messages is received, if receiving in batches
+    BatchReceiveCallback batch_receive_callback_;
+
+    // Only allocated if receiving in batches
+    std::unique_ptr<BatchReceiveBuffers> batch_receive_buffers_;
 };
@@ -97,10 +97,12 @@ PYBIND11_MODULE(py_constants, m)
         ROBOT_TO_FULL_SYSTEM_IP_NOTIFICATION_PORT;
     m.attr("FULL_SYSTEM_TO_ROBOT_IP_NOTIFICATION_PORT") =
         FULL_SYSTEM_TO_ROBOT_IP_NOTIFICATION_PORT;
+    m.attr("COMPACT_PRIMITIVE_SET_PORT") = COMPACT_PRIMITIVE_SET_PORT;
 
     // PlotJuggler
     m.attr("PLOTJUGGLER_GUI_DEFAULT_HOST") = PLOTJUGGLER_GUI_DEFAULT_HOST;
     m.attr("PLOTJUGGLER_GUI_DEFAULT_PORT") = PLOTJUGGLER_GUI_DEFAULT_PORT;
+    m.attr("PLOTJUGGLER_TELEMETRY_DEFAULT_PORT") = PLOTJUGGLER_TELEMETRY_DEFAULT_PORT;
 
     // SSL
     m.attr("SSL_VISION_ADDRESS") = SSL_VISION_ADDRESS;
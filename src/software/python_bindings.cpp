@@ -1,3 +1,4 @@
+#include <pybind11/chrono.h>
 #include <pybind11/embed.h>
 #include <pybind11/functional.h>
 #include <pybind11/operators.h>
@@ -8,6 +9,7 @@
 
 #include "proto/geometry.pb.h"
 #include "proto/ip_notification.pb.h"
+#include "proto/message_translation/compact_primitive_set.h"
 #include "proto/message_translation/ssl_geometry.h"
 #include "proto/message_translation/tbots_geometry.h"
 #include "proto/parameters.pb.h"
@@ -38,11 +40,14 @@
 #include "software/geom/rectangle.h"
 #include "software/geom/segment.h"
 #include "software/geom/vector.h"
+#include "software/logger/proto_replay_reader.h"
 #include "software/math/math_functions.h"
+#include "software/multithreading/worker_pool.h"
+#include "software/networking/shm/shared_memory_ring.h"
 #include "software/networking/tbots_network_exception.h"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_sender.hpp"
-#include "software/uart/boost_uart_communication.h"
+#include "software/networking/udp/threaded_udp_sender.h"
 #include "software/world/field.h"
 #include "software/world/robot.h"
 #include "software/world/world.h"
@@ -88,8 +93,13 @@ void declareThreadedProtoUdpListener(py::module& m, std::string name)
     py::class_<Class, std::shared_ptr<Class>>(m, pyclass_name.c_str(),
                                               py::buffer_protocol(), py::dynamic_attr())
         .def(py::init<const std::string&, unsigned short, const std::string&,
-                      const std::function<void(T)>&, bool>())
-        .def(py::init<unsigned short, const std::function<void(T)>&>())
+                      const std::function<void(T)>&, bool, bool>(),
+             py::arg("ip_address"), py::arg("port"), py::arg("interface"),
+             py::arg("receive_callback"), py::arg("multicast"),
+             py::arg("batch_receive") = false)
+        .def(py::init<unsigned short, const std::function<void(T)>&, bool>(),
+             py::arg("port"), py::arg("receive_callback"),
+             py::arg("batch_receive") = false)
         .def("close", &Class::close);
 }
 
@@ -108,18 +118,22 @@ void declareReceiverPositionGenerator(py::module& m, std::string name)
 
 
 /**
- * Create a new threaded e-stop reader
+ * Converts entries read by a ProtoReplayReader into Python (timestamp, protobuf type
+ * full name, protobuf) tuples. The GIL must be held.
  *
- * @param uart_port The uart port the e-stop is on
- * @param baud_rate The baud rate to communicate with
+ * @param entries The replay log entries to convert
  *
- * @returns ThreadedEstopReader
+ * @returns list of (timestamp, protobuf type full name, protobuf) tuples
  */
-std::unique_ptr<ThreadedEstopReader> createThreadedEstopReader(std::string uart_port,
-                                                               int baud_rate)
+py::list convertReplayLogEntries(const std::vector<ReplayLogEntry>& entries)
 {
-    auto uart_device = std::make_unique<BoostUartCommunication>(baud_rate, uart_port);
-    return std::make_unique<ThreadedEstopReader>(std::move(uart_device));
+    py::list py_entries;
+    for (const ReplayLogEntry& entry : entries)
+    {
+        py_entries.append(py::make_tuple(entry.timestamp_sec,
+                                         entry.protobuf_type_full_name, *entry.message));
+    }
+    return py_entries;
 }
 
 PYBIND11_MODULE(python_bindings, m)
@@ -437,22 +451,148 @@ PYBIND11_MODULE(python_bindings, m)
     declareThreadedProtoUdpSender<TbotsProto::Primitive>(m, "Primitive");
     declareThreadedProtoUdpSender<TbotsProto::IpNotification>(m, "FullsystemIpBroadcast");
 
+    py::class_<ThreadedUdpSender, std::shared_ptr<ThreadedUdpSender>>(m, "UdpSender")
+        .def(py::init<const std::string&, unsigned short, const std::string&, bool>(),
+             py::arg("ip_address"), py::arg("port"), py::arg("interface"),
+             py::arg("multicast"))
+        .def("get_interface", &ThreadedUdpSender::getInterface)
+        .def("get_ip_address", &ThreadedUdpSender::getIpAddress)
+        .def("send_string", &ThreadedUdpSender::sendString, py::arg("message"),
+             py::arg("async") = false);
+
+    m.def("encodeCompactPrimitiveSet",
+          [](const TbotsProto::PrimitiveSet& primitive_set)
+          {
+              std::string buffer;
+              encodeCompactPrimitiveSet(primitive_set, buffer);
+              return py::bytes(buffer);
+          });
+
     py::register_exception<TbotsNetworkException>(m, "TbotsNetworkException");
 
+    // Shared memory rings, for the IPC channels that don't use unix sockets
+    py::class_<SharedMemoryRingStats>(m, "SharedMemoryRingStats")
+        .def_readonly("occupancy", &SharedMemoryRingStats::occupancy)
+        .def_readonly("capacity", &SharedMemoryRingStats::capacity)
+        .def_readonly("num_overruns", &SharedMemoryRingStats::num_overruns)
+        .def_readonly("num_total_overruns", &SharedMemoryRingStats::num_total_overruns)
+        .def_readonly("num_messages_written",
+                      &SharedMemoryRingStats::num_messages_written);
+
+    py::class_<SharedMemoryRingWriter>(m, "SharedMemoryRingWriter")
+        .def(py::init<const std::string&>(), py::arg("channel_path"))
+        .def(
+            "write",
+            [](SharedMemoryRingWriter& writer, const std::string& message)
+            { return writer.write(message); },
+            py::arg("message"))
+        .def_static("unlink", &SharedMemoryRingWriter::unlink, py::arg("channel_path"));
+
+    // Reading waits for the writer, so the GIL is released while the reader is waiting
+    py::class_<SharedMemoryRingReader>(m, "SharedMemoryRingReader")
+        .def(py::init<const std::string&>(), py::arg("channel_path"))
+        .def(
+            "read",
+            [](SharedMemoryRingReader& reader, unsigned int timeout_ms) -> py::object
+            {
+                std::string message;
+                bool message_read = false;
+                {
+                    py::gil_scoped_release release;
+                    message_read =
+                        reader.read(message, std::chrono::milliseconds(timeout_ms));
+                }
+                if (!message_read)
+                {
+                    return py::none();
+                }
+                return py::bytes(message);
+            },
+            py::arg("timeout_ms"))
+        .def("get_stats", &SharedMemoryRingReader::getStats);
+
     // Estop Reader
     py::class_<ThreadedEstopReader, std::unique_ptr<ThreadedEstopReader>>(
         m, "ThreadedEstopReader")
-        .def(py::init<>(&createThreadedEstopReader))
-        .def("isEstopPlay", &ThreadedEstopReader::isEstopPlay);
+        .def(py::init<const std::string&, int>(), py::arg("uart_port"),
+             py::arg("baud_rate"))
+        .def("isEstopPlay", &ThreadedEstopReader::isEstopPlay)
+        .def("getStatistics", &ThreadedEstopReader::getStatistics);
+
+    py::class_<EstopReaderStatistics>(m, "EstopReaderStatistics")
+        .def_readonly("num_reads", &EstopReaderStatistics::num_reads)
+        .def_readonly("num_messages", &EstopReaderStatistics::num_messages)
+        .def_readonly("num_state_changes", &EstopReaderStatistics::num_state_changes)
+        .def_readonly("mean_handler_latency_us",
+                      &EstopReaderStatistics::mean_handler_latency_us)
+        .def_readonly("max_handler_latency_us",
+                      &EstopReaderStatistics::max_handler_latency_us)
+        .def_readonly("max_time_between_reads_ms",
+                      &EstopReaderStatistics::max_time_between_reads_ms)
+        .def_readonly("last_state_change_time",
+                      &EstopReaderStatistics::last_state_change_time);
 
     py::class_<ProtoLogger>(m, "ProtoLogger")
         .def_static("createLogEntry", &ProtoLogger::createLogEntry);
 
+    py::class_<ReplayChunkIndex>(m, "ReplayChunkIndex")
+        .def_readonly("chunk_file_name", &ReplayChunkIndex::chunk_file_name)
+        .def_readonly("start_time_sec", &ReplayChunkIndex::start_time_sec)
+        .def_readonly("end_time_sec", &ReplayChunkIndex::end_time_sec)
+        .def_readonly("num_entries", &ReplayChunkIndex::num_entries);
+
+    // Decoding chunks can block on the decoder pool, so the GIL is released while
+    // the reader is working to let the rest of Thunderscope keep running
+    py::class_<ProtoReplayReader>(m, "ProtoReplayReader")
+        .def(py::init<const std::string&, unsigned int, unsigned int>(),
+             py::arg("log_folder_path"),
+             py::arg("num_decoder_threads") =
+                 ProtoReplayReader::DEFAULT_NUM_DECODER_THREADS,
+             py::arg("num_read_ahead_chunks") =
+                 ProtoReplayReader::DEFAULT_NUM_READ_AHEAD_CHUNKS,
+             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "getEntriesInTimeRange",
+            [](ProtoReplayReader& reader, double start_time_sec, double end_time_sec)
+            {
+                std::vector<ReplayLogEntry> entries;
+                {
+                    py::gil_scoped_release release;
+                    entries = reader.getEntriesInTimeRange(start_time_sec, end_time_sec);
+                }
+                return convertReplayLogEntries(entries);
+            },
+            py::arg("start_time_sec"), py::arg("end_time_sec"))
+        .def(
+            "getChunkEntries",
+            [](ProtoReplayReader& reader, std::size_t chunk_index)
+            {
+                std::vector<ReplayLogEntry> entries;
+                {
+                    py::gil_scoped_release release;
+                    entries = reader.getChunkEntries(chunk_index);
+                }
+                return convertReplayLogEntries(entries);
+            },
+            py::arg("chunk_index"))
+        .def("getChunkIndexForTime", &ProtoReplayReader::getChunkIndexForTime)
+        .def("getNumChunks", &ProtoReplayReader::getNumChunks)
+        .def("getChunkIndex", &ProtoReplayReader::getChunkIndex)
+        .def("getBookmarkTimestamps", &ProtoReplayReader::getBookmarkTimestamps)
+        .def("getStartTime", &ProtoReplayReader::getStartTime)
+        .def("getEndTime", &ProtoReplayReader::getEndTime)
+        .def("getReplayFileVersion", &ProtoReplayReader::getReplayFileVersion);
+
     py::class_<EighteenZonePitchDivision, std::shared_ptr<EighteenZonePitchDivision>>(
         m, "EighteenZonePitchDivision")
         .def(py::init<Field>())
         .def("getZone", &EighteenZonePitchDivision::getZone);
 
+    py::class_<PassingParams>(m, "PassingParams")
+        .def(py::init<const TbotsProto::PassingConfig&>());
+
+    py::class_<WorkerPool>(m, "WorkerPool").def(py::init<unsigned int>());
+
     declareReceiverPositionGenerator<EighteenZoneId>(m, "EighteenZoneId");
 
     py::class_<PassGenerator>(m, "PassGenerator")
@@ -13,21 +13,23 @@
 BallFilter::BallFilter() : ball_detection_buffer(MAX_BUFFER_SIZE) {}
 
 std::optional<Ball> BallFilter::estimateBallState(
-    const std::vector<BallDetection>& new_ball_detections, const Rectangle& filter_area)
+    std::span<const BallDetection> new_ball_detections, const Rectangle& filter_area)
 {
     addNewDetectionsToBuffer(new_ball_detections, filter_area);
     return estimateBallStateFromBuffer(ball_detection_buffer);
 }
 
-void BallFilter::addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_detections,
-                                          const Rectangle& filter_area)
+void BallFilter::addNewDetectionsToBuffer(
+    std::span<const BallDetection> new_ball_detections, const Rectangle& filter_area)
 {
     // Sort the detections in increasing order before processing. This places the oldest
     // detections (with the smallest timestamp) at the front of the buffer, and the most
     // recent detections (largest timestamp) at the end of the buffer.
-    std::sort(new_ball_detections.begin(), new_ball_detections.end());
+    sorted_ball_detections.assign(new_ball_detections.begin(),
+                                  new_ball_detections.end());
+    std::sort(sorted_ball_detections.begin(), sorted_ball_detections.end());
 
-    for (const auto& detection : new_ball_detections)
+    for (const auto& detection : sorted_ball_detections)
     {
         // Remove any detections outside the filter area
         if (!contains(filter_area, detection.position))
@@ -2,6 +2,8 @@
 
 #include <boost/circular_buffer.hpp>
 #include <optional>
+#include <span>
+#include <vector>
 
 #include "software/geom/line.h"
 #include "software/geom/point.h"
@@ -65,7 +67,7 @@ class BallFilter
      * If a filtered result cannot be calculated, returns std::nullopt
      */
     std::optional<Ball> estimateBallState(
-        const std::vector<BallDetection>& new_ball_detections,
+        std::span<const BallDetection> new_ball_detections,
         const Rectangle& filter_area);
 
    private:
@@ -101,7 +103,7 @@ class BallFilter
      * @param filter_area The area within which the ball filter will work. Any detections
      * outside of this area will be ignored.
      */
-    void addNewDetectionsToBuffer(std::vector<BallDetection> new_ball_detections,
+    void addNewDetectionsToBuffer(std::span<const BallDetection> new_ball_detections,
                                   const Rectangle& filter_area);
 
     /**
@@ -193,4 +195,8 @@ class BallFilter
         const std::optional<Line>& ball_regression_line = std::nullopt);
 
     boost::circular_buffer<BallDetection> ball_detection_buffer;
+
+    // The new detections being added to the buffer, sorted by timestamp. Kept between
+    // updates so that sorting the new detections doesn't allocate every frame.
+    std::vector<BallDetection> sorted_ball_detections;
 };
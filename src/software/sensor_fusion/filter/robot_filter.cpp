@@ -16,7 +16,7 @@ RobotFilter::RobotFilter(RobotDetection current_robot_state,
 }
 
 std::optional<Robot> RobotFilter::getFilteredData(
-    const std::vector<RobotDetection>& new_robot_data,
+    std::span<const RobotDetection> new_robot_data,
     const std::optional<RobotId> breakbeam_tripped_id)
 {
     int data_num               = 0;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "software/geom/angle.h"
@@ -51,7 +52,7 @@ class RobotFilter
      * @return The filtered data for the robot
      */
     std::optional<Robot> getFilteredData(
-        const std::vector<RobotDetection>& new_robot_data,
+        std::span<const RobotDetection> new_robot_data,
         const std::optional<RobotId> breakbeam_tripped_id = std::nullopt);
 
     /**
@@ -8,11 +8,11 @@ RobotTeamFilter::RobotTeamFilter() {}
 
 Team RobotTeamFilter::getFilteredData(
     const Team& current_team_state,
-    const std::vector<RobotDetection>& new_robot_detections,
+    std::span<const RobotDetection> new_robot_detections,
     const std::optional<RobotId> breakbeam_tripped_id)
 {
     // Add filters for any robot we haven't seen before
-    for (auto detection : new_robot_detections)
+    for (const RobotDetection& detection : new_robot_detections)
     {
         if (robot_filters.find(detection.id) == robot_filters.end())
         {
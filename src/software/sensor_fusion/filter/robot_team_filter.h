@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "software/constants.h"
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
@@ -27,7 +29,7 @@ class RobotTeamFilter
      */
     Team getFilteredData(
         const Team& current_team_state,
-        const std::vector<RobotDetection>& new_robot_detections,
+        std::span<const RobotDetection> new_robot_detections,
         const std::optional<RobotId> breakbeam_tripped_id = std::nullopt);
 
 
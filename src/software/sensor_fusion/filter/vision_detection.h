@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
 #include "software/time/timestamp.h"
@@ -46,3 +48,31 @@ struct BallDetection
         return timestamp < b.timestamp;
     }
 };
+
+/**
+ * The detections from a single SSL vision camera frame, converted to our units and
+ * reference frame and ready to be passed to the filters.
+ *
+ * A batch is meant to be reused for every frame, so once its arrays have grown to fit
+ * the largest frame seen, converting a frame into it doesn't allocate.
+ */
+struct VisionDetectionBatch
+{
+    // The id of the camera that captured the frame
+    unsigned int camera_id = 0;
+    // The time the camera frame was captured
+    Timestamp t_capture;
+    std::vector<BallDetection> balls;
+    std::vector<RobotDetection> yellow_robots;
+    std::vector<RobotDetection> blue_robots;
+
+    /**
+     * Removes all detections from the batch, keeping the memory allocated for them
+     */
+    void clear()
+    {
+        balls.clear();
+        yellow_robots.clear();
+        blue_robots.clear();
+    }
+};
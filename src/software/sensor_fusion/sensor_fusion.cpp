@@ -236,42 +236,19 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
     bool ignore_invalid_camera_data = sensor_fusion_config.ignore_invalid_camera_data();
     bool friendly_team_is_yellow    = sensor_fusion_config.friendly_color_yellow();
 
-    std::optional<Ball> new_ball;
-    auto ball_detections = createBallDetections({ssl_detection_frame}, min_valid_x,
-                                                max_valid_x, ignore_invalid_camera_data);
-
-    auto yellow_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::YELLOW, min_valid_x,
-                            max_valid_x, ignore_invalid_camera_data);
-    auto blue_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::BLUE, min_valid_x,
-                            max_valid_x, ignore_invalid_camera_data);
-
-    if (defending_positive_side)
-    {
-        for (auto& detection : ball_detections)
-        {
-            detection = invert(detection);
-        }
-        for (auto& detection : yellow_team)
-        {
-            detection = invert(detection);
-        }
-        for (auto& detection : blue_team)
-        {
-            detection = invert(detection);
-        }
-    }
+    fillVisionDetectionBatch(ssl_detection_frame, min_valid_x, max_valid_x,
+                             ignore_invalid_camera_data, defending_positive_side,
+                             vision_detection_batch);
 
     if (friendly_team_is_yellow)
     {
-        friendly_team = createFriendlyTeam(yellow_team);
-        enemy_team    = createEnemyTeam(blue_team);
+        friendly_team = createFriendlyTeam(vision_detection_batch.yellow_robots);
+        enemy_team    = createEnemyTeam(vision_detection_batch.blue_robots);
     }
     else
     {
-        friendly_team = createFriendlyTeam(blue_team);
-        enemy_team    = createEnemyTeam(yellow_team);
+        friendly_team = createFriendlyTeam(vision_detection_batch.blue_robots);
+        enemy_team    = createEnemyTeam(vision_detection_batch.yellow_robots);
     }
 
     ball_in_dribbler_timeout--;
@@ -288,17 +265,18 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
         std::optional<Robot> robot_with_ball_in_dribbler =
             friendly_team.getRobotById(friendly_robot_id_with_ball_in_dribbler.value());
 
-        std::vector<BallDetection> dribbler_in_ball_detection = {BallDetection{
+        BallDetection dribbler_in_ball_detection{
             .position =
                 robot_with_ball_in_dribbler->position() +
                 Vector::createFromAngle(robot_with_ball_in_dribbler->orientation())
                     .normalize(DIST_TO_FRONT_OF_ROBOT_METERS +
                                BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING),
             .distance_from_ground = 0,
-            .timestamp  = Timestamp::fromSeconds(ssl_detection_frame.t_capture()),
-            .confidence = 1}};
+            .timestamp  = vision_detection_batch.t_capture,
+            .confidence = 1};
 
-        std::optional<Ball> new_ball = createBall(dribbler_in_ball_detection);
+        std::optional<Ball> new_ball =
+            createBall(std::span(&dribbler_in_ball_detection, 1));
 
         if (new_ball)
         {
@@ -307,7 +285,7 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame& ssl_detection
     }
     else
     {
-        std::optional<Ball> new_ball = createBall(ball_detections);
+        std::optional<Ball> new_ball = createBall(vision_detection_batch.balls);
         if (new_ball)
         {
             // If vision detected a new ball, then use that one
@@ -349,7 +327,7 @@ void SensorFusion::updateBall(Ball new_ball)
 }
 
 std::optional<Ball> SensorFusion::createBall(
-    const std::vector<BallDetection>& ball_detections)
+    std::span<const BallDetection> ball_detections)
 {
     if (field)
     {
@@ -360,7 +338,7 @@ std::optional<Ball> SensorFusion::createBall(
     return std::nullopt;
 }
 
-Team SensorFusion::createFriendlyTeam(const std::vector<RobotDetection>& robot_detections)
+Team SensorFusion::createFriendlyTeam(std::span<const RobotDetection> robot_detections)
 {
     Team new_friendly_team = friendly_team_filter.getFilteredData(
         friendly_team, robot_detections, friendly_robot_id_with_ball_in_dribbler);
@@ -429,7 +407,7 @@ void SensorFusion::updateDribbleDisplacement()
     }
 }
 
-Team SensorFusion::createEnemyTeam(const std::vector<RobotDetection>& robot_detections)
+Team SensorFusion::createEnemyTeam(std::span<const RobotDetection> robot_detections)
 {
     Team new_enemy_team =
         enemy_team_filter.getFilteredData(enemy_team, robot_detections, false);
@@ -455,21 +433,6 @@ std::optional<Point> SensorFusion::getBallPlacementPoint(const SSLProto::Referee
     return point_opt;
 }
 
-RobotDetection SensorFusion::invert(RobotDetection robot_detection) const
-{
-    robot_detection.position =
-        Point(-robot_detection.position.x(), -robot_detection.position.y());
-    robot_detection.orientation = robot_detection.orientation + Angle::half();
-    return robot_detection;
-}
-
-BallDetection SensorFusion::invert(BallDetection ball_detection) const
-{
-    ball_detection.position =
-        Point(-ball_detection.position.x(), -ball_detection.position.y());
-    return ball_detection;
-}
-
 bool SensorFusion::teamHasBall(const Team& team, const Ball& ball)
 {
     for (const auto& robot : team.getAllRobots())
@@ -2,6 +2,8 @@
 
 #include <google/protobuf/repeated_field.h>
 
+#include <span>
+
 #include "proto/message_translation/ssl_detection.h"
 #include "proto/message_translation/ssl_geometry.h"
 #include "proto/message_translation/ssl_referee.h"
@@ -95,7 +97,7 @@ class SensorFusion
      *
      * @return Ball if filtered from ball detections
      */
-    std::optional<Ball> createBall(const std::vector<BallDetection>& ball_detections);
+    std::optional<Ball> createBall(std::span<const BallDetection> ball_detections);
 
     /**
      * Create team from a list of robot detections
@@ -104,8 +106,8 @@ class SensorFusion
      *
      * @return team
      */
-    Team createFriendlyTeam(const std::vector<RobotDetection>& robot_detections);
-    Team createEnemyTeam(const std::vector<RobotDetection>& robot_detections);
+    Team createFriendlyTeam(std::span<const RobotDetection> robot_detections);
+    Team createEnemyTeam(std::span<const RobotDetection> robot_detections);
 
 
     /**
@@ -118,16 +120,6 @@ class SensorFusion
      */
     std::optional<Point> getBallPlacementPoint(const SSLProto::Referee& packet);
 
-    /**
-     *Inverts all positions and orientations across the x and y axis
-     *
-     * @param Detection to invert
-     *
-     *@return inverted Detection
-     */
-    RobotDetection invert(RobotDetection robot_detection) const;
-    BallDetection invert(BallDetection ball_detection) const;
-
     /**
      * Updates the segment representing the displacement of the ball due to
      * the friendly team continuously dribbling the ball across the field.
@@ -195,6 +187,10 @@ class SensorFusion
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
 
+    // The detections of the latest vision frame, reused between frames so that
+    // converting a frame doesn't allocate
+    VisionDetectionBatch vision_detection_batch;
+
     TeamPossession possession;
     std::shared_ptr<PossessionTracker> possession_tracker;
 
@@ -20,9 +20,13 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
                                    const robot_constants::RobotConstants& robot_constants,
                                    std::unique_ptr<RealismConfigErForce>& realism_config,
                                    const bool ramping,
-                                   Duration primitive_executor_time_step)
+                                   Duration primitive_executor_time_step,
+                                   const camun::simulator::SimulatorFidelity& fidelity)
     : yellow_team_world_msg(std::make_unique<TbotsProto::World>()),
       blue_team_world_msg(std::make_unique<TbotsProto::World>()),
+      field_type(field_type),
+      er_force_realism_config(*realism_config),
+      fidelity(fidelity),
       primitive_executor_time_step(primitive_executor_time_step),
       frame_number(0),
       euclidean_to_four_wheel(robot_constants),
@@ -57,7 +61,8 @@ ErForceSimulator::ErForceSimulator(const TbotsProto::FieldType& field_type,
 
     google::protobuf::TextFormat::Parser parser;
     parser.ParseFromString(config_str, &er_force_sim_setup);
-    er_force_sim = std::make_unique<camun::simulator::Simulator>(er_force_sim_setup);
+    er_force_sim =
+        std::make_unique<camun::simulator::Simulator>(er_force_sim_setup, fidelity);
     auto simulator_setup_command = std::make_unique<amun::Command>();
     simulator_setup_command->mutable_simulator()->set_enable(true);
 
@@ -376,22 +381,17 @@ SSLSimulationProto::RobotControl ErForceSimulator::updateSimulatorRobots(
 
     for (auto& [robot_id, primitive_executor] : robot_primitive_executor_map)
     {
-        std::unique_ptr<TbotsProto::DirectControlPrimitive> direct_control;
+        auto direct_control = std::make_unique<TbotsProto::DirectControlPrimitive>();
 
         TbotsProto::PrimitiveExecutorStatus status;  // Added for compilation
+        primitive_executor->stepPrimitive(status, primitive_executor_time_step,
+                                          *direct_control);
         if (ramping)
         {
-            auto direct_control_no_ramp =
-                primitive_executor->stepPrimitive(status, primitive_executor_time_step);
             const auto& robot_state = robot_map.at(robot_id);
             direct_control          = getRampedVelocityPrimitive(
                          robot_state.localVelocity(), robot_state.angularVelocity(),
-                         *direct_control_no_ramp, primitive_executor_time_step);
-        }
-        else
-        {
-            direct_control =
-                primitive_executor->stepPrimitive(status, primitive_executor_time_step);
+                         *direct_control, primitive_executor_time_step);
         }
 
         auto command = *getRobotCommandFromDirectControl(
@@ -484,6 +484,85 @@ void ErForceSimulator::stepSimulation(const Duration& time_step)
     frame_number++;
 }
 
+/**
+ * Copies the state of the primitive executors in a snapshot into the primitive
+ * executors of a simulator, reusing the existing primitive executors
+ *
+ * @param snapshot_primitive_executors The primitive executors in the snapshot
+ * @param robot_primitive_executor_map The primitive executors of the simulator
+ */
+static void restorePrimitiveExecutors(
+    const std::unordered_map<unsigned int, PrimitiveExecutor>&
+        snapshot_primitive_executors,
+    std::unordered_map<unsigned int, std::shared_ptr<PrimitiveExecutor>>&
+        robot_primitive_executor_map)
+{
+    std::erase_if(robot_primitive_executor_map,
+                  [&](const auto& entry)
+                  { return !snapshot_primitive_executors.contains(entry.first); });
+
+    for (const auto& [id, primitive_executor] : snapshot_primitive_executors)
+    {
+        auto robot_primitive_executor_iter = robot_primitive_executor_map.find(id);
+        if (robot_primitive_executor_iter != robot_primitive_executor_map.end())
+        {
+            *robot_primitive_executor_iter->second = primitive_executor;
+        }
+        else
+        {
+            robot_primitive_executor_map.emplace(
+                id, std::make_shared<PrimitiveExecutor>(primitive_executor));
+        }
+    }
+}
+
+ErForceSimulator::Snapshot ErForceSimulator::createSnapshot() const
+{
+    Snapshot snapshot{
+        .er_force_sim_snapshot  = er_force_sim->createSnapshot(),
+        .yellow_team_world_msg  = *yellow_team_world_msg,
+        .blue_team_world_msg    = *blue_team_world_msg,
+        .frame_number           = frame_number,
+        .current_time           = current_time,
+        .blue_robot_with_ball   = blue_robot_with_ball,
+        .yellow_robot_with_ball = yellow_robot_with_ball,
+    };
+    for (const auto& [id, primitive_executor] : yellow_primitive_executor_map)
+    {
+        snapshot.yellow_primitive_executors.emplace(id, *primitive_executor);
+    }
+    for (const auto& [id, primitive_executor] : blue_primitive_executor_map)
+    {
+        snapshot.blue_primitive_executors.emplace(id, *primitive_executor);
+    }
+    return snapshot;
+}
+
+void ErForceSimulator::restoreSnapshot(const Snapshot& snapshot)
+{
+    er_force_sim->restoreSnapshot(snapshot.er_force_sim_snapshot);
+    restorePrimitiveExecutors(snapshot.yellow_primitive_executors,
+                              yellow_primitive_executor_map);
+    restorePrimitiveExecutors(snapshot.blue_primitive_executors,
+                              blue_primitive_executor_map);
+    *yellow_team_world_msg = snapshot.yellow_team_world_msg;
+    *blue_team_world_msg   = snapshot.blue_team_world_msg;
+    frame_number           = snapshot.frame_number;
+    current_time           = snapshot.current_time;
+    blue_robot_with_ball   = snapshot.blue_robot_with_ball;
+    yellow_robot_with_ball = snapshot.yellow_robot_with_ball;
+}
+
+std::unique_ptr<ErForceSimulator> ErForceSimulator::fork() const
+{
+    auto realism_config = std::make_unique<RealismConfigErForce>(er_force_realism_config);
+    auto forked_simulator = std::make_unique<ErForceSimulator>(
+        field_type, robot_constants, realism_config, ramping,
+        primitive_executor_time_step, fidelity);
+    forked_simulator->restoreSnapshot(createSnapshot());
+    return forked_simulator;
+}
+
 std::vector<TbotsProto::RobotStatus> ErForceSimulator::getBlueRobotStatuses() const
 {
     std::vector<TbotsProto::RobotStatus> robot_statuses;
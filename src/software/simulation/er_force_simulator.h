@@ -20,6 +20,25 @@
 class ErForceSimulator
 {
    public:
+    /**
+     * The complete state of a simulation, including the physics simulation and the
+     * primitive executors of the robots. A snapshot does not refer to the simulator
+     * it was created by, so it can be restored into any simulator with the same
+     * field type and realism config.
+     */
+    struct Snapshot
+    {
+        camun::simulator::Simulator::Snapshot er_force_sim_snapshot;
+        std::unordered_map<unsigned int, PrimitiveExecutor> yellow_primitive_executors;
+        std::unordered_map<unsigned int, PrimitiveExecutor> blue_primitive_executors;
+        TbotsProto::World yellow_team_world_msg;
+        TbotsProto::World blue_team_world_msg;
+        unsigned int frame_number;
+        Timestamp current_time;
+        std::optional<RobotId> blue_robot_with_ball;
+        std::optional<RobotId> yellow_robot_with_ball;
+    };
+
     /**
      * Creates a new Simulator. The starting state of the simulation
      * will have the given field, with no robots or ball.
@@ -27,13 +46,19 @@ class ErForceSimulator
      * @param field_type The field type
      * @param robot_constants The robot constants
      * @param realism_config realism configuration
+     * @param ramping whether to ramp the velocities commanded to the robots
+     * @param primitive_executor_time_step_s the time step of the primitive executors
+     * @param fidelity the controls that trade the fidelity of the physics simulation
+     * for throughput
      */
     explicit ErForceSimulator(
         const TbotsProto::FieldType& field_type,
         const robot_constants::RobotConstants& robot_constants,
         std::unique_ptr<RealismConfigErForce>& realism_config, const bool ramping = false,
         Duration primitive_executor_time_step_s =
-            Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK));
+            Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK),
+        const camun::simulator::SimulatorFidelity& fidelity =
+            camun::simulator::SimulatorFidelity());
     ErForceSimulator()  = delete;
     ~ErForceSimulator() = default;
 
@@ -131,6 +156,35 @@ class ErForceSimulator
      */
     void resetCurrentTime();
 
+    /**
+     * Captures the complete state of the simulation, so that it can be restored later
+     * or restored into another simulator
+     *
+     * @return the snapshot of the simulation
+     */
+    Snapshot createSnapshot() const;
+
+    /**
+     * Restores the simulation to the given snapshot. Unlike setWorldState, this keeps
+     * the velocities, primitives and random number generators of the snapshot, so
+     * stepping the simulation afterwards continues the simulation from the snapshot.
+     *
+     * @pre the snapshot was created by a simulator with the same field type and
+     * realism config as this one
+     *
+     * @param snapshot the snapshot to restore
+     */
+    void restoreSnapshot(const Snapshot& snapshot);
+
+    /**
+     * Creates an independent copy of this simulator in its current state. The copy has
+     * its own physics world, so the copy and the original can be stepped concurrently
+     * on different threads.
+     *
+     * @return the copy of this simulator
+     */
+    std::unique_ptr<ErForceSimulator> fork() const;
+
     /**
      * Creates the default realism config using erforce simulator's default config
      * @return a pointer to default realism config
@@ -214,6 +268,11 @@ class ErForceSimulator
     std::unique_ptr<TbotsProto::World> yellow_team_world_msg;
     std::unique_ptr<TbotsProto::World> blue_team_world_msg;
 
+    // Kept so that the simulator can be forked
+    TbotsProto::FieldType field_type;
+    RealismConfigErForce er_force_realism_config;
+    camun::simulator::SimulatorFidelity fidelity;
+
     Duration primitive_executor_time_step;
     unsigned int frame_number;
 
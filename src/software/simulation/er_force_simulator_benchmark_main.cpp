@@ -0,0 +1,215 @@
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "shared/constants.h"
+#include "shared/robot_constants.h"
+#include "software/logger/logger.h"
+#include "software/simulation/er_force_simulator.h"
+
+/*
+ * This standalone program runs a full 11v11 Division A game in the ErForceSimulator,
+ * once at full fidelity and once in throughput mode, and reports how many simulated
+ * seconds each mode runs per wall second. Every robot is sent a Move primitive to a
+ * random destination once a second, so robots keep driving around, bumping into each
+ * other and pushing the ball, and the camera packets are generated on every tick like
+ * the simulator main does.
+ */
+
+static constexpr unsigned int NUM_ROBOTS_PER_TEAM = 11;
+
+/**
+ * Creates a Move primitive from the given position to the given destination
+ *
+ * @param position The current position of the robot, in its team's frame
+ * @param destination Where the robot should move to, in its team's frame
+ *
+ * @return the Move primitive
+ */
+static TbotsProto::Primitive createMovePrimitive(const Point& position,
+                                                 const Point& destination)
+{
+    TbotsProto::Primitive primitive;
+    TbotsProto::MovePrimitive* move = primitive.mutable_move();
+
+    *(move->mutable_xy_traj_params()->mutable_start_position()) =
+        *createPointProto(position);
+    *(move->mutable_xy_traj_params()->mutable_destination()) =
+        *createPointProto(destination);
+    move->mutable_xy_traj_params()->set_max_speed_mode(
+        TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+
+    *(move->mutable_w_traj_params()->mutable_start_angle()) =
+        *createAngleProto(Angle::zero());
+    *(move->mutable_w_traj_params()->mutable_final_angle()) =
+        *createAngleProto((destination - position).orientation());
+
+    return primitive;
+}
+
+/**
+ * Creates a primitive set that sends every robot of a team to a random destination
+ *
+ * @param sim_robots The robots of the team in the simulator
+ * @param invert Whether the team's frame is rotated by 180 degrees from the
+ * simulator's frame, which is the case for the yellow team
+ * @param field The field the robots are on
+ * @param random_engine The random engine to pick the destinations with
+ *
+ * @return the primitive set
+ */
+static TbotsProto::PrimitiveSet createRandomMovePrimitiveSet(
+    const google::protobuf::RepeatedPtrField<world::SimRobot>& sim_robots, bool invert,
+    const Field& field, std::mt19937& random_engine)
+{
+    std::uniform_real_distribution<double> x_distribution(-field.xLength() / 2,
+                                                          field.xLength() / 2);
+    std::uniform_real_distribution<double> y_distribution(-field.yLength() / 2,
+                                                          field.yLength() / 2);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    for (const auto& sim_robot : sim_robots)
+    {
+        const Point position = invert ? Point(-sim_robot.p_x(), -sim_robot.p_y())
+                                      : Point(sim_robot.p_x(), sim_robot.p_y());
+        const Point destination(x_distribution(random_engine),
+                                y_distribution(random_engine));
+        (*primitive_set.mutable_robot_primitives())[sim_robot.id()] =
+            createMovePrimitive(position, destination);
+    }
+    return primitive_set;
+}
+
+/**
+ * Creates the starting states of one team, spread over their half of the field
+ *
+ * @param field The field the robots are on
+ *
+ * @return the starting states of the robots
+ */
+static std::vector<RobotStateWithId> createStartingRobotStates(const Field& field)
+{
+    std::vector<RobotStateWithId> robot_states;
+    for (unsigned int id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+    {
+        const Point position(-field.xLength() / 4 + (id % 2) * 0.5,
+                             -field.yLength() / 2 +
+                                 field.yLength() * (id + 0.5) / NUM_ROBOTS_PER_TEAM);
+        robot_states.push_back(RobotStateWithId{
+            .id          = id,
+            .robot_state = RobotState(position, Vector(), Angle::zero(),
+                                      AngularVelocity::zero())});
+    }
+    return robot_states;
+}
+
+/**
+ * Runs the game in the simulator and measures the time it took
+ *
+ * @param fidelity The fidelity controls of the simulator
+ * @param duration_s How many seconds to simulate
+ * @param seed The seed of the random destinations
+ *
+ * @return the number of simulated seconds per wall second
+ */
+static double runGame(const camun::simulator::SimulatorFidelity& fidelity,
+                      double duration_s, unsigned int seed)
+{
+    const Duration tick =
+        Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK);
+    auto realism_config = ErForceSimulator::createDefaultRealismConfig();
+    ErForceSimulator simulator(TbotsProto::FieldType::DIV_A,
+                               robot_constants::createRobotConstants(), realism_config,
+                               false, tick, fidelity);
+    const Field field = simulator.getField();
+
+    simulator.setBallState(BallState(Point(0, 0), Vector()));
+    simulator.setBlueRobots(createStartingRobotStates(field));
+    simulator.setYellowRobots(createStartingRobotStates(field));
+
+    std::mt19937 random_engine(seed);
+    const auto num_ticks      = static_cast<std::size_t>(duration_s / tick.toSeconds());
+    const auto ticks_per_move = static_cast<std::size_t>(1.0 / tick.toSeconds());
+    std::size_t num_packets   = 0;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < num_ticks; i++)
+    {
+        if (i % ticks_per_move == 0)
+        {
+            const world::SimulatorState state = simulator.getSimulatorState();
+            simulator.setBlueRobotPrimitiveSet(
+                createRandomMovePrimitiveSet(state.blue_robots(), false, field,
+                                             random_engine),
+                std::make_unique<TbotsProto::World>());
+            simulator.setYellowRobotPrimitiveSet(
+                createRandomMovePrimitiveSet(state.yellow_robots(), true, field,
+                                             random_engine),
+                std::make_unique<TbotsProto::World>());
+        }
+
+        simulator.stepSimulation(tick);
+        num_packets += simulator.getSSLWrapperPackets().size();
+    }
+    const double wall_time_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+
+    LOG(INFO) << "Generated " << num_packets << " camera packets";
+    return duration_s / wall_time_s;
+}
+
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help               = false;
+        std::string runtime_dir = "/tmp/tbots";
+        double duration_s       = 60.0;
+        unsigned int seed       = 0;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()("runtime_dir",
+                       boost::program_options::value<std::string>(&args.runtime_dir),
+                       "The directory to output logs.");
+    desc.add_options()("duration_s",
+                       boost::program_options::value<double>(&args.duration_s),
+                       "How many seconds of the game to simulate in each mode.");
+    desc.add_options()("seed", boost::program_options::value<unsigned int>(&args.seed),
+                       "Seed of the random robot destinations.");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    LoggerSingleton::initializeLogger(args.runtime_dir, nullptr, false);
+
+    const double full_fidelity_speed =
+        runGame(camun::simulator::SimulatorFidelity(), args.duration_s, args.seed);
+    const double throughput_speed = runGame(
+        camun::simulator::SimulatorFidelity::throughput(), args.duration_s, args.seed);
+
+    std::cout << std::left << std::setw(20) << "mode" << std::right << std::setw(25)
+              << "simulated s / wall s" << std::endl;
+    std::cout << std::left << std::setw(20) << "full fidelity" << std::right
+              << std::fixed << std::setprecision(2) << std::setw(25)
+              << full_fidelity_speed << std::endl;
+    std::cout << std::left << std::setw(20) << "throughput" << std::right << std::fixed
+              << std::setprecision(2) << std::setw(25) << throughput_speed << std::endl;
+
+    return 0;
+}
@@ -303,6 +303,90 @@ TEST_F(ErForceSimulatorTest, yellow_robot_add_robots_and_change_position)
     EXPECT_EQ(new_states.size(), yellow_robots.size());
 }
 
+TEST_F(ErForceSimulatorTest, restore_snapshot_continues_simulation_from_snapshot)
+{
+    RobotState robot_state1(Point(1, 1), Vector(-1, 0), Angle::zero(),
+                            AngularVelocity::half());
+    RobotState robot_state2(Point(0, -1), Vector(0, 1), Angle::quarter(),
+                            AngularVelocity::zero());
+
+    std::vector<RobotStateWithId> states = {
+        RobotStateWithId{.id = 0, .robot_state = robot_state1},
+        RobotStateWithId{.id = 1, .robot_state = robot_state2},
+    };
+
+    simulator->setBallState(BallState(Point(-1, 0.5), Vector(2, -0.5)));
+    simulator->setYellowRobots(states);
+    simulator->stepSimulation(Duration::fromMilliseconds(50));
+
+    const ErForceSimulator::Snapshot snapshot = simulator->createSnapshot();
+    for (int i = 0; i < 50; i++)
+    {
+        simulator->stepSimulation(Duration::fromMilliseconds(5));
+    }
+    const world::SimulatorState expected_state = simulator->getSimulatorState();
+    const Timestamp expected_timestamp         = simulator->getTimestamp();
+
+    simulator->restoreSnapshot(snapshot);
+    for (int i = 0; i < 50; i++)
+    {
+        simulator->stepSimulation(Duration::fromMilliseconds(5));
+    }
+    const world::SimulatorState state = simulator->getSimulatorState();
+
+    EXPECT_EQ(expected_timestamp, simulator->getTimestamp());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(state.ball().p_x(),
+                                               expected_state.ball().p_x(), 0.01));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(state.ball().p_y(),
+                                               expected_state.ball().p_y(), 0.01));
+    ASSERT_EQ(state.yellow_robots_size(), expected_state.yellow_robots_size());
+    for (int i = 0; i < state.yellow_robots_size(); i++)
+    {
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(
+            state.yellow_robots(i).p_x(), expected_state.yellow_robots(i).p_x(), 0.01));
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(
+            state.yellow_robots(i).p_y(), expected_state.yellow_robots(i).p_y(), 0.01));
+    }
+}
+
+TEST_F(ErForceSimulatorTest, restore_snapshot_removes_robots_added_after_snapshot)
+{
+    simulator->setYellowRobots(TestUtil::createStationaryRobotStatesWithId(
+        {Point(-1, 0), Point(1, 0)}));
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    const ErForceSimulator::Snapshot snapshot = simulator->createSnapshot();
+
+    simulator->setYellowRobots({RobotStateWithId{
+        .id          = 2,
+        .robot_state = RobotState(Point(0, 2), Vector(), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    EXPECT_EQ(3, simulator->getSimulatorState().yellow_robots_size());
+
+    simulator->restoreSnapshot(snapshot);
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    EXPECT_EQ(2, simulator->getSimulatorState().yellow_robots_size());
+}
+
+TEST_F(ErForceSimulatorTest, forked_simulator_is_independent_of_original)
+{
+    simulator->setBallState(BallState(Point(0, 0), Vector(1, 0)));
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+
+    std::unique_ptr<ErForceSimulator> forked_simulator = simulator->fork();
+    EXPECT_EQ(simulator->getTimestamp(), forked_simulator->getTimestamp());
+
+    simulator->setBallState(BallState(Point(2, 2), Vector(0, 0)));
+    simulator->stepSimulation(Duration::fromMilliseconds(100));
+    forked_simulator->stepSimulation(Duration::fromMilliseconds(100));
+
+    const world::SimBall ball        = simulator->getSimulatorState().ball();
+    const world::SimBall forked_ball = forked_simulator->getSimulatorState().ball();
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(ball.p_x(), 2, 0.01));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(ball.p_y(), 2, 0.01));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(forked_ball.p_x(), 0.1, 0.02));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(forked_ball.p_y(), 0, 0.01));
+}
 
 TEST(ErForceSimulatorFieldTest, check_field_A_configuration)
 {
@@ -329,3 +413,56 @@ TEST(ErForceSimulatorFieldTest, check_field_B_configuration)
 
     EXPECT_EQ(simulator->getField(), Field::createSSLDivisionBField());
 }
+
+class ErForceSimulatorThroughputModeTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        auto realism_config = ErForceSimulator::createDefaultRealismConfig();
+        simulator           = std::make_shared<ErForceSimulator>(
+            TbotsProto::FieldType::DIV_B, robot_constants, realism_config, false,
+            Duration::fromSeconds(DEFAULT_SIMULATOR_TICK_RATE_SECONDS_PER_TICK),
+            camun::simulator::SimulatorFidelity::throughput());
+        simulator->resetCurrentTime();
+    }
+
+    std::shared_ptr<ErForceSimulator> simulator;
+    robot_constants::RobotConstants robot_constants =
+        robot_constants::createRobotConstants();
+};
+
+TEST_F(ErForceSimulatorThroughputModeTest, camera_packets_are_decimated)
+{
+    simulator->setBallState(BallState(Point(1, 2), Vector()));
+
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    EXPECT_FALSE(simulator->getSSLWrapperPackets().empty());
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    EXPECT_TRUE(simulator->getSSLWrapperPackets().empty());
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+    EXPECT_FALSE(simulator->getSSLWrapperPackets().empty());
+}
+
+TEST_F(ErForceSimulatorThroughputModeTest, robots_keep_velocity)
+{
+    RobotState robot_state1(Point(1, 0), Vector(2, 0), Angle::zero(),
+                            AngularVelocity::zero());
+    RobotState robot_state2(Point(0, 1), Vector(0, 0), Angle::zero(),
+                            AngularVelocity::zero());
+
+    std::vector<RobotStateWithId> states = {
+        RobotStateWithId{.id = 0, .robot_state = robot_state1},
+        RobotStateWithId{.id = 1, .robot_state = robot_state2},
+    };
+
+    simulator->setYellowRobots(states);
+    simulator->stepSimulation(Duration::fromMilliseconds(5));
+
+    auto yellow_robots = simulator->getSimulatorState().yellow_robots();
+
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(yellow_robots[0].v_x(), 2.0, 0.1));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(yellow_robots[0].v_y(), 0, 0.1));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(yellow_robots[1].p_x(), 0, 0.01));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(yellow_robots[1].p_y(), 1, 0.01));
+}
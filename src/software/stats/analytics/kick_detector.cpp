@@ -0,0 +1,55 @@
+#include "software/stats/analytics/kick_detector.h"
+
+#include "software/geom/algorithms/intersection.h"
+
+KickDetector::KickDetector(const ReplayStatsConfig& config)
+    : config_(config), last_possessor_(std::nullopt), last_possession_time_sec_(0.0)
+{
+}
+
+std::optional<KickEvent> KickDetector::update(const World& world, double timestamp_sec)
+{
+    const Ball& ball = world.ball();
+
+    std::optional<Robot> possessor = findRobotInPossession(
+        world.friendlyTeam(), ball.position(), config_.possession_distance_m);
+    if (possessor.has_value())
+    {
+        last_possessor_           = possessor;
+        last_possession_time_sec_ = timestamp_sec;
+        return std::nullopt;
+    }
+
+    if (!last_possessor_.has_value())
+    {
+        return std::nullopt;
+    }
+
+    if (timestamp_sec - last_possession_time_sec_ > MAX_TIME_SINCE_POSSESSION_SEC)
+    {
+        // The ball rolled away from the robot rather than being kicked
+        last_possessor_.reset();
+        return std::nullopt;
+    }
+
+    if (ball.velocity().length() < config_.min_kick_speed_m_per_s)
+    {
+        return std::nullopt;
+    }
+
+    KickEvent kick = {
+        .kick_time_sec = last_possession_time_sec_,
+        .kicker        = last_possessor_.value(),
+        .kick_origin   = last_possessor_->position(),
+        .ball_velocity = ball.velocity(),
+    };
+    last_possessor_.reset();
+    return kick;
+}
+
+bool isShotOnEnemyGoal(const Field& field, const KickEvent& kick)
+{
+    const Segment enemy_goal_line(field.enemyGoalpostPos(), field.enemyGoalpostNeg());
+    return !intersection(Ray(kick.kick_origin, kick.ball_velocity), enemy_goal_line)
+                .empty();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <optional>
+
+#include "software/stats/analytics/replay_stats_tracker.h"
+#include "software/world/world.h"
+
+/**
+ * A kick by a friendly robot, detected from the ball leaving the robot's dribbler
+ */
+struct KickEvent
+{
+    double kick_time_sec;
+    Robot kicker;
+    Point kick_origin;
+    Vector ball_velocity;
+};
+
+/**
+ * Detects kicks by friendly robots from a stream of Worlds.
+ *
+ * Replays don't record when a robot actually fires its kicker, so a kick is detected
+ * when the ball leaves a friendly robot's possession at more than the minimum kick
+ * speed shortly after the robot had the ball.
+ */
+class KickDetector
+{
+   public:
+    /**
+     * Creates a new KickDetector
+     *
+     * @param config The possession and kick thresholds to use
+     */
+    explicit KickDetector(const ReplayStatsConfig& config);
+
+    /**
+     * Updates the detector with the next World of the replay
+     *
+     * @param world The world
+     * @param timestamp_sec The time the world was logged
+     *
+     * @return the kick that was taken, if the ball was kicked since the last update
+     */
+    std::optional<KickEvent> update(const World& world, double timestamp_sec);
+
+   private:
+    // The ball must reach kick speed within this time of leaving the robot for the
+    // robot to be credited with the kick
+    static constexpr double MAX_TIME_SINCE_POSSESSION_SEC = 0.3;
+
+    ReplayStatsConfig config_;
+    std::optional<Robot> last_possessor_;
+    double last_possession_time_sec_;
+};
+
+/**
+ * Returns true if the kick is headed into the enemy goal, i.e. it is a shot rather
+ * than a pass
+ *
+ * @param field The field
+ * @param kick The kick
+ *
+ * @return whether the kick is a shot on the enemy goal
+ */
+bool isShotOnEnemyGoal(const Field& field, const KickEvent& kick);
@@ -0,0 +1,69 @@
+#include "software/stats/analytics/pass_stats_tracker.h"
+
+#include "software/geom/algorithms/contains.h"
+
+PassStatsTracker::PassStatsTracker(const ReplayStatsConfig& config)
+    : ReplayStatsTracker(config, {"kick_time_s", "passer_id", "passer_x", "passer_y",
+                                  "kick_speed_m_per_s", "end_time_s", "receiver_id",
+                                  "end_x", "end_y", "pass_length_m", "successful"}),
+      kick_detector_(config),
+      pass_in_flight_(std::nullopt)
+{
+}
+
+void PassStatsTracker::onWorld(const World& world, double timestamp_sec)
+{
+    const Point& ball_position = world.ball().position();
+
+    if (pass_in_flight_.has_value())
+    {
+        auto friendly_robot = findRobotInPossession(world.friendlyTeam(), ball_position,
+                                                    config_.possession_distance_m);
+        auto enemy_robot    = findRobotInPossession(world.enemyTeam(), ball_position,
+                                                    config_.possession_distance_m);
+
+        if (friendly_robot.has_value() &&
+            friendly_robot->id() != pass_in_flight_->kicker.id())
+        {
+            endPass(timestamp_sec, ball_position, friendly_robot);
+        }
+        else if (friendly_robot.has_value() || enemy_robot.has_value() ||
+                 !contains(world.field().fieldLines(), ball_position) ||
+                 timestamp_sec - pass_in_flight_->kick_time_sec >
+                     config_.max_kick_duration_sec)
+        {
+            endPass(timestamp_sec, ball_position, std::nullopt);
+        }
+    }
+
+    std::optional<KickEvent> kick = kick_detector_.update(world, timestamp_sec);
+    if (kick.has_value() && !isShotOnEnemyGoal(world.field(), kick.value()))
+    {
+        pass_in_flight_ = kick;
+    }
+}
+
+void PassStatsTracker::endPass(double end_time_sec, const Point& end_position,
+                               const std::optional<Robot>& receiver)
+{
+    const KickEvent& pass = pass_in_flight_.value();
+    table_.appendRow({
+        pass.kick_time_sec,
+        static_cast<double>(pass.kicker.id()),
+        pass.kick_origin.x(),
+        pass.kick_origin.y(),
+        pass.ball_velocity.length(),
+        end_time_sec,
+        receiver.has_value() ? static_cast<double>(receiver->id()) : -1.0,
+        end_position.x(),
+        end_position.y(),
+        (end_position - pass.kick_origin).length(),
+        receiver.has_value() ? 1.0 : 0.0,
+    });
+    pass_in_flight_.reset();
+}
+
+// Register this tracker in the genericFactory
+static TGenericFactory<std::string, ReplayStatsTracker, PassStatsTracker,
+                       ReplayStatsConfig>
+    factory;
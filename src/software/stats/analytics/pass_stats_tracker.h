@@ -0,0 +1,42 @@
+#pragma once
+
+#include "software/stats/analytics/kick_detector.h"
+#include "software/stats/analytics/replay_stats_tracker.h"
+
+/**
+ * Records every friendly pass and whether it succeeded.
+ *
+ * Columns: kick_time_s, passer_id, passer_x, passer_y, kick_speed_m_per_s,
+ * end_time_s, receiver_id, end_x, end_y, pass_length_m, successful
+ *
+ * A pass is any friendly kick that is not headed into the enemy goal. It succeeds if
+ * another friendly robot gains possession of the ball before an enemy robot does, the
+ * ball leaves the field, or config.max_kick_duration_sec elapses. receiver_id is -1
+ * for unsuccessful passes.
+ */
+class PassStatsTracker : public ReplayStatsTracker
+{
+   public:
+    /**
+     * Creates a new PassStatsTracker
+     *
+     * @param config The possession and kick thresholds to use
+     */
+    explicit PassStatsTracker(const ReplayStatsConfig& config);
+
+    void onWorld(const World& world, double timestamp_sec) override;
+
+   private:
+    /**
+     * Adds a row for the pass in flight and clears it
+     *
+     * @param end_time_sec The time the pass ended
+     * @param end_position The position of the ball when the pass ended
+     * @param receiver The friendly robot that received the pass, if it was successful
+     */
+    void endPass(double end_time_sec, const Point& end_position,
+                 const std::optional<Robot>& receiver);
+
+    KickDetector kick_detector_;
+    std::optional<KickEvent> pass_in_flight_;
+};
@@ -0,0 +1,67 @@
+#include "software/stats/analytics/possession_stats_tracker.h"
+
+PossessionStatsTracker::PossessionStatsTracker(const ReplayStatsConfig& config)
+    : ReplayStatsTracker(
+          config, {"team", "robot_id", "start_time_s", "end_time_s", "duration_s"}),
+      current_possession_(std::nullopt),
+      last_timestamp_sec_(0.0)
+{
+}
+
+void PossessionStatsTracker::onWorld(const World& world, double timestamp_sec)
+{
+    last_timestamp_sec_ = timestamp_sec;
+
+    const Point& ball_position = world.ball().position();
+    std::optional<Possession> new_possession;
+    if (auto robot = findRobotInPossession(world.friendlyTeam(), ball_position,
+                                           config_.possession_distance_m))
+    {
+        new_possession = Possession{true, robot->id(), timestamp_sec};
+    }
+    else if (auto robot = findRobotInPossession(world.enemyTeam(), ball_position,
+                                                config_.possession_distance_m))
+    {
+        new_possession = Possession{false, robot->id(), timestamp_sec};
+    }
+
+    // Only team changes end a possession, passes within a team do not
+    bool possession_changed =
+        current_possession_.has_value() != new_possession.has_value() ||
+        (current_possession_.has_value() &&
+         current_possession_->friendly != new_possession->friendly);
+    if (!possession_changed)
+    {
+        return;
+    }
+
+    endPossession(timestamp_sec);
+    current_possession_ = new_possession;
+}
+
+void PossessionStatsTracker::onReplayEnd()
+{
+    endPossession(last_timestamp_sec_);
+    current_possession_.reset();
+}
+
+void PossessionStatsTracker::endPossession(double end_time_sec)
+{
+    if (!current_possession_.has_value())
+    {
+        return;
+    }
+
+    table_.appendRow({
+        std::string(current_possession_->friendly ? "friendly" : "enemy"),
+        static_cast<double>(current_possession_->robot_id),
+        current_possession_->start_time_sec,
+        end_time_sec,
+        end_time_sec - current_possession_->start_time_sec,
+    });
+}
+
+// Register this tracker in the genericFactory
+static TGenericFactory<std::string, ReplayStatsTracker, PossessionStatsTracker,
+                       ReplayStatsConfig>
+    factory;
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "software/stats/analytics/replay_stats_tracker.h"
+
+/**
+ * Records every interval during which one team has possession of the ball.
+ *
+ * Columns: team, robot_id, start_time_s, end_time_s, duration_s
+ *
+ * robot_id is the robot that gained possession for the team. Possession is checked for
+ * the friendly team first, so contested balls count as friendly possession, matching
+ * the live PossessionTracker.
+ */
+class PossessionStatsTracker : public ReplayStatsTracker
+{
+   public:
+    /**
+     * Creates a new PossessionStatsTracker
+     *
+     * @param config The possession thresholds to use
+     */
+    explicit PossessionStatsTracker(const ReplayStatsConfig& config);
+
+    void onWorld(const World& world, double timestamp_sec) override;
+    void onReplayEnd() override;
+
+   private:
+    /**
+     * Adds a row for the current possession interval, if there is one
+     *
+     * @param end_time_sec The time the possession ended
+     */
+    void endPossession(double end_time_sec);
+
+    struct Possession
+    {
+        bool friendly;
+        RobotId robot_id;
+        double start_time_sec;
+    };
+
+    std::optional<Possession> current_possession_;
+    double last_timestamp_sec_;
+};
@@ -0,0 +1,61 @@
+#include "software/stats/analytics/possession_stats_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/test_util.h"
+
+class PossessionStatsTrackerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        world = TestUtil::createBlankTestingWorld();
+        TestUtil::setFriendlyRobotPositions(world, {Point(0, 0)}, Timestamp());
+        TestUtil::setEnemyRobotPositions(world, {Point(2, 0)}, Timestamp());
+    }
+
+    /**
+     * Moves the ball in front of the given point and updates the tracker
+     *
+     * @param robot_position The position of the robot that should have the ball
+     * @param timestamp_sec The time of the update
+     */
+    void updateWithBallInFrontOf(const Point& robot_position, double timestamp_sec)
+    {
+        TestUtil::setBallPosition(world, robot_position + Vector(0.09, 0),
+                                  Timestamp::fromSeconds(timestamp_sec));
+        tracker->onWorld(*world, timestamp_sec);
+    }
+
+    std::shared_ptr<World> world;
+    std::unique_ptr<ReplayStatsTracker> tracker =
+        ReplayStatsTrackerFactory::create("PossessionStatsTracker", ReplayStatsConfig());
+};
+
+TEST_F(PossessionStatsTrackerTest, no_possession)
+{
+    TestUtil::setBallPosition(world, Point(-2, 2), Timestamp::fromSeconds(1));
+    tracker->onWorld(*world, 1.0);
+    tracker->onReplayEnd();
+
+    EXPECT_EQ(tracker->getTable().numRows(), 0);
+}
+
+TEST_F(PossessionStatsTrackerTest, possession_changes_between_teams)
+{
+    updateWithBallInFrontOf(Point(0, 0), 0.0);
+    updateWithBallInFrontOf(Point(0, 0), 0.5);
+    updateWithBallInFrontOf(Point(2, 0), 1.0);
+    updateWithBallInFrontOf(Point(2, 0), 2.0);
+    tracker->onReplayEnd();
+
+    const StatsTable& table = tracker->getTable();
+    ASSERT_EQ(table.numRows(), 2);
+    EXPECT_EQ(table.getColumn("team"),
+              std::vector<StatsTable::Value>(
+                  {std::string("friendly"), std::string("enemy")}));
+    EXPECT_EQ(table.getColumn("start_time_s"),
+              std::vector<StatsTable::Value>({0.0, 1.0}));
+    EXPECT_EQ(table.getColumn("end_time_s"), std::vector<StatsTable::Value>({1.0, 2.0}));
+    EXPECT_EQ(table.getColumn("duration_s"), std::vector<StatsTable::Value>({1.0, 1.0}));
+}
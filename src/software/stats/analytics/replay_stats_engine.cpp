@@ -0,0 +1,170 @@
+#include "software/stats/analytics/replay_stats_engine.h"
+
+#include <algorithm>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <memory>
+#include <mutex>
+
+#include "proto/message_translation/world_delta.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/logger.h"
+#include "software/logger/proto_replay_reader.h"
+
+ReplayStatsEngine::ReplayStatsEngine(const ReplayStatsConfig& config,
+                                     const std::vector<std::string>& tracker_names,
+                                     unsigned int num_threads)
+    : config_(config),
+      tracker_names_(tracker_names),
+      num_threads_(std::max(num_threads, 1u))
+{
+    const std::vector<std::string> registered_names =
+        ReplayStatsTrackerFactory::getRegisteredNames();
+
+    if (tracker_names_.empty())
+    {
+        tracker_names_ = registered_names;
+    }
+
+    for (const std::string& tracker_name : tracker_names_)
+    {
+        if (std::find(registered_names.begin(), registered_names.end(), tracker_name) ==
+            registered_names.end())
+        {
+            throw std::invalid_argument("ReplayStatsEngine: No tracker named " +
+                                        tracker_name);
+        }
+    }
+}
+
+std::map<std::string, StatsTable> ReplayStatsEngine::run(
+    const std::vector<std::string>& replay_folder_paths) const
+{
+    std::map<std::string, StatsTable> merged_tables;
+    std::mutex merged_tables_mutex;
+
+    boost::asio::thread_pool thread_pool(num_threads_);
+    for (const std::string& replay_folder_path : replay_folder_paths)
+    {
+        boost::asio::post(
+            thread_pool,
+            [&, replay_folder_path]()
+            {
+                std::map<std::string, StatsTable> tables;
+                try
+                {
+                    tables = processReplay(replay_folder_path);
+                }
+                catch (const std::exception& e)
+                {
+                    LOG(WARNING) << "Skipping replay " << replay_folder_path << ": "
+                                 << e.what();
+                    return;
+                }
+
+                std::scoped_lock lock(merged_tables_mutex);
+                for (auto& [tracker_name, table] : tables)
+                {
+                    auto merged_table = merged_tables.find(tracker_name);
+                    if (merged_table == merged_tables.end())
+                    {
+                        merged_tables.emplace(tracker_name, std::move(table));
+                    }
+                    else
+                    {
+                        merged_table->second.appendTable(table);
+                    }
+                }
+            });
+    }
+    thread_pool.join();
+
+    return merged_tables;
+}
+
+std::map<std::string, StatsTable> ReplayStatsEngine::processReplay(
+    const std::string& replay_folder_path) const
+{
+    std::vector<std::unique_ptr<ReplayStatsTracker>> trackers;
+    for (const std::string& tracker_name : tracker_names_)
+    {
+        trackers.push_back(ReplayStatsTrackerFactory::create(tracker_name, config_));
+    }
+
+    ProtoReplayReader reader(replay_folder_path, NUM_DECODER_THREADS_PER_REPLAY);
+
+    const std::string world_type_name = TbotsProto::World::descriptor()->full_name();
+    const std::string world_delta_type_name =
+        TbotsProto::WorldDelta::descriptor()->full_name();
+    const std::string primitive_set_type_name =
+        TbotsProto::PrimitiveSet::descriptor()->full_name();
+
+    auto update_trackers_with_world = [&](const TbotsProto::World& world_proto,
+                                          double timestamp_sec)
+    {
+        const World world(world_proto);
+        for (auto& tracker : trackers)
+        {
+            tracker->onWorld(world, timestamp_sec);
+        }
+    };
+
+    // Newer replays log the World as a stream of WorldDeltas, older ones log it whole
+    WorldDeltaDecoder world_delta_decoder;
+    TbotsProto::World decoded_world;
+
+    for (std::size_t chunk_index = 0; chunk_index < reader.getNumChunks(); chunk_index++)
+    {
+        for (const ReplayLogEntry& entry : reader.getChunkEntries(chunk_index))
+        {
+            if (entry.protobuf_type_full_name == world_type_name)
+            {
+                update_trackers_with_world(
+                    static_cast<const TbotsProto::World&>(*entry.message),
+                    entry.timestamp_sec);
+            }
+            else if (entry.protobuf_type_full_name == world_delta_type_name)
+            {
+                // Deltas before the first keyframe can't be decoded, and are skipped
+                if (world_delta_decoder.decode(
+                        static_cast<const TbotsProto::WorldDelta&>(*entry.message),
+                        decoded_world))
+                {
+                    update_trackers_with_world(decoded_world, entry.timestamp_sec);
+                }
+            }
+            else if (entry.protobuf_type_full_name == primitive_set_type_name)
+            {
+                const auto& primitive_set =
+                    static_cast<const TbotsProto::PrimitiveSet&>(*entry.message);
+                for (auto& tracker : trackers)
+                {
+                    tracker->onPrimitiveSet(primitive_set, entry.timestamp_sec);
+                }
+            }
+        }
+    }
+
+    const std::string match_name = fs::path(replay_folder_path).filename().string();
+
+    std::map<std::string, StatsTable> tables;
+    for (std::size_t i = 0; i < trackers.size(); i++)
+    {
+        trackers[i]->onReplayEnd();
+
+        StatsTable table = trackers[i]->getTable();
+        table.prependColumn("match", match_name);
+        tables.emplace(tracker_names_[i], std::move(table));
+    }
+    return tables;
+}
+
+void ReplayStatsEngine::writeTables(const std::map<std::string, StatsTable>& tables,
+                                    const std::string& output_folder_path)
+{
+    fs::create_directories(output_folder_path);
+    for (const auto& [tracker_name, table] : tables)
+    {
+        table.writeCsv((fs::path(output_folder_path) / (tracker_name + ".csv")).string());
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "software/stats/analytics/replay_stats_tracker.h"
+#include "software/stats/analytics/stats_table.h"
+
+/**
+ * Computes match statistics in bulk from a set of replay logs.
+ *
+ * Every replay is processed by its own set of ReplayStatsTrackers, and replays are
+ * processed in parallel on a thread pool. Within a replay, chunks are decoded ahead of
+ * time by the replay's ProtoReplayReader so the trackers are rarely waiting on I/O.
+ *
+ * Replays may log the World either whole or as a stream of WorldDeltas, which are
+ * decoded back into Worlds before being passed to the trackers.
+ *
+ * The results of each tracker are merged into a single table over all replays, with a
+ * leading "match" column containing the name of the replay folder each row came from.
+ */
+class ReplayStatsEngine
+{
+   public:
+    /**
+     * Creates a new ReplayStatsEngine
+     *
+     * @param config The thresholds used by the trackers
+     * @param tracker_names The names of the trackers to run. If empty, every registered
+     * tracker is run.
+     * @param num_threads The number of replays to process at once
+     *
+     * @throws std::invalid_argument if a tracker name is not registered
+     */
+    explicit ReplayStatsEngine(const ReplayStatsConfig& config,
+                               const std::vector<std::string>& tracker_names = {},
+                               unsigned int num_threads = DEFAULT_NUM_THREADS);
+
+    /**
+     * Runs the trackers over the given replays. Replays that cannot be read are
+     * skipped with a warning.
+     *
+     * @param replay_folder_paths The folders containing the replay chunks of each match
+     *
+     * @return the merged table of each tracker, keyed by tracker name
+     */
+    std::map<std::string, StatsTable> run(
+        const std::vector<std::string>& replay_folder_paths) const;
+
+    /**
+     * Writes each table to "<output_folder_path>/<tracker name>.csv"
+     *
+     * @param tables The tables returned by run
+     * @param output_folder_path The folder to write the tables to. Created if it
+     * doesn't exist.
+     */
+    static void writeTables(const std::map<std::string, StatsTable>& tables,
+                            const std::string& output_folder_path);
+
+    /**
+     * Runs the trackers over a single replay
+     *
+     * @param replay_folder_path The folder containing the replay chunks
+     *
+     * @return the table of each tracker for this replay, keyed by tracker name
+     */
+    std::map<std::string, StatsTable> processReplay(
+        const std::string& replay_folder_path) const;
+
+   private:
+    static constexpr unsigned int DEFAULT_NUM_THREADS = 4;
+
+    // Each replay already decodes its chunks on a few threads of its own, so the
+    // decoder pool per replay is kept small
+    static constexpr unsigned int NUM_DECODER_THREADS_PER_REPLAY = 2;
+
+    const ReplayStatsConfig config_;
+    std::vector<std::string> tracker_names_;
+    const unsigned int num_threads_;
+};
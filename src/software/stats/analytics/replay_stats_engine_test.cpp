@@ -0,0 +1,153 @@
+#include "software/stats/analytics/replay_stats_engine.h"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include "proto/message_translation/tbots_protobuf.h"
+#include "proto/message_translation/world_delta.h"
+#include "shared/constants.h"
+#include "software/logger/compat_flags.h"
+#include "software/logger/proto_logger.h"
+#include "software/test_util/test_util.h"
+
+class ReplayStatsEngineTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        fs::remove_all(replay_folder);
+        fs::create_directories(replay_folder);
+
+        world = TestUtil::createBlankTestingWorld();
+        TestUtil::setFriendlyRobotPositions(world, {Point(0, 0)}, Timestamp());
+        TestUtil::setEnemyRobotPositions(world, {Point(2, 0)}, Timestamp());
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(replay_folder);
+    }
+
+    /**
+     * Gets the World with the ball in front of the given point, as a proto
+     *
+     * @param robot_position The position of the robot that should have the ball
+     * @param timestamp_sec The time of the World
+     *
+     * @return the World proto
+     */
+    TbotsProto::World worldWithBallInFrontOf(const Point& robot_position,
+                                             double timestamp_sec)
+    {
+        TestUtil::setBallPosition(world, robot_position + Vector(0.09, 0),
+                                  Timestamp::fromSeconds(timestamp_sec));
+        return *createWorld(*world);
+    }
+
+    /**
+     * Writes a replay chunk in the format produced by ProtoLogger
+     *
+     * @param entries The serialized log entries of the chunk
+     */
+    void writeChunk(const std::string& entries)
+    {
+        const std::string chunk_path =
+            replay_folder + "/0." + REPLAY_FILE_EXTENSION;
+        gzFile gz_file = gzopen(chunk_path.c_str(), "wb");
+        ASSERT_TRUE(gz_file);
+
+        const std::string contents = REPLAY_FILE_VERSION_PREFIX +
+                                     std::to_string(REPLAY_FILE_VERSION) + "\n" +
+                                     entries;
+        gzwrite(gz_file, contents.data(), static_cast<unsigned>(contents.size()));
+        gzclose(gz_file);
+    }
+
+    /**
+     * Checks that the possession table has friendly possession from 0s to 1s
+     * followed by enemy possession from 1s to 2s
+     *
+     * @param tables The tables produced by the engine
+     */
+    static void expectPossessionChanges(const std::map<std::string, StatsTable>& tables)
+    {
+        const StatsTable& table = tables.at("PossessionStatsTracker");
+        ASSERT_EQ(table.numRows(), 2);
+        EXPECT_EQ(table.getColumn("team"),
+                  std::vector<StatsTable::Value>(
+                      {std::string("friendly"), std::string("enemy")}));
+        EXPECT_EQ(table.getColumn("start_time_s"),
+                  std::vector<StatsTable::Value>({0.0, 1.0}));
+        EXPECT_EQ(table.getColumn("end_time_s"),
+                  std::vector<StatsTable::Value>({1.0, 2.0}));
+    }
+
+    const std::string replay_folder = "/tmp/replay_stats_engine_test";
+
+    // The time of each World in the replay, and the position of the robot with the ball
+    const std::vector<std::pair<double, Point>> possessing_robot_positions = {
+        {0.0, Point(0, 0)},
+        {0.5, Point(0, 0)},
+        {1.0, Point(2, 0)},
+        {2.0, Point(2, 0)},
+    };
+
+    std::shared_ptr<World> world;
+    const ReplayStatsEngine engine =
+        ReplayStatsEngine(ReplayStatsConfig(), {"PossessionStatsTracker"});
+};
+
+TEST_F(ReplayStatsEngineTest, processes_replay_of_worlds)
+{
+    std::string entries;
+    for (const auto& [timestamp_sec, robot_position] : possessing_robot_positions)
+    {
+        entries += ProtoLogger::createLogEntry(
+            TbotsProto::World::descriptor()->full_name(),
+            worldWithBallInFrontOf(robot_position, timestamp_sec).SerializeAsString(),
+            timestamp_sec);
+    }
+    writeChunk(entries);
+
+    expectPossessionChanges(engine.processReplay(replay_folder));
+}
+
+TEST_F(ReplayStatsEngineTest, processes_replay_of_world_deltas)
+{
+    WorldDeltaEncoder encoder(2);
+    std::string entries;
+    for (const auto& [timestamp_sec, robot_position] : possessing_robot_positions)
+    {
+        const TbotsProto::WorldDelta& world_delta =
+            encoder.encode(worldWithBallInFrontOf(robot_position, timestamp_sec));
+        entries += ProtoLogger::createLogEntry(
+            TbotsProto::WorldDelta::descriptor()->full_name(),
+            world_delta.SerializeAsString(), timestamp_sec);
+    }
+    writeChunk(entries);
+
+    expectPossessionChanges(engine.processReplay(replay_folder));
+}
+
+TEST_F(ReplayStatsEngineTest, skips_world_deltas_before_first_keyframe)
+{
+    WorldDeltaEncoder encoder(10);
+    std::string entries;
+    for (const auto& [timestamp_sec, robot_position] : possessing_robot_positions)
+    {
+        const TbotsProto::WorldDelta world_delta =
+            encoder.encode(worldWithBallInFrontOf(robot_position, timestamp_sec));
+
+        // Drop the keyframe, as if logging started after it was sent
+        if (!world_delta.has_keyframe())
+        {
+            entries += ProtoLogger::createLogEntry(
+                TbotsProto::WorldDelta::descriptor()->full_name(),
+                world_delta.SerializeAsString(), timestamp_sec);
+        }
+    }
+    writeChunk(entries);
+
+    EXPECT_EQ(engine.processReplay(replay_folder).at("PossessionStatsTracker").numRows(),
+              0);
+}
@@ -0,0 +1,87 @@
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <thread>
+
+#include "software/logger/logger.h"
+#include "software/stats/analytics/replay_stats_engine.h"
+
+/*
+ * This standalone program computes match statistics from a set of replay logs and
+ * writes one CSV table per stats tracker to the output folder
+ */
+int main(int argc, char** argv)
+{
+    struct CommandLineArgs
+    {
+        bool help                            = false;
+        std::vector<std::string> replay_dirs = {};
+        std::string output_dir               = "";
+        std::vector<std::string> trackers    = {};
+        unsigned int num_threads             = std::thread::hardware_concurrency();
+        bool list_trackers                   = false;
+    };
+
+    CommandLineArgs args;
+    boost::program_options::options_description desc{"Options"};
+
+    desc.add_options()("help,h", boost::program_options::bool_switch(&args.help),
+                       "Help screen");
+    desc.add_options()(
+        "replay_dirs",
+        boost::program_options::value<std::vector<std::string>>(&args.replay_dirs)
+            ->multitoken(),
+        "Space separated folders containing the replay chunks of each match");
+    desc.add_options()("output_dir",
+                       boost::program_options::value<std::string>(&args.output_dir),
+                       "Folder to write the CSV tables to");
+    desc.add_options()(
+        "trackers",
+        boost::program_options::value<std::vector<std::string>>(&args.trackers)
+            ->multitoken(),
+        "Space separated names of the trackers to run. If not specified, all trackers are run");
+    desc.add_options()("num_threads",
+                       boost::program_options::value<unsigned int>(&args.num_threads),
+                       "Number of replays to process at once");
+    desc.add_options()("list_trackers",
+                       boost::program_options::bool_switch(&args.list_trackers),
+                       "List the available trackers");
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (args.help)
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if (args.list_trackers)
+    {
+        for (const std::string& name : ReplayStatsTrackerFactory::getRegisteredNames())
+        {
+            std::cout << name << std::endl;
+        }
+        return 0;
+    }
+
+    if (args.replay_dirs.empty() || args.output_dir.empty())
+    {
+        std::cerr << "Both --replay_dirs and --output_dir must be specified" << std::endl;
+        std::cerr << desc << std::endl;
+        return 1;
+    }
+
+    LoggerSingleton::initializeLogger(args.output_dir, nullptr, false);
+
+    ReplayStatsEngine engine(ReplayStatsConfig(), args.trackers, args.num_threads);
+    const auto tables = engine.run(args.replay_dirs);
+    ReplayStatsEngine::writeTables(tables, args.output_dir);
+
+    for (const auto& [tracker_name, table] : tables)
+    {
+        LOG(INFO) << tracker_name << ": " << table.numRows() << " rows";
+    }
+
+    return 0;
+}
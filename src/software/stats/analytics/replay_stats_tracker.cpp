@@ -0,0 +1,32 @@
+#include "software/stats/analytics/replay_stats_tracker.h"
+
+ReplayStatsTracker::ReplayStatsTracker(const ReplayStatsConfig& config,
+                                       const std::vector<std::string>& column_names)
+    : config_(config), table_(column_names)
+{
+}
+
+void ReplayStatsTracker::onPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                                        double timestamp_sec)
+{
+}
+
+void ReplayStatsTracker::onReplayEnd() {}
+
+const StatsTable& ReplayStatsTracker::getTable() const
+{
+    return table_;
+}
+
+std::optional<Robot> findRobotInPossession(const Team& team, const Point& ball_position,
+                                           double possession_distance_m)
+{
+    for (const Robot& robot : team.getAllRobots())
+    {
+        if (robot.isNearDribbler(ball_position, possession_distance_m))
+        {
+            return robot;
+        }
+    }
+    return std::nullopt;
+}
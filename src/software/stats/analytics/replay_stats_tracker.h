@@ -0,0 +1,107 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "proto/tbots_software_msgs.pb.h"
+#include "software/constants.h"
+#include "software/stats/analytics/stats_table.h"
+#include "software/util/generic_factory/generic_factory.h"
+#include "software/world/world.h"
+
+/**
+ * Tunable thresholds shared by all replay stats trackers. The defaults match the
+ * thresholds used by the live trackers in software/stats/trackers.
+ */
+struct ReplayStatsConfig
+{
+    // A robot has possession of the ball if the ball is within this distance of its
+    // dribbler. Larger than the dribbling distance to make possession a bit stickier.
+    double possession_distance_m = BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING * 2;
+
+    // The minimum speed of the ball after leaving a robot for it to count as a kick
+    double min_kick_speed_m_per_s = 2.0;
+
+    // Kicks that have not been resolved (received, intercepted, scored...) after this
+    // long are considered failed
+    double max_kick_duration_sec = 4.0;
+};
+
+/**
+ * A ReplayStatsTracker computes statistics over a single match replay. The
+ * ReplayStatsEngine feeds every tracker the World and PrimitiveSet messages of a
+ * replay in chronological order, and collects the rows each tracker added to its
+ * table once the replay ends.
+ *
+ * Trackers register themselves with the ReplayStatsTrackerFactory (see the bottom of
+ * each tracker's .cpp file), so new trackers can be added without touching the
+ * engine.
+ */
+class ReplayStatsTracker
+{
+   public:
+    virtual ~ReplayStatsTracker() = default;
+
+    /**
+     * Called for every World in the replay, in chronological order
+     *
+     * @param world The world
+     * @param timestamp_sec The time the world was logged, relative to the start of the
+     * replay
+     */
+    virtual void onWorld(const World& world, double timestamp_sec) = 0;
+
+    /**
+     * Called for every PrimitiveSet in the replay, in chronological order
+     *
+     * @param primitive_set The primitives sent to the friendly robots
+     * @param timestamp_sec The time the primitives were logged, relative to the start
+     * of the replay
+     */
+    virtual void onPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                                double timestamp_sec);
+
+    /**
+     * Called once after the last message of the replay, so that trackers can close off
+     * any events that are still in progress
+     */
+    virtual void onReplayEnd();
+
+    /**
+     * Gets the statistics computed by this tracker
+     *
+     * @return the table of statistics
+     */
+    const StatsTable& getTable() const;
+
+   protected:
+    /**
+     * Creates a new tracker
+     *
+     * @param config The thresholds to use
+     * @param column_names The names of the columns of the tracker's table
+     */
+    explicit ReplayStatsTracker(const ReplayStatsConfig& config,
+                                const std::vector<std::string>& column_names);
+
+    const ReplayStatsConfig config_;
+    StatsTable table_;
+};
+
+/**
+ * Finds the robot of the given team that has possession of the ball, if any
+ *
+ * @param team The team to check
+ * @param ball_position The position of the ball
+ * @param possession_distance_m The maximum distance between the ball and a robot's
+ * dribbler for the robot to have possession
+ *
+ * @return the robot in possession of the ball, or std::nullopt if no robot of the
+ * team has possession
+ */
+std::optional<Robot> findRobotInPossession(const Team& team, const Point& ball_position,
+                                           double possession_distance_m);
+
+using ReplayStatsTrackerFactory =
+    GenericFactory<std::string, ReplayStatsTracker, ReplayStatsConfig>;
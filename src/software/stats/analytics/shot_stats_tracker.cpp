@@ -0,0 +1,78 @@
+#include "software/stats/analytics/shot_stats_tracker.h"
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+
+ShotStatsTracker::ShotStatsTracker(const ReplayStatsConfig& config)
+    : ReplayStatsTracker(config, {"kick_time_s", "shooter_id", "origin_x", "origin_y",
+                                  "distance_to_goal_m", "open_angle_deg",
+                                  "kick_speed_m_per_s", "end_time_s", "outcome"}),
+      kick_detector_(config),
+      shot_in_flight_(std::nullopt)
+{
+}
+
+void ShotStatsTracker::onWorld(const World& world, double timestamp_sec)
+{
+    const Field& field         = world.field();
+    const Point& ball_position = world.ball().position();
+
+    if (shot_in_flight_.has_value())
+    {
+        if (contains(field.enemyGoal(), ball_position))
+        {
+            endShot(timestamp_sec, "goal");
+        }
+        else if (findRobotInPossession(world.enemyTeam(), ball_position,
+                                       config_.possession_distance_m))
+        {
+            endShot(timestamp_sec, "blocked");
+        }
+        else if (!contains(field.fieldLines(), ball_position) ||
+                 timestamp_sec - shot_in_flight_->kick.kick_time_sec >
+                     config_.max_kick_duration_sec)
+        {
+            endShot(timestamp_sec, "missed");
+        }
+    }
+
+    std::optional<KickEvent> kick = kick_detector_.update(world, timestamp_sec);
+    if (kick.has_value() && isShotOnEnemyGoal(field, kick.value()))
+    {
+        // The world is from just after the kick, which is close enough to evaluate
+        // the quality of the shot since robots barely move in that time
+        std::optional<::Shot> best_shot =
+            calcBestShotOnGoal(field, world.friendlyTeam(), world.enemyTeam(),
+                               kick->kick_origin, TeamType::ENEMY, {kick->kicker});
+
+        shot_in_flight_ = Shot{
+            .kick               = kick.value(),
+            .distance_to_goal_m = distance(kick->kick_origin, field.enemyGoalCenter()),
+            .open_angle_deg =
+                best_shot.has_value() ? best_shot->getOpenAngle().toDegrees() : 0.0,
+        };
+    }
+}
+
+void ShotStatsTracker::endShot(double end_time_sec, const std::string& outcome)
+{
+    const Shot& shot = shot_in_flight_.value();
+    table_.appendRow({
+        shot.kick.kick_time_sec,
+        static_cast<double>(shot.kick.kicker.id()),
+        shot.kick.kick_origin.x(),
+        shot.kick.kick_origin.y(),
+        shot.distance_to_goal_m,
+        shot.open_angle_deg,
+        shot.kick.ball_velocity.length(),
+        end_time_sec,
+        outcome,
+    });
+    shot_in_flight_.reset();
+}
+
+// Register this tracker in the genericFactory
+static TGenericFactory<std::string, ReplayStatsTracker, ShotStatsTracker,
+                       ReplayStatsConfig>
+    factory;
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "software/stats/analytics/kick_detector.h"
+#include "software/stats/analytics/replay_stats_tracker.h"
+
+/**
+ * Records every friendly shot on the enemy goal, along with measures of how good the
+ * shot was when it was taken and what happened to it.
+ *
+ * Columns: kick_time_s, shooter_id, origin_x, origin_y, distance_to_goal_m,
+ * open_angle_deg, kick_speed_m_per_s, end_time_s, outcome
+ *
+ * open_angle_deg is the largest open angle on the enemy goal from the shot origin
+ * (see calcBestShotOnGoal), 0 if the goal was completely blocked. outcome is one of
+ * "goal", "blocked" (an enemy robot gained possession) or "missed".
+ */
+class ShotStatsTracker : public ReplayStatsTracker
+{
+   public:
+    /**
+     * Creates a new ShotStatsTracker
+     *
+     * @param config The possession and kick thresholds to use
+     */
+    explicit ShotStatsTracker(const ReplayStatsConfig& config);
+
+    void onWorld(const World& world, double timestamp_sec) override;
+
+   private:
+    /**
+     * Adds a row for the shot in flight and clears it
+     *
+     * @param end_time_sec The time the shot ended
+     * @param outcome What happened to the shot
+     */
+    void endShot(double end_time_sec, const std::string& outcome);
+
+    struct Shot
+    {
+        KickEvent kick;
+        double distance_to_goal_m;
+        double open_angle_deg;
+    };
+
+    KickDetector kick_detector_;
+    std::optional<Shot> shot_in_flight_;
+};
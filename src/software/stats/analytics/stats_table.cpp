@@ -0,0 +1,105 @@
+#include "software/stats/analytics/stats_table.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+StatsTable::StatsTable(const std::vector<std::string>& column_names)
+    : column_names_(column_names), columns_(column_names.size()), num_rows_(0)
+{
+}
+
+void StatsTable::appendRow(const std::vector<Value>& row)
+{
+    if (row.size() != columns_.size())
+    {
+        throw std::invalid_argument("StatsTable: Row has " + std::to_string(row.size()) +
+                                    " values but the table has " +
+                                    std::to_string(columns_.size()) + " columns");
+    }
+
+    for (std::size_t i = 0; i < row.size(); i++)
+    {
+        columns_[i].push_back(row[i]);
+    }
+    num_rows_++;
+}
+
+void StatsTable::appendTable(const StatsTable& other)
+{
+    if (other.column_names_ != column_names_)
+    {
+        throw std::invalid_argument(
+            "StatsTable: Cannot append a table with different columns");
+    }
+
+    for (std::size_t i = 0; i < columns_.size(); i++)
+    {
+        columns_[i].insert(columns_[i].end(), other.columns_[i].begin(),
+                           other.columns_[i].end());
+    }
+    num_rows_ += other.num_rows_;
+}
+
+void StatsTable::prependColumn(const std::string& column_name, const Value& value)
+{
+    column_names_.insert(column_names_.begin(), column_name);
+    columns_.insert(columns_.begin(), std::vector<Value>(num_rows_, value));
+}
+
+void StatsTable::writeCsv(const std::string& file_path) const
+{
+    std::ofstream csv_file(file_path);
+    if (!csv_file.is_open())
+    {
+        throw std::runtime_error("StatsTable: Failed to open " + file_path);
+    }
+
+    csv_file << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    for (std::size_t i = 0; i < column_names_.size(); i++)
+    {
+        csv_file << (i == 0 ? "" : ",") << column_names_[i];
+    }
+    csv_file << "\n";
+
+    for (std::size_t row = 0; row < num_rows_; row++)
+    {
+        for (std::size_t i = 0; i < columns_.size(); i++)
+        {
+            csv_file << (i == 0 ? "" : ",");
+            std::visit([&csv_file](const auto& value) { csv_file << value; },
+                       columns_[i][row]);
+        }
+        csv_file << "\n";
+    }
+
+    if (!csv_file)
+    {
+        throw std::runtime_error("StatsTable: Failed to write " + file_path);
+    }
+}
+
+const std::vector<StatsTable::Value>& StatsTable::getColumn(
+    const std::string& column_name) const
+{
+    auto column = std::find(column_names_.begin(), column_names_.end(), column_name);
+    if (column == column_names_.end())
+    {
+        throw std::invalid_argument("StatsTable: No column named " + column_name);
+    }
+    return columns_[static_cast<std::size_t>(
+        std::distance(column_names_.begin(), column))];
+}
+
+const std::vector<std::string>& StatsTable::getColumnNames() const
+{
+    return column_names_;
+}
+
+std::size_t StatsTable::numRows() const
+{
+    return num_rows_;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <variant>
+#include <vector>
+
+/**
+ * A column oriented table of statistics produced by a ReplayStatsTracker.
+ *
+ * Values are stored per column so that whole columns can be appended and written
+ * out without reshaping, and so tables from many matches can be concatenated cheaply.
+ */
+class StatsTable
+{
+   public:
+    // A single cell of the table
+    using Value = std::variant<double, std::string>;
+
+    /**
+     * Creates an empty table with the given columns
+     *
+     * @param column_names The names of the columns of the table
+     */
+    explicit StatsTable(const std::vector<std::string>& column_names);
+
+    StatsTable() = delete;
+
+    /**
+     * Appends a row to the table
+     *
+     * @param row The values of the row, one per column in column order
+     *
+     * @throws std::invalid_argument if the row does not have one value per column
+     */
+    void appendRow(const std::vector<Value>& row);
+
+    /**
+     * Appends all rows of another table to this table
+     *
+     * @param other The table to append, must have the same columns as this table
+     *
+     * @throws std::invalid_argument if the columns of the tables differ
+     */
+    void appendTable(const StatsTable& other);
+
+    /**
+     * Adds a column before all other columns, filled with the given value
+     *
+     * @param column_name The name of the new column
+     * @param value The value of the new column in every row
+     */
+    void prependColumn(const std::string& column_name, const Value& value);
+
+    /**
+     * Writes the table as a CSV file with a header row
+     *
+     * @param file_path The path of the CSV file to write
+     *
+     * @throws std::runtime_error if the file could not be written
+     */
+    void writeCsv(const std::string& file_path) const;
+
+    /**
+     * Gets the values of a column
+     *
+     * @param column_name The name of the column
+     *
+     * @throws std::invalid_argument if there is no column with the given name
+     *
+     * @return the values of the column, in row order
+     */
+    const std::vector<Value>& getColumn(const std::string& column_name) const;
+
+    const std::vector<std::string>& getColumnNames() const;
+    std::size_t numRows() const;
+
+   private:
+    std::vector<std::string> column_names_;
+    std::vector<std::vector<Value>> columns_;
+    std::size_t num_rows_;
+};
@@ -0,0 +1,73 @@
+#include "software/stats/analytics/stats_table.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "software/logger/compat_flags.h"
+
+TEST(StatsTableTest, append_row_with_wrong_number_of_values_throws)
+{
+    StatsTable table({"a", "b"});
+    EXPECT_THROW(table.appendRow({1.0}), std::invalid_argument);
+    EXPECT_EQ(table.numRows(), 0);
+}
+
+TEST(StatsTableTest, append_rows_stores_values_by_column)
+{
+    StatsTable table({"name", "value"});
+    table.appendRow({std::string("foo"), 1.0});
+    table.appendRow({std::string("bar"), 2.5});
+
+    ASSERT_EQ(table.numRows(), 2);
+    EXPECT_EQ(table.getColumn("name"),
+              std::vector<StatsTable::Value>({std::string("foo"), std::string("bar")}));
+    EXPECT_EQ(table.getColumn("value"), std::vector<StatsTable::Value>({1.0, 2.5}));
+    EXPECT_THROW(table.getColumn("missing"), std::invalid_argument);
+}
+
+TEST(StatsTableTest, prepend_column_fills_existing_rows)
+{
+    StatsTable table({"value"});
+    table.appendRow({1.0});
+    table.appendRow({2.0});
+    table.prependColumn("match", std::string("match_1"));
+
+    EXPECT_EQ(table.getColumnNames(), std::vector<std::string>({"match", "value"}));
+    EXPECT_EQ(table.getColumn("match"),
+              std::vector<StatsTable::Value>(2, std::string("match_1")));
+}
+
+TEST(StatsTableTest, append_table_concatenates_rows)
+{
+    StatsTable table({"value"});
+    table.appendRow({1.0});
+
+    StatsTable other({"value"});
+    other.appendRow({2.0});
+    other.appendRow({3.0});
+
+    table.appendTable(other);
+    EXPECT_EQ(table.getColumn("value"), std::vector<StatsTable::Value>({1.0, 2.0, 3.0}));
+
+    EXPECT_THROW(table.appendTable(StatsTable({"other"})), std::invalid_argument);
+}
+
+TEST(StatsTableTest, write_csv)
+{
+    StatsTable table({"name", "value"});
+    table.appendRow({std::string("foo"), 1.5});
+    table.appendRow({std::string("bar"), -2.0});
+
+    const std::string csv_path =
+        (fs::temp_directory_path() / "stats_table_test.csv").string();
+    table.writeCsv(csv_path);
+
+    std::ifstream csv_file(csv_path);
+    std::stringstream csv_contents;
+    csv_contents << csv_file.rdbuf();
+    EXPECT_EQ(csv_contents.str(), "name,value\nfoo,1.5\nbar,-2\n");
+
+    fs::remove(csv_path);
+}
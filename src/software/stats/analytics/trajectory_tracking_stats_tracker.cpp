@@ -0,0 +1,92 @@
+#include "software/stats/analytics/trajectory_tracking_stats_tracker.h"
+
+#include <cmath>
+
+#include "proto/message_translation/tbots_geometry.h"
+#include "proto/message_translation/tbots_protobuf.h"
+#include "software/geom/algorithms/distance.h"
+
+TrajectoryTrackingStatsTracker::TrajectoryTrackingStatsTracker(
+    const ReplayStatsConfig& config)
+    : ReplayStatsTracker(config, {"robot_id", "num_samples", "mean_error_m",
+                                  "rms_error_m", "max_error_m"}),
+      robot_constants_(robot_constants::createRobotConstants())
+{
+}
+
+void TrajectoryTrackingStatsTracker::onWorld(const World& world, double timestamp_sec)
+{
+    for (const Robot& robot : world.friendlyTeam().getAllRobots())
+    {
+        auto active_trajectory = active_trajectories_.find(robot.id());
+        if (active_trajectory == active_trajectories_.end())
+        {
+            continue;
+        }
+
+        const double time_since_start_sec =
+            timestamp_sec - active_trajectory->second.start_time_sec;
+        if (time_since_start_sec < 0.0)
+        {
+            continue;
+        }
+
+        const double error_m = distance(
+            robot.position(),
+            active_trajectory->second.trajectory.getPosition(time_since_start_sec));
+
+        TrackingError& tracking_error = tracking_errors_[robot.id()];
+        tracking_error.num_samples++;
+        tracking_error.sum_error_m += error_m;
+        tracking_error.sum_squared_error_m_2 += error_m * error_m;
+        tracking_error.max_error_m = std::max(tracking_error.max_error_m, error_m);
+    }
+}
+
+void TrajectoryTrackingStatsTracker::onPrimitiveSet(
+    const TbotsProto::PrimitiveSet& primitive_set, double timestamp_sec)
+{
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        if (!primitive.has_move())
+        {
+            // The robot is no longer following a trajectory
+            active_trajectories_.erase(robot_id);
+            continue;
+        }
+
+        const TbotsProto::TrajectoryPathParams2D& params =
+            primitive.move().xy_traj_params();
+        std::optional<TrajectoryPath> trajectory = createTrajectoryPathFromParams(
+            params, createVector(params.initial_velocity()), robot_constants_);
+        if (!trajectory.has_value())
+        {
+            active_trajectories_.erase(robot_id);
+            continue;
+        }
+
+        active_trajectories_.insert_or_assign(
+            robot_id, ActiveTrajectory{trajectory.value(), timestamp_sec});
+    }
+}
+
+void TrajectoryTrackingStatsTracker::onReplayEnd()
+{
+    for (const auto& [robot_id, tracking_error] : tracking_errors_)
+    {
+        const double num_samples = static_cast<double>(tracking_error.num_samples);
+        table_.appendRow({
+            static_cast<double>(robot_id),
+            num_samples,
+            tracking_error.sum_error_m / num_samples,
+            std::sqrt(tracking_error.sum_squared_error_m_2 / num_samples),
+            tracking_error.max_error_m,
+        });
+    }
+    tracking_errors_.clear();
+}
+
+// Register this tracker in the genericFactory
+static TGenericFactory<std::string, ReplayStatsTracker, TrajectoryTrackingStatsTracker,
+                       ReplayStatsConfig>
+    factory;
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+
+#include "shared/robot_constants.h"
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/stats/analytics/replay_stats_tracker.h"
+
+/**
+ * Measures how closely friendly robots follow the trajectories planned for them.
+ *
+ * Columns: robot_id, num_samples, mean_error_m, rms_error_m, max_error_m
+ *
+ * Each MovePrimitive sent to a robot carries the parameters of its trajectory, which
+ * is rebuilt here exactly as the robot's PrimitiveExecutor does. For every World until
+ * the next primitive, the tracking error is the distance between the robot's observed
+ * position and the position the trajectory expected it to be at. One row is added per
+ * robot when the replay ends.
+ */
+class TrajectoryTrackingStatsTracker : public ReplayStatsTracker
+{
+   public:
+    /**
+     * Creates a new TrajectoryTrackingStatsTracker
+     *
+     * @param config The stats config
+     */
+    explicit TrajectoryTrackingStatsTracker(const ReplayStatsConfig& config);
+
+    void onWorld(const World& world, double timestamp_sec) override;
+    void onPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                        double timestamp_sec) override;
+    void onReplayEnd() override;
+
+   private:
+    struct ActiveTrajectory
+    {
+        TrajectoryPath trajectory;
+        double start_time_sec;
+    };
+
+    struct TrackingError
+    {
+        std::size_t num_samples      = 0;
+        double sum_error_m           = 0.0;
+        double sum_squared_error_m_2 = 0.0;
+        double max_error_m           = 0.0;
+    };
+
+    const robot_constants::RobotConstants robot_constants_;
+    std::map<RobotId, ActiveTrajectory> active_trajectories_;
+    std::map<RobotId, TrackingError> tracking_errors_;
+};
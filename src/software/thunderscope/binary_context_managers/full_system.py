@@ -7,6 +7,7 @@ import threading
 import time
 from subprocess import Popen, TimeoutExpired
 import re
+from typing import Collection
 
 from software.py_constants import *
 from software.python_bindings import *
@@ -32,6 +33,7 @@ class FullSystem:
         run_sudo: bool = False,
         running_in_realtime: bool = True,
         log_level: LogLevels = LogLevels.DEBUG,
+        shared_memory_channels: Collection[str] = (),
     ) -> None:
         """Run FullSystem
 
@@ -43,6 +45,7 @@ class FullSystem:
         :param run_sudo: true if we should run full system under sudo
         :param running_in_realtime: True if we are running fullsystem in realtime, else False
         :param log_level: Minimum g3log level that will be printed (DEBUG|INFO|WARNING|FATAL)
+        :param shared_memory_channels: The unix paths to communicate over shared memory instead of unix sockets
         """
         self.path_to_binary = path_to_binary
         self.full_system_runtime_dir = full_system_runtime_dir
@@ -60,6 +63,7 @@ class FullSystem:
         self.should_run_under_sudo = run_sudo
         self.running_in_realtime = running_in_realtime
         self.log_level = log_level
+        self.shared_memory_channels = set(shared_memory_channels)
         self.thread = threading.Thread(target=self.__restart__, daemon=True)
 
     def discover_supported_flags(self, path_to_binary: str) -> set[str]:
@@ -106,6 +110,20 @@ class FullSystem:
             cmd_parts.append("--ci")
         if "log_level" in supported_flags:
             cmd_parts.append("--log_level={}".format(self.log_level.value))
+        if self.shared_memory_channels:
+            if "shared_memory_channels" in supported_flags:
+                cmd_parts.append(
+                    "--shared_memory_channels={}".format(
+                        ",".join(sorted(self.shared_memory_channels))
+                    )
+                )
+            else:
+                logging.warning(
+                    "'{}' does not support shared memory, using unix sockets".format(
+                        self.path_to_binary
+                    )
+                )
+                self.shared_memory_channels = set()
 
         # Log supported flags info based on importance level
         if supported_flags:
@@ -207,6 +225,10 @@ gdb --args bazel-bin/{self.full_system}
             except TimeoutExpired:
                 self.full_system_proc.kill()
 
+        unlink_shared_memory_rings(
+            self.full_system_runtime_dir, self.shared_memory_channels
+        )
+
     def setup_proto_unix_io(self, proto_unix_io: ProtoUnixIO) -> None:
         """Helper to run full system and attach the appropriate unix senders/listeners
 
@@ -229,18 +251,28 @@ gdb --args bazel-bin/{self.full_system}
                 runtime_dir=self.full_system_runtime_dir,
                 proto_class=proto_class,
                 from_log_visualize=True,
+                shared_memory_channels=self.shared_memory_channels,
             )
 
         proto_unix_io.attach_unix_receiver(
-            self.full_system_runtime_dir, "/log", RobotLog
+            self.full_system_runtime_dir,
+            "/log",
+            RobotLog,
+            shared_memory_channels=self.shared_memory_channels,
         )
 
         # Outputs from full_system
         proto_unix_io.attach_unix_receiver(
-            self.full_system_runtime_dir, WORLD_PATH, World
+            self.full_system_runtime_dir,
+            WORLD_PATH,
+            WorldDelta,
+            shared_memory_channels=self.shared_memory_channels,
         )
         proto_unix_io.attach_unix_receiver(
-            self.full_system_runtime_dir, PRIMITIVE_PATH, PrimitiveSet
+            self.full_system_runtime_dir,
+            PRIMITIVE_PATH,
+            PrimitiveSet,
+            shared_memory_channels=self.shared_memory_channels,
         )
 
         # Inputs to full_system
@@ -258,4 +290,8 @@ gdb --args bazel-bin/{self.full_system}
             (VIRTUAL_OBSTACLES_UNIX_PATH, VirtualObstacles),
             (REPLAY_BOOKMARK_PATH, ReplayBookmark),
         ]:
-            proto_unix_io.attach_unix_sender(self.full_system_runtime_dir, *arg)
+            proto_unix_io.attach_unix_sender(
+                self.full_system_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
+            )
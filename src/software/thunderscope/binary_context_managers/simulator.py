@@ -5,6 +5,7 @@ import logging
 import time
 
 from subprocess import Popen
+from typing import Collection
 from software.python_bindings import *
 from proto.import_all_protos import *
 from software.py_constants import *
@@ -21,6 +22,7 @@ class Simulator:
         simulator_runtime_dir: os.PathLike = None,
         debug_simulator: bool = False,
         enable_realism: bool = False,
+        shared_memory_channels: Collection[str] = (),
     ) -> None:
         """Run Simulator
 
@@ -30,6 +32,7 @@ class Simulator:
         :param simulator_runtime_dir: The directory to run the simulator in
         :param debug_simulator: Whether to run the simulator in debug mode
         :param enable_realism: a argument (--enable_realism) that is going to be passed to er_force_simulator_main binary
+        :param shared_memory_channels: The unix paths to communicate over shared memory instead of unix sockets
         """
         self.simulator_runtime_dir = simulator_runtime_dir
         self.generic_command = [
@@ -42,6 +45,7 @@ class Simulator:
         self.debug_simulator = debug_simulator
         self.er_force_simulator_proc = None
         self.enable_realism = enable_realism
+        self.shared_memory_channels = set(shared_memory_channels)
 
     def __enter__(self) -> Simulator:
         """Enter the simulator context manager.
@@ -64,6 +68,11 @@ class Simulator:
         if self.enable_realism:
             simulator_command += " --enable_realism"
 
+        if self.shared_memory_channels:
+            simulator_command += " --shared_memory_channels={}".format(
+                ",".join(sorted(self.shared_memory_channels))
+            )
+
         if self.debug_simulator:
             # We don't want to check the exact command because this binary could
             # be debugged from clion or somewhere other than gdb
@@ -107,6 +116,10 @@ gdb --args bazel-bin/{simulator_command}
             self.er_force_simulator_proc.kill()
             self.er_force_simulator_proc.wait()
 
+        unlink_shared_memory_rings(
+            self.simulator_runtime_dir, self.shared_memory_channels
+        )
+
     def setup_proto_unix_io(
         self,
         simulator_proto_unix_io: ProtoUnixIO,
@@ -126,12 +139,17 @@ gdb --args bazel-bin/{simulator_command}
             (SIMULATION_TICK_PATH, SimulatorTick),
             (WORLD_STATE_PATH, WorldState),
         ]:
-            simulator_proto_unix_io.attach_unix_sender(self.simulator_runtime_dir, *arg)
+            simulator_proto_unix_io.attach_unix_sender(
+                self.simulator_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
+            )
 
         simulator_proto_unix_io.attach_unix_receiver(
             self.simulator_runtime_dir,
             WORLD_STATE_RECEIVED_TRIGGER_PATH,
             WorldStateReceivedTrigger,
+            shared_memory_channels=self.shared_memory_channels,
         )
 
         # setup blue full system unix io
@@ -140,7 +158,9 @@ gdb --args bazel-bin/{simulator_command}
             (BLUE_PRIMITIVE_SET, PrimitiveSet),
         ]:
             blue_full_system_proto_unix_io.attach_unix_sender(
-                self.simulator_runtime_dir, *arg
+                self.simulator_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
             )
 
         for arg in [
@@ -149,7 +169,9 @@ gdb --args bazel-bin/{simulator_command}
             (SIMULATOR_STATE_PATH, SimulatorState),
         ]:
             blue_full_system_proto_unix_io.attach_unix_receiver(
-                self.simulator_runtime_dir, *arg
+                self.simulator_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
             )
 
         # setup yellow full system unix io
@@ -158,7 +180,9 @@ gdb --args bazel-bin/{simulator_command}
             (YELLOW_PRIMITIVE_SET, PrimitiveSet),
         ]:
             yellow_full_system_proto_unix_io.attach_unix_sender(
-                self.simulator_runtime_dir, *arg
+                self.simulator_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
             )
 
         for arg in [
@@ -167,9 +191,14 @@ gdb --args bazel-bin/{simulator_command}
             (SIMULATOR_STATE_PATH, SimulatorState),
         ]:
             yellow_full_system_proto_unix_io.attach_unix_receiver(
-                self.simulator_runtime_dir, *arg
+                self.simulator_runtime_dir,
+                *arg,
+                shared_memory_channels=self.shared_memory_channels,
             )
 
         autoref_proto_unix_io.attach_unix_receiver(
-            self.simulator_runtime_dir, SSL_WRAPPER_PATH, SSL_WrapperPacket
+            self.simulator_runtime_dir,
+            SSL_WRAPPER_PATH,
+            SSL_WrapperPacket,
+            shared_memory_channels=self.shared_memory_channels,
         )
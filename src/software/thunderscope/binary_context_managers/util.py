@@ -1,6 +1,8 @@
 import logging
+import os
 import psutil
 from collections.abc import Iterator
+from typing import Collection
 from software.python_bindings import *
 from proto.import_all_protos import *
 from software.py_constants import *
@@ -51,3 +53,17 @@ def kill_cmd_if_running(command: list[str]) -> None:
             proc.wait(timeout=3)
         except (psutil.NoSuchProcess, psutil.TimeoutExpired):
             pass
+
+
+def unlink_shared_memory_rings(
+    runtime_dir: os.PathLike, shared_memory_channels: Collection[str]
+) -> None:
+    """Remove the shared memory rings of the given channels once every process using
+    them has stopped, so that they don't stay in /dev/shm. A binary that crashes
+    doesn't get here, so its rings are reused when it is restarted.
+
+    :param runtime_dir: The runtime directory of the channels
+    :param shared_memory_channels: The unix paths of the channels that use shared memory
+    """
+    for channel in shared_memory_channels:
+        SharedMemoryRingWriter.unlink(str(runtime_dir) + channel)
@@ -1,12 +1,18 @@
+from __future__ import annotations
+
 from threading import Thread
 import queue
 
 import os
 
+from proto.message_translation.world_delta import WorldDeltaDecoder
+from proto.world_pb2 import World, WorldDelta
+from software.networking.shm.threaded_shm_listener import ThreadedShmListener
+from software.networking.shm.threaded_shm_sender import ThreadedShmSender
 from software.networking.unix.threaded_unix_listener import ThreadedUnixListener
 from software.networking.unix.threaded_unix_sender import ThreadedUnixSender
 from software.thunderscope.thread_safe_buffer import ThreadSafeBuffer
-from typing import Type
+from typing import Collection, Type
 from google.protobuf.message import Message
 
 
@@ -47,6 +53,16 @@ class ProtoUnixIO:
     - attach_unix_sender() configures a unix sender (it is an observer as well)
       and relays data from send_proto over the socket.
 
+    - Channels listed in shared_memory_channels are sent/received over a
+      shared memory ring instead of a unix socket, and must be listed in the
+      --shared_memory_channels flag of the binary on the other end as well.
+
+    Delta encoded protobufs:
+
+    - WorldDeltas (from a unix receiver or a replay) are decoded back into
+      complete Worlds before they are given to observers, so observers only
+      ever register for and receive World.
+
     TL;DR This class manages inter-thread communication through register_observer
     and send_proto calls. If unix senders/receivers are attached to a proto type,
     then the data is also sent/received over the sockets.
@@ -60,6 +76,18 @@ class ProtoUnixIO:
         self.unix_listeners = {}
         self.send_proto_to_observer_threads = {}
         self.running = True
+        self.world_delta_decoder = WorldDeltaDecoder()
+
+    def __decode(self, proto: Message) -> Message | None:
+        """Decodes a delta encoded protobuf into the complete protobuf
+
+        :param proto: The protobuf to decode
+        :return: The decoded protobuf, the protobuf itself if it isn't delta
+                 encoded, or None if it can't be decoded until a keyframe arrives
+        """
+        if isinstance(proto, WorldDelta):
+            return self.world_delta_decoder.decode(proto)
+        return proto
 
     def __send_proto_to_observers(self, receive_buffer: ThreadSafeBuffer) -> None:
         """Given a ThreadSafeBuffer (receive_buffer) consume it and
@@ -68,7 +96,9 @@ class ProtoUnixIO:
         :param receive_buffer: The queue to consume from
         """
         while self.running:
-            proto = receive_buffer.get()
+            proto = self.__decode(receive_buffer.get())
+            if proto is None:
+                continue
 
             if proto.DESCRIPTOR.full_name in self.proto_observers:
                 for buffer in self.proto_observers[proto.DESCRIPTOR.full_name]:
@@ -118,6 +148,12 @@ class ProtoUnixIO:
                       to put the proto. Otherwise, proto will be dropped if queue is full.
         :param timeout: If block is True, then wait for this many seconds
         """
+        if proto_class is WorldDelta:
+            data = self.__decode(data)
+            if data is None:
+                return
+            proto_class = World
+
         if proto_class.DESCRIPTOR.full_name in self.proto_observers:
             for buffer in self.proto_observers[proto_class.DESCRIPTOR.full_name]:
                 buffer.put(data, block, timeout)
@@ -132,6 +168,7 @@ class ProtoUnixIO:
         runtime_dir: os.PathLike,
         unix_path: os.PathLike,
         proto_class: Type[Message],
+        shared_memory_channels: Collection[str] = (),
     ) -> None:
         """Creates a unix sender and registers an observer
         of the proto_class to send the data over the unix_path socket.
@@ -139,10 +176,16 @@ class ProtoUnixIO:
         :param runtime_dir: The runtime_dir where all protos will be sent to
         :param unix_path: The unix socket path within the runtime_dir to open
         :param proto_class: The protobuf type to send
+        :param shared_memory_channels: The unix paths to send over shared memory
         """
-        sender = ThreadedUnixSender(
-            unix_path=runtime_dir + unix_path, proto_type=proto_class
-        )
+        if unix_path in shared_memory_channels:
+            sender = ThreadedShmSender(
+                channel_path=runtime_dir + unix_path, proto_type=proto_class
+            )
+        else:
+            sender = ThreadedUnixSender(
+                unix_path=runtime_dir + unix_path, proto_type=proto_class
+            )
         self.unix_senders[proto_class.DESCRIPTOR.full_name] = sender
         self.register_observer(proto_class, sender.proto_buffer)
 
@@ -152,6 +195,7 @@ class ProtoUnixIO:
         unix_path: os.PathLike = "",
         proto_class: Type[Message] = None,
         from_log_visualize: bool = False,
+        shared_memory_channels: Collection[str] = (),
     ) -> None:
         """Creates a unix listener of that protobuf type and provides
         incoming data to registered observers.
@@ -160,15 +204,19 @@ class ProtoUnixIO:
         :param unix_path: The unix path within the runtime_dir to send data over
         :param proto_class: The prototype to send
         :param from_log_visualize: If the protobuf is coming from LOG(VISUALIZE)
+        :param shared_memory_channels: The unix paths to receive over shared memory
         """
-        listener = ThreadedUnixListener(
-            (
-                runtime_dir + f"/{proto_class.DESCRIPTOR.full_name}"
-                if from_log_visualize and not unix_path
-                else runtime_dir + unix_path
-            ),
-            proto_class=proto_class,
-        )
+        if from_log_visualize and not unix_path:
+            unix_path = f"/{proto_class.DESCRIPTOR.full_name}"
+
+        if unix_path in shared_memory_channels:
+            listener = ThreadedShmListener(
+                runtime_dir + unix_path, proto_class=proto_class
+            )
+        else:
+            listener = ThreadedUnixListener(
+                runtime_dir + unix_path, proto_class=proto_class
+            )
         key = proto_class.DESCRIPTOR.full_name
         self.unix_listeners[key] = listener
         self.send_proto_to_observer_threads[key] = Thread(
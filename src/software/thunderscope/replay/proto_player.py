@@ -13,8 +13,7 @@ from software.thunderscope.constants import ProtoPlayerFlags
 from software.thunderscope.proto_unix_io import ProtoUnixIO
 import software.python_bindings as tbots_cpp
 from google.protobuf.message import Message
-from typing import Callable, Type, List
-import pickle
+from typing import Callable, Type
 
 
 class ProtoPlayer:
@@ -41,13 +40,15 @@ class ProtoPlayer:
     speed. If the seek function is called with a specific time, the player will
     update the 3 variables (shown above) to point to the chunk and entry (in the
     chunk) that contains the data at that time and continue playing from there.
+
+    Reading the log is handled by the C++ ProtoReplayReader, which maintains a
+    persistent time index of the chunks and bookmarks in the log folder, and
+    decompresses and deserializes chunks on a background thread pool (reading
+    ahead of the current chunk). Chunks are therefore handed to the player as
+    already-parsed (timestamp, protobuf type name, protobuf) entries.
     """
 
     PLAY_PAUSE_POLL_INTERVAL_SECONDS = 0.1
-    CHUNK_INDEX_FILENAME = "chunks.index"
-    BOOKMARK_INDEX_FILENAME = "bookmarks.index"
-    CHUNK_INDEX_FILE_VERSION = 1
-    BOOKMARK_INDEX_FILE_VERSION = 1
 
     def __init__(
         self, log_folder_path: os.PathLike, proto_unix_io: ProtoUnixIO
@@ -77,13 +78,19 @@ class ProtoPlayer:
         self.current_chunk_index = 0
         self.current_entry_index = 0
 
-        self.sorted_chunks = self.sort_and_get_replay_files(self.log_folder_path)
+        # Make sure there are replay files before handing the folder off to the reader
+        self.sort_and_get_replay_files(self.log_folder_path)
 
-        self.version = ProtoPlayer.get_replay_chunk_format_version(
-            self.sorted_chunks[0]
-        )
+        # Loads the time index of the log, building it first if needed
+        self.replay_reader = tbots_cpp.ProtoReplayReader(str(self.log_folder_path))
+        self.version = self.replay_reader.getReplayFileVersion()
+
+        # Only chunks with valid entries are indexed by the reader
+        self.sorted_chunks = [
+            os.path.join(self.log_folder_path, chunk.chunk_file_name)
+            for chunk in self.replay_reader.getChunkIndex()
+        ]
 
-        # build or load index for chunks
         self.bookmark_indices = list()
         self.chunks_indices = dict()
         self.load_or_build_index()
@@ -142,168 +149,32 @@ class ProtoPlayer:
         except Exception:
             return True
 
-    def handle_log_line_for_chunk(self, **kwargs) -> None:
-        """Find the time stamp of the first proto event in the replay file.
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
-        """
-        if kwargs["line_no"] == 0:
-            self.chunks_indices[os.path.basename(kwargs["chunk_name"])] = kwargs[
-                "timestamp"
-            ]
-
-    def handle_log_line_for_bookmark(self, **kwargs) -> None:
-        """Filter out bookmark protos in the replay log
-        :param kwargs: a dictionary contains all the information about a line in the replay log.
-            e.g. {
-                "protobuf_type": type of proto
-                "timestamp": timestamp when the proto is logged
-                "data": data of the proto message
-                "line_no": line number
-                "chunk_name": file name of the chunk
-            }
-        """
-        if kwargs["protobuf_type"] == ReplayBookmark:
-            self.bookmark_indices.append(kwargs["timestamp"])
-
-    def finish_preprocess_replay_file(self) -> None:
-        """Finish off pre-processing and save all the pre-processing result to disk"""
-        # save chunk indices
-        if self.chunks_indices:
-            try:
-                with open(
-                    os.path.join(
-                        self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME
-                    ),
-                    "w",
-                ) as index_file:
-                    index_file.write(
-                        f"Version: {ProtoPlayer.CHUNK_INDEX_FILE_VERSION}, "
-                        f"Generated on {time.time():.0f}\n"
-                    )
-                    for filename, start_timestamp in self.chunks_indices.items():
-                        index_file.write(f"{start_timestamp}, {filename}\n")
-                logging.info("Created chunk index file successfully.")
-            except Exception as e:
-                logging.warning(
-                    f"Failed to build chunk index for {self.log_folder_path}: {e}"
-                )
-        else:
-            logging.warning(
-                f"Failed to build chunk index for {self.log_folder_path} : No chunk data."
-            )
-
-        # save bookmark indices
-        if self.bookmark_indices:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME),
-                "wb",
-            ) as bookmark_file:
-                pickle.dump(self.bookmark_indices, bookmark_file)
-                logging.info("Created bookmark index file successfully.")
-        else:
-            logging.warning(
-                f"Failed to build bookmark index for {self.log_folder_path} : No bookmark data found."
-            )
+    def load_chunk_index(self) -> None:
+        """Loads the start timestamp of every chunk from the replay time index"""
+        self.chunks_indices = {
+            chunk.chunk_file_name: chunk.start_time_sec
+            for chunk in self.replay_reader.getChunkIndex()
+        }
 
-    def preprocess_replay_file(self, handlers: List[Callable[[...], None]]) -> None:
-        """Start preprocessing replay files and build index according to the provided handlers
+    def load_bookmark_index(self) -> None:
+        """Loads the bookmark timestamps from the replay time index"""
+        self.bookmark_indices = list(self.replay_reader.getBookmarkTimestamps())
 
-        :param handlers: handler functions that will be applied to each line of the replay log.
-                This function will be provided following parameters
-                 (self: ProtoPlayer, line_no: int, chunk_name:str, timestamp: float,
-                    protobuf_type: Type[Message], data: Message).
+    def load_or_build_index(self) -> None:
+        """Load bookmark index and chunk index. The replay reader builds the index on
+        disk when it is first opened, so both are always available here.
         """
-        for chunk_name in self.sorted_chunks:
-            chunk_data = ProtoPlayer.load_replay_chunk(chunk_name, self.version)
-            if chunk_data:
-                start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
-                    chunk_data[0], self.version
-                )
-                for line_no, data in enumerate(chunk_data):
-                    timestamp, protobuf_type, data = ProtoPlayer.unpack_log_entry(
-                        data, self.version
-                    )
-                    for handler in handlers:
-                        handler(
-                            line_no=line_no,
-                            chunk_name=chunk_name,
-                            timestamp=timestamp,
-                            protobuf_type=protobuf_type,
-                            data=data,
-                        )
-        self.finish_preprocess_replay_file()
+        self.load_chunk_index()
+        self.load_bookmark_index()
 
-    def is_chunk_indexed(self) -> bool:
-        """Returns true if the chunk index is already built.
+    def load_chunk(self, chunk_index: int) -> list:
+        """Gets the entries of a chunk from the replay reader. The chunk is usually
+        already decoded in the background by the time it is requested.
 
-        :return: if the chunk index file exists
+        :param chunk_index: The index of the chunk in self.sorted_chunks
+        :return: The chunk, as a list of (timestamp, protobuf type name, protobuf)
         """
-        return os.path.exists(
-            os.path.join(self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME)
-        )
-
-    def is_bookmark_indexed(self) -> bool:
-        """Returns true if the bookmark index is already built.
-        :return: if the bookmark index exists
-        """
-        return os.path.exists(
-            os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME)
-        )
-
-    def load_chunk_index(self) -> None:
-        """Loads the chunk index file."""
-        try:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.CHUNK_INDEX_FILENAME),
-                "r",
-            ) as index_file:
-                # skip the first timestamp line
-                index_file.readline()
-
-                for line in index_file:
-                    start_timestamp, chunk_name = line.split(",")
-                    start_timestamp = float(start_timestamp)
-                    chunk_name = chunk_name.strip()
-                    self.chunks_indices[chunk_name] = start_timestamp
-            logging.info("Pre-existing chunk index file found and loaded.")
-        except Exception as e:
-            logging.warning(f"An Exception occurred when loading chunk index file {e}")
-
-    def load_bookmark_index(self) -> None:
-        """Loads the bookmark file"""
-        try:
-            with open(
-                os.path.join(self.log_folder_path, ProtoPlayer.BOOKMARK_INDEX_FILENAME),
-                "rb",
-            ) as bookmark_file:
-                self.bookmark_indices = pickle.load(bookmark_file)
-                logging.info("Pre-existing chunk bookmark file found and loaded.")
-        except Exception as e:
-            logging.warning(f"An Exception occurred when loading bookmark file {e}")
-
-    def load_or_build_index(self):
-        """Load bookmark index and chunk index. If none is found, build first then load."""
-        # handler_list contains all the tasks to do when pre-processing the log data
-        handler_list = list()
-        if not self.is_chunk_indexed():
-            handler_list.append(self.handle_log_line_for_chunk)
-        else:
-            self.load_chunk_index()
-
-        if not self.is_bookmark_indexed():
-            handler_list.append(self.handle_log_line_for_bookmark)
-        else:
-            self.load_bookmark_index()
-
-        if handler_list:
-            self.preprocess_replay_file(handler_list)
+        return self.replay_reader.getChunkEntries(chunk_index)
 
     def is_proto_player_playing(self) -> bool:
         """Return whether or not the proto player is being played.
@@ -315,27 +186,12 @@ class ProtoPlayer:
     def find_actual_endtime(self) -> float:
         """Finding the last end time.
         Note that the end time may not necessarily be the last message in the last chunks since there may be
-        file corruptions. We also assume a chronological order in the chunks data!
+        file corruptions. The replay time index only records valid entries, and we assume a chronological
+        order in the chunks data!
 
         :return: the last end time, if no end time are found, return 0.0s
         """
-        # reverse iterating over the chunks (file)
-        for i in reversed(range(len(self.sorted_chunks))):
-            last_chunk_data = ProtoPlayer.load_replay_chunk(
-                self.sorted_chunks[i], self.version
-            )
-
-            # reverse iterating the protobufs message in each and every file
-            for j in reversed(range(len(last_chunk_data))):
-                try:
-                    end_time, _, _ = ProtoPlayer.unpack_log_entry(
-                        last_chunk_data[j], self.version
-                    )
-                    return end_time
-                except Exception:
-                    pass
-
-        return 0.0
+        return self.replay_reader.getEndTime()
 
     @staticmethod
     def load_replay_chunk(replay_chunk_path: os.PathLike, version: int) -> list:
@@ -491,9 +347,7 @@ class ProtoPlayer:
                         self.current_packet_time,
                         _,
                         proto,
-                    ) = ProtoPlayer.unpack_log_entry(
-                        self.current_chunk[self.current_entry_index], self.version
-                    )
+                    ) = self.current_chunk[self.current_entry_index]
 
                     log_entry = tbots_cpp.ProtoLogger.createLogEntry(
                         proto.DESCRIPTOR.full_name,
@@ -504,16 +358,13 @@ class ProtoPlayer:
                     self.current_entry_index += 1
                     if self.current_packet_time >= end_time:
                         logging.info("Clip saved!")
-                        self.build_chunk_index(directory)
                         return
                 # Load the next chunk
                 self.current_chunk_index += 1
                 replay_index += 1
 
                 if self.current_chunk_index < len(self.sorted_chunks):
-                    self.current_chunk = ProtoPlayer.load_replay_chunk(
-                        self.sorted_chunks[self.current_chunk_index], self.version
-                    )
+                    self.current_chunk = self.load_chunk(self.current_chunk_index)
                     self.current_entry_index = 0
 
     def play(self) -> None:
@@ -565,9 +416,7 @@ class ProtoPlayer:
             else:
                 # adjust log entry index and fetch the right chunk
                 self.current_entry_index -= len(self.current_chunk)
-                self.current_chunk = ProtoPlayer.load_replay_chunk(
-                    self.sorted_chunks[self.current_chunk_index], self.version
-                )
+                self.current_chunk = self.load_chunk(self.current_chunk_index)
 
         logging.info(
             "Stepped to chunk {} at index {} with timestamp {:.2f}".format(
@@ -578,8 +427,8 @@ class ProtoPlayer:
         )
 
     def seek(self, seek_time: float) -> None:
-        """Seeks to a specific time. We binary search through the chunks
-        to find the chunk that would contain the data at the given time.
+        """Seeks to a specific time. We look up the chunk that would contain
+        the data at the given time in the replay time index.
 
         We then binary search the entries in the chunk to find the entry
         cloest to the given time.
@@ -591,40 +440,22 @@ class ProtoPlayer:
         :param seek_time: The time to seek to.
         """
 
-        # Let's binary search through the chunks to find the chunk that starts
-        # with a timestamp less than (but closest to) the seek_time we want
-        # to seek to.
-        def __get_timestamp_for_chunk(chunk: str) -> float:
-            if self.chunks_indices and os.path.basename(chunk) in self.chunks_indices:
-                return self.chunks_indices[os.path.basename(chunk)]
-            else:
-                logging.warning(
-                    "Use old algorithm to jump, which might result in lagging "
-                    + f"Please try deleting {ProtoPlayer.CHUNK_INDEX_FILENAME} in the replay file folder"
-                    + " and re-run Thunderscope to enable the indexing for faster speed!"
-                )
-                chunk = ProtoPlayer.load_replay_chunk(chunk, self.version)
-                start_timestamp, _, _ = ProtoPlayer.unpack_log_entry(
-                    chunk[0], self.version
-                )
-                return start_timestamp
-
+        # Let's look up the chunk that starts with a timestamp less than (but
+        # closest to) the seek_time we want to seek to in the replay time index.
         with self.replay_controls_mutex:
-            self.current_chunk_index = ProtoPlayer.binary_search(
-                self.sorted_chunks, seek_time, key=__get_timestamp_for_chunk
+            self.current_chunk_index = self.replay_reader.getChunkIndexForTime(
+                seek_time
             )
 
         # Let's binary search through the entries in the chunk to find the closest
         # timestamp to seek to
-        def __bisect_entries_by_timestamp(entry: str) -> float:
-            timestamp, _, _ = ProtoPlayer.unpack_log_entry(entry, self.version)
+        def __bisect_entries_by_timestamp(entry: tuple) -> float:
+            timestamp, _, _ = entry
             return timestamp
 
         with self.replay_controls_mutex:
             # Load the chunk that would have the entry
-            self.current_chunk = ProtoPlayer.load_replay_chunk(
-                self.sorted_chunks[self.current_chunk_index], self.version
-            )
+            self.current_chunk = self.load_chunk(self.current_chunk_index)
 
             # Search through the chunk to find the entry that is closest to
             # the seek_time
@@ -734,19 +565,14 @@ class ProtoPlayer:
                 self.current_chunk
             ):
                 with self.replay_controls_mutex:
-                    try:
-                        # Unpack the current entry in the chunk
-                        (
-                            self.current_packet_time,
-                            proto_class,
-                            proto,
-                        ) = ProtoPlayer.unpack_log_entry(
-                            self.current_chunk[self.current_entry_index], self.version
-                        )
-                    except Exception:
-                        self.current_entry_index += 1
-                        logging.error("[ProtoPlayer] Error parsing log entry")
-                        continue
+                    # Entries are already parsed by the replay reader, corrupt
+                    # entries have been dropped while decoding the chunk
+                    (
+                        self.current_packet_time,
+                        _,
+                        proto,
+                    ) = self.current_chunk[self.current_entry_index]
+                    proto_class = type(proto)
                     self.current_entry_index += 1
 
                     # Manage playback speed, if this packet needs to be sent
@@ -767,7 +593,5 @@ class ProtoPlayer:
                     self.current_chunk_index += 1
 
                     if self.current_chunk_index < len(self.sorted_chunks):
-                        self.current_chunk = ProtoPlayer.load_replay_chunk(
-                            self.sorted_chunks[self.current_chunk_index], self.version
-                        )
+                        self.current_chunk = self.load_chunk(self.current_chunk_index)
                         self.current_entry_index = 0
@@ -246,6 +246,10 @@ class RobotCommunication:
                     )
                     force_stop_robot_ids.add(robot_id)
 
+            primitive_set = PrimitiveSet(
+                sequence_number=self.sequence_number,
+                time_sent=Timestamp(epoch_timestamp_seconds=time.time()),
+            )
             for robot_id, primitive in robot_primitives_map.items():
                 if (
                     robot_id not in force_stop_robot_ids
@@ -253,12 +257,11 @@ class RobotCommunication:
                 ):
                     continue
                 primitive.sequence_number = self.sequence_number
-                primitive.time_sent.CopyFrom(
-                    Timestamp(epoch_timestamp_seconds=time.time())
-                )
-                self.communication_manager.send_primitive(
-                    robot_id=robot_id, primitive=primitive
-                )
+                primitive.time_sent.CopyFrom(primitive_set.time_sent)
+                primitive_set.robot_primitives[robot_id].CopyFrom(primitive)
+
+            if primitive_set.robot_primitives:
+                self.communication_manager.send_primitive_set(primitive_set)
 
             self.sequence_number += 1
 
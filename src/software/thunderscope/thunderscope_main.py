@@ -208,6 +208,21 @@ if __name__ == "__main__":
         default=False,
         help="Run unix_full_system under sudo",
     )
+    parser.add_argument(
+        "--compact_primitives",
+        action="store_true",
+        default=False,
+        help="Multicast the primitives of every robot in one compact datagram per frame, instead of sending a protobuf primitive to each robot",
+    )
+    parser.add_argument(
+        "--shared_memory_channels",
+        action="store",
+        type=lambda channels: {
+            channel.strip() for channel in channels.split(",") if channel.strip()
+        },
+        default=set(),
+        help="Comma-separated unix paths (ex. /world,/primitive) to communicate over shared memory instead of unix sockets",
+    )
 
     estop_group = parser.add_mutually_exclusive_group()
     estop_group.add_argument(
@@ -316,6 +331,7 @@ if __name__ == "__main__":
             referee_port=gamecontroller.get_referee_port()
             if gamecontroller
             else SSL_REFEREE_PORT,
+            compact_primitives=args.compact_primitives,
         ) as wifi_communication_manager, RobotCommunication(
             current_proto_unix_io=current_proto_unix_io,
             communication_manager=wifi_communication_manager,
@@ -340,6 +356,7 @@ if __name__ == "__main__":
                     should_restart_on_crash=True,
                     run_sudo=args.sudo,
                     log_level=args.log_level,
+                    shared_memory_channels=args.shared_memory_channels,
                 ) as full_system:
                     full_system.setup_proto_unix_io(current_proto_unix_io)
 
@@ -413,7 +430,10 @@ if __name__ == "__main__":
 
         # Launch all binaries
         with Simulator(
-            args.simulator_runtime_dir, args.debug_simulator, args.enable_realism
+            args.simulator_runtime_dir,
+            args.debug_simulator,
+            args.enable_realism,
+            shared_memory_channels=args.shared_memory_channels,
         ) as simulator, FullSystem(
             path_to_binary=runtime_config.get_blue_runtime_path(),
             full_system_runtime_dir=args.blue_full_system_runtime_dir,
@@ -423,6 +443,7 @@ if __name__ == "__main__":
             run_sudo=args.sudo,
             running_in_realtime=(not args.ci_mode),
             log_level=args.log_level,
+            shared_memory_channels=args.shared_memory_channels,
         ) as blue_fs, FullSystem(
             path_to_binary=runtime_config.get_yellow_runtime_path(),
             full_system_runtime_dir=args.yellow_full_system_runtime_dir,
@@ -432,6 +453,7 @@ if __name__ == "__main__":
             run_sudo=args.sudo,
             running_in_realtime=(not args.ci_mode),
             log_level=args.log_level,
+            shared_memory_channels=args.shared_memory_channels,
         ) as yellow_fs, Gamecontroller(
             suppress_logs=(not args.verbose),
             automate_referee=args.enable_autogc,
@@ -33,6 +33,7 @@ class WifiCommunicationManager:
         should_setup_full_system: bool = False,
         interface: str | None = None,
         referee_port: int = SSL_REFEREE_PORT,
+        compact_primitives: bool = False,
     ):
         """Sets up WiFi communication between this computer and the robots, SSL Vision, and SSL Referee
 
@@ -40,6 +41,8 @@ class WifiCommunicationManager:
         :param multicast_channel: The multicast channel to use
         :param interface: The interface to use for communication with the robots
         :param referee_port: the referee port that we are using. If this is None, the default port is used
+        :param compact_primitives: whether to multicast the primitives of every robot in one
+            compact datagram per frame instead of sending a protobuf primitive to each robot
         """
         ## Robot IP address tracking ##
         self.robot_ip_addresses: list[tuple[Lock, str | None]] = [
@@ -50,6 +53,8 @@ class WifiCommunicationManager:
         self.primitive_senders: list[tuple[Lock, tbots_cpp.PrimitiveSender | None]] = [
             (Lock(), None) for _ in range(MAX_ROBOT_IDS_PER_SIDE)
         ]
+        self.compact_primitives = compact_primitives
+        self.compact_primitive_set_sender: tbots_cpp.UdpSender | None = None
         self.receive_robot_status: tbots_cpp.RobotStatusProtolistener | None = None
         self.receive_robot_log: tbots_cpp.RobotLogProtolistener | None = None
         self.receive_robot_crash: tbots_cpp.RobotCrashProtolistener | None = None
@@ -233,6 +238,7 @@ class WifiCommunicationManager:
                     referee_interface,
                     lambda data: self.__forward_to_proto_unix_io(Referee, data),
                     True,
+                    batch_receive=True,
                 )
                 self.current_network_config.referee_interface = referee_interface
             except tbots_cpp.TbotsNetworkException as e:
@@ -249,6 +255,7 @@ class WifiCommunicationManager:
                         SSL_WrapperPacket, data
                     ),
                     True,
+                    batch_receive=True,
                 )
                 self.current_network_config.vision_interface = vision_interface
             except tbots_cpp.TbotsNetworkException as e:
@@ -279,7 +286,7 @@ class WifiCommunicationManager:
         if self.receive_robot_status is None:
             self.receive_robot_status = setup_network_resource(
                 lambda: tbots_cpp.RobotStatusProtoListener(
-                    ROBOT_STATUS_PORT, self.__receive_robot_status
+                    ROBOT_STATUS_PORT, self.__receive_robot_status, batch_receive=True
                 )
             )
 
@@ -332,6 +339,16 @@ class WifiCommunicationManager:
             )
         )
 
+        if self.compact_primitives:
+            self.compact_primitive_set_sender = setup_network_resource(
+                lambda: tbots_cpp.UdpSender(
+                    self.multicast_channel,
+                    COMPACT_PRIMITIVE_SET_PORT,
+                    robot_communication_interface,
+                    True,
+                )
+            )
+
         local_ip = tbots_cpp.get_local_ip(robot_communication_interface, True)
         if local_ip:
             with self.fullsystem_ip_broadcaster[0]:
@@ -399,6 +416,24 @@ class WifiCommunicationManager:
             self.accept_next_network_config = True
             self.__print_current_network_config()
 
+    def send_primitive_set(self, primitive_set: PrimitiveSet) -> None:
+        """Send the primitives in the given primitive set to their robots
+
+        With compact primitives, the whole set is multicast to every robot in one
+        datagram. Otherwise, each primitive is sent to its robot on its own.
+
+        :param primitive_set: the primitive set to send
+        """
+        compact_primitive_set_sender = self.compact_primitive_set_sender
+        if compact_primitive_set_sender is not None:
+            compact_primitive_set_sender.send_string(
+                tbots_cpp.encodeCompactPrimitiveSet(primitive_set), True
+            )
+            return
+
+        for robot_id, primitive in primitive_set.robot_primitives.items():
+            self.send_primitive(robot_id=robot_id, primitive=primitive)
+
     def send_primitive(self, robot_id: int, primitive: Primitive) -> None:
         """Send the given primitive to the robot with the given id
 
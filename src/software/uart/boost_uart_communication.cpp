@@ -36,18 +36,23 @@ bool BoostUartCommunication::flushSerialPort(FlushType flush_type)
 void BoostUartCommunication::openPort(IoService& ioService, int baud_rate,
                                       std::string device_serial_port)
 {
-    int uart_character_size_bits = 8;
     serial_port = SerialPortPtr(std::make_shared<boost::asio::serial_port>(
         boost::asio::serial_port(ioService, device_serial_port)));
+    configureSerialPort(*serial_port, baud_rate);
+}
 
-    serial_port->set_option(boost::asio::serial_port_base::baud_rate(baud_rate));
-    serial_port->set_option(boost::asio::serial_port::flow_control(
+void BoostUartCommunication::configureSerialPort(boost::asio::serial_port& serial_port,
+                                                 int baud_rate)
+{
+    int uart_character_size_bits = 8;
+    serial_port.set_option(boost::asio::serial_port_base::baud_rate(baud_rate));
+    serial_port.set_option(boost::asio::serial_port::flow_control(
         boost::asio::serial_port::flow_control::none));
-    serial_port->set_option(
+    serial_port.set_option(
         boost::asio::serial_port::parity(boost::asio::serial_port::parity::none));
-    serial_port->set_option(
+    serial_port.set_option(
         boost::asio::serial_port::stop_bits(boost::asio::serial_port::stop_bits::one));
-    serial_port->set_option(boost::asio::serial_port::character_size(
+    serial_port.set_option(boost::asio::serial_port::character_size(
         boost::asio::serial_port::character_size(uart_character_size_bits)));
 }
 
@@ -68,6 +68,16 @@ class BoostUartCommunication : public UartCommunication
      */
     bool flushSerialPort(FlushType flush_type) override;
 
+    /**
+     * Applies the settings used for all of our serial devices to the given port:
+     * 8 bit data, No flow control, No parity, 1 stop bit
+     *
+     * @param serial_port the opened serial port to configure
+     * @param baud_rate the desired baud rate of the connection
+     * @throws boost::exception if an option could not be set
+     */
+    static void configureSerialPort(boost::asio::serial_port& serial_port, int baud_rate);
+
    private:
     /**
      * Attempts to open a serial connection with the given device port
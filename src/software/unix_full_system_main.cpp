@@ -17,8 +17,9 @@
 #include "software/logger/logger.h"
 #include "software/logger/proto_logger.h"
 #include "software/multithreading/observer_subject_adapter.hpp"
+#include "software/networking/ipc/ipc_channel_config.h"
+#include "software/networking/ipc/threaded_proto_ipc_listener.hpp"
 #include "software/networking/udp/threaded_proto_udp_listener.hpp"
-#include "software/networking/unix/threaded_proto_unix_listener.hpp"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
 #include "software/util/generic_factory/generic_factory.h"
 
@@ -78,11 +79,12 @@ int main(int argc, char** argv)
     // Setup dynamic parameters
     struct CommandLineArgs
     {
-        bool help                   = false;
-        std::string runtime_dir     = "/tmp/tbots";
-        bool friendly_colour_yellow = false;
-        bool ci                     = false;
-        std::string log_level       = "DEBUG";
+        bool help                          = false;
+        std::string runtime_dir            = "/tmp/tbots";
+        bool friendly_colour_yellow        = false;
+        bool ci                            = false;
+        std::string log_level              = "DEBUG";
+        std::string shared_memory_channels = "";
     };
 
     CommandLineArgs args;
@@ -102,6 +104,11 @@ int main(int argc, char** argv)
     desc.add_options()(
         "log_level", boost::program_options::value<std::string>(&args.log_level),
         "The minimum g3log level that will be printed (DEBUG|INFO|WARNING|FATAL)");
+    desc.add_options()(
+        "shared_memory_channels",
+        boost::program_options::value<std::string>(&args.shared_memory_channels),
+        "Comma-separated list of the channels in the runtime directory that use shared "
+        "memory instead of unix sockets (ex. /world,/primitive)");
 
     boost::program_options::variables_map vm;
     boost::program_options::store(parse_command_line(argc, argv, desc), vm);
@@ -151,16 +158,17 @@ int main(int argc, char** argv)
         }
         proto_logger = std::make_shared<ProtoLogger>(args.runtime_dir, time_provider,
                                                      args.friendly_colour_yellow);
+        const IpcChannelConfig ipc_channel_config(args.shared_memory_channels);
         LoggerSingleton::initializeLogger(args.runtime_dir, proto_logger, true,
-                                          *minimum_log_level);
+                                          *minimum_log_level, ipc_channel_config);
         TbotsProto::ThunderbotsConfig tbots_proto;
 
         // Override friendly color
         tbots_proto.mutable_sensor_fusion_config()->set_friendly_color_yellow(
             args.friendly_colour_yellow);
 
-        auto backend =
-            std::make_shared<UnixSimulatorBackend>(args.runtime_dir, proto_logger);
+        auto backend = std::make_shared<UnixSimulatorBackend>(
+            args.runtime_dir, proto_logger, ipc_channel_config);
         if (args.ci)
         {
             // Update the time provider for ProtoLogger
@@ -174,13 +182,15 @@ int main(int argc, char** argv)
 
         // Overrides
         auto tactic_override_listener =
-            ThreadedProtoUnixListener<TbotsProto::AssignedTacticPlayControlParams>(
+            ThreadedProtoIpcListener<TbotsProto::AssignedTacticPlayControlParams>(
                 args.runtime_dir + TACTIC_OVERRIDE_PATH,
+                ipc_channel_config.getTransport(TACTIC_OVERRIDE_PATH),
                 [&ai](TbotsProto::AssignedTacticPlayControlParams input)
                 { ai->overrideTactics(input); });
 
-        auto play_override_listener = ThreadedProtoUnixListener<TbotsProto::Play>(
+        auto play_override_listener = ThreadedProtoIpcListener<TbotsProto::Play>(
             args.runtime_dir + PLAY_OVERRIDE_PATH,
+            ipc_channel_config.getTransport(PLAY_OVERRIDE_PATH),
             [&ai](TbotsProto::Play input_play) { ai->overridePlay(input_play); });
 
         // Connect observers
@@ -0,0 +1,178 @@
+#include "software/util/allocation_counter/allocation_counter.h"
+
+#include <Tracy.hpp>
+#include <cstdlib>
+#include <new>
+
+// Totals for the allocations made by each thread. The totals are only updated while at
+// least one ScopedAllocationCounter is alive on the thread, so that threads which never
+// count allocations only pay for a thread local read.
+static thread_local std::size_t num_active_counters   = 0;
+static thread_local std::size_t total_num_allocations = 0;
+static thread_local std::size_t total_num_bytes       = 0;
+
+/**
+ * Allocates memory for operator new and records the allocation
+ *
+ * @param size the number of bytes to allocate
+ * @param alignment the alignment of the allocation
+ *
+ * @return the allocated memory, or nullptr if the allocation failed
+ */
+static void* countedAllocate(std::size_t size, std::size_t alignment)
+{
+    if (num_active_counters > 0)
+    {
+        total_num_allocations++;
+        total_num_bytes += size;
+    }
+
+    // malloc and aligned_alloc do not guarantee a unique pointer for 0 byte
+    // allocations, which operator new must return
+    const std::size_t allocated_size = size == 0 ? 1 : size;
+    void* ptr                        = nullptr;
+    if (alignment <= alignof(std::max_align_t))
+    {
+        ptr = std::malloc(allocated_size);
+    }
+    else
+    {
+        // aligned_alloc requires the size to be a multiple of the alignment
+        ptr = std::aligned_alloc(
+            alignment, (allocated_size + alignment - 1) / alignment * alignment);
+    }
+
+    // Feeds Tracy's memory profiler when built with TRACY_ENABLE, and does nothing
+    // otherwise
+    if (ptr != nullptr)
+    {
+        TracyAlloc(ptr, size);
+    }
+    return ptr;
+}
+
+/**
+ * Frees memory allocated by countedAllocate
+ *
+ * @param ptr the memory to free, or nullptr
+ */
+static void countedFree(void* ptr)
+{
+    if (ptr != nullptr)
+    {
+        TracyFree(ptr);
+    }
+    std::free(ptr);
+}
+
+/**
+ * Allocates memory for a throwing operator new
+ *
+ * @param size the number of bytes to allocate
+ * @param alignment the alignment of the allocation
+ *
+ * @throws std::bad_alloc if the allocation failed
+ *
+ * @return the allocated memory
+ */
+static void* countedAllocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    void* ptr = countedAllocate(size, alignment);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+ScopedAllocationCounter::ScopedAllocationCounter()
+    : start_num_allocations_(total_num_allocations),
+      start_num_bytes_allocated_(total_num_bytes)
+{
+    num_active_counters++;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter()
+{
+    num_active_counters--;
+}
+
+std::size_t ScopedAllocationCounter::getNumAllocations() const
+{
+    return total_num_allocations - start_num_allocations_;
+}
+
+std::size_t ScopedAllocationCounter::getNumBytesAllocated() const
+{
+    return total_num_bytes - start_num_bytes_allocated_;
+}
+
+void* operator new(std::size_t size)
+{
+    return countedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAllocate(size, alignof(std::max_align_t));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    countedFree(ptr);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Counts the heap allocations made by the current thread while it is alive.
+ *
+ * Linking in the allocation_counter library replaces the global operator new and
+ * operator delete with versions that count allocations, so that tests and benchmarks
+ * can check that code meant to run in a real-time loop does not allocate. Only the
+ * allocations made on the thread that created the counter are counted. Counters may
+ * be nested, in which case every active counter on the thread counts each allocation.
+ *
+ * When built with TRACY_ENABLE, every allocation and free is also reported to Tracy's
+ * memory profiler, which attributes them to the Tracy zone they were made in.
+ *
+ * Host binaries that aren't tests or benchmarks only link this library in when built
+ * with --//software/util/allocation_counter:track_allocations, which also defines
+ * TRACK_ALLOCATIONS for the libraries that report allocations per AI tick.
+ *
+ * This library must not be linked into binaries that run on the robot.
+ */
+class ScopedAllocationCounter
+{
+   public:
+    /**
+     * Starts counting the heap allocations made by the current thread
+     */
+    ScopedAllocationCounter();
+
+    ~ScopedAllocationCounter();
+
+    ScopedAllocationCounter(const ScopedAllocationCounter&)            = delete;
+    ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+
+    /**
+     * Gets the number of heap allocations made by the current thread since this
+     * counter was created
+     *
+     * @return the number of allocations
+     */
+    std::size_t getNumAllocations() const;
+
+    /**
+     * Gets the total number of bytes requested by the heap allocations made by the
+     * current thread since this counter was created
+     *
+     * @return the number of bytes allocated
+     */
+    std::size_t getNumBytesAllocated() const;
+
+   private:
+    std::size_t start_num_allocations_;
+    std::size_t start_num_bytes_allocated_;
+};
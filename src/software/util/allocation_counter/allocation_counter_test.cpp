@@ -0,0 +1,60 @@
+#include "software/util/allocation_counter/allocation_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(AllocationCounterTest, test_no_allocations)
+{
+    ScopedAllocationCounter counter;
+    std::array<int, 16> values = {};
+    values[3]                  = 4;
+
+    EXPECT_EQ(counter.getNumAllocations(), 0);
+    EXPECT_EQ(counter.getNumBytesAllocated(), 0);
+}
+
+TEST(AllocationCounterTest, test_counts_allocations)
+{
+    ScopedAllocationCounter counter;
+    auto value = std::make_unique<int>(4);
+    std::vector<char> buffer(100);
+
+    EXPECT_EQ(counter.getNumAllocations(), 2);
+    EXPECT_GE(counter.getNumBytesAllocated(), sizeof(int) + 100);
+}
+
+TEST(AllocationCounterTest, test_nested_counters)
+{
+    ScopedAllocationCounter outer_counter;
+    auto first = std::make_unique<int>(1);
+    {
+        ScopedAllocationCounter inner_counter;
+        auto second = std::make_unique<int>(2);
+        EXPECT_EQ(inner_counter.getNumAllocations(), 1);
+    }
+    EXPECT_EQ(outer_counter.getNumAllocations(), 2);
+}
+
+TEST(AllocationCounterTest, test_ignores_allocations_on_other_threads)
+{
+    ScopedAllocationCounter counter;
+    std::unique_ptr<std::thread> thread;
+    const std::size_t num_allocations_before_thread = counter.getNumAllocations();
+
+    thread = std::make_unique<std::thread>(
+        []()
+        {
+            std::vector<int> values(1000);
+            values[0] = 1;
+        });
+    const std::size_t num_allocations_after_thread = counter.getNumAllocations();
+    thread->join();
+
+    // Only the allocations made to start the thread are counted
+    EXPECT_EQ(counter.getNumAllocations(), num_allocations_after_thread);
+    EXPECT_GT(num_allocations_after_thread, num_allocations_before_thread);
+}
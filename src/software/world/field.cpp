@@ -56,7 +56,17 @@ Field::Field(double field_x_length, double field_y_length, double defense_x_leng
           Point(enemyGoalCenter().x() + goalXLength(), enemyGoalpostNeg().y()))),
       friendly_goal_(Rectangle(
           Point(friendlyGoalCenter().x() - goalXLength(), friendlyGoalpostPos().y()),
-          Point(friendlyGoalCenter().x(), friendlyGoalpostNeg().y())))
+          Point(friendlyGoalCenter().x(), friendlyGoalpostNeg().y()))),
+      friendly_half_(friendlyCornerNeg(), Point(0, friendlyCornerPos().y())),
+      friendly_positive_y_quadrant_(friendlyGoalCenter(),
+                                    Point(0, friendlyCornerPos().y())),
+      friendly_negative_y_quadrant_(friendlyGoalCenter(),
+                                    Point(0, friendlyCornerNeg().y())),
+      enemy_half_(Point(0, enemyCornerNeg().y()), enemyCornerPos()),
+      enemy_positive_y_quadrant_(centerPoint(), enemyCornerPos()),
+      enemy_negative_y_quadrant_(centerPoint(), enemyCornerNeg()),
+      field_boundary_(Point(-totalXLength() / 2, -totalYLength() / 2),
+                      Point(totalXLength() / 2, totalYLength() / 2))
 {
     if (field_x_length_ <= 0 || field_y_length <= 0 || defense_x_length_ <= 0 ||
         defense_y_length_ <= 0 || goal_x_length_ <= 0 || goal_y_length_ <= 0 ||
@@ -125,34 +135,34 @@ const Rectangle& Field::enemyDefenseArea() const
     return enemy_defense_area_;
 }
 
-Rectangle Field::friendlyHalf() const
+const Rectangle& Field::friendlyHalf() const
 {
-    return Rectangle(friendlyCornerNeg(), Point(0, friendlyCornerPos().y()));
+    return friendly_half_;
 }
 
-Rectangle Field::friendlyPositiveYQuadrant() const
+const Rectangle& Field::friendlyPositiveYQuadrant() const
 {
-    return Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerPos().y()));
+    return friendly_positive_y_quadrant_;
 }
 
-Rectangle Field::friendlyNegativeYQuadrant() const
+const Rectangle& Field::friendlyNegativeYQuadrant() const
 {
-    return Rectangle(friendlyGoalCenter(), Point(0, friendlyCornerNeg().y()));
+    return friendly_negative_y_quadrant_;
 }
 
-Rectangle Field::enemyHalf() const
+const Rectangle& Field::enemyHalf() const
 {
-    return Rectangle(Point(0, enemyCornerNeg().y()), enemyCornerPos());
+    return enemy_half_;
 }
 
-Rectangle Field::enemyPositiveYQuadrant() const
+const Rectangle& Field::enemyPositiveYQuadrant() const
 {
-    return Rectangle(centerPoint(), enemyCornerPos());
+    return enemy_positive_y_quadrant_;
 }
 
-Rectangle Field::enemyNegativeYQuadrant() const
+const Rectangle& Field::enemyNegativeYQuadrant() const
 {
-    return Rectangle(centerPoint(), enemyCornerNeg());
+    return enemy_negative_y_quadrant_;
 }
 
 const Rectangle& Field::fieldLines() const
@@ -160,11 +170,9 @@ const Rectangle& Field::fieldLines() const
     return field_lines_;
 }
 
-Rectangle Field::fieldBoundary() const
+const Rectangle& Field::fieldBoundary() const
 {
-    Point neg_x_neg_y_corner(-totalXLength() / 2, -totalYLength() / 2);
-    Point pos_x_pos_y_corner(totalXLength() / 2, totalYLength() / 2);
-    return Rectangle(neg_x_neg_y_corner, pos_x_pos_y_corner);
+    return field_boundary_;
 }
 
 double Field::centerCircleRadius() const
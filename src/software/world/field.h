@@ -203,42 +203,42 @@ class Field
      *
      * @return the friendly half of the field
      */
-    Rectangle friendlyHalf() const;
+    const Rectangle& friendlyHalf() const;
 
     /**
      * Gets the friendly positive Y quadrant of the field
      *
      * @return the friendly positive Y quadrant of the field
      */
-    Rectangle friendlyPositiveYQuadrant() const;
+    const Rectangle& friendlyPositiveYQuadrant() const;
 
     /**
      * Gets the friendly negative Y quadrant of the field
      *
      * @return the friendly negative Y quadrant of the field
      */
-    Rectangle friendlyNegativeYQuadrant() const;
+    const Rectangle& friendlyNegativeYQuadrant() const;
 
     /**
      * Gets the enemy half of the field within field lines
      *
      * @return the enemy half of the field
      */
-    Rectangle enemyHalf() const;
+    const Rectangle& enemyHalf() const;
 
     /**
      * Gets the enemy positive Y quadrant of the field
      *
      * @return the enemy positive Y quadrant of the field
      */
-    Rectangle enemyPositiveYQuadrant() const;
+    const Rectangle& enemyPositiveYQuadrant() const;
 
     /**
      * Gets the enemy negative Y quadrant of the field
      *
      * @return the enemy negative Y quadrant of the field
      */
-    Rectangle enemyNegativeYQuadrant() const;
+    const Rectangle& enemyNegativeYQuadrant() const;
 
     /**
      * Gets the area within the field lines as a rectangle. This is the set of locations
@@ -255,7 +255,7 @@ class Field
      *
      * @return The area within the field boundary as a rectangle
      */
-    Rectangle fieldBoundary() const;
+    const Rectangle& fieldBoundary() const;
 
     /**
      * Gets the position of the centre of the friendly goal.
@@ -459,6 +459,13 @@ class Field
     Rectangle field_lines_;
     Rectangle enemy_goal_;
     Rectangle friendly_goal_;
+    Rectangle friendly_half_;
+    Rectangle friendly_positive_y_quadrant_;
+    Rectangle friendly_negative_y_quadrant_;
+    Rectangle enemy_half_;
+    Rectangle enemy_positive_y_quadrant_;
+    Rectangle enemy_negative_y_quadrant_;
+    Rectangle field_boundary_;
 };
 
 namespace std
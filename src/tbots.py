@@ -37,6 +37,7 @@ from cli.cli_params import (
     SSHPasswordOption,
     StopAIOnStartOption,
     TestSuiteOption,
+    TrackAllocationsOption,
     TracyOption,
 )
 
@@ -74,6 +75,7 @@ class BuildConfig:
     ssh_password: str | None = None
     interactive_search: bool = False
     tracy: bool = False
+    track_allocations: bool = False
     test_suite: bool = False
     enable_thunderscope: bool = False
     stop_ai_on_start: bool = False
@@ -91,6 +93,7 @@ class BazelFlag(tuple, Enum):
     OPTIMIZED = ("--copt=-O3",)
     ROBOT_PLATFORM = ("--platforms=//toolchains/cc:robot",)
     TRACY = ("--cxxopt=-DTRACY_ENABLE",)
+    TRACK_ALLOCATIONS = ("--//software/util/allocation_counter:track_allocations",)
     THUNDERSCOPE = ("--spawn_strategy=local", "--test_env=DISPLAY=:0")
     NO_CACHE_TESTS = ("--cache_test_results=false",)
     DEBUG_POWERLOOP = ("--//software/power:debug_powerloop",)
@@ -116,6 +119,7 @@ def main(
     ssh_password: SSHPasswordOption = None,
     interactive_search: InteractiveModeOption = False,
     tracy: TracyOption = False,
+    track_allocations: TrackAllocationsOption = False,
     test_suite: TestSuiteOption = False,
     enable_thunderscope: EnableThunderscopeOption = False,
     stop_ai_on_start: StopAIOnStartOption = False,
@@ -142,6 +146,7 @@ def main(
     :param ssh_password: password Ansible uses when SSHing into the robots
     :param interactive_search: enable interactive fuzzy target selection
     :param tracy: build with the TRACY_ENABLE macro defined
+    :param track_allocations: build with the heap allocations of each AI tick counted
     :param test_suite: run the entire test suite instead of a single target
     :param enable_thunderscope: launch with Thunderscope enabled
     :param stop_ai_on_start: start the binary with the AI paused
@@ -164,6 +169,7 @@ def main(
         ssh_password=ssh_password,
         interactive_search=interactive_search,
         tracy=tracy,
+        track_allocations=track_allocations,
         test_suite=test_suite,
         enable_thunderscope=enable_thunderscope,
         stop_ai_on_start=stop_ai_on_start,
@@ -231,6 +237,7 @@ def create_command(config: BuildConfig, extra_args: list[str]) -> list[str]:
         and (not config.no_optimized_build or bool(config.flash_robots)),
         BazelFlag.ROBOT_PLATFORM: bool(config.flash_robots or config.ansible_playbook),
         BazelFlag.TRACY: config.tracy,
+        BazelFlag.TRACK_ALLOCATIONS: config.track_allocations,
         BazelFlag.THUNDERSCOPE: config.enable_thunderscope,
         BazelFlag.NO_CACHE_TESTS: config.action == ActionArgument.test,
         BazelFlag.DEBUG_POWERLOOP: config.debug_powerloop,